@@ -63,6 +63,14 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
   putNextEntry( ZipCDirEntry(entryName));
 }
 
+void ZipOutputStream::putRawEntry( const ZipCDirEntry &entry, int alignment ) {
+  ozf->putRawEntry( entry, alignment ) ;
+}
+
+void ZipOutputStream::writeRawData( const char *data, std::streamsize size ) {
+  ozf->writeRawData( data, size ) ;
+}
+
 
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
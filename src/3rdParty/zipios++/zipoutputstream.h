@@ -54,6 +54,14 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Begins writing an entry whose data is already deflated or stored.
+      The method, crc, size and compressed size of entry must be set.
+      @see ZipOutputStreambuf::putRawEntry() */
+  void putRawEntry( const ZipCDirEntry &entry, int alignment = 1 ) ;
+
+  /** Writes data of the entry begun with putRawEntry() unchanged. */
+  void writeRawData( const char *data, std::streamsize size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
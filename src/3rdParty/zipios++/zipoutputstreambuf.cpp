@@ -18,6 +18,16 @@ using std::endl ;
 using std::min ;
 using std::vector ;
 
+static int currentDosTime() {
+  // Mark Donszelmann: added current date and time
+  time_t ltime;
+  time( &ltime );
+  struct tm *now;
+  now = localtime( &ltime );
+  return (now->tm_year - 80) << 25 | (now->tm_mon + 1) << 21 | now->tm_mday << 16 |
+         now->tm_hour << 11 | now->tm_min << 5 | now->tm_sec >> 1;
+}
+
 ZipOutputStreambuf::ZipOutputStreambuf( streambuf *outbuf, bool del_outbuf ) 
   : DeflateOutputStreambuf( outbuf, false, del_outbuf ),
     _open_entry( false    ),
@@ -81,6 +91,46 @@ void ZipOutputStreambuf::putNextEntry( const ZipCDirEntry &entry ) {
 }
 
 
+void ZipOutputStreambuf::putRawEntry( const ZipCDirEntry &entry, int alignment ) {
+  if ( _open_entry )
+    closeEntry() ;
+
+  _entries.push_back( entry ) ;
+  ZipCDirEntry &ent = _entries.back() ;
+
+  ostream os( _outbuf ) ;
+
+  // The sizes are known up front, so the header is final right away
+  ent.setLocalHeaderOffset( os.tellp() ) ;
+  ent.setTime( currentDosTime() ) ;
+
+  if ( alignment > 1 ) {
+    // Pad with the alignment extra field (id 0xd935) also used by zipalign:
+    // the alignment as 16 bit value followed by zeros
+    const int field_header = 6 ;
+    int offset = ent.getLocalHeaderOffset() + ent.getLocalHeaderSize() + field_header ;
+    int padding = ( alignment - offset % alignment ) % alignment ;
+    vector< unsigned char > extra = ent.getExtra() ;
+    int data_size = 2 + padding ;
+    extra.push_back( 0x35 ) ;
+    extra.push_back( 0xd9 ) ;
+    extra.push_back( static_cast< unsigned char >( data_size & 0xff ) ) ;
+    extra.push_back( static_cast< unsigned char >( data_size >> 8 ) ) ;
+    extra.push_back( static_cast< unsigned char >( alignment & 0xff ) ) ;
+    extra.push_back( static_cast< unsigned char >( ( alignment >> 8 ) & 0xff ) ) ;
+    extra.insert( extra.end(), padding, 0 ) ;
+    ent.setExtra( extra ) ;
+  }
+
+  os << static_cast< ZipLocalEntry >( ent ) ;
+}
+
+
+void ZipOutputStreambuf::writeRawData( const char *data, std::streamsize size ) {
+  _outbuf->sputn( data, size ) ;
+}
+
+
 void ZipOutputStreambuf::setComment( const string &comment ) {
   _zip_comment = comment ;
 }
@@ -146,14 +196,7 @@ void ZipOutputStreambuf::updateEntryHeaderInfo() {
   entry.setCompressedSize( curr_pos - entry.getLocalHeaderOffset() 
 			   - entry.getLocalHeaderSize() ) ;
 
-  // Mark Donszelmann: added current date and time
-  time_t ltime;
-  time( &ltime );
-  struct tm *now;
-  now = localtime( &ltime );
-  int dosTime = (now->tm_year - 80) << 25 | (now->tm_mon + 1) << 21 | now->tm_mday << 16 |
-              now->tm_hour << 11 | now->tm_min << 5 | now->tm_sec >> 1;
-  entry.setTime(dosTime);
+  entry.setTime( currentDosTime() ) ;
 
   // write ZipLocalEntry header to header position
   os.seekp( entry.getLocalHeaderOffset() ) ;
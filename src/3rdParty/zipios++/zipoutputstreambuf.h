@@ -49,6 +49,18 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Begins writing an entry whose data is already in its final form,
+      i.e. deflated or stored. The method, crc, size and compressed size
+      of entry must be set, and exactly getCompressedSize() bytes must be
+      passed to writeRawData() before the next entry is put. If alignment
+      is greater than one, the local header is padded with an extra field
+      so that the data starts at a multiple of alignment in the archive. */
+  void putRawEntry( const ZipCDirEntry &entry, int alignment = 1 ) ;
+
+  /** Writes data of the entry begun with putRawEntry() unchanged to the
+      archive. */
+  void writeRawData( const char *data, std::streamsize size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
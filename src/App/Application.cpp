@@ -37,6 +37,8 @@
 # include <boost/date_time/posix_time/posix_time.hpp>
 # include <boost/scope_exit.hpp>
 # include <chrono>
+# include <condition_variable>
+# include <exception>
 # include <random>
 # include <memory>
 # include <utility>
@@ -45,6 +47,7 @@
 # include <algorithm>
 # include <iostream>
 # include <map>
+# include <mutex>
 # include <tuple>
 # include <vector>
 # include <fmt/format.h>
@@ -523,6 +526,24 @@ bool Application::closeDocument(const char* name)
 
     Base::ConsoleRefreshDisabler disabler;
 
+    // A running recompute still uses the document
+    if (pos->second->isRecomputingAsync()) {
+        pos->second->abortRecompute();
+        pos->second->waitForRecompute();
+    }
+    // A running save must finish writing the file
+    if (pos->second->isSavingAsync()) {
+        try {
+            pos->second->waitForSave();
+        }
+        catch (const Base::Exception& e) {
+            e.reportException();
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Failed to save document " << name << ": " << e.what());
+        }
+    }
+
     // Trigger observers before removing the document from the internal map.
     // Some observers might rely on this document still being there.
     signalDeleteDocument(*pos->second);
@@ -582,6 +603,225 @@ std::vector<Document*> Application::getDocuments() const
     return docs;
 }
 
+std::vector<Document*> Application::loadPartialDocuments(const std::vector<Document*>& docs)
+{
+    std::vector<std::string> files;
+    for (auto doc : docs.empty() ? getDocuments() : docs) {
+        if (doc->testStatus(Document::PartialDoc) || doc->testStatus(Document::PartialRestore)) {
+            files.emplace_back(doc->FileName.getValue());
+        }
+    }
+    if (files.empty()) {
+        return {};
+    }
+
+    // A document given as file name is opened fully, an open partial document
+    // of that file is closed first
+    FC_LOG("Loading " << files.size() << " partial documents");
+    Document* active = getActiveDocument();
+    std::string activeFile = active ? active->FileName.getValue() : "";
+    std::vector<std::string> errs(files.size());
+    DocumentInitFlags initFlags {
+        .createView = false
+    };
+    std::vector<Document*> res = openDocuments(files, nullptr, nullptr, &errs, initFlags);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (!errs[i].empty()) {
+            FC_ERR("Failed to load partial document " << files[i] << ": " << errs[i]);
+        }
+    }
+
+    // keep the active document, the reloaded one if it was partial
+    if (Document* doc = getDocumentByPath(activeFile.c_str())) {
+        setActiveDocument(doc);
+    }
+    return res;
+}
+
+int Application::recomputeDocuments(const std::vector<Document*>& docs, bool force, bool* hasError)
+{
+    // the documents in dependency order, including the ones the given documents link to
+    std::vector<Document*> sorted =
+        Document::getDependentDocuments(docs.empty() ? getDocuments() : docs, true);
+
+    // Partial documents only hold the objects linked by other documents and are
+    // read-only, so load the ones that need a recompute before
+    std::vector<Document*> partialDocs;
+    for (auto doc : sorted) {
+        if (doc->testStatus(Document::PartialDoc) && doc->mustExecute()) {
+            partialDocs.push_back(doc);
+        }
+    }
+    if (!partialDocs.empty()) {
+        // The reloaded documents are new objects, find the given ones by their files.
+        // The other given documents are kept, they may not have been saved yet.
+        std::set<Document*> reloading(partialDocs.begin(), partialDocs.end());
+        std::vector<std::pair<std::size_t, std::string>> files;
+        for (std::size_t i = 0; i < docs.size(); ++i) {
+            if (reloading.count(docs[i])) {
+                files.emplace_back(i, docs[i]->FileName.getValue());
+            }
+        }
+        loadPartialDocuments(partialDocs);
+
+        std::vector<Document*> givenDocs = docs;
+        for (const auto& [index, file] : files) {
+            givenDocs[index] = getDocumentByPath(file.c_str());
+        }
+        givenDocs.erase(std::remove(givenDocs.begin(), givenDocs.end(), nullptr), givenDocs.end());
+        if (!docs.empty() && givenDocs.empty()) {
+            return 0;
+        }
+        sorted = Document::getDependentDocuments(docs.empty() ? getDocuments() : givenDocs, true);
+    }
+
+    // Each document only recomputes its own objects, the linked objects of other
+    // documents have been recomputed before.
+    auto checkErrors = [hasError](Document* doc) {
+        if (hasError) {
+            for (auto obj : doc->getObjects()) {
+                if (doc->getErrorDescription(obj)) {
+                    *hasError = true;
+                    break;
+                }
+            }
+        }
+    };
+
+    ParameterGrp::handle hGrp = GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+
+    int objectCount = 0;
+    if (!parallel || sorted.size() < 2) {
+        for (auto doc : sorted) {
+            objectCount += doc->recompute({}, force, hasError, Document::DepNoXLinked);
+        }
+        return objectCount;
+    }
+
+    // the number of documents each document waits for and the documents waiting for it
+    std::map<Document*, int> pending;
+    std::map<Document*, std::vector<Document*>> dependents;
+    auto outLists = PropertyXLink::getDocumentOutList();
+    for (auto doc : sorted) {
+        pending[doc] = 0;
+    }
+    for (auto doc : sorted) {
+        auto it = outLists.find(doc);
+        if (it == outLists.end()) {
+            continue;
+        }
+        for (auto depDoc : it->second) {
+            if (depDoc != doc && pending.count(depDoc)) {
+                ++pending[doc];
+                dependents[depDoc].push_back(doc);
+            }
+        }
+    }
+
+    std::list<Document*> ready;
+    for (auto doc : sorted) {
+        if (pending[doc] == 0) {
+            ready.push_back(doc);
+        }
+    }
+
+    auto finish = [&](Document* doc) {
+        checkErrors(doc);
+        for (auto depDoc : dependents[doc]) {
+            if (--pending[depDoc] == 0) {
+                ready.push_back(depDoc);
+            }
+        }
+    };
+
+    // The workers wake up this thread whenever a notification is waiting or a
+    // document is done, through the main thread hook of their document
+    std::mutex eventMutex;
+    std::condition_variable eventCondition;
+    bool event = false;
+    auto notifyEvent = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(eventMutex);
+            event = true;
+        }
+        eventCondition.notify_all();
+    };
+
+    // Every document recomputes on its own worker thread and hands its
+    // notifications over to this thread, which starts the waiting documents
+    // as soon as the documents they link to are done.
+    FC_TIME_INIT(t);
+    std::list<Document*> running;
+    std::map<Document*, Document::MainThreadHook> hooks;
+    std::exception_ptr error;
+    while (!ready.empty() || !running.empty()) {
+        while (!ready.empty()) {
+            Document* doc = ready.front();
+            ready.pop_front();
+            Document::MainThreadHook hook = doc->getMainThreadHook();
+            doc->setMainThreadHook([hook, &notifyEvent]() {
+                if (hook) {
+                    hook();
+                }
+                notifyEvent();
+            });
+            if (doc->recomputeAsync({}, force, Document::DepNoXLinked)) {
+                hooks[doc] = hook;
+                running.push_back(doc);
+            }
+            else {
+                doc->setMainThreadHook(hook);
+                finish(doc);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(eventMutex);
+            event = false;
+        }
+        bool done = false;
+        for (auto it = running.begin(); it != running.end();) {
+            Document* doc = *it;
+            doc->processRecomputeNotifications();
+            if (doc->isRecomputingAsync()) {
+                ++it;
+                continue;
+            }
+            // let the other documents finish before reporting an error
+            try {
+                objectCount += doc->waitForRecompute();
+            }
+            catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            doc->setMainThreadHook(hooks[doc]);
+            it = running.erase(it);
+            finish(doc);
+            done = true;
+        }
+        if (!done && !running.empty()) {
+            // the workers may need the GIL to execute Python features
+            std::unique_ptr<Base::PyGILStateRelease> unlock;
+            if (Py_IsInitialized() && PyGILState_Check()) {
+                unlock = std::make_unique<Base::PyGILStateRelease>();
+            }
+            std::unique_lock<std::mutex> lock(eventMutex);
+            eventCondition.wait(lock, [&event]() {
+                return event;
+            });
+        }
+    }
+    FC_TIME_LOG(t, "Recompute " << sorted.size() << " documents");
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return objectCount;
+}
+
 std::string Application::getUniqueDocumentName(const char* Name, bool tempDoc) const
 {
     if (!Name || *Name == '\0') {
@@ -1939,6 +2179,7 @@ void Application::init(int argc, char ** argv)
         initTypes();
 
         initConfig(argc,argv);
+        addStartupPhase("Init types and configuration");
         initApplication();
     }
     catch (...) {
@@ -2124,6 +2365,7 @@ void Application::initTypes()
     App::FeatureTestAbsAddress     ::init();
     App::FeatureTestPlacement      ::init();
     App::FeatureTestAttribute      ::init();
+    App::FeatureTestConcurrent     ::init();
 
     // Feature class
     App::FeaturePython             ::init();
@@ -2243,6 +2485,8 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     config.add_options()
     ("write-log,l", descr.str().c_str())
     ("log-file", boost::program_options::value<std::string>(), "Unlike --write-log this allows logging to an arbitrary file")
+    ("log-startup", "Prints the time spent in the phases of the start up")
+    ("async-log", "Queues the console messages and delivers them from a background thread")
     ("user-cfg,u", boost::program_options::value<std::string>(),"User config file to load/save user settings")
     ("system-cfg,s", boost::program_options::value<std::string>(),"System config file to load/save system settings")
     ("run-test,t", boost::program_options::value<std::string>()->implicit_value(""),"Run a given test case (use 0 (zero) to run all tests). If no argument is provided then return list of all available tests.")
@@ -2461,6 +2705,14 @@ void processProgramOptions(const boost::program_options::variables_map& vm, std:
         mConfig["LoggingFileName"] = vm["log-file"].as<std::string>();
     }
 
+    if (vm.contains("log-startup")) {
+        mConfig["LogStartup"] = "1";
+    }
+
+    if (vm.contains("async-log")) {
+        mConfig["LoggingAsynchronous"] = "1";
+    }
+
     if (vm.contains("user-cfg")) {
         mConfig["UserParameter"] = vm["user-cfg"].as<std::string>();
     }
@@ -2653,6 +2905,10 @@ void Application::initConfig(int argc, char ** argv)
     else
         _pConsoleObserverFile = nullptr;
 
+    if (mConfig["LoggingAsynchronous"] == "1") {
+        Base::Console().setConnectionMode(Base::ConsoleSingleton::Asynchronous);
+    }
+
     // Banner ===========================================================
     if (mConfig["RunMode"] != "Cmd" && !(vm.contains("verbose") && vm.contains("version"))) {
         // Remove banner if FreeCAD is invoked via the -c command as regular
@@ -2684,6 +2940,7 @@ void Application::initConfig(int argc, char ** argv)
         }
     }
     LoadParameters();
+    addStartupPhase("Load parameters");
 
     auto loglevelParam = _pcUserParamMngr->GetGroup("BaseApp/LogLevels");
     const auto &loglevels = loglevelParam->GetIntMap();
@@ -2791,6 +3048,7 @@ void Application::initApplication()
     if (mConfig["Verbose"] != "Strict")
         Base::Console().log("Create Application\n");
     Application::_pcSingleton = new Application(mConfig);
+    addStartupPhase("Create application");
 
     // set up Unit system default
     const ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath
@@ -2813,6 +3071,7 @@ void Application::initApplication()
     catch (const Base::Exception& e) {
         e.reportException();
     }
+    addStartupPhase("Run App init script");
 
     // seed randomizer
     srand(time(nullptr));
@@ -2954,6 +3213,8 @@ void Application::runApplication()
 {
     // process all files given through command line interface
     processCmdLineFiles();
+    addStartupPhase("Open files");
+    printStartupTimeline();
 
     if (mConfig["RunMode"] == "Cmd") {
         // Run the commandline interface
@@ -2973,6 +3234,45 @@ void Application::runApplication()
     }
 }
 
+namespace {
+struct StartupPhase
+{
+    std::string name;
+    double time;
+};
+
+// the clock starts with the static initialization of the library
+const auto startupTime = std::chrono::steady_clock::now();
+std::vector<StartupPhase> startupPhases;
+bool startupTimelinePrinted = false;
+}
+
+void Application::addStartupPhase(const char* name)
+{
+    if (startupTimelinePrinted || mConfig["LogStartup"] != "1") {
+        return;
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startupTime;
+    startupPhases.push_back({name, elapsed.count()});
+}
+
+void Application::printStartupTimeline()
+{
+    if (startupTimelinePrinted || mConfig["LogStartup"] != "1") {
+        return;
+    }
+
+    startupTimelinePrinted = true;
+    Base::Console().message("Startup timeline (total / phase in ms):\n");
+    double last = 0.0;
+    for (const auto& phase : startupPhases) {
+        Base::Console().message("%9.1f %9.1f  %s\n", phase.time, phase.time - last, phase.name.c_str());
+        last = phase.time;
+    }
+    startupPhases.clear();
+}
+
 void Application::logStatus()
 {
     const std::string time_str = boost::posix_time::to_simple_string(
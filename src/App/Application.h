@@ -168,6 +168,36 @@ public:
     const char * getDocumentName(const App::Document* ) const;
     /// get a list of all documents in the application
     std::vector<App::Document*> getDocuments() const;
+    /** Recompute documents together with the documents they link to
+     *
+     * @param docs: the documents to recompute, all open documents if empty
+     * @param force: recompute even documents marked with SkipRecompute
+     * @param hasError: if given, set to true if any feature failed
+     *
+     * @return Returns the number of recomputed features.
+     *
+     * The documents are recomputed in the order of their external links, so
+     * that each document only needs to recompute its own objects. Partially
+     * loaded documents with touched objects are fully loaded before. If the
+     * 'ParallelRecompute' document preference is enabled, documents that do
+     * not link to each other are recomputed at the same time, each on its
+     * own worker thread. Must be called from the main thread.
+     */
+    int recomputeDocuments(const std::vector<App::Document*>& docs = {},
+                           bool force = false,
+                           bool* hasError = nullptr);
+    /** Fully load partially loaded documents
+     *
+     * @param docs: the documents to load, all open documents if empty
+     *
+     * @return Returns the loaded documents.
+     *
+     * Documents opened because of external links only load the linked objects
+     * and their dependencies, and they are read-only. This function reopens
+     * them with all their objects, so they can be edited and recomputed. The
+     * given partial documents are closed, so their pointers become invalid.
+     */
+    std::vector<App::Document*> loadPartialDocuments(const std::vector<App::Document*>& docs = {});
     /// Set the active document
     void setActiveDocument(App::Document* pDoc);
     void setActiveDocument(const char* Name);
@@ -417,6 +447,15 @@ public:
     static int64_t applicationPid();
     //@}
 
+    /** @name Startup timeline
+     * With --log-startup the time spent in the phases of the start up is recorded
+     * and printed once the application is ready.
+     */
+    //@{
+    static void addStartupPhase(const char* name);
+    static void printStartupTimeline();
+    //@}
+
     /** @name Application directories */
     //@{
     static std::string getHomePath();
@@ -579,10 +618,13 @@ private:
     static PyObject* sActiveDocument    (PyObject *self,PyObject *args);
     static PyObject* sSetActiveDocument (PyObject *self,PyObject *args);
     static PyObject* sGetDocument       (PyObject *self,PyObject *args);
+    static PyObject* sRecomputeDocuments(PyObject *self,PyObject *args, PyObject *kwd);
+    static PyObject* sLoadPartialDocuments(PyObject *self,PyObject *args);
     static PyObject* sListDocuments     (PyObject *self,PyObject *args);
     static PyObject* sAddDocObserver    (PyObject *self,PyObject *args);
     static PyObject* sRemoveDocObserver (PyObject *self,PyObject *args);
     static PyObject *sIsRestoring       (PyObject *self,PyObject *args);
+    static PyObject *sAddStartupPhase   (PyObject *self,PyObject *args);
 
     static PyObject *sSetLogLevel       (PyObject *self,PyObject *args);
     static PyObject *sGetLogLevel       (PyObject *self,PyObject *args);
@@ -189,6 +189,21 @@ PyMethodDef Application::Methods[] = {
      "getDocument(string) -> object\n\n"
      "Get a document by its name or raise an exception\n"
      "if there is no document with the given name."},
+    {"recomputeDocuments",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(Application::sRecomputeDocuments)),
+     METH_VARARGS | METH_KEYWORDS,
+     "recomputeDocuments(docs=None, force=False) -> int\n\n"
+     "Recompute the given documents, or all documents if None, together with\n"
+     "the documents they link to in the order of their links, partially loaded\n"
+     "documents that need a recompute are fully loaded. Documents not\n"
+     "linked to each other are recomputed concurrently if the preference\n"
+     "'ParallelRecompute' is enabled. Return the number of recomputed features."},
+    {"loadPartialDocuments",
+     (PyCFunction)Application::sLoadPartialDocuments,
+     METH_VARARGS,
+     "loadPartialDocuments(docs=None) -> list\n\n"
+     "Fully load the given documents, or all documents if None, that have been\n"
+     "partially loaded because of external links. Return the loaded documents."},
     {"listDocuments",
      (PyCFunction)Application::sListDocuments,
      METH_VARARGS,
@@ -256,6 +271,11 @@ PyMethodDef Application::Methods[] = {
      METH_VARARGS,
      "isRestoring() -> bool\n\n"
      "Test if the application is opening some document"},
+    {"addStartupPhase",
+     (PyCFunction)Application::sAddStartupPhase,
+     METH_VARARGS,
+     "addStartupPhase(name) -- record the end of a start up phase.\n\n"
+     "Only has an effect if the application was started with --log-startup."},
     {"checkAbort",
      (PyCFunction)Application::sCheckAbort,
      METH_VARARGS,
@@ -336,6 +356,16 @@ PyObject* Application::sIsRestoring(PyObject* /*self*/, PyObject* args)
     return Py::new_reference_to(Py::Boolean(GetApplication().isRestoring()));
 }
 
+PyObject* Application::sAddStartupPhase(PyObject* /*self*/, PyObject* args)
+{
+    char* name {};
+    if (!PyArg_ParseTuple(args, "s", &name)) {
+        return nullptr;
+    }
+    addStartupPhase(name);
+    Py_Return;
+}
+
 PyObject* Application::sOpenDocument(PyObject* /*self*/, PyObject* args, PyObject* kwd)
 {
     char* Name;
@@ -513,6 +543,89 @@ PyObject* Application::sGetDocument(PyObject* /*self*/, PyObject* args)
     return doc->getPyObject();
 }
 
+namespace
+{
+// Get the documents passed to recomputeDocuments() or loadPartialDocuments()
+bool getDocuments(PyObject* pyDocs, std::vector<Document*>& docs)
+{
+    if (pyDocs == Py_None) {
+        return true;
+    }
+    if (!PySequence_Check(pyDocs)) {
+        PyErr_SetString(PyExc_TypeError, "expect input of sequence of documents");
+        return false;
+    }
+
+    Py::Sequence seq(pyDocs);
+    for (Py_ssize_t i = 0; i < seq.size(); ++i) {
+        if (!PyObject_TypeCheck(seq[i].ptr(), &DocumentPy::Type)) {
+            PyErr_SetString(PyExc_TypeError, "Expect element in sequence to be of type document");
+            return false;
+        }
+        docs.push_back(static_cast<DocumentPy*>(seq[i].ptr())->getDocumentPtr());
+    }
+    return true;
+}
+}  // namespace
+
+PyObject* Application::sRecomputeDocuments(PyObject* /*self*/, PyObject* args, PyObject* kwd)
+{
+    PyObject* pyDocs = Py_None;
+    PyObject* force = Py_False;
+    static const std::array<const char*, 3> kwlist {"docs", "force", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwd,
+                                             "|OO!",
+                                             kwlist,
+                                             &pyDocs,
+                                             &PyBool_Type,
+                                             &force)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<Document*> docs;
+        if (!getDocuments(pyDocs, docs)) {
+            return nullptr;
+        }
+
+        int objectCount = 0;
+        {
+            // the workers may need the GIL to execute Python features
+            Base::PyGILStateRelease unlock;
+            objectCount = GetApplication().recomputeDocuments(docs, Base::asBoolean(force));
+        }
+        return Py::new_reference_to(Py::Long(objectCount));
+    }
+    PY_CATCH;
+}
+
+PyObject* Application::sLoadPartialDocuments(PyObject* /*self*/, PyObject* args)
+{
+    PyObject* pyDocs = Py_None;
+    if (!PyArg_ParseTuple(args, "|O", &pyDocs)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<Document*> docs;
+        if (!getDocuments(pyDocs, docs)) {
+            return nullptr;
+        }
+
+        Py::List res;
+        for (auto doc : GetApplication().loadPartialDocuments(docs)) {
+            if (doc) {
+                res.append(Py::asObject(doc->getPyObject()));
+            }
+        }
+        return Py::new_reference_to(res);
+    }
+    PY_CATCH;
+}
+
 PyObject* Application::sGetParam(PyObject* /*self*/, PyObject* args)
 {
     char* pstr = nullptr;
@@ -37,6 +37,13 @@
 #include <list>
 #include <algorithm>
 #include <filesystem>
+#include <iterator>
+#include <limits>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -50,6 +57,7 @@
 
 #include <QCryptographicHash>
 #include <QCoreApplication>
+#include <QThreadPool>
 
 #include <App/DocumentPy.h>
 #include <Base/Interpreter.h>
@@ -109,6 +117,9 @@ namespace App
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
 
+std::atomic<std::uint64_t> DocumentP::resolutionChanges {0};
+thread_local DocumentP::DeferredRecompute* DocumentP::deferredRecompute {nullptr};
+
 DocumentP::DocumentP()
 {
     static std::random_device rd;
@@ -123,6 +134,13 @@ DocumentP::DocumentP()
     StatusBits.set((size_t)Document::Restoring, false);
 }
 
+void DocumentP::checkAsyncEdit() const
+{
+    if (asyncRecomputing && !asyncNotifying && std::this_thread::get_id() == mainThreadId) {
+        throw Base::RuntimeError("Cannot change a document while it is recomputed asynchronously");
+    }
+}
+
 }  // namespace App
 
 PROPERTY_SOURCE(App::Document, App::PropertyContainer)
@@ -158,6 +176,7 @@ bool Document::checkOnCycle()
 
 bool Document::undo(const int id)
 {
+    d->checkAsyncEdit();
     if (d->iUndoMode != 0) {
         if (id != 0) {
             const auto it = mUndoMap.find(id);
@@ -187,6 +206,7 @@ bool Document::undo(const int id)
             mUndoTransactions.back()->apply(*this, false);
 
             // save the redo
+            d->activeUndoTransaction->compact();
             mRedoMap[d->activeUndoTransaction->getID()] = d->activeUndoTransaction;
             mRedoTransactions.push_back(d->activeUndoTransaction);
             d->activeUndoTransaction = nullptr;
@@ -213,6 +233,7 @@ bool Document::undo(const int id)
 
 bool Document::redo(const int id)
 {
+    d->checkAsyncEdit();
     if (d->iUndoMode != 0) {
         if (id != 0) {
             const auto it = mRedoMap.find(id);
@@ -239,6 +260,7 @@ bool Document::redo(const int id)
             Base::FlagToggler<bool> flag(d->undoing);
             mRedoTransactions.back()->apply(*this, true);
 
+            d->activeUndoTransaction->compact();
             mUndoMap[d->activeUndoTransaction->getID()] = d->activeUndoTransaction;
             mUndoTransactions.push_back(d->activeUndoTransaction);
             d->activeUndoTransaction = nullptr;
@@ -314,6 +336,7 @@ std::vector<std::string> Document::getAvailableRedoNames() const
 
 void Document::openTransaction(const char* name) // NOLINT
 {
+    d->checkAsyncEdit();
     if (isPerformingTransaction() || d->committing) {
         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
             FC_WARN("Cannot open transaction while transacting");
@@ -477,6 +500,7 @@ void Document::_commitTransaction(const bool notify)
         Base::FlagToggler<> flag(d->committing);
         Application::TransactionSignaller signaller(false, true);
         const int id = d->activeUndoTransaction->getID();
+        d->activeUndoTransaction->compact();
         mUndoTransactions.push_back(d->activeUndoTransaction);
         d->activeUndoTransaction = nullptr;
         // check the stack for the limits
@@ -485,6 +509,19 @@ void Document::_commitTransaction(const bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // and for the memory budget, the latest transaction is kept in any case
+        if (d->UndoMemSize != 0) {
+            std::size_t size = 0;
+            for (const auto* transaction : mUndoTransactions) {
+                size += transaction->getMemSize();
+            }
+            while (size > d->UndoMemSize && mUndoTransactions.size() > 1) {
+                size -= mUndoTransactions.front()->getMemSize();
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -559,6 +596,26 @@ int Document::getTransactionID(const bool undo, unsigned pos) const
     return (*rit)->getID();
 }
 
+unsigned int Document::getTransactionMemSize(const bool undo, unsigned pos) const
+{
+    if (undo) {
+        if (d->activeUndoTransaction) {
+            if (pos == 0) {
+                return d->activeUndoTransaction->getMemSize();
+            }
+            --pos;
+        }
+        if (pos >= mUndoTransactions.size()) {
+            return 0;
+        }
+        return (*std::next(mUndoTransactions.rbegin(), pos))->getMemSize();
+    }
+    if (pos >= mRedoTransactions.size()) {
+        return 0;
+    }
+    return (*std::next(mRedoTransactions.rbegin(), pos))->getMemSize();
+}
+
 bool Document::isTransactionEmpty() const
 {
     return !d->activeUndoTransaction;
@@ -588,6 +645,7 @@ void Document::clearDocument() // NOLINT
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->typeBuckets.clear();
     d->objectMap.clear();
     d->objectNameManager.clear();
     d->objectIdMap.clear();
@@ -686,7 +744,15 @@ int Document::getUndoMode() const
 
 unsigned int Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = d->activeUndoTransaction ? d->activeUndoTransaction->getMemSize() : 0;
+    for (const auto* transaction : mUndoTransactions) {
+        size += transaction->getMemSize();
+    }
+    for (const auto* transaction : mRedoTransactions) {
+        size += transaction->getMemSize();
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
@@ -694,6 +760,11 @@ void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
     d->UndoMemSize = UndoMemSize;
 }
 
+unsigned int Document::getUndoLimit() const
+{
+    return d->UndoMemSize;
+}
+
 void Document::setMaxUndoStackSize(const unsigned int UndoMaxStackSize) // NOLINT
 {
     d->UndoMaxStackSize = UndoMaxStackSize;
@@ -706,6 +777,7 @@ unsigned int Document::getMaxUndoStackSize() const
 
 void Document::onBeforeChange(const Property* prop)
 {
+    d->checkAsyncEdit();
     if (prop == &Label) {
         oldLabel = Label.getValue();
     }
@@ -714,6 +786,7 @@ void Document::onBeforeChange(const Property* prop)
 
 void Document::onChanged(const Property* prop)
 {
+    invalidateResolutionCache();
     signalChanged(*this, *prop);
 
     // the Name property is a label for display purposes
@@ -776,10 +849,25 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
+    d->checkAsyncEdit();
     if (Who->isDerivedFrom<DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
+        auto obj = static_cast<const DocumentObject*>(Who);
+        runOnMainThread([this, obj, What]() {
+            signalBeforeChangeObject(*obj, *What);
+        });
     }
     if (!d->rollback && !globalIsRelabeling) {
+        if (auto deferred = DocumentP::deferredRecompute) {
+            // The transaction is shared by all threads, so the change is recorded after
+            // the concurrent recompute, but the value before the change is copied now.
+            if ((d->iUndoMode != 0 || d->activeUndoTransaction)
+                && deferred->changed.insert(What).second) {
+                std::unique_ptr<Property> copy(What->Copy());
+                copy->setStatusValue(What->getStatus());
+                deferred->changes.push_back({this, Who, What, std::move(copy)});
+            }
+            return;
+        }
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
@@ -789,7 +877,76 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
-    signalChangedObject(*Who, *What);
+    runOnMainThread([this, Who, What]() {
+        signalChangedObject(*Who, *What);
+    });
+}
+
+void Document::runOnMainThread(const std::function<void()>& func)
+{
+    // objects recomputed concurrently notify once the whole batch is done
+    if (auto deferred = DocumentP::deferredRecompute) {
+        deferred->notifications.push_back(func);
+        return;
+    }
+    if (!d->asyncRecomputing || std::this_thread::get_id() == d->mainThreadId) {
+        func();
+        return;
+    }
+
+    // The main thread may need the GIL to handle the notification, so don't hold on to
+    // it while waiting. Released before and taken back after the locks below.
+    std::unique_ptr<Base::PyGILStateRelease> unlock;
+    if (Py_IsInitialized() && PyGILState_Check()) {
+        unlock = std::make_unique<Base::PyGILStateRelease>();
+    }
+
+    // Hand the function over to the main thread and wait until it has been called.
+    // Only one notification is handed over at a time.
+    std::lock_guard<std::mutex> notifyLock(d->asyncNotifyMutex);
+    std::unique_lock<std::mutex> lock(d->asyncMutex);
+    d->asyncNotification = &func;
+    d->asyncNotificationDone = false;
+    lock.unlock();
+    d->asyncCondition.notify_all();
+    if (d->_mainThreadHook) {
+        d->_mainThreadHook();
+    }
+    lock.lock();
+    d->asyncCondition.wait(lock, [this] {
+        return d->asyncNotificationDone;
+    });
+}
+
+void Document::processRecomputeNotifications()
+{
+    std::unique_lock<std::mutex> lock(d->asyncMutex);
+    const std::function<void()>* func = d->asyncNotification;
+    if (!func) {
+        return;
+    }
+    // reset it first in case a signal handler processes events
+    d->asyncNotification = nullptr;
+    lock.unlock();
+
+    Base::StateLocker notifying(d->asyncNotifying);
+    try {
+        (*func)();
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR("Exception in recompute notification of " << getName() << ": " << e.what());
+    }
+    catch (...) {
+        FC_ERR("Unknown exception in recompute notification of " << getName());
+    }
+
+    lock.lock();
+    d->asyncNotificationDone = true;
+    lock.unlock();
+    d->asyncCondition.notify_all();
 }
 
 void Document::setTransactionMode(const int iMode) // NOLINT
@@ -810,6 +967,7 @@ Document::Document(const char* documentName)
     // Remark: We force the document Python object to own the DocumentPy instance, thus we don't
     // have to care about ref counting any more.
     setAutoCreated(false);
+    invalidateResolutionCache();
     Base::PyGILStateLocker lock;
     d->DocumentPythonObject = Py::Object(new DocumentPy(this), true);
 
@@ -911,6 +1069,7 @@ Document::~Document()
 #ifdef FC_LOGUPDATECHAIN
     Console().log("-App::Document: %s %p\n", getName(), this);
 #endif
+    invalidateResolutionCache();
 
     try {
         clearUndos();
@@ -1645,6 +1804,37 @@ unsigned int Document::getMemSize() const
     return size;
 }
 
+Document::MemoryReport Document::getMemoryReport() const
+{
+    MemoryReport report;
+    report.objects.reserve(d->objectArray.size());
+    for (auto obj : d->objectArray) {
+        ObjectMemory entry;
+        entry.object = obj;
+        std::vector<std::pair<const char*, Property*>> props;
+        obj->getPropertyNamedList(props);
+        for (const auto& prop : props) {
+            std::size_t size = prop.second->getMemSize();
+            entry.properties.emplace_back(prop.first, size);
+            entry.total += size;
+        }
+        std::sort(entry.properties.begin(),
+                  entry.properties.end(),
+                  [](const auto& a, const auto& b) { return a.second > b.second; });
+        report.total += entry.total;
+        report.objects.push_back(std::move(entry));
+    }
+    std::sort(report.objects.begin(),
+              report.objects.end(),
+              [](const ObjectMemory& a, const ObjectMemory& b) { return a.total > b.total; });
+
+    report.properties = PropertyContainer::getMemSize();
+    report.hasher = d->Hasher->getMemSize();
+    report.undo = getUndoMemSize();
+    report.total += report.properties + report.hasher + report.undo;
+    return report;
+}
+
 static std::string checkFileName(const char* file)
 {
     std::string fn(file);
@@ -1698,32 +1888,36 @@ bool Document::save()
     }
 
     if (*(FileName.getValue()) != '\0') {
-        // Save the name of the tip object in order to handle in Restore()
-        if (Tip.getValue()) {
-            TipName.setValue(Tip.getValue()->getNameInDocument());
-        }
-
-        const std::string LastModifiedDateString = Base::Tools::currentDateTimeString();
-        LastModifiedDate.setValue(LastModifiedDateString.c_str());
-        // set author if needed
-        const bool saveAuthor =
-            GetApplication()
-                .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                ->GetBool("prefSetAuthorOnSave", false);
-        if (saveAuthor) {
-            const std::string Author =
-                GetApplication()
-                    .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                    ->GetASCII("prefAuthor", "");
-            LastModifiedBy.setValue(Author.c_str());
-        }
-
+        setSaveProperties();
         return saveToFile(FileName.getValue());
     }
 
     return false;
 }
 
+void Document::setSaveProperties()
+{
+    // Save the name of the tip object in order to handle in Restore()
+    if (Tip.getValue()) {
+        TipName.setValue(Tip.getValue()->getNameInDocument());
+    }
+
+    const std::string LastModifiedDateString = Base::Tools::currentDateTimeString();
+    LastModifiedDate.setValue(LastModifiedDateString.c_str());
+    // set author if needed
+    const bool saveAuthor =
+        GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("prefSetAuthorOnSave", false);
+    if (saveAuthor) {
+        const std::string Author =
+            GetApplication()
+                .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+                ->GetASCII("prefAuthor", "");
+        LastModifiedBy.setValue(Author.c_str());
+    }
+}
+
 namespace App
 {
 // Helper class to handle different backup policies
@@ -2038,78 +2232,149 @@ private:
 };
 }  // namespace App
 
-bool Document::saveToFile(const char* filename) const
+namespace
 {
-    signalStartSave(*this, filename);
-
-    auto hGrp = GetApplication().GetParameterGroupByPath(
-        "User parameter:BaseApp/Preferences/Document");
-    int compression = static_cast<int>(hGrp->GetInt("CompressionLevel", 7));
-    compression = Base::clamp<int>(compression, Z_NO_COMPRESSION, Z_BEST_COMPRESSION);
-
-    bool policy = GetApplication()
-                      .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                      ->GetBool("BackupPolicy", true);
-
-    auto canonical_path = [](const char* filename) {
-        try {
+// The canonical file name, i.e. without symlinks. The missing folders of the path are created.
+std::string getNativePath(const char* filename)
+{
+    try {
 #ifdef FC_OS_WIN32
-            QString utf8Name = QString::fromUtf8(filename);
-            auto realpath = fs::weakly_canonical(fs::absolute(fs::path(utf8Name.toStdWString())));
-            std::string nativePath = QString::fromStdWString(realpath.native()).toStdString();
+        QString utf8Name = QString::fromUtf8(filename);
+        auto realpath = fs::weakly_canonical(fs::absolute(fs::path(utf8Name.toStdWString())));
+        std::string nativePath = QString::fromStdWString(realpath.native()).toStdString();
 #else
-            auto realpath = fs::weakly_canonical(fs::absolute(fs::path(filename)));
-            std::string nativePath = realpath.native();
+        auto realpath = fs::weakly_canonical(fs::absolute(fs::path(filename)));
+        std::string nativePath = realpath.native();
 #endif
-            // In case some folders in the path do not exist
-            auto parentPath = realpath.parent_path();
-            fs::create_directories(parentPath);
+        // In case some folders in the path do not exist
+        auto parentPath = realpath.parent_path();
+        fs::create_directories(parentPath);
 
-            return nativePath;
-        }
-        catch (const std::exception&) {
+        return nativePath;
+    }
+    catch (const std::exception&) {
 #ifdef FC_OS_WIN32
-            QString utf8Name = QString::fromUtf8(filename);
-            auto parentPath = fs::absolute(fs::path(utf8Name.toStdWString())).parent_path();
+        QString utf8Name = QString::fromUtf8(filename);
+        auto parentPath = fs::absolute(fs::path(utf8Name.toStdWString())).parent_path();
 #else
-            auto parentPath = fs::absolute(fs::path(filename)).parent_path();
+        auto parentPath = fs::absolute(fs::path(filename)).parent_path();
 #endif
-            fs::create_directories(parentPath);
+        fs::create_directories(parentPath);
 
-            return std::string(filename);
-        }
-    };
-
-    // realpath is canonical filename i.e. without symlink
-    std::string nativePath = canonical_path(filename);
+        return std::string(filename);
+    }
+}
 
-    // make a tmp. file where to save the project data first and then rename to
-    // the actual file name. This may be useful if overwriting an existing file
-    // fails so that the data of the work up to now isn't lost.
-    std::string uuid = Base::Uuid::createUuid();
+// The file the project data is saved to first, it is renamed to the actual file name by
+// the backup policy. This may be useful if overwriting an existing file fails so that the
+// data of the work up to now isn't lost.
+std::string getSaveFileName(const std::string& nativePath, bool policy)
+{
     std::string fn = nativePath;
     if (policy) {
         fn += ".";
-        fn += uuid;
+        fn += Base::Uuid::createUuid();
     }
+    return fn;
+}
 
+bool useBackupPolicy()
+{
+    return GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+        ->GetBool("BackupPolicy", true);
+}
 
-    // open extra scope to close ZipWriter properly
-    {
-        Base::FileInfo tmp(fn);
-        Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+// The backup policy of the preferences, it renames the saved file to the actual file name
+BackupPolicy getBackupPolicy()
+{
+    int count_bak = static_cast<int>(GetApplication()
+                        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+                        ->GetInt("CountBackupFiles", 1));
+    bool backup = GetApplication()
+                      .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+                      ->GetBool("CreateBackupFiles", true);
+    if (!backup) {
+        count_bak = -1;
+    }
+    bool useFCBakExtension =
+        GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("UseFCBakExtension", true);
+    std::string saveBackupDateFormat =
+        GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetASCII("SaveBackupDateFormat", "%Y%m%d-%H%M%S");
 
-        Base::ZipWriter writer(file);
-        if (!file.is_open()) {
-            throw Base::FileException("Failed to open file", tmp);
+    BackupPolicy backupPolicy;
+    if (useFCBakExtension) {
+        backupPolicy.setPolicy(BackupPolicy::TimeStamp);
+        backupPolicy.useBackupExtension(useFCBakExtension);
+        backupPolicy.setDateFormat(saveBackupDateFormat);
+    }
+    else {
+        backupPolicy.setPolicy(BackupPolicy::Standard);
+    }
+    backupPolicy.setNumberOfFiles(count_bak);
+    return backupPolicy;
+}
+}  // namespace
+
+void Document::writeToStream(std::ostream& stream, const std::string& fn) const
+{
+    // Read the data files that are still deferred as long as the archive is unchanged, it may be
+    // the file that is going to be overwritten. Properties that support lazy restore read their
+    // data on calling getComplexData().
+    if (!d->lazyArchive.expired()) {
+        for (auto obj : d->objectArray) {
+            std::vector<Property*> props;
+            obj->getPropertyList(props);
+            for (auto prop : props) {
+                if (auto geoData = freecad_cast<PropertyComplexGeoData*>(prop)) {
+                    geoData->getComplexData();
+                }
+            }
         }
+    }
+
+    auto hGrp = GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    int compression = static_cast<int>(hGrp->GetInt("CompressionLevel", 7));
+    compression = Base::clamp<int>(compression, Z_NO_COMPRESSION, Z_BEST_COMPRESSION);
+
+    // open extra scope to close ZipWriter properly
+    {
+        Base::ZipWriter writer(stream);
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setParallel(hGrp->GetBool("ParallelSave", false)
+                           && std::thread::hardware_concurrency() > 1);
+        writer.setCompact(hGrp->GetBool("CompactXML", false));
+        // Copy the data files that didn't change from the file saved last, unless it was
+        // replaced or truncated for writing in place since then
+        bool incremental = hGrp->GetBool("IncrementalSave", true);
+        if (incremental) {
+            const auto& saved = d->savedArchive;
+            Base::FileInfo fi(saved.fileName);
+            bool unchanged = !saved.fileName.empty() && fi.isFile()
+                && fi.size() == saved.size && fi.lastModified() == saved.modified;
+            writer.setPreviousArchive(unchanged ? saved.fileName : std::string(), saved.digests);
+        }
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
+            // Keep the tessellation of the shapes so that they are displayed without
+            // meshing them again when the document is opened
+            if (hGrp->GetBool("SaveTriangulation", false)) {
+                writer.setMode("BrepTriangulation");
+            }
+        }
+        // Store point clouds and meshes as uncompressed arrays that open quickly, but
+        // can't be read by versions that don't know the raw format
+        if (hGrp->GetBool("SaveRawKernels", false)) {
+            writer.setMode("RawKernel");
         }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << '\n'
@@ -2129,50 +2394,203 @@ bool Document::saveToFile(const char* filename) const
             std::stringstream message;
             message << "Failed to write all data to file ";
             message << writer.getErrors().front();
-            throw Base::FileException(message.str().c_str(), tmp);
+            throw Base::FileException(message.str().c_str(), Base::FileInfo(fn));
+        }
+        if (incremental) {
+            FC_LOG("Serialized " << writer.getChangedFiles().size() << " changed data files of '"
+                                 << getName() << "'");
+            d->writtenDigests = writer.getDigests();
         }
 
         GetApplication().signalSaveDocument(*this);
     }
+}
+
+bool Document::saveToFile(const char* filename) const
+{
+    signalStartSave(*this, filename);
+
+    bool policy = useBackupPolicy();
+
+    // realpath is canonical filename i.e. without symlink
+    std::string nativePath = getNativePath(filename);
+    std::string fn = getSaveFileName(nativePath, policy);
+
+    FC_TIME_INIT(t);
+
+    {
+        Base::FileInfo tmp(fn);
+        Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+        if (!file.is_open()) {
+            throw Base::FileException("Failed to open file", tmp);
+        }
+        writeToStream(file, fn);
+    }
+
+    FC_DURATION_DECL_INIT(d);
+    FC_DURATION_PLUS(d, t);
+    FC_DURATION_LOG(d,
+                    "Saved " << Base::FileInfo(fn).size() / 1e6 << " MB to '" << nativePath
+                             << "' at " << Base::FileInfo(fn).size() / 1e6 / d.count()
+                             << " MB/s,");
 
     if (policy) {
         // if saving the project data succeeded rename to the actual file name
-        int count_bak = static_cast<int>(GetApplication()
-                            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                            ->GetInt("CountBackupFiles", 1));
-        bool backup = GetApplication()
-                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                          ->GetBool("CreateBackupFiles", true);
-        if (!backup) {
-            count_bak = -1;
-        }
-        bool useFCBakExtension =
-            GetApplication()
-                .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                ->GetBool("UseFCBakExtension", true);
-        std::string saveBackupDateFormat =
-            GetApplication()
-                .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
-                ->GetASCII("SaveBackupDateFormat", "%Y%m%d-%H%M%S");
+        getBackupPolicy().apply(fn, nativePath);
+    }
+    d->rememberSavedArchive(nativePath);
+
+    signalFinishSave(*this, filename);
+
+    return true;
+}
 
-        BackupPolicy backupPolicy;
-        if (useFCBakExtension) {
-            backupPolicy.setPolicy(BackupPolicy::TimeStamp);
-            backupPolicy.useBackupExtension(useFCBakExtension);
-            backupPolicy.setDateFormat(saveBackupDateFormat);
+bool Document::saveAsync()
+{
+    if (isSavingAsync()) {
+        FC_ERR("Document " << getName() << " is already saving");
+        return false;
+    }
+    if (testStatus(Document::PartialDoc)) {
+        FC_ERR("Partial loaded document '" << Label.getValue() << "' cannot be saved");
+        return false;
+    }
+    if (*(FileName.getValue()) == '\0') {
+        return false;
+    }
+
+    // finish a previous run nobody has waited for
+    if (d->asyncSave.valid()) {
+        try {
+            waitForSave();
         }
-        else {
-            backupPolicy.setPolicy(BackupPolicy::Standard);
+        catch (const Base::Exception& e) {
+            e.reportException();
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Failed to save document " << getName() << ": " << e.what());
+        }
+    }
+
+    setSaveProperties();
+    std::string filename = FileName.getValue();
+    signalStartSave(*this, filename);
+
+    // The document is serialized into memory, so it can be changed while the
+    // data is written to the file
+    FC_TIME_INIT(t);
+    std::ostringstream stream(std::ios::out | std::ios::binary);
+    try {
+        writeToStream(stream, filename);
+    }
+    catch (...) {
+        signalFinishSave(*this, filename);
+        throw;
+    }
+    auto data = std::make_shared<std::string>(std::move(stream).str());
+    FC_TIME_LOG(t, "Serialized " << data->size() / 1e6 << " MB of '" << getName() << "'");
+
+    // The data is always written to a temporary file, so that the existing file is
+    // kept if the save is aborted or fails. Without the backup policy it just
+    // replaces the existing file.
+    BackupPolicy backupPolicy;
+    if (useBackupPolicy()) {
+        backupPolicy = getBackupPolicy();
+    }
+    else {
+        backupPolicy.setNumberOfFiles(0);
+    }
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    d->asyncSaveCancel = cancel;
+    d->asyncSaveFileName = filename;
+    d->asyncSave = std::async(std::launch::async, [data, filename, backupPolicy, cancel]() mutable {
+        std::string nativePath = getNativePath(filename.c_str());
+        std::string fn = getSaveFileName(nativePath, true);
+        Base::FileInfo tmp(fn);
+
+        FC_TIME_INIT(t);
+        try {
+            Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+            if (!file.is_open()) {
+                throw Base::FileException("Failed to open file", tmp);
+            }
+
+            // write in blocks to show the progress and to be able to stop
+            constexpr std::size_t blockSize = 1 << 20;
+            std::size_t numBlocks = (data->size() + blockSize - 1) / blockSize;
+            Base::SequencerLauncher seq("Saving...", numBlocks);
+            for (std::size_t pos = 0; pos < data->size(); pos += blockSize) {
+                if (*cancel) {
+                    throw Base::AbortException("Saving aborted");
+                }
+                std::size_t size = std::min(blockSize, data->size() - pos);
+                file.write(data->data() + pos, static_cast<std::streamsize>(size));
+                if (!file) {
+                    throw Base::FileException("Failed to write file", tmp);
+                }
+                seq.next(false);
+            }
+            file.close();
+            if (!file) {
+                throw Base::FileException("Failed to write file", tmp);
+            }
+            if (*cancel) {
+                throw Base::AbortException("Saving aborted");
+            }
         }
-        backupPolicy.setNumberOfFiles(count_bak);
+        catch (...) {
+            tmp.deleteFile();
+            throw;
+        }
+
+        FC_TIME_LOG(t, "Wrote " << data->size() / 1e6 << " MB to '" << nativePath << "'");
+
         backupPolicy.apply(fn, nativePath);
+    });
+    return true;
+}
+
+bool Document::isSavingAsync() const
+{
+    return d->asyncSave.valid()
+        && d->asyncSave.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+bool Document::waitForSave()
+{
+    if (!d->asyncSave.valid()) {
+        return false;
     }
 
-    signalFinishSave(*this, filename);
+    auto save = std::move(d->asyncSave);
+    d->asyncSaveCancel.reset();
+    // pair the signalStartSave of saveAsync() whatever the outcome
+    std::string filename = d->asyncSaveFileName;
+    try {
+        save.get();
+    }
+    catch (const Base::AbortException&) {
+        FC_WARN("Saving document " << getName() << " was aborted");
+        signalFinishSave(*this, filename);
+        return false;
+    }
+    catch (...) {
+        signalFinishSave(*this, filename);
+        throw;
+    }
+    d->rememberSavedArchive(getNativePath(filename.c_str()));
 
+    signalFinishSave(*this, filename);
     return true;
 }
 
+void Document::abortSave()
+{
+    if (d->asyncSaveCancel) {
+        *d->asyncSaveCancel = true;
+    }
+}
+
 void Document::registerLabel(const std::string& newLabel)
 {
     if (!newLabel.empty()) {
@@ -2229,6 +2647,7 @@ void Document::restore(const char* filename,
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->typeBuckets.clear();
     d->objectNameManager.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
@@ -2260,6 +2679,21 @@ void Document::restore(const char* filename,
         throw Base::FileException("Error reading compression file", filename);
     }
 
+    // In lazy mode the heavy data files are read from the archive on first access
+    std::shared_ptr<zipios::ZipFile> lazyArchive;
+    if (GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("LazyRestore", false)) {
+        try {
+            lazyArchive = std::make_shared<zipios::ZipFile>(filename);
+            reader.setLazyArchive(lazyArchive);
+        }
+        catch (const std::exception& e) {
+            FC_WARN("Cannot restore lazily from '" << filename << "': " << e.what());
+        }
+    }
+    d->lazyArchive = lazyArchive;
+
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
 
@@ -2688,11 +3122,11 @@ static void buildDependencyList(const std::vector<DocumentObject*>& objectArray,
     }
 }
 
-std::vector<DocumentObject*>
-Document::getDependencyList(const std::vector<DocumentObject*>& objs, int options)
+static std::vector<DocumentObject*>
+getDependencyListUncached(const std::vector<DocumentObject*>& objs, int options, bool& complete)
 {
     std::vector<DocumentObject*> ret;
-    if ((options & DepSort) == 0) {
+    if ((options & Document::DepSort) == 0) {
         buildDependencyList(objs, options, &ret, nullptr, nullptr);
         return ret;
     }
@@ -2712,7 +3146,7 @@ Document::getDependencyList(const std::vector<DocumentObject*>& objs, int option
         boost::topological_sort(depList, std::front_inserter(make_order));
     }
     catch (const std::exception& e) {
-        if ((options & DepNoCycle) != 0) {
+        if ((options & Document::DepNoCycle) != 0) {
             // Use boost::strong_components to find cycles. It groups strongly
             // connected vertices as components, and therefore each component
             // forms a cycle.
@@ -2766,6 +3200,7 @@ Document::getDependencyList(const std::vector<DocumentObject*>& objs, int option
         FC_ERR(e.what());
         ret = DocumentP::partialTopologicalSort(objs);
         std::reverse(ret.begin(), ret.end());
+        complete = false;
         return ret;
     }
 
@@ -2775,6 +3210,50 @@ Document::getDependencyList(const std::vector<DocumentObject*>& objs, int option
     return ret;
 }
 
+// The dependency lists of the last queries, e.g. of all objects of a document
+// on recompute, kept until any link changes
+struct DependencyListCache
+{
+    std::uint64_t generation;
+    int options;
+    std::vector<DocumentObject*> objects;
+    std::vector<DocumentObject*> result;
+};
+static std::mutex dependencyListMutex;
+static std::vector<DependencyListCache> dependencyListCache;
+
+std::vector<DocumentObject*>
+Document::getDependencyList(const std::vector<DocumentObject*>& objs, int options)
+{
+    const std::uint64_t generation = DocumentObject::getDependencyGeneration();
+    {
+        std::lock_guard<std::mutex> lock(dependencyListMutex);
+        for (const auto& entry : dependencyListCache) {
+            if (entry.generation == generation && entry.options == options
+                && entry.objects == objs) {
+                return entry.result;
+            }
+        }
+    }
+
+    bool complete = true;
+    std::vector<DocumentObject*> ret = getDependencyListUncached(objs, options, complete);
+    if (complete) {
+        const std::size_t maxEntries = 8;
+        std::lock_guard<std::mutex> lock(dependencyListMutex);
+        std::erase_if(dependencyListCache, [generation](const DependencyListCache& entry) {
+            return entry.generation != generation;
+        });
+        if (dependencyListCache.size() >= maxEntries) {
+            dependencyListCache.erase(dependencyListCache.begin());
+        }
+        if (generation == DocumentObject::getDependencyGeneration()) {
+            dependencyListCache.push_back({generation, options, objs, ret});
+        }
+    }
+    return ret;
+}
+
 std::vector<Document*> Document::getDependentDocuments(const bool sort)
 {
     return getDependentDocuments({this}, sort);
@@ -2883,6 +3362,141 @@ void Document::setPreRecomputeHook(const PreRecomputeHook& hook)
      d->_preRecomputeHook = hook;
 }
 
+void Document::setMainThreadHook(const MainThreadHook& hook)
+{
+    d->_mainThreadHook = hook;
+}
+
+const Document::MainThreadHook& Document::getMainThreadHook() const
+{
+    return d->_mainThreadHook;
+}
+
+namespace
+{
+/// Run @a worker on the calling thread and on up to @a helpers threads of the application
+/// wide thread pool, and return once all of them are done. Helpers the pool has not started
+/// by the time the calling thread is done are skipped, so that a busy pool cannot stall the
+/// caller.
+void runOnThreadPool(const std::function<void()>& worker, size_t helpers)
+{
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable idle;
+        const std::function<void()>* worker {nullptr};
+        size_t running {0};
+    };
+    auto state = std::make_shared<State>();
+    state->worker = &worker;
+
+    auto pool = QThreadPool::globalInstance();
+    for (size_t i = 0; i < helpers; ++i) {
+        pool->start([state]() {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            auto work = state->worker;
+            if (!work) {
+                return;
+            }
+            ++state->running;
+            lock.unlock();
+            (*work)();
+            lock.lock();
+            --state->running;
+            lock.unlock();
+            state->idle.notify_all();
+        });
+    }
+
+    worker();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->worker = nullptr;
+    state->idle.wait(lock, [&state] {
+        return state->running == 0;
+    });
+}
+}  // namespace
+
+bool Document::recomputeAsync(const std::vector<DocumentObject*>& objs, bool force, int options)
+{
+    if (d->asyncRecomputing || testStatus(Document::Recomputing)) {
+        FC_ERR("Document " << getName() << " is already recomputing");
+        return false;
+    }
+
+    // collect the result of a previous run nobody has waited for
+    if (d->asyncRecompute.valid()) {
+        d->asyncRecompute.get();
+    }
+
+    d->mainThreadId = std::this_thread::get_id();
+    d->asyncRecomputing = true;
+    d->asyncRecompute = std::async(std::launch::async, [this, objs, force, options]() {
+        auto finish = [this]() {
+            std::unique_lock<std::mutex> lock(d->asyncMutex);
+            d->asyncRecomputing = false;
+            lock.unlock();
+            d->asyncCondition.notify_all();
+            if (d->_mainThreadHook) {
+                d->_mainThreadHook();
+            }
+        };
+
+        int objectCount = 0;
+        try {
+            objectCount = recompute(objs, force, nullptr, options);
+        }
+        catch (...) {
+            finish();
+            throw;
+        }
+        finish();
+        return objectCount;
+    });
+    return true;
+}
+
+bool Document::isRecomputingAsync() const
+{
+    return d->asyncRecomputing;
+}
+
+int Document::waitForRecompute()
+{
+    if (!d->asyncRecompute.valid()) {
+        return 0;
+    }
+
+    // the worker may need the GIL to execute Python features
+    std::unique_ptr<Base::PyGILStateRelease> unlock;
+    if (Py_IsInitialized() && PyGILState_Check()) {
+        unlock = std::make_unique<Base::PyGILStateRelease>();
+    }
+
+    std::unique_lock<std::mutex> lock(d->asyncMutex);
+    while (d->asyncRecomputing) {
+        d->asyncCondition.wait(lock, [this] {
+            return d->asyncNotification || !d->asyncRecomputing;
+        });
+        if (d->asyncNotification) {
+            lock.unlock();
+            processRecomputeNotifications();
+            lock.lock();
+        }
+    }
+    lock.unlock();
+
+    return d->asyncRecompute.get();
+}
+
+void Document::abortRecompute()
+{
+    if (d->asyncRecomputing) {
+        Base::Sequencer().tryToCancel();
+    }
+}
+
 int Document::recompute(const std::vector<DocumentObject*>& objs,
                         bool force,
                         bool* hasError,
@@ -2913,12 +3527,15 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     // The 'SkipRecompute' flag can be (tmp.) set to avoid too many
     // time expensive recomputes
     if (!force && testStatus(Document::SkipRecompute)) {
-        signalSkipRecompute(*this, objs);
+        runOnMainThread([&]() {
+            signalSkipRecompute(*this, objs);
+        });
         return 0;
     }
 
     // delete recompute log
     d->clearRecomputeLog();
+    RecomputeProfile::Session profiling(d->recomputeProfile, getName());
 
     FC_TIME_INIT(t);
 
@@ -2928,7 +3545,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     // and *block* the worker until the main thread is done, avoiding races
     // between any running Python code and the rest of the recompute call.
     if (d->_preRecomputeHook) {
-        d->_preRecomputeHook();
+        runOnMainThread(d->_preRecomputeHook);
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -2958,9 +3575,112 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         obj->setStatus(ObjectStatus::PendingRecompute, true);
     }
 
-    ParameterGrp::handle hGrp =
-        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
-    bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    static ParameterValue<bool> canAbortRecompute(
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document"),
+        "CanAbortRecompute",
+        true);
+    static ParameterValue<bool> parallelRecompute(canAbortRecompute.getGroup(),
+                                                  "ParallelRecompute",
+                                                  false);
+    // an asynchronous recompute must always be cancellable
+    bool canAbort = canAbortRecompute.getValue() || d->asyncRecomputing;
+    bool parallel = parallelRecompute.getValue();
+
+    // Results of objects that have been recomputed ahead of the serial loop
+    // by the concurrent scheduler below.
+    std::unordered_map<DocumentObject*, int> concurrentResults;
+
+    // Starting at 'start', collect the consecutive run of objects that may be
+    // recomputed concurrently and do not depend on each other, and recompute
+    // them using a shared work queue. Because the list is topologically sorted,
+    // any indirect dependency between two members would have to go through an
+    // object placed in between, which already ends the run.
+    auto recomputeConcurrently = [&](size_t start, const std::set<DocumentObject*>& filter) {
+        std::vector<DocumentObject*> batch;
+        std::unordered_set<DocumentObject*> members;
+        for (size_t i = start; i < topoSortedObjects.size(); ++i) {
+            auto obj = topoSortedObjects[i];
+            if (!obj->isAttachedToDocument() || filter.contains(obj)) {
+                continue;
+            }
+            if (!obj->mustRecompute() || !obj->canRecomputeConcurrently()) {
+                break;
+            }
+            const auto& outList = obj->getOutList();
+            if (std::any_of(outList.begin(), outList.end(), [&](DocumentObject* dep) {
+                    return members.contains(dep);
+                })) {
+                break;
+            }
+            members.insert(obj);
+            batch.push_back(obj);
+        }
+        if (batch.size() < 2) {
+            return;
+        }
+
+        std::vector<int> results(batch.size(), 0);
+        std::vector<std::exception_ptr> errors(batch.size());
+        // Signals and undo records of each object, see runOnMainThread()
+        std::vector<DocumentP::DeferredRecompute> deferred(batch.size());
+        std::atomic<size_t> next(0);
+        std::function<void()> worker = [&]() {
+            for (size_t i = next++; i < batch.size(); i = next++) {
+                DocumentP::deferredRecompute = &deferred[i];
+                try {
+                    FC_TIME_INIT(t3);
+                    results[i] = _recomputeFeature(batch[i]);
+                    FC_TIME_LOG(t3, "Recompute " << batch[i]->getFullName());
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+                DocumentP::deferredRecompute = nullptr;
+            }
+        };
+
+        auto pool = QThreadPool::globalInstance();
+        size_t threads = std::max<size_t>(1, pool->maxThreadCount());
+        threads = std::min(threads, batch.size());
+        FC_LOG("Recompute " << batch.size() << " objects using " << threads << " threads");
+        // The objects name the elements of their shapes using the string hasher of the
+        // document. It stays in the thread-safe mode afterwards, Python threads that found
+        // it thread-safe may still be using it. They check the mode under the GIL.
+        if (!d->Hasher->isThreadSafe()) {
+            Base::PyGILStateLocker lock;
+            d->Hasher->setThreadSafe(true);
+        }
+        {
+            // Python features in the batch take the GIL inside execute(), so the
+            // calling thread must not hold on to it while waiting for the workers.
+            std::unique_ptr<Base::PyGILStateRelease> unlock;
+            if (Py_IsInitialized() && PyGILState_Check()) {
+                unlock = std::make_unique<Base::PyGILStateRelease>();
+            }
+            runOnThreadPool(worker, threads - 1);
+        }
+
+        // replay in the order of the batch, as if recomputed one after the other
+        for (auto& deferral : deferred) {
+            for (auto& change : deferral.changes) {
+                auto doc = change.doc;
+                doc->_checkTransaction(nullptr, change.property, __LINE__);
+                if (doc->d->activeUndoTransaction) {
+                    doc->d->activeUndoTransaction->addObjectChange(change.object,
+                                                                   change.property,
+                                                                   std::move(change.copy));
+                }
+            }
+            for (const auto& notification : deferral.notifications) {
+                runOnMainThread(notification);
+            }
+        }
+        Base::rethrowFirstException(errors);
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            concurrentResults[batch[i]] = results[i];
+        }
+    };
 
     FC_TIME_INIT(t2);
 
@@ -2975,6 +3695,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            concurrentResults.clear();
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -2985,7 +3706,20 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                 if (obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
-                    int res = _recomputeFeature(obj);
+                    if (parallel && concurrentResults.empty()) {
+                        recomputeConcurrently(idx, filter);
+                    }
+                    int res = 0;
+                    auto itRes = concurrentResults.find(obj);
+                    if (itRes != concurrentResults.end()) {
+                        res = itRes->second;
+                        concurrentResults.erase(itRes);
+                    }
+                    else {
+                        FC_TIME_INIT(t3);
+                        res = _recomputeFeature(obj);
+                        FC_TIME_LOG(t3, "Recompute " << obj->getFullName());
+                    }
                     if (res != 0) {
                         if (hasError) {
                             *hasError = true;
@@ -3002,7 +3736,9 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                     }
                 }
                 if (obj->isTouched() || doRecompute) {
-                    signalRecomputedObject(*obj);
+                    runOnMainThread([&]() {
+                        signalRecomputedObject(*obj);
+                    });
                     obj->purgeTouched();
                     // set all dependent object touched to force recompute
                     for (auto inObjIt : obj->getInList()) {
@@ -3038,6 +3774,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     }
 
     FC_TIME_LOG(t2, "Recompute");
+    profiling.stop();
 
     for (auto obj : topoSortedObjects) {
         if (!obj->isAttachedToDocument()) {
@@ -3047,7 +3784,9 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         obj->setStatus(ObjectStatus::Recompute2, false);
     }
 
-    signalRecomputed(*this, topoSortedObjects);
+    runOnMainThread([&]() {
+        signalRecomputed(*this, topoSortedObjects);
+    });
 
     FC_TIME_LOG(t, "Recompute total");
 
@@ -3064,22 +3803,25 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         }
     }
 
-    for (auto doc : GetApplication().getDocuments()) {
-        decltype(doc->d->pendingRemove) objects;
-        objects.swap(doc->d->pendingRemove);
-        for (auto& o : objects) {
-            try {
-                if (auto obj = o.getObject()) {
-                    obj->getDocument()->removeObject(obj->getNameInDocument());
+    // removing objects changes the documents, so do it on the main thread
+    runOnMainThread([]() {
+        for (auto doc : GetApplication().getDocuments()) {
+            decltype(doc->d->pendingRemove) objects;
+            objects.swap(doc->d->pendingRemove);
+            for (auto& o : objects) {
+                try {
+                    if (auto obj = o.getObject()) {
+                        obj->getDocument()->removeObject(obj->getNameInDocument());
+                    }
+                }
+                catch (Base::Exception& e) {
+                    e.reportException();
+                    FC_ERR("error when removing object " << o.getDocumentName() << '#'
+                                                         << o.getObjectName());
                 }
-            }
-            catch (Base::Exception& e) {
-                e.reportException();
-                FC_ERR("error when removing object " << o.getDocumentName() << '#'
-                                                     << o.getObjectName());
             }
         }
-    }
+    });
     return objectCount;
 }
 
@@ -3266,16 +4008,49 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
     return d->findRecomputeLog(Obj);
 }
 
+const RecomputeProfile& Document::getRecomputeProfile() const
+{
+    return d->recomputeProfile;
+}
+
+Document::ResolutionCacheStats Document::getResolutionCacheStats() const
+{
+    std::lock_guard<std::mutex> lock(d->resolutionMutex);
+    ResolutionCacheStats stats;
+    stats.hits = d->resolutionHits;
+    stats.misses = d->resolutionMisses;
+    if (d->resolutionGeneration == DocumentP::resolutionChanges.load()) {
+        stats.entries = d->resolutions.size();
+    }
+    return stats;
+}
+
+void Document::resetResolutionCacheStats()
+{
+    std::lock_guard<std::mutex> lock(d->resolutionMutex);
+    d->resolutionHits = 0;
+    d->resolutionMisses = 0;
+}
+
+void Document::invalidateResolutionCache()
+{
+    // the caches are dropped on their next lookup
+    ++DocumentP::resolutionChanges;
+}
+
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    RecomputeProfile::Recorder recorder(d->recomputeProfile, Feat);
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
         if (returnCode == DocumentObject::StdReturn) {
+            recorder.beginExecute();
             returnCode = Feat->recompute();
+            recorder.endExecute();
             if (returnCode == DocumentObject::StdReturn) {
                 returnCode =
                     Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteOutput);
@@ -3350,6 +4125,7 @@ DocumentObject* Document::addObject(const char* sType,
                                     const char* viewType,
                                     const bool isPartial)
 {
+    d->checkAsyncEdit();
     const Base::Type type =
         Base::Type::getTypeIfDerivedFrom(sType, DocumentObject::getClassTypeId(), true);
     if (type.isBad()) {
@@ -3400,6 +4176,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         return objects;
     }
 
+    ObjectBatch batch(this);
     for (auto it = objects.begin(); it != objects.end(); ++it) {
         size_t index = std::distance(objects.begin(), it);
         DocumentObject* pcObject = *it;
@@ -3417,8 +4194,105 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
     return objects;
 }
 
+std::vector<DocumentObject*> Document::addObjects(const std::vector<std::string>& types,
+                                                  const std::vector<std::string>& objectNames,
+                                                  bool isNew)
+{
+    d->checkAsyncEdit();
+    if (types.size() != objectNames.size()) {
+        throw Base::ValueError("Number of types and names differ");
+    }
+
+    // check all types first to not leave a partial import behind
+    std::vector<Base::Type> objectTypes;
+    objectTypes.reserve(types.size());
+    for (const auto& sType : types) {
+        Base::Type type =
+            Base::Type::getTypeIfDerivedFrom(sType.c_str(), DocumentObject::getClassTypeId(), true);
+        if (type.isBad()) {
+            std::stringstream str;
+            str << "'" << sType << "' is not a document object type";
+            throw Base::TypeError(str.str());
+        }
+        objectTypes.push_back(type);
+    }
+
+    std::vector<DocumentObject*> objects;
+    objects.reserve(types.size());
+    ObjectBatch batch(this);
+    for (std::size_t index = 0; index < objectTypes.size(); ++index) {
+        auto pcObject = static_cast<DocumentObject*>(objectTypes[index].createInstance());
+        if (!pcObject) {
+            continue;
+        }
+        pcObject->setDocument(this);
+
+        // Add the object but only activate the last one
+        bool isLast = index == (objectTypes.size() - 1);
+        _addObject(pcObject,
+                   objectNames[index].c_str(),
+                   AddObjectOption::SetNewStatus
+                       | (isNew ? AddObjectOption::DoSetup : AddObjectOption::None)
+                       | (isLast ? AddObjectOption::ActivateObject : AddObjectOption::None));
+        objects.push_back(pcObject);
+    }
+
+    return objects;
+}
+
+Document::ObjectBatch::ObjectBatch(Document* doc)
+    : doc(doc)
+{
+    ++doc->d->objectBatchLevel;
+}
+
+Document::ObjectBatch::~ObjectBatch()
+{
+    if (doc->d->objectBatchLevel > 1) {
+        --doc->d->objectBatchLevel;
+        return;
+    }
+
+    // The batch stays open while the objects are announced, so that observers can
+    // tell by isBatchingObjects(). Objects added by observers are announced, too.
+    while (!doc->d->batchedObjects.empty()) {
+        std::vector<DocumentObject*> objects;
+        objects.reserve(doc->d->batchedObjects.size());
+        for (long id : doc->d->batchedObjects) {
+            // skip the objects removed within the batch
+            auto it = doc->d->objectIdMap.find(id);
+            if (it != doc->d->objectIdMap.end()) {
+                objects.push_back(it->second);
+            }
+        }
+        doc->d->batchedObjects.clear();
+
+        try {
+            for (auto obj : objects) {
+                doc->signalNewObject(*obj);
+            }
+            if (!objects.empty()) {
+                doc->signalNewObjects(objects);
+            }
+        }
+        catch (Base::Exception& e) {
+            e.reportException();
+        }
+        catch (std::exception& e) {
+            FC_ERR("Exception on announcing new objects: " << e.what());
+        }
+    }
+    --doc->d->objectBatchLevel;
+}
+
+bool Document::isBatchingObjects() const
+{
+    return d->objectBatchLevel > 0;
+}
+
 void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
 {
+    d->checkAsyncEdit();
     if (pcObject->getDocument()) {
         throw Base::RuntimeError("Document object is already added to a document");
     }
@@ -3454,6 +4328,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addToTypeBucket(pcObject);
+    invalidateResolutionCache();
+    DocumentObject::clearDependencyCache();
      
      // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3486,7 +4363,12 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
-    signalNewObject(*pcObject);
+    if (d->objectBatchLevel > 0) {
+        d->batchedObjects.push_back(pcObject->_Id);
+    }
+    else {
+        signalNewObject(*pcObject);
+    }
  
     // do no transactions if we do a rollback!
     if (!d->rollback && d->activeUndoTransaction) {
@@ -3511,6 +4393,7 @@ bool Document::containsObject(const DocumentObject* pcObject) const
 /// Remove an object out of the document
 void Document::removeObject(const char* sName)
 {
+    d->checkAsyncEdit();
     auto pos = d->objectMap.find(sName);
 
     if (pos->second->testStatus(ObjectStatus::PendingRecompute)) {
@@ -3532,6 +4415,8 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
     TransactionLocker tlock;
 
     _checkTransaction(pcObject, nullptr, __LINE__);
+    invalidateResolutionCache();
+    DocumentObject::clearDependencyCache();
 
     auto pos = d->objectMap.find(pcObject->getNameInDocument());
     if (pos == d->objectMap.end()) {
@@ -3615,6 +4500,7 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
             break;
         }
     }
+    d->removeFromTypeBucket(pcObject);
     
     // In case the object gets deleted the pointer must be nullified
     if (tobedestroyed) {
@@ -3917,27 +4803,19 @@ const std::vector<DocumentObject*>& Document::getObjects() const
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            Objects.push_back(it);
-        }
-    }
-    return Objects;
+    return d->getObjectsOfType([&typeId](Base::Type type) {
+        return type.isDerivedFrom(typeId);
+    });
 }
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const std::vector<Base::Type>& types) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        for (auto& typeId : types) {
-            if (it->isDerivedFrom(typeId)) {
-                Objects.push_back(it);
-                break; // Prevent adding several times the same object.
-            }
-        }
-    }
-    return Objects;
+    // every object is only added once, even if it matches several types
+    return d->getObjectsOfType([&types](Base::Type type) {
+        return std::any_of(types.begin(), types.end(), [type](const Base::Type& typeId) {
+            return type.isDerivedFrom(typeId);
+        });
+    });
 }
 
 std::vector<DocumentObject*> Document::getObjectsWithExtension(const Base::Type& typeId,
@@ -3969,32 +4847,21 @@ Document::findObjects(const Base::Type& typeId, const char* objname, const char*
         rx_label.set_expression(label);
     }
 
-    std::vector<DocumentObject*> Objects;
-    DocumentObject* found = nullptr;
-    for (const auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            found = it;
-
-            if (!rx_name.empty() && !boost::regex_search(it->getNameInDocument(), what, rx_name)) {
-                found = nullptr;
-            }
-
-            if (!rx_label.empty() && !boost::regex_search(it->Label.getValue(), what, rx_label)) {
-                found = nullptr;
-            }
-
-            if (found) {
-                Objects.push_back(found);
-            }
+    std::vector<DocumentObject*> Objects = getObjectsOfType(typeId);
+    auto mismatch = [&](DocumentObject* obj) {
+        if (!rx_name.empty() && !boost::regex_search(obj->getNameInDocument(), what, rx_name)) {
+            return true;
         }
-    }
+        return !rx_label.empty() && !boost::regex_search(obj->Label.getValue(), what, rx_label);
+    };
+    Objects.erase(std::remove_if(Objects.begin(), Objects.end(), mismatch), Objects.end());
     return Objects;
 }
 
 int Document::countObjectsOfType(const Base::Type& typeId) const
 {
-    return std::count_if(d->objectMap.begin(), d->objectMap.end(), [&](const auto& it) {
-        return it.second->isDerivedFrom(typeId);
+    return d->countObjectsOfType([&typeId](Base::Type type) {
+        return type.isDerivedFrom(typeId);
     });
 }
 
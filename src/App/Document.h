@@ -34,6 +34,7 @@
 #include "PropertyLinks.h"
 #include "PropertyStandard.h"
 
+#include <cstdint>
 #include <map>
 #include <vector>
 #include <utility>
@@ -82,6 +83,7 @@ class DocumentPy;
 class Application;
 class Transaction;
 class StringHasher;
+class RecomputeProfile;
 using StringHasherRef = Base::Reference<StringHasher>;
 
 /**
@@ -167,6 +169,8 @@ public:
     boost::signals2::signal<void(const Document&, const Property&)> signalChanged;
     /// signal on new Object
     boost::signals2::signal<void(const DocumentObject&)> signalNewObject;
+    /// signal after the objects of an ObjectBatch were announced by signalNewObject
+    boost::signals2::signal<void(const std::vector<DocumentObject*>&)> signalNewObjects;
     /// signal on deleted Object
     boost::signals2::signal<void(const DocumentObject&)> signalDeletedObject;
     /// signal before changing an Object
@@ -223,6 +227,15 @@ public:
 
     using PreRecomputeHook = std::function<void()>;
     void setPreRecomputeHook(const PreRecomputeHook& hook);
+    /** Set a hook that is called from the worker thread of an asynchronous recompute
+     * whenever a notification is waiting to be delivered, and once more when the
+     * recompute has finished. The hook must arrange that processRecomputeNotifications()
+     * is called on the main thread. Without a hook the notifications are only delivered
+     * by waitForRecompute(). The hook must not be changed while a recompute is running.
+     */
+    using MainThreadHook = std::function<void()>;
+    void setMainThreadHook(const MainThreadHook& hook);
+    const MainThreadHook& getMainThreadHook() const;
 
     void clearDocument();
 
@@ -234,6 +247,29 @@ public:
     bool save();
     bool saveAs(const char* file);
     bool saveCopy(const char* file) const;
+    /** Save the document to the file in Property Path on a worker thread
+     *
+     * The document is serialized into memory first, then the function returns
+     * and the worker writes the data to the file and applies the backup policy.
+     * So, the document can be changed while it is written. The progress is
+     * shown by the sequencer, the result can be obtained with waitForSave().
+     *
+     * @return false if the document cannot be saved or is already saving
+     */
+    bool saveAsync();
+    /// Check if an asynchronous save is running
+    bool isSavingAsync() const;
+    /** Wait for the asynchronous save to finish
+     * Must be called from the main thread, which then gets signalFinishSave, also
+     * if the save failed or was aborted. Exceptions of the worker are passed on.
+     * @return false if no save was running or it was aborted
+     */
+    bool waitForSave();
+    /** Ask the running asynchronous save to stop before it writes the next block
+     * The existing file is kept unless the worker has already replaced it, which
+     * waitForSave() tells.
+     */
+    void abortSave();
     /// Restore the document from the file in Property Path
     void restore(const char* filename = nullptr,
                  bool delaySignal = false,
@@ -286,6 +322,27 @@ public:
     /// returns the complete document memory consumption, including all managed DocObjects and Undo
     /// Redo.
     unsigned int getMemSize() const override;
+    /// The memory consumption of an object, broken down by its properties
+    struct ObjectMemory
+    {
+        DocumentObject* object {nullptr};
+        std::vector<std::pair<std::string, std::size_t>> properties;
+        std::size_t total {0};
+    };
+    /// The memory consumption of the document, see getMemoryReport()
+    struct MemoryReport
+    {
+        /// Sorted by size, the largest object first
+        std::vector<ObjectMemory> objects;
+        std::size_t properties {0};
+        std::size_t hasher {0};
+        std::size_t undo {0};
+        std::size_t total {0};
+    };
+    /** Returns the estimated memory consumption of every object and property
+     * as reported by their getMemSize(), plus the string hasher and Undo/Redo.
+     */
+    MemoryReport getMemoryReport() const;
 
     /** @name Object handling  */
     //@{
@@ -328,6 +385,34 @@ public:
      */
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
+    /** Add an array of features of different types, see the function above.
+     * Both lists must have the same size, an empty name gives a name derived
+     * from the type.
+     */
+    std::vector<DocumentObject*> addObjects(const std::vector<std::string>& types,
+                                            const std::vector<std::string>& objectNames,
+                                            bool isNew = true);
+    /** Defers the announcement of new objects for bulk creation, e.g. by importers.
+     * Within the scope of an ObjectBatch signalNewObject is held back. When the
+     * outermost batch ends it is emitted for every object that still exists,
+     * followed by a single signalNewObjects, so that observers can process all
+     * objects at once. The objects are added to the undo transaction right away.
+     * Until the batch ends the objects have no view provider.
+     */
+    class AppExport ObjectBatch
+    {
+    public:
+        explicit ObjectBatch(Document* doc);
+        ~ObjectBatch();
+
+        ObjectBatch(const ObjectBatch&) = delete;
+        ObjectBatch& operator=(const ObjectBatch&) = delete;
+
+    private:
+        Document* doc;
+    };
+    /// Returns true while objects are added within an ObjectBatch or announced at its end
+    bool isBatchingObjects() const;
     /// Remove a feature out of the document
     void removeObject(const char* sName);
     /** Add an existing feature with sName (ASCII) to this document and set it active.
@@ -437,8 +522,61 @@ public:
                   int options = 0);
     /// Recompute only one feature
     bool recomputeFeature(DocumentObject* Feat, bool recursive = false);
+    /** Recompute touched features on a worker thread
+     *
+     * The arguments are the same as for recompute(). The function returns
+     * immediately, the result can be obtained with waitForRecompute().
+     * While the worker is running all document signals are emitted on the
+     * main thread, the worker waits until they have been handled. So, the
+     * view providers are updated object by object. The document must not be
+     * modified from the main thread until the recompute has finished.
+     *
+     * @return false if a recompute is already running
+     */
+    bool recomputeAsync(const std::vector<DocumentObject*>& objs = {},
+                        bool force = false,
+                        int options = 0);
+    /// Check if an asynchronous recompute is running
+    bool isRecomputingAsync() const;
+    /** Wait for the asynchronous recompute to finish
+     * Must be called from the main thread. Pending notifications of the
+     * worker are delivered while waiting.
+     * @return the number of recomputed features or 0 if no recompute is running
+     */
+    int waitForRecompute();
+    /// Ask the running recompute to stop after the current feature
+    void abortRecompute();
+    /// Deliver the notifications of an asynchronous recompute, must be called from the main thread
+    void processRecomputeNotifications();
     /// get the text of the error of a specified object
     const char* getErrorDescription(const DocumentObject*) const;
+    /** Get the timings of the last recompute
+     * For every executed object the profile holds the wall time, the time
+     * spent in its execute() method and the properties that caused the
+     * recompute.
+     */
+    const RecomputeProfile& getRecomputeProfile() const;
+    /// The statistics of the cache of DocumentObject::getSubObjectCached()
+    struct ResolutionCacheStats
+    {
+        std::uint64_t hits {0};
+        std::uint64_t misses {0};
+        std::size_t entries {0};
+        /// The ratio of hits to lookups, 0 if nothing was looked up
+        double hitRate() const
+        {
+            return hits + misses ? static_cast<double>(hits) / static_cast<double>(hits + misses)
+                                 : 0.0;
+        }
+    };
+    ResolutionCacheStats getResolutionCacheStats() const;
+    void resetResolutionCacheStats();
+    /** Drop the cached resolutions of all documents
+     * Called on any change of an object and when objects are added or deleted.
+     * As links may point into other documents, the caches of all documents are
+     * dropped.
+     */
+    static void invalidateResolutionCache();
     /// return the status bits
     bool testStatus(Status pos) const;
     /// set the status bits
@@ -488,11 +626,15 @@ public:
     bool hasPendingTransaction() const;
     /// Return the undo/redo transaction ID starting from the back
     int getTransactionID(bool undo, unsigned pos = 0) const;
+    /// Return the memory used by the undo/redo transaction starting from the back
+    unsigned int getTransactionMemSize(bool undo, unsigned pos = 0) const;
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
+    /// Set the Undo limit in Byte! The oldest transactions are removed above it, 0 means no limit.
     void setUndoLimit(unsigned int UndoMemSize = 0);
+    /// Returns the Undo limit in Byte
+    unsigned int getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize() const;
     /// Set the Undo limit as stack size
@@ -663,6 +805,10 @@ protected:
     std::vector<DocumentObject*> readObjects(Base::XMLReader& reader);
     void writeObjects(const std::vector<DocumentObject*>&, Base::Writer& writer) const;
     bool saveToFile(const char* filename) const;
+    /// Write the zipped document data to the stream, \a fn is used in error messages
+    void writeToStream(std::ostream& stream, const std::string& fn) const;
+    /// Update the properties recorded on saving, like the modification date
+    void setSaveProperties();
     int countObjectsOfType(const Base::Type& typeId) const;
 
     void onBeforeChange(const Property* prop) override;
@@ -671,6 +817,8 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject* Who, const Property* What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject* Who, const Property* What);
+    /// Runs a function on the main thread if called from the worker of an asynchronous recompute
+    void runOnMainThread(const std::function<void()>& func);
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
@@ -1,6 +1,6 @@
 from PropertyContainer import PropertyContainer
 from DocumentObject import DocumentObject
-from typing import Final, List, Tuple, Sequence
+from typing import Final, List, Tuple, Sequence, Dict, Any
 
 
 class Document(PropertyContainer):
@@ -100,6 +100,34 @@ class Document(PropertyContainer):
         """
         ...
 
+    def saveAsync(self) -> bool:
+        """
+        saveAsync(): Save the document to disk on a worker thread.
+        The document is serialized before the function returns, use waitForSave() to get
+        the result of writing the file. Returns False if the document cannot be saved or
+        is already saving.
+        """
+        ...
+
+    def isSavingAsync(self) -> bool:
+        """
+        Check if an asynchronous save is running
+        """
+        ...
+
+    def waitForSave(self) -> bool:
+        """
+        Wait for the asynchronous save to finish. Returns False if it was aborted
+        """
+        ...
+
+    def abortSave(self) -> None:
+        """
+        Ask the running asynchronous save to stop, the existing file is kept unless
+        it has already been replaced, which waitForSave() tells
+        """
+        ...
+
     def load(self) -> None:
         """
         Load the document from the given path
@@ -205,6 +233,19 @@ class Document(PropertyContainer):
         """
         ...
 
+    def addObjects(self, types: List[str], names: List[str] = None) -> List[DocumentObject]:
+        """
+        addObjects(types, names=None) -> list
+
+        Add several objects to the document at once, e.g. for importers.
+        Observers are notified about the new objects when all of them are
+        created, which is much cheaper than adding the objects one by one.
+
+        types (List): the types of the document objects to create.
+        names (List): the optional names of the new objects, of the same size.
+        """
+        ...
+
     def addProperty(
         self,
         *,
@@ -332,6 +373,86 @@ class Document(PropertyContainer):
         """
         ...
 
+    def recomputeAsync(
+        self, objs: Sequence[DocumentObject] = None, force: bool = False, checkCycle: bool = False
+    ) -> bool:
+        """
+        recomputeAsync(objs=None, force=False, checkCycle=False): Recompute the document on a worker thread.
+        Returns immediately, use waitForRecompute() to get the amount of recomputed features.
+        Returns False if a recompute is already running.
+
+        objs : sequence of DocumentObject
+            The objects to recompute together with their dependencies, all objects if None.
+        force : bool
+            Recompute even if the document is set to skip recomputes.
+        checkCycle : bool
+            Check for cyclic dependencies before recomputing.
+
+        The document cannot be changed from the main thread until the recompute is done.
+        """
+        ...
+
+    def isRecomputingAsync(self) -> bool:
+        """
+        Check if an asynchronous recompute is running
+        """
+        ...
+
+    def waitForRecompute(self) -> int:
+        """
+        Wait for the asynchronous recompute to finish and return the amount of recomputed features
+        """
+        ...
+
+    def abortRecompute(self) -> None:
+        """
+        Ask the running asynchronous recompute to stop
+        """
+        ...
+
+    def getRecomputeProfile(self) -> List[Dict[str, Any]]:
+        """
+        getRecomputeProfile() -> list
+
+        Return the timings of the last recompute. For every executed object
+        a dict with its Name, Label, TypeId, the Thread index, the Start time
+        and Duration and the time spent in execute() (Execute) in seconds,
+        the Touched properties that caused the recompute and the Failed status.
+        """
+        ...
+
+    def exportRecomputeProfile(self, *, filename: str = None, format: str = "chrome") -> str:
+        """
+        exportRecomputeProfile(filename=None, format='chrome')
+
+        Export the timings of the last recompute. The format is either 'chrome'
+        for the trace event format of chrome://tracing and Perfetto or
+        'speedscope' for https://www.speedscope.app. If no file name is given
+        the JSON text is returned.
+        """
+        ...
+
+    def getResolutionCacheStats(self, reset: bool = False) -> Dict[str, Any]:
+        """
+        getResolutionCacheStats(reset=False) -> dict
+
+        Return the statistics of the cache of the resolved sub objects: the
+        number of Hits and Misses, the HitRate and the number of cached Entries.
+        The counters are set to zero afterwards if reset is True.
+        """
+        ...
+
+    def memoryReport(self) -> Dict[str, Any]:
+        """
+        memoryReport() -> dict
+
+        Return the estimated memory consumption in bytes. Objects maps every
+        object name to a dict with its Total and the size of its Properties,
+        besides there are the sizes of the document Properties, the
+        StringHasher, the Undo/Redo stack and the Total of the document.
+        """
+        ...
+
     def mustExecute(self) -> bool:
         """
         Check if any object must be recomputed
@@ -24,8 +24,11 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
 #include <stack>
 #include <memory>
+#include <mutex>
 #include <map>
 #include <set>
 #include <vector>
@@ -49,6 +52,7 @@
 #include "ObjectIdentifier.h"
 #include "PropertyExpressionEngine.h"
 #include "PropertyLinks.h"
+#include "private/DocumentP.h"
 
 
 FC_LOG_LEVEL_INIT("App", true, true)
@@ -85,6 +89,8 @@ DocumentObject::DocumentObject()
 
 DocumentObject::~DocumentObject()
 {
+    Document::invalidateResolutionCache();
+    clearDependencyCache();
     if (!PythonObject.is(Py::_None())) {
         Base::PyGILStateLocker lock;
         // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
@@ -220,7 +226,9 @@ void DocumentObject::touch(bool noRecompute)
     }
     StatusBits.set(ObjectStatus::Touch);
     if (_pDoc) {
-        _pDoc->signalTouchedObject(*this);
+        _pDoc->runOnMainThread([this]() {
+            _pDoc->signalTouchedObject(*this);
+        });
     }
 }
 
@@ -233,7 +241,9 @@ void DocumentObject::freeze()
     StatusBits.set(ObjectStatus::Freeze);
     // use the signalTouchedObject to refresh the Gui
     if (_pDoc) {
-        _pDoc->signalTouchedObject(*this);
+        _pDoc->runOnMainThread([this]() {
+            _pDoc->signalTouchedObject(*this);
+        });
     }
 }
 
@@ -486,23 +496,66 @@ std::vector<App::DocumentObject*> DocumentObject::getInListRecursive() const
 }
 
 
-// More efficient algorithm to find the recursive inList of an object,
-// including possible external parents.  One shortcoming of this algorithm is
-// it does not detect cyclic reference, althgouth it won't crash either.
-void DocumentObject::getInListEx(std::set<App::DocumentObject*>& inSet,
-                                 bool recursive,
-                                 std::vector<App::DocumentObject*>* inList) const
+namespace
 {
-    if (!recursive) {
-        inSet.insert(_inList.begin(), _inList.end());
-        if (inList) {
-            *inList = _inList;
-        }
+// starts at one to tell the empty caches apart
+std::atomic<std::uint64_t> dependencyGeneration {1};
+// guards the cached recursive lists, which may be queried by concurrent recomputes
+std::mutex recursiveListMutex;
+}  // namespace
+
+std::uint64_t DocumentObject::getDependencyGeneration()
+{
+    return dependencyGeneration.load();
+}
+
+void DocumentObject::clearDependencyCache()
+{
+    ++dependencyGeneration;
+}
+
+bool DocumentObject::RecursiveList::get(std::vector<App::DocumentObject*>& res) const
+{
+    std::lock_guard<std::mutex> lock(recursiveListMutex);
+    if (generation != dependencyGeneration.load()) {
+        return false;
+    }
+    res.insert(res.end(), objects.begin(), objects.end());
+    return true;
+}
+
+int DocumentObject::RecursiveList::contains(const App::DocumentObject* obj) const
+{
+    std::lock_guard<std::mutex> lock(recursiveListMutex);
+    if (generation != dependencyGeneration.load()) {
+        return -1;
+    }
+    return std::binary_search(sorted.begin(), sorted.end(), obj) ? 1 : 0;
+}
+
+void DocumentObject::RecursiveList::set(std::uint64_t generation,
+                                        const std::vector<App::DocumentObject*>& objects)
+{
+    std::lock_guard<std::mutex> lock(recursiveListMutex);
+    // don't keep what was obtained while the links changed
+    if (generation != dependencyGeneration.load()) {
         return;
     }
+    this->generation = generation;
+    this->objects = objects;
+    sorted = objects;
+    std::sort(sorted.begin(), sorted.end());
+}
 
+// More efficient algorithm to find the recursive inList of an object,
+// including possible external parents.  One shortcoming of this algorithm is
+// it does not detect cyclic reference, althgouth it won't crash either.
+static void _getInListRecursive(const DocumentObject* act,
+                                std::set<App::DocumentObject*>& inSet,
+                                std::vector<App::DocumentObject*>* inList)
+{
     std::stack<DocumentObject*> pendings;
-    pendings.push(const_cast<DocumentObject*>(this));
+    pendings.push(const_cast<DocumentObject*>(act));
     while (!pendings.empty()) {
         auto obj = pendings.top();
         pendings.pop();
@@ -517,6 +570,38 @@ void DocumentObject::getInListEx(std::set<App::DocumentObject*>& inSet,
     }
 }
 
+void DocumentObject::getInListEx(std::set<App::DocumentObject*>& inSet,
+                                 bool recursive,
+                                 std::vector<App::DocumentObject*>* inList) const
+{
+    if (!recursive) {
+        inSet.insert(_inList.begin(), _inList.end());
+        if (inList) {
+            *inList = _inList;
+        }
+        return;
+    }
+
+    // objects already in inSet are not followed, so only the full list is cached
+    if (!inSet.empty()) {
+        _getInListRecursive(this, inSet, inList);
+        return;
+    }
+
+    std::vector<App::DocumentObject*> res;
+    if (!_inListRecursive.get(res)) {
+        std::uint64_t generation = dependencyGeneration.load();
+        _getInListRecursive(this, inSet, &res);
+        _inListRecursive.set(generation, res);
+    }
+    else {
+        inSet.insert(res.begin(), res.end());
+    }
+    if (inList) {
+        inList->insert(inList->end(), res.begin(), res.end());
+    }
+}
+
 std::set<App::DocumentObject*> DocumentObject::getInListEx(bool recursive) const
 {
     std::set<App::DocumentObject*> ret;
@@ -546,6 +631,12 @@ void _getOutListRecursive(std::set<DocumentObject*>& objSet,
 
 std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
 {
+    std::vector<App::DocumentObject*> array;
+    if (_outListRecursive.get(array)) {
+        return array;
+    }
+
+    std::uint64_t generation = dependencyGeneration.load();
     // number of objects in document is a good estimate in result size
     int maxDepth = GetApplication().checkLinkDepth(0);
     std::set<App::DocumentObject*> result;
@@ -553,8 +644,8 @@ std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
     // using a recursive helper to collect all OutLists
     _getOutListRecursive(result, this, this, maxDepth);
 
-    std::vector<App::DocumentObject*> array;
     array.insert(array.begin(), result.begin(), result.end());
+    _outListRecursive.set(generation, array);
     return array;
 }
 
@@ -581,7 +672,14 @@ bool _isInInListRecursive(const DocumentObject* act, const DocumentObject* check
 
 bool DocumentObject::isInInListRecursive(DocumentObject* linkTo) const
 {
-    return this == linkTo || getInListEx(true).contains(linkTo);
+    if (this == linkTo) {
+        return true;
+    }
+    int cached = _inListRecursive.contains(linkTo);
+    if (cached >= 0) {
+        return cached > 0;
+    }
+    return getInListEx(true).contains(linkTo);
 }
 
 bool DocumentObject::isInInList(DocumentObject* linkTo) const
@@ -617,6 +715,10 @@ bool _isInOutListRecursive(const DocumentObject* act, const DocumentObject* chec
 
 bool DocumentObject::isInOutListRecursive(DocumentObject* linkTo) const
 {
+    int cached = _outListRecursive.contains(linkTo);
+    if (cached >= 0) {
+        return cached > 0;
+    }
     int maxDepth = getDocument()->countObjects() + 2;
     return _isInOutListRecursive(this, linkTo, maxDepth);
 }
@@ -641,10 +743,8 @@ bool DocumentObject::testIfLinkDAGCompatible(DocumentObject* linkTo) const
 
 bool DocumentObject::testIfLinkDAGCompatible(const std::vector<DocumentObject*>& linksTo) const
 {
-    auto inLists = getInListEx(true);
-    inLists.emplace(const_cast<DocumentObject*>(this));
     for (auto obj : linksTo) {
-        if (inLists.contains(obj)) {
+        if (isInInListRecursive(obj)) {
             return false;
         }
     }
@@ -740,9 +840,14 @@ void DocumentObject::onBeforeChange(const Property* prop)
 
     if (_pDoc){
         onBeforeChangeProperty(_pDoc, prop);
+        // observers expect the thread of the document, not a recompute worker
+        _pDoc->runOnMainThread([this, prop]() {
+            signalBeforeChange(*this, *prop);
+        });
+    }
+    else {
+        signalBeforeChange(*this, *prop);
     }
-
-    signalBeforeChange(*this, *prop);
 }
 
 std::vector<std::pair<Property*, std::unique_ptr<Property>>>
@@ -764,11 +869,11 @@ DocumentObject::onProposedLabelChange(std::string& newLabel)
             && !doc->testStatus(App::Document::Importing))) {
         return {};
     }
-    static ParameterGrp::handle _hPGrp;
-    if (!_hPGrp) {
-        _hPGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
-    }
-    if (doc && !newLabel.empty() && !_hPGrp->GetBool("DuplicateLabels") && !allowDuplicateLabel()
+    static ParameterValue<bool> duplicateLabels(
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document"),
+        "DuplicateLabels",
+        false);
+    if (doc && !newLabel.empty() && !duplicateLabels.getValue() && !allowDuplicateLabel()
         && doc->containsLabel(newLabel)) {
         // We must ensure the Label is unique in the document (well, sort of...).
         std::string objName = getNameInDocument();
@@ -824,12 +929,21 @@ void DocumentObject::onEarlyChange(const Property* prop)
         }
     }
 
-    signalEarlyChanged(*this, *prop);
+    if (_pDoc) {
+        _pDoc->runOnMainThread([this, prop]() {
+            signalEarlyChanged(*this, *prop);
+        });
+    }
+    else {
+        signalEarlyChanged(*this, *prop);
+    }
 }
 
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    Document::invalidateResolutionCache();
+
     if (prop == &Label && _pDoc && _pDoc->containsObject(this) && oldLabel != Label.getStrValue()) {
         _pDoc->unregisterLabel(oldLabel);
         _pDoc->registerLabel(Label.getStrValue());
@@ -859,7 +973,9 @@ void DocumentObject::onChanged(const Property* prop)
     //     _pDoc->onChangedProperty(this,prop);
 
     if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()) {
-        _pDoc->signalRelabelObject(*this);
+        _pDoc->runOnMainThread([this]() {
+            _pDoc->signalRelabelObject(*this);
+        });
     }
 
     // set object touched if it is an input property
@@ -881,13 +997,18 @@ void DocumentObject::onChanged(const Property* prop)
     // Now signal the view provider
     if (_pDoc) {
         _pDoc->onChangedProperty(this, prop);
+        _pDoc->runOnMainThread([this, prop]() {
+            signalChanged(*this, *prop);
+        });
+    }
+    else {
+        signalChanged(*this, *prop);
     }
-
-    signalChanged(*this, *prop);
 }
 
 void DocumentObject::clearOutListCache() const
 {
+    clearDependencyCache();
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
@@ -1138,6 +1259,33 @@ DocumentObject* DocumentObject::getLinkedObject(bool recursive,
     return const_cast<DocumentObject*>(this);
 }
 
+DocumentObject* DocumentObject::getSubObjectCached(const char* subname,
+                                                   Base::Matrix4D* mat,
+                                                   bool transform) const
+{
+    if (!_pDoc) {
+        return getSubObject(subname, nullptr, mat, transform);
+    }
+    return _pDoc->d->resolve({this, subname ? subname : "", transform ? 1 : 0},
+                             mat,
+                             [&](Base::Matrix4D* local) {
+                                 return getSubObject(subname, nullptr, local, transform);
+                             });
+}
+
+DocumentObject* DocumentObject::getLinkedObjectCached(bool recurse,
+                                                      Base::Matrix4D* mat,
+                                                      bool transform) const
+{
+    if (!_pDoc) {
+        return getLinkedObject(recurse, mat, transform);
+    }
+    int flags = 2 | (recurse ? 4 : 0) | (transform ? 1 : 0);
+    return _pDoc->d->resolve({this, std::string(), flags}, mat, [&](Base::Matrix4D* local) {
+        return getLinkedObject(recurse, local, transform);
+    });
+}
+
 void DocumentObject::Save(Base::Writer& writer) const
 {
     if (this->isFreezed()) {
@@ -1267,6 +1415,7 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     if (it != _inList.end()) {
         _inList.erase(it);
     }
+    clearDependencyCache();
 }
 
 void App::DocumentObject::_addBackLink(DocumentObject* newObj)
@@ -1276,6 +1425,7 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    clearDependencyCache();
 }
 
 int DocumentObject::setElementVisible(const char* element, bool visible)
@@ -32,6 +32,7 @@
 #include <Base/SmartPtrPy.h>
 
 #include <bitset>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <map>
@@ -294,6 +295,15 @@ public:
     std::vector<App::DocumentObject*> getOutListRecursive() const;
     /// clear internal out list cache
     void clearOutListCache() const;
+    /** A counter that changes whenever the in or out list of any object
+     * changes or an object is added to or removed from a document
+     *
+     * The recursive in and out lists and Document::getDependencyList() are
+     * cached until the counter changes.
+     */
+    static std::uint64_t getDependencyGeneration();
+    /// Drop the cached recursive lists and dependency lists of all objects
+    static void clearDependencyCache();
     /// get all possible paths from this to another object following the OutList
     std::vector<std::list<App::DocumentObject*>> getPathsByOutList(App::DocumentObject* to) const;
     /// get all objects link to this object
@@ -494,6 +504,22 @@ public:
                                             bool transform = false,
                                             int depth = 0) const;
 
+    /** Return the sub object like getSubObject() without a Python object
+     *
+     * The result and the transformation are cached in the document, so that
+     * repeated queries of the selection and the link view providers don't walk
+     * the object hierarchy again. The cache is dropped on any change of an
+     * object, see Document::getResolutionCacheStats(). Resolutions that pass
+     * a Python getSubObject() or getLinkedObject() are not cached.
+     */
+    DocumentObject* getSubObjectCached(const char* subname,
+                                       Base::Matrix4D* mat = nullptr,
+                                       bool transform = true) const;
+    /// Return the linked object like getLinkedObject(), cached like getSubObjectCached()
+    DocumentObject* getLinkedObjectCached(bool recurse = true,
+                                          Base::Matrix4D* mat = nullptr,
+                                          bool transform = false) const;
+
     /* Return true to cause PropertyView to show linked object's property */
     virtual bool canLinkProperties() const
     {
@@ -673,6 +699,25 @@ public:
         return 0;
     }
 
+    /** Allow the document to recompute this object in a worker thread
+     *
+     * @return Returns true if execute() only reads from the objects in its
+     * out-list and only writes to its own properties, without touching any
+     * Python or GUI state. Such objects may be recomputed concurrently with
+     * independent siblings when the 'ParallelRecompute' document preference
+     * is enabled. The default returns false, i.e. the object is always
+     * recomputed in the calling thread.
+     *
+     * No built-in feature overrides this yet, so the concurrent recompute is
+     * only infrastructure for now. Python features opt in with
+     * '__thread_safe_execute__ = True' on their proxy, but their execute()
+     * holds the GIL, so they only overlap while it is released.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
+
     virtual void onUpdateElementReference(const Property*)
     {}
 
@@ -796,6 +841,26 @@ private:
     mutable std::unordered_map<const char*, App::DocumentObject*, CStringHasher, CStringHasher>
         _outListMap;
     mutable bool _outListCached = false;
+
+    /// The cached result of a recursive in or out list
+    class RecursiveList
+    {
+    public:
+        /// Append the cached objects to \a res, return false if not cached
+        bool get(std::vector<App::DocumentObject*>& res) const;
+        /// 1 if \a obj is in the cached objects, 0 if not and -1 if not cached
+        int contains(const App::DocumentObject* obj) const;
+        /// Cache \a objects obtained at \a generation
+        void set(std::uint64_t generation, const std::vector<App::DocumentObject*>& objects);
+
+    private:
+        std::uint64_t generation {0};
+        std::vector<App::DocumentObject*> objects;
+        // sorted by address to test membership
+        std::vector<App::DocumentObject*> sorted;
+    };
+    mutable RecursiveList _inListRecursive;
+    mutable RecursiveList _outListRecursive;
 };
 
 }  // namespace App
@@ -517,7 +517,7 @@ App::DocumentObject* SubObjectT::getSubObject() const
 {
     auto obj = getObject();
     if (obj) {
-        return obj->getSubObject(subname.c_str());
+        return obj->getSubObjectCached(subname.c_str());
     }
     return nullptr;
 }
@@ -31,6 +31,7 @@
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
 #include "MergeDocuments.h"
+#include "RecomputeProfile.h"
 
 // inclusion of the generated files (generated By DocumentPy.xml)
 #include "DocumentPy.h"
@@ -149,6 +150,56 @@ PyObject* DocumentPy::save(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::saveAsync(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool ok = getDocumentPtr()->saveAsync();
+        return Py::new_reference_to(Py::Boolean(ok));
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::isSavingAsync(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    bool ok = getDocumentPtr()->isSavingAsync();
+    return Py::new_reference_to(Py::Boolean(ok));
+}
+
+PyObject* DocumentPy::waitForSave(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool ok = false;
+        {
+            Base::PyGILStateRelease unlock;
+            ok = getDocumentPtr()->waitForSave();
+        }
+        return Py::new_reference_to(Py::Boolean(ok));
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::abortSave(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->abortSave();
+    Py_Return;
+}
+
 PyObject* DocumentPy::saveAs(PyObject* args)
 {
     char* fn;
@@ -410,6 +461,41 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args)
+{
+    PyObject* pyTypes;
+    PyObject* pyNames = Py_None;
+    if (!PyArg_ParseTuple(args, "O|O", &pyTypes, &pyNames)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<std::string> types;
+        Py::Sequence typeSeq(pyTypes);
+        for (Py_ssize_t i = 0; i < typeSeq.size(); ++i) {
+            types.push_back(Py::String(typeSeq[i]).as_std_string("utf-8"));
+        }
+        std::vector<std::string> names(types.size());
+        if (pyNames != Py_None) {
+            Py::Sequence nameSeq(pyNames);
+            if (nameSeq.size() != typeSeq.size()) {
+                throw Py::ValueError("Number of types and names differ");
+            }
+            for (Py_ssize_t i = 0; i < nameSeq.size(); ++i) {
+                names[i] = Py::String(nameSeq[i]).as_std_string("utf-8");
+            }
+        }
+
+        Py::List list;
+        for (auto obj : getDocumentPtr()->addObjects(types, names)) {
+            list.append(Py::asObject(obj->getPyObject()));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName;
@@ -681,6 +767,32 @@ PyObject *DocumentPy::isAutoCreated(PyObject *args)
     return Py::new_reference_to(Py::Boolean(ok));
 }
 
+namespace
+{
+// Get the objects passed to recompute() or recomputeAsync()
+bool getRecomputeObjects(PyObject* pyobjs, std::vector<App::DocumentObject*>& objs)
+{
+    if (pyobjs == Py_None) {
+        return true;
+    }
+    if (!PySequence_Check(pyobjs)) {
+        PyErr_SetString(PyExc_TypeError, "expect input of sequence of document objects");
+        return false;
+    }
+
+    Py::Sequence seq(pyobjs);
+    for (Py_ssize_t i = 0; i < seq.size(); ++i) {
+        if (!PyObject_TypeCheck(seq[i].ptr(), &DocumentObjectPy::Type)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "Expect element in sequence to be of type document object");
+            return false;
+        }
+        objs.push_back(static_cast<DocumentObjectPy*>(seq[i].ptr())->getDocumentObjectPtr());
+    }
+    return true;
+}
+}  // namespace
+
 PyObject* DocumentPy::recompute(PyObject* args)
 {
     PyObject* pyobjs = Py_None;
@@ -699,22 +811,8 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_TRY
     {
         std::vector<App::DocumentObject*> objs;
-        if (pyobjs != Py_None) {
-            if (!PySequence_Check(pyobjs)) {
-                PyErr_SetString(PyExc_TypeError, "expect input of sequence of document objects");
-                return nullptr;
-            }
-
-            Py::Sequence seq(pyobjs);
-            for (Py_ssize_t i = 0; i < seq.size(); ++i) {
-                if (!PyObject_TypeCheck(seq[i].ptr(), &DocumentObjectPy::Type)) {
-                    PyErr_SetString(PyExc_TypeError,
-                                    "Expect element in sequence to be of type document object");
-                    return nullptr;
-                }
-                objs.push_back(
-                    static_cast<DocumentObjectPy*>(seq[i].ptr())->getDocumentObjectPtr());
-            }
+        if (!getRecomputeObjects(pyobjs, objs)) {
+            return nullptr;
         }
 
         int options = 0;
@@ -736,6 +834,202 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::recomputeAsync(PyObject* args)
+{
+    PyObject* pyobjs = Py_None;
+    PyObject* force = Py_False;
+    PyObject* checkCycle = Py_False;
+    if (!PyArg_ParseTuple(args,
+                          "|OO!O!",
+                          &pyobjs,
+                          &PyBool_Type,
+                          &force,
+                          &PyBool_Type,
+                          &checkCycle)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<App::DocumentObject*> objs;
+        if (!getRecomputeObjects(pyobjs, objs)) {
+            return nullptr;
+        }
+
+        int options = 0;
+        if (Base::asBoolean(checkCycle)) {
+            options = Document::DepNoCycle;
+        }
+
+        bool ok = getDocumentPtr()->recomputeAsync(objs, Base::asBoolean(force), options);
+        return Py::new_reference_to(Py::Boolean(ok));
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::isRecomputingAsync(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    bool ok = getDocumentPtr()->isRecomputingAsync();
+    return Py::new_reference_to(Py::Boolean(ok));
+}
+
+PyObject* DocumentPy::waitForRecompute(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        int objectCount = 0;
+        {
+            // the worker may need the GIL to execute Python features
+            Base::PyGILStateRelease unlock;
+            objectCount = getDocumentPtr()->waitForRecompute();
+        }
+        return Py::new_reference_to(Py::Long(objectCount));
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::abortRecompute(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->abortRecompute();
+    Py_Return;
+}
+
+PyObject* DocumentPy::getRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto toSeconds = [](std::int64_t usec) {
+            return Py::Float(static_cast<double>(usec) / 1e6);
+        };
+        Py::List list;
+        for (const auto& entry : getDocumentPtr()->getRecomputeProfile().getEntries()) {
+            Py::Dict dict;
+            dict.setItem("Name", Py::String(entry.name));
+            dict.setItem("Label", Py::String(entry.label));
+            dict.setItem("TypeId", Py::String(entry.type));
+            dict.setItem("Thread", Py::Long(entry.thread));
+            dict.setItem("Start", toSeconds(entry.start));
+            dict.setItem("Duration", toSeconds(entry.duration));
+            dict.setItem("Execute", toSeconds(entry.executeDuration));
+            Py::List touched;
+            for (const auto& name : entry.touched) {
+                touched.append(Py::String(name));
+            }
+            dict.setItem("Touched", touched);
+            dict.setItem("Failed", Py::Boolean(entry.failed));
+            list.append(dict);
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::exportRecomputeProfile(PyObject* args, PyObject* kwd)
+{
+    char* fn = nullptr;
+    const char* format = "chrome";
+    static const std::array<const char*, 3> kwlist {"filename", "format", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwd, "|zs", kwlist, &fn, &format)) {
+        return nullptr;
+    }
+
+    RecomputeProfile::Format fmt {};
+    if (strcmp(format, "chrome") == 0) {
+        fmt = RecomputeProfile::Format::ChromeTrace;
+    }
+    else if (strcmp(format, "speedscope") == 0) {
+        fmt = RecomputeProfile::Format::Speedscope;
+    }
+    else {
+        PyErr_SetString(PyExc_ValueError, "Format must be 'chrome' or 'speedscope'");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const auto& profile = getDocumentPtr()->getRecomputeProfile();
+        if (fn) {
+            Base::FileInfo fi(fn);
+            Base::ofstream str(fi);
+            profile.exportProfile(str, fmt);
+            str.close();
+            Py_Return;
+        }
+
+        std::stringstream str;
+        profile.exportProfile(str, fmt);
+        return Py::new_reference_to(Py::String(str.str()));
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::getResolutionCacheStats(PyObject* args)
+{
+    PyObject* reset = Py_False;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &reset)) {
+        return nullptr;
+    }
+
+    auto stats = getDocumentPtr()->getResolutionCacheStats();
+    if (Base::asBoolean(reset)) {
+        getDocumentPtr()->resetResolutionCacheStats();
+    }
+    Py::Dict dict;
+    dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+    dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+    dict.setItem("HitRate", Py::Float(stats.hitRate()));
+    dict.setItem("Entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+    return Py::new_reference_to(dict);
+}
+
+PyObject* DocumentPy::memoryReport(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto toLong = [](std::size_t size) {
+            return Py::Long(static_cast<unsigned long long>(size));
+        };
+        auto report = getDocumentPtr()->getMemoryReport();
+        Py::Dict objects;
+        for (const auto& entry : report.objects) {
+            Py::Dict props;
+            for (const auto& prop : entry.properties) {
+                props.setItem(prop.first, toLong(prop.second));
+            }
+            Py::Dict dict;
+            dict.setItem("Total", toLong(entry.total));
+            dict.setItem("Properties", props);
+            objects.setItem(entry.object->getNameInDocument(), dict);
+        }
+        Py::Dict dict;
+        dict.setItem("Objects", objects);
+        dict.setItem("Properties", toLong(report.properties));
+        dict.setItem("StringHasher", toLong(report.hasher));
+        dict.setItem("Undo", toLong(report.undo));
+        dict.setItem("Total", toLong(report.total));
+        return Py::new_reference_to(dict);
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::mustExecute(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -249,11 +250,12 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
         return map;
     }
 
-    std::vector<std::string> postfixes;
+    // The names of all maps share the postfix buffers read here
+    std::vector<QByteArray> postfixes;
     postfixes.reserve(count);
     for (int i = 0; i < count; ++i) {
-        postfixes.emplace_back();
-        stream >> postfixes.back();
+        stream >> tmp;
+        postfixes.emplace_back(tmp.c_str(), static_cast<int>(tmp.size()));
     }
 
     std::vector<ElementMapPtr> childMaps;
@@ -274,7 +276,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
 ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                                   std::istream& stream,
                                   std::vector<ElementMapPtr>& childMaps,
-                                  const std::vector<std::string>& postfixes)
+                                  const std::vector<QByteArray>& postfixes)
 {
     const char* msg = "Invalid element map";
     const int hexBase {16};
@@ -422,7 +424,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                         }
                         long elementIndex = strtol(tokens[1].c_str(), nullptr, hexBase);
                         ref->name = MappedName(
-                            IndexedName::fromConst(postfixes[elementNameIndex - 1].c_str(),
+                            IndexedName::fromConst(postfixes[elementNameIndex - 1].constData(),
                                                    static_cast<int>(elementIndex)));
                         break;
                     }
@@ -444,6 +446,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                     else {
                         ref->name += postfixes[postfixIndex - 1];
+                        postfixPool.insert(ref->name.postfixBytes());
                     }
                 }
 
@@ -510,6 +513,9 @@ MappedName ElementMap::addName(MappedName& name,
             FC_ERR("missing tag postfix " << name);  // NOLINT
         }
     }
+    if (!name.postfixBytes().isEmpty()) {
+        name.sharePostfix(*postfixPool.insert(name.postfixBytes()));
+    }
     while (true) {
         if (overwrite) {
             erase(idx);
@@ -590,7 +596,6 @@ MappedName ElementMap::setElementName(const IndexedName& element,
         sid = &_sid;
     }
 
-    std::ostringstream ss;
     Data::MappedName mappedName(name);
     for (int i = 0;;) {
         IndexedName existing;
@@ -615,6 +620,27 @@ MappedName ElementMap::setElementName(const IndexedName& element,
     }
 }
 
+void ElementMap::setElementNames(std::vector<ElementName>& names, long masterTag, bool overwrite)
+{
+    std::map<const char*, int, CStringComp> maxIndices;
+    for (const auto& entry : names) {
+        if (entry.element && entry.name) {
+            int& index = maxIndices[entry.element.getType()];
+            index = std::max(index, entry.element.getIndex());
+        }
+    }
+    for (const auto& [type, index] : maxIndices) {
+        auto& indices = this->indexedNames[type];
+        if (index >= (int)indices.names.size()) {
+            indices.names.resize(index + 1);
+        }
+    }
+
+    for (auto& entry : names) {
+        entry.name = setElementName(entry.element, entry.name, masterTag, &entry.sids, overwrite);
+    }
+}
+
 // try to hash element name while preserving the source tag
 void ElementMap::encodeElementName(char element_type,
                                    MappedName& name,
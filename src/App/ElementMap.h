@@ -38,6 +38,8 @@
 #include <map>
 #include <memory>
 
+#include <QSet>
+
 
 namespace Data
 {
@@ -126,6 +128,22 @@ public:
                               const ElementIDRefs* sid = nullptr,
                               bool overwrite = false);
 
+    /// An element name for setElementNames()
+    struct ElementName
+    {
+        IndexedName element;
+        MappedName name;
+        ElementIDRefs sids;
+    };
+
+    /** Add many element names at once
+     *
+     * Same as calling setElementName() for every entry in the given order, but
+     * the index lists are grown only once. The stored names are written back
+     * to the entries.
+     */
+    void setElementNames(std::vector<ElementName>& names, long masterTag, bool overwrite = false);
+
     /* Generates a new MappedName from the current details.
      *
      * The result is streamed to `ss` and stored in `name`.
@@ -231,7 +249,7 @@ private:
     ElementMapPtr restore(::App::StringHasherRef hasherRef,
                           std::istream& stream,
                           std::vector<ElementMapPtr>& childMaps,
-                          const std::vector<std::string>& postfixes);
+                          const std::vector<QByteArray>& postfixes);
 
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
@@ -315,6 +333,10 @@ private:
     QHash<QByteArray, ChildMapInfo> childElements;
     std::size_t childElementSize = 0;
 
+    // Postfixes are repeated for every element created by the same operation, the names keep
+    // a shared copy from here instead of their own
+    QSet<QByteArray> postfixPool;
+
     mutable unsigned _id = 0;
 
     void init();
@@ -34,6 +34,8 @@
 #include <boost/math/special_functions/round.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 
+#include <algorithm>
+#include <array>
 #include <numbers>
 #include <limits>
 #include <sstream>
@@ -646,6 +648,132 @@ Expression* expressionFromPy(const DocumentObject *owner, const Py::Object &valu
 
 } // namespace App
 
+//
+// Numeric evaluation, mirrors the result of the evaluation through Python
+//
+
+using NumericValue = Expression::NumericValue;
+using NumericType = Expression::NumericValue::Type;
+
+// Python turns integers into arbitrary precision numbers, so integer arithmetic is
+// only done as long as the results are exact in a double and fit into a long
+static constexpr double MaxExactInteger = 9007199254740992.0;
+
+static bool toInteger(double v, long &l) {
+    if (!(std::fabs(v) < MaxExactInteger)
+            || v > static_cast<double>(std::numeric_limits<long>::max())
+            || v < static_cast<double>(std::numeric_limits<long>::min()))
+        return false;
+    l = static_cast<long>(v);
+    return true;
+}
+
+static void setIntegerValue(NumericValue &value, long l) {
+    value.type = NumericType::Integer;
+    value.integer = l;
+}
+
+static void setBooleanValue(NumericValue &value, bool b) {
+    value.type = NumericType::Boolean;
+    value.integer = b ? 1 : 0;
+}
+
+static void setFloatValue(NumericValue &value, double d) {
+    value.type = NumericType::Float;
+    value.real = d;
+}
+
+static void setQuantityValue(NumericValue &value, const Quantity &q) {
+    value.type = NumericType::Quantity;
+    value.quantity = q;
+}
+
+// same as pyFromQuantity()
+static void setNumberValue(NumericValue &value, const Quantity &q) {
+    if (!q.isDimensionless()) {
+        setQuantityValue(value, q);
+        return;
+    }
+    long l;
+    int i;
+    switch(essentiallyInteger(q.getValue(),l,i)) {
+    case 1:
+    case 2:
+        setIntegerValue(value, l);
+        break;
+    default:
+        setFloatValue(value, q.getValue());
+    }
+}
+
+static bool isIntegerValue(const NumericValue &value) {
+    return value.type == NumericType::Integer || value.type == NumericType::Boolean;
+}
+
+static bool toDouble(const NumericValue &value, double &d) {
+    switch(value.type) {
+    case NumericType::Boolean:
+    case NumericType::Integer:
+        if (std::fabs(static_cast<double>(value.integer)) > MaxExactInteger)
+            return false;
+        d = static_cast<double>(value.integer);
+        return true;
+    case NumericType::Float:
+        d = value.real;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// same as pyToQuantity()
+static Quantity toQuantity(const NumericValue &value) {
+    switch(value.type) {
+    case NumericType::Boolean:
+    case NumericType::Integer:
+        return Quantity(static_cast<double>(value.integer));
+    case NumericType::Float:
+        return Quantity(value.real);
+    default:
+        return value.quantity;
+    }
+}
+
+static bool isTrueValue(const NumericValue &value) {
+    switch(value.type) {
+    case NumericType::Boolean:
+    case NumericType::Integer:
+        return value.integer != 0;
+    case NumericType::Float:
+        return value.real != 0.0;
+    default:
+        return value.quantity.getValue() != 0.0;
+    }
+}
+
+// same as pyObjectToAny()
+App::any Expression::NumericValue::toAny() const {
+    switch(type) {
+    case NumericType::Boolean:
+    case NumericType::Integer:
+        return App::any(integer);
+    case NumericType::Float:
+        return App::any(real);
+    default:
+        return App::any(quantity);
+    }
+}
+
+// same as expressionFromPy()
+static Expression *numericToExpression(const DocumentObject *owner, const NumericValue &value) {
+    if (value.type == NumericType::Boolean) {
+        if (value.integer)
+            return new ConstantExpression(owner,"True",Quantity(1.0));
+        return new ConstantExpression(owner,"False",Quantity(0.0));
+    }
+    return new NumberExpression(owner,toQuantity(value));
+}
+
 //
 // Expression component
 //
@@ -1092,10 +1220,23 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    NumericValue value;
+    if (getNumericValue(value))
+        return value.toAny();
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
 
+bool Expression::getNumericValue(NumericValue &value) const {
+    if (!components.empty())
+        return false;
+    try {
+        return _getNumericValue(value);
+    } catch (Base::Exception &) {
+        return false;
+    }
+}
+
 Py::Object Expression::getPyValue() const {
     try {
         Py::Object pyobj = _getPyValue();
@@ -1123,6 +1264,9 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    NumericValue value;
+    if (getNumericValue(value))
+        return numericToExpression(owner,value);
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
@@ -1256,6 +1400,11 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_getNumericValue(NumericValue &value) const {
+    setNumberValue(value, quantity);
+    return true;
+}
+
 //
 // NumberExpression class
 //
@@ -1465,6 +1614,246 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+// Same result as calc() for Python numbers and quantities. Returns false where
+// Python raises an error, or switches to arbitrary precision integers.
+static bool calcNumeric(int op, const NumericValue &l, const NumericValue &r, NumericValue &res)
+{
+    if (l.type == NumericType::Quantity || r.type == NumericType::Quantity) {
+        // see QuantityPy
+        switch(op) {
+        case OperatorExpression::ADD:
+            setQuantityValue(res, toQuantity(l) + toQuantity(r));
+            return true;
+        case OperatorExpression::SUB:
+            setQuantityValue(res, toQuantity(l) - toQuantity(r));
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            setQuantityValue(res, toQuantity(l) * toQuantity(r));
+            return true;
+        case OperatorExpression::DIV:
+            setQuantityValue(res, toQuantity(l) / toQuantity(r));
+            return true;
+        case OperatorExpression::POW:
+            if (l.type != NumericType::Quantity)
+                return false;
+            if (r.type == NumericType::Quantity)
+                setQuantityValue(res, l.quantity.pow(r.quantity));
+            else if (r.type == NumericType::Float)
+                setQuantityValue(res, l.quantity.pow(r.real));
+            else
+                setQuantityValue(res, l.quantity.pow(static_cast<double>(r.integer)));
+            return true;
+        default:
+            break;
+        }
+        if (l.type != r.type)
+            return false;
+        const Quantity &a = l.quantity;
+        const Quantity &b = r.quantity;
+        switch(op) {
+        case OperatorExpression::EQ:
+            setBooleanValue(res, a == b);
+            return true;
+        case OperatorExpression::NEQ:
+            setBooleanValue(res, !(a == b));
+            return true;
+        case OperatorExpression::LT:
+            setBooleanValue(res, a < b);
+            return true;
+        case OperatorExpression::LTE:
+            setBooleanValue(res, (a < b) || (a == b));
+            return true;
+        case OperatorExpression::GT:
+            setBooleanValue(res, !(a < b) && !(a == b));
+            return true;
+        case OperatorExpression::GTE:
+            setBooleanValue(res, !(a < b));
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    double a, b;
+    if (!toDouble(l, a) || !toDouble(r, b))
+        return false;
+
+    if (isIntegerValue(l) && isIntegerValue(r)) {
+        long i = l.integer;
+        long j = r.integer;
+        long k;
+        switch(op) {
+        case OperatorExpression::ADD:
+            if (!toInteger(a + b, k))
+                return false;
+            setIntegerValue(res, k);
+            return true;
+        case OperatorExpression::SUB:
+            if (!toInteger(a - b, k))
+                return false;
+            setIntegerValue(res, k);
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            if (!toInteger(a * b, k))
+                return false;
+            setIntegerValue(res, k);
+            return true;
+        case OperatorExpression::DIV:
+            if (j == 0)
+                return false;
+            setFloatValue(res, a / b);
+            return true;
+        case OperatorExpression::MOD:
+            if (j == 0)
+                return false;
+            // the result has the sign of the divisor
+            k = (j == -1) ? 0 : i % j;
+            if (k != 0 && ((k < 0) != (j < 0)))
+                k += j;
+            setIntegerValue(res, k);
+            return true;
+        case OperatorExpression::POW: {
+            if (j < 0) {
+                if (i == 0)
+                    return false;
+                setFloatValue(res, std::pow(a, b));
+                return true;
+            }
+            double p = 1.0;
+            if (i == 0 || i == 1)
+                p = (i == 0 && j > 0) ? 0.0 : 1.0;
+            else if (i == -1)
+                p = (j % 2) ? -1.0 : 1.0;
+            else {
+                for (long n = 0; n < j; ++n) {
+                    p *= a;
+                    if (!(std::fabs(p) < MaxExactInteger))
+                        return false;
+                }
+            }
+            if (!toInteger(p, k))
+                return false;
+            setIntegerValue(res, k);
+            return true;
+        }
+        case OperatorExpression::EQ:
+            setBooleanValue(res, i == j);
+            return true;
+        case OperatorExpression::NEQ:
+            setBooleanValue(res, i != j);
+            return true;
+        case OperatorExpression::LT:
+            setBooleanValue(res, i < j);
+            return true;
+        case OperatorExpression::LTE:
+            setBooleanValue(res, i <= j);
+            return true;
+        case OperatorExpression::GT:
+            setBooleanValue(res, i > j);
+            return true;
+        case OperatorExpression::GTE:
+            setBooleanValue(res, i >= j);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    switch(op) {
+    case OperatorExpression::ADD:
+        setFloatValue(res, a + b);
+        return true;
+    case OperatorExpression::SUB:
+        setFloatValue(res, a - b);
+        return true;
+    case OperatorExpression::MUL:
+    case OperatorExpression::UNIT:
+        setFloatValue(res, a * b);
+        return true;
+    case OperatorExpression::DIV:
+        if (b == 0.0)
+            return false;
+        setFloatValue(res, a / b);
+        return true;
+    case OperatorExpression::MOD: {
+        if (b == 0.0)
+            return false;
+        double m = std::fmod(a, b);
+        if (m != 0.0) {
+            if ((b < 0.0) != (m < 0.0))
+                m += b;
+        }
+        else
+            m = std::copysign(0.0, b);
+        setFloatValue(res, m);
+        return true;
+    }
+    case OperatorExpression::POW: {
+        // Python raises an error for these or returns a complex number
+        if ((a == 0.0 && b < 0.0) || (a < 0.0 && b != std::floor(b)))
+            return false;
+        double p = std::pow(a, b);
+        if (std::isinf(p) && std::isfinite(a) && std::isfinite(b))
+            return false;
+        setFloatValue(res, p);
+        return true;
+    }
+    case OperatorExpression::EQ:
+        setBooleanValue(res, a == b);
+        return true;
+    case OperatorExpression::NEQ:
+        setBooleanValue(res, a != b);
+        return true;
+    case OperatorExpression::LT:
+        setBooleanValue(res, a < b);
+        return true;
+    case OperatorExpression::LTE:
+        setBooleanValue(res, a <= b);
+        return true;
+    case OperatorExpression::GT:
+        setBooleanValue(res, a > b);
+        return true;
+    case OperatorExpression::GTE:
+        setBooleanValue(res, a >= b);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool OperatorExpression::_getNumericValue(NumericValue &value) const {
+    NumericValue l;
+    if (!left->getNumericValue(l))
+        return false;
+
+    switch(op) {
+    case NEG:
+        if (l.type == NumericType::Quantity)
+            setQuantityValue(value, l.quantity * -1.0);
+        else if (l.type == NumericType::Float)
+            setFloatValue(value, -l.real);
+        else if (l.integer == std::numeric_limits<long>::min())
+            return false;
+        else
+            setIntegerValue(value, -l.integer);
+        return true;
+    case POS:
+        value = l;
+        if (value.type == NumericType::Boolean)
+            value.type = NumericType::Integer;
+        return true;
+    default:
+        break;
+    }
+
+    NumericValue r;
+    if (!right->getNumericValue(r))
+        return false;
+    return calcNumeric(op, l, r, value);
+}
+
 /**
   * Simplify the expression. For OperatorExpressions, we return a NumberExpression if
   * both the left and right side can be simplified to NumberExpressions. In this case
@@ -2135,8 +2524,6 @@ Base::Vector3d FunctionExpression::extractVectorArgument(
 
 Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std::vector<Expression*> &args)
 {
-    using std::numbers::pi;
-
     if(!expr || !expr->getOwner())
         _EXPR_THROW("Invalid owner.", expr);
 
@@ -2394,6 +2781,35 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         v3 = pyToQuantity(e3,expr,"Invalid third argument.");
     }
 
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            Base::toRadians(v1.getValue()))));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    default:
+        break;
+    }
+
+    return Py::asObject(new QuantityPy(new Quantity(evaluateScalar(expr, f, v1, v2, v3, args.size()))));
+}
+
+/**
+  * Evaluates the functions that compute a quantity from up to three quantities.
+  */
+
+Quantity FunctionExpression::evaluateScalar(const Expression *expr, int f,
+        const Quantity &v1, const Quantity &v2, const Quantity &v3, std::size_t numArguments)
+{
+    using std::numbers::pi;
+
     double output;
     Unit unit;
     double scaler = 1;
@@ -2405,9 +2821,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2447,7 +2860,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         unit = v1.getUnit().cbrt();
         break;
     case ATAN2:
-        if (e2.isNone())
+        if (numArguments < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2456,14 +2869,14 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / pi;
         break;
     case MOD:
-        if (e2.isNone())
+        if (numArguments < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit() && !v1.isDimensionless() && !v2.isDimensionless())
             _EXPR_THROW("Units must be equal or dimensionless.",expr);
         unit = v1.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (numArguments < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2481,23 +2894,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (numArguments < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (numArguments > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
@@ -2562,11 +2969,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (numArguments > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (numArguments > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2581,25 +2988,38 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
     return evaluate(this,f,args);
 }
 
+bool FunctionExpression::_getNumericValue(NumericValue &value) const {
+    if (!owner || args.empty())
+        return false;
+
+    if (f == HIDDENREF || f == HREF)
+        return args[0]->getNumericValue(value);
+    if (f < ABS || f > TRUNC)
+        return false;
+
+    std::array<Quantity,3> v;
+    std::size_t count = std::min<std::size_t>(args.size(), v.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        NumericValue arg;
+        if (!args[i]->getNumericValue(arg))
+            return false;
+        v[i] = toQuantity(arg);
+    }
+    setQuantityValue(value, evaluateScalar(this, f, v[0], v[1], v[2], args.size()));
+    return true;
+}
+
 /**
   * Try to simplify the expression, i.e calculate all constant expressions.
   *
@@ -2861,6 +3281,7 @@ const Property * VariableExpression::getProperty() const
 }
 
 void VariableExpression::addComponent(Component *c) {
+    numericEpoch = 0;
     do {
         if(!components.empty())
             break;
@@ -2914,6 +3335,75 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+// Counts the changes that may resolve an object identifier to another property.
+// Changes of the identifier itself reset the epoch of the VariableExpression.
+static unsigned long _ResolveEpoch = 1;
+
+static void watchResolveChanges() {
+    // function-local static, so that concurrent evaluations connect only once
+    static const bool inited = [] {
+        auto &app = GetApplication();
+        auto onObject = [](const DocumentObject &) { ++_ResolveEpoch; };
+        auto onProperty = [](const Property &) { ++_ResolveEpoch; };
+        auto onDocument = [](const Document &) { ++_ResolveEpoch; };
+        app.signalNewObject.connect(onObject);
+        app.signalDeletedObject.connect(onObject);
+        app.signalRelabelObject.connect(onObject);
+        app.signalAppendDynamicProperty.connect(onProperty);
+        app.signalRemoveDynamicProperty.connect(onProperty);
+        app.signalRenameDynamicProperty.connect([](const Property &, const char *) { ++_ResolveEpoch; });
+        app.signalNewDocument.connect([](const Document &, bool) { ++_ResolveEpoch; });
+        app.signalDeleteDocument.connect(onDocument);
+        app.signalRelabelDocument.connect(onDocument);
+        app.signalRenameDocument.connect(onDocument);
+        return true;
+    }();
+    (void)inited;
+}
+
+bool VariableExpression::_getNumericValue(NumericValue &value) const {
+    if (numericEpoch != _ResolveEpoch) {
+        if (!owner)
+            return false;
+        watchResolveChanges();
+        numericEpoch = _ResolveEpoch;
+        numericProperty = var.getWholeProperty();
+        if (numericProperty) {
+            if (numericProperty->isDerivedFrom<PropertyQuantity>())
+                numericType = NumericType::Quantity;
+            else if (numericProperty->isDerivedFrom<PropertyFloat>())
+                numericType = NumericType::Float;
+            else if (numericProperty->isDerivedFrom<PropertyInteger>())
+                numericType = NumericType::Integer;
+            else if (numericProperty->isDerivedFrom<PropertyBool>())
+                numericType = NumericType::Boolean;
+            else
+                numericProperty = nullptr;
+        }
+    }
+    if (!numericProperty)
+        return false;
+
+    // same values as the getPyObject() of the properties
+    switch(numericType) {
+    case NumericType::Quantity: {
+        auto prop = static_cast<const PropertyQuantity*>(numericProperty);
+        setQuantityValue(value, Quantity(prop->getValue(), prop->getUnit()));
+        break;
+    }
+    case NumericType::Float:
+        setFloatValue(value, static_cast<const PropertyFloat*>(numericProperty)->getValue());
+        break;
+    case NumericType::Integer:
+        setIntegerValue(value, static_cast<const PropertyInteger*>(numericProperty)->getValue());
+        break;
+    case NumericType::Boolean:
+        setBooleanValue(value, static_cast<const PropertyBool*>(numericProperty)->getValue());
+        break;
+    }
+    return true;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -2953,29 +3443,34 @@ void VariableExpression::_getIdentifiers(std::map<App::ObjectIdentifier,bool> &d
 bool VariableExpression::_relabeledDocument(const std::string &oldName,
         const std::string &newName, ExpressionVisitor &v)
 {
+    numericEpoch = 0;
     return var.relabeledDocument(v, oldName, newName);
 }
 
 bool VariableExpression::_adjustLinks(
         const std::set<App::DocumentObject *> &inList, ExpressionVisitor &v)
 {
+    numericEpoch = 0;
     return var.adjustLinks(v,inList);
 }
 
 void VariableExpression::_importSubNames(const ObjectIdentifier::SubNameMap &subNameMap)
 {
+    numericEpoch = 0;
     var.importSubNames(subNameMap);
 }
 
 void VariableExpression::_updateLabelReference(
         App::DocumentObject *obj, const std::string &ref, const char *newLabel)
 {
+    numericEpoch = 0;
     var.updateLabelReference(obj,ref,newLabel);
 }
 
 bool VariableExpression::_updateElementReference(
         App::DocumentObject *feature, bool reverse, ExpressionVisitor &v)
 {
+    numericEpoch = 0;
     return var.updateElementReference(v,feature,reverse);
 }
 
@@ -2988,6 +3483,7 @@ bool VariableExpression::_renameObjectIdentifier(
     auto it = paths.find(oldPath);
     if (it != paths.end()) {
         visitor.aboutToChange();
+        numericEpoch = 0;
         const bool originalHasDocumentObjectName = var.hasDocumentObjectName();
         ObjectIdentifier::String originalDocumentObjectName = var.getDocumentObjectName();
         std::string originalSubObjectName = var.getSubObjectName();
@@ -3034,6 +3530,7 @@ void VariableExpression::_moveCells(const CellAddress &address,
     int thisCol = addr.col();
     if (thisRow >= address.row() || thisCol >= address.col()) {
         v.aboutToChange();
+        numericEpoch = 0;
         addr.setRow(thisRow + rowCount);
         addr.setCol(thisCol + colCount);
         var.setComponent(idx,ObjectIdentifier::SimpleComponent(addr.toString()));
@@ -3060,6 +3557,7 @@ void VariableExpression::_offsetCells(int rowOffset, int colOffset, ExpressionVi
                 << '(' << colOffset << ", " << rowOffset << ')');
     } else {
         v.aboutToChange();
+        numericEpoch = 0;
         var.setComponent(idx,ObjectIdentifier::SimpleComponent(addr.toString()));
     }
 }
@@ -3067,6 +3565,7 @@ void VariableExpression::_offsetCells(int rowOffset, int colOffset, ExpressionVi
 void VariableExpression::setPath(const ObjectIdentifier &path)
 {
      var = path;
+     numericEpoch = 0;
 }
 
 //
@@ -3193,6 +3692,15 @@ Py::Object ConditionalExpression::_getPyValue() const {
         return falseExpr->getPyValue();
 }
 
+bool ConditionalExpression::_getNumericValue(NumericValue &value) const {
+    NumericValue cond;
+    if (!condition->getNumericValue(cond))
+        return false;
+    if (isTrueValue(cond))
+        return trueExpr->getNumericValue(value);
+    return falseExpr->getNumericValue(value);
+}
+
 Expression *ConditionalExpression::simplify() const
 {
     std::unique_ptr<Expression> e(condition->simplify());
@@ -3279,6 +3787,18 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_getNumericValue(NumericValue &value) const {
+    if(strcmp(name,"None")==0)
+        return false;
+    if(strcmp(name,"True")==0)
+        setBooleanValue(value, true);
+    else if(strcmp(name, "False")==0)
+        setBooleanValue(value, false);
+    else
+        setNumberValue(value, getQuantity());
+    return true;
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
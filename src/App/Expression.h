@@ -32,13 +32,9 @@
 #include <App/Range.h>
 #include <Base/Exception.h>
 #include <Base/BaseClass.h>
+#include <Base/Quantity.h>
 
 
-namespace Base
-{
-class Quantity;
-}
-
 namespace App  {
 
 class DocumentObject;
@@ -188,6 +184,36 @@ public:
 
     Py::Object getPyValue() const;
 
+    /// Result of getNumericValue(), typed like the Python object getPyValue() returns
+    struct NumericValue {
+        enum class Type {
+            Boolean,
+            Integer,
+            Float,
+            Quantity,
+        };
+        Type type {Type::Integer};
+        long integer {0};
+        double real {0.0};
+        Base::Quantity quantity;
+
+        /// Same value as the one getValueAsAny() returns
+        boost::any toAny() const;
+    };
+
+    /** Evaluates the expression without creating Python objects
+     *
+     * This works for numbers, operators, conditionals, the scalar math functions and
+     * references to boolean, integer, float and quantity properties. The references
+     * are resolved once and resolved again after objects, labels or dynamic properties
+     * change. No Python is used, so different expressions may be evaluated on
+     * several threads as long as the documents aren't changed meanwhile.
+     *
+     * @return false if the expression has to be evaluated by getPyValue(), also when
+     * the evaluation fails so that getPyValue() reports the error.
+     */
+    bool getNumericValue(NumericValue &value) const;
+
     bool isSame(const Expression &other, bool checkComment=true) const;
 
     friend class ExpressionVisitor;
@@ -214,6 +240,7 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _getNumericValue(NumericValue &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
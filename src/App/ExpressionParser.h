@@ -118,6 +118,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -168,6 +169,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -237,6 +239,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _getNumericValue(NumericValue& value) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -275,6 +279,7 @@ protected:
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
 
 protected:
     Expression* condition; /**< Condition */
@@ -420,7 +425,14 @@ protected:
                                              const std::vector<Expression*>& arguments,
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
+    static Base::Quantity evaluateScalar(const Expression* expression,
+                                         int type,
+                                         const Base::Quantity& v1,
+                                         const Base::Quantity& v2,
+                                         const Base::Quantity& v3,
+                                         std::size_t numArguments);
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -471,6 +483,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
@@ -491,6 +504,13 @@ protected:
 
 protected:
     ObjectIdentifier var; /**< Variable name  */
+
+private:
+    // The numeric property var refers to and the resolve epoch it was looked up
+    // in, a null property means that var doesn't refer to a numeric property.
+    mutable const App::Property* numericProperty = nullptr;
+    mutable NumericValue::Type numericType = NumericValue::Type::Float;
+    mutable unsigned long numericEpoch = 0;
 };
 
 //////////////////////////////////////////////////////////////////////
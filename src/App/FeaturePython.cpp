@@ -59,6 +59,12 @@ void FeaturePythonImp::init(PyObject* pyobj)
 {
     Base::PyGILStateLocker lock;
     has__object__ = !!PyObject_HasAttrString(pyobj, "__object__");
+    threadSafeExecute = false;
+    if (Base::pyHasAttr(pyobj, "__thread_safe_execute__")) {
+        Py::Object flag(PyObject_GetAttrString(pyobj, "__thread_safe_execute__"), true);
+        threadSafeExecute = !flag.isNull() && PyObject_IsTrue(flag.ptr()) == 1;
+        PyErr_Clear();
+    }
 
 #undef FC_PY_ELEMENT
 #define FC_PY_ELEMENT(_name) FC_PY_ELEMENT_INIT(_name)
@@ -262,6 +268,16 @@ void FeaturePythonImp::unsetupObject()
     }
 }
 
+namespace
+{
+thread_local std::uint64_t transformOverrideCalls = 0;
+}
+
+std::uint64_t FeaturePythonImp::getTransformOverrideCalls()
+{
+    return transformOverrideCalls;
+}
+
 bool FeaturePythonImp::getSubObject(DocumentObject*& ret,
                                     const char* subname,
                                     PyObject** pyObj,
@@ -270,6 +286,7 @@ bool FeaturePythonImp::getSubObject(DocumentObject*& ret,
                                     int depth) const
 {
     FC_PY_CALL_CHECK(getSubObject);
+    ++transformOverrideCalls;
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(6);
@@ -379,6 +396,7 @@ bool FeaturePythonImp::getLinkedObject(DocumentObject*& ret,
                                        int depth) const
 {
     FC_PY_CALL_CHECK(getLinkedObject);
+    ++transformOverrideCalls;
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(5);
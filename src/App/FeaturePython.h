@@ -24,6 +24,8 @@
 #ifndef APP_FEATUREPYTHON_H
 #define APP_FEATUREPYTHON_H
 
+#include <cstdint>
+
 #include <App/GeoFeature.h>
 #include <App/PropertyPythonObject.h>
 
@@ -72,6 +74,12 @@ public:
                          bool transform,
                          int depth) const;
 
+    /** Number of calls of a Python getSubObject() or getLinkedObject() on this thread
+     * Those may assign the matrix instead of multiplying it, so a change of
+     * this number tells that a resolution must not be cached.
+     */
+    static std::uint64_t getTransformOverrideCalls();
+
     ValueT canLinkProperties() const;
 
     ValueT allowDuplicateLabel() const;
@@ -91,9 +99,16 @@ public:
 
     bool editProperty(const char* propName);
 
+    /// Whether the proxy class declares '__thread_safe_execute__ = True'
+    bool canRecomputeConcurrently() const
+    {
+        return threadSafeExecute;
+    }
+
 private:
     App::DocumentObject* object;
     bool has__object__ {false};
+    bool threadSafeExecute {false};
 
 #define FC_PY_FEATURE_PYTHON                                                                       \
     FC_PY_ELEMENT(execute)                                                                         \
@@ -121,7 +136,9 @@ private:
 #define FC_PY_ELEMENT_INIT(_name)                                                                  \
     FC_PY_GetCallable(pyobj, #_name, py_##_name);                                                  \
     if (!py_##_name.isNone()) {                                                                    \
-        PyObject* pyRecursive = PyObject_GetAttrString(pyobj, "__allow_recursive_" #_name);        \
+        PyObject* pyRecursive = Base::pyHasAttr(pyobj, "__allow_recursive_" #_name)                \
+            ? PyObject_GetAttrString(pyobj, "__allow_recursive_" #_name)                           \
+            : nullptr;                                                                             \
         if (!pyRecursive) {                                                                        \
             PyErr_Clear();                                                                         \
             _Flags.set(FlagAllowRecursive_##_name, false);                                         \
@@ -334,6 +351,19 @@ public:
         return FeatureT::canLoadPartial();
     }
 
+    /** Python features are serialized unless the proxy opts in
+     *
+     * A proxy declaring '__thread_safe_execute__ = True' promises that its
+     * execute() only reads the out-list and writes its own properties. The
+     * GIL is still taken inside execute(), so such objects only run truly in
+     * parallel while the proxy is inside a native call that releases it, e.g.
+     * the boolean and offset operations of Part.Shape.
+     */
+    bool canRecomputeConcurrently() const override
+    {
+        return imp->canRecomputeConcurrently();
+    }
+
     /**
      * @brief Called when a property is edited by the user.
      *
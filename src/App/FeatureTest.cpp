@@ -371,3 +371,20 @@ DocumentObjectExecReturn* FeatureTestAttribute::execute()
     }
     return StdReturn;
 }
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(App::FeatureTestConcurrent, App::DocumentObject)
+
+
+FeatureTestConcurrent::FeatureTestConcurrent()
+{
+    ADD_PROPERTY_TYPE(Input, (0), "Test", Prop_None, "");
+    ADD_PROPERTY_TYPE(Output, (0), "Test", Prop_Output, "Twice the input");
+}
+
+DocumentObjectExecReturn* FeatureTestConcurrent::execute()
+{
+    Output.setValue(Input.getValue() * 2);
+    return StdReturn;
+}
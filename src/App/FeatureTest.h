@@ -218,6 +218,27 @@ public:
     App::PropertyString Attribute;
 };
 
+/// A feature that may be recomputed concurrently with its siblings
+class FeatureTestConcurrent: public DocumentObject
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(App::FeatureTestConcurrent);
+
+public:
+    FeatureTestConcurrent();
+
+    App::PropertyInteger Input;
+    App::PropertyInteger Output;
+
+    /** @name methods override Feature */
+    //@{
+    DocumentObjectExecReturn* execute() override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
+    //@}
+};
+
 
 }  // namespace App
 
@@ -191,6 +191,7 @@ def InitApplications():
                 Err('Please look into the log file for further information\n')
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
+            FreeCAD.addStartupPhase('Init.py of ' + os.path.basename(Dir))
         else:
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
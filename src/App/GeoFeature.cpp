@@ -155,11 +155,11 @@ DocumentObject* GeoFeature::resolveElement(const DocumentObject* obj,
     if (_element) {
         *_element = element;
     }
-    auto sobj = obj->getSubObject(std::string(subname, element).c_str());
+    auto sobj = obj->getSubObjectCached(std::string(subname, element).c_str());
     if (!sobj) {
         return nullptr;
     }
-    auto linked = sobj->getLinkedObject(true);
+    auto linked = sobj->getLinkedObjectCached(true);
     auto geo = freecad_cast<GeoFeature*>(linked);
     if (!geo && linked) {
         auto ext = linked->getExtensionByType<LinkBaseExtension>(true);
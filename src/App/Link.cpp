@@ -78,6 +78,7 @@ public:
         funcs;
 
     bool CopyOnChangeApplyToAll;  // Auto generated code. See class document of LinkParams.
+    long MaxElementObjects;       // Auto generated code. See class document of LinkParams.
 
     // Auto generated code. See class document of LinkParams.
     LinkParamsP()
@@ -88,6 +89,8 @@ public:
 
         CopyOnChangeApplyToAll = handle->GetBool("CopyOnChangeApplyToAll", true);
         funcs["CopyOnChangeApplyToAll"] = &LinkParamsP::updateCopyOnChangeApplyToAll;
+        MaxElementObjects = handle->GetInt("MaxElementObjects", 5000);
+        funcs["MaxElementObjects"] = &LinkParamsP::updateMaxElementObjects;
     }
 
     // Auto generated code. See class document of LinkParams.
@@ -112,6 +115,11 @@ public:
     {
         self->CopyOnChangeApplyToAll = self->handle->GetBool("CopyOnChangeApplyToAll", true);
     }
+    // Auto generated code. See class document of LinkParams.
+    static void updateMaxElementObjects(LinkParamsP* self)
+    {
+        self->MaxElementObjects = self->handle->GetInt("MaxElementObjects", 5000);
+    }
 };
 
 // Auto generated code. See class document of LinkParams.
@@ -163,6 +171,42 @@ void LinkParams::removeCopyOnChangeApplyToAll()
 {
     instance()->handle->RemoveBool("CopyOnChangeApplyToAll");
 }
+
+// Auto generated code. See class document of LinkParams.
+const char* LinkParams::docMaxElementObjects()
+{
+    return QT_TRANSLATE_NOOP(
+        "LinkParams",
+        "Maximum number of link element objects of a link array. An array that grows\n"
+        "beyond it switches off ShowElement and keeps its elements only as placement,\n"
+        "scale, visibility and material lists. Zero for no limit.");
+}
+
+// Auto generated code. See class document of LinkParams.
+const long& LinkParams::getMaxElementObjects()
+{
+    return instance()->MaxElementObjects;
+}
+
+// Auto generated code. See class document of LinkParams.
+const long& LinkParams::defaultMaxElementObjects()
+{
+    static const long def = 5000;
+    return def;
+}
+
+// Auto generated code. See class document of LinkParams.
+void LinkParams::setMaxElementObjects(const long& v)
+{
+    instance()->handle->SetInt("MaxElementObjects", v);
+    instance()->MaxElementObjects = v;
+}
+
+// Auto generated code. See class document of LinkParams.
+void LinkParams::removeMaxElementObjects()
+{
+    instance()->handle->RemoveInt("MaxElementObjects");
+}
 //[[[end]]]
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1967,6 +2011,19 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
         }
         else if (getElementListProperty()) {
             auto objs = getElementListValue();
+            // Too many elements for an object each, keep them as lists instead
+            long maxObjects = LinkParams::getMaxElementObjects();
+            auto showElement = _getShowElementProperty();
+            if (showElement && maxObjects > 0 && elementCount > objs.size()
+                && elementCount > static_cast<size_t>(maxObjects)
+                && !parent->getDocument()->isPerformingTransaction()) {
+                FC_WARN(parent->getFullName()
+                        << " has more than " << maxObjects
+                        << " elements, turning off ShowElement");
+                showElement->setValue(false);
+                update(parent, prop);
+                return;
+            }
             if (elementCount > objs.size()) {
                 std::string name = parent->getNameInDocument();
                 auto doc = parent->getDocument();
@@ -814,6 +814,19 @@ public:
     static const char* docCopyOnChangeApplyToAll();
     //@}
 
+    //@{
+    /// Accessor for parameter MaxElementObjects
+    ///
+    /// Maximum number of link element objects of a link array. An array that grows
+    /// beyond it switches off ShowElement and keeps its elements only as placement,
+    /// scale, visibility and material lists. Zero for no limit.
+    static const long& getMaxElementObjects();
+    static const long& defaultMaxElementObjects();
+    static void removeMaxElementObjects();
+    static void setMaxElementObjects(const long& v);
+    static const char* docMaxElementObjects();
+    //@}
+
     // Auto generated code. See class document of LinkParams.
 };
 }  // namespace App
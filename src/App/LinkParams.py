@@ -24,6 +24,14 @@ Params = [
 Stores the last user choice of whether to apply CopyOnChange setup to all link
 that links to the same configurable object""",
     ),
+    ParamInt(
+        "MaxElementObjects",
+        5000,
+        """\
+Maximum number of link element objects of a link array. An array that grows
+beyond it switches off ShowElement and keeps its elements only as placement,
+scale, visibility and material lists. Zero for no limit.""",
+    ),
 ]
 
 
@@ -726,6 +726,15 @@ public:
     /// Ensure that this data is unshared, making a copy if necessary.
     void compact() const;
 
+    /// Replace the postfix by \a other if both hold the same bytes, so that many names with an
+    /// equal postfix share a single buffer.
+    void sharePostfix(const QByteArray& other)
+    {
+        if (this->postfix == other) {
+            this->postfix = other;
+        }
+    }
+
     /// Boolean conversion is the inverse of empty(), returning true if there is data in either the
     /// data or postfix, and false if there is nothing in either.
     explicit operator bool() const
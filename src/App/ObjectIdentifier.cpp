@@ -1080,6 +1080,13 @@ void ObjectIdentifier::getDepLabels(const ResolveResults& result,
     }
 }
 
+void ObjectIdentifier::getDocumentLabelReferences(std::vector<std::string>& labels) const
+{
+    if (documentNameSet && documentName.isRealString()) {
+        labels.push_back(documentName.getString());
+    }
+}
+
 ObjectIdentifier::Dependencies ObjectIdentifier::getDep(bool needProps,
                                                         std::vector<std::string>* labels) const
 {
@@ -1218,6 +1225,21 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getWholeProperty() const
+{
+    // checked first, resolving a sub-object may call into Python
+    if (!subObjectName.getString().empty()) {
+        return nullptr;
+    }
+    ResolveResults result(*this);
+    if (!result.resolvedDocumentObject || !result.resolvedProperty
+        || result.propertyType != PseudoNone || result.propertyIndex + 1 != static_cast<int>(components.size())
+        || result.resolvedProperty->getContainer() != result.resolvedDocumentObject) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
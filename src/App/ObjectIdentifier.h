@@ -986,6 +986,15 @@ public:
      */
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /**
+     * @brief Get the property if the object identifier refers to it as a whole.
+     *
+     * @return A pointer to the property of the resolved document object, or
+     * `nullptr` if the object identifier refers to a sub-object, a pseudo
+     * property, a part of the property or doesn't resolve.
+     */
+    App::Property* getWholeProperty() const;
+
     /**
      * @brief Create a canonical representation of the object identifier.
      *
@@ -1190,6 +1199,16 @@ public:
      */
     void getDepLabels(std::vector<std::string>& labels) const;
 
+    /**
+     * @brief Returns the document label this object identifier refers to.
+     *
+     * Only an explicitly given label, i.e. one that relabeledDocument() would
+     * update, is returned.
+     *
+     * @param[in,out] labels The container in which the label is returned.
+     */
+    void getDocumentLabelReferences(std::vector<std::string>& labels) const;
+
     /**
      * @brief Find a document with the given name.
      *
@@ -68,10 +68,13 @@
 #include <sstream>
 
 // STL
+#include <atomic>
 #include <bitset>
 #include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -82,6 +85,7 @@
 #include <set>
 #include <stack>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -422,3 +422,12 @@ void PropertyListsBase::_setPyObject(PyObject* value)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 TYPESYSTEM_SOURCE_ABSTRACT(App::PropertyLists, App::Property)
+
+std::uint64_t PropertyLists::digest(const void* data, std::size_t size, std::uint64_t hash)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
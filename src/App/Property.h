@@ -28,8 +28,13 @@
 #include <Base/Persistence.h>
 #include <boost/any.hpp>
 #include <boost/signals2.hpp>
+#include <algorithm>
 #include <bitset>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include <FCGlobal.h>
 
 #include "ElementNamingUtils.h"
@@ -874,6 +879,134 @@ public:
     {
         return this->testStatus(Status::Ordered);
     }
+
+    /**
+     * @brief The number of values up to which a list is saved inline.
+     *
+     * Lists of numbers with more values are saved as a binary file of the
+     * archive, which is much faster to restore than one XML element per value.
+     */
+    static constexpr int InlineSizeLimit = 64;
+
+    /**
+     * @brief The elements a trimmed copy shares with the property at both ends.
+     *
+     * @see trimCommonEnds()
+     */
+    struct CommonEnds
+    {
+        /// The number of shared elements at the front.
+        int front {0};
+        /// The number of shared elements at the back.
+        int back {0};
+        /// The size of the property when the copy was trimmed.
+        int size {0};
+        /// A digest of the shared elements of the property.
+        std::uint64_t digest {0};
+    };
+
+    /**
+     * @brief Drop the elements this copy shares with the property at both ends.
+     *
+     * A transaction keeps a copy of each changed property for undo. When only a
+     * few elements of a long list change, most of the copy equals the property
+     * and is dropped here. restoreCommonEnds() takes the dropped elements from
+     * the property again, which by then must have the value it has now.
+     *
+     * @param[in] current The property this is a copy of.
+     * @param[out] ends The elements that have been dropped.
+     *
+     * @return True if elements have been dropped, false if the list type
+     * doesn't support it or too little would be saved.
+     */
+    virtual bool trimCommonEnds(const PropertyLists& current, CommonEnds& ends)
+    {
+        (void)current;
+        (void)ends;
+        return false;
+    }
+
+    /**
+     * @brief Restore the elements dropped by trimCommonEnds().
+     *
+     * @param[in] current The property this is a copy of.
+     * @param[in] ends The elements that have been dropped.
+     *
+     * @return False if the property has been changed since, in which case the
+     * copy is left untouched.
+     */
+    virtual bool restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends)
+    {
+        (void)current;
+        (void)ends;
+        return false;
+    }
+
+protected:
+    /// Implements trimCommonEnds() for lists of plain values, which are compared byte-wise.
+    template<class T>
+    static bool trimVector(std::vector<T>& copy, const std::vector<T>& values, CommonEnds& ends)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        // the copy saves too little otherwise
+        constexpr std::size_t minTrimmedBytes = 65536;
+        const std::size_t limit = std::min(values.size(), copy.size());
+        std::size_t front = 0;
+        while (front < limit && std::memcmp(&values[front], &copy[front], sizeof(T)) == 0) {
+            ++front;
+        }
+        std::size_t back = 0;
+        while (back < limit - front
+               && std::memcmp(&values[values.size() - back - 1],
+                              &copy[copy.size() - back - 1],
+                              sizeof(T))
+                   == 0) {
+            ++back;
+        }
+        if ((front + back) * sizeof(T) < minTrimmedBytes) {
+            return false;
+        }
+
+        ends.front = static_cast<int>(front);
+        ends.back = static_cast<int>(back);
+        ends.size = static_cast<int>(values.size());
+        ends.digest = digestEnds(values, front, back);
+        copy = std::vector<T>(copy.begin() + front, copy.end() - back);
+        return true;
+    }
+
+    /// Implements restoreCommonEnds() for lists of plain values.
+    template<class T>
+    static bool
+    restoreVector(std::vector<T>& copy, const std::vector<T>& values, const CommonEnds& ends)
+    {
+        const auto front = static_cast<std::size_t>(ends.front);
+        const auto back = static_cast<std::size_t>(ends.back);
+        if (values.size() != static_cast<std::size_t>(ends.size)
+            || digestEnds(values, front, back) != ends.digest) {
+            return false;
+        }
+
+        std::vector<T> restored;
+        restored.reserve(front + copy.size() + back);
+        restored.insert(restored.end(), values.begin(), values.begin() + front);
+        restored.insert(restored.end(), copy.begin(), copy.end());
+        restored.insert(restored.end(), values.end() - back, values.end());
+        copy.swap(restored);
+        return true;
+    }
+
+private:
+    /// A 64-bit FNV-1a hash of @p size bytes at @p data, continuing from @p hash.
+    static std::uint64_t digest(const void* data, std::size_t size, std::uint64_t hash);
+
+    template<class T>
+    static std::uint64_t digestEnds(const std::vector<T>& values, std::size_t front, std::size_t back)
+    {
+        constexpr std::uint64_t offsetBasis = 14695981039346656037ULL;
+        std::uint64_t hash = digest(values.data(), front * sizeof(T), offsetBasis);
+        return digest(values.data() + values.size() - back, back * sizeof(T), hash);
+    }
 };
 
 /**
@@ -22,6 +22,13 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#endif
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
@@ -45,6 +52,10 @@ namespace sp = std::placeholders;
 TYPESYSTEM_SOURCE_ABSTRACT(App::PropertyExpressionContainer, App::PropertyXLinkContainer)
 
 static std::set<PropertyExpressionContainer*> _ExprContainers;
+// containers by the labels of the documents their expressions refer to
+static std::unordered_map<std::string, std::set<PropertyExpressionContainer*>> _DocLabelMap;
+// containers that have not registered their document references
+static std::set<PropertyExpressionContainer*> _UnregisteredExprContainers;
 
 PropertyExpressionContainer::PropertyExpressionContainer()
 {
@@ -57,23 +68,84 @@ PropertyExpressionContainer::PropertyExpressionContainer()
             PropertyExpressionContainer::slotRenameDynamicProperty);
     }
     _ExprContainers.insert(this);
+    _UnregisteredExprContainers.insert(this);
 }
 
 PropertyExpressionContainer::~PropertyExpressionContainer()
 {
+    unregisterDocumentLabelReferences();
+    _UnregisteredExprContainers.erase(this);
     _ExprContainers.erase(this);
 }
 
+void PropertyExpressionContainer::unregisterDocumentLabelReferences()
+{
+    for (auto& label : _DocLabelRefs) {
+        auto it = _DocLabelMap.find(label);
+        if (it != _DocLabelMap.end()) {
+            it->second.erase(this);
+            if (it->second.empty()) {
+                _DocLabelMap.erase(it);
+            }
+        }
+    }
+    _DocLabelRefs.clear();
+    _DocLabelRefsRegistered = false;
+    _UnregisteredExprContainers.insert(this);
+}
+
+void PropertyExpressionContainer::registerDocumentLabelReferences(const App::Expression* expr,
+                                                                  bool reset)
+{
+    if (reset) {
+        unregisterDocumentLabelReferences();
+        _DocLabelRefsRegistered = true;
+        _UnregisteredExprContainers.erase(this);
+    }
+    if (!expr || !_DocLabelRefsRegistered) {
+        return;
+    }
+    std::vector<std::string> labels;
+    for (auto& v : expr->getIdentifiers()) {
+        v.first.getDocumentLabelReferences(labels);
+    }
+    for (auto& label : labels) {
+        auto res = _DocLabelRefs.insert(std::move(label));
+        if (res.second) {
+            _DocLabelMap[*res.first].insert(this);
+        }
+    }
+}
+
 void PropertyExpressionContainer::slotRelabelDocument(const App::Document& doc)
 {
     // For use a private _ExprContainers to track all living
     // PropertyExpressionContainer including those inside undo/redo stack,
     // because document relabel is not undoable/redoable.
 
-    if (doc.getOldLabel() != doc.Label.getValue()) {
-        for (auto prop : _ExprContainers) {
-            prop->onRelabeledDocument(doc);
-        }
+    const std::string& oldLabel = doc.getOldLabel();
+    const std::string& newLabel = doc.Label.getStrValue();
+    if (oldLabel == newLabel) {
+        return;
+    }
+
+    std::vector<PropertyExpressionContainer*> props(_UnregisteredExprContainers.begin(),
+                                                    _UnregisteredExprContainers.end());
+    for (auto prop : props) {
+        prop->onRelabeledDocument(doc);
+    }
+
+    auto it = _DocLabelMap.find(oldLabel);
+    if (it == _DocLabelMap.end()) {
+        return;
+    }
+    props.assign(it->second.begin(), it->second.end());
+    _DocLabelMap.erase(it);
+    for (auto prop : props) {
+        prop->onRelabeledDocument(doc);
+        prop->_DocLabelRefs.erase(oldLabel);
+        prop->_DocLabelRefs.insert(newLabel);
+        _DocLabelMap[newLabel].insert(prop);
     }
 }
 
@@ -147,6 +219,7 @@ void PropertyExpressionEngine::hasSetValue()
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
+        unregisterDocumentLabelReferences();
         PropertyExpressionContainer::hasSetValue();
         return;
     }
@@ -154,11 +227,13 @@ void PropertyExpressionEngine::hasSetValue()
     std::map<App::DocumentObject*, bool> deps;
     std::vector<std::string> labels;
     unregisterElementReference();
+    registerDocumentLabelReferences(nullptr, true);
     UpdateElementReferenceExpressionVisitor<PropertyExpressionEngine> v(*this);
     for (auto& e : expressions) {
         auto expr = e.second.expression;
         if (expr) {
             expr->getDepObjects(deps, &labels);
+            registerDocumentLabelReferences(expr.get(), false);
             if (!restoring) {
                 expr->visit(v);
             }
@@ -485,10 +560,12 @@ void PropertyExpressionEngine::onContainerRestored()
 {
     Base::FlagToggler<bool> flag(restoring);
     unregisterElementReference();
+    registerDocumentLabelReferences(nullptr, true);
     UpdateElementReferenceExpressionVisitor<PropertyExpressionEngine> v(*this);
     for (auto& e : expressions) {
         auto expr = e.second.expression;
         if (expr) {
+            registerDocumentLabelReferences(expr.get(), false);
             expr->visit(v);
         }
     }
@@ -644,10 +721,13 @@ void PropertyExpressionEngine::buildGraph(const ExpressionMap& exprs,
  * The code below builds a graph for all expressions in the engine, and
  * finds any circular dependencies. It also computes the internal evaluation
  * order, in case properties depends on each other.
+ *
+ * If \a levels is given, the order is sorted by the topological level which is
+ * stored for every entry. The expressions of one level don't depend on each other.
  */
 
 std::vector<App::ObjectIdentifier>
-PropertyExpressionEngine::computeEvaluationOrder(ExecuteOption option)
+PropertyExpressionEngine::computeEvaluationOrder(ExecuteOption option, std::vector<int>* levels)
 {
     std::vector<App::ObjectIdentifier> evaluationOrder;
     boost::unordered_map<int, ObjectIdentifier> revNodes;
@@ -667,9 +747,80 @@ PropertyExpressionEngine::computeEvaluationOrder(ExecuteOption option)
         }
     }
 
+    if (levels) {
+        // the dependencies come first in c, outside dependencies have no level
+        std::vector<int> nodeLevels(num_vertices(g), -1);
+        std::vector<std::pair<int, ObjectIdentifier>> sorted;
+        for (int i : c) {
+            auto it = revNodes.find(i);
+            if (it == revNodes.end()) {
+                continue;
+            }
+            int level = 0;
+            for (auto edges = out_edges(i, g); edges.first != edges.second; ++edges.first) {
+                level = std::max(level, nodeLevels[target(*edges.first, g)] + 1);
+            }
+            nodeLevels[i] = level;
+            sorted.emplace_back(level, it->second);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        evaluationOrder.clear();
+        levels->clear();
+        for (auto& entry : sorted) {
+            levels->push_back(entry.first);
+            evaluationOrder.push_back(std::move(entry.second));
+        }
+    }
+
     return evaluationOrder;
 }
 
+namespace
+{
+
+// Fewer expressions are not worth starting threads for
+constexpr std::size_t MinConcurrentExpressions = 64;
+
+/* Evaluates the numeric expressions on several threads. Only the numeric evaluation
+ * of the expressions is used because it doesn't need Python, a value is left empty
+ * if the expression has to be evaluated with Python.
+ */
+
+std::vector<App::any> evaluateConcurrently(const std::vector<const Expression*>& exprs)
+{
+    std::vector<App::any> values(exprs.size());
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < exprs.size(); i = next++) {
+            Expression::NumericValue value;
+            try {
+                if (exprs[i] && exprs[i]->getNumericValue(value)) {
+                    values[i] = value.toAny();
+                }
+            }
+            catch (std::exception&) {
+                // evaluated again in the calling thread to report the error
+            }
+        }
+    };
+
+    std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    threads = std::min(threads, exprs.size() / MinConcurrentExpressions + 1);
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < threads; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+    return values;
+}
+
+}  // namespace
+
 /**
  * @brief Compute and update values of all registered expressions.
  * @return StdReturn on success.
@@ -730,16 +881,47 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
+    // The independent expressions of one topological level may be evaluated
+    // concurrently. Expressions that need Python are evaluated serially below.
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelExpressions", false);
+
     // Compute evaluation order
-    std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
+    std::vector<int> levels;
+    std::vector<App::ObjectIdentifier> evaluationOrder =
+        computeEvaluationOrder(option, parallel ? &levels : nullptr);
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
 
+    // Values of the current level that were evaluated concurrently
+    std::vector<App::any> levelValues;
+    std::size_t levelStart = 0;
+    std::size_t levelEnd = 0;
+
 #ifdef FC_PROPERTYEXPRESSIONENGINE_LOG
     std::clog << "Computing expressions for " << getName() << std::endl;
 #endif
 
     /* Evaluate the expressions, and update properties */
     for (; it != evaluationOrder.end(); ++it) {
+        std::size_t index = it - evaluationOrder.begin();
+        if (parallel && index == levelEnd) {
+            levelStart = index;
+            levelEnd = index + 1;
+            while (levelEnd < levels.size() && levels[levelEnd] == levels[index]) {
+                ++levelEnd;
+            }
+            levelValues.clear();
+            if (levelEnd - levelStart >= MinConcurrentExpressions) {
+                std::vector<const Expression*> exprs;
+                for (std::size_t i = levelStart; i < levelEnd; ++i) {
+                    exprs.push_back(expressions[evaluationOrder[i]].expression.get());
+                }
+                FC_LOG("Evaluate " << exprs.size() << " expressions of " << getFullName()
+                                   << " concurrently");
+                levelValues = evaluateConcurrently(exprs);
+            }
+        }
 
         // Get property to update
         Property* prop = it->getProperty();
@@ -761,7 +943,12 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
             // Evaluate expression
             std::shared_ptr<App::Expression> expression = expressions[*it].expression;
             if (expression) {
-                value = expression->getValueAsAny();
+                if (!levelValues.empty() && !levelValues[index - levelStart].empty()) {
+                    value = levelValues[index - levelStart];
+                }
+                else {
+                    value = expression->getValueAsAny();
+                }
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -61,9 +61,23 @@ protected:
     virtual void onRelabeledDocument(const App::Document& doc) = 0;
     virtual void onRenameDynamicProperty(const App::Property& prop, const char* oldName) = 0;
 
+    /** Register the labels of the documents referred to by the given expression
+     *
+     * Document relabel only visits the containers registered with the old
+     * label, plus those that have never registered (e.g. copies kept in the
+     * undo stack). Call it with reset = true (and no expression) to start
+     * over, then once for each expression of the container.
+     */
+    void registerDocumentLabelReferences(const App::Expression* expr, bool reset);
+    /// Mark the container for being visited on any document relabel
+    void unregisterDocumentLabelReferences();
+
 private:
     static void slotRelabelDocument(const App::Document& doc);
     static void slotRenameDynamicProperty(const App::Property& prop, const char* oldName);
+
+    std::set<std::string> _DocLabelRefs;
+    bool _DocLabelRefsRegistered = false;
 };
 
 class AppExport PropertyExpressionEngine
@@ -204,7 +218,8 @@ private:
     using ExpressionMap = std::map<const App::ObjectIdentifier, ExpressionInfo>;
 #endif
 
-    std::vector<App::ObjectIdentifier> computeEvaluationOrder(ExecuteOption option);
+    std::vector<App::ObjectIdentifier> computeEvaluationOrder(ExecuteOption option,
+                                                              std::vector<int>* levels = nullptr);
 
     void buildGraphStructures(const App::ObjectIdentifier& path,
                               const std::shared_ptr<Expression> expression,
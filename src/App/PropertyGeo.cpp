@@ -147,9 +147,9 @@ void PropertyVector::Save(Base::Writer& writer) const
     // clang-format off
     writer.Stream() << writer.ind()
                     << "<PropertyVector"
-                    << " valueX=\"" << _cVec.x << "\""
-                    << " valueY=\"" << _cVec.y << "\""
-                    << " valueZ=\"" << _cVec.z << "\""
+                    << " valueX=\"" << Base::XMLNumber(_cVec.x) << "\""
+                    << " valueY=\"" << Base::XMLNumber(_cVec.y) << "\""
+                    << " valueZ=\"" << Base::XMLNumber(_cVec.z) << "\""
                     << "/>\n";
     // clang-format on
 }
@@ -334,9 +334,9 @@ void PropertyVectorList::SaveDocFile(Base::Writer& writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
-        for (const auto& it : _lValueList) {
-            str << it.x << it.y << it.z;
-        }
+        static_assert(sizeof(Base::Vector3d) == 3 * sizeof(double));
+        str.writeArray(reinterpret_cast<const double*>(_lValueList.data()),  // NOLINT
+                       3 * _lValueList.size());
     }
     else {
         for (const auto& it : _lValueList) {
@@ -355,9 +355,7 @@ void PropertyVectorList::RestoreDocFile(Base::Reader& reader)
     str >> uCt;
     std::vector<Base::Vector3d> values(uCt);
     if (!isSinglePrecision()) {
-        for (auto& it : values) {
-            str >> it.x >> it.y >> it.z;
-        }
+        str.readArray(reinterpret_cast<double*>(values.data()), 3 * values.size());  // NOLINT
     }
     else {
         Base::Vector3f vec;
@@ -386,6 +384,18 @@ unsigned int PropertyVectorList::getMemSize() const
     return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
 }
 
+bool PropertyVectorList::trimCommonEnds(const PropertyLists& current, CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyVectorList*>(&current);
+    return other && trimVector(_lValueList, other->_lValueList, ends);
+}
+
+bool PropertyVectorList::restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyVectorList*>(&current);
+    return other && restoreVector(_lValueList, other->_lValueList, ends);
+}
+
 //**************************************************************************
 //**************************************************************************
 // PropertyMatrix
@@ -838,22 +848,22 @@ void PropertyPlacement::Save(Base::Writer& writer) const
 {
     // clang-format off
     writer.Stream() << writer.ind() << "<PropertyPlacement";
-    writer.Stream() << " Px=\"" << _cPos.getPosition().x << "\""
-                    << " Py=\"" << _cPos.getPosition().y << "\""
-                    << " Pz=\"" << _cPos.getPosition().z << "\"";
-
-    writer.Stream() << " Q0=\"" << _cPos.getRotation()[0] << "\""
-                    << " Q1=\"" << _cPos.getRotation()[1] << "\""
-                    << " Q2=\"" << _cPos.getRotation()[2] << "\""
-                    << " Q3=\"" << _cPos.getRotation()[3] << "\"";
+    writer.Stream() << " Px=\"" << Base::XMLNumber(_cPos.getPosition().x) << "\""
+                    << " Py=\"" << Base::XMLNumber(_cPos.getPosition().y) << "\""
+                    << " Pz=\"" << Base::XMLNumber(_cPos.getPosition().z) << "\"";
+
+    writer.Stream() << " Q0=\"" << Base::XMLNumber(_cPos.getRotation()[0]) << "\""
+                    << " Q1=\"" << Base::XMLNumber(_cPos.getRotation()[1]) << "\""
+                    << " Q2=\"" << Base::XMLNumber(_cPos.getRotation()[2]) << "\""
+                    << " Q3=\"" << Base::XMLNumber(_cPos.getRotation()[3]) << "\"";
     Vector3d axis;
     double rfAngle {};
     _cPos.getRotation().getRawValue(axis, rfAngle);
-    writer.Stream() << " A=\"" << rfAngle << "\""
-                    << " Ox=\"" << axis.x << "\""
-                    << " Oy=\"" << axis.y << "\""
-                    << " Oz=\"" << axis.z << "\"";
-    writer.Stream() << "/>" << std::endl;
+    writer.Stream() << " A=\"" << Base::XMLNumber(rfAngle) << "\""
+                    << " Ox=\"" << Base::XMLNumber(axis.x) << "\""
+                    << " Oy=\"" << Base::XMLNumber(axis.y) << "\""
+                    << " Oz=\"" << Base::XMLNumber(axis.z) << "\"";
+    writer.Stream() << "/>\n";
     // clang-format on
 }
 
@@ -240,6 +240,8 @@ public:
     void Paste(const Property& from) override;
 
     unsigned int getMemSize() const override;
+    bool trimCommonEnds(const PropertyLists& current, CommonEnds& ends) override;
+    bool restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends) override;
     const char* getEditorName() const override
     {
         return "Gui::PropertyEditor::PropertyVectorListItem";
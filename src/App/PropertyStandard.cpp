@@ -115,7 +115,7 @@ void PropertyInteger::setPyObject(PyObject* value)
 
 void PropertyInteger::Save(Base::Writer& writer) const
 {
-    writer.Stream() << writer.ind() << "<Integer value=\"" << _lValue << "\"/>" << std::endl;
+    writer.Stream() << writer.ind() << "<Integer value=\"" << Base::XMLNumber(_lValue) << "\"/>\n";
 }
 
 void PropertyInteger::Restore(Base::XMLReader& reader)
@@ -830,6 +830,19 @@ long PropertyIntegerList::getPyValue(PyObject* item) const
 
 void PropertyIntegerList::Save(Base::Writer& writer) const
 {
+    // the binary file holds 32 bit values
+    auto fitsFile = [this]() {
+        return std::ranges::all_of(_lValueList, [](long value) {
+            return value >= std::numeric_limits<int32_t>::min()
+                && value <= std::numeric_limits<int32_t>::max();
+        });
+    };
+    if (!writer.isForceXML() && getSize() > InlineSizeLimit && fitsFile()) {
+        writer.Stream() << writer.ind() << "<IntegerList file=\"" << writer.addFile(getName(), this)
+                        << "\"/>" << std::endl;
+        return;
+    }
+
     writer.Stream() << writer.ind() << "<IntegerList count=\"" << getSize() << "\">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
@@ -843,6 +856,15 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
 {
     // read my Element
     reader.readElement("IntegerList");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute<const char*>("file"));
+        if (!file.empty()) {
+            // initiate a file read
+            reader.addFile(file.c_str(), this);
+        }
+        return;
+    }
+
     // get the value of my Attribute
     int count = reader.getAttribute<long>("count");
 
@@ -858,6 +880,25 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
     setValues(values);
 }
 
+void PropertyIntegerList::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    uint32_t uCt = (uint32_t)getSize();
+    str << uCt;
+    std::vector<int32_t> values(_lValueList.begin(), _lValueList.end());
+    str.writeArray(values.data(), values.size());
+}
+
+void PropertyIntegerList::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t uCt = 0;
+    str >> uCt;
+    std::vector<int32_t> values(uCt);
+    str.readArray(values.data(), values.size());
+    setValues(std::vector<long>(values.begin(), values.end()));
+}
+
 Property* PropertyIntegerList::Copy() const
 {
     PropertyIntegerList* p = new PropertyIntegerList();
@@ -1058,7 +1099,7 @@ void PropertyFloat::setPyObject(PyObject* value)
 
 void PropertyFloat::Save(Base::Writer& writer) const
 {
-    writer.Stream() << writer.ind() << "<Float value=\"" << _dValue << "\"/>" << std::endl;
+    writer.Stream() << writer.ind() << "<Float value=\"" << Base::XMLNumber(_dValue) << "\"/>\n";
 }
 
 void PropertyFloat::Restore(Base::XMLReader& reader)
@@ -1355,6 +1396,19 @@ void PropertyFloatList::Save(Base::Writer& writer) const
 void PropertyFloatList::Restore(Base::XMLReader& reader)
 {
     reader.readElement("FloatList");
+    if (reader.hasAttribute("count")) {
+        // saved inline with forced XML
+        int count = reader.getAttribute<long>("count");
+        std::vector<double> values(count);
+        for (double& it : values) {
+            reader.readElement("F");
+            it = reader.getAttribute<double>("v");
+        }
+        reader.readEndElement("FloatList");
+        setValues(values);
+        return;
+    }
+
     string file(reader.getAttribute<const char*>("file"));
 
     if (!file.empty()) {
@@ -1369,9 +1423,7 @@ void PropertyFloatList::SaveDocFile(Base::Writer& writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
-        for (double it : _lValueList) {
-            str << it;
-        }
+        str.writeArray(_lValueList.data(), _lValueList.size());
     }
     else {
         for (double it : _lValueList) {
@@ -1388,9 +1440,7 @@ void PropertyFloatList::RestoreDocFile(Base::Reader& reader)
     str >> uCt;
     std::vector<double> values(uCt);
     if (!isSinglePrecision()) {
-        for (double& it : values) {
-            str >> it;
-        }
+        str.readArray(values.data(), values.size());
     }
     else {
         for (double& it : values) {
@@ -1419,6 +1469,18 @@ unsigned int PropertyFloatList::getMemSize() const
     return static_cast<unsigned int>(_lValueList.size() * sizeof(double));
 }
 
+bool PropertyFloatList::trimCommonEnds(const PropertyLists& current, CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyFloatList*>(&current);
+    return other && trimVector(_lValueList, other->_lValueList, ends);
+}
+
+bool PropertyFloatList::restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyFloatList*>(&current);
+    return other && restoreVector(_lValueList, other->_lValueList, ends);
+}
+
 //**************************************************************************
 //**************************************************************************
 // PropertyString
@@ -1526,7 +1588,7 @@ void PropertyString::Save(Base::Writer& writer) const
     if (!exported) {
         val = encodeAttribute(_cValue);
     }
-    writer.Stream() << "value=\"" << val << "\"/>" << std::endl;
+    writer.Stream() << "value=\"" << val << "\"/>\n";
 }
 
 void PropertyString::Restore(Base::XMLReader& reader)
@@ -2056,7 +2118,7 @@ void PropertyBool::Save(Base::Writer& writer) const
     else {
         writer.Stream() << "false" << "\"/>";
     }
-    writer.Stream() << std::endl;
+    writer.Stream() << '\n';
 }
 
 void PropertyBool::Restore(Base::XMLReader& reader)
@@ -2486,6 +2548,18 @@ unsigned int PropertyColorList::getMemSize() const
     return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Color));
 }
 
+bool PropertyColorList::trimCommonEnds(const PropertyLists& current, CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyColorList*>(&current);
+    return other && trimVector(_lValueList, other->_lValueList, ends);
+}
+
+bool PropertyColorList::restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends)
+{
+    auto other = freecad_cast<const PropertyColorList*>(&current);
+    return other && restoreVector(_lValueList, other->_lValueList, ends);
+}
+
 //**************************************************************************
 //**************************************************************************
 // PropertyMaterial
@@ -2788,6 +2862,20 @@ void PropertyMaterialList::setMinimumSizeOne()
     }
 }
 
+void PropertyMaterialList::verifyRange(int start, std::size_t count) const
+{
+    if (start < 0 || start + count > static_cast<std::size_t>(getSize())) {
+        throw Base::RuntimeError("index out of bound");
+    }
+}
+
+void PropertyMaterialList::hasSetValue()
+{
+    PropertyListsT<Material>::hasSetValue();
+    // the touched elements only describe the change that has just been reported
+    _touchList.clear();
+}
+
 int PropertyMaterialList::resizeByOneIfNeeded(int index)
 {
     int size = getSize();
@@ -2821,6 +2909,7 @@ void PropertyMaterialList::setValue(int index, const Material& mat)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index] = mat;
     hasSetValue();
 }
@@ -2861,6 +2950,7 @@ void PropertyMaterialList::setAmbientColor(int index, const Base::Color& col)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].ambientColor = col;
     hasSetValue();
 }
@@ -2871,6 +2961,7 @@ void PropertyMaterialList::setAmbientColor(int index, float r, float g, float b,
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].ambientColor.set(r, g, b, a);
     hasSetValue();
 }
@@ -2881,6 +2972,7 @@ void PropertyMaterialList::setAmbientColor(int index, uint32_t rgba)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].ambientColor.setPackedValue(rgba);
     hasSetValue();
 }
@@ -2921,6 +3013,7 @@ void PropertyMaterialList::setDiffuseColor(int index, const Base::Color& col)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].diffuseColor = col;
     hasSetValue();
 }
@@ -2931,6 +3024,7 @@ void PropertyMaterialList::setDiffuseColor(int index, float r, float g, float b,
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].diffuseColor.set(r, g, b, a);
     hasSetValue();
 }
@@ -2941,6 +3035,7 @@ void PropertyMaterialList::setDiffuseColor(int index, uint32_t rgba)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].diffuseColor.setPackedValue(rgba);
     hasSetValue();
 }
@@ -2992,6 +3087,7 @@ void PropertyMaterialList::setSpecularColor(int index, const Base::Color& col)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].specularColor = col;
     hasSetValue();
 }
@@ -3002,6 +3098,7 @@ void PropertyMaterialList::setSpecularColor(int index, float r, float g, float b
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].specularColor.set(r, g, b, a);
     hasSetValue();
 }
@@ -3012,6 +3109,7 @@ void PropertyMaterialList::setSpecularColor(int index, uint32_t rgba)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].specularColor.setPackedValue(rgba);
     hasSetValue();
 }
@@ -3052,6 +3150,7 @@ void PropertyMaterialList::setEmissiveColor(int index, const Base::Color& col)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].emissiveColor = col;
     hasSetValue();
 }
@@ -3062,6 +3161,7 @@ void PropertyMaterialList::setEmissiveColor(int index, float r, float g, float b
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].emissiveColor.set(r, g, b, a);
     hasSetValue();
 }
@@ -3072,6 +3172,7 @@ void PropertyMaterialList::setEmissiveColor(int index, uint32_t rgba)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].emissiveColor.setPackedValue(rgba);
     hasSetValue();
 }
@@ -3092,6 +3193,7 @@ void PropertyMaterialList::setShininess(int index, float val)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].shininess = val;
     hasSetValue();
 }
@@ -3112,6 +3214,7 @@ void PropertyMaterialList::setTransparency(int index, float val)
 
     aboutToSetValue();
     index = resizeByOneIfNeeded(index);
+    _touchList.insert(index);
     _lValueList[index].transparency = val;
     hasSetValue();
 }
@@ -3127,6 +3230,30 @@ void PropertyMaterialList::setTransparencies(const std::vector<float>& transpare
     hasSetValue();
 }
 
+void PropertyMaterialList::setValues(int start, const std::vector<App::Material>& materials)
+{
+    verifyRange(start, materials.size());
+
+    aboutToSetValue();
+    for (std::size_t i = 0; i < materials.size(); i++) {
+        _lValueList[start + i] = materials[i];
+        _touchList.insert(start + static_cast<int>(i));
+    }
+    hasSetValue();
+}
+
+void PropertyMaterialList::setDiffuseColors(int start, const std::vector<Base::Color>& colors)
+{
+    verifyRange(start, colors.size());
+
+    aboutToSetValue();
+    for (std::size_t i = 0; i < colors.size(); i++) {
+        _lValueList[start + i].diffuseColor = colors[i];
+        _touchList.insert(start + static_cast<int>(i));
+    }
+    hasSetValue();
+}
+
 const Base::Color& PropertyMaterialList::getAmbientColor() const
 {
     return _lValueList[0].ambientColor;
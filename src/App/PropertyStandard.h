@@ -390,6 +390,9 @@ public:
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
     Property* Copy() const override;
     void Paste(const Property& from) override;
     unsigned int getMemSize() const override;
@@ -729,6 +732,8 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
     unsigned int getMemSize() const override;
+    bool trimCommonEnds(const PropertyLists& current, CommonEnds& ends) override;
+    bool restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends) override;
 
 protected:
     double getPyValue(PyObject* item) const override;
@@ -1089,6 +1094,8 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
     unsigned int getMemSize() const override;
+    bool trimCommonEnds(const PropertyLists& current, CommonEnds& ends) override;
+    bool restoreCommonEnds(const PropertyLists& current, const CommonEnds& ends) override;
 
 protected:
     Base::Color getPyValue(PyObject* py) const override;
@@ -1240,6 +1247,16 @@ public:
     void setTransparency(int index, float);
     void setTransparencies(const std::vector<float>& transparencies);
 
+    /** Set the materials of the elements from \a start on
+     *
+     * Unlike the other setters, that report the whole list as changed, the
+     * changed elements are listed in getTouchList() while observers are
+     * notified. So only the faces of a shape that got a new colour need to be
+     * updated.
+     */
+    void setValues(int start, const std::vector<App::Material>& materials);
+    void setDiffuseColors(int start, const std::vector<Base::Color>& colors);
+
     const Base::Color& getAmbientColor() const;
     const Base::Color& getAmbientColor(int index) const;
 
@@ -1276,6 +1293,7 @@ public:
 
 protected:
     Material getPyValue(PyObject* py) const override;
+    void hasSetValue() override;
 
 private:
     enum Format
@@ -1295,6 +1313,7 @@ private:
     void verifyIndex(int index) const;
     void setMinimumSizeOne();
     int resizeByOneIfNeeded(int index);
+    void verifyRange(int start, std::size_t count) const;
 
     Format formatVersion {Version_0};
 };
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#endif
+
+#include "RecomputeProfile.h"
+#include "DocumentObject.h"
+
+using namespace App;
+
+namespace
+{
+
+std::string jsonString(const std::string& text)
+{
+    std::ostringstream str;
+    str << '"';
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"':
+                str << "\\\"";
+                break;
+            case '\\':
+                str << "\\\\";
+                break;
+            case '\n':
+                str << "\\n";
+                break;
+            case '\r':
+                str << "\\r";
+                break;
+            case '\t':
+                str << "\\t";
+                break;
+            default:
+                if (c < 0x20) {
+                    str << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec;
+                }
+                else {
+                    str << c;
+                }
+                break;
+        }
+    }
+    str << '"';
+    return str.str();
+}
+
+std::string displayName(const RecomputeProfile::Entry& entry)
+{
+    if (entry.label.empty() || entry.label == entry.name) {
+        return entry.name;
+    }
+    return entry.label + " (" + entry.name + ")";
+}
+
+std::string threadName(int thread)
+{
+    return thread == 0 ? std::string("Recompute") : "Worker " + std::to_string(thread);
+}
+
+}  // namespace
+
+RecomputeProfile::Recorder::Recorder(RecomputeProfile& profile, DocumentObject* obj)
+    : profile(profile)
+    , object(obj)
+    , active(profile.isRecording())
+{
+    if (!active) {
+        return;
+    }
+
+    std::vector<Property*> props;
+    object->getPropertyList(props);
+    for (auto prop : props) {
+        if (prop->isTouched()) {
+            const char* name = prop->getName();
+            touched.emplace_back(name ? name : "");
+        }
+    }
+    start = executeStart = executeEnd = Clock::now();
+}
+
+RecomputeProfile::Recorder::~Recorder()
+{
+    if (!active) {
+        return;
+    }
+
+    auto end = Clock::now();
+    if (executing) {
+        // execute() has thrown
+        executeEnd = end;
+    }
+    Entry entry;
+    const char* name = object->getNameInDocument();
+    entry.name = name ? name : "";
+    entry.label = object->Label.getValue();
+    entry.type = object->getTypeId().getName();
+    entry.touched = std::move(touched);
+    entry.start = profile.elapsed(start);
+    entry.duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    entry.executeStart = profile.elapsed(executeStart);
+    entry.executeDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(executeEnd - executeStart).count();
+    entry.failed = object->isError();
+    profile.addEntry(std::move(entry), std::this_thread::get_id());
+}
+
+void RecomputeProfile::Recorder::beginExecute()
+{
+    if (active) {
+        executeStart = executeEnd = Clock::now();
+        executing = true;
+    }
+}
+
+void RecomputeProfile::Recorder::endExecute()
+{
+    if (active) {
+        executeEnd = Clock::now();
+        executing = false;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+RecomputeProfile::Session::Session(RecomputeProfile& profile, const std::string& name)
+    : profile(profile)
+{
+    profile.start(name);
+}
+
+RecomputeProfile::Session::~Session()
+{
+    profile.stop();
+}
+
+void RecomputeProfile::Session::stop()
+{
+    profile.stop();
+}
+
+// ----------------------------------------------------------------------------
+
+void RecomputeProfile::start(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    profileName = name;
+    entries.clear();
+    threads.clear();
+    // the recomputing thread always gets the first index
+    threads.push_back(std::this_thread::get_id());
+    duration = 0;
+    startTime = Clock::now();
+    recording = true;
+}
+
+void RecomputeProfile::stop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (recording) {
+        recording = false;
+        duration = elapsed(Clock::now());
+    }
+}
+
+bool RecomputeProfile::isRecording() const
+{
+    return recording;
+}
+
+std::vector<RecomputeProfile::Entry> RecomputeProfile::getEntries() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries;
+}
+
+std::string RecomputeProfile::getName() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return profileName;
+}
+
+std::int64_t RecomputeProfile::getDuration() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return recording ? elapsed(Clock::now()) : duration;
+}
+
+void RecomputeProfile::addEntry(Entry&& entry, std::thread::id thread)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find(threads.begin(), threads.end(), thread);
+    entry.thread = static_cast<int>(it - threads.begin());
+    if (it == threads.end()) {
+        threads.push_back(thread);
+    }
+    entries.push_back(std::move(entry));
+}
+
+std::int64_t RecomputeProfile::elapsed(Clock::time_point time) const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - startTime).count();
+}
+
+void RecomputeProfile::exportProfile(std::ostream& str, Format format) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    switch (format) {
+        case Format::ChromeTrace:
+            exportChromeTrace(str);
+            break;
+        case Format::Speedscope:
+            exportSpeedscope(str);
+            break;
+    }
+}
+
+void RecomputeProfile::exportChromeTrace(std::ostream& str) const
+{
+    // Trace event format, using complete ('X') events and metadata ('M') events for the names
+    str << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"document\":" << jsonString(profileName)
+        << "},\"traceEvents\":[";
+    str << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":"
+        << jsonString("Recompute " + profileName) << "}}";
+    for (int i = 0; i < static_cast<int>(threads.size()); ++i) {
+        str << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+            << ",\"args\":{\"name\":\"" << threadName(i) << "\"}}";
+    }
+
+    for (const auto& entry : entries) {
+        str << ",\n{\"name\":" << jsonString(displayName(entry))
+            << ",\"cat\":\"recompute\",\"ph\":\"X\",\"pid\":1,\"tid\":" << entry.thread
+            << ",\"ts\":" << entry.start << ",\"dur\":" << entry.duration
+            << ",\"args\":{\"type\":" << jsonString(entry.type) << ",\"touched\":[";
+        for (std::size_t i = 0; i < entry.touched.size(); ++i) {
+            str << (i ? "," : "") << jsonString(entry.touched[i]);
+        }
+        str << "],\"failed\":" << (entry.failed ? "true" : "false") << "}}";
+        if (entry.executeDuration > 0) {
+            str << ",\n{\"name\":\"execute\",\"cat\":\"recompute\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                << entry.thread << ",\"ts\":" << entry.executeStart
+                << ",\"dur\":" << entry.executeDuration << "}";
+        }
+    }
+    str << "]}\n";
+}
+
+void RecomputeProfile::exportSpeedscope(std::ostream& str) const
+{
+    // https://www.speedscope.app/file-format-schema.json
+    // Frame 0 is the execute() call shared by all objects, then one frame per entry.
+    str << "{\"$schema\":\"https://www.speedscope.app/file-format-schema.json\""
+        << ",\"name\":" << jsonString(profileName) << ",\"exporter\":\"FreeCAD\""
+        << ",\"shared\":{\"frames\":[{\"name\":\"execute\"}";
+    for (const auto& entry : entries) {
+        str << ",{\"name\":" << jsonString(displayName(entry)) << "}";
+    }
+    str << "]},\"profiles\":[";
+
+    std::int64_t end = duration;
+    for (const auto& entry : entries) {
+        end = std::max(end, entry.start + entry.duration);
+    }
+
+    bool first = true;
+    for (int thread = 0; thread < static_cast<int>(threads.size()); ++thread) {
+        // the objects executed by one thread don't overlap and are in order
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].thread == thread) {
+                indices.push_back(i);
+            }
+        }
+        std::stable_sort(indices.begin(), indices.end(), [this](std::size_t a, std::size_t b) {
+            return entries[a].start < entries[b].start;
+        });
+
+        str << (first ? "" : ",") << "\n{\"type\":\"evented\",\"name\":\"" << threadName(thread)
+            << "\",\"unit\":\"microseconds\",\"startValue\":0,\"endValue\":" << end
+            << ",\"events\":[";
+        first = false;
+
+        bool firstEvent = true;
+        auto event = [&](char type, std::size_t frame, std::int64_t at) {
+            str << (firstEvent ? "" : ",") << "{\"type\":\"" << type << "\",\"frame\":" << frame
+                << ",\"at\":" << at << "}";
+            firstEvent = false;
+        };
+        for (auto i : indices) {
+            const auto& entry = entries[i];
+            event('O', i + 1, entry.start);
+            if (entry.executeDuration > 0) {
+                event('O', 0, entry.executeStart);
+                event('C', 0, entry.executeStart + entry.executeDuration);
+            }
+            event('C', i + 1, entry.start + entry.duration);
+        }
+        str << "]}";
+    }
+    str << "]}\n";
+}
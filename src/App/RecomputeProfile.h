@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef APP_RECOMPUTEPROFILE_H
+#define APP_RECOMPUTEPROFILE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/** Timings of the objects executed by the last recompute of a document
+ *
+ * While a recompute is running Document::_recomputeFeature() adds an entry
+ * for every object it executes. The entries can be exported in the Chrome
+ * trace event format, which is understood by chrome://tracing and Perfetto,
+ * or in the speedscope format to get a flame graph of the recompute.
+ */
+class AppExport RecomputeProfile
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        /// Internal name of the executed object
+        std::string name;
+        std::string label;
+        std::string type;
+        /// Names of the touched properties, i.e. the cause of the recompute
+        std::vector<std::string> touched;
+        /// Index of the thread the object was executed on, 0 is the recomputing thread
+        int thread = 0;
+        /// Times in microseconds, relative to the start of the recompute
+        std::int64_t start = 0;
+        std::int64_t duration = 0;
+        /// Time spent in DocumentObject::recompute(), without the expressions
+        std::int64_t executeStart = 0;
+        std::int64_t executeDuration = 0;
+        bool failed = false;
+    };
+
+    enum class Format
+    {
+        ChromeTrace,
+        Speedscope
+    };
+
+    /** Measures the execution of a single object
+     * Does nothing if the profile is not recording.
+     */
+    class AppExport Recorder
+    {
+    public:
+        Recorder(RecomputeProfile& profile, DocumentObject* obj);
+        ~Recorder();
+
+        void beginExecute();
+        void endExecute();
+
+        Recorder(const Recorder&) = delete;
+        Recorder(Recorder&&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+        Recorder& operator=(Recorder&&) = delete;
+
+    private:
+        RecomputeProfile& profile;
+        DocumentObject* object;
+        bool active;
+        bool executing = false;
+        Clock::time_point start;
+        Clock::time_point executeStart;
+        Clock::time_point executeEnd;
+        std::vector<std::string> touched;
+    };
+
+    /** Records a whole recompute
+     * Stops the recording when it goes out of scope, so that the profile
+     * doesn't keep recording if the recompute throws.
+     */
+    class AppExport Session
+    {
+    public:
+        Session(RecomputeProfile& profile, const std::string& name);
+        ~Session();
+
+        /// Stop the recording before the end of the scope
+        void stop();
+
+        Session(const Session&) = delete;
+        Session(Session&&) = delete;
+        Session& operator=(const Session&) = delete;
+        Session& operator=(Session&&) = delete;
+
+    private:
+        RecomputeProfile& profile;
+    };
+
+    /// Clear the entries and record the objects executed from now on
+    void start(const std::string& name);
+    /// Stop recording
+    void stop();
+    bool isRecording() const;
+
+    std::vector<Entry> getEntries() const;
+    /// The name of the profiled document
+    std::string getName() const;
+    /// Duration of the whole recompute in microseconds
+    std::int64_t getDuration() const;
+
+    void exportProfile(std::ostream& str, Format format) const;
+
+private:
+    void addEntry(Entry&& entry, std::thread::id thread);
+    std::int64_t elapsed(Clock::time_point time) const;
+    void exportChromeTrace(std::ostream& str) const;
+    void exportSpeedscope(std::ostream& str) const;
+
+private:
+    mutable std::mutex mutex;
+    std::atomic<bool> recording {false};
+    std::string profileName;
+    Clock::time_point startTime;
+    std::int64_t duration = 0;
+    std::vector<Entry> entries;
+    std::vector<std::thread::id> threads;
+};
+
+}  // namespace App
+
+#endif  // APP_RECOMPUTEPROFILE_H
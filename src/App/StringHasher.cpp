@@ -24,7 +24,11 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <array>
+#include <atomic>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -78,11 +82,131 @@ using HashMapBase =
     boost::bimap<boost::bimaps::unordered_set_of<StringID*, StringIDHasher, StringIDHasher>,
                  boost::bimaps::set_of<long>>;
 
+/// Content index used by the thread-safe mode of StringHasher.
+///
+/// The lookup is split into shards of open addressing tables with atomic slots, so readers
+/// probe without any locking. Entries are only added while the index is in use, the caller
+/// serializes the insertions. A table that has to grow is replaced by a larger copy, the old
+/// one is kept alive until the index is cleared because readers may still be probing it.
+class ConcurrentIndex
+{
+public:
+    StringID* find(const StringID* key) const
+    {
+        std::size_t hash = StringIDHasher()(key);
+        const Table* table = shards[hash % NumShards].table.load(std::memory_order_acquire);
+        if (!table) {
+            return nullptr;
+        }
+        std::size_t mask = table->slots.size() - 1;
+        for (std::size_t i = (hash / NumShards) & mask;; i = (i + 1) & mask) {
+            StringID* sid = table->slots[i].load(std::memory_order_acquire);
+            if (!sid || StringIDHasher()(sid, key)) {
+                return sid;
+            }
+        }
+    }
+
+    void insert(StringID* sid)
+    {
+        std::size_t hash = StringIDHasher()(sid);
+        Shard& shard = shards[hash % NumShards];
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        // keep the load factor below one half so that the probing stays short
+        if (!table || 2 * (shard.count + 1) > table->slots.size()) {
+            table = grow(shard);
+        }
+        store(*table, sid, hash);
+        ++shard.count;
+    }
+
+    void clear()
+    {
+        for (auto& shard : shards) {
+            shard.table.store(nullptr, std::memory_order_release);
+            shard.tables.clear();
+            shard.count = 0;
+        }
+    }
+
+private:
+    static constexpr std::size_t NumShards = 16;
+    static constexpr std::size_t MinTableSize = 64;
+
+    struct Table
+    {
+        explicit Table(std::size_t size)
+            : slots(size)
+        {}
+        std::vector<std::atomic<StringID*>> slots;
+    };
+
+    struct Shard
+    {
+        std::atomic<Table*> table {nullptr};
+        std::size_t count = 0;
+        // the current table and the outgrown ones
+        std::vector<std::unique_ptr<Table>> tables;
+    };
+
+    static void store(Table& table, StringID* sid, std::size_t hash)
+    {
+        std::size_t mask = table.slots.size() - 1;
+        std::size_t i = (hash / NumShards) & mask;
+        while (table.slots[i].load(std::memory_order_relaxed)) {
+            i = (i + 1) & mask;
+        }
+        table.slots[i].store(sid, std::memory_order_release);
+    }
+
+    static Table* grow(Shard& shard)
+    {
+        Table* old = shard.table.load(std::memory_order_relaxed);
+        auto table = std::make_unique<Table>(old ? 2 * old->slots.size() : MinTableSize);
+        if (old) {
+            for (const auto& slot : old->slots) {
+                if (StringID* sid = slot.load(std::memory_order_relaxed)) {
+                    store(*table, sid, StringIDHasher()(sid));
+                }
+            }
+        }
+        shard.table.store(table.get(), std::memory_order_release);
+        shard.tables.push_back(std::move(table));
+        return shard.tables.back().get();
+    }
+
+    std::array<Shard, NumShards> shards;
+};
+
 class StringHasher::HashMap: public HashMapBase
 {
 public:
     bool SaveAll = false;
     int Threshold = 0;
+
+    /// Lookup by content if the hasher is used from several threads
+    std::unique_ptr<ConcurrentIndex> Index;
+    /// Guards the bimap in the thread-safe mode
+    std::shared_mutex Mutex;
+
+    StringID* find(const StringID* key) const
+    {
+        if (Index) {
+            return Index->find(key);
+        }
+        auto it = left.find(const_cast<StringID*>(key));  // NOLINT
+        return it != left.end() ? it->first : nullptr;
+    }
+
+    void rebuildIndex()
+    {
+        if (Index) {
+            Index->clear();
+            for (auto& hasher : right) {
+                Index->insert(hasher.second);
+            }
+        }
+    }
 };
 
 ///////////////////////////////////////////////////////////
@@ -225,6 +349,7 @@ void StringHasher::compact()
             }
         }
     }
+    _hashes->rebuildIndex();
 }
 
 bool StringHasher::getSaveAll() const
@@ -278,9 +403,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    if (StringID* existing = _hashes->find(&dataID)) {
+        return {existing};
     }
 
     if (!hashed && !nocopy) {
@@ -295,8 +419,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    StringIDRef sid(new StringID(0, dataID._data, flags));
+    return {insertNew(sid)};
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -322,9 +446,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
+    if (StringID* existing = _hashes->find(&tempID)) {
+        auto res = StringIDRef(existing);
         if (indexed) {
             res._index = indexed.getIndex();
         }
@@ -350,7 +473,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -430,7 +553,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
-    return {insert(newStringIDRef), indexed.getIndex()};
+    return {insertNew(newStringIDRef), indexed.getIndex()};
 }
 
 StringIDRef StringHasher::getID(long id, int index) const
@@ -438,6 +561,10 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock<std::shared_mutex> lock;
+    if (_hashes->Index) {
+        lock = std::shared_lock<std::shared_mutex>(_hashes->Mutex);
+    }
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -725,6 +852,7 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 
         last = insert(sid);
     }
+    _hashes->rebuildIndex();
 }
 
 StringID* StringHasher::insert(const StringIDRef& sid)
@@ -742,6 +870,43 @@ StringID* StringHasher::insert(const StringIDRef& sid)
     return res->second;
 }
 
+StringID* StringHasher::insertNew(const StringIDRef& sid)
+{
+    if (!_hashes->Index) {
+        sid._sid->_id = lastID() + 1;
+        return insert(sid);
+    }
+
+    // Another thread may have added the same string in the meantime, then the bimap refuses
+    // the new entry and insert() returns the existing one.
+    std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+    sid._sid->_id = lastID() + 1;
+    StringID* res = insert(sid);
+    if (res == sid._sid) {
+        _hashes->Index->insert(res);
+    }
+    return res;
+}
+
+void StringHasher::setThreadSafe(bool enable)
+{
+    if (enable == isThreadSafe()) {
+        return;
+    }
+    if (enable) {
+        _hashes->Index = std::make_unique<ConcurrentIndex>();
+        _hashes->rebuildIndex();
+    }
+    else {
+        _hashes->Index.reset();
+    }
+}
+
+bool StringHasher::isThreadSafe() const
+{
+    return _hashes->Index != nullptr;
+}
+
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
     _hashes->clear();
@@ -759,6 +924,7 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
         }
         insert(sid);
     }
+    _hashes->rebuildIndex();
 }
 
 void StringHasher::clear()
@@ -768,6 +934,7 @@ void StringHasher::clear()
         hasher.second->unref();
     }
     _hashes->clear();
+    _hashes->rebuildIndex();
 }
 
 size_t StringHasher::size() const
@@ -838,6 +1005,7 @@ void StringHasher::Restore(Base::XMLReader& reader)
             }
             insert(sid);
         }
+        _hashes->rebuildIndex();
     }
     reader.readEndElement("StringHasher");
 }
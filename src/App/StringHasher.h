@@ -767,11 +767,23 @@ public:
     /// Compact string storage by eliminating unused strings from the table.
     void compact();
 
+    /** Enable/disable the thread-safe mode
+     *
+     * In this mode getID() may be called from several threads at the same time. Strings that
+     * are already in the table are found without locking, adding a new string is serialized.
+     * All other functions, such as compact(), clear(), Save() and Restore(), must not run
+     * concurrently with anything else. The mode has no influence on the persistence format.
+     */
+    void setThreadSafe(bool enable);
+    bool isThreadSafe() const;
+
     class HashMap;
     friend class StringID;
 
 protected:
     StringID* insert(const StringIDRef& sid);
+    /// Assigns the next free ID to a new StringID and inserts it
+    StringID* insertNew(const StringIDRef& sid);
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
@@ -25,7 +25,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #endif
 
 #include <atomic>
@@ -116,7 +118,15 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    if (memSize == 0) {
+        std::size_t size = sizeof(*this) + Name.size();
+        for (const auto& It : _Objects.get<0>()) {
+            size += sizeof(It) + It.second->getMemSize();
+        }
+        memSize = static_cast<unsigned int>(
+            std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
+    }
+    return memSize;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -165,6 +175,7 @@ void Transaction::addOrRemoveProperty(TransactionalObject* Obj, const Property*
     }
 
     To->addOrRemoveProperty(pcProp, add);
+    memSize = 0;
 }
 
 //**************************************************************************
@@ -203,6 +214,7 @@ void Transaction::apply(Document& Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject* Obj)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -232,6 +244,7 @@ void Transaction::addObjectNew(TransactionalObject* Obj)
 
 void Transaction::addObjectDel(const TransactionalObject* Obj)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -251,7 +264,9 @@ void Transaction::addObjectDel(const TransactionalObject* Obj)
     }
 }
 
-void Transaction::addObjectChange(const TransactionalObject* Obj, const Property* Prop)
+void Transaction::addObjectChange(const TransactionalObject* Obj,
+                                  const Property* Prop,
+                                  std::unique_ptr<Property> copy)
 {
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
@@ -267,7 +282,16 @@ void Transaction::addObjectChange(const TransactionalObject* Obj, const Property
         index.emplace(Obj, To);
     }
 
-    To->setProperty(Prop);
+    To->setProperty(Prop, std::move(copy));
+    memSize = 0;
+}
+
+void Transaction::compact()
+{
+    for (const auto& It : _Objects.get<0>()) {
+        It.second->compact(It.first);
+    }
+    memSize = 0;
 }
 
 
@@ -304,7 +328,7 @@ void TransactionObject::applyDel(Document& /*Doc*/, TransactionalObject* /*pcObj
 void TransactionObject::applyNew(Document& /*Doc*/, TransactionalObject* /*pcObj*/)
 {}
 
-void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj, bool /* Forward */)
+void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj, bool Forward)
 {
     if (status == New || status == Chn) {
         // Property change order is not preserved, as it is recursive in nature
@@ -364,6 +388,17 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
             //             << " -> " << prop->getTypeId().getName());
             //     continue;
             // }
+            if (data.trimmed) {
+                auto copy = static_cast<PropertyLists*>(data.property);
+                auto current = freecad_cast<PropertyLists*>(prop);
+                if (!current || !copy->restoreCommonEnds(*current, data.commonEnds)) {
+                    FC_WARN("Cannot " << (Forward ? "redo" : "undo") << " change of property "
+                                      << prop->getFullName()
+                                      << " because it has been modified outside of a transaction");
+                    continue;
+                }
+                data.trimmed = false;
+            }
             try {
                 prop->Paste(*data.property);
             }
@@ -380,16 +415,19 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
     }
 }
 
-void TransactionObject::setProperty(const Property* pcProp)
+void TransactionObject::setProperty(const Property* pcProp, std::unique_ptr<Property> copy)
 {
     auto& data = _PropChangeMap[pcProp->getID()];
     if (!data.property && data.name.empty()) {
         static_cast<DynamicProperty::PropData&>(data) =
             pcProp->getContainer()->getDynamicPropertyData(pcProp);
         data.propertyOrig = pcProp;
-        data.property = pcProp->Copy();
+        if (!copy) {
+            copy.reset(pcProp->Copy());
+            copy->setStatusValue(pcProp->getStatus());
+        }
+        data.property = copy.release();
         data.propertyType = pcProp->getTypeId();
-        data.property->setStatusValue(pcProp->getStatus());
     }
 }
 
@@ -426,9 +464,39 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
     }
 }
 
+void TransactionObject::compact(const TransactionalObject* pcObj)
+{
+    if (status != New && status != Chn) {
+        return;
+    }
+    for (auto& v : _PropChangeMap) {
+        auto& data = v.second;
+        auto copy = freecad_cast<PropertyLists*>(data.property);
+        if (!copy || data.trimmed) {
+            continue;
+        }
+        // same check as in applyChn(), the original may be gone
+        auto name = pcObj->getPropertyName(data.propertyOrig);
+        if (!name || (!data.name.empty() && data.name != name)
+            || data.propertyType != data.propertyOrig->getTypeId()) {
+            continue;
+        }
+        data.trimmed = copy->trimCommonEnds(*static_cast<const PropertyLists*>(data.propertyOrig),
+                                            data.commonEnds);
+    }
+}
+
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    std::size_t size = sizeof(*this) + _NameInDocument.size();
+    for (const auto& v : _PropChangeMap) {
+        size += sizeof(v) + v.second.name.size();
+        if (v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
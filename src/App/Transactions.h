@@ -25,9 +25,11 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <memory>
 #include <unordered_map>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
+#include <App/Property.h>
 #include <App/PropertyContainer.h>
 
 namespace App
@@ -85,10 +87,24 @@ public:
 
     void addObjectNew(TransactionalObject* Obj);
     void addObjectDel(const TransactionalObject* Obj);
-    void addObjectChange(const TransactionalObject* Obj, const Property* Prop);
+    /** Record the change of a property
+     * @param copy: the value of the property before the change, taken by the caller.
+     * If null, the current value of the property is copied.
+     */
+    void addObjectChange(const TransactionalObject* Obj,
+                         const Property* Prop,
+                         std::unique_ptr<Property> copy = {});
+
+    /** Reduce the copies of list properties to their changed elements
+     * Called when the transaction is closed, the properties must keep their current values
+     * until the transaction is applied, see PropertyLists::trimCommonEnds().
+     */
+    void compact();
 
 private:
     int transID;
+    // cached result of getMemSize(), zero if unknown
+    mutable unsigned int memSize {0};
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -114,8 +130,9 @@ public:
     virtual void applyDel(Document& Doc, TransactionalObject* pcObj);
     virtual void applyChn(Document& Doc, TransactionalObject* pcObj, bool Forward);
 
-    void setProperty(const Property* pcProp);
+    void setProperty(const Property* pcProp, std::unique_ptr<Property> copy = {});
     void addOrRemoveProperty(const Property* pcProp, bool add);
+    void compact(const TransactionalObject* pcObj);
 
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
@@ -136,6 +153,9 @@ protected:
     {
         Base::Type propertyType;
         const Property* propertyOrig = nullptr;
+        // the elements the copy shares with the original, if it is trimmed
+        bool trimmed = false;
+        PropertyLists::CommonEnds commonEnds;
     };
     std::unordered_map<int64_t, PropData> _PropChangeMap;
 
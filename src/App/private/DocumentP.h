@@ -27,9 +27,17 @@
 #pragma warning(disable : 4834)
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -41,8 +49,13 @@
 
 #include <App/DocumentObject.h>
 #include <App/DocumentObserver.h>
+#include <App/FeaturePython.h>
+#include <App/RecomputeProfile.h>
 #include <App/StringHasher.h>
+#include <Base/Matrix.h>
+#include <Base/TimeInfo.h>
 #include <Base/UniqueNameManager.h>
+#include <Base/Writer.h>
 
 // using VertexProperty = boost::property<boost::vertex_root_t, DocumentObject* >;
 using DependencyList = boost::adjacency_list<
@@ -60,6 +73,11 @@ using Edge = Traits::edge_descriptor;
 using Node = std::vector<size_t>;
 using Path = std::vector<size_t>;
 
+namespace zipios
+{
+class ZipFile;
+}
+
 namespace App
 {
 using HasherMap = boost::bimap<StringHasherRef, int>;
@@ -70,6 +88,16 @@ struct DocumentP
 {
     // Array to preserve the creation order of created objects
     std::vector<DocumentObject*> objectArray;
+    /// The objects of one exact type, each with a number that increases along objectArray
+    struct TypeBucket
+    {
+        Base::Type type;
+        std::vector<std::pair<std::size_t, DocumentObject*>> objects;
+    };
+    /// The objects by their type, so that queries by type take time in proportion to
+    /// the number of types and the result instead of the number of objects
+    std::unordered_map<Base::Type::TypeId, TypeBucket> typeBuckets;
+    std::size_t objectSequence {0};
     std::unordered_set<App::DocumentObject*> touchedObjs;
     std::unordered_map<std::string, DocumentObject*> objectMap;
     Base::UniqueNameManager objectNameManager;
@@ -84,6 +112,10 @@ struct DocumentP
     Py::Object DocumentPythonObject;
     int iTransactionMode {0};
     bool rollback {false};
+    /// Nesting depth of Document::ObjectBatch
+    int objectBatchLevel {0};
+    /// Ids of the objects added within an ObjectBatch, not announced yet
+    std::vector<long> batchedObjects;
     bool undoing {false};  ///< document in the middle of undo or redo
     bool committing {false};
     bool opentransaction {false};
@@ -95,10 +127,122 @@ struct DocumentP
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    /// Guards _RecomputeLog while objects are recomputed concurrently
+    std::mutex recomputeLogMutex;
+    /// Timings of the last recompute
+    RecomputeProfile recomputeProfile;
+
+    /// A resolution of DocumentObject::getSubObjectCached() or getLinkedObjectCached()
+    struct ResolutionKey
+    {
+        const DocumentObject* obj;
+        std::string subname;
+        int flags;
+
+        bool operator==(const ResolutionKey& other) const
+        {
+            return obj == other.obj && flags == other.flags && subname == other.subname;
+        }
+    };
+    struct ResolutionKeyHash
+    {
+        std::size_t operator()(const ResolutionKey& key) const
+        {
+            std::size_t seed = std::hash<std::string>()(key.subname);
+            seed ^= std::hash<const void*>()(key.obj) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return seed ^ static_cast<std::size_t>(key.flags);
+        }
+    };
+    struct Resolution
+    {
+        DocumentObject* obj;
+        /// The transformation accumulated from the identity
+        Base::Matrix4D mat;
+        /// A Python override took part, so the transformation is resolved every time
+        bool uncached;
+    };
+    std::unordered_map<ResolutionKey, Resolution, ResolutionKeyHash> resolutions;
+    std::uint64_t resolutionGeneration {0};
+    std::uint64_t resolutionHits {0};
+    std::uint64_t resolutionMisses {0};
+    mutable std::mutex resolutionMutex;
+    /// Counts the changes of all documents that may alter a resolution
+    static std::atomic<std::uint64_t> resolutionChanges;
 
     StringHasherRef Hasher {new StringHasher};
 
     Document::PreRecomputeHook _preRecomputeHook;
+    Document::MainThreadHook _mainThreadHook;
+
+    /// What the objects recomputed concurrently would have done on the calling
+    /// thread. Each object of a batch collects its own, and they are replayed on
+    /// the calling thread in the order of the batch once all objects are done.
+    struct DeferredRecompute
+    {
+        /// A property change to be recorded in the undo transaction
+        struct Change
+        {
+            Document* doc;
+            const TransactionalObject* object;
+            const Property* property;
+            /// The value before the first change, or null if undo is off
+            std::unique_ptr<Property> copy;
+        };
+        std::vector<Change> changes;
+        /// The properties already in changes
+        std::unordered_set<const Property*> changed;
+        std::vector<std::function<void()>> notifications;
+    };
+    /// The deferral of the object recomputed by the current thread, if any
+    static thread_local DeferredRecompute* deferredRecompute;
+
+    /// State of an asynchronous recompute
+    std::future<int> asyncRecompute;
+    std::atomic<bool> asyncRecomputing {false};
+    std::thread::id mainThreadId;
+    /// Serializes the notifications of the worker threads
+    std::mutex asyncNotifyMutex;
+    /// Guards the hand over of a notification to the main thread
+    std::mutex asyncMutex;
+    std::condition_variable asyncCondition;
+    const std::function<void()>* asyncNotification {nullptr};
+    bool asyncNotificationDone {false};
+    /// Set while the main thread handles a notification of an asynchronous recompute
+    bool asyncNotifying {false};
+    /// Throws if the main thread changes the document while it is recomputed
+    /// asynchronously, other than from the notifications of the recompute
+    void checkAsyncEdit() const;
+
+    /// State of an asynchronous save
+    std::future<void> asyncSave;
+    std::string asyncSaveFileName;
+    /// Set by abortSave(), the worker stops before writing the next block
+    std::shared_ptr<std::atomic<bool>> asyncSaveCancel;
+
+    /// Archive of a lazily restored document, alive while deferred data files are left in it
+    std::weak_ptr<zipios::ZipFile> lazyArchive;
+
+    /// The file last saved, the next save copies the data files that didn't change from it
+    struct SavedArchive
+    {
+        std::string fileName;
+        unsigned int size {0};
+        Base::TimeInfo modified;
+        Base::ZipWriter::EntryDigests digests;
+    };
+    SavedArchive savedArchive;
+    /// Digests of the data files serialized last, until they are in the saved file
+    Base::ZipWriter::EntryDigests writtenDigests;
+
+    void rememberSavedArchive(const std::string& fileName)
+    {
+        Base::FileInfo fi(fileName);
+        savedArchive.fileName = fileName;
+        savedArchive.size = fi.size();
+        savedArchive.modified = fi.lastModified();
+        savedArchive.digests = std::move(writtenDigests);
+        writtenDigests.clear();
+    }
 
     DocumentP();
 
@@ -118,6 +262,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::mutex> lock(recomputeLogMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -133,10 +278,133 @@ struct DocumentP
         }
     }
 
+    void addToTypeBucket(DocumentObject* obj)
+    {
+        Base::Type type = obj->getTypeId();
+        TypeBucket& bucket = typeBuckets[type.getKey()];
+        bucket.type = type;
+        bucket.objects.emplace_back(objectSequence++, obj);
+    }
+
+    void removeFromTypeBucket(DocumentObject* obj)
+    {
+        auto it = typeBuckets.find(obj->getTypeId().getKey());
+        if (it == typeBuckets.end()) {
+            return;
+        }
+        auto& objects = it->second.objects;
+        auto jt = std::find_if(objects.begin(), objects.end(), [obj](const auto& entry) {
+            return entry.second == obj;
+        });
+        if (jt != objects.end()) {
+            objects.erase(jt);
+        }
+        if (objects.empty()) {
+            typeBuckets.erase(it);
+        }
+    }
+
+    /// The objects whose type matches in the order of objectArray
+    std::vector<DocumentObject*> getObjectsOfType(const std::function<bool(Base::Type)>& matches) const
+    {
+        std::vector<const TypeBucket*> buckets;
+        std::size_t count = 0;
+        for (const auto& it : typeBuckets) {
+            if (matches(it.second.type)) {
+                buckets.push_back(&it.second);
+                count += it.second.objects.size();
+            }
+        }
+
+        std::vector<std::pair<std::size_t, DocumentObject*>> entries;
+        entries.reserve(count);
+        for (const TypeBucket* bucket : buckets) {
+            entries.insert(entries.end(), bucket->objects.begin(), bucket->objects.end());
+        }
+        if (buckets.size() > 1) {
+            std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right) {
+                return left.first < right.first;
+            });
+        }
+
+        std::vector<DocumentObject*> objects;
+        objects.reserve(count);
+        for (const auto& entry : entries) {
+            objects.push_back(entry.second);
+        }
+        return objects;
+    }
+
+    int countObjectsOfType(const std::function<bool(Base::Type)>& matches) const
+    {
+        std::size_t count = 0;
+        for (const auto& it : typeBuckets) {
+            if (matches(it.second.type)) {
+                count += it.second.objects.size();
+            }
+        }
+        return static_cast<int>(count);
+    }
+
+    /** Look up the resolution of \a key or call \a func to get it
+     * The transformations only ever post-multiply the input matrix, so the
+     * cached transformation from the identity is applied to \a mat. The Python
+     * getSubObject() and getLinkedObject() may assign the matrix instead, so
+     * the resolutions they take part in are always done with \a mat.
+     */
+    template<typename Func>
+    DocumentObject* resolve(ResolutionKey&& key, Base::Matrix4D* mat, Func&& func)
+    {
+        std::uint64_t generation = resolutionChanges.load();
+        bool uncached = false;
+        {
+            std::lock_guard<std::mutex> lock(resolutionMutex);
+            if (resolutionGeneration != generation) {
+                resolutions.clear();
+                resolutionGeneration = generation;
+            }
+            auto it = resolutions.find(key);
+            if (it != resolutions.end() && !it->second.uncached) {
+                ++resolutionHits;
+                if (mat) {
+                    *mat *= it->second.mat;
+                }
+                return it->second.obj;
+            }
+            ++resolutionMisses;
+            if (it != resolutions.end()) {
+                uncached = true;
+            }
+        }
+        if (uncached) {
+            return func(mat);
+        }
+
+        std::uint64_t overrides = FeaturePythonImp::getTransformOverrideCalls();
+        Base::Matrix4D local;
+        DocumentObject* obj = func(&local);
+        uncached = FeaturePythonImp::getTransformOverrideCalls() != overrides;
+        {
+            // don't keep what was resolved while something changed
+            std::lock_guard<std::mutex> lock(resolutionMutex);
+            if (resolutionGeneration == generation && resolutionChanges.load() == generation) {
+                resolutions.emplace(std::move(key), Resolution {obj, local, uncached});
+            }
+        }
+        if (uncached) {
+            return mat ? func(mat) : obj;
+        }
+        if (mat) {
+            *mat *= local;
+        }
+        return obj;
+    }
+
     void clearDocument()
     {
         objectLabelManager.clear();
         objectArray.clear();
+        typeBuckets.clear();
         for (auto& v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
             delete (v.second);
@@ -29,13 +29,17 @@
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 #include <unistd.h>
 #endif
+#include <algorithm>
 #include <cstring>
 #include <functional>
+#include <thread>
+#include <vector>
 #endif
 
 #include "Console.h"
 #include "PyObjectBase.h"
 #include <QCoreApplication>
+#include <QThread>
 
 
 using namespace Base;
@@ -69,6 +73,30 @@ public:
     {}
 };
 
+struct ConsoleMessage
+{
+    LogStyle category;
+    IntendedRecipient recipient;
+    ContentType content;
+    std::string notifier;
+    std::string msg;
+    ConsoleMessage* next {nullptr};
+};
+
+// the messages of one batch of the asynchronous mode for the observers of the main thread
+class ConsoleBatchEvent: public QEvent
+{
+public:
+    static constexpr auto eventType = static_cast<QEvent::Type>(QEvent::User + 1);  // NOLINT
+
+    explicit ConsoleBatchEvent(std::vector<ConsoleMessage>&& messages)
+        : QEvent(eventType)
+        , messages(std::move(messages))
+    {}
+
+    std::vector<ConsoleMessage> messages;
+};
+
 class ConsoleOutput: public QObject  // clazy:exclude=missing-qobject-macro
 {
 public:
@@ -133,6 +161,11 @@ public:
                     break;
             }
         }
+        else if (ev->type() == ConsoleBatchEvent::eventType) {
+            for (const auto& message : static_cast<ConsoleBatchEvent*>(ev)->messages) {
+                Console().notifyObservers(message, false);
+            }
+        }
     }
 
 private:
@@ -141,6 +174,120 @@ private:
 
 ConsoleOutput* ConsoleOutput::instance = nullptr;  // NOLINT
 
+/* Delivers the messages of the asynchronous mode
+ * The sending threads push their messages onto a lock-free stack. The dispatcher thread takes the
+ * whole stack at once, restores the order in which the messages were sent and passes them to the
+ * thread-safe observers. The other observers get the batch with a single event in the main thread.
+ */
+class ConsoleDispatcher
+{
+public:
+    ConsoleDispatcher()
+        : thread(&ConsoleDispatcher::run, this)
+    {}
+    ~ConsoleDispatcher()
+    {
+        push(&stopMessage);
+        thread.join();
+    }
+
+    ConsoleDispatcher(const ConsoleDispatcher&) = delete;
+    ConsoleDispatcher(ConsoleDispatcher&&) = delete;
+    ConsoleDispatcher& operator=(const ConsoleDispatcher&) = delete;
+    ConsoleDispatcher& operator=(ConsoleDispatcher&&) = delete;
+
+    void push(ConsoleMessage* message)
+    {
+        if (message != &stopMessage) {
+            pushed.fetch_add(1);
+        }
+        ConsoleMessage* top = head.load(std::memory_order_relaxed);
+        do {
+            message->next = top;
+        } while (!head.compare_exchange_weak(top,
+                                             message,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+        // only the dispatcher waits, and only for an empty stack
+        if (!top) {
+            head.notify_one();
+        }
+    }
+
+    void flush()
+    {
+        // an observer of the dispatcher thread would wait for itself
+        if (std::this_thread::get_id() == thread.get_id()) {
+            return;
+        }
+        const std::uint64_t target = pushed.load();
+        std::uint64_t done = dispatched.load();
+        while (done < target) {
+            dispatched.wait(done);
+            done = dispatched.load();
+        }
+    }
+
+private:
+    void run()
+    {
+        std::vector<ConsoleMessage*> batch;
+        bool running = true;
+        while (running) {
+            head.wait(nullptr, std::memory_order_acquire);
+            ConsoleMessage* top = head.exchange(nullptr, std::memory_order_acquire);
+            batch.clear();
+            for (; top; top = top->next) {
+                batch.push_back(top);
+            }
+            // the stack holds the latest message first
+            std::reverse(batch.begin(), batch.end());
+            running = deliver(batch);
+        }
+    }
+
+    bool deliver(const std::vector<ConsoleMessage*>& batch)
+    {
+        ConsoleSingleton& console = Console();
+        std::vector<ConsoleMessage> mainThread;
+        std::uint64_t count = 0;
+        bool running = true;
+        {
+            std::lock_guard<std::mutex> lock(console._observerMutex);
+            bool forward = std::any_of(console._aclObservers.begin(),
+                                       console._aclObservers.end(),
+                                       [](ILogger* observer) {
+                                           return !observer->isThreadSafe();
+                                       });
+            for (ConsoleMessage* message : batch) {
+                if (message == &stopMessage) {
+                    running = false;
+                    continue;
+                }
+                std::unique_ptr<ConsoleMessage> owner(message);
+                console.notifyObservers(*message, true);
+                if (forward) {
+                    mainThread.push_back(std::move(*message));
+                }
+                count++;
+            }
+        }
+        if (!mainThread.empty()) {
+            QCoreApplication::postEvent(ConsoleOutput::getInstance(),
+                                        new ConsoleBatchEvent(std::move(mainThread)));
+        }
+        dispatched.fetch_add(count);
+        dispatched.notify_all();
+        return running;
+    }
+
+    std::atomic<ConsoleMessage*> head {nullptr};
+    std::atomic<std::uint64_t> pushed {0};
+    std::atomic<std::uint64_t> dispatched {0};
+    ConsoleMessage stopMessage {};
+    std::thread thread;
+};
+
 }  // namespace Base
 
 //**************************************************************************
@@ -157,6 +304,8 @@ ConsoleSingleton::ConsoleSingleton()
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    // delivers the pending messages
+    _dispatcher.reset();
     ConsoleOutput::destruct();
     for (ILogger* Iter : _aclObservers) {  // NOLINT
         delete Iter;
@@ -261,12 +410,30 @@ bool ConsoleSingleton::isMsgTypeEnabled(const char* sObs, const FreeCAD_ConsoleM
 
 void ConsoleSingleton::setConnectionMode(const ConnectionMode mode)
 {
-    connectionMode = mode;
-
     // make sure this method gets called from the main thread
-    if (connectionMode == Queued) {
+    if (mode != Direct) {
         ConsoleOutput::getInstance();
     }
+    // the dispatcher is kept until the end because other threads may still be sending to it
+    if (mode == Asynchronous && !_dispatcher) {
+        _dispatcher = std::make_unique<ConsoleDispatcher>();
+    }
+
+    if (connectionMode.exchange(mode) == Asynchronous && mode != Asynchronous) {
+        flush();
+    }
+}
+
+void ConsoleSingleton::flush()
+{
+    if (!_dispatcher) {
+        return;
+    }
+    _dispatcher->flush();
+    ConsoleOutput* output = ConsoleOutput::getInstance();
+    if (QThread::currentThread() == output->thread()) {
+        QCoreApplication::sendPostedEvents(output, ConsoleBatchEvent::eventType);
+    }
 }
 
 //**************************************************************************
@@ -280,6 +447,7 @@ void ConsoleSingleton::setConnectionMode(const ConnectionMode mode)
  */
 void ConsoleSingleton::attachObserver(ILogger* pcObserver)
 {
+    std::lock_guard<std::mutex> lock(_observerMutex);
     // double insert !!
     assert(!_aclObservers.contains(pcObserver));
 
@@ -293,6 +461,9 @@ void ConsoleSingleton::attachObserver(ILogger* pcObserver)
  */
 void ConsoleSingleton::detachObserver(ILogger* pcObserver)
 {
+    // the observer may be destroyed afterwards
+    flush();
+    std::lock_guard<std::mutex> lock(_observerMutex);
     _aclObservers.erase(pcObserver);
 }
 
@@ -313,6 +484,29 @@ void ConsoleSingleton::notifyPrivate(const LogStyle category,
     }
 }
 
+void ConsoleSingleton::notifyObservers(const ConsoleMessage& message, const bool threadSafe) const
+{
+    for (ILogger* Iter : _aclObservers) {
+        if (Iter->isThreadSafe() == threadSafe && Iter->isActive(message.category)) {
+            Iter->sendLog(message.notifier,
+                          message.msg,
+                          message.category,
+                          message.recipient,
+                          message.content);
+        }
+    }
+}
+
+void ConsoleSingleton::enqueue(const LogStyle category,
+                               const IntendedRecipient recipient,
+                               const ContentType content,
+                               const std::string& notifiername,
+                               std::string&& msg)
+{
+    _dispatcher->push(
+        new ConsoleMessage {category, recipient, content, notifiername, std::move(msg)});
+}
+
 void ConsoleSingleton::postEvent(const FreeCAD_ConsoleMsgType type,
                                  const IntendedRecipient recipient,
                                  const ContentType content,
@@ -326,6 +520,7 @@ void ConsoleSingleton::postEvent(const FreeCAD_ConsoleMsgType type,
 ILogger* ConsoleSingleton::get(const char* Name) const
 {
     const char* OName {};
+    std::lock_guard<std::mutex> lock(_observerMutex);
     for (ILogger* Iter : _aclObservers) {
         OName = Iter->name();  // get the name
         if (OName && strcmp(OName, Name) == 0) {
@@ -26,9 +26,12 @@
 
 // Std. configurations
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <sstream>
@@ -351,6 +354,12 @@ using PyMethodDef = struct PyMethodDef;
 #define FC_LOGLEVEL_LOG 3
 #define FC_LOGLEVEL_TRACE 4
 
+// Log statements above this level are compiled out, e.g. build with -DFC_LOG_MAX_LEVEL=3 to strip
+// all FC_TRACE calls
+#ifndef FC_LOG_MAX_LEVEL
+#define FC_LOG_MAX_LEVEL FC_LOGLEVEL_TRACE
+#endif
+
 #define _FC_LOG_LEVEL_INIT(_name, _tag, ...) static Base::LogLevel _name(_tag, ##__VA_ARGS__);
 
 #ifndef FC_LOG_INSTANCE
@@ -361,7 +370,7 @@ using PyMethodDef = struct PyMethodDef;
 
 #define __FC_PRINT(_instance, _l, _func, _notifier, _msg, _file, _line)                            \
     do {                                                                                           \
-        if (_instance.isEnabled(_l)) {                                                             \
+        if ((_l) <= FC_LOG_MAX_LEVEL && _instance.isEnabled(_l)) {                                 \
             std::stringstream _str;                                                                \
             _instance.prefix(_str, _file, _line) << _msg;                                          \
             if (_instance.add_eol)                                                                 \
@@ -603,6 +612,14 @@ public:
     {
         return nullptr;
     }
+    /** Returns whether sendLog() may be called from any thread
+     * In asynchronous mode thread-safe observers are notified by the dispatcher thread, all others
+     * in the main thread.
+     */
+    virtual bool isThreadSafe() const
+    {
+        return false;
+    }
     bool bErr {true};
     bool bMsg {true};
     bool bLog {true};
@@ -612,6 +629,9 @@ public:
 };
 
 
+class ConsoleDispatcher;
+struct ConsoleMessage;
+
 /** The console class
  *  This class manage all the stdio stuff. This includes
  *  Messages, Warnings, Log entries, Errors, Criticals, Notifications. The incoming Messages are
@@ -797,7 +817,9 @@ public:
     enum ConnectionMode
     {
         Direct = 0,
-        Queued = 1
+        Queued = 1,
+        /// Messages are queued without locking and dispatched in batches by a background thread
+        Asynchronous = 2
     };
 
     enum FreeCAD_ConsoleMsgType
@@ -814,7 +836,10 @@ public:
     ConsoleMsgFlags setEnabledMsgType(const char* sObs, ConsoleMsgFlags type, bool on) const;
     /// Checks if message types of a certain console observer are enabled
     bool isMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType type) const;
+    /// Must be called from the main thread
     void setConnectionMode(ConnectionMode mode);
+    /// Waits until all messages sent in asynchronous mode have been delivered
+    void flush();
 
     int* getLogLevel(const char* tag, bool create = true);
 
@@ -862,7 +887,7 @@ private:
     static PyObject* sPyGetObservers(PyObject* self, PyObject* args);
 
     bool _bCanRefresh {true};
-    ConnectionMode connectionMode {Direct};
+    std::atomic<ConnectionMode> connectionMode {Direct};
 
     // Singleton!
     ConsoleSingleton();
@@ -885,6 +910,12 @@ private:
                        ContentType content,
                        const std::string& notifiername,
                        const std::string& msg) const;
+    void enqueue(LogStyle category,
+                 IntendedRecipient recipient,
+                 ContentType content,
+                 const std::string& notifiername,
+                 std::string&& msg);
+    void notifyObservers(const ConsoleMessage& message, bool threadSafe) const;
 
     // singleton
     static void Destruct();
@@ -892,11 +923,15 @@ private:
 
     // observer list
     std::set<ILogger*> _aclObservers;
+    // guards the observer list against the dispatcher thread
+    mutable std::mutex _observerMutex;
+    std::unique_ptr<ConsoleDispatcher> _dispatcher;
 
     std::map<std::string, int> _logLevels;
     int _defaultLogLevel;
 
     friend class ConsoleOutput;
+    friend class ConsoleDispatcher;
 };
 
 /** Access to the Console
@@ -1193,9 +1228,13 @@ void Base::ConsoleSingleton::send(const std::string& notifiername, const char* p
         format += e.what();
     }
 
-    if (connectionMode == Direct) {
+    const ConnectionMode mode = connectionMode;
+    if (mode == Direct) {
         notify<category, recipient, contenttype>(notifiername, format);
     }
+    else if (mode == Asynchronous) {
+        enqueue(category, recipient, contenttype, notifiername, std::move(format));
+    }
     else {
 
         const auto type = getConsoleMsg(category);
@@ -52,6 +52,10 @@ public:
     {
         return "File";
     }
+    bool isThreadSafe() const override
+    {
+        return true;
+    }
 
     ConsoleObserverFile(const ConsoleObserverFile&) = delete;
     ConsoleObserverFile(ConsoleObserverFile&&) = delete;
@@ -79,6 +83,10 @@ public:
     {
         return "Console";
     }
+    bool isThreadSafe() const override
+    {
+        return true;
+    }
 
     ConsoleObserverStd(const ConsoleObserverStd&) = delete;
     ConsoleObserverStd(ConsoleObserverStd&&) = delete;
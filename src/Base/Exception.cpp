@@ -588,6 +588,17 @@ PyObject* RestoreError::getPyExceptionType() const
 
 // ---------------------------------------------------------
 
+void Base::rethrowFirstException(const std::vector<std::exception_ptr>& errors)
+{
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// ---------------------------------------------------------
+
 #if defined(__GNUC__) && defined(FC_OS_LINUX)
 #include <stdexcept>
 #include <iostream>
@@ -25,8 +25,10 @@
 #define BASE_EXCEPTION_H
 
 #include <csignal>
+#include <exception>
 #include <source_location>
 #include <string>
+#include <vector>
 
 #include "BaseClass.h"
 #include "FileInfo.h"
@@ -535,6 +537,13 @@ inline void Exception::setTranslatable(const bool translatable)
     isTranslatable = translatable;
 }
 
+/** Rethrow the first exception in \a errors, if there is one
+ * For items processed concurrently, each of which keeps what it has thrown.
+ * The items are checked in order, so the caller gets the exception a serial
+ * loop over them would have thrown.
+ */
+BaseExport void rethrowFirstException(const std::vector<std::exception_ptr>& errors);
+
 #if defined(__GNUC__) && defined(FC_OS_LINUX)
 class SignalException
 {
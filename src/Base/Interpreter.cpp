@@ -25,7 +25,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <map>
 #include <sstream>
+#include <string_view>
 #include <boost/regex.hpp>
 #endif
 
@@ -43,6 +45,43 @@ unsigned int format2_len = 1024;
 
 using namespace Base;
 
+namespace
+{
+// The attributes found on Python classes, by class and version tag. A modified class gets a new
+// version tag, and tags aren't reused. Guarded by the GIL.
+std::map<std::pair<PyTypeObject*, unsigned int>, std::map<std::string, bool, std::less<>>>
+    classAttributes;  // NOLINT
+}  // namespace
+
+bool Base::pyHasAttr(PyObject* obj, const char* name)
+{
+    PyTypeObject* type = Py_TYPE(obj);
+    // a class computing its attributes in __getattr__ can't be cached
+    if (type->tp_getattro != PyObject_GenericGetAttr || type->tp_version_tag == 0) {
+        return PyObject_HasAttrString(obj, name) != 0;
+    }
+
+    auto& attributes = classAttributes[std::make_pair(type, type->tp_version_tag)];
+    auto it = attributes.find(std::string_view(name));
+    if (it == attributes.end()) {
+        bool found = PyObject_HasAttrString(reinterpret_cast<PyObject*>(type), name) != 0;  // NOLINT
+        it = attributes.emplace(name, found).first;
+    }
+    if (it->second) {
+        return true;
+    }
+
+    // the instance may still have an attribute of its own
+    PyObject* dict = PyObject_GenericGetDict(obj, nullptr);
+    if (!dict) {
+        PyErr_Clear();
+        return false;
+    }
+    bool found = PyDict_GetItemString(dict, name) != nullptr;
+    Py_DECREF(dict);
+    return found;
+}
+
 PyException::PyException(const Py::Object& obj)
 {
     setMessage(obj.as_string());
@@ -59,8 +59,13 @@
 #define FC_PY_GetCallable(_pyobj, _name, _var)                                                     \
     do {                                                                                           \
         _var = Py::Object();                                                                       \
-        if (PyObject_HasAttrString(_pyobj, _name)) {                                               \
-            Py::Object _obj(PyObject_GetAttrString(_pyobj, _name), true);                          \
+        if (Base::pyHasAttr(_pyobj, _name)) {                                                      \
+            PyObject* _attr = PyObject_GetAttrString(_pyobj, _name);                               \
+            if (!_attr) {                                                                          \
+                PyErr_Clear();                                                                     \
+                break;                                                                             \
+            }                                                                                      \
+            Py::Object _obj(_attr, true);                                                          \
             if (_obj.isCallable())                                                                 \
                 _var = _obj;                                                                       \
         }                                                                                          \
@@ -77,8 +82,13 @@
 #define FC_PY_GetObject(_pyobj, _name, _var)                                                       \
     do {                                                                                           \
         _var = Py::Object();                                                                       \
-        if (PyObject_HasAttrString(_pyobj, _name))                                                 \
-            _var = Py::asObject(PyObject_GetAttrString(_pyobj, _name));                            \
+        if (Base::pyHasAttr(_pyobj, _name)) {                                                      \
+            PyObject* _attr = PyObject_GetAttrString(_pyobj, _name);                               \
+            if (_attr)                                                                             \
+                _var = Py::asObject(_attr);                                                        \
+            else                                                                                   \
+                PyErr_Clear();                                                                     \
+        }                                                                                          \
     } while (0)
 // NOLINTEND
 
@@ -129,6 +139,14 @@ private:
     PyObject* _exceptionType;
 };
 
+/** Checks whether a Python object has an attribute
+ * Unlike PyObject_HasAttrString() this doesn't raise and clear an AttributeError for every
+ * missing attribute. What the class of the object provides is looked up once for each version
+ * of the class, so checking the same names on many objects of a class only has to look into
+ * their instance dictionaries. The GIL must be held.
+ */
+BaseExport bool pyHasAttr(PyObject* obj, const char* name);
+
 inline Py::Object pyCall(PyObject* callable, PyObject* args = nullptr)
 {
     PyObject* result = PyObject_CallObject(callable, args);
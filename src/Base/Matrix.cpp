@@ -27,6 +27,14 @@
 #include <sstream>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FC_MATRIX_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define FC_MATRIX_NEON
+#include <arm_neon.h>
+#endif
+
 #include "Matrix.h"
 #include "Converter.h"
 
@@ -510,6 +518,101 @@ void Matrix4D::transform(const Vector3d& vec, const Matrix4D& mat)
     move(vec);
 }
 
+namespace
+{
+// The rows for x and y are computed together in one register and z separately.
+// The order of the operations is the same as in multVec(). Wider registers don't
+// pay off for the interleaved coordinates.
+#if defined(FC_MATRIX_SSE2)
+inline void storeXY(Vector3d& pnt, __m128d xy)
+{
+    _mm_storeu_pd(&pnt.x, xy);
+}
+
+inline void storeXY(Vector3f& pnt, __m128d xy)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(&pnt.x), _mm_cvtpd_ps(xy));  // NOLINT
+}
+
+template<typename Vec>
+void transformArray(const Matrix4D& mat, std::span<Vec> points)
+{
+    const __m128d c0 = _mm_set_pd(mat[1][0], mat[0][0]);
+    const __m128d c1 = _mm_set_pd(mat[1][1], mat[0][1]);
+    const __m128d c2 = _mm_set_pd(mat[1][2], mat[0][2]);
+    const __m128d c3 = _mm_set_pd(mat[1][3], mat[0][3]);
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+    using value_type = typename Vec::num_type;
+    for (auto& pnt : points) {
+        double sx = static_cast<double>(pnt.x);
+        double sy = static_cast<double>(pnt.y);
+        double sz = static_cast<double>(pnt.z);
+        __m128d xy = _mm_mul_pd(c0, _mm_set1_pd(sx));
+        xy = _mm_add_pd(xy, _mm_mul_pd(c1, _mm_set1_pd(sy)));
+        xy = _mm_add_pd(xy, _mm_mul_pd(c2, _mm_set1_pd(sz)));
+        xy = _mm_add_pd(xy, c3);
+        double dz = m20 * sx + m21 * sy + m22 * sz + m23;
+        storeXY(pnt, xy);
+        pnt.z = static_cast<value_type>(dz);
+    }
+}
+#elif defined(FC_MATRIX_NEON)
+inline void storeXY(Vector3d& pnt, float64x2_t xy)
+{
+    vst1q_f64(&pnt.x, xy);
+}
+
+inline void storeXY(Vector3f& pnt, float64x2_t xy)
+{
+    vst1_f32(&pnt.x, vcvt_f32_f64(xy));
+}
+
+inline float64x2_t makePair(double first, double second)
+{
+    return vcombine_f64(vdup_n_f64(first), vdup_n_f64(second));
+}
+
+template<typename Vec>
+void transformArray(const Matrix4D& mat, std::span<Vec> points)
+{
+    const float64x2_t c0 = makePair(mat[0][0], mat[1][0]);
+    const float64x2_t c1 = makePair(mat[0][1], mat[1][1]);
+    const float64x2_t c2 = makePair(mat[0][2], mat[1][2]);
+    const float64x2_t c3 = makePair(mat[0][3], mat[1][3]);
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+    using value_type = typename Vec::num_type;
+    for (auto& pnt : points) {
+        double sx = static_cast<double>(pnt.x);
+        double sy = static_cast<double>(pnt.y);
+        double sz = static_cast<double>(pnt.z);
+        float64x2_t xy = vmulq_n_f64(c0, sx);
+        xy = vaddq_f64(xy, vmulq_n_f64(c1, sy));
+        xy = vaddq_f64(xy, vmulq_n_f64(c2, sz));
+        xy = vaddq_f64(xy, c3);
+        double dz = m20 * sx + m21 * sy + m22 * sz + m23;
+        storeXY(pnt, xy);
+        pnt.z = static_cast<value_type>(dz);
+    }
+}
+#else
+template<typename Vec>
+void transformArray(const Matrix4D& mat, std::span<Vec> points)
+{
+    mat.transformPoints(points.begin(), points.end());
+}
+#endif
+}  // namespace
+
+void Matrix4D::transformPoints(std::span<Vector3f> points) const
+{
+    transformArray(*this, points);
+}
+
+void Matrix4D::transformPoints(std::span<Vector3d> points) const
+{
+    transformArray(*this, points);
+}
+
 void Matrix4D::inverse()
 {
     Matrix4D clInvTrlMat;
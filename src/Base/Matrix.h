@@ -26,7 +26,9 @@
 
 #include <array>
 #include <cmath>
+#include <span>
 #include <string>
+#include <type_traits>
 
 #include "Vector3D.h"
 #ifndef FC_GLOBAL_H
@@ -99,6 +101,17 @@ public:
     inline Vector3d operator*(const Vector3d& vec) const;
     inline void multVec(const Vector3d& src, Vector3d& dst) const;
     inline void multVec(const Vector3f& src, Vector3f& dst) const;
+    /** @name Batch transformation
+     * Transform whole arrays of points in place. This is considerably faster than
+     * calling multVec() for every single point.
+     */
+    //@{
+    void transformPoints(std::span<Vector3f> points) const;
+    void transformPoints(std::span<Vector3d> points) const;
+    /// Generic version for ranges of any type with the members x, y and z
+    template<typename Iterator>
+    void transformPoints(Iterator first, Iterator last) const;
+    //@}
     inline Matrix4D operator*(double scalar) const;
     inline Matrix4D& operator*=(double scalar);
     /// Comparison
@@ -345,6 +358,28 @@ inline void Matrix4D::multVec(const Vector3f& src, Vector3f& dst) const
     dst.Set(static_cast<float>(dx), static_cast<float>(dy), static_cast<float>(dz));
 }
 
+template<typename Iterator>
+void Matrix4D::transformPoints(Iterator first, Iterator last) const
+{
+    // The compiler cannot rule out that the points alias the matrix, so copying the
+    // coefficients avoids reloading them for every point.
+    // clang-format off
+    const double m00 = dMtrx4D[0][0], m01 = dMtrx4D[0][1], m02 = dMtrx4D[0][2], m03 = dMtrx4D[0][3];
+    const double m10 = dMtrx4D[1][0], m11 = dMtrx4D[1][1], m12 = dMtrx4D[1][2], m13 = dMtrx4D[1][3];
+    const double m20 = dMtrx4D[2][0], m21 = dMtrx4D[2][1], m22 = dMtrx4D[2][2], m23 = dMtrx4D[2][3];
+    // clang-format on
+    for (; first != last; ++first) {
+        auto& pnt = *first;
+        using value_type = std::remove_reference_t<decltype(pnt.x)>;
+        double sx = static_cast<double>(pnt.x);
+        double sy = static_cast<double>(pnt.y);
+        double sz = static_cast<double>(pnt.z);
+        pnt.x = static_cast<value_type>(m00 * sx + m01 * sy + m02 * sz + m03);
+        pnt.y = static_cast<value_type>(m10 * sx + m11 * sy + m12 * sz + m13);
+        pnt.z = static_cast<value_type>(m20 * sx + m21 * sy + m22 * sz + m23);
+    }
+}
+
 inline Matrix4D Matrix4D::operator*(double scalar) const
 {
     Matrix4D newMat(*this);
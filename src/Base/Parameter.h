@@ -46,6 +46,8 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include <boost/signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -625,6 +627,122 @@ public:
     ParameterManager& operator=(ParameterManager&&) = delete;
 };
 
+/** A typed handle to a single parameter that caches its value
+ *  Reading the value doesn't search the XML document. The cached value is
+ *  refreshed when the group notifies a change of the parameter, so changes
+ *  made in the preferences or by Python are seen immediately.
+ *  Supported types are bool, integral and floating point types, std::string
+ *  and Base::Color.
+ *  \code
+ *  static ParameterValue<bool> checkExtension(
+ *      App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document"),
+ *      "CheckExtension",
+ *      true);
+ *  if (checkExtension.getValue()) {
+ *      ...
+ *  }
+ *  \endcode
+ *  For a whole group of parameters see the generated classes like Gui::TreeParams.
+ */
+template<typename T>
+class ParameterValue: public ParameterGrp::ObserverType
+{
+public:
+    ParameterValue(ParameterGrp::handle group, const char* name, T preset = T())
+        : hGrp(std::move(group))
+        , name(name)
+        , preset(std::move(preset))
+    {
+        value = read();
+        hGrp->Attach(this);
+    }
+    ~ParameterValue() override
+    {
+        hGrp->Detach(this);
+    }
+
+    ParameterValue(const ParameterValue&) = delete;
+    ParameterValue(ParameterValue&&) = delete;
+    ParameterValue& operator=(const ParameterValue&) = delete;
+    ParameterValue& operator=(ParameterValue&&) = delete;
+
+    /// Returns the cached value
+    const T& getValue() const
+    {
+        return value;
+    }
+    /// Writes the value to the parameter group
+    void setValue(const T& val)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            hGrp->SetBool(name.c_str(), val);
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            hGrp->SetInt(name.c_str(), static_cast<long>(val));
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            hGrp->SetUnsigned(name.c_str(), static_cast<unsigned long>(val));
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            hGrp->SetFloat(name.c_str(), static_cast<double>(val));
+        }
+        else if constexpr (std::is_same_v<T, std::string>) {
+            hGrp->SetASCII(name.c_str(), val);
+        }
+        else {
+            hGrp->SetColor(name.c_str(), val);
+        }
+    }
+    const char* getName() const
+    {
+        return name.c_str();
+    }
+    const ParameterGrp::handle& getGroup() const
+    {
+        return hGrp;
+    }
+
+    void OnChange(ParameterGrp::SubjectType& rCaller, ParameterGrp::MessageType Reason) override
+    {
+        (void)rCaller;
+        // Clear() notifies with an empty name
+        if (!Reason || !*Reason || name == Reason) {
+            value = read();
+        }
+    }
+
+private:
+    T read() const
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            return hGrp->GetBool(name.c_str(), preset);
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return static_cast<T>(hGrp->GetInt(name.c_str(), static_cast<long>(preset)));
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(
+                hGrp->GetUnsigned(name.c_str(), static_cast<unsigned long>(preset)));
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<T>(hGrp->GetFloat(name.c_str(), static_cast<double>(preset)));
+        }
+        else if constexpr (std::is_same_v<T, std::string>) {
+            return hGrp->GetASCII(name.c_str(), preset.c_str());
+        }
+        else {
+            static_assert(std::is_same_v<T, Base::Color>, "Unsupported parameter type");
+            return hGrp->GetColor(name.c_str(), preset);
+        }
+    }
+
+private:
+    ParameterGrp::handle hGrp;
+    std::string name;
+    T preset;
+    T value;
+};
+
 /** python wrapper function
  */
 BaseExport PyObject* GetPyObject(const Base::Reference<ParameterGrp>& hcParamGrp);
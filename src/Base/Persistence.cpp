@@ -74,11 +74,33 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::deferRestoreDocFile(const std::shared_ptr<DeferredDocFile>& /*file*/)
+{
+    return false;
+}
+
+Persistence::DocFileDecoder Persistence::getDocFileDecoder()
+{
+    return {};
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
+    // Most attributes are plain names, so look for the characters to escape
+    // first and copy the text between them in one go
+    static const char special[] = "<\"'&>\r\n\t";
+    std::size_t pos = str.find_first_of(special);
+    if (pos == std::string::npos) {
+        return str;
+    }
+
     std::string tmp;
-    for (char it : str) {
-        switch (it) {
+    tmp.reserve(str.size() + 16);
+    std::size_t start = 0;
+    for (; pos != std::string::npos; pos = str.find_first_of(special, start)) {
+        tmp.append(str, start, pos - start);
+        start = pos + 1;
+        switch (str[pos]) {
             case '<':
                 tmp += "&lt;";
                 break;
@@ -104,10 +126,10 @@ std::string Persistence::encodeAttribute(const std::string& str)
                 tmp += "&#9;";
                 break;
             default:
-                tmp += it;
                 break;
         }
     }
+    tmp.append(str, start, std::string::npos);
 
     return tmp;
 }
@@ -24,10 +24,14 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <functional>
+#include <memory>
+
 #include "BaseClass.h"
 
 namespace Base
 {
+class DeferredDocFile;
 class Reader;
 class Writer;
 class XMLReader;
@@ -145,6 +149,28 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** This method is used to defer restoring a data file until its content is needed
+     * It is called by XMLReader::readFiles() instead of RestoreDocFile() if the reader restores
+     * lazily. A subclass that supports this keeps \a file and restores from it on first access
+     * of its data. The default implementation returns false, in which case RestoreDocFile() is
+     * called right away.
+     * @see Base::DeferredDocFile, Base::XMLReader::setLazyArchive()
+     */
+    virtual bool deferRestoreDocFile(const std::shared_ptr<DeferredDocFile>& file);
+    /** Decodes a data file in a worker thread and returns the function that assigns the result
+     * The returned function is called in the thread of XMLReader::readFiles().
+     */
+    using DocFileDecoder = std::function<std::function<void()>(Reader& reader)>;
+    /** This method is used to opt in to restoring a data file concurrently
+     * It is called by XMLReader::readFiles() instead of RestoreDocFile(). A subclass whose data
+     * can be decoded independently of any other object returns a decoder, which must neither
+     * modify the object nor use a local reader. Settings the decoder depends on are to be read
+     * here, this method is called in the thread of readFiles(). The data files of several objects
+     * are decoded at the same time and their results are assigned in the order of the files,
+     * after the files restored directly in between. The default implementation returns an empty
+     * decoder, in which case RestoreDocFile() is called right away.
+     */
+    virtual DocFileDecoder getDocFileDecoder();
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
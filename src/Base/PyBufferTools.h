@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef FREECAD_PYBUFFERTOOLS_H
+#define FREECAD_PYBUFFERTOOLS_H
+
+#include <Python.h>
+#include <type_traits>
+
+namespace Base
+{
+
+/// Returns the struct module format character of the arithmetic type \a T
+template<typename T>
+constexpr const char* bufferFormat()
+{
+    // clang-format off
+    if constexpr (std::is_same_v<T, float>) { return "f"; }
+    else if constexpr (std::is_same_v<T, double>) { return "d"; }
+    else if constexpr (std::is_same_v<T, int>) { return "i"; }
+    else if constexpr (std::is_same_v<T, unsigned int>) { return "I"; }
+    else if constexpr (std::is_same_v<T, long>) { return "l"; }
+    else if constexpr (std::is_same_v<T, unsigned long>) { return "L"; }
+    else if constexpr (std::is_same_v<T, long long>) { return "q"; }
+    else if constexpr (std::is_same_v<T, unsigned long long>) { return "Q"; }
+    else { static_assert(std::is_same_v<T, void>, "Unsupported buffer type"); }
+    // clang-format on
+}
+
+/** Creates a memoryview of \a rows x \a cols values of type \a T, e.g. to be
+ * wrapped by numpy.asarray() without another copy. The memory is owned by a
+ * bytearray that lives as long as the memoryview, \a data is set to it to fill
+ * in the values. Returns nullptr with a Python exception set on failure.
+ */
+template<typename T>
+PyObject* newArrayView(Py_ssize_t rows, Py_ssize_t cols, T*& data)
+{
+    PyObject* bytes = PyByteArray_FromStringAndSize(nullptr, rows * cols * Py_ssize_t(sizeof(T)));
+    if (!bytes) {
+        return nullptr;
+    }
+    data = reinterpret_cast<T*>(PyByteArray_AsString(bytes));  // NOLINT
+    PyObject* view = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if (!view) {
+        return nullptr;
+    }
+    // memoryview.cast() doesn't accept a shape with zero elements
+    PyObject* cast = rows > 0 && cols > 0
+        ? PyObject_CallMethod(view, "cast", "s(nn)", bufferFormat<T>(), rows, cols)
+        : PyObject_CallMethod(view, "cast", "s", bufferFormat<T>());
+    Py_DECREF(view);
+    return cast;
+}
+
+/** Calls \a func(index, value) for all values of the C-contiguous buffer
+ * \a obj, e.g. a NumPy array, whose number of values must be a multiple of
+ * \a cols. The value has the item type of the buffer, which must be one of
+ * the arithmetic types of the struct module. Returns false with a Python
+ * exception set if \a obj isn't such a buffer.
+ */
+template<typename Func>
+bool forEachBufferValue(PyObject* obj, Py_ssize_t cols, Func&& func)
+{
+    Py_buffer buf;
+    if (PyObject_GetBuffer(obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return false;
+    }
+    struct Release
+    {
+        Py_buffer* buf;
+        ~Release()
+        {
+            PyBuffer_Release(buf);
+        }
+    } release {&buf};
+
+    const char* name = buf.format ? buf.format : "B";
+    const char* format = name;
+    if (*format == '@') {
+        ++format;
+    }
+    Py_ssize_t count = buf.itemsize > 0 ? buf.len / buf.itemsize : 0;
+    if (count % cols != 0) {
+        PyErr_Format(PyExc_ValueError, "Number of values must be a multiple of %zd", cols);
+        return false;
+    }
+
+    auto apply = [&](auto type) {
+        using T = decltype(type);
+        if (buf.itemsize != Py_ssize_t(sizeof(T))) {
+            return false;
+        }
+        const T* data = static_cast<const T*>(buf.buf);
+        for (Py_ssize_t i = 0; i < count; i++) {
+            func(i, data[i]);  // NOLINT
+        }
+        return true;
+    };
+
+    bool done = false;
+    if (format[0] != '\0' && format[1] == '\0') {
+        switch (format[0]) {
+            // clang-format off
+            case 'b': done = apply((signed char)0); break;
+            case 'B': done = apply((unsigned char)0); break;
+            case 'h': done = apply((short)0); break;
+            case 'H': done = apply((unsigned short)0); break;
+            case 'i': done = apply(int(0)); break;
+            case 'I': done = apply((unsigned int)0); break;
+            case 'l': done = apply(long(0)); break;
+            case 'L': done = apply((unsigned long)0); break;
+            case 'q': done = apply((long long)0); break;
+            case 'Q': done = apply((unsigned long long)0); break;
+            case 'n': done = apply(Py_ssize_t(0)); break;
+            case 'N': done = apply(size_t(0)); break;
+            case 'f': done = apply(float(0)); break;
+            case 'd': done = apply(double(0)); break;
+            default: break;
+            // clang-format on
+        }
+    }
+    if (!done && !PyErr_Occurred()) {
+        PyErr_Format(PyExc_TypeError, "Unsupported buffer format '%s'", name);
+    }
+    return done;
+}
+
+}  // namespace Base
+
+#endif  // FREECAD_PYBUFFERTOOLS_H
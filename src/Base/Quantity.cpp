@@ -25,8 +25,13 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <list>
+#include <mutex>
 #include <numbers>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #endif
 
 #include <fmt/format.h>
@@ -553,8 +558,64 @@ private:
 #pragma GCC diagnostic pop
 #endif
 
+namespace
+{
+
+// the generated scanner and parser keep their state in globals
+std::mutex parserMutex;  // NOLINT
+
+// The results of the most recently parsed strings, properties and expressions often parse the
+// same strings over and over. Only the value and the unit are kept, so that each result gets the
+// format that is current when it is parsed.
+class ParseCache
+{
+public:
+    bool find(const std::string& string, Quantity& quantity)
+    {
+        auto it = index.find(string);
+        if (it == index.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        const auto& [value, unit] = it->second->second;
+        quantity = Quantity(value, unit);
+        return true;
+    }
+
+    void insert(const std::string& string, const Quantity& quantity)
+    {
+        if (entries.size() >= maxSize) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(string, std::make_pair(quantity.getValue(), quantity.getUnit()));
+        index.emplace(entries.front().first, entries.begin());
+    }
+
+private:
+    static constexpr std::size_t maxSize = 64;
+    using Entries = std::list<std::pair<std::string, std::pair<double, Unit>>>;
+    Entries entries;
+    // the keys refer to the strings of the entries
+    std::unordered_map<std::string_view, Entries::iterator> index;
+};
+
+ParseCache& parseCache()
+{
+    static ParseCache cache;
+    return cache;
+}
+
+}  // namespace
+
 Quantity Quantity::parse(const std::string& string)
 {
+    std::lock_guard<std::mutex> lock(parserMutex);
+    Quantity cached;
+    if (parseCache().find(string, cached)) {
+        return cached;
+    }
+
     // parse from buffer
     QuantityParser::YY_BUFFER_STATE my_string_buffer =
         QuantityParser::yy_scan_string(string.c_str());
@@ -564,5 +625,6 @@ Quantity Quantity::parse(const std::string& string)
     // run the parser
     QuantityParser::yyparse();
 
+    parseCache().insert(string, QuantResult);
     return QuantResult;
 }
@@ -24,10 +24,16 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <future>
 #include <map>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/sax2/Attributes.hpp>
 #endif
@@ -48,6 +54,7 @@
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -115,59 +122,90 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
-    return static_cast<unsigned int>(AttrMap.size());
+    return static_cast<unsigned int>(AttrCount);
+}
+
+const std::string* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    // elements have few attributes, so a linear search beats any map
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        if (AttrPool[i].name == AttrName) {
+            return &AttrPool[i].value;
+        }
+    }
+    return nullptr;
 }
 
 namespace
 {
 template<typename T>
-T readerCast(const char* value)
+T readerCast(const std::string& value)
 {
     if constexpr (std::is_same_v<T, const char*>) {
-        return value;
-    }
-    if constexpr (std::is_same_v<T, long>) {
-        return stol(value);
-    }
-    if constexpr (std::is_same_v<T, int>) {
-        return stoi(value);
-    }
-    if constexpr (std::is_same_v<T, unsigned long>) {
-        return stoul(value, nullptr);
-    }
-    if constexpr (std::is_same_v<T, double>) {
-        return stod(value, nullptr);
+        return value.c_str();
     }
     if constexpr (std::is_same_v<T, bool>) {
-        return std::string_view(value) != "0";
+        return value != "0";
+    }
+    if constexpr (!std::is_same_v<T, const char*> && !std::is_same_v<T, bool>) {
+        // from_chars neither allocates nor depends on the locale, anything it doesn't
+        // accept like leading white space or a plus sign goes the old way
+        T result {};
+        const char* last = value.data() + value.size();
+        if (std::from_chars(value.data(), last, result).ec == std::errc()) {
+            return result;
+        }
+        if constexpr (std::is_same_v<T, long>) {
+            return stol(value);
+        }
+        if constexpr (std::is_same_v<T, int>) {
+            return stoi(value);
+        }
+        if constexpr (std::is_same_v<T, unsigned long>) {
+            return stoul(value, nullptr);
+        }
+        if constexpr (std::is_same_v<T, double>) {
+            return stod(value, nullptr);
+        }
     }
 }
+
+// Copy a string of ASCII characters without transcoding, return false on any other character
+bool assignAscii(std::string& target, const XMLCh* str)
+{
+    target.clear();
+    for (; *str; ++str) {
+        if (*str >= 0x80) {
+            return false;
+        }
+        target.push_back(static_cast<char>(*str));
+    }
+    return true;
+}
 }  // anonymous namespace
 
 template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName, T defaultValue) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const std::string* value = findAttribute(AttrName);
+    if (!value) {
         return defaultValue;
     }
-    const char* rawValue = pos->second.c_str();
-    return readerCast<T>(rawValue);
+    return readerCast<T>(*value);
 }
 
 template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const std::string* value = findAttribute(AttrName);
+    if (!value) {
         // wrong name, use hasAttribute if not sure!
         std::string msg = std::string("XML Attribute: \"") + AttrName + "\" not found";
         throw Base::XMLAttributeError(msg);
     }
-    const char* rawValue = pos->second.c_str();
-    return readerCast<T>(rawValue);
+    return readerCast<T>(*value);
 }
 
 // Explicit template instantiation
@@ -195,7 +233,7 @@ Base::XMLReader::getAttribute<unsigned long>(const char* AttrName) const;
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
@@ -457,6 +495,31 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    // The files of objects with a decoder are read from the archive here and decoded by worker
+    // threads, their results are assigned in the order of the files. To limit the memory held by
+    // the read files, the oldest one is assigned once all threads are busy.
+    struct DecodedFile
+    {
+        std::string FileName;
+        std::future<std::function<void()>> Result;
+    };
+    std::deque<DecodedFile> decoding;
+    const std::size_t maxDecoding = std::max(2U, std::thread::hardware_concurrency());
+    auto assignDecoded = [this, &decoding]() {
+        DecodedFile file = std::move(decoding.front());
+        decoding.pop_front();
+        try {
+            auto assign = file.Result.get();
+            if (assign) {
+                assign();
+            }
+        }
+        catch (...) {
+            Base::Console().error("Reading failed from embedded file: %s\n", file.FileName.c_str());
+            FailedFiles.push_back(file.FileName);
+        }
+    };
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -469,11 +532,37 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
         if (jt != FileList.end()) {
+            std::shared_ptr<DeferredDocFile> deferred;
+            if (LazyArchive) {
+                deferred = std::make_shared<DeferredDocFile>(LazyArchive, jt->FileName, FileVersion);
+            }
             try {
-                Base::Reader reader(zipstream, jt->FileName, FileVersion);
-                jt->Object->RestoreDocFile(reader);
-                if (reader.getLocalReader()) {
-                    reader.getLocalReader()->readFiles(zipstream);
+                // In lazy mode the object reads the data later on from the archive
+                if (!deferred || !jt->Object->deferRestoreDocFile(deferred)) {
+                    Persistence::DocFileDecoder decoder = jt->Object->getDocFileDecoder();
+                    if (decoder) {
+                        std::string data(std::istreambuf_iterator<char>(zipstream), {});
+                        auto decode = [decoder = std::move(decoder),
+                                       data = std::move(data),
+                                       name = jt->FileName,
+                                       version = FileVersion]() mutable {
+                            std::istringstream str(std::move(data));
+                            Base::Reader reader(str, name, version);
+                            return decoder(reader);
+                        };
+                        decoding.push_back(
+                            {jt->FileName, std::async(std::launch::async, std::move(decode))});
+                        if (decoding.size() >= maxDecoding) {
+                            assignDecoded();
+                        }
+                    }
+                    else {
+                        Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                        jt->Object->RestoreDocFile(reader);
+                        if (reader.getLocalReader()) {
+                            reader.getLocalReader()->readFiles(zipstream);
+                        }
+                    }
                 }
             }
             catch (...) {
@@ -501,6 +590,10 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    while (!decoding.empty()) {
+        assignDecoded();
+    }
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
@@ -524,6 +617,11 @@ bool Base::XMLReader::hasReadFailed(const std::string& filename) const
     return std::ranges::find(FailedFiles, filename) != FailedFiles.end();
 }
 
+void Base::XMLReader::setLazyArchive(const std::shared_ptr<zipios::ZipFile>& archive)
+{
+    LazyArchive = archive;
+}
+
 bool Base::XMLReader::isRegistered(Base::Persistence* Object) const
 {
     if (Object) {
@@ -569,12 +667,23 @@ void Base::XMLReader::startElement(const XMLCh* const /*uri*/,
                                    const XERCES_CPP_NAMESPACE_QUALIFIER Attributes& attrs)
 {
     Level++;  // new scope
-    LocalName = StrX(localname).c_str();
+    if (!assignAscii(LocalName, localname)) {
+        LocalName = StrX(localname).c_str();
+    }
 
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    // saving attributes of the current scope, overwrite all previously stored ones
+    AttrCount = attrs.getLength();
+    if (AttrPool.size() < AttrCount) {
+        AttrPool.resize(AttrCount);
+    }
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        Attribute& attr = AttrPool[i];
+        if (!assignAscii(attr.name, attrs.getQName(i))) {
+            attr.name = StrX(attrs.getQName(i)).c_str();
+        }
+        if (!assignAscii(attr.value, attrs.getValue(i))) {
+            attr.value = StrXUTF8(attrs.getValue(i)).str;
+        }
     }
 
     ReadType = StartElement;
@@ -585,7 +694,9 @@ void Base::XMLReader::endElement(const XMLCh* const /*uri*/,
                                  const XMLCh* const /*qname*/)
 {
     Level--;  // end of scope
-    LocalName = StrX(localname).c_str();
+    if (!assignAscii(LocalName, localname)) {
+        LocalName = StrX(localname).c_str();
+    }
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -729,3 +840,77 @@ std::shared_ptr<Base::XMLReader> Base::Reader::getLocalReader() const
 {
     return (this->localreader);
 }
+
+// ----------------------------------------------------------
+
+Base::DeferredDocFile::DeferredDocFile(std::shared_ptr<zipios::ZipFile> archive,
+                                       std::string fileName,
+                                       int version)
+    : archive(std::move(archive))
+    , fileName(std::move(fileName))
+    , fileVersion(version)
+{}
+
+bool Base::DeferredDocFile::restore(const std::function<void(Reader&)>& restore) const
+{
+    try {
+        std::unique_ptr<std::istream> str(archive->getInputStream(fileName));
+        if (!str) {
+            throw Base::FileException("Missing embedded file", fileName);
+        }
+        Base::Reader reader(*str, fileName, fileVersion);
+        restore(reader);
+        return true;
+    }
+    catch (...) {
+        Base::Console().error("Reading failed from embedded file: %s\n", fileName.c_str());
+        return false;
+    }
+}
+
+const std::string& Base::DeferredDocFile::getFileName() const
+{
+    return fileName;
+}
+
+unsigned int Base::DeferredDocFile::getSize() const
+{
+    zipios::ConstEntryPointer entry = archive->getEntry(fileName);
+    return entry ? static_cast<unsigned int>(entry->getSize()) : 0;
+}
+
+// ---------------------------------------------------------------------------
+
+void Base::LazyDocFile::set(std::shared_ptr<DeferredDocFile> deferred)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    file = std::move(deferred);
+    pending = static_cast<bool>(file);
+}
+
+void Base::LazyDocFile::reset()
+{
+    set({});
+}
+
+bool Base::LazyDocFile::restore(const std::function<void(Reader&)>& restore)
+{
+    if (!pending.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (!file) {
+        return false;
+    }
+    auto deferred = std::move(file);
+    file.reset();
+    deferred->restore(restore);
+    pending.store(false, std::memory_order_release);
+    return true;
+}
+
+unsigned int Base::LazyDocFile::getSize() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return file ? file->getSize() : 0;
+}
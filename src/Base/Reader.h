@@ -23,9 +23,12 @@
 #ifndef SRC_BASE_READER_H_
 #define SRC_BASE_READER_H_
 
+#include <atomic>
 #include <bitset>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -39,6 +42,7 @@
 
 namespace zipios
 {
+class ZipFile;
 class ZipInputStream;
 }
 #ifndef XERCES_CPP_NAMESPACE_BEGIN
@@ -290,6 +294,12 @@ public:
     /// returns true if reading the file \a filename has failed
     bool hasReadFailed(const std::string& filename) const;
     bool isRegistered(Base::Persistence* Object) const;
+    /** Enable lazy restore of the data files
+     * If an archive is set, readFiles() doesn't read the data files of objects that support
+     * deferring (see Persistence::deferRestoreDocFile()) but hands them a DeferredDocFile that
+     * reads the member from \a archive when needed. The archive must be the one that is read.
+     */
+    void setLazyArchive(const std::shared_ptr<zipios::ZipFile>& archive);
     virtual void addName(const char*, const char*);
     virtual const char* getName(const char*) const;
     virtual bool doNameMapping() const;
@@ -366,8 +376,17 @@ private:
     unsigned int CharacterCount {0};
     std::streamsize CharacterOffset {-1};
 
-    std::map<std::string, std::string> AttrMap;
-    using AttrMapType = std::map<std::string, std::string>;
+    /// An attribute of the current element
+    struct Attribute
+    {
+        std::string name;
+        std::string value;
+    };
+    /// The attributes of the current element are the first AttrCount entries, the
+    /// strings are reused by the next elements to avoid allocations
+    std::vector<Attribute> AttrPool;
+    std::size_t AttrCount {0};
+    const std::string* findAttribute(const char* AttrName) const;
 
     enum
     {
@@ -399,6 +418,7 @@ public:
 
 private:
     mutable std::vector<std::string> FailedFiles;
+    std::shared_ptr<zipios::ZipFile> LazyArchive;
 
     std::bitset<32> StatusBits;
 
@@ -422,6 +442,65 @@ private:
     std::shared_ptr<Base::XMLReader> localreader;
 };
 
+/** The DeferredDocFile class
+ * Refers to a data file of a project archive whose restoring has been postponed by
+ * Persistence::deferRestoreDocFile(). The archive stays open as long as the object exists.
+ */
+class BaseExport DeferredDocFile
+{
+public:
+    DeferredDocFile(std::shared_ptr<zipios::ZipFile> archive, std::string fileName, int version);
+
+    /** Opens the data file and calls \a restore with a reader for it
+     * Errors are reported like in XMLReader::readFiles() and not passed on to the caller.
+     * @return true if the data has been restored without error.
+     */
+    bool restore(const std::function<void(Reader&)>& restore) const;
+    const std::string& getFileName() const;
+    /// The uncompressed size of the data file
+    unsigned int getSize() const;
+
+private:
+    std::shared_ptr<zipios::ZipFile> archive;
+    std::string fileName;
+    int fileVersion;
+};
+
+/** The LazyDocFile class
+ * Keeps the DeferredDocFile of a property until its data is accessed. The data is restored
+ * by the first thread that asks for it, the others wait until it is done, so the getters
+ * of a property may restore it even if they are called concurrently.
+ */
+class BaseExport LazyDocFile
+{
+public:
+    LazyDocFile() = default;
+
+    /// Postpone the restoring of \a file, or discard the pending file if null
+    void set(std::shared_ptr<DeferredDocFile> file);
+    /// Discard the pending file, e.g. because the property gets a new value
+    void reset();
+    /** Calls \a restore with a reader for the pending file, if any
+     * Only the first call restores the data, the file is discarded afterwards. A call
+     * from within \a restore returns immediately.
+     * @return true if this call has restored the data.
+     */
+    bool restore(const std::function<void(Reader&)>& restore);
+    /// The uncompressed size of the pending file, or 0 if there is none
+    unsigned int getSize() const;
+
+    LazyDocFile(const LazyDocFile&) = delete;
+    LazyDocFile(LazyDocFile&&) = delete;
+    LazyDocFile& operator=(const LazyDocFile&) = delete;
+    LazyDocFile& operator=(LazyDocFile&&) = delete;
+
+private:
+    std::shared_ptr<DeferredDocFile> file;
+    /// Checked without the lock, so that the getters don't lock once the data is there
+    std::atomic<bool> pending {false};
+    mutable std::recursive_mutex mutex;
+};
+
 }  // namespace Base
 
 
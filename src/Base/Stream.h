@@ -96,6 +96,24 @@ public:
 
     OutputStream& write(const char* s, int n);
 
+    /** Writes \a count numbers
+     * If the byte order of the stream is the one of the machine, they are written in one go.
+     */
+    template<typename T>
+    OutputStream& writeArray(const T* values, std::size_t count)
+    {
+        if (!isSwapped()) {
+            _out.write(reinterpret_cast<const char*>(values),  // NOLINT
+                       static_cast<std::streamsize>(count * sizeof(T)));
+        }
+        else {
+            for (std::size_t i = 0; i < count; i++) {
+                *this << values[i];
+            }
+        }
+        return *this;
+    }
+
     OutputStream(const OutputStream&) = delete;
     OutputStream(OutputStream&&) = delete;
     void operator=(const OutputStream&) = delete;
@@ -129,6 +147,24 @@ public:
 
     InputStream& read(char* s, int n);
 
+    /** Reads \a count numbers
+     * If the byte order of the stream is the one of the machine, they are read in one go.
+     */
+    template<typename T>
+    InputStream& readArray(T* values, std::size_t count)
+    {
+        if (!isSwapped()) {
+            _in.read(reinterpret_cast<char*>(values),  // NOLINT
+                     static_cast<std::streamsize>(count * sizeof(T)));
+        }
+        else {
+            for (std::size_t i = 0; i < count; i++) {
+                *this >> values[i];
+            }
+        }
+        return *this;
+    }
+
     explicit operator bool() const
     {
         // test if _Ipfx succeeded
@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <cassert>
+#include <utility>
 #endif
 
 #include "Type.h"
@@ -48,17 +49,22 @@ struct Base::TypeData
     TypeData(const char* name,
              const Type type,
              const Type parent,
-             const Type::instantiationMethod instMethod)
+             const Type::instantiationMethod instMethod,
+             std::vector<Type::TypeId> ancestors)
         : name(name)
         , parent(parent)
         , type(type)
         , instMethod(instMethod)
+        , ancestors(std::move(ancestors))
     {}
 
     const std::string name;
     const Type parent;
     const Type type;
     const Type::instantiationMethod instMethod;
+    /// The root type first and the type itself last. Types are only ever added below the
+    /// existing ones, so the ancestor at a given depth never changes.
+    const std::vector<Type::TypeId> ancestors;
 };
 
 namespace
@@ -146,7 +152,12 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
-    Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
+    std::vector<TypeId> ancestors;
+    if (!parent.isBad()) {
+        ancestors = typedata[parent.index]->ancestors;
+    }
+    ancestors.push_back(newType.index);
+    Type::typedata.emplace_back(new TypeData(name, newType, parent, method, std::move(ancestors)));
 
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
@@ -158,7 +169,8 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 void Type::init()
 {
     assert(Type::typedata.size() == 0 && "Type::init() should only be called once");
-    typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
+    typedata.emplace_back(
+        new TypeData(BadTypeName, BadType, BadType, nullptr, {BadType.getKey()}));
     typemap[BadTypeName] = 0;
 }
 
@@ -207,15 +219,10 @@ const Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
-
-    return false;
+    // a type is derived from the ancestor at the depth of \a type, if it is that deep
+    const std::vector<TypeId>& ancestors = typedata[index]->ancestors;
+    const std::size_t depth = typedata[type.index]->ancestors.size() - 1;
+    return depth < ancestors.size() && ancestors[depth] == type.index;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
@@ -105,7 +105,7 @@ public:
     [[nodiscard]] const char* getName() const;
     /// Returns the parent type
     [[nodiscard]] const Type getParent() const;
-    /// Checks whether this type is derived from "type"
+    /// Checks whether this type is derived from "type", takes constant time
     [[nodiscard]] bool isDerivedFrom(const Type type) const;
     /// Returns all descendants from the given type
     static int getAllDerivedFrom(const Type type, std::vector<Type>& list);
@@ -54,16 +54,19 @@ std::string
 UnitsSchema::translate(const Quantity& quant, double& factor, std::string& unitString) const
 {
     // Use defaults without schema-level translation.
-    factor = 1.0;
-    unitString = quant.getUnit().getString();
+    auto useDefaults = [&]() {
+        factor = 1.0;
+        unitString = quant.getUnit().getString();
+        return toLocale(quant, factor, unitString);
+    };
 
     if (spec.translationSpecs.empty()) {
-        return toLocale(quant, factor, unitString);
+        return useDefaults();
     }
 
-    const auto unitName = quant.getUnit().getTypeString();
-    if (!spec.translationSpecs.contains(unitName)) {
-        return toLocale(quant, factor, unitString);
+    const auto unitSpecs = spec.translationSpecs.find(quant.getUnit().getTypeString());
+    if (unitSpecs == spec.translationSpecs.end()) {
+        return useDefaults();
     }
 
     const auto value = quant.getValue();
@@ -71,14 +74,16 @@ UnitsSchema::translate(const Quantity& quant, double& factor, std::string& unitS
         return row.threshold > value || row.threshold == 0;  // zero indicates default
     };
 
-    auto unitSpecs = spec.translationSpecs.at(unitName);
-    const auto unitSpec = std::find_if(unitSpecs.begin(), unitSpecs.end(), isSuitable);
-    if (unitSpec == unitSpecs.end()) {
+    const auto& rows = unitSpecs->second;
+    const auto unitSpec = std::find_if(rows.begin(), rows.end(), isSuitable);
+    if (unitSpec == rows.end()) {
         throw RuntimeError("Suitable threshold not found. Schema: " + spec.name
                            + " value: " + std::to_string(value));
     }
 
     if (unitSpec->factor == 0) {
+        factor = 1.0;
+        unitString = quant.getUnit().getString();
         return UnitsSchemasData::runSpecial(unitSpec->unitString, value, factor, unitString);
     }
 
@@ -97,14 +102,21 @@ UnitsSchema::toLocale(const Quantity& quant, const double factor, const std::str
         Lc.setNumberOptions(static_cast<QLocale::NumberOptions>(format.option));
     }
 
-    auto valueString =
-        Lc.toString(quant.getValue() / factor, format.toFormat(), format.precision).toStdString();
+    const QByteArray valueString =
+        Lc.toString(quant.getValue() / factor, format.toFormat(), format.precision).toUtf8();
 
-    auto notUnit = [](auto s) {
+    auto notUnit = [](const std::string& s) {
         return s.empty() || s == "°" || s == "″" || s == "′" || s == "\"" || s == "'";
     };
 
-    return fmt::format("{}{}{}", valueString, notUnit(unitString) ? "" : " ", unitString);
+    std::string result;
+    result.reserve(valueString.size() + unitString.size() + 1);
+    result.append(valueString.constData(), valueString.size());
+    if (!notUnit(unitString)) {
+        result += ' ';
+    }
+    result += unitString;
+    return result;
 }
 
 bool UnitsSchema::isMultiUnitLength() const
@@ -23,8 +23,15 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <deque>
+#include <future>
 #include <memory>
 #include <set>
+#include <string_view>
+#include <thread>
 #include <vector>
 #include <string>
 #endif
@@ -43,7 +50,9 @@
 #include "Tools.h"
 
 #include <boost/iostreams/filtering_stream.hpp>
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
+#include <zlib.h>
 
 using namespace Base;
 
@@ -267,7 +276,7 @@ std::vector<std::string> Writer::getErrors() const
     return Errors;
 }
 
-std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
+std::string Writer::addFile(const char* Name, const Base::Persistence* Object, bool stored)
 {
     // always check isForceXML() before requesting a file!
     assert(!isForceXML());
@@ -278,6 +287,7 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
         temp.FileName = FileNameManager.makeUniqueName(temp.FileName);
     }
     temp.Object = Object;
+    temp.Stored = stored;
 
     FileList.push_back(temp);
     FileNameManager.addExactName(temp.FileName);
@@ -288,7 +298,7 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
 
 void Writer::incInd()
 {
-    if (indent < 1020) {
+    if (!compact && indent < 1020) {
         indBuf[indent] = ' ';
         indBuf[indent + 1] = ' ';
         indBuf[indent + 2] = ' ';
@@ -309,6 +319,69 @@ void Writer::decInd()
     indBuf[indent] = '\0';
 }
 
+void Writer::setCompact(bool on)
+{
+    compact = on;
+    if (compact) {
+        indent = 0;
+        indBuf[0] = '\0';
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const XMLNumber& num)
+{
+    // Anything the writers don't set up is left to the stream
+    const std::ios::fmtflags flags = os.flags();
+    if (os.width() != 0
+        || (flags & (std::ios::showpos | std::ios::showpoint | std::ios::uppercase)) != 0) {
+        return num.isInteger ? os << num.lValue : os << num.dValue;
+    }
+
+    // large enough for any double in fixed notation
+    std::array<char, 400> buf {};
+    std::to_chars_result res {};
+    res.ec = std::errc::not_supported;
+    if (num.isInteger) {
+        const std::ios::fmtflags base = flags & std::ios::basefield;
+        if (base == std::ios::dec || base == 0) {
+            res = std::to_chars(buf.data(), buf.data() + buf.size(), num.lValue);
+        }
+    }
+    else {
+        const auto precision = static_cast<int>(os.precision());
+        switch (flags & std::ios::floatfield) {
+            case std::ios::fixed:
+                res = std::to_chars(buf.data(),
+                                    buf.data() + buf.size(),
+                                    num.dValue,
+                                    std::chars_format::fixed,
+                                    precision);
+                break;
+            case std::ios::scientific:
+                res = std::to_chars(buf.data(),
+                                    buf.data() + buf.size(),
+                                    num.dValue,
+                                    std::chars_format::scientific,
+                                    precision);
+                break;
+            case std::ios::fmtflags(0):
+                res = std::to_chars(buf.data(),
+                                    buf.data() + buf.size(),
+                                    num.dValue,
+                                    std::chars_format::general,
+                                    precision);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (res.ec != std::errc()) {
+        return num.isInteger ? os << num.lValue : os << num.dValue;
+    }
+    return os.write(buf.data(), res.ptr - buf.data());
+}
+
 void Writer::putNextEntry(const char* file, const char* obj)
 {
     ObjectName = obj ? obj : file;
@@ -316,28 +389,104 @@ void Writer::putNextEntry(const char* file, const char* obj)
 
 // ----------------------------------------------------------------------------
 
-ZipWriter::ZipWriter(const char* FileName)
-    : ZipStream(FileName)
+namespace
+{
+
+void setupStream(std::ostream& str)
 {
 #ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
+    str.imbue(std::locale::empty());
 #else
-    ZipStream.imbue(std::locale::classic());
+    str.imbue(std::locale::classic());
 #endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    str.precision(std::numeric_limits<double>::digits10 + 1);
+    str.setf(std::ios::fixed, std::ios::floatfield);
+}
+
+// Size of the pieces a data file is split into to deflate it on several threads
+constexpr std::size_t deflateChunkSize = 1024 * 1024;
+// Each chunk is primed with the data preceding it so that the ratio doesn't suffer
+constexpr std::size_t deflateWindowSize = 32768;
+
+struct DeflatedChunk
+{
+    std::string data;
+    uLong crc {0};
+};
+
+// Deflates a chunk of the input into raw deflate blocks that can be concatenated with the
+// ones of the following chunks. Only the last chunk finishes the deflate stream. With level 0
+// only the checksum is computed because the entry is going to be stored.
+DeflatedChunk
+deflateChunk(const std::string& input, std::size_t offset, std::size_t size, int level, bool last)
+{
+    DeflatedChunk chunk;
+    auto begin = reinterpret_cast<const Bytef*>(input.data()) + offset;  // NOLINT
+    chunk.crc = crc32(crc32(0L, Z_NULL, 0), begin, static_cast<uInt>(size));
+    if (level == 0) {
+        return chunk;
+    }
+
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("ZipWriter: failed to initialize deflate stream");
+    }
+    if (offset > 0) {
+        std::size_t window = std::min(offset, deflateWindowSize);
+        deflateSetDictionary(&zs, begin - window, static_cast<uInt>(window));
+    }
+
+    // A sync flush ends the chunk on a byte boundary without marking its last block as final
+    const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+    chunk.data.resize(deflateBound(&zs, static_cast<uLong>(size)) + 16);
+    zs.next_in = const_cast<Bytef*>(begin);  // NOLINT
+    zs.avail_in = static_cast<uInt>(size);
+    std::size_t produced = 0;
+    int err = Z_OK;
+    do {
+        if (produced == chunk.data.size()) {
+            chunk.data.resize(2 * chunk.data.size());
+        }
+        zs.next_out = reinterpret_cast<Bytef*>(chunk.data.data()) + produced;  // NOLINT
+        zs.avail_out = static_cast<uInt>(chunk.data.size() - produced);
+        err = deflate(&zs, flush);
+        produced = chunk.data.size() - zs.avail_out;
+    } while (err == Z_OK && zs.avail_out == 0);
+    deflateEnd(&zs);
+
+    if (err != Z_OK && err != Z_STREAM_END) {
+        throw Base::RuntimeError("ZipWriter: failed to deflate data");
+    }
+    chunk.data.resize(produced);
+    return chunk;
+}
+
+}  // namespace
+
+struct ZipWriter::PendingEntry
+{
+    std::string FileName;
+    bool Stored {false};
+    // the chunks refer to the data, so they must be destroyed (i.e. waited for) first
+    std::unique_ptr<std::string> data;
+    std::vector<std::future<DeflatedChunk>> chunks;
+    // an unchanged file is copied from the previous archive, starting at the offset
+    const zipios::ZipCDirEntry* previous {nullptr};
+    std::streamoff previousOffset {0};
+};
+
+ZipWriter::ZipWriter(const char* FileName)
+    : ZipStream(FileName)
+{
+    setupStream(ZipStream);
+    setupStream(EntryBuffer);
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
     : ZipStream(os)
 {
-#ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
-#else
-    ZipStream.imbue(std::locale::classic());
-#endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    setupStream(ZipStream);
+    setupStream(EntryBuffer);
 }
 
 void ZipWriter::putNextEntry(const char* file, const char* obj)
@@ -349,19 +498,282 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     Writer::checkErrNo();
 }
 
+void ZipWriter::setPreviousArchive(const std::string& fileName, const EntryDigests& fileDigests)
+{
+    incremental = true;
+    previousArchive.reset();
+    previousStream.reset();
+    previousFileName = fileName;
+    previousDigests = fileDigests;
+    if (fileName.empty() || fileDigests.empty()) {
+        return;
+    }
+
+    try {
+        previousArchive = std::make_unique<zipios::ZipFile>(fileName);
+        previousStream =
+            std::make_unique<Base::ifstream>(FileInfo(fileName), std::ios::in | std::ios::binary);
+        if (!*previousStream) {
+            previousArchive.reset();
+            previousStream.reset();
+        }
+    }
+    catch (const std::exception&) {
+        previousArchive.reset();
+        previousStream.reset();
+    }
+}
+
 void ZipWriter::writeFiles()
 {
+    // the incremental mode needs the serialised files to compare them
+    if (parallel || incremental) {
+        writeFilesParallel();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        putNextEntry(entry.FileName.c_str());
-        indent = 0;
-        indBuf[0] = 0;
+        if (entry.Stored) {
+            // the header of a stored entry needs the size and checksum of its data
+            PendingEntry current;
+            current.FileName = entry.FileName;
+            current.Stored = true;
+            current.data = std::make_unique<std::string>(saveToBuffer(entry));
+            writeEntry(current);
+        }
+        else {
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+        }
+        changedFiles.push_back(entry.FileName);
+        index++;
+    }
+}
+
+std::string ZipWriter::saveToBuffer(const FileEntry& entry)
+{
+    Writer::putNextEntry(entry.FileName.c_str());
+    indent = 0;
+    indBuf[0] = 0;
+
+    buffering = true;
+    try {
         entry.Object->SaveDocFile(*this);
+    }
+    catch (...) {
+        buffering = false;
+        throw;
+    }
+    buffering = false;
+
+    std::string data = std::move(EntryBuffer).str();
+    EntryBuffer.str(std::string());
+    EntryBuffer.clear();
+    return data;
+}
+
+void ZipWriter::writeFilesParallel()
+{
+    // Limit the number of chunks in flight, this bounds both the number of threads and the
+    // memory held by serialised entries that are not yet written
+    const std::size_t maxPendingChunks = 2 * std::max(1U, std::thread::hardware_concurrency());
+    // Also bound the serialised data held back, a single entry may have few but large
+    // chunks. Without the parallel mode, i.e. only for the incremental mode, nothing is
+    // gained by holding entries back, so each one is written before the next is serialised.
+    const std::size_t maxPendingBytes = parallel ? maxPendingChunks * deflateChunkSize : 0;
+    // without the parallel mode the chunks are deflated when they are written
+    const auto launch = parallel ? std::launch::async : std::launch::deferred;
+
+    std::deque<PendingEntry> pending;
+    std::size_t pendingChunks = 0;
+    std::size_t pendingBytes = 0;
+    auto writeFront = [&]() {
+        pendingChunks -= pending.front().chunks.size();
+        if (pending.front().data) {
+            pendingBytes -= pending.front().data->size();
+        }
+        writeEntry(pending.front());
+        pending.pop_front();
+    };
+    auto writeOverflow = [&]() {
+        while (!pending.empty()
+               && (pendingChunks > maxPendingChunks || pendingBytes > maxPendingBytes)) {
+            writeFront();
+        }
+    };
+
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+
+        // Persistence::SaveDocFile() may need the main thread (e.g. for the thumbnail), so
+        // only the deflating is done on the worker threads
+        std::string data = saveToBuffer(entry);
+        EntryDigest digest {data.size(), std::hash<std::string_view> {}(data)};
+        digests[entry.FileName] = digest;
+
+        writeOverflow();
+
+        PendingEntry& current = pending.emplace_back();
+        current.FileName = entry.FileName;
+        current.Stored = entry.Stored;
+        current.previous = findPreviousEntry(entry, digest, current.previousOffset);
+        if (current.previous) {
+            index++;
+            continue;
+        }
+        changedFiles.push_back(entry.FileName);
+        current.data = std::make_unique<std::string>(std::move(data));
+
+        // the chunks of a stored entry only compute the checksum
+        const std::string& input = *current.data;
+        const int level = entry.Stored ? 0 : compressionLevel;
+        for (std::size_t offset = 0; offset < input.size(); offset += deflateChunkSize) {
+            if (current.chunks.size() >= maxPendingChunks) {
+                current.chunks[current.chunks.size() - maxPendingChunks].wait();
+            }
+            std::size_t size = std::min(deflateChunkSize, input.size() - offset);
+            current.chunks.push_back(std::async(launch,
+                                                deflateChunk,
+                                                std::cref(input),
+                                                offset,
+                                                size,
+                                                level,
+                                                offset + size == input.size()));
+        }
+        pendingChunks += current.chunks.size();
+        pendingBytes += input.size();
         index++;
     }
+
+    while (!pending.empty()) {
+        writeFront();
+    }
+}
+
+const zipios::ZipCDirEntry*
+ZipWriter::findPreviousEntry(const FileEntry& entry, const EntryDigest& digest, std::streamoff& offset)
+{
+    if (!previousArchive) {
+        return nullptr;
+    }
+    auto it = previousDigests.find(entry.FileName);
+    if (it == previousDigests.end() || !(it->second == digest)) {
+        return nullptr;
+    }
+
+    zipios::ConstEntryPointer pointer = previousArchive->getEntry(entry.FileName);
+    auto previous = dynamic_cast<const zipios::ZipCDirEntry*>(pointer.get());
+    if (!previous || previous->getSize() != digest.size) {
+        return nullptr;
+    }
+    // keep the promise of stored entries, they are read in place
+    bool store = entry.Stored || compressionLevel == 0;
+    if (store && previous->getMethod() != zipios::STORED) {
+        return nullptr;
+    }
+    if (previous->getMethod() != zipios::STORED && previous->getMethod() != zipios::DEFLATED) {
+        return nullptr;
+    }
+
+    // The data follows the local header, which has a name and extra field of its own
+    constexpr int localHeaderSize = 30;
+    std::array<unsigned char, localHeaderSize> header {};
+    previousStream->clear();
+    previousStream->seekg(previous->getLocalHeaderOffset());
+    previousStream->read(reinterpret_cast<char*>(header.data()), localHeaderSize);  // NOLINT
+    auto readShort = [&header](int pos) {
+        return header[pos] | (header[pos + 1] << 8);  // NOLINT
+    };
+    if (!*previousStream || readShort(0) != 0x4b50 || readShort(2) != 0x0403) {
+        return nullptr;
+    }
+    offset = static_cast<std::streamoff>(previous->getLocalHeaderOffset()) + localHeaderSize
+        + readShort(26) + readShort(28);
+    return previous;
+}
+
+void ZipWriter::copyPreviousEntry(const PendingEntry& entry)
+{
+    const zipios::ZipCDirEntry& previous = *entry.previous;
+    zipios::ZipCDirEntry zipEntry(entry.FileName);
+    zipEntry.setMethod(previous.getMethod());
+    zipEntry.setCrc(previous.getCrc());
+    zipEntry.setSize(previous.getSize());
+    zipEntry.setCompressedSize(previous.getCompressedSize());
+    ZipStream.putRawEntry(zipEntry, entry.Stored ? storedAlignment : 1);
+
+    constexpr std::size_t blockSize = 1024 * 1024;
+    std::vector<char> block(blockSize);
+    std::size_t remaining = previous.getCompressedSize();
+    previousStream->clear();
+    previousStream->seekg(entry.previousOffset);
+    while (remaining > 0) {
+        std::size_t size = std::min(blockSize, remaining);
+        previousStream->read(block.data(), static_cast<std::streamsize>(size));
+        if (!*previousStream) {
+            throw Base::FileException("ZipWriter: failed to copy unchanged data file",
+                                      FileInfo(previousFileName));
+        }
+        ZipStream.writeRawData(block.data(), static_cast<std::streamsize>(size));
+        remaining -= size;
+    }
+
+    Writer::checkErrNo();
+}
+
+void ZipWriter::writeEntry(PendingEntry& entry)
+{
+    if (entry.previous) {
+        copyPreviousEntry(entry);
+        return;
+    }
+
+    const std::string& data = *entry.data;
+    std::vector<DeflatedChunk> chunks;
+    chunks.reserve(entry.chunks.size());
+
+    uLong crc = crc32(0L, Z_NULL, 0);
+    std::size_t offset = 0;
+    std::size_t compressedSize = 0;
+    for (auto& future : entry.chunks) {
+        DeflatedChunk& chunk = chunks.emplace_back(future.get());
+        std::size_t size = std::min(deflateChunkSize, data.size() - offset);
+        crc = crc32_combine(crc, chunk.crc, static_cast<z_off_t>(size));
+        compressedSize += chunk.data.size();
+        offset += size;
+    }
+    if (entry.chunks.empty()) {
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(data.data()),  // NOLINT
+                    static_cast<uInt>(data.size()));
+    }
+
+    // already dense data doesn't shrink, store it instead
+    bool store = entry.Stored || compressionLevel == 0 || compressedSize >= data.size();
+
+    zipios::ZipCDirEntry zipEntry(entry.FileName);
+    zipEntry.setMethod(store ? zipios::STORED : zipios::DEFLATED);
+    zipEntry.setCrc(static_cast<zipios::uint32>(crc));
+    zipEntry.setSize(static_cast<zipios::uint32>(data.size()));
+    zipEntry.setCompressedSize(static_cast<zipios::uint32>(store ? data.size() : compressedSize));
+    ZipStream.putRawEntry(zipEntry, entry.Stored ? storedAlignment : 1);
+    if (store) {
+        ZipStream.writeRawData(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+    else {
+        for (const auto& chunk : chunks) {
+            ZipStream.writeRawData(chunk.data.data(),
+                                   static_cast<std::streamsize>(chunk.data.size()));
+        }
+    }
+
+    Writer::checkErrNo();
 }
 
 ZipWriter::~ZipWriter()
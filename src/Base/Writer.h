@@ -24,6 +24,7 @@
 #define SRC_BASE_WRITER_H_
 
 
+#include <map>
 #include <set>
 #include <string>
 #include <sstream>
@@ -37,6 +38,11 @@
 #include "FileInfo.h"
 
 
+namespace zipios
+{
+class ZipFile;
+}
+
 namespace Base
 {
 
@@ -93,8 +99,12 @@ public:
 
     /** @name additional file writing */
     //@{
-    /// add a write request of a persistent object
-    std::string addFile(const char* Name, const Base::Persistence* Object);
+    /** add a write request of a persistent object
+     * If \a stored is true, an archive keeps the file uncompressed and aligned to
+     * storedAlignment bytes, so that big binary data can be read without inflating it.
+     */
+    std::string addFile(const char* Name, const Base::Persistence* Object, bool stored = false);
+    static constexpr int storedAlignment = 64;
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// Set mode
@@ -131,6 +141,15 @@ public:
     void incInd();
     /// decrease indentation by one tab
     void decInd();
+    /** Switch off the indentation
+     * In compact mode ind() is always empty, which makes big documents smaller
+     * and faster to write. Readers don't care about the indentation.
+     */
+    void setCompact(bool on);
+    bool isCompact() const
+    {
+        return compact;
+    }
     //@}
 
     virtual std::ostream& Stream() = 0;
@@ -167,6 +186,7 @@ protected:
     {
         std::string FileName;
         const Base::Persistence* Object;
+        bool Stored {false};
     };
     std::vector<FileEntry> FileList;
     UniqueFileNameManager FileNameManager;
@@ -175,6 +195,7 @@ protected:
 
     short indent {0};
     char indBuf[1024] {};
+    bool compact {false};
 
     bool forceXML {false};
     int fileVersion {1};
@@ -192,6 +213,39 @@ private:
 };
 
 
+/** A number written to a stream by std::to_chars
+ * It gives the same text as operator<< with the format flags and precision of
+ * the stream, i.e. those set up by the writers, but doesn't go through the
+ * locale facets of the stream. Like the XML readers it assumes the classic locale.
+ * \code
+ * writer.Stream() << writer.ind() << "<Float value=\"" << XMLNumber(value) << "\"/>" << '\n';
+ * \endcode
+ */
+class BaseExport XMLNumber
+{
+public:
+    explicit XMLNumber(double value)
+        : dValue(value)
+    {}
+    explicit XMLNumber(long value)
+        : lValue(value)
+        , isInteger(true)
+    {}
+    explicit XMLNumber(int value)
+        : XMLNumber(static_cast<long>(value))
+    {}
+
+    friend BaseExport std::ostream& operator<<(std::ostream& os, const XMLNumber& num);
+
+private:
+    double dValue {0.0};
+    long lValue {0};
+    bool isInteger {false};
+};
+
+BaseExport std::ostream& operator<<(std::ostream& os, const XMLNumber& num);
+
+
 /** The ZipWriter class
  * This is an important helper class implementation for the store and retrieval system
  * of persistent objects in FreeCAD.
@@ -209,6 +263,9 @@ public:
 
     std::ostream& Stream() override
     {
+        if (buffering) {
+            return EntryBuffer;
+        }
         return ZipStream;
     }
 
@@ -218,17 +275,84 @@ public:
     }
     void setLevel(int level)
     {
+        compressionLevel = level;
         ZipStream.setLevel(level);
     }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
+    /** Switch writeFiles() into parallel mode
+     * The data files are still serialised one after another on the calling thread, but into
+     * memory. Their content is split into chunks that are deflated on worker threads while
+     * the next files are serialised, and the entries are written in order once their chunks
+     * are done. With level 0 the entries are stored, and so is any entry that doesn't shrink
+     * when deflated. Files added as stored are never deflated in either mode.
+     */
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
+
+    /// Size and hash of the uncompressed content of a data file
+    struct EntryDigest
+    {
+        std::size_t size {0};
+        std::size_t hash {0};
+
+        bool operator==(const EntryDigest& other) const
+        {
+            return size == other.size && hash == other.hash;
+        }
+    };
+    using EntryDigests = std::map<std::string, EntryDigest>;
+
+    /** Copy unchanged data files from a previous archive
+     * The data files are serialised into memory and hashed. A file whose digest matches the
+     * one recorded in \a digests for the same entry of the archive \a fileName is copied from
+     * there as compressed data instead of being deflated again. The archive must not be the
+     * file that is being written. If it can't be opened every file is written anew.
+     */
+    void setPreviousArchive(const std::string& fileName, const EntryDigests& digests);
+    /// The digests of the data files written so far, to pass to the next save
+    const EntryDigests& getDigests() const
+    {
+        return digests;
+    }
+    /// The data files that were serialised anew instead of being copied
+    const std::vector<std::string>& getChangedFiles() const
+    {
+        return changedFiles;
+    }
+
     ZipWriter(const ZipWriter&) = delete;
     ZipWriter(ZipWriter&&) = delete;
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
 private:
+    struct PendingEntry;
+    void writeFilesParallel();
+    std::string saveToBuffer(const FileEntry& entry);
+    void writeEntry(PendingEntry& entry);
+    const zipios::ZipCDirEntry*
+    findPreviousEntry(const FileEntry& entry, const EntryDigest& digest, std::streamoff& offset);
+    void copyPreviousEntry(const PendingEntry& entry);
+
     zipios::ZipOutputStream ZipStream;
+    std::ostringstream EntryBuffer;
+    int compressionLevel {zipios::ZipOutputStreambuf::DEFAULT_COMPRESSION};
+    bool parallel {false};
+    bool buffering {false};
+    bool incremental {false};
+    std::unique_ptr<zipios::ZipFile> previousArchive;
+    std::unique_ptr<std::istream> previousStream;
+    std::string previousFileName;
+    EntryDigests previousDigests;
+    EntryDigests digests;
+    std::vector<std::string> changedFiles;
 };
 
 /** The StringWriter class
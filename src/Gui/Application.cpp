@@ -2310,10 +2310,12 @@ void Application::runApplication()
 
     StartupProcess process;
     process.execute();
+    App::Application::addStartupPhase("Create Qt application");
 
     Application app(true);
     MainWindow mw;
     mw.setProperty("QuitOnClosed", true);
+    App::Application::addStartupPhase("Create main window");
 
     // https://forum.freecad.org/viewtopic.php?f=3&t=15540
     // Needs to be set after app is created to override platform defaults (qt commit a2aa1f81a81)
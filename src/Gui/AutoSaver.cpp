@@ -184,6 +184,8 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                 // So, always force binary format because ASCII
                 // is not reentrant. See PropertyPartShape::SaveDocFile
                 writer.setMode("BinaryBrep");
+                // the recovery files are plain files, raw kernels are read back in one go
+                writer.setMode("RawKernel");
 
                 writer.putNextEntry("Document.xml");
 
@@ -206,6 +208,8 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                     Base::ZipWriter writer(file);
                     if (hGrp->GetBool("SaveBinaryBrep", true))
                         writer.setMode("BinaryBrep");
+                    if (hGrp->GetBool("SaveRawKernels", false))
+                        writer.setMode("RawKernel");
 
                     writer.setComment("AutoRecovery file");
                     writer.setLevel(1); // apparently the fastest compression
@@ -55,6 +55,7 @@
 #include "FileDialog.h"
 #include "MainWindow.h"
 #include "Selection.h"
+#include "Dialogs/DlgMemoryReport.h"
 #include "Dialogs/DlgObjectSelection.h"
 #include "Dialogs/DlgProjectInformationImp.h"
 #include "Dialogs/DlgProjectUtility.h"
@@ -637,6 +638,35 @@ bool StdCmdExportDependencyGraph::isActive()
     return (getActiveGuiDocument() ? true : false);
 }
 
+//===========================================================================
+// Std_MemoryReport
+//===========================================================================
+
+DEF_STD_CMD_A(StdCmdMemoryReport)
+
+StdCmdMemoryReport::StdCmdMemoryReport()
+  : Command("Std_MemoryReport")
+{
+    sGroup        = "Tools";
+    sMenuText     = QT_TR_NOOP("&Memory usage...");
+    sToolTipText  = QT_TR_NOOP("Show the estimated memory usage of the objects in the active document");
+    sStatusTip    = QT_TR_NOOP("Show the estimated memory usage of the objects in the active document");
+    sWhatsThis    = "Std_MemoryReport";
+    eType         = 0;
+}
+
+void StdCmdMemoryReport::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+    Gui::Dialog::DlgMemoryReport dlg(getActiveGuiDocument(), getMainWindow());
+    dlg.exec();
+}
+
+bool StdCmdMemoryReport::isActive()
+{
+    return (getActiveGuiDocument() ? true : false);
+}
+
 //===========================================================================
 // Std_New
 //===========================================================================
@@ -1993,6 +2023,7 @@ void CreateDocCommands()
     rcCmdMgr.addCommand(new StdCmdMergeProjects());
     rcCmdMgr.addCommand(new StdCmdDependencyGraph());
     rcCmdMgr.addCommand(new StdCmdExportDependencyGraph());
+    rcCmdMgr.addCommand(new StdCmdMemoryReport());
 
     rcCmdMgr.addCommand(new StdCmdSave());
     rcCmdMgr.addCommand(new StdCmdSaveAs());
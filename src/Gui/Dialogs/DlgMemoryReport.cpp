@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QDialogButtonBox>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+#endif
+
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+
+#include "Dialogs/DlgMemoryReport.h"
+#include "Document.h"
+#include "ViewProvider.h"
+
+
+using namespace Gui::Dialog;
+
+namespace {
+
+// sorts by the number of bytes instead of the formatted text
+class SizeItem : public QTreeWidgetItem
+{
+public:
+    SizeItem(const QString& name, std::size_t size)
+    {
+        setText(0, name);
+        setData(1, Qt::UserRole, QVariant::fromValue<qulonglong>(size));
+        setText(1, QLocale().formattedDataSize(static_cast<qint64>(size)));
+        setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+    }
+
+    bool operator<(const QTreeWidgetItem& other) const override
+    {
+        int column = treeWidget() ? treeWidget()->sortColumn() : 0;
+        if (column == 1) {
+            return data(1, Qt::UserRole).toULongLong() < other.data(1, Qt::UserRole).toULongLong();
+        }
+        return QTreeWidgetItem::operator<(other);
+    }
+};
+
+}
+
+/* TRANSLATOR Gui::Dialog::DlgMemoryReport */
+
+DlgMemoryReport::DlgMemoryReport(Gui::Document* doc, QWidget* parent)
+  : QDialog(parent)
+  , document(doc)
+  , tree(new QTreeWidget(this))
+  , total(new QLabel(this))
+{
+    QString label = QString::fromUtf8(doc->getDocument()->Label.getValue());
+    setWindowTitle(tr("Memory usage of %1").arg(label));
+    resize(600, 500);
+
+    tree->setColumnCount(2);
+    tree->setHeaderLabels({tr("Item"), tr("Size")});
+    tree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    tree->header()->setStretchLastSection(false);
+    tree->setSortingEnabled(true);
+
+    auto buttons = new QDialogButtonBox(QDialogButtonBox::Close, this);
+    auto refreshButton = buttons->addButton(tr("Refresh"), QDialogButtonBox::ActionRole);
+    connect(refreshButton, &QPushButton::clicked, this, &DlgMemoryReport::refresh);
+    connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+    auto layout = new QVBoxLayout(this);
+    layout->addWidget(total);
+    layout->addWidget(tree);
+    layout->addWidget(buttons);
+
+    refresh();
+}
+
+DlgMemoryReport::~DlgMemoryReport() = default;
+
+void DlgMemoryReport::refresh()
+{
+    tree->clear();
+    tree->setSortingEnabled(false);
+
+    App::Document* doc = document->getDocument();
+    auto report = doc->getMemoryReport();
+    std::size_t sceneGraphs = 0;
+    for (const auto& entry : report.objects) {
+        App::DocumentObject* obj = entry.object;
+        QString name = QStringLiteral("%1 (%2)").arg(QString::fromUtf8(obj->Label.getValue()),
+                                                      QString::fromUtf8(obj->getNameInDocument()));
+
+        auto props = new SizeItem(tr("Properties"), entry.total);
+        for (const auto& prop : entry.properties) {
+            if (prop.second > 0) {
+                props->addChild(new SizeItem(QString::fromUtf8(prop.first.c_str()), prop.second));
+            }
+        }
+
+        std::size_t size = entry.total;
+        QTreeWidgetItem* sceneGraph = nullptr;
+        if (auto vp = document->getViewProvider(obj)) {
+            std::size_t nodes = vp->getSceneGraphMemSize();
+            sceneGraph = new SizeItem(tr("Scene graph"), nodes);
+            size += nodes;
+            sceneGraphs += nodes;
+        }
+
+        auto item = new SizeItem(name, size);
+        item->addChild(props);
+        if (sceneGraph) {
+            item->addChild(sceneGraph);
+        }
+        tree->addTopLevelItem(item);
+    }
+
+    tree->addTopLevelItem(new SizeItem(tr("Document properties"), report.properties));
+    tree->addTopLevelItem(new SizeItem(tr("String hasher"), report.hasher));
+    tree->addTopLevelItem(new SizeItem(tr("Undo/Redo (%1 steps)")
+        .arg(doc->getAvailableUndos() + doc->getAvailableRedos()), report.undo));
+
+    tree->setSortingEnabled(true);
+    tree->sortByColumn(1, Qt::DescendingOrder);
+
+    QLocale locale;
+    total->setText(tr("Total: %1, thereof %2 in scene graphs")
+        .arg(locale.formattedDataSize(static_cast<qint64>(report.total + sceneGraphs)),
+             locale.formattedDataSize(static_cast<qint64>(sceneGraphs))));
+}
+
+#include "moc_DlgMemoryReport.cpp"
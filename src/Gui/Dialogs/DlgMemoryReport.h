@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef GUI_DIALOG_DLGMEMORYREPORT_H
+#define GUI_DIALOG_DLGMEMORYREPORT_H
+
+#include <QDialog>
+
+class QLabel;
+class QTreeWidget;
+
+namespace Gui {
+class Document;
+
+namespace Dialog {
+
+/**
+ * Shows the estimated memory consumption of a document, broken down by
+ * object, property and scene graph of the view providers, the string hasher
+ * and the Undo/Redo stack.
+ */
+class DlgMemoryReport : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit DlgMemoryReport(Gui::Document* doc, QWidget* parent = nullptr);
+    ~DlgMemoryReport() override;
+
+private:
+    void refresh();
+
+private:
+    Gui::Document* document;
+    QTreeWidget* tree;
+    QLabel* total;
+};
+
+} // namespace Dialog
+} // namespace Gui
+
+#endif // GUI_DIALOG_DLGMEMORYREPORT_H
@@ -24,17 +24,50 @@
 
 #ifndef _PreComp_
 #include <QAction>
+#include <QCoreApplication>
 #include <QList>
+#include <QLocale>
 #endif
 
+#include <App/Document.h>
+
 #include "Dialogs/DlgUndoRedo.h"
 #include "Application.h"
+#include "Document.h"
 #include "MainWindow.h"
 #include "MDIView.h"
 
 
 using namespace Gui::Dialog;
 
+namespace
+{
+
+// shows the memory each step of the document occupies
+void addMemoryToolTips(QMenu* menu, Gui::MDIView* mdi, bool undo)
+{
+    Gui::Document* guiDoc = mdi->getGuiDocument();
+    if (!guiDoc) {
+        return;
+    }
+    App::Document* doc = guiDoc->getDocument();
+    QList<QAction*> acts = menu->actions();
+    std::size_t count = undo ? doc->getAvailableUndoNames().size()
+                             : doc->getAvailableRedoNames().size();
+    if (static_cast<std::size_t>(acts.size()) != count) {
+        // the view has its own undo stack
+        return;
+    }
+    for (int i = 0; i < acts.size(); i++) {
+        auto size = static_cast<qint64>(doc->getTransactionMemSize(undo, i));
+        acts[i]->setToolTip(QCoreApplication::translate("Gui::Dialog::UndoDialog", "Memory: %1")
+                                .arg(menu->locale().formattedDataSize(size)));
+    }
+    menu->setToolTipsVisible(true);
+}
+
+}  // namespace
+
 /* TRANSLATOR Gui::Dialog::UndoRedoDialog */
 
 /**
@@ -66,6 +99,7 @@ void UndoDialog::onFetchInfo()
         for (QStringList::Iterator i = vecUndos.begin(); i != vecUndos.end(); ++i) {
             addAction(*i, this, &UndoDialog::onSelected);
         }
+        addMemoryToolTips(this, mdi, true);
     }
 }
 
@@ -112,6 +146,7 @@ void RedoDialog::onFetchInfo()
         for (QStringList::Iterator i = vecRedos.begin(); i != vecRedos.end(); ++i) {
             addAction(*i, this, &RedoDialog::onSelected);
         }
+        addMemoryToolTips(this, mdi, false);
     }
 }
 
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <tuple>
 # include <memory>
 # include <list>
@@ -119,9 +120,12 @@ struct DocumentP
     std::map<SoSeparator *,ViewProviderDocumentObject*> _CoinMap;
     std::map<std::string,ViewProvider*> _ViewProviderMapAnnotation;
     std::list<ViewProviderDocumentObject*> _redoViewProviders;
+    /// View providers of an App::Document::ObjectBatch, not added to the views yet
+    std::vector<ViewProvider*> _batchedViewProviders;
 
     using Connection = boost::signals2::connection;
     Connection connectNewObject;
+    Connection connectNewObjects;
     Connection connectDelObject;
     Connection connectCngObject;
     Connection connectRenObject;
@@ -453,6 +457,8 @@ Document::Document(App::Document* pcDocument,Application * app)
     // Setup the connections
     d->connectNewObject = pcDocument->signalNewObject.connect
         (std::bind(&Gui::Document::slotNewObject, this, sp::_1));
+    d->connectNewObjects = pcDocument->signalNewObjects.connect
+        (std::bind(&Gui::Document::slotNewObjects, this, sp::_1));
     d->connectDelObject = pcDocument->signalDeletedObject.connect
         (std::bind(&Gui::Document::slotDeletedObject, this, sp::_1));
     d->connectCngObject = pcDocument->signalChangedObject.connect
@@ -507,6 +513,14 @@ Document::Document(App::Document* pcDocument,Application * app)
     //NOLINTEND
 
     pcDocument->setPreRecomputeHook([this] { callSignalBeforeRecompute(); });
+    // deliver the notifications of an asynchronous recompute in the GUI thread
+    pcDocument->setMainThreadHook([name = std::string(pcDocument->getName())] {
+        QMetaObject::invokeMethod(qApp, [name] {
+            if (auto doc = App::GetApplication().getDocument(name.c_str())) {
+                doc->processRecomputeNotifications();
+            }
+        }, Qt::QueuedConnection);
+    });
 
     // pointer to the python class
     // NOTE: As this Python object doesn't get returned to the interpreter we
@@ -519,6 +533,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // and the memory budget in MB, which must fit into an unsigned int
+        long undoMemory = std::clamp<long>(hGrp->GetInt("MaxUndoMemory",0), 0, 4095);
+        d->_pcDocument->setUndoLimit(static_cast<unsigned int>(undoMemory) * 1024U * 1024U);
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -529,6 +546,7 @@ Document::~Document()
     // disconnect everything to avoid to be double-deleted
     // in case an exception is raised somewhere
     d->connectNewObject.disconnect();
+    d->connectNewObjects.disconnect();
     d->connectDelObject.disconnect();
     d->connectCngObject.disconnect();
     d->connectRenObject.disconnect();
@@ -966,12 +984,19 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
     }
 
     if (pcProvider) {
-        std::list<Gui::BaseView*>::iterator vIt;
-        // cycling to all views of the document
-        for (vIt = d->baseViews.begin();vIt != d->baseViews.end();++vIt) {
-            auto activeView = dynamic_cast<View3DInventor *>(*vIt);
-            if (activeView)
-                activeView->getViewer()->addViewProvider(pcProvider);
+        bool batching = Obj.getDocument()->isBatchingObjects();
+        if (batching) {
+            // added to the views at once by slotNewObjects()
+            d->_batchedViewProviders.push_back(pcProvider);
+        }
+        else {
+            std::list<Gui::BaseView*>::iterator vIt;
+            // cycling to all views of the document
+            for (vIt = d->baseViews.begin();vIt != d->baseViews.end();++vIt) {
+                auto activeView = dynamic_cast<View3DInventor *>(*vIt);
+                if (activeView)
+                    activeView->getViewer()->addViewProvider(pcProvider);
+            }
         }
 
         // adding to the tree
@@ -979,13 +1004,30 @@ void Document::slotNewObject(const App::DocumentObject& Obj)
         pcProvider->pcDocument = this;
 
         // it is possible that a new viewprovider already claims children
-        handleChildren3D(pcProvider);
+        if (!batching)
+            handleChildren3D(pcProvider);
         if (d->_isTransacting) {
             d->_redoViewProviders.push_back(pcProvider);
         }
     }
 }
 
+void Document::slotNewObjects(const std::vector<App::DocumentObject*>&)
+{
+    std::vector<ViewProvider*> providers;
+    providers.swap(d->_batchedViewProviders);
+
+    for (auto view : d->baseViews) {
+        auto activeView = dynamic_cast<View3DInventor *>(view);
+        if (activeView)
+            activeView->getViewer()->addViewProviders(providers);
+    }
+
+    // all objects of the batch exist now, so that every claimed child is found
+    for (auto pcProvider : providers)
+        handleChildren3D(pcProvider);
+}
+
 void Document::slotDeletedObject(const App::DocumentObject& Obj)
 {
     std::list<Gui::BaseView*>::iterator vIt;
@@ -996,6 +1038,11 @@ void Document::slotDeletedObject(const App::DocumentObject& Obj)
     if(!viewProvider)
         return;
 
+    auto batched = std::find(d->_batchedViewProviders.begin(),
+                             d->_batchedViewProviders.end(), viewProvider);
+    if (batched != d->_batchedViewProviders.end())
+        d->_batchedViewProviders.erase(batched);
+
     if (d->_editViewProvider==viewProvider || d->_editViewProviderParent==viewProvider)
         _resetEdit();
     else if(Application::Instance->editDocument()) {
@@ -77,6 +77,8 @@ protected:
     //@{
     /// This slot is connected to the App::Document::signalNewObject(...)
     void slotNewObject(const App::DocumentObject&);
+    /// This slot is connected to the App::Document::signalNewObjects(...)
+    void slotNewObjects(const std::vector<App::DocumentObject*>&);
     void slotDeletedObject(const App::DocumentObject&);
     void slotChangedObject(const App::DocumentObject&, const App::Property&);
     void slotRelabelObject(const App::DocumentObject&);
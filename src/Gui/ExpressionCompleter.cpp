@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <unordered_map>
 #include <boost/algorithm/string/predicate.hpp>
 #include <QAbstractItemView>
 #include <QContextMenuEvent>
@@ -55,16 +56,40 @@ public:
     ExpressionCompleterModel(QObject* parent, bool noProperty)
         : QAbstractItemModel(parent)
         , noProperty(noProperty)
-    {}
+    {
+        // keep the cached names and labels in sync with the documents, see invalidate()
+        auto& app = App::GetApplication();
+        auto onDocument = [this](const App::Document&) {
+            invalidate();
+        };
+        auto onObject = [this](const App::DocumentObject&) {
+            invalidate();
+        };
+        auto onProperty = [this](const App::Property&) {
+            invalidate();
+        };
+        connections.emplace_back(app.signalNewDocument.connect([this](const App::Document&, bool) {
+            invalidate();
+        }));
+        connections.emplace_back(app.signalDeleteDocument.connect(onDocument));
+        connections.emplace_back(app.signalRelabelDocument.connect(onDocument));
+        connections.emplace_back(app.signalNewObject.connect(onObject));
+        connections.emplace_back(app.signalDeletedObject.connect(onObject));
+        connections.emplace_back(app.signalRelabelObject.connect(onObject));
+        connections.emplace_back(app.signalAppendDynamicProperty.connect(onProperty));
+        connections.emplace_back(app.signalRemoveDynamicProperty.connect(onProperty));
+    }
 
     void setNoProperty(bool enabled)
     {
         noProperty = enabled;
+        clearCache();
     }
 
     void setDocumentObject(const App::DocumentObject* obj, bool checkInList)
     {
         beginResetModel();
+        clearCache();
         if (obj) {
             currentDoc = obj->getDocument()->getName();
             currentObj = obj->getNameInDocument();
@@ -264,6 +289,65 @@ public:
         return variant;
     }
 
+    // The QCompleter filters by calling data() on every row, so the documents, the properties
+    // of the current object and the texts of the object items are cached. The texts are only
+    // built for the rows that are actually asked for.
+    void clearCache()
+    {
+        cacheValid = false;
+        docsCache.clear();
+        currentDocCache = nullptr;
+        propsCache.clear();
+        objectTexts.clear();
+    }
+
+    void invalidate()
+    {
+        if (!cacheValid) {
+            return;
+        }
+        beginResetModel();
+        clearCache();
+        endResetModel();
+    }
+
+    void updateCache() const
+    {
+        if (cacheValid) {
+            return;
+        }
+        cacheValid = true;
+        docsCache = App::GetApplication().getDocuments();
+        currentDocCache = App::GetApplication().getDocument(currentDoc.c_str());
+        propsCache.clear();
+        if (currentDocCache && !noProperty) {
+            if (auto cobj = currentDocCache->getObject(currentObj.c_str())) {
+                cobj->getPropertyNamedList(propsCache);
+            }
+        }
+    }
+
+    // even index gives the object's name, odd index its quoted label
+    const QString& objectText(App::Document* doc, int idx) const
+    {
+        const auto& objs = doc->getObjects();
+        auto& texts = objectTexts[doc];
+        if (texts.size() != objs.size() * 2) {
+            texts.assign(objs.size() * 2, QString());
+        }
+        QString& text = texts[idx];
+        if (text.isNull()) {
+            auto obj = objs[idx / 2];
+            if (idx & 1) {
+                text = QString::fromUtf8(quote(obj->Label.getStrValue()).c_str());
+            }
+            else {
+                text = QString::fromLatin1(obj->getNameInDocument());
+            }
+        }
+        return text;
+    }
+
     static std::vector<App::ObjectIdentifier> retrieveSubPaths(const App::Property* prop)
     {
         std::vector<App::ObjectIdentifier> result;
@@ -301,7 +385,8 @@ public:
         // identify the document index. For any children of the root, it is given by traversing
         // the flat list and identified by [row]
         idx = info.doc < 0 ? row : info.doc;
-        const auto& docs = App::GetApplication().getDocuments();
+        updateCache();
+        const auto& docs = docsCache;
         int docSize = (int)docs.size() * 2;
         int objSize = 0;
         int propSize = 0;
@@ -323,7 +408,7 @@ public:
             // objs.size+  props.size
             //
             // We need to process the ROOT so we get the correct count for its children
-            doc = App::GetApplication().getDocument(currentDoc.c_str());
+            doc = currentDocCache;
             if (!doc) {  // no current, there are no additional objects
                 return;
             }
@@ -355,8 +440,7 @@ public:
                         row = idx;
                     }
                     // get the properties
-                    cobj->getPropertyNamedList(props);
-                    propSize = (int)props.size();
+                    propSize = (int)propsCache.size();
 
                     // if this is an invalid index, bail out
                     // if it's the ROOT break!
@@ -366,8 +450,8 @@ public:
                     if (idx >= 0) {
                         obj = cobj;  // we only set the active object if we're not processing the
                                      // root.
-                        propName = props[idx].first;
-                        prop = props[idx].second;
+                        propName = propsCache[idx].first;
+                        prop = propsCache[idx].second;
                     }
                 }
             }
@@ -394,12 +478,7 @@ public:
                 else if (obj) {
                     // the object has been resolved, use the saved idx to figure out quotation or
                     // not.
-                    if (idx & 1) {
-                        res = QString::fromUtf8(quote(obj->Label.getStrValue()).c_str());
-                    }
-                    else {
-                        res = QString::fromLatin1(obj->getNameInDocument());
-                    }
+                    res = objectText(doc, idx);
                     if (sep && !noProperty) {
                         res += QLatin1Char('.');
                     }
@@ -442,13 +521,7 @@ public:
                 }
                 if (v) {
                     // resolve the name
-                    QString res;
-                    if (idx & 1) {
-                        res = QString::fromUtf8(quote(obj->Label.getStrValue()).c_str());
-                    }
-                    else {
-                        res = QString::fromLatin1(obj->getNameInDocument());
-                    }
+                    QString res = objectText(doc, idx);
                     if (sep && !noProperty) {
                         res += QLatin1Char('.');
                     }
@@ -573,8 +646,8 @@ public:
             // Our wonderful element is a child of the root
             if (parentInfo.doc < 0) {
                 // need special casing to properly identify this model's object
-                const auto& docs = App::GetApplication().getDocuments();
-                auto docsSize = static_cast<int>(docs.size() * 2);
+                updateCache();
+                auto docsSize = static_cast<int>(docsCache.size() * 2);
 
                 info.doc = element.row();
 
@@ -585,12 +658,12 @@ public:
                 }
             }
             else if (parentInfo.contextualHierarchy) {
-                const auto& docs = App::GetApplication().getDocuments();
-                auto cdoc = App::GetApplication().getDocument(currentDoc.c_str());
+                updateCache();
+                auto cdoc = currentDocCache;
 
                 if (cdoc) {
                     int objsSize = static_cast<int>(cdoc->getObjects().size() * 2);
-                    int idx = parentInfo.doc - static_cast<int>(docs.size());
+                    int idx = parentInfo.doc - static_cast<int>(docsCache.size());
                     if (idx < objsSize) {
                         //  |-- Parent (OBJECT)   - (row 4, [-1,-1,-1,0]) = encode as element =>
                         //  [parent.row,-1,-1,1]
@@ -679,6 +752,13 @@ private:
     std::string currentDoc;
     std::string currentObj;
     bool noProperty;
+
+    mutable bool cacheValid = false;
+    mutable std::vector<App::Document*> docsCache;
+    mutable App::Document* currentDocCache = nullptr;
+    mutable std::vector<std::pair<const char*, App::Property*>> propsCache;
+    mutable std::unordered_map<const App::Document*, std::vector<QString>> objectTexts;
+    std::vector<boost::signals2::scoped_connection> connections;
 };
 
 const ExpressionCompleterModel::Info ExpressionCompleterModel::Info::root = {-1, -1, -1, 0};
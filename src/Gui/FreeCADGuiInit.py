@@ -213,6 +213,7 @@ def InitApplications():
                 Err('Please look into the log file for further information\n')
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
+                FreeCAD.addStartupPhase('InitGui.py of ' + os.path.basename(Dir))
                 return True
         else:
             Log('Init:      Initializing ' + Dir + '(InitGui.py not found)... ignore\n')
@@ -1587,6 +1587,8 @@ void MainWindow::delayedStartup()
     catch (const Base::SystemExitException&) {
         throw;
     }
+    App::Application::addStartupPhase("Open files");
+    App::Application::printStartupTimeline();
 
     if (Application::hiddenMainWindow()) {
         QApplication::quit();
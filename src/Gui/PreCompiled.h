@@ -65,6 +65,7 @@
 #include <algorithm>
 #include <atomic>
 #include <bitset>
+#include <cmath>
 #include <limits>
 #include <list>
 #include <map>
@@ -83,6 +83,7 @@ void DlgSettingsDocumentImp::saveSettings()
 
     ui->prefUndoRedo->onSave();
     ui->prefUndoRedoSize->onSave();
+    ui->prefUndoRedoMemory->onSave();
     ui->prefSaveTransaction->onSave();
     ui->prefDiscardTransaction->onSave();
     ui->prefSaveThumbnail->onSave();
@@ -103,6 +104,8 @@ void DlgSettingsDocumentImp::saveSettings()
     ui->prefAutoSaveEnabled->onSave();
     ui->prefAutoSaveTimeout->onSave();
     ui->prefCanAbortRecompute->onSave();
+    ui->prefSaveBinaryBrep->onSave();
+    ui->prefSaveTriangulation->onSave();
 
     int timeout = ui->prefAutoSaveTimeout->value();
     if (!ui->prefAutoSaveEnabled->isChecked())
@@ -117,6 +120,7 @@ void DlgSettingsDocumentImp::loadSettings()
 
     ui->prefUndoRedo->onRestore();
     ui->prefUndoRedoSize->onRestore();
+    ui->prefUndoRedoMemory->onRestore();
     ui->prefSaveTransaction->onRestore();
     ui->prefDiscardTransaction->onRestore();
     ui->prefSaveThumbnail->onRestore();
@@ -137,6 +141,8 @@ void DlgSettingsDocumentImp::loadSettings()
     ui->prefAutoSaveEnabled->onRestore();
     ui->prefAutoSaveTimeout->onRestore();
     ui->prefCanAbortRecompute->onRestore();
+    ui->prefSaveBinaryBrep->onRestore();
+    ui->prefSaveTriangulation->onRestore();
 }
 
 /**
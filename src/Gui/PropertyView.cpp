@@ -77,6 +77,7 @@ PropertyView::PropertyView(QWidget *parent)
     timer = new QTimer(this);
     timer->setSingleShot(true);
     connect(timer, &QTimer::timeout, this, &PropertyView::onTimer);
+    setReceiveBatch(true);
 
     tabs = new QTabWidget (this);
     tabs->setObjectName(QStringLiteral("propertyTab"));
@@ -52,6 +52,7 @@
 #pragma warning(disable : 4267)
 #endif
 
+#include <algorithm>
 #include <cassert>
 
 #if HAVE_CONFIG_H
@@ -64,6 +65,7 @@
 #include <QAction>
 #include <QApplication>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QEvent>
 #include <QFile>
 #include <QGuiApplication>
@@ -73,6 +75,8 @@
 #include <QOpenGLWidget>
 #include <QPaintEvent>
 #include <QResizeEvent>
+#include <QScreen>
+#include <QTimer>
 #include <QWindow>
 
 #include <Inventor/C/basic.h>
@@ -275,6 +279,14 @@ QuarterWidget::constructor(const QSurfaceFormat & format, const QOpenGLWidget *
   PRIVATE(this)->initialsoeventmanager = true;
   PRIVATE(this)->processdelayqueue = true;
 
+  // a redraw that was postponed to the next frame slot
+  PRIVATE(this)->redrawtimer = new QTimer(this);
+  PRIVATE(this)->redrawtimer->setSingleShot(true);
+  QObject::connect(PRIVATE(this)->redrawtimer, &QTimer::timeout, this, [this]() {
+    PRIVATE(this)->processdelayqueue = false;
+    this->viewport()->update();
+  });
+
   //Mind the order of initialization as the XML state machine uses
   //callbacks which depends on other state being initialized
   PRIVATE(this)->eventfilter = new EventFilter(this);
@@ -506,6 +518,61 @@ QuarterWidget::getCacheContextId() const
   return PRIVATE(this)->getCacheContextId();
 }
 
+/*!
+  Returns true if redraw() renders at most one frame per refresh interval
+  of the screen.
+*/
+bool
+QuarterWidget::framePacing() const
+{
+  return PRIVATE(this)->framepacing;
+}
+
+/*!
+  Enables or disables frame pacing. When enabled, calls of redraw() that
+  come faster than the screen can show the frames are merged, the scene
+  is rendered once at the start of the next refresh interval.
+*/
+void
+QuarterWidget::setFramePacing(bool onoff)
+{
+  PRIVATE(this)->framepacing = onoff;
+  if (!onoff && PRIVATE(this)->redrawtimer->isActive()) {
+    PRIVATE(this)->redrawtimer->stop();
+    this->viewport()->update();
+  }
+}
+
+/*!
+  Returns the number of rendered frames and requested redraws together
+  with the render times since the last call of resetFrameStatistics().
+*/
+QuarterWidget::FrameStatistics
+QuarterWidget::getFrameStatistics() const
+{
+  FrameStatistics stats;
+  stats.frames = PRIVATE(this)->framecount;
+  stats.requests = PRIVATE(this)->redrawrequests;
+  stats.coalesced = PRIVATE(this)->coalescedrequests;
+  stats.lastTime = PRIVATE(this)->lastframetime;
+  stats.maxTime = PRIVATE(this)->maxframetime;
+  if (stats.frames > 0) {
+    stats.averageTime = PRIVATE(this)->totalframetime / stats.frames;
+  }
+  return stats;
+}
+
+void
+QuarterWidget::resetFrameStatistics()
+{
+  PRIVATE(this)->framecount = 0;
+  PRIVATE(this)->redrawrequests = 0;
+  PRIVATE(this)->coalescedrequests = 0;
+  PRIVATE(this)->lastframetime = 0.0;
+  PRIVATE(this)->totalframetime = 0.0;
+  PRIVATE(this)->maxframetime = 0.0;
+}
+
 /*!
   \property QuarterWidget::transparencyType
 
@@ -893,7 +960,20 @@ void QuarterWidget::paintEvent(QPaintEvent* event)
     //glDrawBuffer(w->format().swapBehavior() == QSurfaceFormat::DoubleBuffer ? GL_BACK : GL_FRONT);
 
     w->makeCurrent();
+
+    // this frame shows the latest state of the scene, so a postponed
+    // redraw is not needed anymore
+    PRIVATE(this)->redrawtimer->stop();
+
+    QElapsedTimer frametime;
+    frametime.start();
+    PRIVATE(this)->lastframe.start();
     this->actualRedraw();
+    double milliseconds = frametime.nsecsElapsed() / 1.0e6;
+    PRIVATE(this)->framecount++;
+    PRIVATE(this)->lastframetime = milliseconds;
+    PRIVATE(this)->totalframetime += milliseconds;
+    PRIVATE(this)->maxframetime = std::max(PRIVATE(this)->maxframetime, milliseconds);
 
     //start the standard graphics view processing for all widgets and graphic items. As 
     //QGraphicsView initaliizes a QPainter which changes the Opengl context in an unpredictable 
@@ -964,6 +1044,25 @@ QuarterWidget::redraw()
   // we're triggering the next paintGL(). Set a flag to remember this
   // to avoid that we process the delay queue in paintGL()
   PRIVATE(this)->processdelayqueue = false;
+  PRIVATE(this)->redrawrequests++;
+
+  // With frame pacing a burst of scene changes is rendered at most once
+  // per refresh interval of the screen, a request that comes too early is
+  // postponed to the next frame slot and merged with the ones following it.
+  if (PRIVATE(this)->redrawtimer->isActive()) {
+    PRIVATE(this)->coalescedrequests++;
+    return;
+  }
+  if (PRIVATE(this)->framepacing && PRIVATE(this)->lastframe.isValid()) {
+    qreal rate = this->screen() ? this->screen()->refreshRate() : 60.0;
+    qint64 interval = static_cast<qint64>(1000.0 / (rate > 0.0 ? rate : 60.0));
+    qint64 remaining = interval - PRIVATE(this)->lastframe.elapsed();
+    if (remaining > 0) {
+      PRIVATE(this)->coalescedrequests++;
+      PRIVATE(this)->redrawtimer->start(static_cast<int>(remaining));
+      return;
+    }
+  }
 
   // When stylesheet is used, there is recursive repaint warning caused by
   // repaint() here. It happens when switching active documents. Based on call
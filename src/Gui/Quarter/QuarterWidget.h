@@ -114,6 +114,18 @@ public:
   Q_ENUM(RenderMode)
   Q_ENUM(StereoMode)
 
+  struct FrameStatistics {
+    // the number of rendered frames
+    unsigned long frames = 0;
+    // the number of calls of redraw()
+    unsigned long requests = 0;
+    // the calls of redraw() that were merged into a later frame
+    unsigned long coalesced = 0;
+    // render times in milliseconds
+    double lastTime = 0.0;
+    double averageTime = 0.0;
+    double maxTime = 0.0;
+  };
 
 public:
   explicit QuarterWidget(QWidget * parent = nullptr, const QOpenGLWidget * sharewidget = nullptr, Qt::WindowFlags f = Qt::WindowFlags());
@@ -160,6 +172,12 @@ public:
 
   uint32_t getCacheContextId() const;
 
+  bool framePacing() const;
+  void setFramePacing(bool onoff);
+
+  FrameStatistics getFrameStatistics() const;
+  void resetFrameStatistics();
+
   virtual void setSceneGraph(SoNode * root);
   virtual SoNode * getSceneGraph() const;
 
@@ -88,6 +88,14 @@ QuarterWidgetP::QuarterWidgetP(QuarterWidget * masterptr, const QOpenGLWidget *
   clearwindow(true),
   addactions(true),
   processdelayqueue(true),
+  framepacing(true),
+  redrawtimer(nullptr),
+  framecount(0),
+  redrawrequests(0),
+  coalescedrequests(0),
+  lastframetime(0.0),
+  totalframetime(0.0),
+  maxframetime(0.0),
   currentStateMachine(nullptr),
   device_pixel_ratio(1.0),
   transparencytypegroup(nullptr),
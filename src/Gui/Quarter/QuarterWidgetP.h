@@ -34,10 +34,12 @@
 \**************************************************************************/
 
 #include <Inventor/SbBasic.h>
+#include <QElapsedTimer>
 #include <QList>
 #include <QUrl>
 
 class QOpenGLWidget;
+class QTimer;
 
 class SoNode;
 class SoCamera;
@@ -89,6 +91,15 @@ public:
   bool clearwindow;
   bool addactions;
   bool processdelayqueue;
+  bool framepacing;
+  QTimer * redrawtimer;
+  QElapsedTimer lastframe;
+  unsigned long framecount;
+  unsigned long redrawrequests;
+  unsigned long coalescedrequests;
+  double lastframetime;
+  double totalframetime;
+  double maxframetime;
   QUrl navigationModeFile;
   SoScXMLStateMachine * currentStateMachine;
   qreal device_pixel_ratio;
@@ -102,6 +102,12 @@ public:
     virtual float getPickRadius() const {return this->pickRadius;}
     virtual void setPickRadius(float pickRadius);
 
+    /// Returns the draw time in milliseconds and the frames per second
+    SbVec2f getFramesPerSecond() const
+    {
+        return framesPerSecond;
+    }
+
     virtual void saveHomePosition();
     virtual void resetToHomePosition();
     virtual bool hasHomePosition() const
@@ -146,6 +146,8 @@ public:
 
     /// returns the name for observer handling
     const char* name() override {return "ReportOutput";}
+    /// the messages are posted to the report view as events
+    bool isThreadSafe() const override {return true;}
 
     /** Restore the default font settings. */
     void restoreFont ();
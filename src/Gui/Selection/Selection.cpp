@@ -139,6 +139,10 @@ void SelectionObserver::attachSelection()
         //NOLINTBEGIN
         connectSelection = signal.connect(std::bind
             (&SelectionObserver::_onSelectionChanged, this, sp::_1));
+        if (receiveBatch) {
+            connectBatch = Selection().signalSelectionBatch.connect(std::bind
+                (&SelectionObserver::_onSelectionChanged, this, sp::_1));
+        }
         //NOLINTEND
 
         if (!filterDocName.empty()) {
@@ -152,6 +156,8 @@ void SelectionObserver::_onSelectionChanged(const SelectionChanges& msg) {
     try {
         if (blockedSelection)
             return;
+        if (receiveBatch && msg.Batch == SelectionChanges::BatchRole::Part)
+            return;
         onSelectionChanged(msg);
     } catch (Base::Exception &e) {
         e.reportException();
@@ -167,11 +173,26 @@ void SelectionObserver::detachSelection()
 {
     if (connectSelection.connected()) {
         connectSelection.disconnect();
+        connectBatch.disconnect();
         if (!filterDocName.empty())
             Selection().rmvSelectionGate();
     }
 }
 
+void SelectionObserver::setReceiveBatch(bool on)
+{
+    receiveBatch = on;
+    if (!on) {
+        connectBatch.disconnect();
+    }
+    else if (connectSelection.connected() && !connectBatch.connected()) {
+        //NOLINTBEGIN
+        connectBatch = Selection().signalSelectionBatch.connect(std::bind
+            (&SelectionObserver::_onSelectionChanged, this, sp::_1));
+        //NOLINTEND
+    }
+}
+
 // -------------------------------------------
 
 bool SelectionSingleton::hasSelection() const
@@ -509,6 +530,12 @@ static void notifyDocumentObjectViewProvider(const SelectionChanges& changes) {
 
 void SelectionSingleton::notify(SelectionChanges &&Chng)
 {
+    if (batchDepth > 0 && Chng.Batch == SelectionChanges::BatchRole::None
+        && (Chng.Type == SelectionChanges::AddSelection
+            || Chng.Type == SelectionChanges::RmvSelection)) {
+        Chng.Batch = SelectionChanges::BatchRole::Part;
+        batchDocuments.insert(Chng.Object.getDocumentName());
+    }
     if(Notifying) {
         NotificationQueue.push_back(std::move(Chng));
         return;
@@ -517,6 +544,17 @@ void SelectionSingleton::notify(SelectionChanges &&Chng)
     NotificationQueue.push_back(std::move(Chng));
     while(!NotificationQueue.empty()) {
         const auto &msg = NotificationQueue.front();
+        if (msg.Batch == SelectionChanges::BatchRole::Summary) {
+            try {
+                signalSelectionBatch(msg);
+            }
+            catch (const boost::exception&) {
+                // reported by code analyzers
+                Base::Console().warning("notify: Unexpected boost exception\n");
+            }
+            NotificationQueue.pop_front();
+            continue;
+        }
         bool notify = false;
         switch(msg.Type) {
         case SelectionChanges::AddSelection:
@@ -552,6 +590,59 @@ void SelectionSingleton::notify(SelectionChanges &&Chng)
     }
 }
 
+void SelectionSingleton::beginBatch()
+{
+    ++batchDepth;
+}
+
+void SelectionSingleton::endBatch()
+{
+    if (batchDepth <= 0 || --batchDepth > 0)
+        return;
+    std::set<std::string> docs;
+    docs.swap(batchDocuments);
+    for (const auto& doc : docs) {
+        SelectionChanges Chng(SelectionChanges::SetSelection, doc.c_str());
+        Chng.Batch = SelectionChanges::BatchRole::Summary;
+        notify(std::move(Chng));
+    }
+}
+
+std::string SelectionSingleton::selectionKey(const std::string& docName,
+                                             const std::string& featName,
+                                             const std::string& subName)
+{
+    std::string key;
+    key.reserve(docName.size() + featName.size() + subName.size() + 2);
+    key += docName;
+    key += '#';
+    key += featName;
+    key += '.';
+    key += subName;
+    return key;
+}
+
+void SelectionSingleton::addToSelList(const _SelObj& sel)
+{
+    _SelList.push_back(sel);
+    ++_SelIndex[selectionKey(sel.DocName, sel.FeatName, sel.SubName)];
+}
+
+std::list<SelectionSingleton::_SelObj>::iterator
+SelectionSingleton::eraseFromSelList(std::list<_SelObj>::iterator it)
+{
+    auto pos = _SelIndex.find(selectionKey(it->DocName, it->FeatName, it->SubName));
+    if (pos != _SelIndex.end() && --pos->second <= 0)
+        _SelIndex.erase(pos);
+    return _SelList.erase(it);
+}
+
+void SelectionSingleton::clearSelList()
+{
+    _SelList.clear();
+    _SelIndex.clear();
+}
+
 bool SelectionSingleton::hasPickedList() const
 {
     return !_PickedList.empty();
@@ -690,6 +781,7 @@ void SelectionSingleton::slotSelectionChanged(const SelectionChanges& msg)
 
         try {
             msg2.pOriginalMsg = &msg;
+            msg2.Batch = msg.Batch;
             signalSelectionChanged3(msg2);
 
             msg2.Object.setSubName(oldElementName.c_str());
@@ -1065,7 +1157,7 @@ bool SelectionSingleton::addSelection(const char* pDocName, const char* pObjectN
     if(!logDisabled)
         temp.log(false,clearPreselect);
 
-    _SelList.push_back(temp);
+    addToSelList(temp);
     _SelStackForward.clear();
 
     if(clearPreselect)
@@ -1089,16 +1181,13 @@ bool SelectionSingleton::addSelection(const char* pDocName, const char* pObjectN
 }
 
 void SelectionSingleton::selStackPush(bool clearForward, bool overwrite) {
-    static int stackSize;
-    if(!stackSize) {
-        stackSize = App::GetApplication().GetParameterGroupByPath
-                ("User parameter:BaseApp/Preferences/View")->GetInt("SelectionStackSize",100);
-    }
+    static ParameterValue<int> stackSize(App::GetApplication().GetParameterGroupByPath
+                ("User parameter:BaseApp/Preferences/View"), "SelectionStackSize", 100);
     if(clearForward)
         _SelStackForward.clear();
     if(_SelList.empty())
         return;
-    if((int)_SelStackBack.size() >= stackSize)
+    if((int)_SelStackBack.size() >= stackSize.getValue())
         _SelStackBack.pop_front();
     SelStackItem item;
     for(auto &sel : _SelList)
@@ -1218,6 +1307,7 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
         notify(SelectionChanges(SelectionChanges::PickedListChanged));
     }
 
+    SelectionBatch batch;
     bool update = false;
     for(const auto & pSubName : pSubNames) {
         _SelObj temp;
@@ -1229,7 +1319,7 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
         temp.y        = 0;
         temp.z        = 0;
 
-        _SelList.push_back(temp);
+        addToSelList(temp);
         _SelStackForward.clear();
 
         SelectionChanges Chng(SelectionChanges::AddSelection,
@@ -1283,6 +1373,7 @@ bool SelectionSingleton::addSelection(const SelectionObject& obj, bool clearPres
 {
     const std::vector<std::string>& subNames = obj.getSubNames();
     const std::vector<Base::Vector3d> points = obj.getPickedPoints();
+    SelectionBatch batch;
     if (!subNames.empty() && subNames.size() == points.size()) {
         bool ok = true;
         for (std::size_t i=0; i<subNames.size(); i++) {
@@ -1356,7 +1447,7 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
                 It->DocName,It->FeatName,It->SubName,It->TypeName);
 
         // destroy the _SelObj item
-        _SelList.erase(It);
+        eraseFromSelList(It);
     }
 
     // NOTE: It can happen that there are nested calls of rmvSelection()
@@ -1494,7 +1585,7 @@ void SelectionSingleton::setSelection(const char* pDocName, const std::vector<Ap
         if (ret!=0)
             continue;
         touched = true;
-        _SelList.push_back(temp);
+        addToSelList(temp);
     }
 
     if(touched) {
@@ -1530,7 +1621,7 @@ void SelectionSingleton::clearSelection(const char* pDocName, bool clearPreSelec
         for (auto it=_SelList.begin();it!=_SelList.end();) {
             if (it->DocName == docName) {
                 touched = true;
-                it = _SelList.erase(it);
+                it = eraseFromSelList(it);
             }
             else {
                 ++it;
@@ -1588,7 +1679,7 @@ void SelectionSingleton::clearCompleteSelection(bool clearPreSelect)
         vp->onSelectionChanged(Chng);
     }
 
-    _SelList.clear();
+    clearSelList();
 
     SelectionChanges Chng(SelectionChanges::ClrSelection);
 
@@ -1671,6 +1762,10 @@ int SelectionSingleton::checkSelection(const char *pDocName, const char *pObject
     if(!pSubName)
         pSubName = "";
 
+    // without resolving only exact matches count
+    if (resolve == ResolveMode::NoResolve && selList == &_SelList)
+        return _SelIndex.contains(selectionKey(sel.DocName, sel.FeatName, pSubName)) ? 1 : 0;
+
     for (auto &s : *selList) {
         if (s.DocName==pDocName && s.FeatName==sel.FeatName) {
             if(s.SubName==pSubName)
@@ -1731,7 +1826,7 @@ void SelectionSingleton::slotDeletedObject(const App::DocumentObject& Obj)
         if(it->pResolvedObject == &Obj || it->pObject==&Obj) {
             changes.emplace_back(SelectionChanges::RmvSelection,
                     it->DocName,it->FeatName,it->SubName,it->TypeName);
-            _SelList.erase(it);
+            eraseFromSelList(it);
         }
     }
     if(!changes.empty()) {
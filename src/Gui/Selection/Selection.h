@@ -26,7 +26,9 @@
 
 #include <deque>
 #include <list>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <App/DocumentObject.h>
@@ -93,6 +95,15 @@ public:
         Internal = 1,
         TreeView = 2
     };
+    /** A bulk change notifies every single change as Part, followed by a SetSelection
+     * message per document as Summary. The summary is only sent to the observers that
+     * receive batches, and those ignore the parts. See SelectionObserver::setReceiveBatch().
+     */
+    enum class BatchRole {
+        None,
+        Part,
+        Summary
+    };
 
     SelectionChanges(MsgType type = ClrSelection,
             const char *docName=nullptr, const char *objName=nullptr,
@@ -148,6 +159,7 @@ public:
         pSubName = Object.getSubName().c_str();
         pTypeName = TypeName.c_str();
         pOriginalMsg = other.pOriginalMsg;
+        Batch = other.Batch;
         return *this;
     }
 
@@ -168,6 +180,7 @@ public:
         pSubName = Object.getSubName().c_str();
         pTypeName = TypeName.c_str();
         pOriginalMsg = other.pOriginalMsg;
+        Batch = other.Batch;
         return *this;
     }
 
@@ -187,6 +200,8 @@ public:
 
     // Original selection message in case resolve!=0
     const SelectionChanges *pOriginalMsg = nullptr;
+
+    BatchRole Batch = BatchRole::None;
 };
 
 class ViewProviderDocumentObject;
@@ -228,6 +243,11 @@ public:
     /** Detaches from the selection. */
     void detachSelection();
 
+    /** Receive a single SetSelection message instead of the single messages of a
+     * bulk change. This is for observers that update from the whole selection anyway.
+     */
+    void setReceiveBatch(bool on);
+
 private:
     virtual void onSelectionChanged(const SelectionChanges& msg) = 0;
     void _onSelectionChanged(const SelectionChanges& msg);
@@ -235,6 +255,8 @@ private:
 private:
     using Connection = boost::signals2::connection;
     Connection connectSelection;
+    Connection connectBatch;
+    bool receiveBatch = false;
     std::string filterDocName;
     std::string filterObjName;
     ResolveMode resolve;
@@ -313,8 +335,13 @@ public:
 
     /// Add to selection
     bool addSelection(const SelectionObject&, bool clearPreSelect=true);
-    /// Add to selection with several sub-elements
+    /// Add to selection with several sub-elements, the change is notified as batch
     bool addSelections(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames);
+    /** Starts a bulk change, the selection changes until the matching endBatch() are
+     * notified as batch. Calls can be nested, see also SelectionBatch.
+     */
+    void beginBatch();
+    void endBatch();
     /// Update a selection
     bool updateSelection(bool show, const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr);
     /// Remove from selection (for internal use)
@@ -416,6 +443,8 @@ public:
     boost::signals2::signal<void (const SelectionChanges& msg)> signalSelectionChanged2;
     /// signal on selection change with resolved object and sub element map
     boost::signals2::signal<void (const SelectionChanges& msg)> signalSelectionChanged3;
+    /// signal with the summary of a bulk change
+    boost::signals2::signal<void (const SelectionChanges& msg)> signalSelectionBatch;
 
     /** Returns a vector of selection objects
      *
@@ -656,6 +685,9 @@ protected:
     std::deque<SelectionChanges> NotificationQueue;
     bool Notifying = false;
 
+    int batchDepth = 0;
+    std::set<std::string> batchDocuments;
+
     void notify(SelectionChanges &&Chng);
     void notify(const SelectionChanges &Chng) { notify(SelectionChanges(Chng)); }
 
@@ -677,6 +709,13 @@ protected:
         void log(bool remove=false, bool clearPreselect=true);
     };
     mutable std::list<_SelObj> _SelList;
+    // counts the entries of _SelList by document, object and sub name
+    std::unordered_map<std::string, int> _SelIndex;
+    static std::string selectionKey(const std::string& docName, const std::string& featName,
+                                    const std::string& subName);
+    void addToSelList(const _SelObj& sel);
+    std::list<_SelObj>::iterator eraseFromSelList(std::list<_SelObj>::iterator it);
+    void clearSelList();
 
     mutable std::list<_SelObj> _PickedList;
     bool _needPickedList{false};
@@ -741,6 +780,21 @@ inline SelectionSingleton& Selection()
     return SelectionSingleton::instance();
 }
 
+/** Helper class to notify the selection changes of its lifetime as batch
+ */
+class GuiExport SelectionBatch {
+public:
+    SelectionBatch() {
+        Selection().beginBatch();
+    }
+    ~SelectionBatch() {
+        Selection().endBatch();
+    }
+
+    SelectionBatch(const SelectionBatch&) = delete;
+    SelectionBatch& operator=(const SelectionBatch&) = delete;
+};
+
 /** Helper class to disable logging selection action to MacroManager
  */
 class GuiExport SelectionLogDisabler {
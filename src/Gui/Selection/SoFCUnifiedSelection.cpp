@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <Inventor/SbBox2f.h>
 # include <Inventor/SoFullPath.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/actions/SoCallbackAction.h>
@@ -30,6 +33,7 @@
 # include <Inventor/actions/SoGetPrimitiveCountAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
 # include <Inventor/actions/SoHandleEventAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/actions/SoWriteAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/details/SoFaceDetail.h>
@@ -39,6 +43,7 @@
 # include <Inventor/elements/SoDrawStyleElement.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoLazyElement.h>
+# include <Inventor/elements/SoLightModelElement.h>
 # include <Inventor/elements/SoLineWidthElement.h>
 # include <Inventor/elements/SoMaterialBindingElement.h>
 # include <Inventor/elements/SoModelMatrixElement.h>
@@ -46,8 +51,10 @@
 # include <Inventor/elements/SoShapeStyleElement.h>
 # include <Inventor/elements/SoSwitchElement.h>
 # include <Inventor/elements/SoTextureEnabledElement.h>
+# include <Inventor/elements/SoViewVolumeElement.h>
 # include <Inventor/events/SoLocation2Event.h>
 # include <Inventor/events/SoMouseButtonEvent.h>
+# include <Inventor/lists/SoPathList.h>
 # include <Inventor/misc/SoChildList.h>
 # include <Inventor/misc/SoState.h>
 # include <Inventor/nodes/SoCoordinate3.h>
@@ -104,6 +111,34 @@ void printPreselectionInfo(const char* documentName,
 
 SoFullPath * Gui::SoFCUnifiedSelection::currentHighlightPath = nullptr;
 
+namespace {
+// ids of the ID buffer, the children of the node are numbered from 1
+constexpr uint32_t IdBackground = 0;
+constexpr uint32_t IdUnknown = 0xFFFFFF;
+
+SbColor idToColor(uint32_t id)
+{
+    return {float(id & 0xFF) / 255.0F,
+            float((id >> 8) & 0xFF) / 255.0F,
+            float((id >> 16) & 0xFF) / 255.0F};
+}
+}
+
+struct SoFCUnifiedSelection::IdBuffer
+{
+    // the scene graph of the viewer when the buffer was rendered
+    SoNode* scene = nullptr;
+    SbUniqueId sceneId = 0;
+    SbVec2s size;
+    float pickRadius = 5.0F;
+    uint32_t numChildren = 0;
+    // RGBA values of the rendered ids
+    std::vector<unsigned char> pixels;
+
+    SoRayPickAction pickAction {SbViewportRegion()};
+    SoPickedPointList noPoints;
+};
+
 // *************************************************************************
 
 SO_NODE_SOURCE(SoFCUnifiedSelection)
@@ -242,7 +277,7 @@ SoFCUnifiedSelection::getPickedList(SoHandleEventAction* action, bool singlePick
 {
     ViewProvider *last_vp = nullptr;
     std::vector<PickedInfo> ret;
-    const SoPickedPointList & points = action->getPickedPointList();
+    const SoPickedPointList & points = getPickedPoints(action);
     for(int i=0,count=points.getLength();i<count;++i) {
         PickedInfo info;
         info.pp = points[i];
@@ -312,6 +347,119 @@ SoFCUnifiedSelection::getPickedList(SoHandleEventAction* action, bool singlePick
     return ret;
 }
 
+const SoPickedPointList& SoFCUnifiedSelection::getPickedPoints(SoHandleEventAction* action) const
+{
+    std::vector<int> hits;
+    if (!getIdBufferHits(action, hits))
+        return action->getPickedPointList();
+    if (hits.empty())
+        return idBuffer->noPoints;
+
+    // only pick the children under the cursor
+    SoPathList paths;
+    for (int child : hits) {
+        SoPath* path = action->getCurPath()->copy();
+        path->append(child);
+        paths.append(path);
+    }
+
+    SoRayPickAction& pick = idBuffer->pickAction;
+    pick.setViewportRegion(action->getViewportRegion());
+    pick.setPoint(action->getEvent()->getPosition());
+    pick.setRadius(idBuffer->pickRadius);
+    pick.setPickAll(true);
+    pick.apply(paths);
+    return pick.getPickedPointList();
+}
+
+bool SoFCUnifiedSelection::isIdBufferValid(SoNode* scene, const SbViewportRegion& vp) const
+{
+    // any change of the scene graph or the camera changes the id of the root node
+    return idBuffer && idBuffer->scene == scene && scene->getNodeId() == idBuffer->sceneId
+        && idBuffer->size == vp.getViewportSizePixels();
+}
+
+void SoFCUnifiedSelection::renderIdBuffer(SoGLRenderAction* action, SoNode* scene)
+{
+    // Render everything flat and opaque with the id as color. Nodes outside of
+    // this node get the id of an unknown object so that they are ray picked.
+    SoState* state = action->getState();
+    SbColor unknown = idToColor(IdUnknown);
+    float transparency = 0.0F;
+    SoLightModelElement::set(state, this, SoLightModelElement::BASE_COLOR);
+    SoOverrideElement::setLightModelOverride(state, this, true);
+    SoLazyElement::setDiffuse(state, this, 1, &unknown, &colorpacker);
+    SoOverrideElement::setDiffuseColorOverride(state, this, true);
+    SoLazyElement::setTransparency(state, this, 1, &transparency, &colorpacker);
+    SoOverrideElement::setTransparencyOverride(state, this, true);
+    SoMaterialBindingElement::set(state, this, SoMaterialBindingElement::OVERALL);
+    SoOverrideElement::setMaterialBindingOverride(state, this, true);
+
+    Base::FlagToggler<bool> flag(renderingIds);
+    action->apply(scene);
+}
+
+void SoFCUnifiedSelection::renderIds(SoGLRenderAction* action)
+{
+    SoState* state = action->getState();
+    state->push();
+    for (int i = 0, count = getNumChildren(); i < count && !action->hasTerminated(); ++i) {
+        SbColor color = idToColor(std::min<uint32_t>(i + 1, IdUnknown));
+        SoLazyElement::setDiffuse(state, this, 1, &color, &colorpacker);
+        this->children->traverse(action, i);
+    }
+    state->pop();
+}
+
+void SoFCUnifiedSelection::setIdBuffer(SoNode* scene, const SbViewportRegion& vp,
+                                       std::vector<unsigned char>&& pixels, float pickRadius)
+{
+    if (!idBuffer)
+        idBuffer = std::make_unique<IdBuffer>();
+    idBuffer->scene = scene;
+    idBuffer->sceneId = scene->getNodeId();
+    idBuffer->size = vp.getViewportSizePixels();
+    idBuffer->pickRadius = pickRadius;
+    idBuffer->numChildren = getNumChildren();
+    idBuffer->pixels = std::move(pixels);
+}
+
+void SoFCUnifiedSelection::clearIdBuffer()
+{
+    idBuffer.reset();
+}
+
+bool SoFCUnifiedSelection::getIdBufferHits(SoHandleEventAction* action, std::vector<int>& children) const
+{
+    const SoPath* curPath = action->getCurPath();
+    if (!idBuffer || curPath->getTail() != this)
+        return false;
+    const SbViewportRegion& vp = action->getViewportRegion();
+    if (!isIdBufferValid(curPath->getHead(), vp))
+        return false;
+
+    SbVec2s pos = action->getEvent()->getPosition(vp);
+    int radius = static_cast<int>(std::ceil(idBuffer->pickRadius));
+    int width = idBuffer->size[0];
+    int height = idBuffer->size[1];
+    for (int y = std::max(0, pos[1] - radius); y <= std::min(height - 1, pos[1] + radius); ++y) {
+        for (int x = std::max(0, pos[0] - radius); x <= std::min(width - 1, pos[0] + radius); ++x) {
+            const unsigned char* pixel = &idBuffer->pixels[4 * (std::size_t(y) * width + x)];
+            uint32_t id = pixel[0] | (pixel[1] << 8) | (pixel[2] << 16);
+            if (id == IdBackground)
+                continue;
+            // something that can only be resolved by the ray pick
+            if (id > idBuffer->numChildren)
+                return false;
+            children.push_back(int(id - 1));
+        }
+    }
+
+    std::sort(children.begin(), children.end());
+    children.erase(std::unique(children.begin(), children.end()), children.end());
+    return true;
+}
+
 void SoFCUnifiedSelection::doAction(SoAction *action)
 {
     if (action->getTypeId() == SoFCEnablePreselectionAction::getClassTypeId()) {
@@ -751,6 +899,10 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
         if (preselectionMode == AUTO || preselectionMode == ON) {
             // check to see if the mouse is over our geometry...
             auto infos = this->getPickedList(action,true);
+            // the highlighting doesn't change which object is drawn where, so a valid
+            // ID buffer is kept
+            SoNode* scene = action->getCurPath()->getHead();
+            bool keepIdBuffer = isIdBufferValid(scene, action->getViewportRegion());
             if(!infos.empty())
                 setPreselect(infos[0]);
             else {
@@ -762,6 +914,8 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
                     this->touch();
                 }
             }
+            if (keepIdBuffer && idBuffer)
+                idBuffer->sceneId = scene->getNodeId();
         }
     }
     // mouse press events for (de)selection
@@ -783,6 +937,11 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
 
 void SoFCUnifiedSelection::GLRenderBelowPath(SoGLRenderAction * action)
 {
+    if (renderingIds) {
+        renderIds(action);
+        return;
+    }
+
     inherited::GLRenderBelowPath(action);
 
     // nothing picked, so restore the arrow cursor if needed
@@ -1087,6 +1246,20 @@ static void so_bbox_cleanup()
     delete so_bbox_storage;
 }
 
+static SoFCBBoxRenderInfo* so_bbox_get_data()
+{
+    auto data = static_cast<SoFCBBoxRenderInfo*>(so_bbox_storage->get());
+    if (!data->bboxaction) {
+        // The viewport region will be replaced every time the action is
+        // used, so we can just feed it a dummy here.
+        data->bboxaction = new SoGetBoundingBoxAction(SbViewportRegion());
+        data->cube = new SoCube;
+        data->cube->ref();
+        data->packer = new SoColorPacker;
+    }
+    return data;
+}
+
 // ---------------------------------------------------------------------------------
 
 SoFCSelectionRoot::Stack SoFCSelectionRoot::SelStack;
@@ -1143,6 +1316,12 @@ SoFCSelectionContextBasePtr SoFCSelectionRoot::getNodeContext(
         return SoFCSelectionContextBasePtr();
     }
 
+    // Usually nothing below the root is selected or highlighted. This saves
+    // the lookup for every shape of every element of a link array.
+    if (front->contextMap.empty()) {
+        return {};
+    }
+
     stack.front() = node;
 
     auto it = front->contextMap.find(stack);
@@ -1234,15 +1413,7 @@ std::pair<bool,SoFCSelectionContextBasePtr*> SoFCSelectionRoot::findActionContex
 
 bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbColor color)
 {
-    auto data = static_cast<SoFCBBoxRenderInfo*>(so_bbox_storage->get());
-    if (!data->bboxaction) {
-        // The viewport region will be replaced every time the action is
-        // used, so we can just feed it a dummy here.
-        data->bboxaction = new SoGetBoundingBoxAction(SbViewportRegion());
-        data->cube = new SoCube;
-        data->cube->ref();
-        data->packer = new SoColorPacker;
-    }
+    auto data = so_bbox_get_data();
 
     SbBox3f bbox;
     data->bboxaction->setViewportRegion(action->getViewportRegion());
@@ -1283,7 +1454,65 @@ bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbCol
 
 static std::time_t _CyclicLastReported;
 
+// With the render optimization the node is skipped if it's outside of the view
+// volume. While navigating, it's drawn as bounding box if it covers only a few
+// pixels and skipped if it's smaller than a pixel.
+bool SoFCSelectionRoot::renderSimplified(SoGLRenderAction * action) {
+    // without a cached bounding box the test is more expensive than rendering
+    if(!ViewParams::instance()->getRenderOptimization()
+            || boundingBoxCaching.getValue() == SoSeparator::OFF)
+        return false;
+
+    auto data = so_bbox_get_data();
+    data->bboxaction->setViewportRegion(action->getViewportRegion());
+    data->bboxaction->apply(this);
+    SbBox3f bbox = data->bboxaction->getBoundingBox();
+    if(bbox.isEmpty())
+        return false;
+
+    SoState *state = action->getState();
+    SbMatrix matrix = SoModelMatrixElement::get(state);
+    matrix.multRight(SoViewVolumeElement::get(state).getMatrix());
+
+    // the bounding box in normalized device coordinates
+    float xmin, ymin, zmin, xmax, ymax, zmax;
+    bbox.getBounds(xmin, ymin, zmin, xmax, ymax, zmax);
+    SbBox2f screen;
+    for(int i=0; i<8; ++i) {
+        SbVec4f corner((i & 1) ? xmax : xmin, (i & 2) ? ymax : ymin, (i & 4) ? zmax : zmin, 1.0f);
+        SbVec4f projected;
+        matrix.multVecMatrix(corner, projected);
+        // the box reaches behind the camera
+        if(projected[3] <= 0.0f)
+            return false;
+        screen.extendBy(SbVec2f(projected[0] / projected[3], projected[1] / projected[3]));
+    }
+
+    if(!screen.intersect(SbBox2f(-1.0f, -1.0f, 1.0f, 1.0f)))
+        return true;
+    if(!SoFCInteractiveElement::get(state))
+        return false;
+
+    float width, height;
+    screen.getSize(width, height);
+    SbVec2s size = action->getViewportRegion().getViewportSizePixels();
+    float pixels = std::max(width * size[0], height * size[1]) / 2.0f;
+    if(pixels >= float(ViewParams::instance()->getLevelOfDetailSize()))
+        return false;
+
+    if(pixels >= 1.0f) {
+        SbColor color;
+        float transparency;
+        color.setPackedValue(uint32_t(ViewParams::instance()->getBoundingBoxColor()), transparency);
+        renderBBox(action, this, color);
+    }
+    return true;
+}
+
 void SoFCSelectionRoot::renderPrivate(SoGLRenderAction * action, bool inPath) {
+    if(!inPath && renderSimplified(action))
+        return;
+
     if(ViewParams::instance()->getCoinCycleCheck()
             && !SelStack.nodeSet.insert(this).second)
     {
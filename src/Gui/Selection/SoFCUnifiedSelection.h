@@ -24,8 +24,10 @@
 #define GUI_SOFCUNIFIEDSELECTION_H
 
 #include <list>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <Inventor/elements/SoLazyElement.h>
 #include <Inventor/fields/SoSFBool.h>
@@ -39,7 +41,9 @@
 
 class SoFullPath;
 class SoPickedPoint;
+class SoPickedPointList;
 class SoDetail;
+class SbViewportRegion;
 
 
 namespace Gui {
@@ -106,6 +110,23 @@ private:
     bool setSelection(const std::vector<PickedInfo> &, bool ctrlDown=false);
 
     std::vector<PickedInfo> getPickedList(SoHandleEventAction* action, bool singlePick) const;
+    const SoPickedPointList& getPickedPoints(SoHandleEventAction* action) const;
+
+    /** @name ID buffer picking
+     * If enabled the viewer renders the index of the child below every pixel into
+     * an offscreen buffer. Then only the children under the cursor must be ray
+     * picked, and nothing at all if the cursor is over the background. Without a
+     * valid buffer the whole scene is ray picked.
+     */
+    //@{
+    bool isIdBufferValid(SoNode* scene, const SbViewportRegion& vp) const;
+    void renderIdBuffer(SoGLRenderAction* action, SoNode* scene);
+    void setIdBuffer(SoNode* scene, const SbViewportRegion& vp,
+                     std::vector<unsigned char>&& pixels, float pickRadius);
+    void clearIdBuffer();
+    void renderIds(SoGLRenderAction* action);
+    bool getIdBufferHits(SoHandleEventAction* action, std::vector<int>& children) const;
+    //@}
 
     Gui::Document       *pcDocument{nullptr};
 
@@ -117,6 +138,10 @@ private:
     // -1 = not handled, 0 = not selected, 1 = selected
     int32_t preSelection;
     SoColorPacker colorpacker;
+
+    struct IdBuffer;
+    std::unique_ptr<IdBuffer> idBuffer;
+    bool renderingIds{false};
 };
 
 class GuiExport SoFCPathAnnotation : public SoSeparator {
@@ -319,6 +344,7 @@ protected:
 
     void renderPrivate(SoGLRenderAction *, bool inPath);
     bool _renderPrivate(SoGLRenderAction *, bool inPath);
+    bool renderSimplified(SoGLRenderAction *);
 
     class Stack : public std::vector<SoNode*> {
     public:
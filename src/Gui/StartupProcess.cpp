@@ -216,9 +216,12 @@ void StartupPostProcess::execute()
     setQtStyle();
     checkOpenGL();
     loadOpenInventor();
+    App::Application::addStartupPhase("Load Open Inventor");
     setBranding();
     showMainWindow();
+    App::Application::addStartupPhase("Show main window");
     activateWorkbench();
+    App::Application::addStartupPhase("Activate workbench");
     checkParameters();
 }
 
@@ -29,6 +29,9 @@
 # include <QDateTime>
 # include <QImage>
 # include <QThread>
+# include <Inventor/SoRenderManager.h>
+# include <Inventor/nodes/SoCamera.h>
+# include <Inventor/nodes/SoNode.h>
 #endif
 
 #include <App/Application.h>
@@ -91,8 +94,7 @@ void Thumbnail::SaveDocFile (Base::Writer &writer) const
         return;
     }
 
-    QColor invalid;
-    this->viewer->imageFromFramebuffer(this->size, this->size, 4, invalid, img);
+    img = renderImage();
 
     // Get app icon and resize to half size to insert in topbottom position over the current view snapshot
     QPixmap appIcon = Gui::BitmapFactory().pixmap(App::Application::Config()["AppIcon"].c_str());
@@ -127,6 +129,32 @@ void Thumbnail::SaveDocFile (Base::Writer &writer) const
     }
 }
 
+QImage Thumbnail::renderImage() const
+{
+    // Saving an unchanged document again, e.g. by the auto saver, doesn't need a new image. A
+    // change anywhere in the scene graph or of the camera gives the changed node a new id.
+    SoRenderManager* renderManager = this->viewer->getSoRenderManager();
+    auto currentKey = [this, renderManager]() {
+        SoNode* scene = renderManager->getSceneGraph();
+        SoCamera* camera = renderManager->getCamera();
+        return ImageKey {this->viewer,
+                         scene ? static_cast<std::uint32_t>(scene->getNodeId()) : 0,
+                         camera ? static_cast<std::uint32_t>(camera->getNodeId()) : 0,
+                         this->size};
+    };
+    if (!cachedImage.isNull() && cachedKey == currentKey()) {
+        return cachedImage;
+    }
+
+    QImage img;
+    QColor invalid;
+    this->viewer->imageFromFramebuffer(this->size, this->size, 4, invalid, img);
+    // take the ids after rendering as it may update nodes
+    cachedImage = img;
+    cachedKey = currentKey();
+    return img;
+}
+
 void Thumbnail::RestoreDocFile(Base::Reader &reader)
 {
     Q_UNUSED(reader);
@@ -24,11 +24,11 @@
 #ifndef GUI_THUMBNAIL_H
 #define GUI_THUMBNAIL_H
 
+#include <cstdint>
 #include <Base/Persistence.h>
+#include <QImage>
 #include <QUrl>
 
-class QImage;
-
 namespace Gui {
 class View3DInventorViewer;
 
@@ -56,9 +56,24 @@ public:
     //@}
 
 private:
+    /// What the cached image was rendered from, see SoNode::getNodeId()
+    struct ImageKey
+    {
+        const View3DInventorViewer* viewer = nullptr;
+        std::uint32_t sceneId = 0;
+        std::uint32_t cameraId = 0;
+        int size = 0;
+        bool operator==(const ImageKey&) const = default;
+    };
+
+    QImage renderImage() const;
+
     QUrl uri;
     View3DInventorViewer* viewer{nullptr};
     int size;
+    /// The image of the last save is reused as long as the scene and the camera are unchanged
+    mutable QImage cachedImage;
+    mutable ImageKey cachedKey;
 };
 
 }
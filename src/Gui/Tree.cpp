@@ -618,6 +618,9 @@ TreeWidget::TreeWidget(const char* name, QWidget* parent)
     , currentDocItem(nullptr)
     , myName(name)
 {
+    // the selection is synchronized from the whole selection anyway
+    setReceiveBatch(true);
+
     Instances.insert(this);
     if (!_LastSelectedTreeWidget)
         _LastSelectedTreeWidget = this;
@@ -4035,6 +4038,7 @@ void TreeWidget::_slotDeleteObject(const Gui::ViewProviderDocumentObject& view,
 
         for (auto cit = items.begin(), citNext = cit; cit != items.end(); cit = citNext) {
             ++citNext;
+            docItem->SelectedItems.erase(*cit);
             (*cit)->myOwner = nullptr;
             delete* cit;
         }
@@ -4744,9 +4748,9 @@ void DocumentItem::clearSelection(DocumentObjectItem* exclude)
     _v.second->dirtyFlag = false;
     if (item == exclude) {
         if (item->selected > 0)
-            item->selected = -1;
+            item->setSelectedState(-1);
         else
-            item->selected = 0;
+            item->setSelectedState(0);
         updateItemSelection(item);
         // The set has been changed while calling updateItemSelection
         // so that the iterator has become invalid -> Abort
@@ -4755,7 +4759,7 @@ void DocumentItem::clearSelection(DocumentObjectItem* exclude)
         }
     }
     else {
-        item->selected = 0;
+        item->setSelectedState(0);
         item->mySubs.clear();
         item->setSelected(false);
         item->setCheckState(false);
@@ -4810,7 +4814,7 @@ void DocumentItem::updateItemSelection(DocumentObjectItem* item)
     }
     if (item->selected != -1)
         item->mySubs.clear();
-    item->selected = selected;
+    item->setSelectedState(selected);
 
     auto obj = item->object()->getObject();
     if (!obj || !obj->isAttachedToDocument())
@@ -4854,7 +4858,7 @@ void DocumentItem::updateItemSelection(DocumentObjectItem* item)
             // Safely re-access the item
             DocumentObjectItem* item2 = findItem(vobj->getObject(), subname);
             if (item2) {
-                item2->selected = 0;
+                item2->setSelectedState(0);
                 item2->setSelected(false);
                 item2->setCheckState(false);
             }
@@ -4987,7 +4991,7 @@ DocumentObjectItem* DocumentItem::findItem(
 
     if (!subname || *subname == 0) {
         if (select) {
-            item->selected += 2;
+            item->setSelectedState(item->selected + 2);
             item->mySubs.clear();
         }
         return item;
@@ -5002,7 +5006,7 @@ DocumentObjectItem* DocumentItem::findItem(
         nextsub = dot + 1;
     else {
         if (select) {
-            item->selected += 2;
+            item->setSelectedState(item->selected + 2);
             if (std::ranges::find(item->mySubs, subname) == item->mySubs.end()) {
                 item->mySubs.emplace_back(subname);
             }
@@ -5017,7 +5021,7 @@ DocumentObjectItem* DocumentItem::findItem(
         if (!subObj && !getTree()->searchDoc)
             TREE_LOG("sub object not found " << item->getName() << '.' << name.c_str());
         if (select) {
-            item->selected += 2;
+            item->setSelectedState(item->selected + 2);
             if (std::ranges::find(item->mySubs, subname) == item->mySubs.end())
                 item->mySubs.emplace_back(subname);
         }
@@ -5062,7 +5066,7 @@ DocumentObjectItem* DocumentItem::findItem(
         // The sub object is still not found. Maybe it is a non-object sub-element.
         // Select the current object instead.
         TREE_TRACE("element " << subname << " not found");
-        item->selected += 2;
+        item->setSelectedState(item->selected + 2);
         if (std::ranges::find(item->mySubs, subname) == item->mySubs.end())
             item->mySubs.emplace_back(subname);
     }
@@ -5080,11 +5084,16 @@ void DocumentItem::selectItems(SelectionReason reason) {
     DocumentObjectItem* newSelect = nullptr;
     DocumentObjectItem* oldSelect = nullptr;
 
-    FOREACH_ITEM_ALL(item)
+    // Only the items of the old and the new selection have to be updated. Expanding
+    // an item may delete other items, those are no longer in the set.
+    std::vector<DocumentObjectItem*> items(SelectedItems.begin(), SelectedItems.end());
+    for (auto item : items) {
+        if (!SelectedItems.contains(item))
+            continue;
         if (item->selected == 1) {
             // this means it is the old selection and is not in the current
             // selection
-            item->selected = 0;
+            item->setSelectedState(0);
             item->mySubs.clear();
             item->setSelected(false);
             item->setCheckState(false);
@@ -5108,11 +5117,11 @@ void DocumentItem::selectItems(SelectionReason reason) {
                         oldSelect = item;
                 }
             }
-            item->selected = 1;
+            item->setSelectedState(1);
             item->setSelected(true);
             item->setCheckState(true);
         }
-    END_FOREACH_ITEM;
+    }
 
     if (sync) {
         if (!newSelect)
@@ -5253,6 +5262,9 @@ DocumentObjectItem::~DocumentObjectItem()
     TREE_LOG("Delete item: " << countItems << ", " << object()->getObject()->getFullName());
     myData->removeItem(this);
 
+    if (myOwner)
+        myOwner->SelectedItems.erase(this);
+
     if (myData->rootItem == this)
         myData->rootItem = nullptr;
 
@@ -5872,6 +5884,16 @@ App::DocumentObject* DocumentObjectItem::getRelativeParent(
     return nullptr;
 }
 
+void DocumentObjectItem::setSelectedState(int state) {
+    selected = state;
+    if (!myOwner)
+        return;
+    if (state)
+        myOwner->SelectedItems.insert(this);
+    else
+        myOwner->SelectedItems.erase(this);
+}
+
 void DocumentObjectItem::setCheckState(bool checked) {
     if (isSelectionCheckBoxesEnabled())
         QTreeWidgetItem::setCheckState(0, checked ? Qt::Checked : Qt::Unchecked);
@@ -25,6 +25,7 @@
 #define GUI_TREE_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <QElapsedTimer>
 #include <QStyledItemDelegate>
 #include <QTreeWidget>
@@ -379,6 +380,8 @@ private:
     std::unordered_map<App::DocumentObject*,DocumentObjectDataPtr> ObjectMap;
     std::unordered_map<App::DocumentObject*, std::set<App::DocumentObject*> > _ParentMap;
     std::vector<App::DocumentObject*> PopulateObjects;
+    // the items with a selection state, so that not all items have to be visited
+    std::unordered_set<DocumentObjectItem*> SelectedItems;
 
     ExpandInfoPtr _ExpandInfo;
     void restoreItemExpansion(const ExpandInfoPtr &, DocumentObjectItem *);
@@ -470,6 +473,7 @@ public:
 
 private:
     void setCheckState(bool checked);
+    void setSelectedState(int state);
     void getExpandedSnapshot(std::vector<bool>& snapshot) const;
     void applyExpandedSnapshot(const std::vector<bool>& snapshot, std::vector<bool>::const_iterator& from);
 
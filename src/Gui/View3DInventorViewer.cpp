@@ -34,6 +34,7 @@
 # include <GL/glu.h>
 # endif
 
+# include <array>
 # include <fmt/format.h>
 
 # include <Inventor/SbBox.h>
@@ -47,6 +48,7 @@
 # include <Inventor/annex/Profiler/SoProfiler.h>
 # include <Inventor/annex/Profiler/elements/SoProfilerElement.h>
 # include <Inventor/details/SoDetail.h>
+# include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoLightModelElement.h>
 # include <Inventor/elements/SoOverrideElement.h>
 # include <Inventor/elements/SoViewportRegionElement.h>
@@ -55,6 +57,7 @@
 # include <Inventor/events/SoKeyboardEvent.h>
 # include <Inventor/events/SoMotion3Event.h>
 # include <Inventor/manips/SoClipPlaneManip.h>
+# include <Inventor/misc/SoContextHandler.h>
 # include <Inventor/nodes/SoAnnotation.h>
 # include <Inventor/nodes/SoBaseColor.h>
 # include <Inventor/nodes/SoCallback.h>
@@ -422,6 +425,7 @@ void View3DInventorViewer::init()
     shading = true;
     fpsEnabled = false;
     vboEnabled = false;
+    idBufferCacheContext = SoGLCacheContextElement::getUniqueCacheContext();
 
     attachSelection();
 
@@ -761,6 +765,11 @@ void View3DInventorViewer::aboutToDestroyGLContext()
         naviCube = nullptr;
         naviCubeEnabled = false;
     }
+
+    if (auto gl = qobject_cast<QOpenGLWidget*>(this->viewport())) {
+        gl->makeCurrent();
+        SoContextHandler::destructingContext(idBufferCacheContext);
+    }
 }
 
 void View3DInventorViewer::setDocument(Gui::Document* pcDocument)
@@ -905,6 +914,29 @@ void View3DInventorViewer::addViewProvider(ViewProvider* pcProvider)
     _ViewProviderSet.insert(pcProvider);
 }
 
+void View3DInventorViewer::addViewProviders(const std::vector<ViewProvider*>& providers)
+{
+    // Every added child would notify the scene and invalidate its caches, so
+    // notify only once when all of them are in place
+    if (providers.empty()) {
+        return;
+    }
+    std::array<SoNode*, 4> groups {objectGroup, pcViewProviderRoot, foregroundroot, backgroundroot};
+    std::array<SbBool, 4> notify {};
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        notify[i] = groups[i]->enableNotify(false);
+    }
+
+    for (auto pcProvider : providers) {
+        addViewProvider(pcProvider);
+    }
+
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        groups[i]->enableNotify(notify[i]);
+        groups[i]->touch();
+    }
+}
+
 void View3DInventorViewer::removeViewProvider(ViewProvider* pcProvider)
 {
     if (this->editViewProvider == pcProvider) {
@@ -2322,6 +2354,74 @@ void View3DInventorViewer::renderToFramebuffer(QOpenGLFramebufferObject* fbo)
     fbo->release();
 }
 
+void View3DInventorViewer::updateIdBuffer()
+{
+    if (!ViewParams::instance()->getUseIdBufferPicking()) {
+        selectionRoot->clearIdBuffer();
+        return;
+    }
+
+    SoNode* scene = this->getSoRenderManager()->getSceneGraph();
+    const SbViewportRegion vp = this->getSoRenderManager()->getViewportRegion();
+    if (!scene || idBufferPending || selectionRoot->isIdBufferValid(scene, vp)) {
+        return;
+    }
+
+    // render the buffer once the view has stopped changing
+    idBufferPending = true;
+    QTimer::singleShot(200, this, [this]() {  // NOLINT
+        idBufferPending = false;
+        renderIdBuffer();
+    });
+}
+
+void View3DInventorViewer::renderIdBuffer()
+{
+    SoNode* scene = this->getSoRenderManager()->getSceneGraph();
+    const SbViewportRegion vp = this->getSoRenderManager()->getViewportRegion();
+    if (!scene || selectionRoot->isIdBufferValid(scene, vp)) {
+        return;
+    }
+
+    // the next redraw schedules it again
+    if (isAnimating() || navigation->getViewingMode() != NavigationStyle::IDLE) {
+        return;
+    }
+
+    static_cast<QOpenGLWidget*>(this->viewport())->makeCurrent();  // NOLINT
+    SbVec2s size = vp.getViewportSizePixels();
+    int width = size[0];
+    int height = size[1];
+    QOpenGLFramebufferObject fbo(width, height, QOpenGLFramebufferObject::Depth);
+    fbo.bind();
+
+    // the ids must be written unchanged
+    glPushAttrib(GL_ALL_ATTRIB_BITS);
+    glDisable(GL_BLEND);
+    glDisable(GL_DITHER);
+    glDisable(GL_LINE_SMOOTH);
+    glDisable(GL_POINT_SMOOTH);
+    glDisable(GL_POLYGON_SMOOTH);
+    glEnable(GL_DEPTH_TEST);
+    glViewport(0, 0, width, height);
+    glClearColor(0.0F, 0.0F, 0.0F, 0.0F);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Use an own cache context so that the caches of the normal rendering don't
+    // replay the real colors.
+    SoGLRenderAction gl(SbViewportRegion(width, height));
+    gl.setCacheContext(idBufferCacheContext);
+    gl.setTransparencyType(SoGLRenderAction::NONE);
+    selectionRoot->renderIdBuffer(&gl, scene);
+
+    std::vector<unsigned char> pixels(std::size_t(width) * std::size_t(height) * 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glPopAttrib();
+    fbo.release();
+
+    selectionRoot->setIdBuffer(scene, vp, std::move(pixels), getPickRadius());
+}
+
 void View3DInventorViewer::actualRedraw()
 {
     switch (renderType) {
@@ -2512,6 +2612,8 @@ void View3DInventorViewer::renderScene()
         this->getSoRenderManager()->scheduleRedraw();
     }
 
+    updateIdBuffer();
+
     printDimension();
 
     {
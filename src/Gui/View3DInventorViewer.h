@@ -218,6 +218,8 @@ public:
     bool containsViewProvider(const ViewProvider*) const;
     /// adds an ViewProvider to the view, e.g. from a feature
     void addViewProvider(ViewProvider*);
+    /// adds several ViewProviders with a single notification of the scene
+    void addViewProviders(const std::vector<ViewProvider*>&);
     /// remove a ViewProvider
     void removeViewProvider(ViewProvider*);
     /// get view provider by path
@@ -511,6 +513,8 @@ private:
     void setCursorRepresentation(int mode);
     void aboutToDestroyGLContext();
     void createStandardCursors(double);
+    void updateIdBuffer();
+    void renderIdBuffer();
 
 private:
     NaviCube* naviCube;
@@ -547,6 +551,9 @@ private:
     RenderType renderType;
     QOpenGLFramebufferObject* framebuffer;
     QImage glImage;
+    // cache context of the ID buffer used for picking
+    uint32_t idBufferCacheContext;
+    bool idBufferPending = false;
     bool shading;
     SoSwitch *dimensionRoot;
 
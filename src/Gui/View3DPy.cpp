@@ -114,6 +114,9 @@ void View3DInventorPy::init_type()
     add_noargs_method("stopAnimating",&View3DInventorPy::stopAnimating,"stopAnimating()");
     add_varargs_method("setAnimationEnabled",&View3DInventorPy::setAnimationEnabled,"setAnimationEnabled()");
     add_noargs_method("isAnimationEnabled",&View3DInventorPy::isAnimationEnabled,"isAnimationEnabled()");
+    add_noargs_method("getFramesPerSecond",&View3DInventorPy::getFramesPerSecond,
+        "getFramesPerSecond() -> tuple\n"
+        "Returns the averaged draw time in milliseconds and the frames per second.");
     add_varargs_method("setPopupMenuEnabled",&View3DInventorPy::setPopupMenuEnabled,"setPopupMenuEnabled()");
     add_noargs_method("isPopupMenuEnabled",&View3DInventorPy::isPopupMenuEnabled,"isPopupMenuEnabled()");
     add_varargs_method("dump",&View3DInventorPy::dump,"dump(filename, [onlyVisible=False])");
@@ -146,6 +149,16 @@ void View3DInventorPy::init_type()
         "\n"
         "Return the current cursor position relative to the coordinate system of the\n"
         "viewport region.\n");
+    add_noargs_method("getFrameStatistics",&View3DInventorPy::getFrameStatistics,
+        "getFrameStatistics() -> dictionary\n"
+        "\n"
+        "Return the number of rendered frames, of requested redraws and of the\n"
+        "redraws merged into a later frame, together with the last, average and\n"
+        "maximum render time in milliseconds.\n");
+    add_noargs_method("resetFrameStatistics",&View3DInventorPy::resetFrameStatistics,
+        "resetFrameStatistics()\n"
+        "\n"
+        "Reset the frame statistics.\n");
     add_varargs_method("getObjectInfo",&View3DInventorPy::getObjectInfo,
         "getObjectInfo(tuple(int,int), [pick_radius]) -> dictionary or None\n"
         "\n"
@@ -847,6 +860,12 @@ Py::Object View3DInventorPy::isAnimationEnabled()
     return Py::Boolean(ok ? true : false);
 }
 
+Py::Object View3DInventorPy::getFramesPerSecond()
+{
+    SbVec2f fps = getView3DInventorPtr()->getViewer()->getFramesPerSecond();
+    return Py::TupleN(Py::Float(fps[0]), Py::Float(fps[1]));
+}
+
 Py::Object View3DInventorPy::setPopupMenuEnabled(const Py::Tuple& args)
 {
     int ok;
@@ -1291,6 +1310,25 @@ Py::Object View3DInventorPy::getCursorPos()
     }
 }
 
+Py::Object View3DInventorPy::getFrameStatistics()
+{
+    auto stats = getView3DInventorPtr()->getViewer()->getFrameStatistics();
+    Py::Dict dict;
+    dict.setItem("Frames", Py::Long(stats.frames));
+    dict.setItem("Requests", Py::Long(stats.requests));
+    dict.setItem("Coalesced", Py::Long(stats.coalesced));
+    dict.setItem("LastTime", Py::Float(stats.lastTime));
+    dict.setItem("AverageTime", Py::Float(stats.averageTime));
+    dict.setItem("MaxTime", Py::Float(stats.maxTime));
+    return dict;
+}
+
+Py::Object View3DInventorPy::resetFrameStatistics()
+{
+    getView3DInventorPtr()->getViewer()->resetFrameStatistics();
+    return Py::None();
+}
+
 Py::Object View3DInventorPy::getObjectInfo(const Py::Tuple& args)
 {
     PyObject* object;
@@ -71,6 +71,7 @@ public:
     Py::Object stopAnimating();
     Py::Object setAnimationEnabled(const Py::Tuple&);
     Py::Object isAnimationEnabled();
+    Py::Object getFramesPerSecond();
     Py::Object setPopupMenuEnabled(const Py::Tuple&);
     Py::Object isPopupMenuEnabled();
     Py::Object dump(const Py::Tuple&);
@@ -92,6 +93,8 @@ public:
     Py::Object getCameraNode();
     Py::Object listCameraTypes();
     Py::Object getCursorPos();
+    Py::Object getFrameStatistics();
+    Py::Object resetFrameStatistics();
     Py::Object getObjectInfo(const Py::Tuple&);
     Py::Object getObjectsInfo(const Py::Tuple&);
     Py::Object getSize();
@@ -98,6 +98,7 @@ void View3DSettings::applySettings()
     OnChange(*hGrp,"AxisZColor");
     OnChange(*hGrp,"UseVBO");
     OnChange(*hGrp,"RenderCache");
+    OnChange(*hGrp,"FramePacing");
     OnChange(*hGrp,"Orthographic");
 
     auto lightSourcesGrp = hGrp->GetGroup("LightSources");
@@ -451,6 +452,11 @@ void View3DSettings::OnChange(ParameterGrp::SubjectType &rCaller,ParameterGrp::M
             }
         }
     }
+    else if (strcmp(Reason,"FramePacing") == 0) {
+        for (auto _viewer : _viewers) {
+            _viewer->setFramePacing(rGrp.GetBool("FramePacing", true));
+        }
+    }
     else if (strcmp(Reason,"Orthographic") == 0) {
         // check whether a perspective or orthogrphic camera should be set
         if (rGrp.GetBool("Orthographic", true)) {
@@ -46,6 +46,9 @@ public:
 #define FC_VIEW_PARAMS \
     FC_VIEW_PARAM(UseNewSelection,bool,Bool,true) \
     FC_VIEW_PARAM(UseSelectionRoot,bool,Bool,true) \
+    FC_VIEW_PARAM(UseIdBufferPicking,bool,Bool,false) \
+    FC_VIEW_PARAM(RenderOptimization,bool,Bool,false) \
+    FC_VIEW_PARAM(LevelOfDetailSize,double,Float,16.0) \
     FC_VIEW_PARAM(EnableSelection,bool,Bool,true) \
     FC_VIEW_PARAM(RenderCache,int,Int,0) \
     FC_VIEW_PARAM(RandomColor,bool,Bool,false) \
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <unordered_set>
 # include <QApplication>
 # include <QTimer>
 # include <Inventor/SoPickedPoint.h>
@@ -31,6 +32,12 @@
 # include <Inventor/events/SoKeyboardEvent.h>
 # include <Inventor/events/SoLocation2Event.h>
 # include <Inventor/events/SoMouseButtonEvent.h>
+# include <Inventor/fields/SoMFColor.h>
+# include <Inventor/fields/SoMFInt32.h>
+# include <Inventor/fields/SoMFVec2f.h>
+# include <Inventor/fields/SoMFVec3f.h>
+# include <Inventor/fields/SoMFVec4f.h>
+# include <Inventor/lists/SoFieldList.h>
 # include <Inventor/nodes/SoSeparator.h>
 # include <Inventor/nodes/SoSwitch.h>
 # include <Inventor/nodes/SoTransform.h>
@@ -1010,6 +1017,51 @@ void ViewProvider::setRenderCacheMode(int mode) {
         mode==0?SoSeparator::AUTO:(mode==1?SoSeparator::ON:SoSeparator::OFF);
 }
 
+static std::size_t fieldValueSize(const SoMField* field)
+{
+    if (field->isOfType(SoMFVec3f::getClassTypeId()) || field->isOfType(SoMFColor::getClassTypeId()))
+        return 3 * sizeof(float);
+    if (field->isOfType(SoMFVec2f::getClassTypeId()))
+        return 2 * sizeof(float);
+    if (field->isOfType(SoMFVec4f::getClassTypeId()))
+        return 4 * sizeof(float);
+    if (field->isOfType(SoMFInt32::getClassTypeId()))
+        return sizeof(int32_t);
+    return sizeof(void*);
+}
+
+static std::size_t nodeMemSize(SoNode* node, std::unordered_set<SoNode*>& visited)
+{
+    if (!node || !visited.insert(node).second)
+        return 0;
+
+    std::size_t size = sizeof(SoNode);
+    SoFieldList fields;
+    int count = node->getFields(fields);
+    for (int i = 0; i < count; ++i) {
+        SoField* field = fields[i];
+        if (field->isOfType(SoMField::getClassTypeId())) {
+            auto mfield = static_cast<SoMField*>(field);
+            size += mfield->getNum() * fieldValueSize(mfield);
+        }
+        else {
+            size += sizeof(SoField);
+        }
+    }
+    if (node->isOfType(SoGroup::getClassTypeId())) {
+        auto group = static_cast<SoGroup*>(node);
+        for (int i = 0; i < group->getNumChildren(); ++i)
+            size += nodeMemSize(group->getChild(i), visited);
+    }
+    return size;
+}
+
+std::size_t ViewProvider::getSceneGraphMemSize() const
+{
+    std::unordered_set<SoNode*> visited;
+    return nodeMemSize(pcRoot, visited);
+}
+
 Base::BoundBox3d ViewProvider::getBoundingBox(const char *subname, bool transform, MDIView *view) const {
     if(!pcRoot || !pcModeSwitch || pcRoot->findChild(pcModeSwitch)<0)
         return Base::BoundBox3d();
@@ -220,6 +220,12 @@ public:
      */
     Base::BoundBox3d getBoundingBox(const char *subname=nullptr, bool transform=true, MDIView *view=nullptr) const;
 
+    /** Returns the estimated memory consumption of the scene graph in bytes.
+     * It is dominated by the values of the multiple-value fields like
+     * coordinates and indices. Nodes shared within the graph count once.
+     */
+    std::size_t getSceneGraphMemSize() const;
+
     /**
      * Get called if the object is about to get deleted.
      * Here you can delete other objects, switch their visibility or prevent the deletion of the object.
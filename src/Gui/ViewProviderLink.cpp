@@ -1336,8 +1336,8 @@ void LinkView::updateLink() {
     for(const auto &v : subInfo) {
         auto &sub = *v.second;
         Base::Matrix4D mat;
-        App::DocumentObject *sobj = obj->getSubObject(
-                v.first.c_str(), nullptr, &mat, nodeType==SnapshotContainer);
+        App::DocumentObject *sobj = obj->getSubObjectCached(
+                v.first.c_str(), &mat, nodeType==SnapshotContainer);
         if(!sobj) {
             sub.unlink();
             continue;
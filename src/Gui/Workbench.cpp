@@ -733,6 +733,7 @@ MenuItem* StdWorkbench::setupMenuBar() const
           << "Std_SceneInspector"
           << "Std_DependencyGraph"
           << "Std_ExportDependencyGraph"
+          << "Std_MemoryReport"
           << "Separator"
           << "Std_ProjectUtil"
           << "Std_DlgParameter"
@@ -24,6 +24,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <chrono>
 #include <cmath>
 #include <vector>
 #include <unordered_map>
@@ -42,6 +43,7 @@
 #include <Base/Tools.h>
 #include <Base/Interpreter.h>
 
+#include <Mod/Part/App/PartFeature.h>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/AttachExtension.h>
 
@@ -83,7 +85,10 @@
 #include "AssemblyObject.h"
 #include "AssemblyObjectPy.h"
 #include "AssemblyUtils.h"
+#include "BomGroup.h"
+#include "InterferenceCheck.h"
 #include "JointGroup.h"
+#include "SimulationGroup.h"
 #include "ViewGroup.h"
 
 FC_LOG_LEVEL_INIT("Assembly", true, true, true)
@@ -102,6 +107,9 @@ PROPERTY_SOURCE(Assembly::AssemblyObject, App::Part)
 AssemblyObject::AssemblyObject()
     : mbdAssembly(std::make_shared<ASMTAssembly>())
     , bundleFixed(false)
+    , dragModelValid(false)
+    , updatingDocument(false)
+    , dragStepTime(0.0)
 {
     mbdAssembly->externalSystem->freecadAssemblyObject = this;
 }
@@ -129,8 +137,58 @@ App::DocumentObjectExecReturn* AssemblyObject::execute()
     return ret;
 }
 
+void AssemblyObject::onSettingDocument()
+{
+    App::Document* doc = getDocument();
+    if (doc) {
+        connChangedObject = doc->signalChangedObject.connect(
+            [this](const App::DocumentObject& obj, const App::Property& prop) {
+                slotChangedObject(obj, prop);
+            });
+        connDeletedObject = doc->signalDeletedObject.connect([this](const App::DocumentObject&) {
+            dragModelValid = false;
+        });
+    }
+
+    App::Part::onSettingDocument();
+}
+
+void AssemblyObject::unsetupObject()
+{
+    connChangedObject.disconnect();
+    connDeletedObject.disconnect();
+
+    App::Part::unsetupObject();
+}
+
+void AssemblyObject::slotChangedObject(const App::DocumentObject& obj, const App::Property& prop)
+{
+    if (!dragModelValid || updatingDocument) {
+        return;
+    }
+    // e.g. the visibility of the joints that is toggled while dragging
+    if (prop.testStatus(App::Property::Output) || (prop.getType() & App::Prop_Output)) {
+        return;
+    }
+
+    // A part that moved freely is updated by the next preDrag(). Any other change, including
+    // the placement of a grounded part or of a part bundled to another one, needs a new model.
+    if (obj.getPropertyByName("Placement") == &prop) {
+        auto it = objectPartMap.find(const_cast<App::DocumentObject*>(&obj));
+        if (it != objectPartMap.end() && it->second.part
+            && it->second.part->name == obj.getFullName()
+            && dragGroundedParts.count(it->first) == 0) {
+            return;
+        }
+    }
+    dragModelValid = false;
+}
+
 int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 {
+    Base::StateLocker lock(updatingDocument);
+    dragModelValid = false;
+
     ensureIdentityPlacements();
 
     mbdAssembly = makeMbdAssembly();
@@ -174,6 +232,7 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 
 int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 {
+    dragModelValid = false;
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
 
@@ -246,9 +305,22 @@ size_t Assembly::AssemblyObject::numberOfFrames()
 
 void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
 {
-    bundleFixed = true;
-    solve();
-    bundleFixed = false;
+    if (dragModelValid) {
+        // Nothing but the placements of the parts changed since the last drag, so the solver
+        // starts from where the parts are now.
+        updateMbdPlacements();
+    }
+    else {
+        bundleFixed = true;
+        int status = solve();
+        bundleFixed = false;
+
+        if (status == 0) {
+            dragGroundedParts = getGroundedParts();
+            dragModelValid = true;
+        }
+    }
+    dragJoints = getJoints(false);
 
     draggedParts.clear();
     for (auto part : dragParts) {
@@ -309,16 +381,19 @@ void AssemblyObject::doDragStep()
                 ->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
         }
 
-        // Timing mbdAssembly->runDragStep()
         auto dragPartsVec = std::make_shared<std::vector<std::shared_ptr<ASMTPart>>>(dragMbdParts);
+        auto start = std::chrono::steady_clock::now();
         mbdAssembly->runDragStep(dragPartsVec);
+        std::chrono::duration<double, std::milli> duration =
+            std::chrono::steady_clock::now() - start;
+        dragStepTime = duration.count();
+        FC_LOG("Drag step solved in " << dragStepTime << " ms");
 
-        // Timing the validation and placement setting
         if (validateNewPlacements()) {
+            Base::StateLocker lock(updatingDocument);
             setNewPlacements();
 
-            auto joints = getJoints(false);
-            for (auto* joint : joints) {
+            for (auto* joint : dragJoints) {
                 if (joint->Visibility.getValue()) {
                     // redraw only the moving joint as its quite slow as its python code.
                     redrawJointPlacement(joint);
@@ -384,6 +459,32 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+    dragJoints.clear();
+}
+
+void AssemblyObject::updateMbdPlacements()
+{
+    for (auto& pair : objectPartMap) {
+        App::DocumentObject* obj = pair.first;
+        std::shared_ptr<ASMTPart> mbdPart = pair.second.part;
+
+        // The other objects of a bundle follow the object the ASMTPart was made for.
+        if (!obj || !mbdPart || mbdPart->name != obj->getFullName()) {
+            continue;
+        }
+
+        Base::Placement plc = getPlacementFromProp(obj, "Placement");
+        Base::Vector3d pos = plc.getPosition();
+        mbdPart->setPosition3D(pos.x, pos.y, pos.z);
+
+        Base::Rotation rot = plc.getRotation();
+        Base::Matrix4D mat;
+        rot.getValue(mat);
+        Base::Vector3d r0 = mat.getRow(0);
+        Base::Vector3d r1 = mat.getRow(1);
+        Base::Vector3d r2 = mat.getRow(2);
+        mbdPart->setRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+    }
 }
 
 void AssemblyObject::savePlacementsForUndo()
@@ -444,6 +545,7 @@ void AssemblyObject::clearUndo()
 
 void AssemblyObject::exportAsASMT(std::string fileName)
 {
+    dragModelValid = false;
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     fixGroundedParts();
@@ -455,6 +557,39 @@ void AssemblyObject::exportAsASMT(std::string fileName)
     mbdAssembly->outputFile(fileName);
 }
 
+std::vector<InterferencePair>
+AssemblyObject::checkInterference(std::vector<App::DocumentObject*> parts) const
+{
+    if (parts.empty()) {
+        for (auto* obj : Group.getValues()) {
+            if (obj->isDerivedFrom<JointGroup>() || obj->isDerivedFrom<ViewGroup>()
+                || obj->isDerivedFrom<BomGroup>() || obj->isDerivedFrom<SimulationGroup>()
+                || obj->isDerivedFrom<App::LocalCoordinateSystem>()
+                || obj->isDerivedFrom<App::DatumElement>()) {
+                continue;
+            }
+            parts.push_back(obj);
+        }
+    }
+
+    InterferenceCheck check;
+    for (auto* part : parts) {
+        if (!part) {
+            continue;
+        }
+        TopoDS_Shape shape = PartApp::Feature::getShape(
+            part,
+            PartApp::ShapeOption::ResolveLink | PartApp::ShapeOption::Transform);
+        check.addPart(part, shape);
+    }
+
+    std::vector<InterferencePair> result = check.perform();
+    FC_LOG("Interference check: " << check.countBroadphasePairs() << " pairs of bounding boxes, "
+                                  << check.countMidphasePairs() << " of them with overlapping "
+                                  << "triangulations, " << result.size() << " interferences");
+    return result;
+}
+
 void AssemblyObject::setNewPlacements()
 {
     for (auto& pair : objectPartMap) {
@@ -671,7 +806,8 @@ AssemblyObject::getJoints(bool updateJCS, bool delBadJoints, bool subJoints)
     // add sub assemblies joints.
     if (subJoints) {
         for (auto& assembly : getSubAssemblies()) {
-            auto subJoints = assembly->getJoints();
+            // recomputeJointPlacements() below updates these as well
+            auto subJoints = assembly->getJoints(false);
             joints.insert(joints.end(), subJoints.begin(), subJoints.end());
         }
     }
@@ -59,6 +59,7 @@ namespace Assembly
 {
 
 class AssemblyLink;
+struct InterferencePair;
 class JointGroup;
 class ViewGroup;
 enum class JointType;
@@ -95,15 +96,27 @@ public:
     int generateSimulation(App::DocumentObject* sim);
     int updateForFrame(size_t index, bool updateJCS = true);
     size_t numberOfFrames();
+    /* Prepare the solver for dragging. The model built for the previous drag is reused if
+    nothing in the document changed since, the parts then start from their current placements.*/
     void preDrag(std::vector<App::DocumentObject*> dragParts);
     void doDragStep();
     void postDrag();
+    /// The time the solver took for the last drag step in milliseconds
+    double getDragStepTime() const
+    {
+        return dragStepTime;
+    }
     void savePlacementsForUndo();
     void undoSolve();
     void clearUndo();
 
     void exportAsASMT(std::string fileName);
 
+    /* Find the parts that interfere with each other, see InterferenceCheck. If parts is empty all
+    the parts of the assembly are checked.*/
+    std::vector<InterferencePair>
+    checkInterference(std::vector<App::DocumentObject*> parts = {}) const;
+
     Base::Placement getMbdPlacement(std::shared_ptr<MbD::ASMTPart> mbdPart);
     bool validateNewPlacements();
     void setNewPlacements();
@@ -188,17 +201,35 @@ public:
 
     std::vector<App::DocumentObject*> getMotionsFromSimulation(App::DocumentObject* sim);
 
+protected:
+    void onSettingDocument() override;
+    void unsetupObject() override;
+
 private:
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+    void updateMbdPlacements();
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
 
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
     std::vector<std::pair<App::DocumentObject*, double>> objMasses;
     std::vector<App::DocumentObject*> draggedParts;
+    std::vector<App::DocumentObject*> dragJoints;
+    std::unordered_set<App::DocumentObject*> dragGroundedParts;
     std::vector<App::DocumentObject*> motions;
 
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
 
     bool bundleFixed;
+
+    // Whether mbdAssembly is the bundled model of the last drag and the document hasn't changed
+    bool dragModelValid;
+    // Set while the solver writes its results, these changes don't invalidate the drag model
+    bool updatingDocument;
+    double dragStepTime;
+
+    boost::signals2::scoped_connection connChangedObject;
+    boost::signals2::scoped_connection connDeletedObject;
 };
 
 }  // namespace Assembly
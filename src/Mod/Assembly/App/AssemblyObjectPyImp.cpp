@@ -24,6 +24,8 @@
 
 #include "PreCompiled.h"
 
+#include "InterferenceCheck.h"
+
 // inclusion of the generated files (generated out of AssemblyObject.xml)
 #include "AssemblyObjectPy.h"
 #include "AssemblyObjectPy.cpp"
@@ -189,6 +191,45 @@ PyObject* AssemblyObjectPy::exportAsASMT(PyObject* args) const
     Py_Return;
 }
 
+PyObject* AssemblyObjectPy::checkInterference(PyObject* args) const
+{
+    PyObject* pyParts = Py_None;
+    if (!PyArg_ParseTuple(args, "|O", &pyParts)) {
+        return nullptr;
+    }
+
+    std::vector<App::DocumentObject*> parts;
+    if (pyParts != Py_None) {
+        if (!PySequence_Check(pyParts)) {
+            PyErr_SetString(PyExc_TypeError, "Expected a list of document objects");
+            return nullptr;
+        }
+        Py::Sequence list(pyParts);
+        for (const auto& item : list) {
+            if (!PyObject_TypeCheck(item.ptr(), &(App::DocumentObjectPy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "Expected a list of document objects");
+                return nullptr;
+            }
+            parts.push_back(
+                static_cast<App::DocumentObjectPy*>(item.ptr())->getDocumentObjectPtr());
+        }
+    }
+
+    PY_TRY
+    {
+        Py::List ret;
+        for (const auto& pair : getAssemblyObjectPtr()->checkInterference(parts)) {
+            Py::Tuple tuple(3);
+            tuple.setItem(0, Py::asObject(pair.object1->getPyObject()));
+            tuple.setItem(1, Py::asObject(pair.object2->getPyObject()));
+            tuple.setItem(2, Py::Float(pair.volume));
+            ret.append(tuple);
+        }
+        return Py::new_reference_to(ret);
+    }
+    PY_CATCH
+}
+
 Py::List AssemblyObjectPy::getJoints() const
 {
     Py::List ret;
@@ -200,3 +241,8 @@ Py::List AssemblyObjectPy::getJoints() const
 
     return ret;
 }
+
+Py::Float AssemblyObjectPy::getDragStepTime() const
+{
+    return Py::Float(getAssemblyObjectPtr()->getDragStepTime());
+}
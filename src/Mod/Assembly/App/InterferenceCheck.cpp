@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <BRep_Tool.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <GProp_GProps.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#endif
+
+#include <App/DocumentObject.h>
+#include <Base/Console.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include "InterferenceCheck.h"
+
+FC_LOG_LEVEL_INIT("Assembly", true, true, true)
+
+using namespace Assembly;
+
+namespace
+{
+
+using IndexPair = std::pair<std::size_t, std::size_t>;
+
+// A bounding volume hierarchy of boxes, every node is split at the median of its longest axis.
+class BoxTree
+{
+public:
+    explicit BoxTree(const std::vector<Base::BoundBox3d>& boxes)
+        : boxes(boxes)
+        , indices(boxes.size())
+    {
+        std::iota(indices.begin(), indices.end(), 0);
+        if (!indices.empty()) {
+            build(0, indices.size());
+        }
+    }
+
+    // Returns the pairs of intersecting boxes, the first index of a pair is the smaller one.
+    std::vector<IndexPair> findPairs() const
+    {
+        std::vector<IndexPair> pairs;
+        for (std::size_t i = 0; i < boxes.size() && !nodes.empty(); i++) {
+            collect(0, i, pairs);
+        }
+        return pairs;
+    }
+
+private:
+    static constexpr std::size_t leafSize = 4;
+
+    struct Node
+    {
+        Base::BoundBox3d box;
+        std::size_t begin;
+        std::size_t end;
+        // The left child follows its parent, leaves have no right child.
+        std::size_t right;
+    };
+
+    void build(std::size_t begin, std::size_t end)
+    {
+        std::size_t index = nodes.size();
+        nodes.push_back({Base::BoundBox3d(), begin, end, 0});
+
+        Base::BoundBox3d box;
+        Base::BoundBox3d centers;
+        for (std::size_t i = begin; i < end; i++) {
+            box.Add(boxes[indices[i]]);
+            centers.Add(boxes[indices[i]].GetCenter());
+        }
+        nodes[index].box = box;
+        if (end - begin <= leafSize) {
+            return;
+        }
+
+        unsigned short axis = 0;
+        if (centers.LengthY() > centers.LengthX()) {
+            axis = 1;
+        }
+        if (centers.LengthZ() > std::max(centers.LengthX(), centers.LengthY())) {
+            axis = 2;
+        }
+
+        std::size_t middle = begin + (end - begin) / 2;
+        std::nth_element(indices.begin() + begin,
+                         indices.begin() + middle,
+                         indices.begin() + end,
+                         [this, axis](std::size_t a, std::size_t b) {
+                             return boxes[a].GetCenter()[axis] < boxes[b].GetCenter()[axis];
+                         });
+        build(begin, middle);
+        nodes[index].right = nodes.size();
+        build(middle, end);
+    }
+
+    void collect(std::size_t node, std::size_t index, std::vector<IndexPair>& pairs) const
+    {
+        const Base::BoundBox3d& box = boxes[index];
+        if (!nodes[node].box.Intersect(box)) {
+            return;
+        }
+        if (nodes[node].right == 0) {
+            for (std::size_t i = nodes[node].begin; i < nodes[node].end; i++) {
+                std::size_t other = indices[i];
+                if (other > index && boxes[other].Intersect(box)) {
+                    pairs.emplace_back(index, other);
+                }
+            }
+            return;
+        }
+        collect(node + 1, index, pairs);
+        collect(nodes[node].right, index, pairs);
+    }
+
+    const std::vector<Base::BoundBox3d>& boxes;
+    std::vector<std::size_t> indices;
+    std::vector<Node> nodes;
+};
+
+bool hasSolid(const TopoDS_Shape& shape)
+{
+    return TopExp_Explorer(shape, TopAbs_SOLID).More();
+}
+
+// Checks if a vertex of other lies inside a solid of shape. Used when the triangulations don't
+// overlap, then other is either completely inside or completely outside of shape.
+bool isInside(const TopoDS_Shape& shape, const TopoDS_Shape& other)
+{
+    TopExp_Explorer xpVertex(other, TopAbs_VERTEX);
+    if (!xpVertex.More()) {
+        return false;
+    }
+    gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(xpVertex.Current()));
+    for (TopExp_Explorer xp(shape, TopAbs_SOLID); xp.More(); xp.Next()) {
+        BRepClass3d_SolidClassifier classifier(xp.Current(), pnt, Precision::Confusion());
+        if (classifier.State() == TopAbs_IN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void InterferenceCheck::addPart(App::DocumentObject* obj, const TopoDS_Shape& shape)
+{
+    // only solids can have a volume in common
+    if (!obj || shape.IsNull() || !hasSolid(shape)) {
+        return;
+    }
+
+    Base::BoundBox3d box = Part::TopoShape(shape).getBoundBox();
+    box.Enlarge(Precision::Confusion());
+    items.push_back({obj, shape, box, 0.0});
+}
+
+void InterferenceCheck::triangulate(Item& item)
+{
+    bool complete = true;
+    for (TopExp_Explorer xp(item.shape, TopAbs_FACE); xp.More() && complete; xp.Next()) {
+        TopLoc_Location loc;
+        complete = !BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull();
+    }
+    if (!complete) {
+        // the default deviation of the Part view providers
+        const Base::BoundBox3d& box = item.box;
+        double deflection = (box.LengthX() + box.LengthY() + box.LengthZ()) / 300.0 * 0.5;
+        BRepMesh_IncrementalMesh(item.shape, deflection, Standard_False, 0.5, Standard_True);
+    }
+
+    item.deflection = 0.0;
+    for (TopExp_Explorer xp(item.shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (!mesh.IsNull()) {
+            item.deflection = std::max(item.deflection, mesh->Deflection());
+        }
+    }
+}
+
+bool InterferenceCheck::overlap(const Item& item1, const Item& item2)
+{
+    // The triangles may be off the surfaces by their deflection, so touching ones are taken as
+    // possible interferences and left to the exact check.
+    double tolerance = std::max(item1.deflection, item2.deflection);
+    BRepExtrema_ShapeProximity proximity(item1.shape, item2.shape, tolerance);
+    proximity.Perform();
+    if (!proximity.IsDone() || !proximity.OverlapSubShapes1().IsEmpty()) {
+        return true;
+    }
+    return isInside(item1.shape, item2.shape) || isInside(item2.shape, item1.shape);
+}
+
+double InterferenceCheck::commonVolume(const Item& item1, const Item& item2)
+{
+    FCBRepAlgoAPI_Common common(item1.shape, item2.shape);
+    if (!common.IsDone()) {
+        Standard_Failure::Raise("Boolean operation failed");
+    }
+    GProp_GProps props;
+    BRepGProp::VolumeProperties(common.Shape(), props);
+    return std::abs(props.Mass());
+}
+
+std::vector<InterferencePair> InterferenceCheck::perform()
+{
+    std::vector<Base::BoundBox3d> boxes;
+    boxes.reserve(items.size());
+    for (const auto& item : items) {
+        boxes.push_back(item.box);
+    }
+    std::vector<IndexPair> pairs = BoxTree(boxes).findPairs();
+    broadphasePairs = pairs.size();
+
+    // Meshing changes the shapes, so it must be done before they are shared by the threads.
+    std::vector<char> used(items.size(), 0);
+    for (const auto& pair : pairs) {
+        used[pair.first] = 1;
+        used[pair.second] = 1;
+    }
+    for (std::size_t i = 0; i < items.size(); i++) {
+        if (used[i]) {
+            triangulate(items[i]);
+        }
+    }
+
+    std::vector<char> candidates(pairs.size(), 0);
+    OSD_Parallel::For(0, static_cast<int>(pairs.size()), [this, &pairs, &candidates](int i) {
+        try {
+            candidates[i] = overlap(items[pairs[i].first], items[pairs[i].second]);
+        }
+        catch (const Standard_Failure&) {
+            candidates[i] = 1;
+        }
+    });
+    std::vector<IndexPair> survivors;
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        if (candidates[i]) {
+            survivors.push_back(pairs[i]);
+        }
+    }
+    midphasePairs = survivors.size();
+
+    // The booleans don't modify their arguments, so the pairs sharing a part can run at once.
+    std::vector<double> volumes(survivors.size(), 0.0);
+    std::vector<std::string> errors(survivors.size());
+    OSD_Parallel::For(0, static_cast<int>(survivors.size()), [&, this](int i) {
+        try {
+            volumes[i] = commonVolume(items[survivors[i].first], items[survivors[i].second]);
+        }
+        catch (const Standard_Failure& e) {
+            const char* msg = e.GetMessageString();
+            errors[i] = msg && *msg ? msg : e.DynamicType()->Name();
+        }
+    });
+
+    std::vector<InterferencePair> result;
+    for (std::size_t i = 0; i < survivors.size(); i++) {
+        App::DocumentObject* obj1 = items[survivors[i].first].object;
+        App::DocumentObject* obj2 = items[survivors[i].second].object;
+        if (!errors[i].empty()) {
+            FC_WARN("Interference check of " << obj1->getFullName() << " and "
+                                             << obj2->getFullName() << " failed: " << errors[i]);
+            continue;
+        }
+        if (volumes[i] > Precision::Confusion()) {
+            result.push_back({obj1, obj2, volumes[i]});
+        }
+    }
+    return result;
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef ASSEMBLY_InterferenceCheck_H
+#define ASSEMBLY_InterferenceCheck_H
+
+#include <cstddef>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Base/BoundBox.h>
+#include <Mod/Assembly/AssemblyGlobal.h>
+
+namespace App
+{
+class DocumentObject;
+}  // namespace App
+
+
+namespace Assembly
+{
+
+struct InterferencePair
+{
+    App::DocumentObject* object1;
+    App::DocumentObject* object2;
+    // The volume of the common part of both shapes
+    double volume;
+};
+
+/* Finds the parts that interfere with each other. The check runs in three stages:
+ - broadphase: a bounding volume hierarchy of the part bounding boxes gives the pairs whose boxes
+   intersect.
+ - midphase: the triangulations of these pairs are checked for overlapping triangles, or for one
+   part lying inside the other one. The triangulation built for the display is used, shapes that
+   have none get a coarse one.
+ - exact: the common part of the remaining pairs is computed in parallel and its volume is
+   reported.*/
+class AssemblyExport InterferenceCheck
+{
+public:
+    /// Adds a part, \a shape must be placed in the coordinate system of the other parts.
+    void addPart(App::DocumentObject* obj, const TopoDS_Shape& shape);
+
+    std::vector<InterferencePair> perform();
+
+    /// The number of pairs that passed the broadphase in the last perform()
+    std::size_t countBroadphasePairs() const
+    {
+        return broadphasePairs;
+    }
+    /// The number of pairs that passed the midphase in the last perform()
+    std::size_t countMidphasePairs() const
+    {
+        return midphasePairs;
+    }
+
+private:
+    struct Item
+    {
+        App::DocumentObject* object;
+        TopoDS_Shape shape;
+        Base::BoundBox3d box;
+        // the largest deflection of the triangulation
+        double deflection;
+    };
+
+    static void triangulate(Item& item);
+    static bool overlap(const Item& item1, const Item& item2);
+    static double commonVolume(const Item& item1, const Item& item2);
+
+    std::vector<Item> items;
+    std::size_t broadphasePairs = 0;
+    std::size_t midphasePairs = 0;
+};
+
+}  // namespace Assembly
+
+
+#endif  // ASSEMBLY_InterferenceCheck_H
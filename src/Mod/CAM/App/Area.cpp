@@ -26,6 +26,8 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <exception>
 #include <limits>
 
 #include <boost/geometry.hpp>
@@ -56,6 +58,7 @@
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeAnalysis_FreeBounds.hxx>
 #include <ShapeExtend_WireData.hxx>
@@ -733,6 +736,10 @@ std::shared_ptr<Area> Area::getRestArea(std::vector<std::shared_ptr<Area>> clear
 {
     build();
 #define AREA_MY(_param) myParams.PARAM_FNAME(_param)
+
+// The parameters only used on the built area
+#define AREA_PARAMS_OUTPUT                                                                         \
+    AREA_PARAMS_OFFSET AREA_PARAMS_OFFSET_CONF AREA_PARAMS_POCKET AREA_PARAMS_POCKET_CONF
     PARAM_ENUM_CONVERT(AREA_MY, PARAM_FNAME, PARAM_ENUM_EXCEPT, AREA_PARAMS_OFFSET_CONF);
     PARAM_ENUM_CONVERT(AREA_MY, PARAM_FNAME, PARAM_ENUM_EXCEPT, AREA_PARAMS_CLIPPER_FILL);
 
@@ -816,9 +823,29 @@ void Area::setParams(const AreaParams& params)
 #define AREA_SRC(_param) params.PARAM_FNAME(_param)
     // Validate all enum type of parameters
     PARAM_ENUM_CHECK(AREA_SRC, PARAM_ENUM_EXCEPT, AREA_PARAMS_CONF);
-    if (params != myParams) {
-        clean();
-        myParams = params;
+    if (params == myParams) {
+        return;
+    }
+
+    AreaParams buildParams(params);
+#define AREA_KEEP_PARAM(_param) buildParams.PARAM_FNAME(_param) = myParams.PARAM_FNAME(_param);
+    PARAM_FOREACH(AREA_KEEP_PARAM, AREA_PARAMS_OUTPUT);
+    if (buildParams == myParams) {
+        setOutputParams(params);
+        return;
+    }
+    clean();
+    myParams = params;
+}
+
+void Area::setOutputParams(const AreaParams& params)
+{
+#define AREA_COPY_PARAM(_param) myParams.PARAM_FNAME(_param) = params.PARAM_FNAME(_param);
+    PARAM_FOREACH(AREA_COPY_PARAM, AREA_PARAMS_OUTPUT);
+    myShapeDone = false;
+    myShape.Nullify();
+    for (const auto& area : mySections) {
+        area->setOutputParams(params);
     }
 }
 
@@ -1729,7 +1756,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
         throw Base::ValueError("failed to obtain section plane");
     }
 
-    FC_TIME_INIT2(t, t1);
+    FC_TIME_INIT(t);
 
     TopLoc_Location loc(trsf);
 
@@ -1888,7 +1915,14 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // The heights are sliced at once, every one of them into its own section, which is built
+    // right away. libarea keeps its settings per thread, see CAreaConfig. Debugging shapes are
+    // added to the document, so they are only shown in a single thread.
+    bool parallel = FC_LOG_INSTANCE.level() <= FC_LOGLEVEL_TRACE;
+    std::vector<shared_ptr<Area>> results(heights.size());
+    std::vector<std::exception_ptr> errors(heights.size());
+    auto makeSection = [&](int i) {
+        FC_TIME_INIT(t1);
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
@@ -1909,7 +1943,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
+                results[i] = area;
                 break;
             }
 
@@ -1923,13 +1957,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     showShape(xp.Current(), nullptr, "section_%u_shape", i);
                     std::list<TopoDS_Wire> wires;
                     Part::CrossSection section(a, b, c, xp.Current());
-                    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
-                        // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
-                        // needed to make finish pass work.
-                        // This fix might be better to move into Part::CrossSection but it is kept
-                        // here for now to be on the safe side.
-                        wires = section.slice(-d);
-                    });
+                    wires = section.slice(-d);
                     showShapes(wires, nullptr, "section_%u_wire", i);
                     if (wires.empty()) {
                         AREA_LOG("Section returns no wires");
@@ -1992,7 +2020,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
+                results[i] = area;
                 FC_TIME_LOG(t1, "makeSection " << z);
                 showShape(area->getShape(), nullptr, "section_%u_final", i);
                 break;
@@ -2007,7 +2035,32 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 retried = true;
             }
         }
+    };
+    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
+        // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
+        // needed to make finish pass work.
+        // This fix might be better to move into Part::CrossSection but it is kept
+        // here for now to be on the safe side.
+        OSD_Parallel::For(
+            0,
+            static_cast<int>(heights.size()),
+            [&](int i) {
+                try {
+                    makeSection(i);
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            },
+            !parallel);
+    });
+    Base::rethrowFirstException(errors);
+    for (std::size_t i = 0; i < heights.size(); ++i) {
+        if (results[i]) {
+            sections.push_back(results[i]);
+        }
     }
+
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
 }
@@ -2437,14 +2490,7 @@ void Area::makeOffset(list<shared_ptr<CArea>>& areas,
             last_stepover = 0;
         }
     }
-    for (int i = 0; count < 0 || i < count; ++i, offset += stepover) {
-        if (from_center) {
-            areas.push_front(make_shared<CArea>());
-        }
-        else {
-            areas.push_back(make_shared<CArea>());
-        }
-        CArea& area = from_center ? (*areas.front()) : (*areas.back());
+    auto offsetArea = [&](CArea& area, double passOffset) {
         CArea areaOpen;
 #ifdef AREA_OFFSET_ALGO
         if (myParams.Algo == Area::Algolibarea) {
@@ -2467,15 +2513,15 @@ void Area::makeOffset(list<shared_ptr<CArea>>& areas,
                 // libarea somehow fails offset without Reorder, but ClipperOffset
                 // works okay. Don't know why
                 area.Reorder();
-                area.Offset(-offset);
+                area.Offset(-passOffset);
                 if (areaOpen.m_curves.size()) {
-                    areaOpen.Thicken(offset);
+                    areaOpen.Thicken(passOffset);
                     area.Clip(ClipperLib::ctUnion, &areaOpen, SubjectFill, ClipFill);
                 }
                 break;
             case Area::AlgoClipperOffset:
 #endif
-                area.OffsetWithClipper(offset,
+                area.OffsetWithClipper(passOffset,
                                        JoinType,
                                        EndType,
                                        myParams.MiterLimit,
@@ -2484,6 +2530,63 @@ void Area::makeOffset(list<shared_ptr<CArea>>& areas,
                 break;
         }
 #endif
+    };
+
+    if (count > 1 && !last_stepover) {
+        // Every pass offsets the combined area by its own distance, so with a
+        // known number of passes they are made at the same time. libarea keeps
+        // its settings per thread, the workers take over the ones of this thread.
+        CAreaParams conf;
+#define AREA_CONF_GET(_param)                                                                      \
+    conf.PARAM_FNAME(_param) = BOOST_PP_CAT(CArea::get_, PARAM_FARG(_param))();
+        PARAM_FOREACH(AREA_CONF_GET, AREA_PARAMS_CAREA);
+
+        std::vector<double> offsets(count);
+        for (auto& passOffset : offsets) {
+            passOffset = offset;
+            offset += stepover;
+        }
+        std::vector<shared_ptr<CArea>> passes(count);
+        std::vector<std::exception_ptr> errors(count);
+        OSD_Parallel::For(0, static_cast<int>(count), [&](int i) {
+            try {
+                CAreaConfig threadConf(conf, /*noFitArcs*/ false);
+                passes[i] = make_shared<CArea>();
+                offsetArea(*passes[i], offsets[i]);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        // the passes stop at the first one that has nothing left, the errors
+        // of the ones after it don't matter
+        long used = 0;
+        while (used < count && (errors[used] || !passes[used]->m_curves.empty())) {
+            ++used;
+        }
+        errors.resize(used);
+        Base::rethrowFirstException(errors);
+        for (long i = 0; i < used; ++i) {
+            if (from_center) {
+                areas.push_front(passes[i]);
+            }
+            else {
+                areas.push_back(passes[i]);
+            }
+        }
+        FC_TIME_LOG(t, "makeOffset count: " << count);
+        return;
+    }
+
+    for (int i = 0; count < 0 || i < count; ++i, offset += stepover) {
+        if (from_center) {
+            areas.push_front(make_shared<CArea>());
+        }
+        else {
+            areas.push_back(make_shared<CArea>());
+        }
+        CArea& area = from_center ? (*areas.front()) : (*areas.back());
+        offsetArea(area, offset);
         if (count > 1) {
             FC_TIME_LOG(t1, "makeOffset " << i << '/' << count);
         }
@@ -2998,6 +3101,125 @@ struct GetWires
     }
 };
 
+// A wire in the sorted order with the points where the tool enters and leaves it
+struct SortedWire
+{
+    TopoDS_Shape wire;
+    gp_Pnt pentry;
+    gp_Pnt pexit;
+    bool isClosed;
+    // whether the wire may be run the other way round
+    bool reversible;
+
+    void reverse()
+    {
+        std::swap(pentry, pexit);
+        // a closed wire is entered and left at the same point, so it stays as it is
+        if (!isClosed) {
+            wire.Reverse();
+        }
+    }
+};
+
+using SortedWires = std::vector<SortedWire>;
+
+// The travel distance from pstart through all the wires
+static double rapidDistance(const gp_Pnt& pstart, const SortedWires& wires)
+{
+    double d = 0.0;
+    const gp_Pnt* pt = &pstart;
+    for (const auto& w : wires) {
+        d += pt->Distance(w.pentry);
+        pt = &w.pexit;
+    }
+    return d;
+}
+
+/** Improves the wire order with local search until no move shortens the travel or the deadline
+ * is reached. 2-opt moves run a range of wires backwards, Or-opt moves take a range of up to
+ * three wires elsewhere. The first wire is still entered from pstart, the end of the path is
+ * free.
+ */
+static void improveWireOrder(const gp_Pnt& pstart,
+                             SortedWires& wires,
+                             std::chrono::steady_clock::time_point deadline)
+{
+    const int count = static_cast<int>(wires.size());
+    const double tolerance = Precision::Confusion();
+    auto entry = [&](int i) -> const gp_Pnt& {
+        return wires[i].pentry;
+    };
+    // the point the tool comes from before entering wire i
+    auto before = [&](int i) -> const gp_Pnt& {
+        return i == 0 ? pstart : wires[i - 1].pexit;
+    };
+
+    bool improved = true;
+    while (improved) {
+        improved = false;
+
+        for (int i = 0; i < count; ++i) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return;
+            }
+            for (int j = i; j < count && wires[j].reversible; ++j) {
+                double d = before(i).Distance(wires[j].pexit) - before(i).Distance(entry(i));
+                if (j + 1 < count) {
+                    d += entry(i).Distance(entry(j + 1)) - wires[j].pexit.Distance(entry(j + 1));
+                }
+                if (d < -tolerance) {
+                    std::reverse(wires.begin() + i, wires.begin() + j + 1);
+                    for (int k = i; k <= j; ++k) {
+                        wires[k].reverse();
+                    }
+                    improved = true;
+                }
+            }
+        }
+
+        for (int length = 1; length <= 3; ++length) {
+            for (int i = 0; i + length <= count; ++i) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return;
+                }
+                int last = i + length - 1;
+                // the travel saved by taking the range out
+                double gain = before(i).Distance(entry(i));
+                if (last + 1 < count) {
+                    gain += wires[last].pexit.Distance(entry(last + 1))
+                        - before(i).Distance(entry(last + 1));
+                }
+                // insert the range after wire k, or at the front for k == -1
+                for (int k = -1; k < count; ++k) {
+                    if (k >= i - 1 && k <= last) {
+                        continue;
+                    }
+                    const gp_Pnt& pt = k < 0 ? pstart : wires[k].pexit;
+                    double cost = pt.Distance(entry(i));
+                    if (k + 1 < count) {
+                        cost += wires[last].pexit.Distance(entry(k + 1))
+                            - pt.Distance(entry(k + 1));
+                    }
+                    if (cost - gain < -tolerance) {
+                        if (k < i) {
+                            std::rotate(wires.begin() + k + 1,
+                                        wires.begin() + i,
+                                        wires.begin() + last + 1);
+                        }
+                        else {
+                            std::rotate(wires.begin() + i,
+                                        wires.begin() + last + 1,
+                                        wires.begin() + k + 1);
+                        }
+                        improved = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
 struct ShapeInfo
 {
     gp_Pln myPln;
@@ -3269,11 +3491,11 @@ struct ShapeInfo
         return myBestWire->wire;
     }
 
-    std::list<TopoDS_Shape>
+    SortedWires
     sortWires(const gp_Pnt& pstart, gp_Pnt& pend, double min_dist, double max_dist, gp_Pnt* pentry)
     {
 
-        std::list<TopoDS_Shape> wires;
+        SortedWires wires;
 
         if (myWires.empty() || pstart.SquareDistance(myStartPt) > Precision::SquareConfusion()) {
             nearest(pstart);
@@ -3290,18 +3512,26 @@ struct ShapeInfo
             min_dist = 0.01;
         }
         while (true) {
+            wires.emplace_back();
+            SortedWire& sorted = wires.back();
+            sorted.isClosed = myBestWire->isClosed;
+            sorted.reversible = sorted.isClosed || myParams.direction == Area::DirectionNone;
             if (myRebase) {
                 pend = myBestPt;
-                wires.push_back(rebaseWire(pend, min_dist));
+                sorted.wire = rebaseWire(pend, min_dist);
+                sorted.pentry = pend;
             }
             else if (!myStart) {
-                wires.push_back(myBestWire->wire.Reversed());
+                sorted.wire = myBestWire->wire.Reversed();
+                sorted.pentry = myBestWire->pend();
                 pend = myBestWire->pstart();
             }
             else {
-                wires.push_back(myBestWire->wire);
+                sorted.wire = myBestWire->wire;
+                sorted.pentry = myBestWire->pstart();
                 pend = myBestWire->pend();
             }
+            sorted.pexit = pend;
             FC_TIME_INIT(t);
             for (size_t i = 0, count = myBestWire->points.size(); i < count; ++i) {
                 myRTree.remove(RValue(myBestWire, i));
@@ -3703,6 +3933,13 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
     auto current_it = shape_list.end();
     double current_height = (pstart.*getter)();
     double max_dist = sort_mode == SortModeGreedy ? threshold * threshold : 0;
+    // Greedy sorting leaves a layer on purpose, so its order is not improved
+    bool optimize = optimize_time > 0.0 && sort_mode != SortModeGreedy;
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(optimize ? optimize_time : 0.0));
+    double rapid = 0.0;
+    double rapidBefore = 0.0;
     while (!shape_list.empty()) {
         AREA_TRACE("sorting " << shape_list.size() << ' ' << AREA_XYZ(pstart));
         double best_d = std::numeric_limits<double>::max();
@@ -3739,7 +3976,17 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
             }
         }
 
-        wires.splice(wires.end(), best_it->sortWires(pstart, pend, min_dist, max_dist, &pentry));
+        SortedWires sorted = best_it->sortWires(pstart, pend, min_dist, max_dist, &pentry);
+        rapidBefore += rapidDistance(pstart, sorted);
+        if (optimize && sorted.size() > 1) {
+            improveWireOrder(pstart, sorted, deadline);
+            pentry = sorted.front().pentry;
+            pend = sorted.back().pexit;
+        }
+        rapid += rapidDistance(pstart, sorted);
+        for (auto& w : sorted) {
+            wires.push_back(w.wire);
+        }
 
         if (use_bound && _pstart) {
             use_bound = false;
@@ -3793,6 +4040,12 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
     FC_DURATION_LOG(rparams.qd, "rtree query");
     FC_DURATION_LOG(rparams.rd, "rtree clean");
     FC_DURATION_LOG(rparams.xd, "BRepExtrema");
+    if (optimize) {
+        AREA_LOG("rapid distance " << rapidBefore << " improved to " << rapid);
+    }
+    else {
+        AREA_LOG("rapid distance " << rapid);
+    }
     FC_TIME_LOG(t, "sortWires total");
     return wires;
 }
@@ -3831,8 +4084,10 @@ static inline void addG1(bool verbose,
 {
     addGCode(verbose, path, last, next, "G1");
     if (f > Precision::Confusion()) {
-        Command* cmd = path.getCommands().back();
-        addParameter(verbose, *cmd, "F", last_f, f);
+        unsigned int pos = path.getSize() - 1;
+        Command cmd = path.getCommand(pos);
+        addParameter(verbose, cmd, "F", last_f, f);
+        path.setCommand(cmd, pos);
         last_f = f;
     }
     return;
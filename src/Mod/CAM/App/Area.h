@@ -86,6 +86,8 @@ struct PathExport AreaStaticParams: AreaParams
  *
  * It is kind of troublesome with the fact that libarea uses static variables to
  * config its algorithm. CAreaConfig makes it easy to safely customize libarea.
+ * The variables are thread local, so the configuration only applies to the
+ * calling thread.
  */
 struct PathExport CAreaConfig
 {
@@ -147,6 +149,11 @@ protected:
     /** Called internally to combine children shapes for further processing */
     void build();
 
+    /** Applies the offset and pocket parameters of \a params, which are used
+     * after building, and discards the output shapes but keeps the combined
+     * children shapes */
+    void setOutputParams(const AreaParams& params);
+
     /** Called by build() to add children shape
      *
      * Mainly for checking if there is any faces for auto fill*/
@@ -260,7 +267,11 @@ public:
                                       double diameter);
     TopoDS_Shape toTopoShape();
 
-    /** Config this Area object */
+    /** Config this Area object
+     *
+     * If only the offset and pocket parameters change, the combined children
+     * shapes are kept and just the output is made again.
+     */
     void setParams(const AreaParams& params);
 
 
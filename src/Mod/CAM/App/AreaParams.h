@@ -396,7 +396,14 @@
              "If two wire's end points are separated within this threshold, they are consider\n"   \
              "as connected. You may want to set this to the tool diameter to keep the tool down.", \
              App::PropertyLength))(                                                                \
-            (enum, retract_axis, RetractAxis, 2, "Tool retraction axis", (X)(Y)(Z)))
+            (enum, retract_axis, RetractAxis, 2, "Tool retraction axis", (X)(Y)(Z)))(              \
+            (double,                                                                               \
+             optimize_time,                                                                        \
+             SortOptimizeTime,                                                                     \
+             0.0,                                                                                  \
+             "Time limit in seconds for improving the wire order of sort mode '2D5' and '3D'\n"    \
+             "with 2-opt and Or-opt moves that shorten the travel between the wires.\n"            \
+             "0 disables the improvement."))
 
 /** Area path generation parameters */
 #define AREA_PARAMS_PATH                                                                           \
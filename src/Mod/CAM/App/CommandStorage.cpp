@@ -0,0 +1,409 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <bit>
+#include <istream>
+#include <ostream>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+
+#include "CommandStorage.h"
+
+
+using namespace Path;
+
+namespace
+{
+// "FCTP" and the version of the binary format
+constexpr std::uint32_t StorageMagic = 0x50544346;
+constexpr std::uint32_t StorageVersion = 1;
+
+int slotIndex(const std::string& key)
+{
+    if (key.size() == 1 && key[0] >= 'A' && key[0] <= 'Z') {
+        return key[0] - 'A';
+    }
+    return -1;
+}
+}  // namespace
+
+void CommandStorage::clear()
+{
+    strings.clear();
+    stringIds.clear();
+    entries.clear();
+    values.clear();
+}
+
+void CommandStorage::reserve(std::size_t commands)
+{
+    entries.reserve(commands);
+    // most of the commands are moves with three or four parameters
+    values.reserve(commands * 4);
+}
+
+std::uint32_t CommandStorage::intern(std::string_view str)
+{
+    auto it = stringIds.find(str);
+    if (it != stringIds.end()) {
+        return it->second;
+    }
+    auto id = static_cast<std::uint32_t>(strings.size());
+    strings.emplace_back(str);
+    stringIds.emplace(strings.back(), id);
+    return id;
+}
+
+void CommandStorage::encode(const Command& cmd, std::uint32_t& mask, std::vector<double>& out)
+{
+    // The map is sorted, so the single letters come in the order of the slots
+    mask = 0;
+    std::size_t extras = 0;
+    for (const auto& it : cmd.Parameters) {
+        int slot = slotIndex(it.first);
+        if (slot < 0) {
+            extras++;
+        }
+        else {
+            mask |= 1U << slot;
+            out.push_back(it.second);
+        }
+    }
+
+    if (extras > 0) {
+        mask |= ExtraFlag;
+        out.push_back(static_cast<double>(extras));
+        for (const auto& it : cmd.Parameters) {
+            if (slotIndex(it.first) < 0) {
+                out.push_back(static_cast<double>(intern(it.first)));
+                out.push_back(it.second);
+            }
+        }
+    }
+}
+
+std::size_t CommandStorage::endOf(std::size_t pos) const
+{
+    return pos + 1 < entries.size() ? entries[pos + 1].offset : values.size();
+}
+
+void CommandStorage::push_back(const Command& cmd)
+{
+    Entry entry;
+    entry.opcode = intern(cmd.Name);
+    entry.offset = values.size();
+    encode(cmd, entry.mask, values);
+    entries.push_back(entry);
+}
+
+void CommandStorage::push_back(std::string_view name, std::uint32_t mask, const double* slots)
+{
+    Entry entry;
+    entry.opcode = intern(name);
+    entry.mask = mask & SlotMask;
+    entry.offset = values.size();
+    for (int slot = 0; slot < 26; slot++) {
+        if (entry.mask & (1U << slot)) {
+            values.push_back(slots[slot]);
+        }
+    }
+    entries.push_back(entry);
+}
+
+void CommandStorage::append(const CommandStorage& other)
+{
+    std::vector<std::uint32_t> ids;
+    ids.reserve(other.strings.size());
+    for (const auto& it : other.strings) {
+        ids.push_back(intern(it));
+    }
+
+    std::size_t offset = values.size();
+    entries.reserve(entries.size() + other.entries.size());
+    values.insert(values.end(), other.values.begin(), other.values.end());
+    for (std::size_t i = 0; i < other.entries.size(); i++) {
+        Entry entry = other.entries[i];
+        entry.opcode = ids[entry.opcode];
+        entry.offset += offset;
+        entries.push_back(entry);
+
+        if (entry.mask & ExtraFlag) {
+            std::size_t index = entry.offset + std::popcount(entry.mask & SlotMask);
+            auto count = static_cast<std::size_t>(values[index++]);
+            for (std::size_t j = 0; j < count; j++, index += 2) {
+                values[index] = ids[static_cast<std::size_t>(values[index])];
+            }
+        }
+    }
+}
+
+void CommandStorage::insert(std::size_t pos, const Command& cmd)
+{
+    if (pos == entries.size()) {
+        push_back(cmd);
+        return;
+    }
+
+    Entry entry;
+    std::vector<double> data;
+    entry.opcode = intern(cmd.Name);
+    entry.offset = entries[pos].offset;
+    encode(cmd, entry.mask, data);
+
+    values.insert(values.begin() + std::ptrdiff_t(entry.offset), data.begin(), data.end());
+    entries.insert(entries.begin() + std::ptrdiff_t(pos), entry);
+    for (std::size_t i = pos + 1; i < entries.size(); i++) {
+        entries[i].offset += data.size();
+    }
+}
+
+void CommandStorage::replace(std::size_t pos, const Command& cmd)
+{
+    Entry& entry = entries[pos];
+    std::size_t begin = entry.offset;
+    std::size_t end = endOf(pos);
+    std::vector<double> data;
+    entry.opcode = intern(cmd.Name);
+    encode(cmd, entry.mask, data);
+
+    if (data.size() == end - begin) {
+        std::copy(data.begin(), data.end(), values.begin() + std::ptrdiff_t(begin));
+        return;
+    }
+
+    values.erase(values.begin() + std::ptrdiff_t(begin), values.begin() + std::ptrdiff_t(end));
+    values.insert(values.begin() + std::ptrdiff_t(begin), data.begin(), data.end());
+    for (std::size_t i = pos + 1; i < entries.size(); i++) {
+        entries[i].offset = entries[i].offset - (end - begin) + data.size();
+    }
+}
+
+void CommandStorage::erase(std::size_t pos)
+{
+    std::size_t begin = entries[pos].offset;
+    std::size_t end = endOf(pos);
+    values.erase(values.begin() + std::ptrdiff_t(begin), values.begin() + std::ptrdiff_t(end));
+    entries.erase(entries.begin() + std::ptrdiff_t(pos));
+    for (std::size_t i = pos; i < entries.size(); i++) {
+        entries[i].offset -= end - begin;
+    }
+}
+
+void CommandStorage::scale(std::size_t first, std::size_t last, double factor)
+{
+    // the same parameters as Command::scaleBy()
+    auto isScaled = [](char c) {
+        return c == 'X' || c == 'Y' || c == 'Z' || c == 'I' || c == 'J' || c == 'R' || c == 'Q'
+            || c == 'F';
+    };
+
+    for (std::size_t pos = first; pos < last; pos++) {
+        const Entry& entry = entries[pos];
+        std::size_t index = entry.offset;
+        for (int slot = 0; slot < 26; slot++) {
+            if (entry.mask & (1U << slot)) {
+                if (isScaled(char('A' + slot))) {
+                    values[index] *= factor;
+                }
+                index++;
+            }
+        }
+
+        if (entry.mask & ExtraFlag) {
+            auto count = static_cast<std::size_t>(values[index++]);
+            for (std::size_t i = 0; i < count; i++, index += 2) {
+                if (isScaled(strings[static_cast<std::size_t>(values[index])][0])) {
+                    values[index + 1] *= factor;
+                }
+            }
+        }
+    }
+}
+
+Command CommandStorage::at(std::size_t pos) const
+{
+    const Entry& entry = entries[pos];
+    Command cmd;
+    cmd.Name = strings[entry.opcode];
+
+    std::size_t index = entry.offset;
+    for (int slot = 0; slot < 26; slot++) {
+        if (entry.mask & (1U << slot)) {
+            cmd.Parameters.emplace_hint(cmd.Parameters.end(),
+                                        std::string(1, char('A' + slot)),
+                                        values[index++]);
+        }
+    }
+
+    if (entry.mask & ExtraFlag) {
+        auto count = static_cast<std::size_t>(values[index++]);
+        for (std::size_t i = 0; i < count; i++, index += 2) {
+            const std::string& key = strings[static_cast<std::size_t>(values[index])];
+            cmd.Parameters[key] = values[index + 1];
+        }
+    }
+    return cmd;
+}
+
+bool CommandStorage::has(std::size_t pos, char slot) const
+{
+    if (slot < 'A' || slot > 'Z') {
+        return false;
+    }
+    return (entries[pos].mask & (1U << (slot - 'A'))) != 0;
+}
+
+double CommandStorage::value(std::size_t pos, char slot, double fallback) const
+{
+    if (!has(pos, slot)) {
+        return fallback;
+    }
+    const Entry& entry = entries[pos];
+    std::uint32_t bit = 1U << (slot - 'A');
+    return values[entry.offset + std::popcount(entry.mask & (bit - 1))];
+}
+
+std::size_t CommandStorage::memSize() const
+{
+    std::size_t size = entries.capacity() * sizeof(Entry) + values.capacity() * sizeof(double);
+    for (const auto& it : strings) {
+        // the string is kept in the table and as key of the lookup
+        size += 2 * (sizeof(std::string) + it.capacity());
+    }
+    return size;
+}
+
+void CommandStorage::save(std::ostream& str) const
+{
+    Base::OutputStream out(str);
+    out << StorageMagic << StorageVersion;
+
+    out << static_cast<std::uint32_t>(strings.size());
+    for (const auto& it : strings) {
+        out << static_cast<std::uint32_t>(it.size());
+        out.write(it.c_str(), static_cast<int>(it.size()));
+    }
+
+    out << static_cast<std::uint64_t>(entries.size());
+    for (const auto& it : entries) {
+        out << it.opcode << it.mask << it.offset;
+    }
+
+    out << static_cast<std::uint64_t>(values.size());
+    for (double it : values) {
+        out << it;
+    }
+}
+
+void CommandStorage::restore(std::istream& str)
+{
+    clear();
+
+    Base::InputStream in(str);
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    in >> magic >> version;
+    if (magic != StorageMagic || version > StorageVersion) {
+        throw Base::BadFormatError("Unknown format of the toolpath data");
+    }
+
+    std::uint32_t numStrings = 0;
+    in >> numStrings;
+    for (std::uint32_t i = 0; i < numStrings && str; i++) {
+        std::uint32_t len = 0;
+        in >> len;
+        std::string text(len, '\0');
+        in.read(text.data(), static_cast<int>(len));
+        intern(text);
+    }
+
+    std::uint64_t numEntries = 0;
+    in >> numEntries;
+    for (std::uint64_t i = 0; i < numEntries && str; i++) {
+        Entry entry;
+        in >> entry.opcode >> entry.mask >> entry.offset;
+        entries.push_back(entry);
+    }
+
+    std::uint64_t numValues = 0;
+    in >> numValues;
+    for (std::uint64_t i = 0; i < numValues && str; i++) {
+        double value = 0.0;
+        in >> value;
+        values.push_back(value);
+    }
+
+    if (!str || strings.size() != numStrings) {
+        clear();
+        throw Base::BadFormatError("Truncated toolpath data");
+    }
+
+    // make sure that the entries can't point outside of the tables
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        if (!isValid(i)) {
+            clear();
+            throw Base::BadFormatError("Corrupted toolpath data");
+        }
+    }
+}
+
+bool CommandStorage::isValid(std::size_t pos) const
+{
+    const Entry& entry = entries[pos];
+    if (entry.opcode >= strings.size() || entry.offset > values.size()
+        || (entry.mask & ~(SlotMask | ExtraFlag)) != 0) {
+        return false;
+    }
+    std::size_t begin = entry.offset;
+    std::size_t end = endOf(pos);
+    if (end < begin || end > values.size()) {
+        return false;
+    }
+
+    std::size_t count = std::popcount(entry.mask & SlotMask);
+    if ((entry.mask & ExtraFlag) == 0) {
+        return count == end - begin;
+    }
+
+    if (begin + count >= end) {
+        return false;
+    }
+    double extras = values[begin + count];
+    if (!(extras >= 0.0 && extras <= double(end - begin))) {
+        return false;
+    }
+    auto numExtras = static_cast<std::size_t>(extras);
+    if (count + 1 + 2 * numExtras != end - begin) {
+        return false;
+    }
+    for (std::size_t i = begin + count + 1; i < end; i += 2) {
+        if (!(values[i] >= 0.0 && values[i] < double(strings.size()))) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PATH_COMMANDSTORAGE_H
+#define PATH_COMMANDSTORAGE_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Mod/CAM/PathGlobal.h>
+
+#include "Command.h"
+
+
+namespace Path
+{
+
+/** Compact storage of the commands of a toolpath
+ *
+ * The command names are interned, every command only keeps the index of its name,
+ * a bit mask of the set parameters A to Z and the offset of its values. The values
+ * of all commands are kept in a single array in the order of the commands and for
+ * each command in the order of the slots. Parameters with other names are rare, they
+ * are appended to the values of their command as pairs of interned name and value.
+ *
+ * The Command objects handed out are copies, changing them doesn't change the storage.
+ */
+class PathExport CommandStorage
+{
+public:
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+    bool empty() const
+    {
+        return entries.empty();
+    }
+
+    void clear();
+    void reserve(std::size_t commands);
+    void push_back(const Command& cmd);
+    /** Adds a command with the parameters set in \a mask, the value of the parameter
+     * A is found at \a slots[0], the one of Z at \a slots[25].
+     */
+    void push_back(std::string_view name, std::uint32_t mask, const double* slots);
+    /// Adds all the commands of \a other
+    void append(const CommandStorage& other);
+    void insert(std::size_t pos, const Command& cmd);
+    void replace(std::size_t pos, const Command& cmd);
+    void erase(std::size_t pos);
+    /// Scales the coordinates and feed rates of the commands in [\a first, \a last)
+    void scale(std::size_t first, std::size_t last, double factor);
+
+    /// Returns a copy of the command at \a pos
+    Command at(std::size_t pos) const;
+    const std::string& name(std::size_t pos) const
+    {
+        return strings[entries[pos].opcode];
+    }
+    /// The index of the name of the command at \a pos in names()
+    std::uint32_t nameIndex(std::size_t pos) const
+    {
+        return entries[pos].opcode;
+    }
+    /// All names of the commands, a name keeps its index until the storage is cleared
+    const std::vector<std::string>& names() const
+    {
+        return strings;
+    }
+    /// Checks if the parameter \a slot (A to Z) of the command at \a pos is set
+    bool has(std::size_t pos, char slot) const;
+    double value(std::size_t pos, char slot, double fallback = 0.0) const;
+
+    /// The number of bytes used by the storage
+    std::size_t memSize() const;
+
+    /** @name Binary serialization
+     * The data is written as is, independent of the byte order of the machine.
+     */
+    //@{
+    void save(std::ostream& str) const;
+    void restore(std::istream& str);
+    //@}
+
+private:
+    static constexpr std::uint32_t SlotMask = (1U << 26) - 1;
+    static constexpr std::uint32_t ExtraFlag = 1U << 26;
+
+    struct Entry
+    {
+        std::uint32_t opcode = 0;
+        std::uint32_t mask = 0;
+        std::uint64_t offset = 0;
+    };
+
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const
+        {
+            return std::hash<std::string_view> {}(str);
+        }
+    };
+
+    std::uint32_t intern(std::string_view str);
+    void encode(const Command& cmd, std::uint32_t& mask, std::vector<double>& out);
+    std::size_t endOf(std::size_t pos) const;
+    bool isValid(std::size_t pos) const;
+
+private:
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> stringIds;
+    std::vector<Entry> entries;
+    std::vector<double> values;
+};
+
+}  // namespace Path
+
+
+#endif  // PATH_COMMANDSTORAGE_H
@@ -44,6 +44,7 @@ PARAM_ENUM_STRING_DECLARE(static const char* Enums, AREA_PARAMS_ALL)
 
 FeatureArea::FeatureArea()
     : myInited(false)
+    , mySourceOperation(0)
 {
     ADD_PROPERTY(Sources, (nullptr));
     ADD_PROPERTY(WorkPlane, (TopoDS_Shape()));
@@ -81,6 +82,8 @@ App::DocumentObjectExecReturn* FeatureArea::execute()
         return new App::DocumentObjectExecReturn("No shapes linked");
     }
 
+    std::vector<TopoDS_Shape> sources;
+    sources.reserve(links.size());
     for (std::vector<App::DocumentObject*>::iterator it = links.begin(); it != links.end(); ++it) {
         if (!(*it && (*it)->isDerivedFrom<Part::Feature>())) {
             return new App::DocumentObjectExecReturn(
@@ -90,6 +93,7 @@ App::DocumentObjectExecReturn* FeatureArea::execute()
         if (shape.IsNull()) {
             return new App::DocumentObjectExecReturn("Linked shape object is empty");
         }
+        sources.push_back(shape);
     }
 
     FC_TIME_INIT(t);
@@ -99,15 +103,32 @@ App::DocumentObjectExecReturn* FeatureArea::execute()
 #define AREA_PROP_GET(_param) params.PARAM_FNAME(_param) = PARAM_FNAME(_param).getValue();
     PARAM_FOREACH(AREA_PROP_GET, AREA_PARAMS_CONF)
 
-    myArea.clean(true);
-    myArea.setParams(params);
-
     TopoDS_Shape workPlane = WorkPlane.getShape().getShape();
-    myArea.setPlane(workPlane);
+    long operation = PARAM_PROP_ARGS(AREA_PARAMS_OPCODE);
 
-    for (std::vector<App::DocumentObject*>::iterator it = links.begin(); it != links.end(); ++it) {
-        myArea.add(static_cast<Part::Feature*>(*it)->Shape.getShape().getShape(),
-                   PARAM_PROP_ARGS(AREA_PARAMS_OPCODE));
+    // Shapes are compared by identity, a recomputed source has a new one.
+    bool sameSources = sources.size() == mySources.size() && mySourcePlane.IsEqual(workPlane)
+        && mySourceOperation == operation;
+    for (std::size_t i = 0; sameSources && i < sources.size(); ++i) {
+        sameSources = sources[i].IsEqual(mySources[i]);
+    }
+
+    if (sameSources) {
+        // keeps the built area if only the offset or pocket parameters changed
+        myArea.setParams(params);
+    }
+    else {
+        mySources.clear();
+        myArea.clean(true);
+        myArea.setParams(params);
+        myArea.setPlane(workPlane);
+
+        for (auto& shape : sources) {
+            myArea.add(shape, operation);
+        }
+        mySources = std::move(sources);
+        mySourcePlane = workPlane;
+        mySourceOperation = operation;
     }
 
     myShapes.clear();
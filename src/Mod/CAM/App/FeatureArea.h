@@ -64,12 +64,19 @@ public:
     {
         WorkPlane.setValue(shape);
         myArea.setPlane(shape);
+        mySources.clear();
     }
 
 private:
     Area myArea;
     std::vector<TopoDS_Shape> myShapes;
     bool myInited;
+
+    // The inputs myArea holds, as long as they are the same only new
+    // parameters are passed to it, see Area::setParams()
+    std::vector<TopoDS_Shape> mySources;
+    TopoDS_Shape mySourcePlane;
+    long mySourceOperation;
 };
 
 using FeatureAreaPython = App::FeaturePythonT<FeatureArea>;
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#endif
+
+#include "GCodeScanner.h"
+
+
+using namespace Path;
+
+namespace
+{
+bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '+';
+}
+
+bool isNumber(char c)
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '.';
+}
+}  // namespace
+
+double GCodeScanner::toDouble(std::string_view number)
+{
+    double value = 0.0;
+#if defined(__cpp_lib_to_chars)
+    if (std::from_chars(number.data(), number.data() + number.size(), value).ec != std::errc()) {
+        value = 0.0;
+    }
+#else
+    // libc++ doesn't support std::from_chars for floating point numbers yet
+    char str[64];
+    std::size_t len = std::min(number.size(), sizeof(str) - 1);
+    number.copy(str, len);
+    str[len] = '\0';
+    value = std::strtod(str, nullptr);
+#endif
+    return value;
+}
+
+bool GCodeScanner::next(Token& token)
+{
+    const std::size_t size = text.size();
+    while (pos < size) {
+        char c = text[pos];
+        if (c == '\n') {
+            pos++;
+            token = Token();
+            token.type = TokenType::EndOfLine;
+            return true;
+        }
+
+        if (c == '(') {
+            token = Token();
+            token.type = TokenType::Comment;
+            std::size_t end = text.find(')', pos + 1);
+            if (end == std::string_view::npos) {
+                token.text = text.substr(pos);
+                pos = size;
+            }
+            else {
+                token.text = text.substr(pos, end - pos + 1);
+                token.complete = true;
+                pos = end + 1;
+            }
+            return true;
+        }
+
+        pos++;
+        if (!std::isalpha(static_cast<unsigned char>(c))) {
+            continue;
+        }
+
+        token.type = TokenType::Word;
+        token.letter = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        while (pos < size && isBlank(text[pos])) {
+            pos++;
+        }
+        std::size_t begin = pos;
+        while (pos < size && isNumber(text[pos])) {
+            pos++;
+        }
+        token.text = text.substr(begin, pos - begin);
+
+        // the rare case of a number with blanks in between needs a copy
+        bool buffered = false;
+        while (pos > begin) {
+            std::size_t next = pos;
+            while (next < size && isBlank(text[next])) {
+                next++;
+            }
+            if (next == pos || next == size || !isNumber(text[next])) {
+                break;
+            }
+            if (!buffered) {
+                buffer.assign(token.text);
+                buffered = true;
+            }
+            pos = next;
+            while (pos < size && isNumber(text[pos])) {
+                buffer += text[pos++];
+            }
+        }
+        if (buffered) {
+            token.text = buffer;
+        }
+
+        token.complete = !token.text.empty();
+        token.value = token.complete ? toDouble(token.text) : 0.0;
+        return true;
+    }
+
+    token = Token();
+    return false;
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PATH_GCODESCANNER_H
+#define PATH_GCODESCANNER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <Mod/CAM/PathGlobal.h>
+
+
+namespace Path
+{
+
+/** Splits G-code text into words and comments without copying it
+ *
+ * A word is a letter followed by a number. Blanks and a '+' are skipped within a
+ * number, so "X 1.5" and "X+1.5" are the same word, other characters that are
+ * neither letters nor parts of a number are ignored. A comment reaches from an
+ * opening to the next closing parenthesis and may span several lines.
+ *
+ * The scanner doesn't know anything about the meaning of the words, it is shared
+ * by the toolpath and by the simulator that group the words in different ways.
+ */
+class PathExport GCodeScanner
+{
+public:
+    enum class TokenType
+    {
+        Word,
+        Comment,
+        EndOfLine,
+        End
+    };
+
+    struct Token
+    {
+        TokenType type = TokenType::End;
+        /// The upper case letter of a word
+        char letter = 0;
+        /// The value of a word, 0 if the number is missing or invalid
+        double value = 0.0;
+        /** The number of a word as written or the comment including the parentheses,
+         * only valid until the next token is read.
+         */
+        std::string_view text;
+        /// False for a word without a number or a comment without closing parenthesis
+        bool complete = false;
+    };
+
+    explicit GCodeScanner(std::string_view text)
+        : text(text)
+    {}
+
+    /// Reads the next token, returns false at the end of the text
+    bool next(Token& token);
+    /// The offset of the next character to be read
+    std::size_t position() const
+    {
+        return pos;
+    }
+
+    /** Parses a number like atof() does, a trailing garbage is ignored and a
+     * number that cannot be parsed at all gives 0.
+     */
+    static double toDouble(std::string_view number);
+
+private:
+    std::string_view text;
+    std::size_t pos = 0;
+    // holds the number of a word that is interrupted by blanks
+    std::string buffer;
+};
+
+}  // namespace Path
+
+
+#endif  // PATH_GCODESCANNER_H
@@ -21,14 +21,25 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <array>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <string_view>
+#include <thread>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 #include <Mod/CAM/App/PathSegmentWalker.h>
 
+#include "GCodeScanner.h"
 #include "Path.h"
 
 
@@ -41,10 +52,9 @@ Toolpath::Toolpath()
 {}
 
 Toolpath::Toolpath(const Toolpath& otherPath)
-    : vpcCommands(otherPath.vpcCommands.size())
+    : commands(otherPath.commands)
     , center(otherPath.center)
 {
-    *this = otherPath;
     recalculate();
 }
 
@@ -59,14 +69,7 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
         return *this;
     }
 
-    clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it = otherPath.vpcCommands.begin();
-         it != otherPath.vpcCommands.end();
-         ++it, i++) {
-        vpcCommands[i] = new Command(**it);
-    }
+    commands = otherPath.commands;
     center = otherPath.center;
     recalculate();
     return *this;
@@ -74,17 +77,13 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
 
 void Toolpath::clear()
 {
-    for (std::vector<Command*>::iterator it = vpcCommands.begin(); it != vpcCommands.end(); ++it) {
-        delete (*it);
-    }
-    vpcCommands.clear();
+    commands.clear();
     recalculate();
 }
 
 void Toolpath::addCommand(const Command& Cmd)
 {
-    Command* tmp = new Command(Cmd);
-    vpcCommands.push_back(tmp);
+    commands.push_back(Cmd);
     recalculate();
 }
 
@@ -93,9 +92,8 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
     if (pos == -1) {
         addCommand(Cmd);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        Command* tmp = new Command(Cmd);
-        vpcCommands.insert(vpcCommands.begin() + pos, tmp);
+    else if (pos >= 0 && pos <= static_cast<int>(commands.size())) {
+        commands.insert(pos, Cmd);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -105,12 +103,14 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
 
 void Toolpath::deleteCommand(int pos)
 {
+    if (commands.empty()) {
+        throw Base::IndexError("Index not in range");
+    }
     if (pos == -1) {
-        // delete(*vpcCommands.rbegin()); // causes crash
-        vpcCommands.pop_back();
+        commands.erase(commands.size() - 1);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        vpcCommands.erase(vpcCommands.begin() + pos);
+    else if (pos >= 0 && pos < static_cast<int>(commands.size())) {
+        commands.erase(pos);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -118,18 +118,28 @@ void Toolpath::deleteCommand(int pos)
     recalculate();
 }
 
+void Toolpath::setCommand(const Command& Cmd, unsigned int pos)
+{
+    if (pos >= commands.size()) {
+        throw Base::IndexError("Index not in range");
+    }
+    commands.replace(pos, Cmd);
+    recalculate();
+}
+
 double Toolpath::getLength()
 {
-    if (vpcCommands.empty()) {
+    if (commands.empty()) {
         return 0;
     }
     double l = 0;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
+    for (std::size_t i = 0; i < commands.size(); i++) {
+        const std::string& name = commands.name(i);
+        next.x = commands.value(i, 'X', last.x);
+        next.y = commands.value(i, 'Y', last.y);
+        next.z = commands.value(i, 'Z', last.z);
         if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
             // straight line
             l += (next - last).Length();
@@ -137,7 +147,7 @@ double Toolpath::getLength()
         }
         else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
             // arc
-            Vector3d center = (*it)->getCenter();
+            Vector3d center(commands.value(i, 'I'), commands.value(i, 'J'), commands.value(i, 'K'));
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -167,7 +177,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
-    if (vpcCommands.empty()) {
+    if (commands.empty()) {
         return 0;
     }
     double l = 0;
@@ -175,15 +185,15 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
     bool verticalMove = false;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
+    for (std::size_t i = 0; i < commands.size(); i++) {
+        const std::string& name = commands.name(i);
+        float feedrate = hFeed;
 
         l = 0;
         verticalMove = false;
-        feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
+        next.x = commands.value(i, 'X', last.x);
+        next.y = commands.value(i, 'Y', last.y);
+        next.z = commands.value(i, 'Z', last.z);
 
         if (last.z != next.z) {
             verticalMove = true;
@@ -204,7 +214,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         }
         else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
             // Arc Move
-            Vector3d center = (*it)->getCenter();
+            Vector3d center(commands.value(i, 'I'), commands.value(i, 'J'), commands.value(i, 'K'));
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -304,76 +314,181 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
+namespace
+{
+// the size of G-code text that is worth a thread of its own
+constexpr std::size_t MinChunkSize = 1 << 20;
+
+// The commands of a part of a G-code program. The units of the commands before the
+// first G20 or G21 of the part depend on the previous parts, they are scaled later.
+struct GCodeChunk
+{
+    std::string_view text;
+    CommandStorage commands;
+    std::size_t unitsUnknown = 0;
+    bool unitsSet = false;
+    bool inches = false;
+};
+
+void scaleSlots(std::uint32_t mask, std::array<double, 26>& slots, double factor)
 {
-    Command* cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
-        inches = true;
-        delete cmd;
+    for (char c : {'X', 'Y', 'Z', 'I', 'J', 'R', 'Q', 'F'}) {
+        if (mask & (1U << (c - 'A'))) {
+            slots[c - 'A'] *= factor;
+        }
     }
-    else if ("G21" == cmd->Name) {
-        inches = false;
-        delete cmd;
+}
+
+// Every G or M word starts a new command and every comment is a command of its own.
+// Words before the first command or after a comment are skipped.
+void parseGCode(GCodeChunk& chunk)
+{
+    GCodeScanner scanner(chunk.text);
+    GCodeScanner::Token token;
+    std::string name;
+    std::uint32_t mask = 0;
+    std::array<double, 26> slots {};
+    bool open = false;
+
+    auto finish = [&]() {
+        if (!open) {
+            return;
+        }
+        open = false;
+        if (name == "G20" || name == "G21") {
+            if (!chunk.unitsSet) {
+                chunk.unitsSet = true;
+                chunk.unitsUnknown = chunk.commands.size();
+            }
+            chunk.inches = name == "G20";
+            return;
+        }
+        if (chunk.inches) {
+            scaleSlots(mask, slots, 25.4);
+        }
+        chunk.commands.push_back(name, mask, slots.data());
+    };
+
+    while (scanner.next(token)) {
+        if (token.type == GCodeScanner::TokenType::Word) {
+            if (token.letter == 'G' || token.letter == 'M') {
+                finish();
+                if (!token.complete) {
+                    throw Base::BadFormatError("Badly formatted GCode command");
+                }
+                name.assign(1, token.letter);
+                name += token.text;
+                mask = 0;
+                open = true;
+            }
+            else if (open) {
+                if (!token.complete) {
+                    throw Base::BadFormatError("Badly formatted GCode argument");
+                }
+                int slot = token.letter - 'A';
+                mask |= 1U << slot;
+                slots[slot] = token.value;
+            }
+        }
+        else if (token.type == GCodeScanner::TokenType::Comment) {
+            finish();
+            // a comment that isn't closed is dropped together with the rest
+            if (!token.complete) {
+                break;
+            }
+            chunk.commands.push_back(token.text, 0, nullptr);
+        }
     }
-    else {
-        if (inches) {
-            cmd->scaleBy(25.4);
+    finish();
+
+    if (!chunk.unitsSet) {
+        chunk.unitsUnknown = chunk.commands.size();
+    }
+}
+
+// Splits the text at commands or comments, never inside of a comment
+std::vector<GCodeChunk> splitGCode(std::string_view text, std::size_t count)
+{
+    std::vector<std::size_t> starts {0};
+    std::size_t pos = 0;
+    for (std::size_t i = 1; i < count && pos != std::string_view::npos; i++) {
+        std::size_t target = i * (text.size() / count);
+        while (pos < target) {
+            std::size_t open = text.find('(', pos);
+            if (open == std::string_view::npos || open >= target) {
+                pos = target;
+                break;
+            }
+            std::size_t close = text.find(')', open + 1);
+            pos = close == std::string_view::npos ? close : close + 1;
         }
-        commands.push_back(cmd);
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        pos = text.find_first_of("(gGmM", pos);
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        if (pos > starts.back()) {
+            starts.push_back(pos);
+        }
+    }
+
+    std::vector<GCodeChunk> chunks(starts.size());
+    for (std::size_t i = 0; i < starts.size(); i++) {
+        std::size_t end = i + 1 < starts.size() ? starts[i + 1] : text.size();
+        chunks[i].text = text.substr(starts[i], end - starts[i]);
     }
+    return chunks;
 }
+}  // namespace
 
 void Toolpath::setFromGCode(const std::string instr)
 {
     clear();
 
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
+    std::size_t numThreads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    numThreads = std::min(numThreads, instr.size() / MinChunkSize);
+    std::vector<GCodeChunk> chunks = splitGCode(instr, std::max<std::size_t>(numThreads, 1));
+
+    // the parts are parsed independently and joined in order
+    std::vector<std::exception_ptr> errors(chunks.size());
+    std::atomic<std::size_t> next {0};
+    auto worker = [&chunks, &errors, &next]() {
+        for (std::size_t i = next++; i < chunks.size(); i = next++) {
+            try {
+                parseGCode(chunks[i]);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < std::min(numThreads, chunks.size()); i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& it : futures) {
+        it.get();
+    }
+
+    Base::rethrowFirstException(errors);
 
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
     bool inches = false;
-    while (found != std::string::npos) {
-        if (str[found] == '(') {
-            // start of comment
-            if ((last > -1) && (mode == "command")) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found + 1);
+    for (auto& chunk : chunks) {
+        if (inches) {
+            chunk.commands.scale(0, chunk.unitsUnknown, 25.4);
         }
-        else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
+        if (chunk.unitsSet) {
+            inches = chunk.inches;
         }
-        else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            last = found;
-            found = str.find_first_of("(gGmM", found + 1);
+        if (commands.empty()) {
+            commands = std::move(chunk.commands);
         }
-    }
-    // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+        else {
+            commands.append(chunk.commands);
         }
     }
     recalculate();
@@ -382,9 +497,8 @@ void Toolpath::setFromGCode(const std::string instr)
 std::string Toolpath::toGCode() const
 {
     std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
+    for (std::size_t i = 0; i < commands.size(); i++) {
+        result += commands.at(i).toGCode();
         result += "\n";
     }
     return result;
@@ -393,7 +507,7 @@ std::string Toolpath::toGCode() const
 void Toolpath::recalculate()  // recalculates the path cache
 {
 
-    if (vpcCommands.empty()) {
+    if (commands.empty()) {
         return;
     }
 
@@ -458,7 +572,7 @@ void Toolpath::recalculate()  // recalculates the path cache
 
 unsigned int Toolpath::getMemSize() const
 {
-    return toGCode().size();
+    return static_cast<unsigned int>(commands.memSize());
 }
 
 void Toolpath::setCenter(const Base::Vector3d& c)
@@ -467,6 +581,13 @@ void Toolpath::setCenter(const Base::Vector3d& c)
     recalculate();
 }
 
+static bool saveBinary()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/CAM");
+    return hGrp->GetBool("SaveBinaryToolpath", false);
+}
+
 static void saveCenter(Writer& writer, const Base::Vector3d& center)
 {
     writer.Stream() << writer.ind() << "<Center x=\"" << center.x << "\" y=\"" << center.y
@@ -475,16 +596,29 @@ static void saveCenter(Writer& writer, const Base::Vector3d& center)
 
 void Toolpath::Save(Writer& writer) const
 {
+    // SaveDocFile() must write the format announced here, even if the preference changes
+    binaryFile = false;
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Path count=\"" << getSize() << "\" version=\""
                         << SchemaVersion << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
         for (unsigned int i = 0; i < getSize(); i++) {
-            vpcCommands[i]->Save(writer);
+            commands.at(i).Save(writer);
         }
         writer.decInd();
     }
+    else if (saveBinary()) {
+        // older versions only read G-code, so the binary storage is opt-in
+        binaryFile = true;
+        writer.Stream() << writer.ind() << "<Path file=\""
+                        << writer.addFile((writer.ObjectName + ".ncb").c_str(), this)
+                        << "\" format=\"binary\" version=\"" << SchemaVersion << "\">"
+                        << std::endl;
+        writer.incInd();
+        saveCenter(writer, center);
+        writer.decInd();
+    }
     else {
         writer.Stream() << writer.ind() << "<Path file=\""
                         << writer.addFile((writer.ObjectName + ".nc").c_str(), this)
@@ -498,16 +632,21 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
+    if (binaryFile) {
+        // an empty storage is written too, RestoreDocFile() expects the header
+        commands.save(writer.Stream());
         return;
     }
-    writer.Stream() << toGCode();
+    for (std::size_t i = 0; i < commands.size(); i++) {
+        writer.Stream() << commands.at(i).toGCode() << '\n';
+    }
 }
 
 void Toolpath::Restore(XMLReader& reader)
 {
     reader.readElement("Path");
     std::string file(reader.getAttribute<const char*>("file"));
+    readFileFormat(reader);
 
     if (!file.empty()) {
         // initiate a file read
@@ -515,13 +654,21 @@ void Toolpath::Restore(XMLReader& reader)
     }
 }
 
+void Toolpath::readFileFormat(XMLReader& reader)
+{
+    binaryFile = reader.hasAttribute("format")
+        && std::string(reader.getAttribute<const char*>("format")) == "binary";
+}
+
 void Toolpath::RestoreDocFile(Base::Reader& reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
+    if (binaryFile) {
+        binaryFile = false;
+        commands.restore(reader);
+        recalculate();
+        return;
     }
-    setFromGCode(gcode);
+
+    std::string gcode((std::istreambuf_iterator<char>(reader)), std::istreambuf_iterator<char>());
+    setFromGCode(std::move(gcode));
 }
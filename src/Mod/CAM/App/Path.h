@@ -28,6 +28,7 @@
 #include <Base/Vector3D.h>
 
 #include "Command.h"
+#include "CommandStorage.h"
 
 
 namespace Path
@@ -52,12 +53,15 @@ public:
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    /// Takes the format of the document file from the Path element that was just read
+    void readFileFormat(Base::XMLReader& reader);
 
     // interface
     void clear();                                         // clears the internal data
     void addCommand(const Command& Cmd);                  // adds a command at the end
     void insertCommand(const Command& Cmd, int);          // inserts a command
     void deleteCommand(int);                              // deletes a command
+    void setCommand(const Command& Cmd, unsigned int);    // replaces a command
     double getLength();                                   // return the Length (mm) of the Path
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
     void recalculate();                                   // recalculates the points
@@ -69,15 +73,16 @@ public:
     // shortcut functions
     unsigned int getSize() const
     {
-        return vpcCommands.size();
+        return commands.size();
     }
-    const std::vector<Command*>& getCommands() const
+    /// Returns a copy of the command at \a pos
+    Command getCommand(unsigned int pos) const
     {
-        return vpcCommands;
+        return commands.at(pos);
     }
-    const Command& getCommand(unsigned int pos) const
+    const CommandStorage& getStorage() const
     {
-        return *vpcCommands[pos];
+        return commands;
     }
 
     // support for rotation
@@ -90,8 +95,10 @@ public:
     static const int SchemaVersion = 2;
 
 protected:
-    std::vector<Command*> vpcCommands;
+    CommandStorage commands;
     Base::Vector3d center;
+    // set by Save() and Restore() if the document file holds the binary storage
+    mutable bool binaryFile = false;
     // KDL::Path_Composite *pcPath;
 
     /*
@@ -21,6 +21,10 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <OSD_Parallel.hxx>
+#endif
+
 #include <vector>
 
 #include <App/Application.h>
@@ -117,6 +121,179 @@ void PathSegmentVisitor::g38(int id, const Base::Vector3d& last, const Base::Vec
     (void)next;
 }
 
+namespace
+{
+
+enum class Kind : std::uint8_t
+{
+    Other,
+    Rapid,
+    Feed,
+    ArcCW,
+    ArcCCW,
+    Absolute,
+    Relative,
+    AbsoluteCenter,
+    RelativeCenter,
+    Drill,
+    Probe,
+    PlaneXY,
+    PlaneXZ,
+    PlaneYZ,
+    RetractInitial,
+    RetractR
+};
+
+Kind classify(const std::string& name)
+{
+    if ((name == "G0") || (name == "G00")) {
+        return Kind::Rapid;
+    }
+    if ((name == "G1") || (name == "G01")) {
+        return Kind::Feed;
+    }
+    if ((name == "G2") || (name == "G02")) {
+        return Kind::ArcCW;
+    }
+    if ((name == "G3") || (name == "G03")) {
+        return Kind::ArcCCW;
+    }
+    if (name == "G90") {
+        return Kind::Absolute;
+    }
+    if (name == "G91") {
+        return Kind::Relative;
+    }
+    if (name == "G90.1") {
+        return Kind::AbsoluteCenter;
+    }
+    if (name == "G91.1") {
+        return Kind::RelativeCenter;
+    }
+    if ((name == "G73") || (name == "G81") || (name == "G82") || (name == "G83") || (name == "G84")
+        || (name == "G85") || (name == "G86") || (name == "G89")) {
+        return Kind::Drill;
+    }
+    if ((name == "G38.2") || (name == "G38.3") || (name == "G38.4") || (name == "G38.5")) {
+        return Kind::Probe;
+    }
+    if (name == "G17") {
+        return Kind::PlaneXY;
+    }
+    if (name == "G18") {
+        return Kind::PlaneXZ;
+    }
+    if (name == "G19") {
+        return Kind::PlaneYZ;
+    }
+    if (name == "G98") {
+        return Kind::RetractInitial;
+    }
+    if (name == "G99") {
+        return Kind::RetractR;
+    }
+    return Kind::Other;
+}
+
+// What is needed to split a move into segments once the state of the path is known
+struct Split
+{
+    std::size_t move;
+    int segments;
+    // the rotation at the start and at the end of the move
+    double A, B, C;
+    double a, b, c;
+    double Base::Vector3d::* pz;
+    // lines and drill cycles: the end of the straight part, without rotation
+    Base::Vector3d target;
+    // arcs
+    double direction;
+    double dangle;
+    double dZ;
+    // drill cycles
+    double r;
+    double q;
+    bool retractToR;
+};
+
+int rotationSegments(double A, double B, double C, double a, double b, double c, float deviation)
+{
+    double amax = std::max(fmod(fabs(a - A), 360),
+                           std::max(fmod(fabs(b - B), 360), fmod(fabs(c - C), 360)));
+    double angle = Base::toRadians(amax);
+    return std::max(ARC_MIN_SEGMENTS, 3.0 / (deviation / angle));
+}
+
+void splitMove(const Split& split,
+               const PathSegments::Move& move,
+               const Base::Vector3d& rotCenter,
+               Base::Vector3d* pt)
+{
+    int segments = split.segments;
+    double da = 0.0;
+    double db = 0.0;
+    double dc = 0.0;
+    if (segments > 0) {
+        da = (split.a - split.A) / segments;
+        db = (split.b - split.B) / segments;
+        dc = (split.c - split.C) / segments;
+    }
+
+    if (move.type == PathSegments::Arc) {
+        auto pz = split.pz;
+        Base::Vector3d norm;
+        norm.*pz = split.direction;
+        Base::Vector3d last0(move.last);
+        last0.*pz = 0.0;
+        Base::Vector3d center0(move.center);
+        center0.*pz = 0.0;
+
+        for (int j = 1; j < segments; j++) {
+            Base::Vector3d inter;
+            Base::Rotation rot(norm, split.dangle * j);
+            rot.multVec((last0 - center0), inter);
+            inter.*pz = move.last.*pz + split.dZ * j;  // Enable displaying helices
+
+            Base::Rotation arot = yawPitchRoll(split.A + da * j, split.B + db * j, split.C + dc * j);
+            *pt++ = compensateRotation(center0 + inter, arot, rotCenter);
+        }
+        return;
+    }
+
+    if (segments > 0) {
+        Base::Vector3d dnext = (split.target - move.last) / segments;
+
+        for (int j = 1; j < segments; j++) {
+            Base::Vector3d inter = move.last + dnext * j;
+
+            Base::Rotation rot = yawPitchRoll(split.A + da * j, split.B + db * j, split.C + dc * j);
+            *pt++ = compensateRotation(inter, rot, rotCenter);
+        }
+    }
+
+    if (move.type == PathSegments::Drill) {
+        auto pz = split.pz;
+        Base::Rotation nrot = yawPitchRoll(split.a, split.b, split.c);
+        Base::Vector3d p2(move.next);
+        p2.*pz = split.r;
+        Base::Vector3d p3(move.next);
+        p3.*pz = split.retractToR ? p2.*pz : move.last.*pz;
+
+        *pt++ = compensateRotation(split.target, nrot, rotCenter);
+        *pt++ = compensateRotation(p2, nrot, rotCenter);
+        *pt++ = compensateRotation(p3, nrot, rotCenter);
+
+        if (split.q > 0) {
+            Base::Vector3d temp(move.next);
+            for (temp.*pz = split.r; temp.*pz > move.next.*pz; temp.*pz -= split.q) {
+                *pt++ = compensateRotation(temp, nrot, rotCenter);
+            }
+        }
+    }
+}
+
+}  // namespace
+
 PathSegmentWalker::PathSegmentWalker(const Toolpath& tp_)
     : tp(tp_)
 {}
@@ -128,6 +305,50 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
         return;
     }
 
+    PathSegments segments = collect(startPosition);
+    const Base::Vector3d* points = segments.points.data();
+    auto range = [points](std::size_t begin, std::size_t end) {
+        return std::deque<Base::Vector3d>(points + begin, points + end);
+    };
+
+    cb.setup(segments.start);
+
+    for (const auto& move : segments.moves) {
+        switch (move.type) {
+            case PathSegments::Rapid:
+                cb.g0(move.id, move.last, move.next, range(move.begin, move.end));
+                break;
+            case PathSegments::Feed:
+                cb.g1(move.id, move.last, move.next, range(move.begin, move.end));
+                break;
+            case PathSegments::Arc:
+                cb.g23(move.id, move.last, move.next, range(move.begin, move.end), move.center);
+                break;
+            case PathSegments::Drill:
+                cb.g8x(move.id,
+                       move.last,
+                       move.next,
+                       range(move.begin, move.end),
+                       range(move.end, move.end + 3),
+                       range(move.end + 3, move.cycleEnd));
+                break;
+            case PathSegments::Probe:
+                cb.g38(move.id, move.last, move.next);
+                break;
+        }
+    }
+}
+
+PathSegments PathSegmentWalker::collect(const Base::Vector3d& startPosition) const
+{
+    PathSegments result;
+    result.start = startPosition;
+
+    const CommandStorage& storage = tp.getStorage();
+    if (storage.empty()) {
+        return result;
+    }
+
     ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
         "User parameter:BaseApp/Preferences/Mod/Part");
     float deviation = hGrp->GetFloat("MeshDeviation", 0.2);
@@ -141,78 +362,99 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
 
     bool absolute = true;
     bool absolutecenter = false;
+    int retract_mode = 98;
 
     // for mapping the coordinates to XY plane
     double Base::Vector3d::* pz = &Base::Vector3d::z;
 
-    cb.setup(last);
-
-    for (unsigned int i = 0; i < tp.getSize(); i++) {
-        std::deque<Base::Vector3d> points;
+    // the names are classified once instead of for every command
+    std::vector<Kind> kinds;
+    kinds.reserve(storage.names().size());
+    for (const auto& name : storage.names()) {
+        kinds.push_back(classify(name));
+    }
 
-        const Path::Command& cmd = tp.getCommand(i);
-        const std::string& name = cmd.Name;
-        Base::Vector3d next = cmd.getPlacement().getPosition();
-        double a = A;
-        double b = B;
-        double c = C;
+    // The state of the path is tracked in order, the moves that need more than their end
+    // point are split afterwards.
+    std::vector<Split> splits;
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < storage.size(); i++) {
+        Kind kind = kinds[storage.nameIndex(i)];
+        switch (kind) {
+            case Kind::Other:
+                continue;
+            case Kind::Absolute:
+                absolute = true;
+                continue;
+            case Kind::Relative:
+                absolute = false;
+                continue;
+            case Kind::AbsoluteCenter:
+                absolutecenter = true;
+                continue;
+            case Kind::RelativeCenter:
+                absolutecenter = false;
+                continue;
+            case Kind::PlaneXY:
+                pz = &Base::Vector3d::z;
+                continue;
+            case Kind::PlaneXZ:
+                pz = &Base::Vector3d::y;
+                continue;
+            case Kind::PlaneYZ:
+                pz = &Base::Vector3d::x;
+                continue;
+            case Kind::RetractInitial:
+                retract_mode = 98;
+                continue;
+            case Kind::RetractR:
+                retract_mode = 99;
+                continue;
+            default:
+                break;
+        }
 
+        int id = static_cast<int>(i);
+        Base::Vector3d next(storage.value(i, 'X'), storage.value(i, 'Y'), storage.value(i, 'Z'));
         if (!absolute) {
             next = last + next;
         }
-        if (!cmd.has("X")) {
+        if (!storage.has(i, 'X')) {
             next.x = last.x;
         }
-        if (!cmd.has("Y")) {
+        if (!storage.has(i, 'Y')) {
             next.y = last.y;
         }
-        if (!cmd.has("Z")) {
+        if (!storage.has(i, 'Z')) {
             next.z = last.z;
         }
-        if (cmd.has("A")) {
-            a = cmd.getValue("A");
-        }
-        if (cmd.has("B")) {
-            b = cmd.getValue("B");
-        }
-        if (cmd.has("C")) {
-            c = cmd.getValue("C");
-        }
+        double a = storage.value(i, 'A', A);
+        double b = storage.value(i, 'B', B);
+        double c = storage.value(i, 'C', C);
 
         Base::Rotation nrot = yawPitchRoll(a, b, c);
 
-        Base::Vector3d rnext = compensateRotation(next, nrot, rotCenter);
+        Split split {result.moves.size(), 0, A, B, C, a, b, c, pz};
 
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
+        if (kind == Kind::Rapid || kind == Kind::Feed) {
             // straight line
+            PathSegments::Move move {id,
+                                     kind == Kind::Rapid ? PathSegments::Rapid : PathSegments::Feed,
+                                     last,
+                                     compensateRotation(next, nrot, rotCenter),
+                                     Base::Vector3d(),
+                                     count,
+                                     count,
+                                     count};
             if (nrot != lrot) {
-                double amax = std::max(fmod(fabs(a - A), 360),
-                                       std::max(fmod(fabs(b - B), 360), fmod(fabs(c - C), 360)));
-                double angle = Base::toRadians(amax);
-                int segments = std::max(ARC_MIN_SEGMENTS, 3.0 / (deviation / angle));
-
-                double da = (a - A) / segments;
-                double db = (b - B) / segments;
-                double dc = (c - C) / segments;
-
-                Base::Vector3d dnext = (next - last) / segments;
-
-                for (int j = 1; j < segments; j++) {
-                    Base::Vector3d inter = last + dnext * j;
-
-                    Base::Rotation rot = yawPitchRoll(A + da * j, B + db * j, C + dc * j);
-                    Base::Vector3d rinter = compensateRotation(inter, rot, rotCenter);
-
-                    points.push_back(rinter);
-                }
-            }
-
-            if ("G0" == name || "G00" == name) {
-                cb.g0(i, last, rnext, points);
-            }
-            else {
-                cb.g1(i, last, rnext, points);
+                split.segments = rotationSegments(A, B, C, a, b, c, deviation);
+                split.target = next;
+                splits.push_back(split);
+                count += split.segments - 1;
             }
+            move.end = move.cycleEnd = count;
+            result.moves.push_back(move);
 
             last = next;
             A = a;
@@ -220,23 +462,21 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             C = c;
             lrot = nrot;
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else if (kind == Kind::ArcCW || kind == Kind::ArcCCW) {
             // arc
-            Base::Vector3d norm;
             Base::Vector3d center;
-
-            if ((name == "G2") || (name == "G02")) {
-                norm.*pz = -1.0;
-            }
-            else {
-                norm.*pz = 1.0;
-            }
+            split.direction = kind == Kind::ArcCW ? -1.0 : 1.0;
 
             if (absolutecenter) {
-                center = cmd.getCenter();
+                center = Base::Vector3d(storage.value(i, 'I'),
+                                        storage.value(i, 'J'),
+                                        storage.value(i, 'K'));
             }
             else {
-                center = (last + cmd.getCenter());
+                center = (last
+                          + Base::Vector3d(storage.value(i, 'I'),
+                                           storage.value(i, 'J'),
+                                           storage.value(i, 'K')));
             }
             Base::Vector3d next0(next);
             next0.*pz = 0.0;
@@ -244,17 +484,16 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             last0.*pz = 0.0;
             Base::Vector3d center0(center);
             center0.*pz = 0.0;
-            // double radius = (last - center).Length();
             double angle = (next0 - center0).GetAngle(last0 - center0);
             // GetAngle will always return the minor angle. Switch if needed
             Base::Vector3d anorm = (last0 - center0) % (next0 - center0);
             if (anorm.*pz < 0) {
-                if (name == "G3" || name == "G03") {
+                if (kind == Kind::ArcCCW) {
                     angle = std::numbers::pi * 2 - angle;
                 }
             }
             else if (anorm.*pz > 0) {
-                if (name == "G2" || name == "G02") {
+                if (kind == Kind::ArcCW) {
                     angle = std::numbers::pi * 2 - angle;
                 }
             }
@@ -265,31 +504,27 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             double amax = std::max(fmod(fabs(a - A), 360),
                                    std::max(fmod(fabs(b - B), 360), fmod(fabs(c - C), 360)));
 
-            int segments = std::max(
+            split.segments = std::max(
                 ARC_MIN_SEGMENTS,
                 3.0
                     / (deviation
                        / std::max(angle, amax)));  // we use a rather simple rule here, provisorily
-            double dZ = (next.*pz - last.*pz) / segments;  // How far each segment will helix in Z
-
-            double dangle = angle / segments;
-            double da = (a - A) / segments;
-            double db = (b - B) / segments;
-            double dc = (c - C) / segments;
-
-            for (int j = 1; j < segments; j++) {
-                Base::Vector3d inter;
-                Base::Rotation rot(norm, dangle * j);
-                rot.multVec((last0 - center0), inter);
-                inter.*pz = last.*pz + dZ * j;  // Enable displaying helices
-
-                Base::Rotation arot = yawPitchRoll(A + da * j, B + db * j, C + dc * j);
-                Base::Vector3d rinter = compensateRotation(center0 + inter, arot, rotCenter);
-
-                points.push_back(rinter);
-            }
-
-            cb.g23(i, last, rnext, points, center);
+            split.dZ = (next.*pz - last.*pz)
+                / split.segments;  // How far each segment will helix in Z
+            split.dangle = angle / split.segments;
+            splits.push_back(split);
+
+            PathSegments::Move move {id,
+                                     PathSegments::Arc,
+                                     last,
+                                     compensateRotation(next, nrot, rotCenter),
+                                     center,
+                                     count,
+                                     count,
+                                     count};
+            count += split.segments - 1;
+            move.end = move.cycleEnd = count;
+            result.moves.push_back(move);
 
             last = next;
             A = a;
@@ -297,119 +532,71 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             C = c;
             lrot = nrot;
         }
-        else if (name == "G90") {
-            // absolute mode
-            absolute = true;
-        }
-        else if (name == "G91") {
-            // relative mode
-            absolute = false;
-        }
-        else if (name == "G90.1") {
-            // absolute mode
-            absolutecenter = true;
-        }
-        else if (name == "G91.1") {
-            // relative mode
-            absolutecenter = false;
-        }
-        else if ((name == "G73") || (name == "G81") || (name == "G82") || (name == "G83")
-                 || (name == "G84") || (name == "G85") || (name == "G86") || (name == "G89")) {
+        else if (kind == Kind::Drill) {
             // drill,tap,bore
-            double r = 0;
-            if (cmd.has("R")) {
-                r = cmd.getValue("R");
-            }
-
-            std::deque<Base::Vector3d> plist;
-            std::deque<Base::Vector3d> qlist;
+            split.r = storage.value(i, 'R');
+            split.q = storage.value(i, 'Q');
+            split.retractToR = retract_mode == 99;
 
             Base::Vector3d p1(next);
             p1.*pz = last.*pz;
-
+            split.target = p1;
+
+            PathSegments::Move move {id,
+                                     PathSegments::Drill,
+                                     last,
+                                     next,
+                                     Base::Vector3d(),
+                                     count,
+                                     count,
+                                     count};
             if (nrot != lrot) {
-                double amax = std::max(fmod(fabs(a - A), 360),
-                                       std::max(fmod(fabs(b - B), 360), fmod(fabs(c - C), 360)));
-                double angle = Base::toRadians(amax);
-                int segments = std::max(ARC_MIN_SEGMENTS, 3.0 / (deviation / angle));
-
-                double da = (a - A) / segments;
-                double db = (b - B) / segments;
-                double dc = (c - C) / segments;
-
-                Base::Vector3d dnext = (p1 - last) / segments;
-
-                for (int j = 1; j < segments; j++) {
-                    Base::Vector3d inter = last + dnext * j;
-
-                    Base::Rotation rot = yawPitchRoll(A + da * j, B + db * j, C + dc * j);
-                    Base::Vector3d rinter = compensateRotation(inter, rot, rotCenter);
-
-                    points.push_back(rinter);
-                }
+                split.segments = rotationSegments(A, B, C, a, b, c, deviation);
+                count += split.segments - 1;
             }
-
-            Base::Vector3d p1r = compensateRotation(p1, nrot, rotCenter);
-            Base::Vector3d p2(next);
-            p2.*pz = r;
-            Base::Vector3d p2r = compensateRotation(p2, nrot, rotCenter);
-
-            double q;
-            if (cmd.has("Q")) {
-                q = cmd.getValue("Q");
-                if (q > 0) {
-                    Base::Vector3d temp(next);
-                    for (temp.*pz = r; temp.*pz > next.*pz; temp.*pz -= q) {
-                        Base::Vector3d pr = compensateRotation(temp, nrot, rotCenter);
-                        qlist.push_back(pr);
-                    }
+            move.end = count;
+            count += 3;
+            if (split.q > 0) {
+                Base::Vector3d temp(next);
+                for (temp.*pz = split.r; temp.*pz > next.*pz; temp.*pz -= split.q) {
+                    ++count;
                 }
             }
+            move.cycleEnd = count;
+            splits.push_back(split);
+            result.moves.push_back(move);
 
             Base::Vector3d p3(next);
-            if (retract_mode == 99) {  // G81,G83 need to account for G99 and retract to R only
-                p3.*pz = p2.*pz;
+            if (split.retractToR) {  // G81,G83 need to account for G99 and retract to R only
+                p3.*pz = split.r;
             }
             else {
                 p3.*pz = last.*pz;
             }
 
-
-            Base::Vector3d p3r = compensateRotation(p3, nrot, rotCenter);
-
-            plist.push_back(p1r);
-            plist.push_back(p2r);
-            plist.push_back(p3r);
-
-            cb.g8x(i, last, next, points, plist, qlist);
-
             last = p3;
             A = a;
             B = b;
             C = c;
             lrot = nrot;
         }
-        else if ((name == "G38.2") || (name == "G38.3") || (name == "G38.4") || (name == "G38.5")) {
+        else if (kind == Kind::Probe) {
             // Straight probe
-            cb.g38(i, last, next);
+            result.moves.push_back(
+                {id, PathSegments::Probe, last, next, Base::Vector3d(), count, count, count});
             last = next;
         }
-        else if (name == "G17") {
-            pz = &Base::Vector3d::z;
-        }
-        else if (name == "G18") {
-            pz = &Base::Vector3d::y;
-        }
-        else if (name == "G19") {
-            pz = &Base::Vector3d::x;
-        }
-        else if (name == "G98") {
-            retract_mode = 98;
-        }
-        else if (name == "G99") {
-            retract_mode = 99;
-        }
     }
+
+    result.points.resize(count);
+    Base::Vector3d* points = result.points.data();
+    OSD_Parallel::For(0, static_cast<int>(splits.size()), [&](int k) {
+        const Split& split = splits[k];
+        const PathSegments::Move& move = result.moves[split.move];
+        splitMove(split, move, rotCenter, points + move.begin);
+    });
+
+    return result;
 }
 
 
@@ -22,7 +22,9 @@
 #ifndef PATHSEGMENTWALKER_H
 #define PATHSEGMENTWALKER_H
 
+#include <cstdint>
 #include <deque>
+#include <vector>
 
 #include <Base/Vector3D.h>
 
@@ -65,6 +67,46 @@ public:
     virtual void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next);
 };
 
+/**
+ * PathSegments holds the movement commands of a path split into straight segments, as built by
+ * PathSegmentWalker::collect(). The intermediate points of all moves are kept in one array, every
+ * move refers to its range in there.
+ */
+struct PathExport PathSegments
+{
+    enum MoveType : std::uint8_t
+    {
+        Rapid,
+        Feed,
+        Arc,
+        Drill,
+        Probe
+    };
+
+    struct Move
+    {
+        /// index of the command
+        int id;
+        MoveType type;
+        Base::Vector3d last;
+        /// the end of the move, as passed to the PathSegmentVisitor
+        Base::Vector3d next;
+        /// the center of an arc
+        Base::Vector3d center;
+        /// the range of the intermediate points
+        std::size_t begin;
+        std::size_t end;
+        /** A drill cycle continues with the three points of its cycle and its peck
+         * points up to here.
+         */
+        std::size_t cycleEnd;
+    };
+
+    Base::Vector3d start;
+    std::vector<Move> moves;
+    std::vector<Base::Vector3d> points;
+};
+
 /**
  * PathSegmentWalker processes a path and splits all movement commands into straight segments and
  * calls the appropriate member of the provided PathSegmentVisitor. All non-movement commands are
@@ -78,9 +120,14 @@ public:
 
     void walk(PathSegmentVisitor& cb, const Base::Vector3d& startPosition);
 
+    /** Splits all movement commands at once
+     * The commands are read from the storage of the path, the arcs and rotations are split
+     * into segments in parallel. walk() calls the visitor with the result of this.
+     */
+    PathSegments collect(const Base::Vector3d& startPosition) const;
+
 private:
     const Toolpath& tp;
-    int retract_mode;
 };
 
 
@@ -43,12 +43,25 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <charconv>
 #include <cinttypes>
+#include <cstdlib>
+#include <exception>
+#include <future>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // Boost
@@ -85,6 +98,7 @@
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_FreeBounds.hxx>
 #include <ShapeExtend_WireData.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
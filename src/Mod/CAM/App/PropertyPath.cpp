@@ -105,6 +105,7 @@ void PropertyPath::Restore(Base::XMLReader& reader)
     reader.readElement("Path");
 
     std::string file(reader.getAttribute<const char*>("file"));
+    _Path.readFileFormat(reader);
     if (!file.empty()) {
         // initiate a file read
         reader.addFile(file.c_str(), this);
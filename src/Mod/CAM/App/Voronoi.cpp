@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <iterator>
+#include <OSD_Parallel.hxx>
 #endif
 
 #include <Base/Vector3D.h>
@@ -37,6 +40,16 @@ TYPESYSTEM_SOURCE(Path::Voronoi, Base::BaseClass)
 
 // Helpers
 
+template<typename T>
+static int indexIn(const std::vector<T>& elements, const T* element)
+{
+    if (elements.empty() || element < elements.data()
+        || element >= elements.data() + elements.size()) {
+        return Voronoi::InvalidIndex;
+    }
+    return static_cast<int>(element - elements.data());
+}
+
 // Voronoi::diagram_type
 
 Voronoi::diagram_type::diagram_type()
@@ -71,48 +84,15 @@ Base::Vector3d Voronoi::diagram_type::scaledVector(const vertex_type& v, double
 
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::cell_type* cell) const
 {
-    auto it = cell_index.find(intptr_t(cell));
-    if (it == cell_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexIn(cells(), cell);
 }
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::edge_type* edge) const
 {
-    auto it = edge_index.find(intptr_t(edge));
-    if (it == edge_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexIn(edges(), edge);
 }
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::vertex_type* vertex) const
 {
-    auto it = vertex_index.find(intptr_t(vertex));
-    if (it == vertex_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
-}
-
-void Voronoi::diagram_type::reIndex()
-{
-    int idx = 0;
-    cell_index.clear();
-    edge_index.clear();
-    vertex_index.clear();
-
-    idx = 0;
-    for (auto it = cells().begin(); it != cells().end(); ++it, ++idx) {
-        cell_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = edges().begin(); it != edges().end(); ++it, ++idx) {
-        edge_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = vertices().begin(); it != vertices().end(); ++it, ++idx) {
-        vertex_index[intptr_t(&(*it))] = idx;
-    }
+    return indexIn(vertices(), vertex);
 }
 
 Voronoi::point_type
@@ -203,27 +183,48 @@ void Voronoi::construct()
                       vd->segments.begin(),
                       vd->segments.end(),
                       static_cast<voronoi_diagram_type*>(vd));
-    vd->reIndex();
 }
 
 void Voronoi::colorExterior(const Voronoi::diagram_type::edge_type* edge, std::size_t colorValue)
 {
-    if (edge->color()) {
-        // end recursion
-        return;
+    // Colors the edge and returns its end vertex if the edges around it are to be visited next
+    auto visit = [colorValue](const diagram_type::edge_type* e) -> const vertex_type* {
+        if (e->color()) {
+            return nullptr;
+        }
+        e->color(colorValue);
+        e->twin()->color(colorValue);
+        auto v = e->vertex1();
+        if (!v || !e->is_primary()) {
+            return nullptr;
+        }
+        v->color(colorValue);
+        return v;
+    };
+
+    // A depth first walk in the same order as recursing into the edges would do, without
+    // running out of stack on large diagrams. Which one of two twins is followed depends on that
+    // order.
+    struct Around
+    {
+        const vertex_type* vertex;
+        const diagram_type::edge_type* next;
+    };
+    std::vector<Around> stack;
+    if (auto v = visit(edge)) {
+        stack.push_back({v, v->incident_edge()});
     }
-    edge->color(colorValue);
-    edge->twin()->color(colorValue);
-    auto v = edge->vertex1();
-    if (!v || !edge->is_primary()) {
-        return;
+    while (!stack.empty()) {
+        Around& around = stack.back();
+        auto e = around.next;
+        around.next = e->rot_next();
+        if (around.next == around.vertex->incident_edge()) {
+            stack.pop_back();
+        }
+        if (auto v = visit(e)) {
+            stack.push_back({v, v->incident_edge()});
+        }
     }
-    v->color(colorValue);
-    auto e = v->incident_edge();
-    do {
-        colorExterior(e, colorValue);
-        e = e->rot_next();
-    } while (e != v->incident_edge());
 }
 
 void Voronoi::colorExterior(Voronoi::color_type color)
@@ -238,15 +239,16 @@ void Voronoi::colorExterior(Voronoi::color_type color)
 
 void Voronoi::colorTwins(Voronoi::color_type color)
 {
-    for (diagram_type::const_edge_iterator it = vd->edges().begin(); it != vd->edges().end();
-         ++it) {
-        if (!it->color()) {
-            auto twin = it->twin();
-            if (!twin->color()) {
-                twin->color(color);
-            }
+    // Every pair of twins is handled by its first edge, which leaves the second one to be colored
+    // if neither has a color yet. No edge is touched by two iterations.
+    const auto& edges = vd->edges();
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int i) {
+        const auto& edge = edges[i];
+        auto twin = edge.twin();
+        if (&edge < twin && !edge.color() && !twin->color()) {
+            twin->color(color);
         }
-    }
+    });
 }
 
 double Voronoi::diagram_type::angleOfSegment(int i, Voronoi::diagram_type::angle_map_t* angle) const
@@ -294,17 +296,28 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree)
     using std::numbers::pi;
     double rad = Base::toRadians(degree);
 
-    Voronoi::diagram_type::angle_map_t angle;
     int psize = vd->points.size();
 
-    for (diagram_type::const_edge_iterator it = vd->edges().begin(); it != vd->edges().end();
-         ++it) {
+    std::vector<double> angle(vd->segments.size());
+    OSD_Parallel::For(0, static_cast<int>(angle.size()), [&](int i) {
+        angle[i] = vd->angleOfSegment(i);
+    });
+
+    // The test is the same for both twins and colors both of them, so it is done once per pair
+    // by its first edge. It passes if either twin has no color yet.
+    const auto& edges = vd->edges();
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int i) {
+        auto it = &edges[i];
+        auto twin = it->twin();
+        if (it > twin || (it->color() != 0 && twin->color() != 0)) {
+            return;
+        }
         int i0 = it->cell()->source_index() - psize;
-        int i1 = it->twin()->cell()->source_index() - psize;
-        if (it->color() == 0 && it->cell()->contains_segment()
-            && it->twin()->cell()->contains_segment() && vd->segmentsAreConnected(i0, i1)) {
-            double a0 = vd->angleOfSegment(i0, &angle);
-            double a1 = vd->angleOfSegment(i1, &angle);
+        int i1 = twin->cell()->source_index() - psize;
+        if (it->cell()->contains_segment() && twin->cell()->contains_segment()
+            && vd->segmentsAreConnected(i0, i1)) {
+            double a0 = angle[i0];
+            double a1 = angle[i1];
             double a = a0 - a1;
             if (a > pi / 2) {
                 a -= pi;
@@ -314,10 +327,10 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree)
             }
             if (fabs(a) < rad) {
                 it->color(color);
-                it->twin()->color(color);
+                twin->color(color);
             }
         }
-    }
+    });
 }
 
 void Voronoi::resetColor(Voronoi::color_type color)
@@ -338,3 +351,86 @@ void Voronoi::resetColor(Voronoi::color_type color)
         }
     }
 }
+
+std::vector<std::vector<int>> Voronoi::getWires(Voronoi::color_type color) const
+{
+    const auto& edges = vd->edges();
+
+    // the edges at every vertex, and the vertices in the order they are found
+    std::vector<std::vector<int>> incident(vd->num_vertices());
+    std::vector<int> order;
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const auto& edge = edges[i];
+        if (edge.color() != color || !edge.is_finite()) {
+            continue;
+        }
+        for (auto v : {vd->index(edge.vertex0()), vd->index(edge.vertex1())}) {
+            if (incident[v].empty()) {
+                order.push_back(v);
+            }
+            incident[v].push_back(static_cast<int>(i));
+        }
+    }
+
+    // knots are the start and end points of a wire
+    std::vector<int> knots;
+    std::copy_if(order.begin(), order.end(), std::back_inserter(knots), [&](int v) {
+        return incident[v].size() == 1;
+    });
+    std::copy_if(order.begin(), order.end(), std::back_inserter(knots), [&](int v) {
+        return incident[v].size() > 2;
+    });
+    if (knots.empty() && !order.empty()) {
+        knots.push_back(order.front());
+    }
+
+    auto consume = [&](int v, int edge) {
+        auto& list = incident[v];
+        list.erase(std::remove(list.begin(), list.end(), edge), list.end());
+        return list.empty();
+    };
+    // adds the edge leaving vStart to the wire, returns the vertex to continue from or -1
+    auto traverse = [&](int vStart, int edge, std::vector<int>& wire) {
+        const auto& e = edges[edge];
+        int vEnd = 0;
+        if (vStart == vd->index(e.vertex0())) {
+            vEnd = vd->index(e.vertex1());
+            wire.push_back(edge);
+        }
+        else {
+            vEnd = vd->index(e.vertex0());
+            wire.push_back(vd->index(e.twin()));
+        }
+        consume(vStart, edge);
+        if (consume(vEnd, edge)) {
+            return -1;
+        }
+        return vEnd;
+    };
+
+    std::vector<std::vector<int>> wires;
+    while (!knots.empty()) {
+        int vFirst = knots.front();
+        int vStart = vFirst;
+        int vLast = vFirst;
+        if (!incident[vStart].empty()) {
+            std::vector<int> wire;
+            while (vStart >= 0) {
+                vLast = vStart;
+                if (!incident[vStart].empty()) {
+                    vStart = traverse(vStart, incident[vStart].front(), wire);
+                }
+                else {
+                    vStart = -1;
+                }
+            }
+            wires.push_back(std::move(wire));
+        }
+        for (int v : {vFirst, vLast}) {
+            if (incident[v].empty()) {
+                knots.erase(std::remove(knots.begin(), knots.end(), v), knots.end());
+            }
+        }
+    }
+    return wires;
+}
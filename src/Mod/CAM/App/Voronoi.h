@@ -68,16 +68,11 @@ public:
         Base::Vector3d scaledVector(const point_type& p, double z) const;
         Base::Vector3d scaledVector(const vertex_type& v, double z) const;
 
-        using cell_map_type = std::map<intptr_t, int>;
-        using edge_map_type = std::map<intptr_t, int>;
-        using vertex_map_type = std::map<intptr_t, int>;
-
+        // The diagram keeps its elements in vectors, the index is the position in there
         int index(const cell_type* cell) const;
         int index(const edge_type* edge) const;
         int index(const vertex_type* vertex) const;
 
-        void reIndex();
-
         std::vector<point_type> points;
         std::vector<segment_type> segments;
 
@@ -90,9 +85,6 @@ public:
 
     private:
         double scale;
-        cell_map_type cell_index;
-        edge_map_type edge_index;
-        vertex_map_type vertex_index;
     };
 
     void addPoint(const point_type& p);
@@ -110,6 +102,13 @@ public:
     void colorTwins(color_type color);
     void colorColinear(color_type color, double degree);
 
+    /** Chains the finite edges of the given color into wires
+     * A wire ends where none or more than two edges of the color meet, each
+     * edge is oriented along its wire, with its twin taking its place if needed.
+     * Returns the edge indices of every wire.
+     */
+    std::vector<std::vector<int>> getWires(color_type color) const;
+
     template<typename T>
     T* create(int index)
     {
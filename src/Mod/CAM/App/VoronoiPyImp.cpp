@@ -284,6 +284,25 @@ PyObject* VoronoiPy::colorColinear(PyObject* args)
     return Py_None;
 }
 
+PyObject* VoronoiPy::getWires(PyObject* args) const
+{
+    Voronoi::color_type color = 0;
+    if (!PyArg_ParseTuple(args, "k", &color)) {
+        throw Py::RuntimeError("getWires requires an integer (color) argument");
+    }
+
+    Voronoi* vo = getVoronoiPtr();
+    Py::List list;
+    for (const auto& wire : vo->getWires(color)) {
+        Py::List edges;
+        for (int index : wire) {
+            edges.append(Py::asObject(new VoronoiEdgePy(vo->create<VoronoiEdge>(index))));
+        }
+        list.append(edges);
+    }
+    return Py::new_reference_to(list);
+}
+
 PyObject* VoronoiPy::resetColor(PyObject* args)
 {
     Voronoi::color_type color = 0;
@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import time
+
+import Path
+from CAMTests.PathTestUtils import PathTestBase
+
+
+def surfacingProgram(lines):
+    """Returns the G-code of a zig-zag surfacing operation with the given number of lines."""
+    gcode = ["(surfacing)", "G21", "G0 Z5.000000"]
+    for i in range(lines):
+        x = 100.0 if i % 2 else 0.0
+        gcode.append("G1 X%.6f Y%.6f Z%.6f F800.000000" % (x, i * 0.1, -(i % 7) * 0.01))
+    gcode.append("G0 Z5.000000")
+    return "\n".join(gcode) + "\n"
+
+
+def benchmark(lines=2000000):
+    """Prints the time to parse a large program, not part of the unit tests.
+
+    Run it from the Python console with
+        from CAMTests import TestPathGCodeParser
+        TestPathGCodeParser.benchmark()
+    """
+    gcode = surfacingProgram(lines)
+    print("G-code size: %.1f MB" % (len(gcode) / 1e6))
+
+    start = time.perf_counter()
+    path = Path.Path(gcode)
+    print("parse: %.3f s for %d commands" % (time.perf_counter() - start, path.Size))
+
+    start = time.perf_counter()
+    text = path.toGCode()
+    print("toGCode: %.3f s" % (time.perf_counter() - start))
+
+    start = time.perf_counter()
+    Path.Path(text)
+    print("parse again: %.3f s" % (time.perf_counter() - start))
+
+
+class TestPathGCodeParser(PathTestBase):
+    def test00(self):
+        """Test parsing of words, blanks and comments"""
+        path = Path.Path("(header) X5 G0 X1 Y 2.5 z-3\ng01x+4 (a  (b) c) M3 S1000")
+        self.assertEqual(
+            [c.Name for c in path.Commands], ["(header)", "G0", "G01", "(a  (b)", "M3"]
+        )
+        self.assertEqual(path.Commands[1].Parameters, {"X": 1.0, "Y": 2.5, "Z": -3.0})
+        self.assertEqual(path.Commands[2].Parameters, {"X": 4.0})
+        self.assertEqual(path.Commands[4].Parameters, {"S": 1000.0})
+
+    def test10(self):
+        """Test the change of units"""
+        path = Path.Path("G20\nG1 X1 F2\nG21 G1 X1")
+        self.assertEqual(path.Size, 2)
+        self.assertRoughly(path.Commands[0].x, 25.4)
+        self.assertRoughly(path.Commands[0].Parameters["F"], 50.8)
+        self.assertRoughly(path.Commands[1].x, 1.0)
+
+    def test20(self):
+        """Test that badly formatted G-code is rejected"""
+        path = Path.Path()
+        with self.assertRaises(Exception):
+            path.setFromGCode("G1 X")
+        with self.assertRaises(Exception):
+            path.setFromGCode("G X1")
+
+    def test30(self):
+        """Test that a large program is parsed in order"""
+        # large enough to be split among several threads, the units of all parts are inch
+        lines = 60000
+        path = Path.Path("G20\n" + surfacingProgram(lines)[len("(surfacing)\nG21\n") :])
+        self.assertEqual(path.Size, lines + 2)
+        self.assertEqual(path.Commands[-1].Name, "G0")
+        for i in (0, 1, lines // 2, lines - 1):
+            cmd = path.Commands[i + 1]
+            self.assertEqual(cmd.Name, "G1")
+            self.assertRoughly(cmd.y, i * 0.1 * 25.4)
+            self.assertRoughly(cmd.Parameters["F"], 800.0 * 25.4)
+
+        path2 = Path.Path(path.toGCode())
+        self.assertEqual(path2.Size, path.Size)
+        self.assertEqual(path2.toGCode(), path.toGCode())
@@ -99,6 +99,19 @@ class TestPathVoronoi(PathTestUtils.PathTestBase):
         self.assertNotEqual(vd.Cells[0], vd.Cells[1])
         self.assertNotEqual(vd.Cells[1], vd.Cells[0])
 
+    def test30(self):
+        """Check wires of primary edges"""
+
+        wires = vd.getWires(0)
+        self.assertNotEqual(len(wires), 0)
+        edges = [e.Index for w in wires for e in w]
+        self.assertEqual(len(edges), len(set(edges)))
+        for w in wires:
+            for e in w:
+                self.assertTrue(e.isFinite())
+            for e0, e1 in zip(w, w[1:]):
+                self.assertEqual(e0.Vertices[1], e1.Vertices[0])
+
     def test50(self):
         """Check toShape for linear edges"""
 
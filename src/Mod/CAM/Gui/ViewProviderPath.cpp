@@ -529,167 +529,6 @@ void ViewProviderPath::hideSelection()
     pcArrowSwitch->whichChild = -1;
 }
 
-class VisualPathSegmentVisitor: public PathSegmentVisitor
-{
-public:
-    VisualPathSegmentVisitor(const Toolpath& tp,
-                             SoCoordinate3* pcLineCoords_,
-                             SoCoordinate3* pcMarkerCoords_,
-                             std::vector<int>& command2Edge_,
-                             std::deque<int>& edge2Command_,
-                             std::deque<int>& edgeIndices_,
-                             std::vector<int>& colorindex_,
-                             std::deque<Base::Vector3d>& points_,
-                             std::deque<Base::Vector3d>& markers_)
-        : pcLineCoords(pcLineCoords_)
-        , pcMarkerCoords(pcMarkerCoords_)
-        , command2Edge(command2Edge_)
-        , edge2Command(edge2Command_)
-        , edgeIndices(edgeIndices_)
-        , colorindex(colorindex_)
-        , points(points_)
-        , markers(markers_)
-    {
-        pcLineCoords->point.deleteValues(0);
-        pcMarkerCoords->point.deleteValues(0);
-
-        command2Edge.clear();
-        edge2Command.clear();
-        edgeIndices.clear();
-
-        colorindex.clear();
-
-        command2Edge.resize(tp.getSize(), -1);
-    }
-
-    void setup(const Base::Vector3d& last) override
-    {
-        points.push_back(last);
-        markers.push_back(last);
-    }
-
-    void g0(int id,
-            const Base::Vector3d& last,
-            const Base::Vector3d& next,
-            const std::deque<Base::Vector3d>& pts) override
-    {
-        (void)last;
-        gx(id, &next, pts, 0);
-    }
-
-    void g1(int id,
-            const Base::Vector3d& last,
-            const Base::Vector3d& next,
-            const std::deque<Base::Vector3d>& pts) override
-    {
-        (void)last;
-        gx(id, &next, pts, 1);
-    }
-
-    void g23(int id,
-             const Base::Vector3d& last,
-             const Base::Vector3d& next,
-             const std::deque<Base::Vector3d>& pts,
-             const Base::Vector3d& center) override
-    {
-        (void)last;
-        gx(id, &next, pts, 1);
-        markers.push_back(center);
-    }
-
-    void g8x(int id,
-             const Base::Vector3d& last,
-             const Base::Vector3d& next,
-             const std::deque<Base::Vector3d>& pts,
-             const std::deque<Base::Vector3d>& p,
-             const std::deque<Base::Vector3d>& q) override
-    {
-        (void)last;
-
-        gx(id, nullptr, pts, 0);
-
-        points.push_back(p[0]);
-        markers.push_back(p[0]);
-        colorindex.push_back(0);
-
-        points.push_back(p[1]);
-        markers.push_back(p[1]);
-        colorindex.push_back(0);
-
-        points.push_back(next);
-        markers.push_back(next);
-        colorindex.push_back(1);
-
-        for (std::deque<Base::Vector3d>::const_iterator it = q.begin(); q.end() != it; ++it) {
-            markers.push_back(*it);
-        }
-
-        points.push_back(p[2]);
-        markers.push_back(p[2]);
-        colorindex.push_back(0);
-
-        pushCommand(id);
-    }
-
-    void g38(int id, const Base::Vector3d& last, const Base::Vector3d& next) override
-    {
-#if 0
-      Base::Vector3d p1(next.x,next.y,last.z);
-      points.push_back(p1);
-      colorindex.push_back(0);
-
-      points.push_back(next);
-      colorindex.push_back(2);
-
-      Base::Vector3d p3(next.x,next.y,last.z);
-      points.push_back(p3);
-      colorindex.push_back(0);
-
-      pushCommand(id);
-#else
-        (void)last;
-        const std::deque<Base::Vector3d> pts {};
-        gx(id, &next, pts, 2);
-#endif
-    }
-
-private:
-    SoCoordinate3* pcLineCoords;
-    SoCoordinate3* pcMarkerCoords;
-
-    std::vector<int>& command2Edge;
-    std::deque<int>& edge2Command;
-    std::deque<int>& edgeIndices;
-
-    std::vector<int>& colorindex;
-    std::deque<Base::Vector3d>& points;
-    std::deque<Base::Vector3d>& markers;
-
-    virtual void
-    gx(int id, const Base::Vector3d* next, const std::deque<Base::Vector3d>& pts, int color)
-    {
-        for (std::deque<Base::Vector3d>::const_iterator it = pts.begin(); pts.end() != it; ++it) {
-            points.push_back(*it);
-            colorindex.push_back(color);
-        }
-
-        if (next) {
-            points.push_back(*next);
-            markers.push_back(*next);
-            colorindex.push_back(color);
-
-            pushCommand(id);
-        }
-    }
-
-    void pushCommand(int id)
-    {
-        command2Edge[id] = edgeIndices.size();
-        edgeIndices.push_back(points.size());
-        edge2Command.push_back(id);
-    }
-};
-
 void ViewProviderPath::updateVisual(bool rebuild)
 {
 
@@ -703,36 +542,97 @@ void ViewProviderPath::updateVisual(bool rebuild)
         Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
         const Toolpath& tp = pcPathObj->Path.getValue();
 
-        std::deque<Base::Vector3d> points;
-        std::deque<Base::Vector3d> markers;
+        PathSegmentWalker walker(tp);
+        PathSegments segments = walker.collect(StartPosition.getValue());
+
+        // Every move is an edge that ends with its end point. The start position is the first
+        // point and marker, it has no color.
+        std::size_t numPoints = 1;
+        std::size_t numMarkers = 1;
+        for (const auto& move : segments.moves) {
+            numPoints += move.end - move.begin + 1;
+            numMarkers += 1;
+            if (move.type == PathSegments::Drill) {
+                numPoints += 3;
+                numMarkers += move.cycleEnd - move.end;
+            }
+            else if (move.type == PathSegments::Arc) {
+                numMarkers += 1;
+            }
+        }
 
-        VisualPathSegmentVisitor collect(tp,
-                                         pcLineCoords,
-                                         pcMarkerCoords,
-                                         command2Edge,
-                                         edge2Command,
-                                         edgeIndices,
-                                         colorindex,
-                                         points,
-                                         markers);
+        pcLineCoords->point.deleteValues(0);
+        pcMarkerCoords->point.deleteValues(0);
 
-        PathSegmentWalker segments(tp);
-        segments.walk(collect, StartPosition.getValue());
+        command2Edge.assign(tp.getSize(), -1);
+        edge2Command.clear();
+        edgeIndices.clear();
+        colorindex.clear();
 
+        if (!segments.moves.empty()) {
+            edge2Command.reserve(segments.moves.size());
+            edgeIndices.reserve(segments.moves.size());
+            colorindex.reserve(numPoints - 1);
 
-        if (!edgeIndices.empty()) {
-            pcLineCoords->point.setNum(points.size());
+            pcLineCoords->point.setNum(numPoints);
+            pcMarkerCoords->point.setNum(numMarkers);
             SbVec3f* verts = pcLineCoords->point.startEditing();
-            int i = 0;
-            for (const auto& pt : points) {
-                verts[i++].setValue(pt.x, pt.y, pt.z);
-            }
-            pcLineCoords->point.finishEditing();
+            SbVec3f* marks = pcMarkerCoords->point.startEditing();
+            int numVerts = 0;
+            auto addPoint = [&](const Base::Vector3d& pt, int color) {
+                verts[numVerts++].setValue(pt.x, pt.y, pt.z);
+                colorindex.push_back(color);
+            };
+            auto addMarker = [&marks](const Base::Vector3d& pt) {
+                (marks++)->setValue(pt.x, pt.y, pt.z);
+            };
+
+            verts[numVerts++].setValue(segments.start.x, segments.start.y, segments.start.z);
+            addMarker(segments.start);
+
+            const Base::Vector3d* points = segments.points.data();
+            for (const auto& move : segments.moves) {
+                // 0 is a rapid move, 1 a feed and 2 a probe
+                int color = 1;
+                if (move.type == PathSegments::Rapid || move.type == PathSegments::Drill) {
+                    color = 0;
+                }
+                else if (move.type == PathSegments::Probe) {
+                    color = 2;
+                }
+                for (std::size_t i = move.begin; i < move.end; ++i) {
+                    addPoint(points[i], color);
+                }
 
-            pcMarkerCoords->point.setNum(markers.size());
-            for (unsigned int i = 0; i < markers.size(); i++) {
-                pcMarkerCoords->point.set1Value(i, markers[i].x, markers[i].y, markers[i].z);
+                if (move.type == PathSegments::Drill) {
+                    const Base::Vector3d* cycle = points + move.end;
+                    addPoint(cycle[0], 0);
+                    addMarker(cycle[0]);
+                    addPoint(cycle[1], 0);
+                    addMarker(cycle[1]);
+                    addPoint(move.next, 1);
+                    addMarker(move.next);
+                    for (std::size_t i = move.end + 3; i < move.cycleEnd; ++i) {
+                        addMarker(points[i]);
+                    }
+                    addPoint(cycle[2], 0);
+                    addMarker(cycle[2]);
+                }
+                else {
+                    addPoint(move.next, color);
+                    addMarker(move.next);
+                }
+
+                command2Edge[move.id] = edgeIndices.size();
+                edgeIndices.push_back(numVerts);
+                edge2Command.push_back(move.id);
+
+                if (move.type == PathSegments::Arc) {
+                    addMarker(move.center);
+                }
             }
+            pcLineCoords->point.finishEditing();
+            pcMarkerCoords->point.finishEditing();
 
             recomputeBoundingBox();
         }
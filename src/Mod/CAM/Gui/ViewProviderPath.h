@@ -105,8 +105,8 @@ protected:
     SoTransform* pcArrowTransform;
 
     std::vector<int> command2Edge;
-    std::deque<int> edge2Command;
-    std::deque<int> edgeIndices;
+    std::vector<int> edge2Command;
+    std::vector<int> edgeIndices;
 
     mutable int pt0Index;
     bool blockPropertyChange;
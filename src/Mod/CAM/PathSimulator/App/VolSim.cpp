@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 #endif
 
 #include <BRepBndLib.hxx>
@@ -48,15 +51,8 @@ cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float
 {
     m_x = (int)(m_lx / res) + 1;
     m_y = (int)(m_ly / res) + 1;
-    m_stock.Init(m_x, m_y);
-    m_attr.Init(m_x, m_y);
     m_plane = pz + lz;
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
-            m_stock[x][y] = m_plane;
-            m_attr[x][y] = 0;
-        }
-    }
+    m_stock.Init(m_x, m_y, m_plane);
 }
 
 cStock::~cStock()
@@ -65,7 +61,7 @@ cStock::~cStock()
 
 float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
 {
-    float z = m_stock[xp][yp];
+    float z = m_stock.Get(xp, yp);
     bool xr_ok = true;
     bool xl_ok = scanHoriz;
     bool yu_ok = true;
@@ -81,7 +77,8 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
             }
             else {
                 for (int y = yp; y < yp + y_size; y++) {
-                    if ((m_attr[tx][y] & SIM_TESSEL_TOP) != 0 || fabs(z - m_stock[tx][y]) > m_res) {
+                    if ((m_attr[tx][y] & SIM_TESSEL_TOP) != 0
+                        || fabs(z - m_stock.Get(tx, y)) > m_res) {
                         xr_ok = false;
                         break;
                     }
@@ -100,7 +97,8 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
             }
             else {
                 for (int y = yp; y < yp + y_size; y++) {
-                    if ((m_attr[tx][y] & SIM_TESSEL_TOP) != 0 || fabs(z - m_stock[tx][y]) > m_res) {
+                    if ((m_attr[tx][y] & SIM_TESSEL_TOP) != 0
+                        || fabs(z - m_stock.Get(tx, y)) > m_res) {
                         xl_ok = false;
                         break;
                     }
@@ -120,7 +118,8 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
             }
             else {
                 for (int x = xp; x < xp + x_size; x++) {
-                    if ((m_attr[x][ty] & SIM_TESSEL_TOP) != 0 || fabs(z - m_stock[x][ty]) > m_res) {
+                    if ((m_attr[x][ty] & SIM_TESSEL_TOP) != 0
+                        || fabs(z - m_stock.Get(x, ty)) > m_res) {
                         yu_ok = false;
                         break;
                     }
@@ -139,7 +138,8 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
             }
             else {
                 for (int x = xp; x < xp + x_size; x++) {
-                    if ((m_attr[x][ty] & SIM_TESSEL_TOP) != 0 || fabs(z - m_stock[x][ty]) > m_res) {
+                    if ((m_attr[x][ty] & SIM_TESSEL_TOP) != 0
+                        || fabs(z - m_stock.Get(x, ty)) > m_res) {
                         yd_ok = false;
                         break;
                     }
@@ -217,7 +217,8 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
             }
             else {
                 for (int y = yp; y < yp + y_size; y++) {
-                    if ((m_attr[tx][y] & SIM_TESSEL_BOT) != 0 || (m_stock[tx][y] - m_pz) < m_res) {
+                    if ((m_attr[tx][y] & SIM_TESSEL_BOT) != 0
+                        || (m_stock.Get(tx, y) - m_pz) < m_res) {
                         xr_ok = false;
                         break;
                     }
@@ -236,7 +237,8 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
             }
             else {
                 for (int y = yp; y < yp + y_size; y++) {
-                    if ((m_attr[tx][y] & SIM_TESSEL_BOT) != 0 || (m_stock[tx][y] - m_pz) < m_res) {
+                    if ((m_attr[tx][y] & SIM_TESSEL_BOT) != 0
+                        || (m_stock.Get(tx, y) - m_pz) < m_res) {
                         xl_ok = false;
                         break;
                     }
@@ -256,7 +258,8 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
             }
             else {
                 for (int x = xp; x < xp + x_size; x++) {
-                    if ((m_attr[x][ty] & SIM_TESSEL_BOT) != 0 || (m_stock[x][ty] - m_pz) < m_res) {
+                    if ((m_attr[x][ty] & SIM_TESSEL_BOT) != 0
+                        || (m_stock.Get(x, ty) - m_pz) < m_res) {
                         yu_ok = false;
                         break;
                     }
@@ -275,7 +278,8 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
             }
             else {
                 for (int x = xp; x < xp + x_size; x++) {
-                    if ((m_attr[x][ty] & SIM_TESSEL_BOT) != 0 || (m_stock[x][ty] - m_pz) < m_res) {
+                    if ((m_attr[x][ty] & SIM_TESSEL_BOT) != 0
+                        || (m_stock.Get(x, ty) - m_pz) < m_res) {
                         yd_ok = false;
                         break;
                     }
@@ -329,20 +333,22 @@ int cStock::TesselBot(int xp, int yp)
 }
 
 
-int cStock::TesselSidesX(int yp)
+void cStock::TesselSidesX(int yp,
+                          std::vector<MeshCore::MeshGeomFacet>& outer,
+                          std::vector<MeshCore::MeshGeomFacet>& inner) const
 {
     float lastz1 = m_pz;
     if (yp < m_y) {
-        lastz1 = std::max(m_stock[0][yp], m_pz);
+        lastz1 = std::max(m_stock.Get(0, yp), m_pz);
     }
     float lastz2 = m_pz;
     if (yp > 0) {
-        lastz2 = std::max(m_stock[0][yp - 1], m_pz);
+        lastz2 = std::max(m_stock.Get(0, yp - 1), m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &inner;
     if (yp == 0 || yp == m_y) {
-        facets = &facetsOuter;
+        facets = &outer;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
@@ -350,11 +356,11 @@ int cStock::TesselSidesX(int yp)
     for (int x = 1; x <= m_x; x++) {
         float newz1 = m_pz;
         if (yp < m_y && x < m_x) {
-            newz1 = std::max(m_stock[x][yp], m_pz);
+            newz1 = std::max(m_stock.Get(x, yp), m_pz);
         }
         float newz2 = m_pz;
         if (yp > 0 && x < m_x) {
-            newz2 = std::max(m_stock[x][yp - 1], m_pz);
+            newz2 = std::max(m_stock.Get(x, yp - 1), m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
@@ -371,23 +377,24 @@ int cStock::TesselSidesX(int yp)
         lastz2 = newz2;
         lastpoint = x;
     }
-    return 0;
 }
 
-int cStock::TesselSidesY(int xp)
+void cStock::TesselSidesY(int xp,
+                          std::vector<MeshCore::MeshGeomFacet>& outer,
+                          std::vector<MeshCore::MeshGeomFacet>& inner) const
 {
     float lastz1 = m_pz;
     if (xp < m_x) {
-        lastz1 = std::max(m_stock[xp][0], m_pz);
+        lastz1 = std::max(m_stock.Get(xp, 0), m_pz);
     }
     float lastz2 = m_pz;
     if (xp > 0) {
-        lastz2 = std::max(m_stock[xp - 1][0], m_pz);
+        lastz2 = std::max(m_stock.Get(xp - 1, 0), m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &inner;
     if (xp == 0 || xp == m_x) {
-        facets = &facetsOuter;
+        facets = &outer;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
@@ -395,11 +402,11 @@ int cStock::TesselSidesY(int xp)
     for (int y = 1; y <= m_y; y++) {
         float newz1 = m_pz;
         if (xp < m_x && y < m_y) {
-            newz1 = std::max(m_stock[xp][y], m_pz);
+            newz1 = std::max(m_stock.Get(xp, y), m_pz);
         }
         float newz2 = m_pz;
         if (xp > 0 && y < m_y) {
-            newz2 = std::max(m_stock[xp - 1][y], m_pz);
+            newz2 = std::max(m_stock.Get(xp - 1, y), m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
@@ -416,10 +423,12 @@ int cStock::TesselSidesY(int xp)
         lastz2 = newz2;
         lastpoint = y;
     }
-    return 0;
 }
 
-void cStock::SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3)
+void cStock::SetFacetPoints(MeshCore::MeshGeomFacet& facet,
+                            Point3D& p1,
+                            Point3D& p2,
+                            Point3D& p3) const
 {
     facet._aclPoints[0][0] = p1.x * m_res + m_px;
     facet._aclPoints[0][1] = p1.y * m_res + m_py;
@@ -437,7 +446,7 @@ void cStock::AddQuad(Point3D& p1,
                      Point3D& p2,
                      Point3D& p3,
                      Point3D& p4,
-                     std::vector<MeshCore::MeshGeomFacet>& facets)
+                     std::vector<MeshCore::MeshGeomFacet>& facets) const
 {
     MeshCore::MeshGeomFacet facet;
     SetFacetPoints(facet, p1, p2, p3);
@@ -446,9 +455,66 @@ void cStock::AddQuad(Point3D& p1,
     facets.push_back(facet);
 }
 
+void cStock::TesselSides()
+{
+    // the walls along every grid line are independent of each other
+    const int numLinesX = m_y + 1;
+    const int numLines = numLinesX + m_x + 1;
+    const int numChunks = std::min(numLines, 64);
+    struct Chunk
+    {
+        std::vector<MeshCore::MeshGeomFacet> outer;
+        std::vector<MeshCore::MeshGeomFacet> inner;
+    };
+    std::vector<Chunk> chunks(numChunks);
+    std::atomic<int> next {0};
+    auto worker = [&]() {
+        for (int i = next++; i < numChunks; i = next++) {
+            Chunk& chunk = chunks[i];
+            int end = (int)((long long)numLines * (i + 1) / numChunks);
+            for (int line = (int)((long long)numLines * i / numChunks); line < end; line++) {
+                if (line < numLinesX) {
+                    TesselSidesX(line, chunk.outer, chunk.inner);
+                }
+                else {
+                    TesselSidesY(line - numLinesX, chunk.outer, chunk.inner);
+                }
+            }
+        }
+    };
+
+    int numThreads = std::min((int)std::max(1U, std::thread::hardware_concurrency()), numChunks);
+    std::vector<std::future<void>> futures;
+    for (int i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    // keep the order of the serial version
+    for (const Chunk& chunk : chunks) {
+        facetsOuter.insert(facetsOuter.end(), chunk.outer.begin(), chunk.outer.end());
+        facetsInner.insert(facetsInner.end(), chunk.inner.begin(), chunk.inner.end());
+    }
+}
+
 void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
 {
-    // reset attribs
+    // the facets are only regenerated if the stock was cut since the last call
+    if (!m_tessellated || m_stock.IsDirty()) {
+        m_stock.Compact();
+        GenerateFacets();
+        m_tessellated = true;
+    }
+    meshOuter.addFacets(facetsOuter);
+    meshInner.addFacets(facetsInner);
+}
+
+void cStock::GenerateFacets()
+{
+    m_attr.Init(m_x, m_y);
     for (int y = 0; y < m_y; y++) {
         for (int x = 0; x < m_x; x++) {
             m_attr[x][y] = 0;
@@ -468,7 +534,7 @@ void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner
     }
     for (int y = 0; y < m_y; y++) {
         for (int x = 0; x < m_x; x++) {
-            if ((m_stock[x][y] - m_pz) < m_res) {
+            if ((m_stock.Get(x, y) - m_pz) < m_res) {
                 m_attr[x][y] |= SIM_TESSEL_BOT;
             }
             if ((m_attr[x][y] & SIM_TESSEL_BOT) == 0) {
@@ -476,16 +542,8 @@ void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner
             }
         }
     }
-    for (int y = 0; y <= m_y; y++) {
-        TesselSidesX(y);
-    }
-    for (int x = 0; x <= m_x; x++) {
-        TesselSidesY(x);
-    }
-    meshOuter.addFacets(facetsOuter);
-    meshInner.addFacets(facetsInner);
-    facetsOuter.clear();
-    facetsInner.clear();
+    TesselSides();
+    m_attr.Free();
 }
 
 
@@ -496,15 +554,13 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     int rad = (int)(radf / m_res);
     int drad = rad * rad;
     int ys = std::max(0, cy - rad);
-    int ye = std::min(m_x, cy + rad);
+    int ye = std::min(m_y, cy + rad);
     int xs = std::max(0, cx - rad);
     int xe = std::min(m_x, cx + rad);
     for (int y = ys; y < ye; y++) {
         for (int x = xs; x < xe; x++) {
             if (((x - cx) * (x - cx) + (y - cy) * (y - cy)) < drad) {
-                if (m_stock[x][y] > height) {
-                    m_stock[x][y] = height;
-                }
+                m_stock.SetMin(x, y, height);
             }
         }
     }
@@ -542,9 +598,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
                 int x = (int)p.x;
                 int y = (int)p.y;
                 if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
-                    }
+                    m_stock.SetMin(x, y, z);
                 }
                 p.Add(mainWay);
                 z += zstep;
@@ -567,9 +621,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
             if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+                m_stock.SetMin(x, y, z);
             }
             cupCirc.Rotate();
         }
@@ -626,9 +678,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
             int x = (int)(cpx + cupCirc.x);
             int y = (int)(cpy + cupCirc.y);
             if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+                m_stock.SetMin(x, y, z);
             }
             z += zstep;
             cupCirc.Rotate();
@@ -652,9 +702,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
             if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+                m_stock.SetMin(x, y, z);
             }
             cupCirc.Rotate();
         }
@@ -25,6 +25,8 @@
 #ifndef PATHSIMULATOR_VolSim_H
 #define PATHSIMULATOR_VolSim_H
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 #include <Mod/Mesh/App/Mesh.h>
@@ -204,10 +206,18 @@ public:
 
     void Init(int x, int y)
     {
+        Free();
         data = new T[x * y];
         height = y;
     }
 
+    void Free()
+    {
+        delete[] data;
+        data = nullptr;
+        height = 0;
+    }
+
     T* operator[](int i)
     {
         return data + i * height;
@@ -218,6 +228,108 @@ private:
     int height;
 };
 
+/* A height map split into square tiles. A tile that holds the same value in all
+   cells only stores this value, the cells are allocated as soon as one of them
+   is lowered. Untouched stock therefore costs next to no memory. Tiles are marked
+   dirty when lowered. */
+template<class T>
+class TiledArray2D
+{
+public:
+    static constexpr int TileShift = 6;
+    static constexpr int TileSize = 1 << TileShift;
+    static constexpr int TileMask = TileSize - 1;
+
+    void Init(int x, int y, T value)
+    {
+        tilesX = (x + TileMask) >> TileShift;
+        tilesY = (y + TileMask) >> TileShift;
+        tiles.clear();
+        tiles.resize(tilesX * tilesY);
+        for (auto& tile : tiles) {
+            tile.fill = value;
+        }
+    }
+
+    T Get(int x, int y) const
+    {
+        const Tile& tile = tiles[TileIndex(x, y)];
+        return tile.data ? tile.data[CellIndex(x, y)] : tile.fill;
+    }
+
+    // lowers the cell to value if it is higher
+    void SetMin(int x, int y, T value)
+    {
+        Tile& tile = tiles[TileIndex(x, y)];
+        if (!tile.data) {
+            if (!(value < tile.fill)) {
+                return;
+            }
+            tile.data = std::make_unique<T[]>(TileSize * TileSize);
+            std::fill_n(tile.data.get(), TileSize * TileSize, tile.fill);
+        }
+        T& cell = tile.data[CellIndex(x, y)];
+        if (value < cell) {
+            cell = value;
+            tile.dirty = true;
+        }
+    }
+
+    bool IsDirty() const
+    {
+        return std::any_of(tiles.begin(), tiles.end(), [](const Tile& tile) {
+            return tile.dirty;
+        });
+    }
+
+    // releases the cells of dirty tiles that became uniform and resets the dirty flags
+    void Compact()
+    {
+        for (auto& tile : tiles) {
+            if (!tile.dirty) {
+                continue;
+            }
+            tile.dirty = false;
+            T* first = tile.data.get();
+            T* last = first + TileSize * TileSize;
+            if (std::all_of(first, last, [first](T value) {
+                    return value == *first;
+                })) {
+                tile.fill = *first;
+                tile.data.reset();
+            }
+        }
+    }
+
+    size_t CountAllocatedTiles() const
+    {
+        return std::count_if(tiles.begin(), tiles.end(), [](const Tile& tile) {
+            return tile.data != nullptr;
+        });
+    }
+
+private:
+    struct Tile
+    {
+        std::unique_ptr<T[]> data;
+        T fill {};
+        bool dirty = false;
+    };
+
+    int TileIndex(int x, int y) const
+    {
+        return (y >> TileShift) * tilesX + (x >> TileShift);
+    }
+    static int CellIndex(int x, int y)
+    {
+        return ((y & TileMask) << TileShift) + (x & TileMask);
+    }
+
+    std::vector<Tile> tiles;
+    int tilesX = 0;
+    int tilesY = 0;
+};
+
 class cStock
 {
 public:
@@ -227,6 +339,11 @@ public:
     void CreatePocket(float x, float y, float rad, float height);
     void ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool);
     void ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW);
+    /// Number of tiles of the height map that store all their cells
+    size_t CountAllocatedTiles() const
+    {
+        return m_stock.CountAllocatedTiles();
+    }
     inline Point3D ToInner(Point3D& p)
     {
         return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
@@ -235,18 +352,27 @@ public:
 private:
     float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
-    void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
+    void SetFacetPoints(MeshCore::MeshGeomFacet& facet,
+                        Point3D& p1,
+                        Point3D& p2,
+                        Point3D& p3) const;
     void AddQuad(Point3D& p1,
                  Point3D& p2,
                  Point3D& p3,
                  Point3D& p4,
-                 std::vector<MeshCore::MeshGeomFacet>& facets);
+                 std::vector<MeshCore::MeshGeomFacet>& facets) const;
+    void GenerateFacets();
     int TesselTop(int x, int y);
     int TesselBot(int x, int y);
-    int TesselSidesX(int yp);
-    int TesselSidesY(int xp);
-    Array2D<float> m_stock;
-    Array2D<char> m_attr;
+    void TesselSides();
+    void TesselSidesX(int yp,
+                      std::vector<MeshCore::MeshGeomFacet>& outer,
+                      std::vector<MeshCore::MeshGeomFacet>& inner) const;
+    void TesselSidesY(int xp,
+                      std::vector<MeshCore::MeshGeomFacet>& outer,
+                      std::vector<MeshCore::MeshGeomFacet>& inner) const;
+    TiledArray2D<float> m_stock;
+    Array2D<char> m_attr;  // only allocated while tessellating
     float m_px, m_py, m_pz;  // stock zero position
     float m_lx, m_ly, m_lz;  // stock dimensions
     float m_res;             // resoulution
@@ -254,6 +380,7 @@ private:
     int m_x, m_y;            // stock array size
     std::vector<MeshCore::MeshGeomFacet> facetsOuter;
     std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    bool m_tessellated = false;  // facetsOuter and facetsInner hold the current mesh
 };
 
 class cVolSim
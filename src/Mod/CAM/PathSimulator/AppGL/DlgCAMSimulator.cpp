@@ -176,7 +176,7 @@ void DlgCAMSimulator::resizeEvent(QResizeEvent* event)
 void DlgCAMSimulator::GetMeshData(const Part::TopoShape& tshape,
                                   float resolution,
                                   std::vector<Vertex>& verts,
-                                  std::vector<GLushort>& indices)
+                                  std::vector<GLuint>& indices)
 {
     std::vector<int> normalCount;
     int nVerts = 0;
@@ -340,7 +340,7 @@ DlgCAMSimulator* DlgCAMSimulator::GetInstance()
 void DlgCAMSimulator::SetStockShape(const Part::TopoShape& shape, float resolution)
 {
     std::vector<Vertex> verts;
-    std::vector<GLushort> indices;
+    std::vector<GLuint> indices;
     GetMeshData(shape, resolution, verts, indices);
     mMillSimulator->SetArbitraryStock(verts, indices);
 }
@@ -348,7 +348,7 @@ void DlgCAMSimulator::SetStockShape(const Part::TopoShape& shape, float resoluti
 void DlgCAMSimulator::SetBaseShape(const Part::TopoShape& tshape, float resolution)
 {
     std::vector<Vertex> verts;
-    std::vector<GLushort> indices;
+    std::vector<GLuint> indices;
     GetMeshData(tshape, resolution, verts, indices);
     mMillSimulator->SetBaseObject(verts, indices);
 }
@@ -98,7 +98,7 @@ protected:
     void GetMeshData(const Part::TopoShape& tshape,
                      float resolution,
                      std::vector<MillSim::Vertex>& verts,
-                     std::vector<GLushort>& indices);
+                     std::vector<GLuint>& indices);
 
 private:
     bool mAnimating = false;
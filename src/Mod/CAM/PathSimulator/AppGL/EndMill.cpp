@@ -23,6 +23,7 @@
 #include "EndMill.h"
 #include "OpenGlWrapper.h"
 #include "SimShapes.h"
+#include <cmath>
 
 using namespace MillSim;
 
@@ -71,6 +72,7 @@ EndMill::~EndMill()
     toolShape.FreeResources();
     halfToolShape.FreeResources();
     pathShape.FreeResources();
+    ClearArcSegments();
 }
 
 void EndMill::GenerateDisplayLists(float quality)
@@ -109,6 +111,23 @@ EndMill::GenerateArcSegmentDL(float radius, float angleRad, float zShift, Shape*
     return 0;
 }
 
+Shape* EndMill::GetArcSegment(float radius, float angleRad, float zShift)
+{
+    ArcKey key(lroundf(radius * 1000.0f), lroundf(angleRad * 1e6f), lroundf(zShift * 1000.0f));
+    auto it = arcShapes.find(key);
+    if (it == arcShapes.end()) {
+        it = arcShapes.try_emplace(key).first;
+        GenerateArcSegmentDL(radius, angleRad, zShift, &it->second);
+    }
+    return &it->second;
+}
+
+void EndMill::ClearArcSegments()
+{
+    // the shapes free their resources when destroyed
+    arcShapes.clear();
+}
+
 void EndMill::MirrorPointBuffer()
 {
     int endpoint = PROFILE_BUFFER_POINTS(nPoints) - 1;
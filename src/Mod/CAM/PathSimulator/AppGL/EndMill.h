@@ -24,6 +24,8 @@
 #define __end_mill_h__
 
 #include "SimShapes.h"
+#include <map>
+#include <tuple>
 #include <vector>
 
 #define PROFILE_BUFFER_POINTS(npoints) ((npoints) * 2 - 1)
@@ -50,9 +52,16 @@ public:
     virtual ~EndMill();
     void GenerateDisplayLists(float quality);
     unsigned int GenerateArcSegmentDL(float radius, float angleRad, float zShift, Shape* retShape);
+    /// Returns the sweep of an arc step, arcs with the same dimensions share one shape
+    Shape* GetArcSegment(float radius, float angleRad, float zShift);
+    void ClearArcSegments();
 
 protected:
     void MirrorPointBuffer();
+
+    // radius, angle and height of the arc step in micrometers and microradians
+    using ArcKey = std::tuple<long, long, long>;
+    std::map<ArcKey, Shape> arcShapes;
 };
 }  // namespace MillSim
 
@@ -26,12 +26,16 @@
 #endif
 #endif
 
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <Mod/CAM/App/GCodeScanner.h>
+
 #include "GCodeParser.h"
 
 using namespace MillSim;
 
-static char TokTypes[] = "GTXYZIJKR";
-
 GCodeParser::~GCodeParser()
 {
     // Clear the vector
@@ -44,114 +48,35 @@ bool GCodeParser::Parse(const char* filename)
     lastState = {eNop, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
     lastTool = -1;
 
-    FILE* fl;
-    if ((fl = fopen(filename, "rt")) == nullptr) {
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    if (!file) {
         return false;
     }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-    char line[120];
-
-    while (!feof(fl)) {
-        if (fgets(line, 120, fl) != NULL) {
-            AddLine(line);
-        }
-    }
-    fclose(fl);
-    return false;
-}
-
-const char* GCodeParser::GetNextToken(const char* ptr, GCToken* token)
-{
-    float tokval;
-    token->letter = '*';
-    while (*ptr != 0) {
-        char letter = toupper(*ptr);
-        ptr++;
-
-        if (letter == ' ') {
-            continue;
-        }
-        if (letter == '(') {
-            break;
-        }
-
-        if (IsValidToken(letter)) {
-            ptr = ParseFloat(ptr, &tokval);
-            token->letter = letter;
-            token->fval = tokval;
-            token->ival = (int)(tokval + 0.5);
-            break;
-        }
-    }
-    return ptr;
-}
-
-bool GCodeParser::IsValidToken(char tok)
-{
-    int len = (int)strlen(TokTypes);
-    for (int i = 0; i < len; i++) {
-        if (tok == TokTypes[i]) {
-            return true;
-        }
+    std::string_view view(text);
+    while (!view.empty()) {
+        std::size_t end = view.find('\n');
+        AddLine(view.substr(0, end));
+        view.remove_prefix(end == std::string_view::npos ? view.size() : end + 1);
     }
     return false;
 }
 
-const char* GCodeParser::ParseFloat(const char* ptr, float* retFloat)
+bool GCodeParser::ParseLine(std::string_view line)
 {
-    float decPos = 10;
-    float sign = 1;
-    bool decimalPointFound = false;
-    float res = 0;
-    while (*ptr != 0) {
-        char letter = toupper(*ptr);
-        ptr++;
-
-        if (letter == ' ') {
-            continue;
-        }
-
-        if (letter == '-') {
-            sign = -1;
-        }
-        else if (letter == '.') {
-            decimalPointFound = true;
-        }
-        else if (letter >= '0' && letter <= '9') {
-            float digitVal = (float)(letter - '0');
-            if (decimalPointFound) {
-                res = res + digitVal / decPos;
-                decPos *= 10;
-            }
-            else {
-                res = res * 10 + digitVal;
-            }
-        }
-        else {
-            ptr--;
-            break;
-        }
-    }
-    *retFloat = res * sign;
-    return ptr;
-}
-
-bool GCodeParser::ParseLine(const char* ptr)
-{
-    GCToken token;
+    Path::GCodeScanner scanner(line);
+    Path::GCodeScanner::Token token;
     bool validMotion = false;
-    bool exitLoop = false;
     int cmd = 0;
-    while (*ptr != 0 && !exitLoop) {
-        ptr = GetNextToken(ptr, &token);
+    // the rest of the line after a comment is ignored
+    while (scanner.next(token) && token.type == Path::GCodeScanner::TokenType::Word) {
+        float fval = (float)token.value;
+        int ival = (int)(fval + 0.5);
         lastLastState = lastState;
         switch (token.letter) {
-            case '*':
-                exitLoop = true;
-                break;
-
             case 'G':
-                cmd = token.ival;
+                cmd = ival;
                 if (cmd == 0 || cmd == 1) {
                     lastState.cmd = eMoveLiner;
                 }
@@ -174,38 +99,38 @@ bool GCodeParser::ParseLine(const char* ptr)
                 break;
 
             case 'T':
-                lastState.tool = token.ival;
+                lastState.tool = ival;
                 break;
 
             case 'X':
-                lastState.x = token.fval;
+                lastState.x = fval;
                 validMotion = true;
                 break;
 
             case 'Y':
-                lastState.y = token.fval;
+                lastState.y = fval;
                 validMotion = true;
                 break;
 
             case 'Z':
-                lastState.z = token.fval;
+                lastState.z = fval;
                 validMotion = true;
                 break;
 
             case 'I':
-                lastState.i = token.fval;
+                lastState.i = fval;
                 break;
 
             case 'J':
-                lastState.j = token.fval;
+                lastState.j = fval;
                 break;
 
             case 'K':
-                lastState.k = token.fval;
+                lastState.k = fval;
                 break;
 
             case 'R':
-                lastState.r = token.fval;
+                lastState.r = fval;
                 break;
         }
     }
@@ -214,7 +139,12 @@ bool GCodeParser::ParseLine(const char* ptr)
 
 bool GCodeParser::AddLine(const char* ptr)
 {
-    bool res = ParseLine(ptr);
+    return AddLine(std::string_view(ptr));
+}
+
+bool GCodeParser::AddLine(std::string_view line)
+{
+    bool res = ParseLine(line);
     if (res) {
         if (lastState.cmd == eDril) {
             // split to several motions
@@ -23,17 +23,11 @@
 #ifndef __csgcodeparser_h__
 #define __csgcodeparser_h__
 #include "MillMotion.h"
+#include <string_view>
 #include <vector>
 
 namespace MillSim
 {
-struct GCToken
-{
-    char letter;
-    float fval;
-    int ival;
-};
-
 class GCodeParser
 {
 public:
@@ -42,6 +36,7 @@ public:
     virtual ~GCodeParser();
     bool Parse(const char* filename);
     bool AddLine(const char* ptr);
+    bool AddLine(std::string_view line);
 
 public:
     std::vector<MillMotion> Operations;
@@ -49,10 +44,7 @@ public:
     MillMotion lastLastState = {eNop, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 protected:
-    const char* GetNextToken(const char* ptr, GCToken* token);
-    bool IsValidToken(char tok);
-    const char* ParseFloat(const char* ptr, float* retFloat);
-    bool ParseLine(const char* ptr);
+    bool ParseLine(std::string_view line);
     int lastTool = -1;
 };
 }  // namespace MillSim
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "HeightMap.h"
+#include "OpenGlWrapper.h"
+#include "GlUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace MillSim
+{
+
+// the value of the empty texels, a cut or stock is always lower
+static const float NoHeights[4] = {1e30f, 1e30f, 1e30f, 0.0f};
+
+HeightMap::~HeightMap()
+{
+    FreeResources();
+}
+
+bool HeightMap::Init(SolidObject* stock, int resolution)
+{
+    FreeResources();
+    if (!stock->isValid || resolution < 2) {
+        return false;
+    }
+
+    // one texel of margin, so the walls of the stock are inside the map
+    float texelSize = std::max(stock->size[0], stock->size[1]) / resolution;
+    if (texelSize <= 0) {
+        return false;
+    }
+    mWidth = (int)std::ceil(stock->size[0] / texelSize) + 2;
+    mHeight = (int)std::ceil(stock->size[1] / texelSize) + 2;
+    float left = stock->position[0] - texelSize;
+    float bottom = stock->position[1] - texelSize;
+    // the depth range is large enough for any tool position
+    mat4x4_ortho(mapMat,
+                 left,
+                 left + mWidth * texelSize,
+                 bottom,
+                 bottom + mHeight * texelSize,
+                 -1e5f,
+                 1e5f);
+
+    glGenFramebuffers(1, &mFbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    glActiveTexture(GL_TEXTURE0);
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, mWidth, mHeight, 0, GL_RGBA, GL_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+    unsigned int attachments[1] = {GL_COLOR_ATTACHMENT0};
+    glDrawBuffers(1, attachments);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete || shaderStock.CompileShader("HeightStock", VertShaderGeom, FragShaderHeightStock)
+            == 0xdeadbeef
+        || shaderCut.CompileShader("HeightCut", VertShaderGeomInstanced, FragShaderHeightCut)
+            == 0xdeadbeef) {
+        FreeResources();
+        return false;
+    }
+
+    // the stock is rendered without culling to get both its bottom and its top
+    StartMapPass(shaderStock);
+    glClearBufferfv(GL_COLOR, 0, NoHeights);
+    stock->render();
+    EndMapPass();
+
+    CreateSurface(left, bottom, texelSize, stock->position[2]);
+    return true;
+}
+
+void HeightMap::CreateSurface(float left, float bottom, float texelSize, float zBottom)
+{
+    // a vertex at the center of every texel
+    std::vector<Vertex> verts;
+    verts.reserve((size_t)mWidth * mHeight);
+    for (int j = 0; j < mHeight; j++) {
+        float y = bottom + (j + 0.5f) * texelSize;
+        for (int i = 0; i < mWidth; i++) {
+            verts.emplace_back(left + (i + 0.5f) * texelSize, y, zBottom);
+        }
+    }
+
+    std::vector<GLuint> indices;
+    indices.reserve((size_t)(mWidth - 1) * (mHeight - 1) * 6);
+    for (int j = 0; j < mHeight - 1; j++) {
+        for (int i = 0; i < mWidth - 1; i++) {
+            GLuint v = j * mWidth + i;
+            indices.insert(indices.end(), {v, v + 1, v + mWidth + 1, v, v + mWidth + 1, v + mWidth});
+        }
+    }
+    mSurface.SetModelData(verts, indices);
+}
+
+void HeightMap::StartMapPass(Shader& shader)
+{
+    glGetIntegerv(GL_VIEWPORT, mViewport);
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    glViewport(0, 0, mWidth, mHeight);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_MIN);
+    shader.Activate();
+    shader.UpdateProjectionMat(mapMat);
+    shader.UpdateViewMat(identityMat);
+}
+
+void HeightMap::EndMapPass()
+{
+    glBlendEquation(GL_FUNC_ADD);
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+}
+
+void HeightMap::ClearCuts()
+{
+    if (!IsValid()) {
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    // only the cuts are kept in the red channel
+    glColorMask(GL_TRUE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glClearBufferfv(GL_COLOR, 0, NoHeights);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+void HeightMap::AddCuts(ShapeBatch& cuts)
+{
+    if (!IsValid() || cuts.IsEmpty()) {
+        return;
+    }
+    StartMapPass(shaderCut);
+    cuts.Render();
+    EndMapPass();
+}
+
+void HeightMap::RenderSurface()
+{
+    // the surface is seen from both sides inside the cuts
+    glDisable(GL_CULL_FACE);
+    mSurface.Render();
+    glEnable(GL_CULL_FACE);
+}
+
+void HeightMap::FreeResources()
+{
+    mSurface.FreeResources();
+    shaderStock.Destroy();
+    shaderCut.Destroy();
+    GLDELETE_FRAMEBUFFER(mFbo);
+    GLDELETE_TEXTURE(mTexture);
+    mWidth = 0;
+    mHeight = 0;
+}
+
+}  // namespace MillSim
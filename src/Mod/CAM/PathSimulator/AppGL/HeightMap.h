@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef __height_map_h__
+#define __height_map_h__
+
+#include "Shader.h"
+#include "ShapeBatch.h"
+#include "SimShapes.h"
+#include "SolidObject.h"
+#include "linmath.h"
+
+namespace MillSim
+{
+
+/** The stock as a map of heights over its footprint
+ *
+ * The map is a float texture that is rendered from the top with an orthographic projection and
+ * GL_MIN blending. Every texel holds the deepest cut, the bottom and the top of the stock in its
+ * column, so the stock must have a single run of material per column. The cuts are added once,
+ * when the simulation reaches them, hence the cost of a frame doesn't depend on the number of
+ * segments already simulated.
+ */
+class HeightMap
+{
+public:
+    HeightMap() = default;
+    ~HeightMap();
+    HeightMap(const HeightMap&) = delete;
+    HeightMap& operator=(const HeightMap&) = delete;
+
+    /// Sets up the map for \a stock with \a resolution texels along its longer side
+    bool Init(SolidObject* stock, int resolution);
+    /// Removes all cuts, the stock is kept
+    void ClearCuts();
+    /// Adds the bottom of the shapes in \a cuts to the map
+    void AddCuts(ShapeBatch& cuts);
+    /// Renders the remaining surface of the cut areas, needs the height map geometry pass with
+    /// the texture of this map
+    void RenderSurface();
+    void FreeResources();
+    bool IsValid() const
+    {
+        return mFbo != 0;
+    }
+    unsigned int GetTexture() const
+    {
+        return mTexture;
+    }
+
+public:
+    /// Maps world coordinates into the texture, x and y in -1 to 1
+    mat4x4 mapMat;
+
+protected:
+    void StartMapPass(Shader& shader);
+    void EndMapPass();
+    void CreateSurface(float left, float bottom, float texelSize, float zBottom);
+
+protected:
+    Shader shaderStock;
+    Shader shaderCut;
+    Shape mSurface;
+    unsigned int mFbo = 0;
+    unsigned int mTexture = 0;
+    int mWidth = 0;
+    int mHeight = 0;
+    int mViewport[4] = {};
+};
+
+}  // namespace MillSim
+#endif  // !__height_map_h__
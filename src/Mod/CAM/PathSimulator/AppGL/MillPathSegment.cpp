@@ -101,13 +101,13 @@ MillPathSegment::MillPathSegment(EndMill* _endmill, MillMotion* from, MillMotion
         mStepAngRad = mArcDir * mSweepAng / numSimSteps;
         if (mSmallRad) {
             // when the radius is too small, we just use the tool itself to carve the stock
-            mShape = endmill->toolShape;
+            mShape = &endmill->toolShape;
         }
         else {
-            endmill->GenerateArcSegmentDL(mRadius,
-                                          mStepAngRad * SWEEP_ARC_PAD,
-                                          mDiff[PZ] / numSimSteps,
-                                          &mShape);
+            // identical arcs share their geometry
+            mShape = endmill->GetArcSegment(mRadius,
+                                            mStepAngRad * SWEEP_ARC_PAD,
+                                            mDiff[PZ] / numSimSteps);
             numSimSteps++;
         }
 
@@ -135,10 +135,7 @@ MillPathSegment::MillPathSegment(EndMill* _endmill, MillMotion* from, MillMotion
     }
 }
 
-MillPathSegment::~MillPathSegment()
-{
-    mShape.FreeResources();
-}
+MillPathSegment::~MillPathSegment() = default;
 
 
 void MillPathSegment::AppendPathPoints(std::vector<MillPathPosition>& pointsBuffer)
@@ -170,7 +167,16 @@ void MillPathSegment::AppendPathPoints(std::vector<MillPathPosition>& pointsBuff
 void MillPathSegment::render(int step)
 {
     mStepNumber = step;
-    mat4x4 mat, mat2, rmat;
+    SegmentShape shapes[MaxStepShapes];
+    int numShapes = GetShapes(step, shapes);
+    for (int i = 0; i < numShapes; i++) {
+        shapes[i].shape->Render(shapes[i].modelMat, shapes[i].normalMat);
+    }
+}
+
+int MillPathSegment::GetShapes(int step, SegmentShape* shapes)
+{
+    mat4x4 mat, rmat;
     mat4x4_identity(mat);
     mat4x4_identity(rmat);
     if (mMotionType == MTCurved) {
@@ -183,11 +189,14 @@ void MillPathSegment::render(int step)
 
         if (mSmallRad || step == numSimSteps) {
             mat4x4_translate_in_place(mat, 0, mRadius, 0);
-            endmill->toolShape.Render(mat, rmat);
+            shapes[0].shape = &endmill->toolShape;
         }
         else {
-            mShape.Render(mat, rmat);
+            shapes[0].shape = mShape;
         }
+        mat4x4_dup(shapes[0].modelMat, mat);
+        mat4x4_dup(shapes[0].normalMat, rmat);
+        return 1;
     }
     else {
         if (mMotionType == MTVertical) {
@@ -198,24 +207,30 @@ void MillPathSegment::render(int step)
                 mat4x4_translate_in_place(mat,
                                           mStartPos[PX],
                                           mStartPos[PY],
-                                          mStartPos[PZ] + mStepNumber * mStepLength[PZ]);
+                                          mStartPos[PZ] + step * mStepLength[PZ]);
             }
-            endmill->toolShape.Render(mat, rmat);
+            shapes[0].shape = &endmill->toolShape;
+            mat4x4_dup(shapes[0].modelMat, mat);
+            mat4x4_dup(shapes[0].normalMat, rmat);
+            return 1;
         }
-        else {
-            float renderDist = step * mStepDistance;
-            mat4x4_translate_in_place_v(mat, mStartPos);
-            mat4x4_rotate_Z(mat, mat, mXYAngle);
-            mat4x4_rotate_Z(rmat, rmat, mXYAngle);
-            mat4x4_dup(mat2, mat);
-            if (mDiff[PZ] != 0.0) {
-                mat4x4_mul(mat2, mat2, mShearMat);
-            }
-            mat4x4_scale_aniso(mat2, mat2, renderDist, 1, 1);
-            endmill->pathShape.Render(mat2, rmat);
-            mat4x4_translate_in_place(mat, renderDist, 0, mDiff[PZ]);
-            endmill->halfToolShape.Render(mat, rmat);
+
+        float renderDist = step * mStepDistance;
+        mat4x4_translate_in_place_v(mat, mStartPos);
+        mat4x4_rotate_Z(mat, mat, mXYAngle);
+        mat4x4_rotate_Z(rmat, rmat, mXYAngle);
+        shapes[0].shape = &endmill->pathShape;
+        mat4x4_dup(shapes[0].modelMat, mat);
+        if (mDiff[PZ] != 0.0) {
+            mat4x4_mul(shapes[0].modelMat, shapes[0].modelMat, mShearMat);
         }
+        mat4x4_scale_aniso(shapes[0].modelMat, shapes[0].modelMat, renderDist, 1, 1);
+        mat4x4_dup(shapes[0].normalMat, rmat);
+        mat4x4_translate_in_place(mat, renderDist, 0, mDiff[PZ]);
+        shapes[1].shape = &endmill->halfToolShape;
+        mat4x4_dup(shapes[1].modelMat, mat);
+        mat4x4_dup(shapes[1].normalMat, rmat);
+        return 2;
     }
 }
 
@@ -41,6 +41,14 @@ enum MotionType
 
 bool IsVerticalMotion(MillMotion* m1, MillMotion* m2);
 
+/// A shape and its placement needed to render one step of a segment
+struct SegmentShape
+{
+    Shape* shape;
+    mat4x4 modelMat;
+    mat4x4 normalMat;
+};
+
 
 class MillPathSegment
 {
@@ -57,10 +65,14 @@ public:
 
     virtual void AppendPathPoints(std::vector<MillPathPosition>& pointsBuffer);
     virtual void render(int substep);
+    /// Fills \a shapes with the at most MaxStepShapes shapes of a step, returns their number
+    virtual int GetShapes(int step, SegmentShape* shapes);
     virtual void GetHeadPosition(vec3 headPos);
     static float SetQuality(float quality, float maxStockDimension);  // 1 minimum, 10 maximum
 
 public:
+    static constexpr int MaxStepShapes = 2;
+
     EndMill* endmill = nullptr;
     bool isMultyPart;
     int numSimSteps;
@@ -70,7 +82,7 @@ public:
 
 protected:
     mat4x4 mShearMat;
-    Shape mShape;
+    Shape* mShape = nullptr;  // owned by the end mill
     float mXYDistance;
     float mXYZDistance;
     float mZDistance;
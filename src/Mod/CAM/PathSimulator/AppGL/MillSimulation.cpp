@@ -22,6 +22,7 @@
 
 #include "MillSimulation.h"
 #include "OpenGlWrapper.h"
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
@@ -47,15 +48,101 @@ void MillSimulation::ClearMillPathSegments()
         delete MillPathSegments[i];
     }
     MillPathSegments.clear();
+    mCutBatch.FreeResources();
+    mLiveCutBatch.FreeResources();
+    mBatchedSegments = 0;
+    mHeightMap.FreeResources();
+    mNewCutBatch.FreeResources();
+    mMapSegment = 0;
+    mMapSubStep = 0;
+    for (EndMill* tool : mToolTable) {
+        tool->ClearArcSegments();
+    }
+}
+
+void MillSimulation::AddSegmentCuts(ShapeBatch& batch,
+                                    MillPathSegment* segment,
+                                    int firstStep,
+                                    int lastStep)
+{
+    SegmentShape shapes[MillPathSegment::MaxStepShapes];
+    for (int step = firstStep; step <= lastStep; step++) {
+        int numShapes = segment->GetShapes(step, shapes);
+        for (int i = 0; i < numShapes; i++) {
+            batch.Add(shapes[i].shape, shapes[i].modelMat);
+        }
+    }
+}
+
+void MillSimulation::UpdateCutBatches()
+{
+    if (mBatchedSegments > mPathStep) {
+        // the simulation was rewound
+        mCutBatch.Clear();
+        mBatchedSegments = 0;
+    }
+    for (; mBatchedSegments < mPathStep; mBatchedSegments++) {
+        MillPathSegment* p = MillPathSegments.at(mBatchedSegments);
+        AddSegmentCuts(mCutBatch, p, p->isMultyPart ? 1 : p->numSimSteps, p->numSimSteps);
+    }
+
+    mLiveCutBatch.Clear();
+    if (mPathStep >= 0) {
+        MillPathSegment* p = MillPathSegments.at(mPathStep);
+        AddSegmentCuts(mLiveCutBatch, p, p->isMultyPart ? 1 : mSubStep, mSubStep);
+    }
+}
+
+bool MillSimulation::UpdateHeightMap()
+{
+    if (!mUseHeightMap) {
+        return false;
+    }
+    if (!mHeightMap.IsValid()) {
+        mUseHeightMap = mHeightMap.Init(&mStockObject, mHeightMapResolution);
+        if (!mUseHeightMap) {
+            return false;
+        }
+        mMapSegment = 0;
+        mMapSubStep = 0;
+    }
+
+    bool isRewound =
+        mPathStep < mMapSegment || (mPathStep == mMapSegment && mSubStep < mMapSubStep);
+    if (isRewound && (mMapSegment > 0 || mMapSubStep > 0)) {
+        mHeightMap.ClearCuts();
+        mMapSegment = 0;
+        mMapSubStep = 0;
+    }
+
+    // only the steps since the last update are added to the map
+    for (; mMapSegment <= mPathStep; mMapSegment++) {
+        MillPathSegment* p = MillPathSegments.at(mMapSegment);
+        int lastStep = mMapSegment == mPathStep ? mSubStep : p->numSimSteps;
+        if (lastStep > mMapSubStep) {
+            // the last step of a single part segment covers the whole segment so far
+            int firstStep = p->isMultyPart ? mMapSubStep + 1 : lastStep;
+            AddSegmentCuts(mNewCutBatch, p, firstStep, lastStep);
+        }
+        mMapSubStep = lastStep;
+        if (mMapSegment == mPathStep) {
+            break;
+        }
+        mMapSubStep = 0;
+    }
+    mHeightMap.AddCuts(mNewCutBatch);
+    mNewCutBatch.Clear();
+    return true;
 }
 
 void MillSimulation::Clear()
 {
     mCodeParser.Operations.clear();
+    // the segments use the arc shapes of the tools
+    ClearMillPathSegments();
     for (unsigned int i = 0; i < mToolTable.size(); i++) {
         delete mToolTable[i];
     }
-    ClearMillPathSegments();
     mStockObject.~StockObject();
     mToolTable.clear();
     guiDisplay.ResetGui();
@@ -101,6 +188,9 @@ void MillSimulation::InitSimulation(float quality)
     mSimPlaying = false;
     mSimSpeed = 1;
     MillPathSegment::SetQuality(quality, simDisplay.maxFar);
+    // the surface of the height map has a vertex per texel
+    mHeightMapResolution = std::clamp((int)(quality * 128), 256, 1024);
+    mUseHeightMap = true;
     int nOperations = (int)mCodeParser.Operations.size();
     int segId = 0;
     for (int i = 0; i < nOperations; i++) {
@@ -273,6 +363,11 @@ void MillSimulation::RenderSimulation()
         return;
     }
 
+    if (UpdateHeightMap()) {
+        RenderHeightMapSimulation();
+        return;
+    }
+
     simDisplay.StartDepthPass();
 
     GlsimStart();
@@ -305,20 +400,26 @@ void MillSimulation::RenderSimulation()
     mStockObject.render();
 
     // render cuts (back faces of tools)
-    simDisplay.StartGeometryPass(cutColor, true);
+    // all cuts with the same shape go into a single instanced draw call
+    UpdateCutBatches();
+    simDisplay.StartInstancedGeometryPass(cutColor, true);
     GlsimRenderTools();
-    for (int i = 0; i <= mPathStep; i++) {
-        MillSim::MillPathSegment* p = MillPathSegments.at(i);
-        int step = (i == mPathStep) ? mSubStep : p->numSimSteps;
-        int start = p->isMultyPart ? 1 : step;
-        for (int j = start; j <= step; j++) {
-            MillPathSegments.at(i)->render(j);
-        }
-    }
+    mCutBatch.Render();
+    mLiveCutBatch.Render();
 
     GlsimEnd();
 }
 
+void MillSimulation::RenderHeightMapSimulation()
+{
+    simDisplay.StartDepthPass();
+    simDisplay.StartClippedGeometryPass(stockColor, mHeightMap.GetTexture(), mHeightMap.mapMat);
+    mStockObject.render();
+
+    simDisplay.StartHeightMapGeometryPass(cutColor, mHeightMap.GetTexture(), mHeightMap.mapMat);
+    mHeightMap.RenderSurface();
+}
+
 void MillSimulation::RenderTool()
 {
     if (mPathStep < 0) {
@@ -545,15 +646,19 @@ void MillSimulation::SetBoxStock(float x, float y, float z, float l, float w, fl
 {
     mStockObject.GenerateBoxStock(x, y, z, l, w, h);
     simDisplay.ScaleViewToStock(&mStockObject);
+    mHeightMap.FreeResources();
+    mUseHeightMap = true;
 }
 
-void MillSimulation::SetArbitraryStock(std::vector<Vertex>& verts, std::vector<GLushort>& indices)
+void MillSimulation::SetArbitraryStock(std::vector<Vertex>& verts, std::vector<GLuint>& indices)
 {
     mStockObject.GenerateSolid(verts, indices);
     simDisplay.ScaleViewToStock(&mStockObject);
+    mHeightMap.FreeResources();
+    mUseHeightMap = true;
 }
 
-void MillSimulation::SetBaseObject(std::vector<Vertex>& verts, std::vector<GLushort>& indices)
+void MillSimulation::SetBaseObject(std::vector<Vertex>& verts, std::vector<GLuint>& indices)
 {
     mBaseShape.GenerateSolid(verts, indices);
 }
@@ -34,6 +34,8 @@
 #include "GuiDisplay.h"
 #include "MillPathLine.h"
 #include "SolidObject.h"
+#include "ShapeBatch.h"
+#include "HeightMap.h"
 #include <sstream>
 #include <vector>
 
@@ -50,6 +52,9 @@ public:
     MillSimulation();
     ~MillSimulation();
     void ClearMillPathSegments();
+    void AddSegmentCuts(ShapeBatch& batch, MillPathSegment* segment, int firstStep, int lastStep);
+    void UpdateCutBatches();
+    bool UpdateHeightMap();
     void Clear();
     void SimNext();
     void InitSimulation(float quality);
@@ -60,6 +65,7 @@ public:
         return GetTool(toolid) != nullptr;
     }
     void RenderSimulation();
+    void RenderHeightMapSimulation();
     void RenderTool();
     void RenderPath();
     void RenderBaseShape();
@@ -71,8 +77,8 @@ public:
     bool AddGcodeLine(const char* line);
     void SetSimulationStage(float stage);
     void SetBoxStock(float x, float y, float z, float l, float w, float h);
-    void SetArbitraryStock(std::vector<Vertex>& verts, std::vector<GLushort>& indices);
-    void SetBaseObject(std::vector<Vertex>& verts, std::vector<GLushort>& indices);
+    void SetArbitraryStock(std::vector<Vertex>& verts, std::vector<GLuint>& indices);
+    void SetBaseObject(std::vector<Vertex>& verts, std::vector<GLuint>& indices);
     void MouseDrag(int buttons, int dx, int dy);
     void MouseMove(int px, int py, int modifiers);
     void MouseScroll(float dy);
@@ -105,6 +111,19 @@ protected:
     SimDisplay simDisplay;
     MillPathLine millPathLine;
     std::vector<MillPathSegment*> MillPathSegments;
+    // the cuts of the completed segments, extended as the simulation goes on
+    ShapeBatch mCutBatch;
+    int mBatchedSegments = 0;
+    // the cuts of the current segment
+    ShapeBatch mLiveCutBatch;
+    // the stock with all cuts up to step mMapSubStep of segment mMapSegment
+    HeightMap mHeightMap;
+    ShapeBatch mNewCutBatch;
+    int mMapSegment = 0;
+    int mMapSubStep = 0;
+    int mHeightMapResolution = 512;
+    // cleared when the height map can't be used, the CSG simulation is used then
+    bool mUseHeightMap = true;
     std::ostringstream mFpsStream;
 
     MillMotion mZeroPos = {eNop, -1, 0, 0, 100, 0, 0, 0, 0};
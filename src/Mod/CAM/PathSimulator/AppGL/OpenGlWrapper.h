@@ -88,5 +88,13 @@ extern QOpenGLContext* gOpenGlContext;
 #define glLineWidth gSimWindow->glLineWidth
 #define glGetShaderiv gSimWindow->glGetShaderiv
 #define glGetShaderInfoLog gSimWindow->glGetShaderInfoLog
+#define glDisableVertexAttribArray gSimWindow->glDisableVertexAttribArray
+#define glVertexAttribDivisor gSimWindow->glVertexAttribDivisor
+#define glDrawElementsInstanced gSimWindow->glDrawElementsInstanced
+#define glBufferSubData gSimWindow->glBufferSubData
+#define glBlendEquation gSimWindow->glBlendEquation
+#define glClearBufferfv gSimWindow->glClearBufferfv
+#define glGetIntegerv gSimWindow->glGetIntegerv
+#define glViewport gSimWindow->glViewport
 
 #endif  // !__openglwrapper_h__
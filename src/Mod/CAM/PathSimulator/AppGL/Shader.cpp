@@ -175,6 +175,13 @@ void Shader::UpdateCurSegment(int curSeg)
     }
 }
 
+void Shader::UpdateHeightMapMat(mat4x4 mat)
+{
+    if (mHeightMapMatPos >= 0) {
+        glUniformMatrix4fv(mHeightMapMatPos, 1, GL_FALSE, (GLfloat*)mat);
+    }
+}
+
 
 bool CheckCompileResult(int shaderId, const char* shaderName, bool isVertex)
 {
@@ -257,6 +264,7 @@ Shader::CompileShader(const char* name, const char* _vertShader, const char* _fr
     mCurSegmentPos = glGetUniformLocation(shaderId, "curSegment");
     mScreenWidthPos = glGetUniformLocation(shaderId, "screenWidth");
     mScreenHeightPos = glGetUniformLocation(shaderId, "screenHeight");
+    mHeightMapMatPos = glGetUniformLocation(shaderId, "heightMapMat");
 
     Activate();
     return shaderId;
@@ -457,6 +465,33 @@ const char* VertShaderGeom = R"(
     }
 )";
 
+// same as VertShaderGeom with the model matrix taken from an instance attribute
+const char* VertShaderGeomInstanced = R"(
+    #version 330 core
+    layout (location = 0) in vec3 aPos;
+    layout (location = 1) in vec3 aNormal;
+    layout (location = 2) in mat4 aModel;
+
+    out vec3 Position;
+    out vec3 Normal;
+
+    uniform bool invertedNormals;
+
+    uniform mat4 view;
+    uniform mat4 projection;
+
+    void main()
+    {
+        vec4 viewPos = view * aModel * vec4(aPos, 1.0);
+        Position = viewPos.xyz;
+
+        mat3 normalMatrix = transpose(inverse(mat3(view * aModel)));
+        Normal = normalMatrix * (invertedNormals ? -aNormal : aNormal);
+
+        gl_Position = projection * viewPos;
+    }
+)";
+
 const char* FragShaderGeom = R"(
     #version 330 core
     layout (location = 0) out vec4 ColorTex;
@@ -477,6 +512,147 @@ const char* FragShaderGeom = R"(
     }
 )";
 
+// The height map shaders, see HeightMap. A texel of the map holds the deepest cut in r, the
+// bottom of the stock in g and the negated top of the stock in b.
+
+// same as VertShaderGeom, also passes the height map coordinates of the vertex
+const char* VertShaderGeomClipped = R"(
+    #version 330 core
+    layout (location = 0) in vec3 aPos;
+    layout (location = 1) in vec3 aNormal;
+
+    out vec3 Position;
+    out vec3 Normal;
+    out vec2 MapCoord;
+    out float WorldZ;
+
+    uniform mat4 model;
+    uniform mat4 view;
+    uniform mat4 projection;
+    uniform mat4 heightMapMat;
+
+    void main()
+    {
+        vec4 worldPos = model * vec4(aPos, 1.0);
+        vec4 viewPos = view * worldPos;
+        Position = viewPos.xyz;
+
+        mat3 normalMatrix = transpose(inverse(mat3(view * model)));
+        Normal = normalMatrix * aNormal;
+
+        MapCoord = (heightMapMat * worldPos).xy * 0.5 + 0.5;
+        WorldZ = worldPos.z;
+        gl_Position = projection * viewPos;
+    }
+)";
+
+// renders the stock without the material above the cuts
+const char* FragShaderGeomClipped = R"(
+    #version 330 core
+    layout (location = 0) out vec4 ColorTex;
+    layout (location = 1) out vec3 PositionTex;
+    layout (location = 2) out vec3 NormalTex;
+
+    in vec3 Position;
+    in vec3 Normal;
+    in vec2 MapCoord;
+    in float WorldZ;
+
+    uniform vec3 objectColor;
+    uniform sampler2D texSlot;
+
+    void main()
+    {
+        if (WorldZ > texture(texSlot, MapCoord).r + 0.001) discard;
+        PositionTex = Position;
+        NormalTex = normalize(Normal);
+        ColorTex = vec4(objectColor, 1.0f);
+    }
+)";
+
+// a grid vertex per texel, moved down to the remaining stock surface
+const char* VertShaderHeightMap = R"(
+    #version 330 core
+    layout (location = 0) in vec3 aPos;
+
+    out vec3 Position;
+    out float Removed;
+    out float Remaining;
+
+    uniform mat4 view;
+    uniform mat4 projection;
+    uniform mat4 heightMapMat;
+    uniform sampler2D texSlot;
+
+    void main()
+    {
+        vec4 heights = texture(texSlot, (heightMapMat * vec4(aPos.xy, 0.0, 1.0)).xy * 0.5 + 0.5);
+        float top = -heights.b;
+        float z = aPos.z;
+        if (heights.g <= top) {
+            z = max(min(top, heights.r), heights.g);
+            Removed = top - z;
+            Remaining = z - heights.g;
+        }
+        else {
+            // no stock in this column, hide all triangles that touch it
+            Removed = 0.0;
+            Remaining = -1e20;
+        }
+        vec4 viewPos = view * vec4(aPos.xy, z, 1.0);
+        Position = viewPos.xyz;
+        gl_Position = projection * viewPos;
+    }
+)";
+
+// the grid is only shown where material was removed and some is left
+const char* FragShaderHeightMap = R"(
+    #version 330 core
+    layout (location = 0) out vec4 ColorTex;
+    layout (location = 1) out vec3 PositionTex;
+    layout (location = 2) out vec3 NormalTex;
+
+    in vec3 Position;
+    in float Removed;
+    in float Remaining;
+
+    uniform vec3 objectColor;
+
+    void main()
+    {
+        if (Removed < 0.001 || Remaining < 0.001) discard;
+        PositionTex = Position;
+        NormalTex = normalize(cross(dFdx(Position), dFdy(Position)));
+        ColorTex = vec4(objectColor, 1.0f);
+    }
+)";
+
+// writes the bottom and the top of the stock, the map is blended with GL_MIN
+const char* FragShaderHeightStock = R"(
+    #version 330 core
+    layout (location = 0) out vec4 Heights;
+
+    in vec3 Position;
+
+    void main()
+    {
+        Heights = vec4(1e30, Position.z, -Position.z, 0.0);
+    }
+)";
+
+// writes the bottom of the cut shapes, the map is blended with GL_MIN
+const char* FragShaderHeightCut = R"(
+    #version 330 core
+    layout (location = 0) out vec4 Heights;
+
+    in vec3 Position;
+
+    void main()
+    {
+        Heights = vec4(Position.z, 1e30, 1e30, 0.0);
+    }
+)";
+
 const char* FragShaderSSAO = R"(
     #version 330 core
     layout (location = 0) out float AoData;
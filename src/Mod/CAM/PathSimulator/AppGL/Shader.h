@@ -54,6 +54,7 @@ public:
     void UpdateSsaoTexSlot(int ssaoSlot);
     void UpdateKernelVals(int nVals, float* vals);
     void UpdateCurSegment(int curSeg);
+    void UpdateHeightMapMat(mat4x4 mat);
     unsigned int CompileShader(const char* name, const char* vertShader, const char* fragShader);
     void Activate();
     void Destroy();
@@ -86,6 +87,7 @@ protected:
     int mCurSegmentPos = -1;
     int mScreenWidthPos = -1;
     int mScreenHeightPos = -1;
+    int mHeightMapMatPos = -1;
 
     const char* vertShader = nullptr;
     const char* fragShader = nullptr;
@@ -102,7 +104,14 @@ extern const char* FragShader2dTex;
 extern const char* VertShader2DFbo;
 extern const char* FragShader2dFbo;
 extern const char* VertShaderGeom;
+extern const char* VertShaderGeomInstanced;
 extern const char* FragShaderGeom;
+extern const char* VertShaderGeomClipped;
+extern const char* FragShaderGeomClipped;
+extern const char* VertShaderHeightMap;
+extern const char* FragShaderHeightMap;
+extern const char* FragShaderHeightStock;
+extern const char* FragShaderHeightCut;
 extern const char* FragShaderSSAO;
 extern const char* FragShaderSSAOLighting;
 extern const char* FragShaderStdLighting;
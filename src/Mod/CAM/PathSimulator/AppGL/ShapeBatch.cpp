@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "ShapeBatch.h"
+#include "OpenGlWrapper.h"
+#include "GlUtils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace MillSim
+{
+
+ShapeBatch::~ShapeBatch()
+{
+    FreeResources();
+}
+
+void ShapeBatch::Add(Shape* shape, mat4x4 modelMat)
+{
+    Instances& inst = mInstances[shape];
+    inst.matrices.emplace_back();
+    memcpy(inst.matrices.back().m, modelMat, sizeof(mat4x4));
+    mNumInstances++;
+}
+
+void ShapeBatch::Clear()
+{
+    for (auto& it : mInstances) {
+        it.second.matrices.clear();
+        it.second.uploaded = 0;
+    }
+    mNumInstances = 0;
+}
+
+void ShapeBatch::Render()
+{
+    for (auto& it : mInstances) {
+        Instances& inst = it.second;
+        size_t count = inst.matrices.size();
+        if (count == 0) {
+            continue;
+        }
+        if (inst.vbo == 0) {
+            glGenBuffers(1, &inst.vbo);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, inst.vbo);
+        if (count > inst.capacity) {
+            // grow geometrically, the matrices are appended while the simulation runs
+            inst.capacity = std::max(count, inst.capacity * 2);
+            glBufferData(GL_ARRAY_BUFFER, inst.capacity * sizeof(mat4x4), nullptr, GL_DYNAMIC_DRAW);
+            inst.uploaded = 0;
+        }
+        if (inst.uploaded < count) {
+            glBufferSubData(GL_ARRAY_BUFFER,
+                            inst.uploaded * sizeof(mat4x4),
+                            (count - inst.uploaded) * sizeof(mat4x4),
+                            inst.matrices[inst.uploaded].m);
+            inst.uploaded = count;
+        }
+        it.first->RenderInstanced(inst.vbo, (int)count);
+    }
+}
+
+void ShapeBatch::FreeResources()
+{
+    for (auto& it : mInstances) {
+        GLDELETE_BUFFER(it.second.vbo);
+    }
+    mInstances.clear();
+    mNumInstances = 0;
+}
+
+}  // namespace MillSim
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef __shape_batch_h__
+#define __shape_batch_h__
+
+#include "SimShapes.h"
+#include "linmath.h"
+#include <map>
+#include <vector>
+
+namespace MillSim
+{
+
+/// Collects the placements of shapes to render all copies of a shape in one draw call
+class ShapeBatch
+{
+public:
+    ShapeBatch() = default;
+    ~ShapeBatch();
+    ShapeBatch(const ShapeBatch&) = delete;
+    ShapeBatch& operator=(const ShapeBatch&) = delete;
+
+    void Add(Shape* shape, mat4x4 modelMat);
+    /// Removes all placements, the GPU buffers are kept for reuse
+    void Clear();
+    /// Renders all shapes, needs an active shader that reads the model matrix per instance
+    void Render();
+    void FreeResources();
+    bool IsEmpty() const
+    {
+        return mNumInstances == 0;
+    }
+
+protected:
+    // arrays can't be stored in a vector directly
+    struct ModelMat
+    {
+        mat4x4 m;
+    };
+    struct Instances
+    {
+        std::vector<ModelMat> matrices;
+        unsigned int vbo = 0;
+        size_t capacity = 0;  // in matrices
+        size_t uploaded = 0;  // matrices already in the vbo
+    };
+
+    std::map<Shape*, Instances> mInstances;
+    size_t mNumInstances = 0;
+};
+
+}  // namespace MillSim
+#endif  // !__shape_batch_h__
@@ -57,6 +57,11 @@ void SimDisplay::InitShaders()
     // geometric shader - generate texture with all geometric info for further processing
     shaderGeom.CompileShader("Geometric", VertShaderGeom, FragShaderGeom);
     shaderGeomCloser.CompileShader("GeomCloser", VertShaderGeom, FragShaderGeom);
+    shaderGeomInstanced.CompileShader("GeomInstanced", VertShaderGeomInstanced, FragShaderGeom);
+    shaderGeomClipped.CompileShader("GeomClipped", VertShaderGeomClipped, FragShaderGeomClipped);
+    shaderGeomClipped.UpdateTextureSlot(0);
+    shaderGeomHeightMap.CompileShader("GeomHeightMap", VertShaderHeightMap, FragShaderHeightMap);
+    shaderGeomHeightMap.UpdateTextureSlot(0);
 
     // SSAO shader - generate SSAO info and embed in texture buffer
     shaderSSAO.CompileShader("SSAO", VertShader2DFbo, FragShaderSSAO);
@@ -295,6 +300,10 @@ void SimDisplay::CleanGL()
     shaderFlat.Destroy();
     shaderSimFbo.Destroy();
     shaderGeom.Destroy();
+    shaderGeomCloser.Destroy();
+    shaderGeomInstanced.Destroy();
+    shaderGeomClipped.Destroy();
+    shaderGeomHeightMap.Destroy();
     shaderSSAO.Destroy();
     shaderSSAOLighting.Destroy();
     shaderSSAOBlur.Destroy();
@@ -341,6 +350,18 @@ void SimDisplay::StartGeometryPass(vec3 objColor, bool invertNormals)
     glDisable(GL_BLEND);
 }
 
+// Same as the std geometry pass for shapes that are rendered by ShapeBatch
+void SimDisplay::StartInstancedGeometryPass(vec3 objColor, bool invertNormals)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    shaderGeomInstanced.Activate();
+    shaderGeomInstanced.UpdateNormalState(invertNormals);
+    shaderGeomInstanced.UpdateViewMat(mMatLookAt);
+    shaderGeomInstanced.UpdateObjColor(objColor);
+    glEnable(GL_CULL_FACE);
+    glDisable(GL_BLEND);
+}
+
 // A 'closer' geometry pass is similar to std geometry pass, but render the objects
 // slightly closer to the camera. This mitigates overlapping faces artifacts.
 void SimDisplay::StartCloserGeometryPass(vec3 objColor)
@@ -354,6 +375,38 @@ void SimDisplay::StartCloserGeometryPass(vec3 objColor)
     glDisable(GL_BLEND);
 }
 
+// Geometry pass for the stock of a height map simulation, the material above the cuts in the
+// height map is left out
+void SimDisplay::StartClippedGeometryPass(vec3 objColor,
+                                          unsigned int heightMapTex,
+                                          mat4x4 heightMapMat)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    shaderGeomClipped.Activate();
+    shaderGeomClipped.UpdateViewMat(mMatLookAt);
+    shaderGeomClipped.UpdateObjColor(objColor);
+    shaderGeomClipped.UpdateHeightMapMat(heightMapMat);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, heightMapTex);
+    glEnable(GL_CULL_FACE);
+    glDisable(GL_BLEND);
+}
+
+// Geometry pass for the surface of the cuts in a height map
+void SimDisplay::StartHeightMapGeometryPass(vec3 objColor,
+                                            unsigned int heightMapTex,
+                                            mat4x4 heightMapMat)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
+    shaderGeomHeightMap.Activate();
+    shaderGeomHeightMap.UpdateViewMat(mMatLookAt);
+    shaderGeomHeightMap.UpdateObjColor(objColor);
+    shaderGeomHeightMap.UpdateHeightMapMat(heightMapMat);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, heightMapTex);
+    glDisable(GL_BLEND);
+}
+
 void SimDisplay::RenderLightObject()
 {
     shaderFlat.Activate();
@@ -576,6 +629,12 @@ void SimDisplay::UpdateProjection()
     shaderFlat.UpdateProjectionMat(projmat);
     shaderGeom.Activate();
     shaderGeom.UpdateProjectionMat(projmat);
+    shaderGeomInstanced.Activate();
+    shaderGeomInstanced.UpdateProjectionMat(projmat);
+    shaderGeomClipped.Activate();
+    shaderGeomClipped.UpdateProjectionMat(projmat);
+    shaderGeomHeightMap.Activate();
+    shaderGeomHeightMap.UpdateProjectionMat(projmat);
     shaderSSAO.Activate();
     shaderSSAO.UpdateProjectionMat(projmat);
     shaderLinePath.Activate();
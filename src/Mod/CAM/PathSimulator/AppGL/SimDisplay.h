@@ -52,7 +52,10 @@ public:
     void PrepareFrameBuffer();
     void StartDepthPass();
     void StartGeometryPass(vec3 objColor, bool invertNormals);
+    void StartInstancedGeometryPass(vec3 objColor, bool invertNormals);
     void StartCloserGeometryPass(vec3 objColor);
+    void StartClippedGeometryPass(vec3 objColor, unsigned int heightMapTex, mat4x4 heightMapMat);
+    void StartHeightMapGeometryPass(vec3 objColor, unsigned int heightMapTex, mat4x4 heightMapMat);
     void RenderLightObject();
     void ScaleViewToStock(StockObject* obj);
     void RenderResult(bool recalculate);
@@ -92,6 +95,8 @@ protected:
     Shader shader3D, shaderInv3D, shaderFlat, shaderSimFbo;
     Shader shaderGeom, shaderSSAO, shaderSSAOLighting, shaderSSAOBlur;
     Shader shaderGeomCloser;
+    Shader shaderGeomInstanced;
+    Shader shaderGeomClipped, shaderGeomHeightMap;
     Shader shaderLinePath;
     vec3 lightColor = {0.5f, 0.6f, 0.7f};
     vec3 lightPos = {20.0f, 20.0f, 10.0f};
@@ -313,7 +313,11 @@ void Shape::ExtrudeProfileLinear(float* profPoints,
     SetModelData(vbuffer, ibuffer);
 }
 
-void Shape::GenerateModel(float* vbuffer, GLushort* ibuffer, int numVerts, int nIndices)
+void Shape::GenerateModel(float* vbuffer,
+                          const void* ibuffer,
+                          int numVerts,
+                          int nIndices,
+                          GLenum type)
 {
     // GLuint vbo, ibo, vao;
 
@@ -327,7 +331,8 @@ void Shape::GenerateModel(float* vbuffer, GLushort* ibuffer, int numVerts, int n
     // index buffer
     glGenBuffers(1, &ibo);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, nIndices * sizeof(GLushort), ibuffer, GL_STATIC_DRAW);
+    std::size_t indexSize = type == GL_UNSIGNED_INT ? sizeof(GLuint) : sizeof(GLushort);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, nIndices * indexSize, ibuffer, GL_STATIC_DRAW);
 
     // vertex array
     glGenVertexArrays(1, &vao);
@@ -338,18 +343,64 @@ void Shape::GenerateModel(float* vbuffer, GLushort* ibuffer, int numVerts, int n
     glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, nx));
 
     numIndices = nIndices;
+    indexType = type;
 }
 
 void MillSim::Shape::SetModelData(std::vector<Vertex>& vbuffer, std::vector<GLushort>& ibuffer)
 {
-    GenerateModel((float*)vbuffer.data(), ibuffer.data(), (int)vbuffer.size(), (int)ibuffer.size());
+    GenerateModel((float*)vbuffer.data(),
+                  ibuffer.data(),
+                  (int)vbuffer.size(),
+                  (int)ibuffer.size(),
+                  GL_UNSIGNED_SHORT);
+}
+
+void MillSim::Shape::SetModelData(std::vector<Vertex>& vbuffer, std::vector<GLuint>& ibuffer)
+{
+    if (vbuffer.size() <= 0x10000) {
+        // small models keep the short indices to save memory
+        std::vector<GLushort> shortBuffer(ibuffer.begin(), ibuffer.end());
+        SetModelData(vbuffer, shortBuffer);
+        return;
+    }
+    GenerateModel((float*)vbuffer.data(),
+                  ibuffer.data(),
+                  (int)vbuffer.size(),
+                  (int)ibuffer.size(),
+                  GL_UNSIGNED_INT);
 }
 
 void Shape::Render()
 {
     glBindVertexArray(vao);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-    glDrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, numIndices, indexType, nullptr);
+}
+
+void Shape::RenderInstanced(uint instanceBuffer, int numInstances)
+{
+    if (numInstances <= 0) {
+        return;
+    }
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+
+    // the model matrix takes the attribute locations 2 to 5, one column each
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    for (int i = 0; i < 4; i++) {
+        glEnableVertexAttribArray(2 + i);
+        glVertexAttribPointer(2 + i,
+                              4,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(mat4x4),
+                              (void*)(i * sizeof(vec4)));
+        glVertexAttribDivisor(2 + i, 1);
+    }
+    glDrawElementsInstanced(GL_TRIANGLES, numIndices, indexType, nullptr, numInstances);
+    for (int i = 0; i < 4; i++) {
+        glDisableVertexAttribArray(2 + i);
+    }
 }
 
 void Shape::Render(mat4x4 modelMat, mat4x4 normallMat)  // normals are rotated only
@@ -78,12 +78,17 @@ public:
     uint vbo = 0;
     uint ibo = 0;
     int numIndices = 0;
+    // GL_UNSIGNED_INT for models with more than 64k vertices
+    GLenum indexType = GL_UNSIGNED_SHORT;
 
 public:
     void Render();
     void Render(mat4x4 modelMat, mat4x4 normallMat);
+    /// Renders the shape once for every model matrix in \a instanceBuffer
+    void RenderInstanced(uint instanceBuffer, int numInstances);
     void FreeResources();
     void SetModelData(std::vector<Vertex>& vbuffer, std::vector<GLushort>& ibuffer);
+    void SetModelData(std::vector<Vertex>& vbuffer, std::vector<GLuint>& ibuffer);
     void RotateProfile(float* profPoints,
                        int nPoints,
                        float distance,
@@ -112,7 +117,11 @@ public:
     static int lastNumSlices;
 
 protected:
-    void GenerateModel(float* vbuffer, GLushort* ibuffer, int numVerts, int numIndices);
+    void GenerateModel(float* vbuffer,
+                       const void* ibuffer,
+                       int numVerts,
+                       int numIndices,
+                       GLenum type);
     void CalculateExtrudeBufferSizes(int nProfilePoints,
                                      bool capStart,
                                      bool capEnd,
@@ -53,7 +53,7 @@ void SolidObject::render()
     shape.Render(mModelMat, mModelMat);  // model is not rotated hence both are identity matrix
 }
 
-void SolidObject::GenerateSolid(std::vector<Vertex>& verts, std::vector<GLushort>& indices)
+void SolidObject::GenerateSolid(std::vector<Vertex>& verts, std::vector<GLuint>& indices)
 {
     shape.SetModelData(verts, indices);
 
@@ -26,7 +26,10 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <numbers>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -1826,6 +1829,8 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
     //	Resolve hierarchy and run processing
     //***************************************
     double cornerRoundingOffset = 0.15 * toolRadiusScaled / 2;
+    // bound paths and tool bound paths of the independent regions
+    std::vector<std::pair<Paths, Paths>> regions;
     if (opType == OperationType::otClearingInside || opType == OperationType::otClearingOutside) {
 
         // prepare stock boundary overshooted paths
@@ -1877,7 +1882,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                 clipof.Clear();
                 clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                 clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-                ProcessPolyNode(boundPaths, toolBoundPaths);
+                regions.emplace_back(boundPaths, toolBoundPaths);
             }
         }
     }
@@ -1934,14 +1939,75 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                     clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                     clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-                    ProcessPolyNode(boundPaths, toolBoundPaths);
+                    regions.emplace_back(boundPaths, toolBoundPaths);
                 }
             }
         }
     }
+    ProcessRegions(regions);
     return results;
 }
 
+//********************************************
+// Adaptive2d - ProcessRegions
+//********************************************
+
+void Adaptive2d::ProcessRegions(const std::vector<std::pair<Paths, Paths>>& regions)
+{
+    size_t threads = threadCount > 0 ? size_t(threadCount)
+                                     : std::max<size_t>(1, std::thread::hardware_concurrency());
+#ifdef DEV_MODE
+    threads = 1;  // debug drawing and performance counters are not thread safe
+#endif
+    threads = std::min(threads, regions.size());
+    if (threads < 2) {
+        for (const auto& region : regions) {
+            ProcessPolyNode(region.first, region.second);
+        }
+        return;
+    }
+
+    // each region is processed by a copy of this object, the results are appended in region
+    // order afterwards. Only the calling thread reports progress as the callback may be a
+    // python function, the other threads just check if processing was stopped.
+    std::atomic<bool> stopped(false);
+    std::function<bool(TPaths)> checkStopped = [&stopped](TPaths) {
+        return stopped.load();
+    };
+    std::vector<std::list<AdaptiveOutput>> regionResults(regions.size());
+    std::atomic<size_t> next(0);
+    auto worker = [&](bool reportProgress) {
+        for (size_t i = next++; i < regions.size() && !stopped; i = next++) {
+            Adaptive2d regionAdaptive(*this);
+            regionAdaptive.results.clear();
+            regionAdaptive.current_region = current_region + int(i);
+            if (!reportProgress) {
+                regionAdaptive.progressCallback = &checkStopped;
+            }
+            regionAdaptive.ProcessPolyNode(regions[i].first, regions[i].second);
+            if (regionAdaptive.stopProcessing) {
+                stopped = true;
+            }
+            regionResults[i] = std::move(regionAdaptive.results);
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (size_t i = 1; i < threads; i++) {
+        futures.push_back(std::async(std::launch::async, worker, false));
+    }
+    worker(true);
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    for (auto& regionResult : regionResults) {
+        results.splice(results.end(), regionResult);
+    }
+    current_region += int(regions.size());
+    stopProcessing = stopped;
+}
+
 bool Adaptive2d::FindEntryPoint(TPaths& progressPaths,
                                 const Paths& toolBoundPaths,
                                 const Paths& boundPaths,
@@ -93,6 +93,7 @@ public:
     bool finishingProfile = true;
     double keepToolDownDistRatio = 3.0;  // keep tool down distance ratio
     OperationType opType = OperationType::otClearingInside;
+    int threadCount = 0;  // number of regions processed at the same time, 0 = one per core
 
     std::list<AdaptiveOutput> Execute(const DPaths& stockPaths,
                                       const DPaths& paths,
@@ -125,6 +126,7 @@ private:
     Path toolGeometry;  // tool geometry at coord 0,0, should not be modified
 
     void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
+    void ProcessRegions(const std::vector<std::pair<Paths, Paths>>& regions);
     bool FindEntryPoint(TPaths& progressPaths,
                         const Paths& toolBoundPaths,
                         const Paths& bound,
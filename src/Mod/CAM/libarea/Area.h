@@ -47,23 +47,26 @@ class CArea
 {
 public:
     std::list<CCurve> m_curves;
-    static double m_accuracy;
-    static double m_units;  // 1.0 for mm, 25.4 for inches. All points are multiplied by this before
-                            // going to the engine
-    static bool m_clipper_simple;
-    static double m_clipper_clean_distance;
-    static bool m_fit_arcs;
-    static int m_min_arc_points;
-    static int m_max_arc_points;
-    static double m_processing_done;  // 0.0 to 100.0, set inside MakeOnePocketCurve
-    static double m_single_area_processing_length;
-    static double m_after_MakeOffsets_length;
-    static double m_MakeOffsets_increment;
-    static double m_split_processing_length;
-    static bool m_set_processing_length_in_split;
+    // The settings and the processing state are kept per thread, so that areas can be
+    // built in several threads at once. Only m_please_abort is shared by all of them.
+    static thread_local double m_accuracy;
+    // 1.0 for mm, 25.4 for inches. All points are multiplied by this before going to the engine
+    static thread_local double m_units;
+    static thread_local bool m_clipper_simple;
+    static thread_local double m_clipper_clean_distance;
+    static thread_local bool m_fit_arcs;
+    static thread_local int m_min_arc_points;
+    static thread_local int m_max_arc_points;
+    // 0.0 to 100.0, set inside MakeOnePocketCurve
+    static thread_local double m_processing_done;
+    static thread_local double m_single_area_processing_length;
+    static thread_local double m_after_MakeOffsets_length;
+    static thread_local double m_MakeOffsets_increment;
+    static thread_local double m_split_processing_length;
+    static thread_local bool m_set_processing_length_in_split;
     static bool m_please_abort;  // the user sets this from another thread, to tell
                                  // MakeOnePocketCurve to finish with no result.
-    static double m_clipper_scale;
+    static thread_local double m_clipper_scale;
 
     void append(const CCurve& curve);
     void move(CCurve&& curve);
@@ -9,7 +9,7 @@
 #include <map>
 #include <set>
 
-static const CAreaPocketParams* pocket_params = NULL;
+static thread_local const CAreaPocketParams* pocket_params = NULL;
 
 class IslandAndOffset
 {
@@ -46,9 +46,9 @@ public:
 
 class CurveTree
 {
-    static std::list<CurveTree*> to_do_list_for_MakeOffsets;
+    static thread_local std::list<CurveTree*> to_do_list_for_MakeOffsets;
     void MakeOffsets2();
-    static std::list<CurveTree*> islands_added;
+    static thread_local std::list<CurveTree*> islands_added;
 
 public:
     Point point_on_parent;
@@ -64,14 +64,14 @@ public:
 
     void MakeOffsets();
 };
-std::list<CurveTree*> CurveTree::islands_added;
+thread_local std::list<CurveTree*> CurveTree::islands_added;
 
 class GetCurveItem
 {
 public:
     CurveTree* curve_tree;
     std::list<CVertex>::iterator EndIt;
-    static std::list<GetCurveItem> to_do_list;
+    static thread_local std::list<GetCurveItem> to_do_list;
 
     GetCurveItem(CurveTree* ct, std::list<CVertex>::iterator EIt)
         : curve_tree(ct)
@@ -87,8 +87,8 @@ public:
     }
 };
 
-std::list<GetCurveItem> GetCurveItem::to_do_list;
-std::list<CurveTree*> CurveTree::to_do_list_for_MakeOffsets;
+thread_local std::list<GetCurveItem> GetCurveItem::to_do_list;
+thread_local std::list<CurveTree*> CurveTree::to_do_list_for_MakeOffsets;
 
 void GetCurveItem::GetCurve(CCurve& output)
 {
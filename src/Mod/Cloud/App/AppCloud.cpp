@@ -23,7 +23,10 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <cctype>
 #include <limits>
+#include <memory>
 #endif
 
 
@@ -219,6 +222,255 @@ static size_t read_callback(void* ptr, size_t size, size_t nmemb, void* stream)
     return 0;
 }
 
+namespace
+{
+
+// Upper bound of simultaneous requests against the storage server
+constexpr long MaxConcurrentTransfers = 8;
+// Members at least this large are sent as multipart uploads
+constexpr size_t MultipartThreshold = 16 * 1024 * 1024;
+// S3 requires every part but the last one to hold at least 5 MiB
+constexpr size_t MultipartPartSize = 8 * 1024 * 1024;
+
+struct Endpoint
+{
+    const char* URL;
+    const char* TCPPort;
+    const char* TokenAuth;
+    const char* TokenSecret;
+    const char* Bucket;
+    std::string ProtocolVersion;
+    std::string Region;
+};
+
+struct Transfer
+{
+    CURL* curl = nullptr;
+    struct curl_slist* chunk = nullptr;
+    struct data_buffer upload = {nullptr, 0};
+    std::string response;
+    std::string etag;
+    CURLcode result = CURLE_OK;
+    long status = 0;
+
+    Transfer() = default;
+    Transfer(const Transfer&) = delete;
+    Transfer& operator=(const Transfer&) = delete;
+    ~Transfer()
+    {
+        if (curl) {
+            curl_easy_cleanup(curl);
+        }
+        curl_slist_free_all(chunk);
+    }
+
+    bool succeeded() const
+    {
+        return result == CURLE_OK && status >= 200 && status < 300;
+    }
+};
+
+size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+    size_t length = size * nitems;
+    std::string line(buffer, length);
+    std::string name = line.substr(0, 5);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    if (name == "etag:") {
+        std::string value = line.substr(5);
+        value.erase(std::remove_if(value.begin(),
+                                   value.end(),
+                                   [](unsigned char c) {
+                                       return c == '"' || std::isspace(c);
+                                   }),
+                    value.end());
+        *static_cast<std::string*>(userdata) = value;
+    }
+    return length;
+}
+
+// Prepares a signed request. The data must stay alive until the transfer is done.
+std::unique_ptr<Transfer> createTransfer(const Endpoint& endpoint,
+                                         char* operation,
+                                         char* data_type,
+                                         const std::string& key,
+                                         const std::string& query,
+                                         const char* data,
+                                         size_t size)
+{
+    auto transfer = std::make_unique<Transfer>();
+
+    std::string path = std::string("/") + endpoint.Bucket + "/" + key;
+    std::string strURL(endpoint.URL);
+    Cloud::eraseSubStr(strURL, "http://");
+    Cloud::eraseSubStr(strURL, "https://");
+    if (endpoint.ProtocolVersion == "2") {
+        // Version 2 signs the sub-resources as part of the resource
+        std::string target = query.empty() ? path : path + "?" + query;
+        struct Cloud::AmzData* RequestData = Cloud::ComputeDigestAmzS3v2(operation,
+                                                                         data_type,
+                                                                         target.c_str(),
+                                                                         endpoint.TokenSecret,
+                                                                         data,
+                                                                         (long)size);
+        transfer->chunk = Cloud::BuildHeaderAmzS3v2(strURL.c_str(),
+                                                    endpoint.TCPPort,
+                                                    endpoint.TokenAuth,
+                                                    RequestData);
+        delete RequestData;
+    }
+    else {
+        // Version 4 expects a value for every query parameter, even an empty one
+        std::string parameters = query;
+        if (!parameters.empty() && parameters.find('=') == std::string::npos) {
+            parameters += "=";
+        }
+        struct Cloud::AmzDatav4* RequestDatav4 = Cloud::ComputeDigestAmzS3v4(
+            operation,
+            strURL.c_str(),
+            data_type,
+            path.c_str(),
+            endpoint.TokenSecret,
+            data,
+            (long)size,
+            parameters.empty() ? nullptr : const_cast<char*>(parameters.c_str()),
+            endpoint.Region);
+        transfer->chunk =
+            Cloud::BuildHeaderAmzS3v4(strURL.c_str(), endpoint.TokenAuth, RequestDatav4);
+        delete RequestDatav4;
+    }
+
+    transfer->curl = curl_easy_init();
+    if (!transfer->curl) {
+        transfer->result = CURLE_FAILED_INIT;
+        return transfer;
+    }
+    CURL* curl = transfer->curl;
+#ifdef ALLOW_SELF_SIGNED_CERTIFICATE
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0);
+#endif
+    std::string URL = std::string(endpoint.URL) + ":" + endpoint.TCPPort + path;
+    if (!query.empty()) {
+        URL += "?" + query;
+    }
+    curl_easy_setopt(curl, CURLOPT_URL, URL.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer->chunk);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, transfer.get());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, Cloud::CurlWrite_CallbackFunc_StdString);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer->response);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &transfer->etag);
+
+    if (strcmp(operation, "PUT") == 0) {
+        transfer->upload.ptr = data;
+        transfer->upload.remaining_size = size;
+        curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
+        curl_easy_setopt(curl, CURLOPT_READFUNCTION, read_callback);
+        curl_easy_setopt(curl, CURLOPT_READDATA, &transfer->upload);
+        curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)size);
+    }
+    else if (strcmp(operation, "POST") == 0) {
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)size);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, data ? data : "");
+    }
+    else if (strcmp(operation, "GET") != 0) {
+        curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, operation);
+    }
+    return transfer;
+}
+
+std::string getUploadId(const Transfer& transfer)
+{
+    static const std::string open = "<UploadId>";
+    static const std::string close = "</UploadId>";
+    if (!transfer.succeeded()) {
+        return {};
+    }
+    size_t begin = transfer.response.find(open);
+    if (begin == std::string::npos) {
+        return {};
+    }
+    begin += open.size();
+    size_t end = transfer.response.find(close, begin);
+    if (end == std::string::npos) {
+        return {};
+    }
+    return transfer.response.substr(begin, end - begin);
+}
+
+// Runs transfers through a single multi handle, so that the requests overlap
+// and the connections to the storage server are kept alive between them
+class TransferQueue
+{
+public:
+    TransferQueue()
+    {
+        curl_global_init(CURL_GLOBAL_ALL);
+        multi = curl_multi_init();
+        curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, MaxConcurrentTransfers);
+        curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, MaxConcurrentTransfers);
+    }
+    TransferQueue(const TransferQueue&) = delete;
+    TransferQueue& operator=(const TransferQueue&) = delete;
+    ~TransferQueue()
+    {
+        curl_multi_cleanup(multi);
+    }
+
+    void perform(const std::vector<std::unique_ptr<Transfer>>& transfers)
+    {
+        for (const auto& transfer : transfers) {
+            if (transfer->curl) {
+                curl_multi_add_handle(multi, transfer->curl);
+            }
+        }
+
+        int running = 0;
+        do {
+            CURLMcode code = curl_multi_perform(multi, &running);
+            if (code == CURLM_OK && running) {
+                code = curl_multi_wait(multi, nullptr, 0, 1000, nullptr);
+            }
+            if (code != CURLM_OK) {
+                fprintf(stderr, "curl_multi_perform() failed: %s\n", curl_multi_strerror(code));
+                break;
+            }
+        } while (running);
+
+        int pending = 0;
+        while (CURLMsg* message = curl_multi_info_read(multi, &pending)) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            char* owner = nullptr;
+            curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &owner);
+            auto transfer = reinterpret_cast<Transfer*>(owner);
+            transfer->result = message->data.result;
+            curl_easy_getinfo(message->easy_handle, CURLINFO_RESPONSE_CODE, &transfer->status);
+        }
+
+        for (const auto& transfer : transfers) {
+            if (transfer->curl) {
+                curl_multi_remove_handle(multi, transfer->curl);
+            }
+            if (transfer->result != CURLE_OK) {
+                fprintf(stderr,
+                        "curl_easy_perform() failed: %s\n",
+                        curl_easy_strerror(transfer->result));
+            }
+        }
+    }
+
+private:
+    CURLM* multi;
+};
+
+}  // namespace
+
 void Cloud::CloudWriter::checkXML(DOMNode* node)
 {
     if (node) {
@@ -247,6 +499,12 @@ void Cloud::CloudWriter::checkElement(DOMElement* element)
     if (strcmp(name, "Code") == 0) {
         print = 1;
     }
+    if (strcmp(name, "Key") == 0) {
+        key = 1;
+    }
+    if (strcmp(name, "ETag") == 0) {
+        etag = 1;
+    }
     XMLString::release(&name);
 }
 
@@ -262,6 +520,16 @@ void Cloud::CloudWriter::checkText(DOMText* text)
         strcpy(errorCode, content);
     }
     print = 0;
+    if (key) {
+        lastKey = content;
+    }
+    key = 0;
+    if (etag) {
+        std::string value(content);
+        value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+        RemoteETags[lastKey] = value;
+    }
+    etag = 0;
     XMLString::release(&content);
 }
 
@@ -1153,6 +1421,44 @@ void Cloud::CloudReader::DownloadFile(Cloud::CloudReader::FileEntry* entry)
     }
 }
 
+void Cloud::CloudReader::DownloadFiles(const std::vector<std::string>& FileNames)
+{
+    const Endpoint endpoint {URL, TCPPort, TokenAuth, TokenSecret, Bucket, ProtocolVersion, Region};
+    std::vector<FileEntry*> entries;
+    std::vector<std::unique_ptr<Transfer>> transfers;
+
+    for (const auto& name : FileNames) {
+        for (auto entry : FileList) {
+            if (name != entry->FileName) {
+                continue;
+            }
+            if (!entry->downloaded
+                && std::find(entries.begin(), entries.end(), entry) == entries.end()) {
+                entries.push_back(entry);
+                transfers.push_back(createTransfer(endpoint,
+                                                   "GET",
+                                                   "application/octet-stream",
+                                                   entry->FileName,
+                                                   std::string(),
+                                                   nullptr,
+                                                   0));
+            }
+            break;
+        }
+    }
+
+    TransferQueue queue;
+    queue.perform(transfers);
+
+    // Failed members are left to GetEntry() which retries them one by one
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (transfers[i]->succeeded()) {
+            entries[i]->FileStream << transfers[i]->response;
+            entries[i]->downloaded = true;
+        }
+    }
+}
+
 struct Cloud::CloudReader::FileEntry* Cloud::CloudReader::GetEntry(std::string FileName)
 {
     struct Cloud::CloudReader::FileEntry* current_entry = nullptr;
@@ -1167,7 +1473,11 @@ struct Cloud::CloudReader::FileEntry* Cloud::CloudReader::GetEntry(std::string F
 
     if (current_entry != nullptr) {
         (*it1)->touch = 1;
-        DownloadFile(*it1);
+        if (!(*it1)->downloaded) {
+            DownloadFile(*it1);
+        }
+        // A prefetched member is handed out once, later requests fetch it again
+        (*it1)->downloaded = false;
     }
 
     return (current_entry);
@@ -1213,105 +1523,142 @@ bool Cloud::CloudWriter::shouldWrite(const std::string&, const Base::Persistence
     return true;
 }
 
-void Cloud::CloudWriter::pushCloud(const char* FileName, const char* data, long size)
+bool Cloud::CloudWriter::isUnchanged(const std::string& FileName, const std::string& data) const
 {
-    struct Cloud::AmzData* RequestData;
-    struct Cloud::AmzDatav4* RequestDatav4;
-    CURL* curl;
-    CURLcode res;
-    struct data_buffer curl_buffer;
-
-    char path[1024];
-    sprintf(path, "/%s/%s", this->Bucket, FileName);
-
-    std::string strURL(this->URL);
-    eraseSubStr(strURL, "http://");
-    eraseSubStr(strURL, "https://");
-    if (this->ProtocolVersion == "2") {
-        RequestData = Cloud::ComputeDigestAmzS3v2("PUT",
-                                                  "application/octet-stream",
-                                                  path,
-                                                  this->TokenSecret,
-                                                  data,
-                                                  size);
-    }
-    else {
-        RequestDatav4 = Cloud::ComputeDigestAmzS3v4("PUT",
-                                                    strURL.c_str(),
-                                                    "application/octet-stream",
-                                                    path,
-                                                    this->TokenSecret,
-                                                    data,
-                                                    size,
-                                                    nullptr,
-                                                    this->Region);
+    auto it = RemoteETags.find(FileName);
+    if (it == RemoteETags.end()) {
+        return false;
     }
+    // The ETag of an object stored with a single request is the MD5 of its content
+    unsigned char result[MD5_DIGEST_LENGTH];
+    MD5((const unsigned char*)data.data(), data.size(), result);
+    return it->second == getHexValue(result, MD5_DIGEST_LENGTH);
+}
 
-    // Let's build the Header and call to curl
-    curl_global_init(CURL_GLOBAL_ALL);
-    curl = curl_easy_init();
-#ifdef ALLOW_SELF_SIGNED_CERTIFICATE
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0);
-#endif
-    if (curl) {
-        struct curl_slist* chunk = nullptr;
-        char URL[256];
-        // Let's build our own header
-        std::string strURL(this->URL);
-        eraseSubStr(strURL, "http://");
-        eraseSubStr(strURL, "https://");
-        if (this->ProtocolVersion == "2") {
-            chunk = Cloud::BuildHeaderAmzS3v2(strURL.c_str(),
-                                              this->TCPPort,
-                                              this->TokenAuth,
-                                              RequestData);
-            delete RequestData;
+void Cloud::CloudWriter::pushCloud(const char* FileName, const char* data, long size)
+{
+    pushCloudFiles({{std::string(FileName), std::string(data, size)}});
+}
+
+void Cloud::CloudWriter::pushCloudFiles(
+    const std::vector<std::pair<std::string, std::string>>& Files)
+{
+    const Endpoint endpoint {URL, TCPPort, TokenAuth, TokenSecret, Bucket, ProtocolVersion, Region};
+    TransferQueue queue;
+
+    // Large members go through a multipart upload, which needs an upload id first
+    std::vector<const std::pair<std::string, std::string>*> single;
+    std::vector<const std::pair<std::string, std::string>*> multipart;
+    std::vector<std::unique_ptr<Transfer>> initiations;
+    for (const auto& file : Files) {
+        if (isUnchanged(file.first, file.second)) {
+            continue;
         }
-        else {
-            chunk = Cloud::BuildHeaderAmzS3v4(strURL.c_str(), this->TokenAuth, RequestDatav4);
-            delete RequestDatav4;
+        if (file.second.size() < MultipartThreshold) {
+            single.push_back(&file);
+            continue;
         }
-
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk);
-
-        // Lets build the URL for our Curl call
-
-        sprintf(URL, "%s:%s/%s/%s", this->URL, this->TCPPort, this->Bucket, FileName);
-        curl_easy_setopt(curl, CURLOPT_URL, URL);
-
-        curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
-        curl_easy_setopt(curl, CURLOPT_PUT, 1L);
-        // curl read a file not a memory buffer (it shall be able to do it)
-        curl_easy_setopt(curl, CURLOPT_READFUNCTION, read_callback);
-        curl_buffer.ptr = data;
-        curl_buffer.remaining_size = (size_t)size;
-
-        curl_easy_setopt(curl, CURLOPT_READDATA, &curl_buffer);
-
-        curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)size);
-
-
-        res = curl_easy_perform(curl);
-        if (res != CURLE_OK) {
-            fprintf(stderr, "curl_easy_perform() failed: %s\n", curl_easy_strerror(res));
+        multipart.push_back(&file);
+        initiations.push_back(createTransfer(endpoint,
+                                             "POST",
+                                             "application/octet-stream",
+                                             file.first,
+                                             "uploads",
+                                             nullptr,
+                                             0));
+    }
+    queue.perform(initiations);
+
+    std::vector<std::string> uploadIds(multipart.size());
+    std::vector<std::vector<Transfer*>> parts(multipart.size());
+    std::vector<std::unique_ptr<Transfer>> transfers;
+    for (size_t i = 0; i < multipart.size(); ++i) {
+        std::string id = getUploadId(*initiations[i]);
+        if (id.empty()) {
+            // The server refused the multipart upload, send it in one go instead
+            single.push_back(multipart[i]);
+            continue;
+        }
+        char* escaped = curl_easy_escape(nullptr, id.c_str(), 0);
+        uploadIds[i] = escaped;
+        curl_free(escaped);
+
+        const std::string& data = multipart[i]->second;
+        size_t number = 1;
+        for (size_t offset = 0; offset < data.size(); offset += MultipartPartSize, ++number) {
+            std::string query =
+                "partNumber=" + std::to_string(number) + "&uploadId=" + uploadIds[i];
+            transfers.push_back(createTransfer(endpoint,
+                                               "PUT",
+                                               "application/octet-stream",
+                                               multipart[i]->first,
+                                               query,
+                                               data.data() + offset,
+                                               std::min(MultipartPartSize, data.size() - offset)));
+            parts[i].push_back(transfers.back().get());
         }
-        curl_easy_cleanup(curl);
     }
+    for (auto file : single) {
+        transfers.push_back(createTransfer(endpoint,
+                                           "PUT",
+                                           "application/octet-stream",
+                                           file->first,
+                                           std::string(),
+                                           file->second.data(),
+                                           file->second.size()));
+    }
+    queue.perform(transfers);
+
+    std::vector<std::string> manifests(multipart.size());
+    std::vector<std::unique_ptr<Transfer>> completions;
+    for (size_t i = 0; i < multipart.size(); ++i) {
+        if (uploadIds[i].empty()) {
+            continue;
+        }
+        std::string query = "uploadId=" + uploadIds[i];
+        bool uploaded = std::all_of(parts[i].begin(), parts[i].end(), [](const Transfer* part) {
+            return part->succeeded() && !part->etag.empty();
+        });
+        if (!uploaded) {
+            // Discard the parts stored so far
+            fprintf(stderr, "Multipart upload of %s failed\n", multipart[i]->first.c_str());
+            completions.push_back(createTransfer(endpoint,
+                                                 "DELETE",
+                                                 "application/octet-stream",
+                                                 multipart[i]->first,
+                                                 query,
+                                                 nullptr,
+                                                 0));
+            continue;
+        }
+        std::string& manifest = manifests[i];
+        manifest = "<CompleteMultipartUpload>";
+        for (size_t n = 0; n < parts[i].size(); ++n) {
+            manifest += "<Part><PartNumber>" + std::to_string(n + 1) + "</PartNumber><ETag>\""
+                + parts[i][n]->etag + "\"</ETag></Part>";
+        }
+        manifest += "</CompleteMultipartUpload>";
+        completions.push_back(createTransfer(endpoint,
+                                             "POST",
+                                             "application/xml",
+                                             multipart[i]->first,
+                                             query,
+                                             manifest.data(),
+                                             manifest.size()));
+    }
+    queue.perform(completions);
 }
 
 void Cloud::CloudWriter::writeFiles(void)
 {
     // use a while loop because it is possible that while
     // processing the files, new ones can be added
-    std::string tmp = "";
-    char* cstr;
+    // The members are collected first and then transferred concurrently
+    std::vector<std::pair<std::string, std::string>> files;
     size_t index = 0;
     if (strlen(this->FileName.c_str()) > 1) {
         // We must push the current buffer
-        const std::string tmp = this->FileStream.str();
-        const char* cstr = tmp.data();
-        pushCloud((const char*)this->FileName.c_str(), cstr, tmp.size());
+        files.emplace_back(this->FileName, this->FileStream.str());
     }
     while (index < FileList.size()) {
         FileEntry entry = FileList.begin()[index];
@@ -1322,14 +1669,13 @@ void Cloud::CloudWriter::writeFiles(void)
             this->FileStream.setf(ios::fixed, ios::floatfield);
             this->FileStream.imbue(std::locale::classic());
             entry.Object->SaveDocFile(*this);
-            tmp = this->FileStream.str();
-            cstr = (char*)tmp.data();
-            pushCloud((const char*)entry.FileName.c_str(), (const char*)cstr, tmp.size());
+            files.emplace_back(entry.FileName, this->FileStream.str());
             this->FileStream.str("");
         }
 
         index++;
     }
+    pushCloudFiles(files);
 }
 
 
@@ -1505,6 +1851,13 @@ bool Cloud::Module::cloudRestore(const char* BucketName)
 
     doc->signalRestoreDocument(reader);
 
+    // Fetch the members up front, so that they are transferred concurrently
+    std::vector<std::string> FileNames;
+    for (const auto& entry : reader.FileList) {
+        FileNames.push_back(entry.FileName);
+    }
+    myreader.DownloadFiles(FileNames);
+
     readFiles(myreader, &reader);
 
     // reset all touched
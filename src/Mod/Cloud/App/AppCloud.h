@@ -20,6 +20,10 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <App/Document.h>
 
 #include <Base/Base64.h>
@@ -112,6 +116,7 @@ public:
         char FileName[1024];
         std::stringstream FileStream;
         int touch = 0;
+        bool downloaded = false;
     };
     void checkText(XERCES_CPP_NAMESPACE_QUALIFIER DOMText* text);
     void checkXML(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* node);
@@ -119,6 +124,8 @@ public:
     void addFile(struct Cloud::CloudReader::FileEntry* new_entry);
     struct FileEntry* GetEntry(std::string FileName);
     void DownloadFile(Cloud::CloudReader::FileEntry* entry);
+    /// Concurrently fetches the listed members ahead of GetEntry()
+    void DownloadFiles(const std::vector<std::string>& FileNames);
     int isTouched(std::string FileName);
 
 protected:
@@ -208,6 +215,8 @@ class CloudAppExport CloudWriter: public Base::Writer
 {
 public:
     int print = 0;
+    int key = 0;
+    int etag = 0;
     char errorCode[1024] = "";
     CloudWriter(const char* URL,
                 const char* TokenAuth,
@@ -218,6 +227,9 @@ public:
                 std::string Region);
     virtual ~CloudWriter();
     void pushCloud(const char* FileName, const char* data, long size);
+    /// Uploads the members concurrently, skipping those whose remote ETag matches
+    void pushCloudFiles(const std::vector<std::pair<std::string, std::string>>& Files);
+    bool isUnchanged(const std::string& FileName, const std::string& data) const;
     void putNextEntry(const char* file);
     void createBucket();
     virtual void writeFiles(void);
@@ -241,6 +253,8 @@ protected:
     std::string ProtocolVersion;
     std::string Region;
     std::stringstream FileStream;
+    std::string lastKey;
+    std::map<std::string, std::string> RemoteETags;
 };
 
 
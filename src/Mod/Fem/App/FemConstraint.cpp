@@ -25,6 +25,7 @@
 
 #ifndef _PreComp_
 #include <limits>
+#include <map>
 #include <Adaptor3d_IsoCurve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepAdaptor_Curve.hxx>
@@ -192,9 +193,9 @@ void Constraint::onChanged(const App::Property* prop)
         std::vector<Base::Vector3d> points;
         std::vector<Base::Vector3d> normals;
         if (getPoints(points, normals, &sizeFactor)) {
-            Points.setValues(points);
+            // Points go last, the view providers rebuild the symbols on their change
             Normals.setValues(normals);
-            Points.touch();
+            Points.setValues(points);
         }
     }
 
@@ -260,6 +261,8 @@ bool Constraint::getPoints(std::vector<Base::Vector3d>& points,
 
     // Extract geometry from References
     TopoDS_Shape sh;
+    // Bounding box extents by object, faces of one solid are usually referenced together
+    std::map<const Part::Feature*, double> extents;
 
     for (std::size_t i = 0; i < Objects.size(); i++) {
         Part::Feature* feat = static_cast<Part::Feature*>(Objects[i]);
@@ -269,9 +272,13 @@ bool Constraint::getPoints(std::vector<Base::Vector3d>& points,
         }
 
         // Scale by bounding box of the object
-        Bnd_Box box;
-        BRepBndLib::Add(feat->Shape.getShape().getShape(), box);
-        double l = sqrt(box.SquareExtent() / 3.0);
+        auto it = extents.find(feat);
+        if (it == extents.end()) {
+            Bnd_Box box;
+            BRepBndLib::Add(feat->Shape.getShape().getShape(), box);
+            it = extents.emplace(feat, sqrt(box.SquareExtent() / 3.0)).first;
+        }
+        double l = it->second;
         *scale = this->calcSizeFactor(l);
 
         if (sh.ShapeType() == TopAbs_VERTEX) {
@@ -24,7 +24,10 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <charconv>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 
 #include <BRepBndLib.hxx>
@@ -84,6 +87,117 @@ using namespace boost;
 
 SMESH_Gen* FemMesh::_mesh_gen = nullptr;
 
+/* A regular grid over the transformed node positions. Only the nodes of the cells
+ * that intersect a bounding box need to be checked by the getNodesBy* methods.
+ */
+class FemMesh::NodeIndex
+{
+public:
+    NodeIndex(const SMESHDS_Mesh* mesh, const Base::Matrix4D& mat)
+        : transform(mat)
+        , numNodes(mesh->NbNodes())
+    {
+        std::vector<const SMDS_MeshNode*> all;
+        all.reserve(numNodes);
+        SMDS_NodeIteratorPtr aNodeIter = mesh->nodesIterator();
+        while (aNodeIter->more()) {
+            const SMDS_MeshNode* aNode = aNodeIter->next();
+            all.push_back(aNode);
+            box.Add(position(aNode));
+        }
+        if (all.empty()) {
+            return;
+        }
+
+        // about four nodes per cell, distributed according to the extent of the box
+        Base::Vector3d size(box.LengthX(), box.LengthY(), box.LengthZ());
+        double maxSize = std::max({size.x, size.y, size.z, 1e-12});
+        double cellSize = std::max(
+            std::cbrt(std::max(size.x, maxSize * 1e-3) * std::max(size.y, maxSize * 1e-3)
+                      * std::max(size.z, maxSize * 1e-3) * 4.0 / double(all.size())),
+            maxSize * 1e-4);
+        for (int i = 0; i < 3; i++) {
+            dims[i] = std::max(1, std::min(int(size[i] / cellSize) + 1, 1024));
+            scale[i] = double(dims[i]) / std::max(size[i], 1e-12);
+        }
+
+        // counting sort of the nodes by their cell
+        std::vector<size_t> cellOfNode(all.size());
+        cellStart.assign(size_t(dims[0]) * dims[1] * dims[2] + 1, 0);
+        for (size_t i = 0; i < all.size(); i++) {
+            int cell[3];
+            cellOf(position(all[i]), cell);
+            cellOfNode[i] = (size_t(cell[0]) * dims[1] + cell[1]) * dims[2] + cell[2];
+            cellStart[cellOfNode[i] + 1]++;
+        }
+        for (size_t i = 1; i < cellStart.size(); i++) {
+            cellStart[i] += cellStart[i - 1];
+        }
+        nodes.resize(all.size());
+        std::vector<size_t> fill(cellStart.begin(), cellStart.end() - 1);
+        for (size_t i = 0; i < all.size(); i++) {
+            nodes[fill[cellOfNode[i]]++] = all[i];
+        }
+    }
+
+    bool isValid(const SMESHDS_Mesh* mesh, const Base::Matrix4D& mat) const
+    {
+        return transform == mat && numNodes == mesh->NbNodes();
+    }
+
+    Base::Vector3d position(const SMDS_MeshNode* node) const
+    {
+        return transform * Base::Vector3d(node->X(), node->Y(), node->Z());
+    }
+
+    /// The nodes of all cells intersecting \a bndBox
+    std::vector<const SMDS_MeshNode*> query(const Bnd_Box& bndBox) const
+    {
+        std::vector<const SMDS_MeshNode*> result;
+        if (nodes.empty() || bndBox.IsVoid()) {
+            return result;
+        }
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bndBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        Base::BoundBox3d query(xMin, yMin, zMin, xMax, yMax, zMax);
+        if (!query.Intersect(box)) {
+            return result;
+        }
+
+        int first[3], last[3];
+        cellOf(Base::Vector3d(xMin, yMin, zMin), first);
+        cellOf(Base::Vector3d(xMax, yMax, zMax), last);
+        for (int x = first[0]; x <= last[0]; x++) {
+            for (int y = first[1]; y <= last[1]; y++) {
+                size_t row = (size_t(x) * dims[1] + y) * dims[2];
+                result.insert(result.end(),
+                              nodes.begin() + cellStart[row + first[2]],
+                              nodes.begin() + cellStart[row + last[2] + 1]);
+            }
+        }
+        return result;
+    }
+
+private:
+    void cellOf(const Base::Vector3d& pnt, int cell[3]) const
+    {
+        double offset[3] = {pnt.x - box.MinX, pnt.y - box.MinY, pnt.z - box.MinZ};
+        for (int i = 0; i < 3; i++) {
+            double pos = offset[i] * scale[i];
+            cell[i] = int(std::clamp(pos, 0.0, double(dims[i] - 1)));
+        }
+    }
+
+    Base::Matrix4D transform;
+    int numNodes;
+    Base::BoundBox3d box;
+    int dims[3] = {1, 1, 1};
+    double scale[3] = {1.0, 1.0, 1.0};
+    // the nodes of cell i are nodes[cellStart[i]] .. nodes[cellStart[i + 1] - 1]
+    std::vector<size_t> cellStart;
+    std::vector<const SMDS_MeshNode*> nodes;
+};
+
 TYPESYSTEM_SOURCE(Fem::FemMesh, Base::Persistence)
 
 FemMesh::FemMesh()
@@ -141,6 +255,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    invalidateNodeIndex();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -273,9 +388,27 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may change the nodes
+    invalidateNodeIndex();
     return myMesh;
 }
 
+const FemMesh::NodeIndex& FemMesh::getNodeIndex() const
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    if (!nodeIndex || !nodeIndex->isValid(data, _Mtrx)) {
+        nodeIndex = std::make_unique<NodeIndex>(data, _Mtrx);
+    }
+    return *nodeIndex;
+}
+
+void FemMesh::invalidateNodeIndex()
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    nodeIndex.reset();
+}
+
 SMESH_Gen* FemMesh::getGenerator()
 {
     if (!FemMesh::_mesh_gen) {
@@ -332,6 +465,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    invalidateNodeIndex();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -561,10 +695,56 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+std::set<int> FemMesh::getNodesByShape(const TopoDS_Shape& shape,
+                                       Bnd_Box box,
+                                       double limit) const
 {
     std::set<int> result;
 
+    // only the nodes near the bounding box can be inside the limit
+    const NodeIndex& index = getNodeIndex();
+    std::vector<const SMDS_MeshNode*> nodes = index.query(box);
+
+#pragma omp parallel
+    {
+        // every thread loads the shape once instead of once per node
+        BRepExtrema_DistShapeShape measure;
+        measure.LoadS1(shape);
+        std::vector<int> found;
+
+#pragma omp for schedule(dynamic, 64)
+        for (long i = 0; i < long(nodes.size()); ++i) {
+            const SMDS_MeshNode* aNode = nodes[i];
+            // Apply the matrix to hold the BoundBox in absolute space.
+            Base::Vector3d vec = index.position(aNode);
+
+            if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
+                // create a vertex
+                BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
+                measure.LoadS2(aBuilder.Vertex());
+                // measure distance
+                measure.Perform();
+                if (!measure.IsDone() || measure.NbSolution() < 1) {
+                    continue;
+                }
+
+                if (measure.Value() < limit) {
+                    found.push_back(aNode->GetID());
+                }
+            }
+        }
+
+#pragma omp critical
+        {
+            result.insert(found.begin(), found.end());
+        }
+    }
+
+    return result;
+}
+
+std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+{
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
 
@@ -576,50 +756,11 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
                         limit,
                         limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-    return result;
+    return getNodesByShape(solid, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -629,96 +770,18 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesByShape(face, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesByShape(edge, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
@@ -726,31 +789,17 @@ std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
     std::set<int> result;
 
     double limit = BRep_Tool::Tolerance(vertex);
-    limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
     Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
+    Bnd_Box box;
+    box.Add(pnt);
+    box.Enlarge(limit);
+    limit *= limit;  // use square to improve speed
 
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
+    const NodeIndex& index = getNodeIndex();
+    for (const SMDS_MeshNode* aNode : index.query(box)) {
+        if (Base::DistanceP2(node, index.position(aNode)) <= limit) {
             result.insert(aNode->GetID());
         }
     }
@@ -1603,6 +1652,7 @@ void FemMesh::readZ88(const std::string& FileName)
 
 void FemMesh::read(const char* FileName)
 {
+    invalidateNodeIndex();
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
 
@@ -1658,12 +1708,98 @@ void FemMesh::writeVTK(const std::string& fileName, bool highest) const
 #endif
 }
 
+namespace
+{
+
+void appendNumber(std::string& str, int value)
+{
+    char buf[16];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    str.append(buf, result.ptr);
+}
+
+// the same as an ostream with precision 13 writes
+void appendNumber(std::string& str, double value)
+{
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, 13);
+    str.append(buf, result.ptr);
+}
+
+// Formats the lines [0, count) with format(index, str) into buffers in parallel and
+// writes the buffers in order. The buffers of only a few chunks are kept at a time.
+template<typename Format>
+void writeLines(std::ostream& out, std::size_t count, Format format)
+{
+    constexpr std::size_t linesPerChunk = 16384;
+    constexpr std::size_t chunksPerBatch = 64;
+    std::vector<std::string> buffers(chunksPerBatch);
+
+    for (std::size_t batchStart = 0; batchStart < count;
+         batchStart += linesPerChunk * chunksPerBatch) {
+        const std::size_t batchEnd = std::min(count, batchStart + linesPerChunk * chunksPerBatch);
+        const int numChunks = int((batchEnd - batchStart + linesPerChunk - 1) / linesPerChunk);
+#pragma omp parallel for schedule(dynamic, 1)
+        for (int chunk = 0; chunk < numChunks; chunk++) {
+            std::string& buffer = buffers[chunk];
+            buffer.clear();
+            const std::size_t first = batchStart + chunk * linesPerChunk;
+            const std::size_t last = std::min(batchEnd, first + linesPerChunk);
+            for (std::size_t i = first; i < last; i++) {
+                format(i, buffer);
+            }
+        }
+        for (int chunk = 0; chunk < numChunks; chunk++) {
+            out.write(buffers[chunk].data(), std::streamsize(buffers[chunk].size()));
+        }
+    }
+}
+
+// Writes one element line per element of the map
+void writeElementLines(std::ostream& out, const std::map<int, std::vector<int>>& elements)
+{
+    std::vector<const std::pair<const int, std::vector<int>>*> lines;
+    lines.reserve(elements.size());
+    for (const auto& it : elements) {
+        lines.push_back(&it);
+    }
+
+    writeLines(out, lines.size(), [&lines](std::size_t index, std::string& str) {
+        const auto& element = *lines[index];
+        appendNumber(str, element.first);
+        // Calculix allows max 16 entries in one line, a hexa20 has more !
+        for (std::size_t i = 0; i < element.second.size(); i++) {
+            str += (i == 15) ? ",\n" : ", ";
+            appendNumber(str, element.second[i]);
+        }
+        str += '\n';
+    });
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(const std::string& Filename,
                           int elemParam,
                           bool groupParam,
                           ABAQUS_VolumeVariant volVariant,
                           ABAQUS_FaceVariant faceVariant,
                           ABAQUS_EdgeVariant edgeVariant) const
+{
+    // write all data to file
+    // take also care of special characters in path
+    // https://forum.freecad.org/viewtopic.php?f=10&t=37436
+    Base::FileInfo fi(Filename);
+    Base::ofstream anABAQUS_Output(fi);
+    writeABAQUS(anABAQUS_Output, elemParam, groupParam, volVariant, faceVariant, edgeVariant);
+    anABAQUS_Output.close();
+}
+
+void FemMesh::writeABAQUS(std::ostream& anABAQUS_Output,
+                          int elemParam,
+                          bool groupParam,
+                          ABAQUS_VolumeVariant volVariant,
+                          ABAQUS_FaceVariant faceVariant,
+                          ABAQUS_EdgeVariant edgeVariant) const
 {
     /*
      * elemParam:
@@ -2004,11 +2140,6 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         }
     }
 
-    // write all data to file
-    // take also care of special characters in path
-    // https://forum.freecad.org/viewtopic.php?f=10&t=37436
-    Base::FileInfo fi(Filename);
-    Base::ofstream anABAQUS_Output(fi);
     // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
     anABAQUS_Output.precision(13);
 
@@ -2030,7 +2161,6 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             break;
         default:
             anABAQUS_Output << "** Problem on writing" << std::endl;
-            anABAQUS_Output.close();
             throw std::runtime_error(
                 "Unknown ABAQUS element choice parameter, [0|1|2] are allowed.");
     }
@@ -2064,10 +2194,22 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
     // This way we get sorted output.
     // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
+    std::vector<const VertexMap::value_type*> vertices;
+    vertices.reserve(vertexMap.size());
     for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
+        vertices.push_back(&it);
+    }
+    writeLines(anABAQUS_Output, vertices.size(), [&vertices](std::size_t index, std::string& str) {
+        const VertexMap::value_type& vertex = *vertices[index];
+        appendNumber(str, vertex.first);
+        str += ", ";
+        appendNumber(str, vertex.second.x);
+        str += ", ";
+        appendNumber(str, vertex.second.y);
+        str += ", ";
+        appendNumber(str, vertex.second.z);
+        str += '\n';
+    });
     anABAQUS_Output << std::endl << std::endl;
     ;
 
@@ -2078,27 +2220,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapVol) {
             anABAQUS_Output << "** Volume elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElementLines(anABAQUS_Output, it.second);
         }
         elsetname += "Evolumes";
         anABAQUS_Output << std::endl;
@@ -2109,13 +2231,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapFac) {
             anABAQUS_Output << "** Face elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElementLines(anABAQUS_Output, it.second);
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2131,13 +2247,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapEdg) {
             anABAQUS_Output << "** Edge elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElementLines(anABAQUS_Output, it.second);
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2154,10 +2264,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     anABAQUS_Output << elsetname << std::endl;
 
     // groups
-    if (!groupParam) {
-        anABAQUS_Output.close();
-    }
-    else {
+    if (groupParam) {
         // get and write group data
         anABAQUS_Output << std::endl << "** Group data" << std::endl;
 
@@ -2220,7 +2327,6 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             // write newline after each group
             anABAQUS_Output << std::endl;
         }
-        anABAQUS_Output.close();
     }
 }
 
@@ -2307,7 +2413,23 @@ void FemMesh::write(const char* FileName) const
 
 unsigned int FemMesh::getMemSize() const
 {
-    return 0;
+    // nodes carry their coordinates, the cells their connectivity
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    std::size_t size = sizeof(FemMesh) + sizeof(SMESH_Mesh) + sizeof(SMESHDS_Mesh);
+    std::size_t nodes = data->NbNodes();
+    size += nodes * (sizeof(SMDS_MeshNode) + 3 * sizeof(double));
+    SMDS_ElemIteratorPtr it = data->elementsIterator();
+    while (it->more()) {
+        const SMDS_MeshElement* elem = it->next();
+        size += sizeof(SMDS_MeshElement) + elem->NbNodes() * sizeof(SMDS_MeshNode*);
+    }
+    for (const auto& group : myMesh->GetGroupIds()) {
+        if (const SMESH_Group* grp = myMesh->GetGroup(group)) {
+            size += grp->GetGroupDS()->Extent() * sizeof(SMDS_MeshElement*);
+        }
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void FemMesh::Save(Base::Writer& writer) const
@@ -2403,6 +2525,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    invalidateNodeIndex();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2412,6 +2535,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    invalidateNodeIndex();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
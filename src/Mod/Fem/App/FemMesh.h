@@ -23,8 +23,10 @@
 #ifndef FEM_FEMMESH_H
 #define FEM_FEMMESH_H
 
+#include <iosfwd>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <SMDSAbs_ElementType.hxx>
@@ -35,6 +37,7 @@
 #include <Mod/Fem/FemGlobal.h>
 
 
+class Bnd_Box;
 class SMESH_Gen;
 class SMESH_Mesh;
 class SMESH_Hypothesis;
@@ -210,10 +213,22 @@ public:
                      ABAQUS_VolumeVariant volVariant = ABAQUS_VolumeVariant::Standard,
                      ABAQUS_FaceVariant faceVariant = ABAQUS_FaceVariant::Shell,
                      ABAQUS_EdgeVariant edgeVariant = ABAQUS_EdgeVariant::Beam) const;
+    /// Writes the inp data to a stream, e.g. to pass it directly to a solver process
+    void writeABAQUS(std::ostream& out,
+                     int elemParam,
+                     bool groupParam,
+                     ABAQUS_VolumeVariant volVariant = ABAQUS_VolumeVariant::Standard,
+                     ABAQUS_FaceVariant faceVariant = ABAQUS_FaceVariant::Shell,
+                     ABAQUS_EdgeVariant edgeVariant = ABAQUS_EdgeVariant::Beam) const;
     void writeVTK(const std::string& FileName, bool highest = true) const;
     void writeZ88(const std::string& FileName) const;
 
 private:
+    class NodeIndex;
+    /// the nodes grouped by their position, built on first use
+    const NodeIndex& getNodeIndex() const;
+    void invalidateNodeIndex();
+    std::set<int> getNodesByShape(const TopoDS_Shape& shape, Bnd_Box box, double limit) const;
     void copyMeshData(const FemMesh&);
     void readNastran(const std::string& Filename);
     void readNastran95(const std::string& Filename);
@@ -230,6 +245,9 @@ private:
 
     std::list<SMESH_HypothesisPtr> hypoth;
     static SMESH_Gen* _mesh_gen;
+
+    mutable std::unique_ptr<NodeIndex> nodeIndex;
+    mutable std::mutex nodeIndexMutex;
 };
 
 
@@ -27,6 +27,8 @@
 #include <Python.h>
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 #ifdef FCWithNetgen
 #include <NETGENPlugin_Hypothesis.hxx>
@@ -34,6 +36,11 @@
 #endif
 #endif
 
+#if defined(FCWithNetgen) && NETGEN_VERSION >= NETGEN_VERSION_STRING(6, 2, 2204)
+#include <core/taskmanager.hpp>
+#define FC_NETGEN_PARALLEL_MESHING
+#endif
+
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -76,6 +83,11 @@ FemMeshShapeNetgenObject::FemMeshShapeNetgenObject()
         Prop_None,
         "allows defining the minimum number of mesh segments in which radii will be split");
     ADD_PROPERTY_TYPE(Optimize, (true), "MeshParams", Prop_None, "Optimize the resulting mesh");
+    ADD_PROPERTY_TYPE(ParallelMeshing,
+                      (true),
+                      "MeshParams",
+                      Prop_None,
+                      "Mesh the volumes of a shape with several solids in parallel");
 }
 
 FemMeshShapeNetgenObject::~FemMeshShapeNetgenObject() = default;
@@ -113,7 +125,28 @@ App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
     myNetGenMesher.SetParameters(tet);
     newMesh.getSMesh()->ShapeToMesh(shape);
 
+#ifdef FC_NETGEN_PARALLEL_MESHING
+    // Netgen keeps its parameters in globals, so several meshers can't run in
+    // parallel. Instead let netgen mesh the volume domains concurrently on its
+    // task manager. The surface mesh is created beforehand, so faces shared by
+    // two solids stay conformal.
+    TopTools_IndexedMapOfShape solids;
+    TopExp::MapShapes(shape, TopAbs_SOLID, solids);
+    int numThreads = 0;
+    if (ParallelMeshing.getValue() && solids.Extent() > 1) {
+        numThreads = ngcore::EnterTaskManager();
+    }
+    try {
+        myNetGenMesher.Compute();
+    }
+    catch (...) {
+        ngcore::ExitTaskManager(numThreads);
+        throw;
+    }
+    ngcore::ExitTaskManager(numThreads);
+#else
     myNetGenMesher.Compute();
+#endif
 
     SMESHDS_Mesh* data = const_cast<SMESH_Mesh*>(newMesh.getSMesh())->GetMeshDS();
     const SMDS_MeshInfo& info = data->GetMeshInfo();
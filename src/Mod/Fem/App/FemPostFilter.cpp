@@ -213,7 +213,18 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             output->Update();
         }
 
-        Data.setValue(output->GetOutputDataObject(0));
+        // VTK only reruns the stages that were modified since the last update. If none
+        // of them was, the data is up to date and the view providers don't need to rebuild.
+        vtkDataObject* data = output->GetOutputDataObject(0);
+        if (data && data == m_lastOutput && data->GetUpdateTime() == m_lastOutputTime
+            && Data.getValue()) {
+            return StdReturn;
+        }
+        m_lastOutput = data;
+        m_lastOutputTime = data ? data->GetUpdateTime() : 0;
+
+        // the algorithms create new arrays on every execution, so sharing them is safe
+        Data.setValueShallow(data);
     }
     return StdReturn;
 }
@@ -36,6 +36,7 @@
 #include <vtkTableBasedClipDataSet.h>
 #include <vtkVectorNorm.h>
 #include <vtkWarpVector.h>
+#include <vtkWeakPointer.h>
 #include <vtkImplicitFunction.h>
 
 #include <App/PropertyUnits.h>
@@ -105,6 +106,10 @@ private:
     bool m_running_setup = false;
     TransformLocation m_transform_location = TransformLocation::output;
 
+    // the output handed to Data the last time, unchanged outputs are not copied again
+    vtkWeakPointer<vtkDataObject> m_lastOutput;
+    vtkMTimeType m_lastOutputTime = 0;
+
     void pipelineChanged();  // inform parents that the pipeline changed
 };
 
@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <cmath>
+#include <limits>
 #include <Python.h>
 #include <vtkAppendFilter.h>
 #include <vtkDataSetReader.h>
@@ -77,6 +78,7 @@ FemFrameSourceAlgorithm::FemFrameSourceAlgorithm::~FemFrameSourceAlgorithm()
 void FemFrameSourceAlgorithm::setDataObject(vtkSmartPointer<vtkDataObject> data)
 {
     m_data = data;
+    m_frames = readFrameValues();
     Modified();
     Update();
 }
@@ -86,7 +88,12 @@ bool FemFrameSourceAlgorithm::isValid()
     return m_data.GetPointer() != nullptr;
 }
 
-std::vector<double> FemFrameSourceAlgorithm::getFrameValues()
+const std::vector<double>& FemFrameSourceAlgorithm::getFrameValues() const
+{
+    return m_frames;
+}
+
+std::vector<double> FemFrameSourceAlgorithm::readFrameValues()
 {
 
     // check if we have frame data
@@ -122,6 +129,22 @@ std::vector<double> FemFrameSourceAlgorithm::getFrameValues()
     return tFrames;
 }
 
+unsigned long FemFrameSourceAlgorithm::findFrame(double time)
+{
+    // we have float values, so be aware of rounding errors. Use the frame closest to the
+    // searched time
+    unsigned long idx = 0;
+    double distance = std::numeric_limits<double>::max();
+    for (unsigned long i = 0; i < m_frames.size(); ++i) {
+        double d = std::abs(m_frames[i] - time);
+        if (d < distance) {
+            distance = d;
+            idx = i;
+        }
+    }
+    return idx;
+}
+
 int FemFrameSourceAlgorithm::RequestInformation(vtkInformation* reqInfo,
                                                 vtkInformationVector** inVector,
                                                 vtkInformationVector* outVector)
@@ -137,19 +160,17 @@ int FemFrameSourceAlgorithm::RequestInformation(vtkInformation* reqInfo,
         return 1;
     }
 
-    std::vector<double> frames = getFrameValues();
-
-    if (frames.empty()) {
+    if (m_frames.empty()) {
         // no frames, default info is sufficient
         return 1;
     }
 
-    double tRange[2] = {frames.front(), frames.back()};
+    double tRange[2] = {m_frames.front(), m_frames.back()};
 
     // finally set the time info!
     vtkInformation* info = outVector->GetInformationObject(0);
     info->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), tRange, 2);
-    info->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), &frames[0], frames.size());
+    info->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), m_frames.data(), m_frames.size());
     info->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
 
     return 1;
@@ -179,20 +200,10 @@ int FemFrameSourceAlgorithm::RequestData(vtkInformation*,
     }
 
     vtkSmartPointer<vtkMultiBlockDataSet> multiblock = vtkMultiBlockDataSet::SafeDownCast(m_data);
-    // find the block asked for (lazy implementation)
+    // find the block asked for
     unsigned long idx = 0;
     if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())) {
-        auto time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
-        auto frames = getFrameValues();
-
-        // we have float values, so be aware of rounding errors. lets subtract the searched time and
-        // then use the smallest value
-        for (auto& frame : frames) {
-            frame = std::abs(frame - time);
-        }
-
-        auto it = std::ranges::min_element(frames);
-        idx = std::distance(frames.begin(), it);
+        idx = findFrame(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()));
     }
 
     auto block = multiblock->GetBlock(idx);
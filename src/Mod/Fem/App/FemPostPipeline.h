@@ -51,13 +51,18 @@ public:
 
     bool isValid();
     void setDataObject(vtkSmartPointer<vtkDataObject> data);
-    std::vector<double> getFrameValues();
+    const std::vector<double>& getFrameValues() const;
 
 protected:
     FemFrameSourceAlgorithm();
     ~FemFrameSourceAlgorithm() override;
 
     vtkSmartPointer<vtkDataObject> m_data;
+    // time values of the frames, read once when the data is set
+    std::vector<double> m_frames;
+
+    std::vector<double> readFrameValues();
+    unsigned long findFrame(double time);
 
     int RequestInformation(vtkInformation* reqInfo,
                            vtkInformationVector** inVector,
@@ -25,6 +25,7 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstdlib>
@@ -127,15 +128,15 @@ void fillVtkArray(vtkSmartPointer<vtkCellArray>& elemArray, std::vector<int>& ty
     types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
 }
 
-// Helper function to fill SMDS_Mesh elements ID from vtk cell
-void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
+// the largest supported cell is the hexa20
+constexpr int maxCellNodes = 20;
+
+// Helper function to fill SMDS_Mesh elements ID from the point ids of a vtk cell
+void fillMeshElementIds(VTKCellType cellType, vtkIdList* pointIds, int* ids)
 {
-    VTKCellType cellType = static_cast<VTKCellType>(cell->GetCellType());
     const std::vector<int>& order = SMDS_MeshCell::fromVtkOrder(cellType);
-    vtkIdType* vtkIds = cell->GetPointIds()->GetPointer(0);
-    ids.clear();
-    int nbPoints = cell->GetNumberOfPoints();
-    ids.resize(nbPoints);
+    vtkIdType* vtkIds = pointIds->GetPointer(0);
+    int nbPoints = std::min<int>(pointIds->GetNumberOfIds(), maxCellNodes);
     if (!order.empty()) {
         for (int i = 0; i < nbPoints; ++i) {
             ids[i] = vtkIds[order[i]] + 1;
@@ -148,6 +149,25 @@ void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
     }
 }
 
+// Copies the first nTuples tuples of a vtk array, for the common array types without
+// calling GetTuple() for every value
+void copyArrayValues(vtkDataArray* array, vtkIdType nTuples, double* values)
+{
+    const int nComponents = array->GetNumberOfComponents();
+    const vtkIdType nValues = std::min(nTuples, array->GetNumberOfTuples()) * nComponents;
+    if (auto doubles = vtkDoubleArray::SafeDownCast(array)) {
+        std::copy_n(doubles->GetPointer(0), nValues, values);
+    }
+    else if (auto floats = vtkFloatArray::SafeDownCast(array)) {
+        std::copy_n(floats->GetPointer(0), nValues, values);
+    }
+    else {
+        for (vtkIdType i = 0; i < nValues / nComponents; i++) {
+            array->GetTuple(i, values + i * nComponents);
+        }
+    }
+}
+
 }  // namespace
 
 
@@ -162,17 +182,39 @@ void FemVTKTools::importVTKMesh(vtkSmartPointer<vtkDataSet> dataset, FemMesh* me
     SMESH_Mesh* smesh = mesh->getSMesh();
     SMESHDS_Mesh* meshds = smesh->GetMeshDS();
     meshds->ClearMesh();
+    meshds->getGrid()->GetPoints()->Allocate(nPoints);
 
     for (vtkIdType i = 0; i < nPoints; i++) {
-        double* p = dataset->GetPoint(i);
+        double p[3];
+        dataset->GetPoint(i, p);
         meshds->AddNodeWithID(p[0] * scale, p[1] * scale, p[2] * scale, i + 1);
     }
 
+    // Converting the connectivity doesn't touch the SMESH data structure and is done in
+    // parallel. The vtk accessors are thread safe once they have been called from a
+    // single thread.
+    std::vector<unsigned char> cellTypes(nCells);
+    std::vector<int> cellIds(nCells * maxCellNodes);
+    if (nCells > 0) {
+        vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+        dataset->GetCellPoints(0, pointIds);
+        dataset->GetCellType(0);
+    }
+#pragma omp parallel
+    {
+        vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+#pragma omp for schedule(static, 1024)
+        for (vtkIdType iCell = 0; iCell < nCells; iCell++) {
+            VTKCellType cellType = static_cast<VTKCellType>(dataset->GetCellType(iCell));
+            dataset->GetCellPoints(iCell, pointIds);
+            cellTypes[iCell] = static_cast<unsigned char>(cellType);
+            fillMeshElementIds(cellType, pointIds, &cellIds[iCell * maxCellNodes]);
+        }
+    }
+
     for (vtkIdType iCell = 0; iCell < nCells; iCell++) {
-        vtkCell* cell = dataset->GetCell(iCell);
-        std::vector<int> ids;
-        fillMeshElementIds(cell, ids);
-        switch (cell->GetCellType()) {
+        const int* ids = &cellIds[iCell * maxCellNodes];
+        switch (cellTypes[iCell]) {
             // 1D edges
             case VTK_LINE:  // seg2
                 meshds->AddEdgeWithID(ids[0], ids[1], iCell + 1);
@@ -814,10 +856,11 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
             App::PropertyVectorList* vector_list =
                 static_cast<App::PropertyVectorList*>(result->getPropertyByName(it.first.c_str()));
             if (vector_list) {
+                std::vector<double> values(nPoints * dim, 0.0);
+                copyArrayValues(vector_field, nPoints, values.data());
                 std::vector<Base::Vector3d> vec(nPoints);
                 for (vtkIdType i = 0; i < nPoints; ++i) {
-                    double* p = vector_field->GetTuple(
-                        i);  // both vtkFloatArray and vtkDoubleArray return double* for GetTuple(i)
+                    const double* p = &values[i * dim];
                     vec[i] = (Base::Vector3d(p[0], p[1], p[2]));
                 }
                 // PropertyVectorList will not show up in PropertyEditor
@@ -851,18 +894,8 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                 continue;
             }
 
-            double vmin = 1.0e100, vmax = -1.0e100;
             std::vector<double> values(nPoints, 0.0);
-            for (vtkIdType i = 0; i < vec->GetNumberOfTuples(); i++) {
-                double v = *(vec->GetTuple(i));
-                values[i] = v;
-                if (v > vmax) {
-                    vmax = v;
-                }
-                if (v < vmin) {
-                    vmin = v;
-                }
-            }
+            copyArrayValues(vec, nPoints, values.data());
             field->setValues(values);
             Base::Console().log("    A PropertyFloatList has been filled with vales: %s\n",
                                 scalar.first.c_str());
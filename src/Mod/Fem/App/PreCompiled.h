@@ -35,6 +35,7 @@
 // standard
 #include <algorithm>
 #include <bitset>
+#include <charconv>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -42,6 +43,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
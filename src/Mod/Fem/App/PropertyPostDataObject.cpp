@@ -118,6 +118,7 @@ void PropertyPostDataObject::scale(double s)
 {
     if (m_dataObject) {
         aboutToSetValue();
+        detach();
         scaleDataObject(m_dataObject, s);
         hasSetValue();
     }
@@ -138,6 +139,35 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     hasSetValue();
 }
 
+void PropertyPostDataObject::setValueShallow(const vtkSmartPointer<vtkDataObject>& ds)
+{
+    aboutToSetValue();
+
+    if (ds) {
+        createDataObjectByExternalType(ds);
+        m_dataObject->ShallowCopy(ds);
+        m_shared = true;
+    }
+    else {
+        m_dataObject = nullptr;
+    }
+
+    hasSetValue();
+}
+
+void PropertyPostDataObject::detach()
+{
+    if (!m_shared) {
+        return;
+    }
+
+    vtkSmartPointer<vtkDataObject> copy;
+    copy.TakeReference(m_dataObject->NewInstance());
+    copy->DeepCopy(m_dataObject);
+    m_dataObject = copy;
+    m_shared = false;
+}
+
 const vtkSmartPointer<vtkDataObject>& PropertyPostDataObject::getValue() const
 {
     return m_dataObject;
@@ -216,6 +246,7 @@ App::Property* PropertyPostDataObject::Copy() const
 
 void PropertyPostDataObject::createDataObjectByExternalType(vtkSmartPointer<vtkDataObject> ex)
 {
+    m_shared = false;
 
     switch (ex->GetDataObjectType()) {
 
@@ -253,6 +284,7 @@ void PropertyPostDataObject::Paste(const App::Property& from)
 {
     aboutToSetValue();
     m_dataObject = dynamic_cast<const PropertyPostDataObject&>(from).m_dataObject;
+    m_shared = static_cast<bool>(m_dataObject);
     hasSetValue();
 }
 
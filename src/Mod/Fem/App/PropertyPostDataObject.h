@@ -50,6 +50,11 @@ public:
     void scale(double s);
     /// set the dataset
     void setValue(const vtkSmartPointer<vtkDataObject>&);
+    /** Set the dataset without copying its arrays, they are shared with \a ds. This is
+     * meant for the output of VTK algorithms which don't modify the arrays they created
+     * in an earlier execution.
+     */
+    void setValueShallow(const vtkSmartPointer<vtkDataObject>&);
     /// get the part shape
     const vtkSmartPointer<vtkDataObject>& getValue() const;
     /// check if we hold a dataset or a dataobject (which would mean a composite data structure)
@@ -85,7 +90,10 @@ private:
 
 protected:
     void createDataObjectByExternalType(vtkSmartPointer<vtkDataObject> ex);
+    void detach();
     vtkSmartPointer<vtkDataObject> m_dataObject;
+    // the arrays of m_dataObject may be used by others
+    bool m_shared = false;
 };
 
 }  // namespace Fem
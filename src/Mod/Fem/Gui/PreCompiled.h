@@ -39,7 +39,9 @@
 
 // STL
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <future>
 #include <limits>
 #include <list>
 #include <map>
@@ -48,6 +50,7 @@
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <vector>
 
 // boost
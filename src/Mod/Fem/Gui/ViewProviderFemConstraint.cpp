@@ -172,10 +172,15 @@ void ViewProviderFemConstraint::updateData(const App::Property* prop)
 {
     auto pcConstraint = this->getObject<const Fem::Constraint>();
 
-    if (prop == &pcConstraint->Points || prop == &pcConstraint->Normals
-        || prop == &pcConstraint->Scale) {
+    if (prop == &pcConstraint->Points || prop == &pcConstraint->Scale) {
         updateSymbol();
     }
+    else if (prop == &pcConstraint->Normals) {
+        // On recompute the normals are set just before the points, only a restore needs them
+        if (pcConstraint->isRestoring()) {
+            updateSymbol();
+        }
+    }
     else {
         ViewProviderGeometryObject::updateData(prop);
     }
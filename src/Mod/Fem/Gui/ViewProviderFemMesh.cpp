@@ -40,7 +40,11 @@
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <sstream>
+#include <thread>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -66,39 +70,37 @@ struct FemFace
     unsigned short Size;
     unsigned short FaceNo;
     bool hide;
-    Base::Vector3d getFirstNodePoint()
-    {
-        return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-    }
-
-    Base::Vector3d set(short size,
-                       const SMDS_MeshElement* element,
-                       unsigned short id,
-                       short faceNo,
-                       const SMDS_MeshNode* n1,
-                       const SMDS_MeshNode* n2,
-                       const SMDS_MeshNode* n3,
-                       const SMDS_MeshNode* n4 = nullptr,
-                       const SMDS_MeshNode* n5 = nullptr,
-                       const SMDS_MeshNode* n6 = nullptr,
-                       const SMDS_MeshNode* n7 = nullptr,
-                       const SMDS_MeshNode* n8 = nullptr);
+    void set(short size,
+             const SMDS_MeshElement* element,
+             unsigned short id,
+             short faceNo,
+             const SMDS_MeshNode* n1,
+             const SMDS_MeshNode* n2,
+             const SMDS_MeshNode* n3,
+             const SMDS_MeshNode* n4 = nullptr,
+             const SMDS_MeshNode* n5 = nullptr,
+             const SMDS_MeshNode* n6 = nullptr,
+             const SMDS_MeshNode* n7 = nullptr,
+             const SMDS_MeshNode* n8 = nullptr);
 
     bool isSameFace(FemFace& face);
+    bool hasSameNodes(const FemFace& face) const;
+    bool lessNodes(const FemFace& face) const;
+    std::size_t hash() const;
 };
 
-Base::Vector3d FemFace::set(short size,
-                            const SMDS_MeshElement* element,
-                            unsigned short id,
-                            short faceNo,
-                            const SMDS_MeshNode* n1,
-                            const SMDS_MeshNode* n2,
-                            const SMDS_MeshNode* n3,
-                            const SMDS_MeshNode* n4,
-                            const SMDS_MeshNode* n5,
-                            const SMDS_MeshNode* n6,
-                            const SMDS_MeshNode* n7,
-                            const SMDS_MeshNode* n8)
+void FemFace::set(short size,
+                  const SMDS_MeshElement* element,
+                  unsigned short id,
+                  short faceNo,
+                  const SMDS_MeshNode* n1,
+                  const SMDS_MeshNode* n2,
+                  const SMDS_MeshNode* n3,
+                  const SMDS_MeshNode* n4,
+                  const SMDS_MeshNode* n5,
+                  const SMDS_MeshNode* n6,
+                  const SMDS_MeshNode* n7,
+                  const SMDS_MeshNode* n8)
 {
     Nodes[0] = n1;
     Nodes[1] = n2;
@@ -131,16 +133,8 @@ Base::Vector3d FemFace::set(short size,
             }
         }
     }
-
-    return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
 }
 
-class FemFaceGridItem: public std::vector<FemFace*>
-{
-public:
-    // FemFaceGridItem(void){reserve(200);}
-};
-
 bool FemFace::isSameFace(FemFace& face)
 {
     // the same element can not have the same face
@@ -151,9 +145,7 @@ bool FemFace::isSameFace(FemFace& face)
         return false;
     }
     // if the same face size just compare if the sorted nodes are the same
-    if (Nodes[0] == face.Nodes[0] && Nodes[1] == face.Nodes[1] && Nodes[2] == face.Nodes[2]
-        && Nodes[3] == face.Nodes[3] && Nodes[4] == face.Nodes[4] && Nodes[5] == face.Nodes[5]
-        && Nodes[6] == face.Nodes[6] && Nodes[7] == face.Nodes[7]) {
+    if (hasSameNodes(face)) {
         hide = true;
         face.hide = true;
         return true;
@@ -162,6 +154,101 @@ bool FemFace::isSameFace(FemFace& face)
     return false;
 }
 
+bool FemFace::hasSameNodes(const FemFace& face) const
+{
+    return std::equal(std::begin(Nodes), std::end(Nodes), std::begin(face.Nodes));
+}
+
+bool FemFace::lessNodes(const FemFace& face) const
+{
+    return std::lexicographical_compare(std::begin(Nodes),
+                                        std::end(Nodes),
+                                        std::begin(face.Nodes),
+                                        std::end(face.Nodes),
+                                        std::less<const SMDS_MeshNode*>());
+}
+
+std::size_t FemFace::hash() const
+{
+    std::size_t seed = Size;
+    for (const SMDS_MeshNode* node : Nodes) {
+        seed ^= std::hash<const SMDS_MeshNode*>()(node) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+// Hides all faces that are shared by two elements, these faces are inside of the mesh.
+// Equal faces have the same hash, so the faces are distributed to buckets by their
+// hash and the buckets are searched for equal faces concurrently.
+static void hideInnerFaces(std::vector<FemFace>& faces)
+{
+    std::size_t numBuckets = 1;
+    while (numBuckets < 65536 && numBuckets * 256 < faces.size()) {
+        numBuckets *= 2;
+    }
+
+    std::vector<std::size_t> bucketOfFace(faces.size());
+    std::vector<std::size_t> bucketStart(numBuckets + 1, 0);
+    for (std::size_t i = 0; i < faces.size(); i++) {
+        bucketOfFace[i] = faces[i].hash() & (numBuckets - 1);
+        bucketStart[bucketOfFace[i] + 1]++;
+    }
+    for (std::size_t i = 1; i <= numBuckets; i++) {
+        bucketStart[i] += bucketStart[i - 1];
+    }
+    std::vector<int> order(faces.size());
+    std::vector<std::size_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+    for (std::size_t i = 0; i < faces.size(); i++) {
+        order[fill[bucketOfFace[i]]++] = int(i);
+    }
+    bucketOfFace.clear();
+    bucketOfFace.shrink_to_fit();
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t bucket = next++; bucket < numBuckets; bucket = next++) {
+            auto first = order.begin() + bucketStart[bucket];
+            auto last = order.begin() + bucketStart[bucket + 1];
+            // equal faces become neighbours and keep their original order
+            std::sort(first, last, [&faces](int a, int b) {
+                if (faces[a].Size != faces[b].Size) {
+                    return faces[a].Size < faces[b].Size;
+                }
+                if (!faces[a].hasSameNodes(faces[b])) {
+                    return faces[a].lessNodes(faces[b]);
+                }
+                return a < b;
+            });
+            for (auto it = first; it != last; ++it) {
+                FemFace& face = faces[*it];
+                if (face.hide) {
+                    continue;
+                }
+                for (auto other = it + 1; other != last; ++other) {
+                    FemFace& candidate = faces[*other];
+                    if (candidate.Size != face.Size || !candidate.hasSameNodes(face)) {
+                        break;
+                    }
+                    if (face.isSameFace(candidate)) {
+                        break;
+                    }
+                }
+            }
+        }
+    };
+
+    std::size_t numThreads =
+        std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), numBuckets);
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 // ----------------------------------------------------------------------------
 
 class ViewProviderFemMesh::Private
@@ -636,50 +723,56 @@ void ViewProviderFemMesh::setDisplacementByNodeIdHelper(
     const std::vector<Base::Vector3d>& DispVector,
     long startId)
 {
+    // remember the undisplaced positions, every factor is then applied to them
+    // directly instead of undoing the previous factor first
+    if (DisplacementBase.empty()) {
+        const SbVec3f* verts = pcCoords->point.getValues(0);
+        DisplacementBase.assign(verts, verts + pcCoords->point.getNum());
+    }
+
     DisplacementVector.resize(vNodeElementIdx.size());
     int i = 0;
     for (std::vector<unsigned long>::const_iterator it = vNodeElementIdx.begin();
          it != vNodeElementIdx.end();
          ++it, i++) {
-        DisplacementVector[i] = DispVector[*it - startId];
+        const Base::Vector3d& disp = DispVector[*it - startId];
+        DisplacementVector[i].setValue(float(disp.x), float(disp.y), float(disp.z));
     }
-    applyDisplacementToNodes(1.0);
+    DisplacementFactor = 1.0;
+    updateDisplacedNodes();
 }
 
 void ViewProviderFemMesh::resetDisplacementByNodeId()
 {
     applyDisplacementToNodes(0.0);
     DisplacementVector.clear();
+    DisplacementBase.clear();
 }
 /// reaply the node displacement with a certain factor and do a redraw
 void ViewProviderFemMesh::applyDisplacementToNodes(double factor)
 {
-    if (DisplacementVector.empty()) {
+    // an animation or slider often sends the same factor several times
+    if (DisplacementVector.empty() || factor == DisplacementFactor) {
         return;
     }
 
-    float x = 0, y = 0, z = 0;
-    // set the point coordinates
-    long sz = pcCoords->point.getNum();
+    DisplacementFactor = factor;
+    updateDisplacedNodes();
+}
+
+void ViewProviderFemMesh::updateDisplacedNodes()
+{
+    auto sz = std::size_t(pcCoords->point.getNum());
+    if (DisplacementBase.size() != sz || DisplacementVector.size() != sz) {
+        return;
+    }
+
+    auto factor = float(DisplacementFactor);
     SbVec3f* verts = pcCoords->point.startEditing();
-    for (long i = 0; i < sz; i++) {
-        verts[i].getValue(x, y, z);
-        // undo old factor#
-        Base::Vector3d oldDisp = DisplacementVector[i] * DisplacementFactor;
-        x -= oldDisp.x;
-        y -= oldDisp.y;
-        z -= oldDisp.z;
-        // apply new factor
-        Base::Vector3d newDisp = DisplacementVector[i] * factor;
-        x += newDisp.x;
-        y += newDisp.y;
-        z += newDisp.z;
-        // set the new value
-        verts[i].setValue(x, y, z);
+    for (std::size_t i = 0; i < sz; i++) {
+        verts[i] = DisplacementBase[i] + DisplacementVector[i] * factor;
     }
     pcCoords->point.finishEditing();
-
-    DisplacementFactor = factor;
 }
 
 void ViewProviderFemMesh::setColorByNodeId(const std::vector<long>& NodeIds,
@@ -739,10 +832,19 @@ void ViewProviderFemMesh::setColorByIdHelper(
     App::PropertyColorList& prop)
 {
     std::vector<Base::Color> vecColor(vElementIdx.size());
-    std::map<long, const Base::Color*> colorMap;
+    // the ids are dense, so a plain array is used for the lookup
+    long maxId = -1;
     for (const auto& m : elemColorMap) {
         for (long i : m.first) {
-            colorMap[i] = &m.second;
+            maxId = std::max(maxId, i);
+        }
+    }
+    std::vector<const Base::Color*> colorMap(maxId + 1, nullptr);
+    for (const auto& m : elemColorMap) {
+        for (long i : m.first) {
+            if (i >= 0) {
+                colorMap[i] = &m.second;
+            }
         }
     }
 
@@ -752,8 +854,8 @@ void ViewProviderFemMesh::setColorByIdHelper(
          it != vElementIdx.end();
          ++it, i++) {
         unsigned long ElemIdx = ((*it) >> rShift);
-        const std::map<long, const Base::Color*>::const_iterator pos = colorMap.find(ElemIdx);
-        vecColor[i] = pos == colorMap.end() ? baseDif : *pos->second;
+        const Base::Color* color = ElemIdx < colorMap.size() ? colorMap[ElemIdx] : nullptr;
+        vecColor[i] = color ? *color : baseDif;
     }
 
     prop.setValue(vecColor);
@@ -920,6 +1022,41 @@ inline void insEdgeVec(std::map<int, std::set<int>>& map, int n1, int n2)
     map[n2].insert(n1);
 }
 
+// The index of the mesh nodes in the coordinates, addressed by the node id
+class NodeIndexMap
+{
+public:
+    explicit NodeIndexMap(int maxId)
+        : nodes(maxId + 1, nullptr)
+        , index(maxId + 1, -1)
+    {}
+
+    /// Marks the node as used and gives access to its index
+    int& operator[](const SMDS_MeshNode* node)
+    {
+        int id = node->GetID();
+        nodes[id] = node;
+        return index[id];
+    }
+
+    /// Numbers the used nodes in the order of their ids and returns them
+    std::vector<const SMDS_MeshNode*> numberNodes()
+    {
+        std::vector<const SMDS_MeshNode*> used;
+        for (std::size_t id = 0; id < nodes.size(); id++) {
+            if (nodes[id]) {
+                index[id] = int(used.size());
+                used.push_back(nodes[id]);
+            }
+        }
+        return used;
+    }
+
+private:
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<int> index;
+};
+
 inline unsigned long ElemFold(unsigned long Element, unsigned long FaceNbr)
 {
     unsigned long t1 = Element << 3;
@@ -992,8 +1129,6 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     Base::Console().log("    %f: Start build up %i face helper\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()),
                         facesHelper.size());
-    Base::BoundBox3d BndBox;
-
     int i = 0;
 
     if (ShowFaces) {
@@ -1005,52 +1140,52 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
             switch (num) {
                 case 3:
                     // tria3 face = N1, N2, N3
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2)));
+                    facesHelper[i++].set(3,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2));
                     break;
                 case 4:
                     // quad4 face = N1, N2, N3, N4
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(3)));
+                    facesHelper[i++].set(4,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(3));
                     break;
                 case 6:
                     // tria6 face = N1, N4, N2, N5, N3, N6
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(5)));
+                    facesHelper[i++].set(6,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(5));
                     break;
                 case 8:
                     // quad8 face = N1, N5, N2, N6, N3, N7, N4, N8
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(5),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(6),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(7)));
+                    facesHelper[i++].set(8,
+                                         aFace,
+                                         aFace->GetID(),
+                                         0,
+                                         aFace->GetNode(0),
+                                         aFace->GetNode(4),
+                                         aFace->GetNode(1),
+                                         aFace->GetNode(5),
+                                         aFace->GetNode(2),
+                                         aFace->GetNode(6),
+                                         aFace->GetNode(3),
+                                         aFace->GetNode(7));
                     break;
                 default:
                     // unknown face type
@@ -1075,34 +1210,34 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N4, N2
                     // face 3 = N2, N4, N3
                     // face 4 = N3, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // pyra5 volume
                 case 5:
@@ -1111,42 +1246,42 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N5, N3
                     // face 4 = N3, N5, N4
                     // face 5 = N4, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // penta6 volume
                 case 6:
@@ -1155,44 +1290,44 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N4, N5, N2
                     // face 4 = N2, N5, N6, N3
                     // face 5 = N3, N6, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(3,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(0));
                     break;
                 // hexa8 volume
                 case 8:
@@ -1202,54 +1337,54 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N6, N7, N3
                     // face 5 = N3, N7, N8, N4
                     // face 6 = N4, N8, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3));
+                    facesHelper[i++].set(4,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(0));
                     break;
                 // tetra10 volume
                 case 10:
@@ -1257,46 +1392,46 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 2 = N1, N8,  N4, N9,  N2, N5
                     // face 3 = N2, N9,  N4, N10, N3, N6
                     // face 4 = N3, N10, N4, N8,  N1, N7
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(4));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6));
                     break;
                 // pyra13 volume
                 case 13:
@@ -1305,58 +1440,58 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N2, N11, N5, N12, N3, N7
                     // face 4 = N3, N12, N5, N13, N4, N8
                     // face 5 = N4, N13, N5, N10, N1, N9
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(5));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // penta15 volume
                 case 15:
@@ -1365,62 +1500,62 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 3 = N1, N13, N4, N10, N5, N14, N2, N7
                     // face 4 = N2, N14, N5, N11, N6, N15, N3, N8
                     // face 5 = N3, N15, N6, N12, N4, N13, N1, N9
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(6,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(6));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(7));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(11),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8));
                     break;
                 // hexa20 volume
                 case 20:
@@ -1430,78 +1565,78 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                     // face 4 = N2, N18, N6, N14, N7, N19, N3, N10
                     // face 5 = N3, N19, N7, N15, N8, N20, N4, N11
                     // face 6 = N4, N20, N8, N16, N5, N17, N1, N12
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(12)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(10)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(11)));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         1,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(8),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(9),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(10),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(11));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         2,
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(12));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         3,
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(12),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(8));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         4,
+                                         aVol->GetNode(1),
+                                         aVol->GetNode(17),
+                                         aVol->GetNode(5),
+                                         aVol->GetNode(13),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(9));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         5,
+                                         aVol->GetNode(2),
+                                         aVol->GetNode(18),
+                                         aVol->GetNode(6),
+                                         aVol->GetNode(14),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(10));
+                    facesHelper[i++].set(8,
+                                         aVol,
+                                         aVol->GetID(),
+                                         6,
+                                         aVol->GetNode(3),
+                                         aVol->GetNode(19),
+                                         aVol->GetNode(7),
+                                         aVol->GetNode(15),
+                                         aVol->GetNode(4),
+                                         aVol->GetNode(16),
+                                         aVol->GetNode(0),
+                                         aVol->GetNode(11));
                     break;
                 // unknown volume type
                 default:
@@ -1513,97 +1648,19 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     int FaceSize = facesHelper.size();
 
 
-    if (FaceSize < MaxFacesShowInner) {
-        Base::Console().log("    %f: Start eliminate internal faces SIMPLE\n",
+    // search for double (inside) faces and hide them, large meshes never show them
+    if (!ShowInner || FaceSize >= MaxFacesShowInner) {
+        Base::Console().log("    %f: Start eliminate internal faces\n",
                             Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-
-        // search for double (inside) faces and hide them
-        if (!ShowInner) {
-            for (int l = 0; l < FaceSize; l++) {
-                if (!facesHelper[l].hide) {
-                    for (int i = l + 1; i < FaceSize; i++) {
-                        if (facesHelper[l].isSameFace(facesHelper[i])) {
-                            break;
-                        }
-                    }
-                }
-            }
-        }
+        hideInnerFaces(facesHelper);
     }
-    else {
-        Base::Console().log("    %f: Start eliminate internal faces GRID\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-        BndBox.Enlarge(BndBox.CalcDiagonalLength() / 10000.0);
-        // calculate grid properties
-        double edge = pow(FaceSize, 1.0 / 3.0);
-        double edgeL = BndBox.LengthX() + BndBox.LengthY() + BndBox.LengthZ();
-        double gridFactor = 5.0;
-        double size = (edgeL / (3 * edge)) * gridFactor;
-
-        unsigned int NbrX = (unsigned int)(BndBox.LengthX() / size) + 1;
-        unsigned int NbrY = (unsigned int)(BndBox.LengthY() / size) + 1;
-        unsigned int NbrZ = (unsigned int)(BndBox.LengthZ() / size) + 1;
-        Base::Console().log("      Size:F:%f,  X:%i  ,Y:%i  ,Z:%i\n", gridFactor, NbrX, NbrY, NbrZ);
-
-        double Xmin = BndBox.MinX;
-        double Ymin = BndBox.MinY;
-        double Zmin = BndBox.MinZ;
-        double Xln = BndBox.LengthX() / NbrX;
-        double Yln = BndBox.LengthY() / NbrY;
-        double Zln = BndBox.LengthZ() / NbrZ;
-
-        std::vector<FemFaceGridItem> Grid(NbrX * NbrY * NbrZ);
-
-
-        unsigned int iX = 0;
-        unsigned int iY = 0;
-        unsigned int iZ = 0;
-
-        for (int l = 0; l < FaceSize; l++) {
-            Base::Vector3d point(facesHelper[l].getFirstNodePoint());
-            double x = (point.x - Xmin) / Xln;
-            double y = (point.y - Ymin) / Yln;
-            double z = (point.z - Zmin) / Zln;
-
-            iX = x;
-            iY = y;
-            iZ = z;
-
-            if (iX >= NbrX || iY >= NbrY || iZ >= NbrZ) {
-                Base::Console().log("      Outof range!\n");
-            }
-
-            Grid[iX + iY * NbrX + iZ * NbrX * NbrY].push_back(&facesHelper[l]);
-        }
-
-        unsigned int max = 0, avg = 0;
-        for (const auto& it : Grid) {
-            for (size_t l = 0; l < it.size(); l++) {
-                if (!it[l]->hide) {
-                    for (size_t i = l + 1; i < it.size(); i++) {
-                        if (it[l]->isSameFace(*(it[i]))) {
-                            break;
-                        }
-                    }
-                }
-            }
-            if (it.size() > max) {
-                max = it.size();
-            }
-            avg += it.size();
-        }
-        avg = avg / Grid.size();
-
-        Base::Console().log("      VoxelSize: Max:%i ,Average:%i\n", max, avg);
-
-    }  // if( FaceSize < 1000)
 
 
     Base::Console().log("    %f: Start build up node map\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // sort out double nodes and build up index map
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    NodeIndexMap mapNodeIndex(data->MaxNodeID());
 
     // handling the corner case beams only, means no faces/triangles only nodes and edges
     if (onlyEdges) {
@@ -1636,15 +1693,15 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
     // set the point coordinates
-    coords->point.setNum(mapNodeIndex.size());
-    vNodeElementIdx.resize(mapNodeIndex.size());
-    std::map<const SMDS_MeshNode*, int>::iterator it = mapNodeIndex.begin();
+    std::vector<const SMDS_MeshNode*> usedNodes = mapNodeIndex.numberNodes();
+    coords->point.setNum(usedNodes.size());
+    vNodeElementIdx.resize(usedNodes.size());
     SbVec3f* verts = coords->point.startEditing();
-    for (int i = 0; it != mapNodeIndex.end(); ++it, i++) {
-        verts[i].setValue((float)it->first->X(), (float)it->first->Y(), (float)it->first->Z());
-        it->second = i;
+    for (std::size_t i = 0; i < usedNodes.size(); i++) {
+        const SMDS_MeshNode* node = usedNodes[i];
+        verts[i].setValue((float)node->X(), (float)node->Y(), (float)node->Z());
         // set selection idx
-        vNodeElementIdx[i] = it->first->GetID();
+        vNodeElementIdx[i] = node->GetID();
     }
     coords->point.finishEditing();
 
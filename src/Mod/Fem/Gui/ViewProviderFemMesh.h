@@ -23,6 +23,8 @@
 #ifndef FEM_VIEWPROVIDERFEMMESH_H
 #define FEM_VIEWPROVIDERFEMMESH_H
 
+#include <Inventor/SbVec3f.h>
+
 #include <Gui/ViewProviderBuilder.h>
 #include <Gui/ViewProviderGeometryObject.h>
 #include <Gui/ViewProviderFeaturePython.h>
@@ -153,6 +155,7 @@ protected:
 
     void setColorByNodeIdHelper(const std::vector<Base::Color>&);
     void setDisplacementByNodeIdHelper(const std::vector<Base::Vector3d>& DispVector, long startId);
+    void updateDisplacedNodes();
     void setColorByIdHelper(const std::map<std::vector<long>, Base::Color>& elemColorMap,
                             const std::vector<unsigned long>& vElementIdx,
                             int rShift,
@@ -165,7 +168,9 @@ protected:
     std::vector<unsigned long> vFaceElementIdx;
     std::vector<unsigned long> vNodeElementIdx;
     std::vector<unsigned long> vHighlightedIdx;
-    std::vector<Base::Vector3d> DisplacementVector;
+    /// undisplaced node positions, kept while a displacement is applied
+    std::vector<SbVec3f> DisplacementBase;
+    std::vector<SbVec3f> DisplacementVector;
     double DisplacementFactor;
 
     SoMaterial* pcPointMaterial;
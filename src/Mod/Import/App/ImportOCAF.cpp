@@ -109,8 +109,12 @@ void ImportOCAF::loadShapes()
 {
     std::vector<App::DocumentObject*> lValue;
     myRefShapes.clear();
+    myColors.clear();
+    myMergedShapes.clear();
     loadShapes(pDoc->Main(), TopLoc_Location(), default_name, "", false, lValue);
     lValue.clear();
+    myColors.clear();
+    myMergedShapes.clear();
 }
 
 void ImportOCAF::setMerge(bool merge)
@@ -284,47 +288,16 @@ void ImportOCAF::createShape(const TDF_Label& label,
         App::Part* pcPart = nullptr;
 
         if (mergeShape) {
-
-            // We should do that only if there is more than a single shape inside
-            // Computing Compounds takes time
-            // We must keep track of the Color. If there is more than 1 Color into
-            // a STEP Compound then the Merge can't be done and we cancel the operation
-
-            BRep_Builder builder;
-            TopoDS_Compound comp;
-            builder.MakeCompound(comp);
-
-            for (xp.Init(aShape, TopAbs_SOLID); xp.More(); xp.Next(), ctSolids++) {
-                const TopoDS_Shape& sh = xp.Current();
-                if (!sh.IsNull()) {
-                    builder.Add(comp, sh);
-                }
-            }
-
-            for (xp.Init(aShape, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next(), ctShells++) {
-                const TopoDS_Shape& sh = xp.Current();
-                if (!sh.IsNull()) {
-                    builder.Add(comp, sh);
-                }
-            }
-
-            for (xp.Init(aShape, TopAbs_EDGE); xp.More(); xp.Next(), ctEdges++) {
-                const TopoDS_Shape& sh = xp.Current();
-                if (!sh.IsNull()) {
-                    builder.Add(comp, sh);
-                }
-            }
-
-            for (xp.Init(aShape, TopAbs_VERTEX); xp.More(); xp.Next(), ctVertices++) {
-                const TopoDS_Shape& sh = xp.Current();
-                if (!sh.IsNull()) {
-                    builder.Add(comp, sh);
-                }
+            // The compound of a shape that is referenced several times is reused
+            auto it = myMergedShapes.find(label);
+            if (it == myMergedShapes.end()) {
+                it = myMergedShapes.emplace(label, makeMergedCompound(aShape)).first;
             }
+            const TopoDS_Shape& comp = it->second;
 
             // Ok we got a Compound which is computed
             // Just need to add it to a Part::Feature and push it to lValue
-            if (!comp.IsNull() && (ctSolids || ctShells || ctEdges || ctVertices)) {
+            if (!comp.IsNull()) {
                 Part::Feature* part = doc->addObject<Part::Feature>();
                 // Let's allocate the relative placement of the Compound from the STEP file
                 tryPlacementFromLoc(part, loc);
@@ -370,6 +343,53 @@ void ImportOCAF::createShape(const TDF_Label& label,
     }
 }
 
+TopoDS_Shape ImportOCAF::makeMergedCompound(const TopoDS_Shape& aShape)
+{
+    // We should do that only if there is more than a single shape inside
+    // Computing Compounds takes time
+    // We must keep track of the Color. If there is more than 1 Color into
+    // a STEP Compound then the Merge can't be done and we cancel the operation
+
+    TopExp_Explorer xp;
+    int ctSolids = 0, ctShells = 0, ctVertices = 0, ctEdges = 0;
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+
+    for (xp.Init(aShape, TopAbs_SOLID); xp.More(); xp.Next(), ctSolids++) {
+        const TopoDS_Shape& sh = xp.Current();
+        if (!sh.IsNull()) {
+            builder.Add(comp, sh);
+        }
+    }
+
+    for (xp.Init(aShape, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next(), ctShells++) {
+        const TopoDS_Shape& sh = xp.Current();
+        if (!sh.IsNull()) {
+            builder.Add(comp, sh);
+        }
+    }
+
+    for (xp.Init(aShape, TopAbs_EDGE); xp.More(); xp.Next(), ctEdges++) {
+        const TopoDS_Shape& sh = xp.Current();
+        if (!sh.IsNull()) {
+            builder.Add(comp, sh);
+        }
+    }
+
+    for (xp.Init(aShape, TopAbs_VERTEX); xp.More(); xp.Next(), ctVertices++) {
+        const TopoDS_Shape& sh = xp.Current();
+        if (!sh.IsNull()) {
+            builder.Add(comp, sh);
+        }
+    }
+
+    if (!ctSolids && !ctShells && !ctEdges && !ctVertices) {
+        return {};
+    }
+    return comp;
+}
+
 void ImportOCAF::createShape(const TopoDS_Shape& aShape,
                              const TopLoc_Location& loc,
                              const std::string& name,
@@ -392,15 +412,30 @@ void ImportOCAF::createShape(const TopoDS_Shape& aShape,
 
 void ImportOCAF::loadColors(Part::Feature* part, const TopoDS_Shape& aShape)
 {
+    auto it = myColors.find(aShape);
+    if (it == myColors.end()) {
+        it = myColors.emplace(aShape, getColors(aShape)).first;
+    }
+
+    const ShapeColors& colors = it->second;
+    if (!colors.colors.empty()) {
+        applyColors(part, colors.colors);
+    }
+    if (!colors.faceColors.empty()) {
+        applyColors(part, colors.faceColors);
+    }
+}
+
+ImportOCAF::ShapeColors ImportOCAF::getColors(const TopoDS_Shape& aShape) const
+{
+    ShapeColors colors;
     Quantity_ColorRGBA aColor;
     Base::Color color(0.8f, 0.8f, 0.8f);
     if (aColorTool->GetColor(aShape, XCAFDoc_ColorGen, aColor)
         || aColorTool->GetColor(aShape, XCAFDoc_ColorSurf, aColor)
         || aColorTool->GetColor(aShape, XCAFDoc_ColorCurv, aColor)) {
         color = Tools::convertColor(aColor);
-        std::vector<Base::Color> colors;
-        colors.push_back(color);
-        applyColors(part, colors);
+        colors.colors.push_back(color);
     }
 
     TopTools_IndexedMapOfShape faces;
@@ -427,8 +462,9 @@ void ImportOCAF::loadColors(Part::Feature* part, const TopoDS_Shape& aShape)
     }
 
     if (found_face_color) {
-        applyColors(part, faceColors);
+        colors.faceColors = std::move(faceColors);
     }
+    return colors;
 }
 
 // ----------------------------------------------------------------------------
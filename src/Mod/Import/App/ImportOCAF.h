@@ -38,6 +38,8 @@
 #include <App/Part.h>
 #include <Mod/Import/ImportGlobal.h>
 
+#include "Tools.h"
+
 
 class TDF_Label;
 class TopLoc_Location;
@@ -64,6 +66,12 @@ public:
     void setMerge(bool);
 
 private:
+    struct ShapeColors
+    {
+        std::vector<Base::Color> colors;
+        std::vector<Base::Color> faceColors;
+    };
+
     void loadShapes(const TDF_Label& label,
                     const TopLoc_Location&,
                     const std::string& partname,
@@ -80,6 +88,8 @@ private:
                      const std::string&,
                      std::vector<App::DocumentObject*>&);
     void loadColors(Part::Feature* part, const TopoDS_Shape& aShape);
+    ShapeColors getColors(const TopoDS_Shape& aShape) const;
+    static TopoDS_Shape makeMergedCompound(const TopoDS_Shape& aShape);
     virtual void applyColors(Part::Feature*, const std::vector<Base::Color>&)
     {}
     static void tryPlacementFromLoc(App::GeoFeature*, const TopLoc_Location&);
@@ -93,6 +103,10 @@ private:
     bool merge {true};
     std::string default_name;
     std::set<int> myRefShapes;
+    // Shapes referenced several times in an assembly share the same TShape, so
+    // the colors and merged compounds are only computed once.
+    std::unordered_map<TopoDS_Shape, ShapeColors, ShapeHasher> myColors;
+    std::unordered_map<TDF_Label, TopoDS_Shape, LabelHasher> myMergedShapes;
 };
 
 class ImportExport ImportOCAFCmd: public ImportOCAF
@@ -26,6 +26,7 @@
 #endif
 #ifndef _PreComp_
 #include <Interface_Static.hxx>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -288,80 +289,29 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
 
     getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
 
     Part::TopoShape tshape(shape);
-    std::vector<Base::Color> faceColors;
-    std::vector<Base::Color> edgeColors;
+    SubShapeColors colors;
 
-    TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
-                    continue;
-                }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
-                }
-
-                bool foundFaceColor = false, foundEdgeColor = false;
-                Base::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
-                }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
-                }
-
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
-                }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
-                }
-            }
-        }
+    // use the colors prepared by loadShapes() if they belong to the same shape
+    auto it = label.IsNull() ? mySubShapeColors.end() : mySubShapeColors.find(label);
+    if (it != mySubShapeColors.end() && it->second.shape.IsEqual(shape)
+        && it->second.defaultFaceColor == info.faceColor
+        && it->second.defaultEdgeColor == info.edgeColor) {
+        colors = std::move(it->second);
+        mySubShapeColors.erase(it);
+    }
+    else if (!label.IsNull()) {
+        colors.shape = shape;
+        colors.defaultFaceColor = info.faceColor;
+        colors.defaultEdgeColor = info.edgeColor;
+        mapSubShapeColors(getSubShapeColors(label), colors);
+    }
+    if (colors.hasFaceColors) {
+        info.hasFaceColor = true;
+    }
+    if (colors.hasEdgeColors) {
+        info.hasEdgeColor = true;
     }
 
     Part::Feature* feature;
@@ -382,11 +332,11 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (colors.hasFaceColors) {
+        applyFaceColors(feature, colors.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (colors.hasEdgeColors) {
+        applyEdgeColors(feature, colors.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -394,6 +344,132 @@ bool ImportOCAF2::createObject(App::Document* doc,
     return true;
 }
 
+std::vector<ImportOCAF2::SubShapeColor> ImportOCAF2::getSubShapeColors(TDF_Label label)
+{
+    std::vector<SubShapeColor> subColors;
+    TDF_LabelSequence seq;
+    if (!aShapeTool->GetSubShapes(label, seq)) {
+        return subColors;
+    }
+
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 1; i <= seq.Length(); ++i) {
+            TDF_Label l = seq.Value(i);
+            SubShapeColor subColor;
+            subColor.shape = aShapeTool->GetShape(l);
+            if (subColor.shape.IsNull()) {
+                continue;
+            }
+            TopAbs_ShapeEnum type = subColor.shape.ShapeType();
+            subColor.isSolid = type != TopAbs_FACE && type != TopAbs_EDGE;
+            if (subColor.isSolid != (j == 0)) {
+                continue;
+            }
+
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+                subColor.faceColor = Tools::convertColor(aColor);
+                subColor.hasFaceColor = true;
+            }
+            if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                subColor.edgeColor = Tools::convertColor(aColor);
+                subColor.hasEdgeColor = true;
+            }
+            if (subColor.hasFaceColor || subColor.hasEdgeColor) {
+                subColors.push_back(subColor);
+            }
+        }
+    }
+    return subColors;
+}
+
+void ImportOCAF2::mapSubShapeColors(const std::vector<SubShapeColor>& subColors,
+                                    SubShapeColors& colors)
+{
+    if (subColors.empty()) {
+        return;
+    }
+
+    // Only works on the topology, so this is safe to be called from several threads
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(colors.shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(colors.shape, TopAbs_EDGE, edgeMap);
+
+    colors.faceColors.assign(faceMap.Extent(), colors.defaultFaceColor);
+    colors.edgeColors.assign(edgeMap.Extent(), colors.defaultEdgeColor);
+
+    for (const auto& subColor : subColors) {
+        bool foundEdgeColor = subColor.hasEdgeColor;
+        if (subColor.isSolid && subColor.hasFaceColor && !colors.faceColors.empty()
+            && subColor.edgeColor == subColor.faceColor) {
+            // Do not set edge the same color as face
+            foundEdgeColor = false;
+        }
+
+        if (subColor.hasFaceColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_FACE); exp.More(); exp.Next()) {
+                int idx = faceMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)colors.faceColors.size()) {
+                    colors.faceColors[idx] = subColor.faceColor;
+                    colors.hasFaceColors = true;
+                }
+            }
+        }
+        if (foundEdgeColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)colors.edgeColors.size()) {
+                    colors.edgeColors[idx] = subColor.edgeColor;
+                    colors.hasEdgeColors = true;
+                }
+            }
+        }
+    }
+}
+
+void ImportOCAF2::prepareSubShapeColors()
+{
+    // Reading the colors from the OCAF document is done here, mapping them to the
+    // faces and edges of the shapes is the expensive part and done in parallel.
+    std::vector<SubShapeColors> colors;
+    std::vector<std::vector<SubShapeColor>> subColors;
+    std::vector<TDF_Label> labels;
+
+    TDF_LabelSequence seq;
+    aShapeTool->GetShapes(seq);
+    for (int i = 1; i <= seq.Length(); ++i) {
+        TDF_Label label = seq.Value(i);
+        if (aShapeTool->IsAssembly(label)) {
+            continue;
+        }
+        auto shapeColors = getSubShapeColors(label);
+        if (shapeColors.empty()) {
+            continue;
+        }
+        Info info;
+        SubShapeColors entry;
+        entry.shape = aShapeTool->GetShape(label).Located(TopLoc_Location());
+        getColor(entry.shape, info);
+        entry.defaultFaceColor = info.faceColor;
+        entry.defaultEdgeColor = info.edgeColor;
+        colors.push_back(std::move(entry));
+        subColors.push_back(std::move(shapeColors));
+        labels.push_back(label);
+    }
+
+    OSD_Parallel::For(0, static_cast<int>(colors.size()), [&](int index) {
+        mapSubShapeColors(subColors[index], colors[index]);
+    });
+
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        mySubShapeColors.emplace(labels[i], std::move(colors[i]));
+    }
+}
+
 App::Document* ImportOCAF2::getDocument(App::Document* doc, TDF_Label label)
 {
     if (filePath.empty() || options.mode == SingleDoc || options.merge) {
@@ -520,6 +596,8 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    mySubShapeColors.clear();
+    prepareSubShapeColors();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
@@ -576,6 +654,7 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    mySubShapeColors.clear();
     sequencer = nullptr;
     return ret;
 }
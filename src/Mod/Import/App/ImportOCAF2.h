@@ -136,6 +136,30 @@ private:
         int free = true;
     };
 
+    /// Color of a sub-shape label as read from the OCAF document
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        Base::Color faceColor;
+        Base::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+        // solids and shells are applied before faces and edges
+        bool isSolid = false;
+    };
+
+    /// Face and edge colors of a shape derived from the colors of its sub-shapes
+    struct SubShapeColors
+    {
+        TopoDS_Shape shape;
+        Base::Color defaultFaceColor;
+        Base::Color defaultEdgeColor;
+        std::vector<Base::Color> faceColors;
+        std::vector<Base::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+    };
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -162,6 +186,10 @@ private:
     getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false);
     void
     getSHUOColors(TDF_Label label, std::map<std::string, Base::Color>& colors, bool appendFirst);
+    std::vector<SubShapeColor> getSubShapeColors(TDF_Label label);
+    static void mapSubShapeColors(const std::vector<SubShapeColor>& subColors,
+                                  SubShapeColors& colors);
+    void prepareSubShapeColors();
     void setObjectName(Info& info, TDF_Label label);
     std::string getLabelName(TDF_Label label);
     App::DocumentObject*
@@ -207,6 +235,7 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TDF_Label, SubShapeColors, LabelHasher> mySubShapeColors;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
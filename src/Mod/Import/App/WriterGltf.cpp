@@ -24,23 +24,105 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/core/ignore_unused.hpp>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <Precision.hxx>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#if OCC_VERSION_HEX >= 0x070700
+#include <RWGltf_DracoParameters.hxx>
+#endif
 #endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Parameter.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
+namespace
+{
+// Checks if all faces already have a triangulation that is at least as fine as requested
+bool hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        const Handle(Poly_Triangulation)& mesh =
+            BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (mesh.IsNull() || mesh->Deflection() > deflection) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {}
 
+void WriterGltf::triangulate(Handle(TDocStd_Document) hDoc)
+{
+    // RWGltf_CafWriter only writes faces that are already triangulated. Use the same
+    // deflection as ViewProviderPartExt so that the tessellation made for the display
+    // is reused and only shapes that were never displayed need to be meshed.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);                    // NOLINT
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);  // NOLINT
+
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetShapes(labels);
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        TDF_Label label = labels.Value(i);
+        if (shapeTool->IsAssembly(label)) {
+            continue;
+        }
+        TopoDS_Shape shape = shapeTool->GetShape(label);
+        if (shape.IsNull()) {
+            continue;
+        }
+
+        Bnd_Box bounds;
+        BRepBndLib::Add(shape, bounds);
+        if (bounds.IsVoid()) {
+            continue;
+        }
+        bounds.SetGap(0.0);
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        double deflection = ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+        deflection = std::max(deflection, Precision::Confusion());
+        if (hasTriangulation(shape, deflection)) {
+            continue;
+        }
+
+        // the faces of a shape are meshed in parallel
+        IMeshTools_Parameters meshParams;
+        meshParams.Deflection = deflection;
+        meshParams.Relative = Standard_False;
+        meshParams.Angle = Base::toRadians(angularDeflection);
+        meshParams.InParallel = Standard_True;
+        BRepMesh_IncrementalMesh(shape, meshParams);
+    }
+}
+
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
     std::string utf8Name = file.filePath();
@@ -54,7 +136,19 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(RWMesh_CoordinateSystem_Zup);
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
+
+    // Draco compression needs an OCC build with Draco support
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Import/glTF");
+    if (hGrp->GetBool("DracoCompression", false)) {
+        RWGltf_DracoParameters draco;
+        draco.DracoCompression = true;
+        draco.CompressionLevel =
+            static_cast<int>(hGrp->GetInt("DracoCompressionLevel", draco.CompressionLevel));
+        aWriter.SetCompressionParameters(draco);
+    }
 #endif
+    triangulate(hDoc);
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
     if (!ret) {
         throw Base::FileException("Cannot save to file: ", file);
@@ -38,6 +38,9 @@ public:
 
     void write(Handle(TDocStd_Document) hDoc) const;
 
+private:
+    static void triangulate(Handle(TDocStd_Document) hDoc);
+
 private:
     Base::FileInfo file;
 };
@@ -37,6 +37,7 @@
 #include <GeomAPI_Interpolate.hxx>
 #include <GeomAPI_PointsToBSpline.hxx>
 #include <Geom_BSplineCurve.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -92,12 +93,17 @@ bool ImpExpDxfRead::ReadEntitiesSection()
     DrawingEntityCollector collector(*this);
     if (m_mergeOption < SingleShapes) {
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>> ShapesToCombine;
+        std::map<CDxfRead::CommonEntityAttributes, LineList> LinesToCombine;
         {
-            ShapeSavingEntityCollector savingCollector(*this, ShapesToCombine);
+            ShapeSavingEntityCollector savingCollector(*this, ShapesToCombine, LinesToCombine);
             if (!CDxfRead::ReadEntitiesSection()) {
                 return false;
             }
         }
+        for (auto& lineSet : LinesToCombine) {
+            MakeLineEdges(lineSet.second, ShapesToCombine[lineSet.first]);
+        }
+        LinesToCombine.clear();
 
         // Merge the contents of ShapesToCombine and AddObject the result(s)
         // TODO: We do end-to-end joining or complete merging as selected by the options.
@@ -137,6 +143,18 @@ void ImpExpDxfRead::CombineShapes(std::list<TopoDS_Shape>& shapes, const char* n
     }
 }
 
+void ImpExpDxfRead::MakeLineEdges(const LineList& lines, std::list<TopoDS_Shape>& shapes)
+{
+    std::vector<TopoDS_Shape> edges(lines.size());
+    OSD_Parallel::For(0, static_cast<int>(lines.size()), [&](int index) {
+        BRepBuilderAPI_MakeEdge mkEdge(lines[index].first, lines[index].second);
+        if (mkEdge.IsDone()) {
+            edges[index] = mkEdge.Edge();
+        }
+    });
+    shapes.insert(shapes.end(), edges.begin(), edges.end());
+}
+
 void ImpExpDxfRead::setOptions()
 {
     ParameterGrp::handle hGrp =
@@ -213,7 +231,7 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start,
         // TODO: Really?? What about the people designing integrated circuits?
         return;
     }
-    Collector->AddObject(BRepBuilderAPI_MakeEdge(p0, p1).Edge(), "Line");
+    Collector->AddLine(p0, p1);
 }
 
 
@@ -732,6 +750,11 @@ std::string ImpExpDxfRead::Deformat(const char* text)
     return ss.str();
 }
 
+void ImpExpDxfRead::EntityCollector::AddLine(const gp_Pnt& start, const gp_Pnt& end)
+{
+    AddObject(BRepBuilderAPI_MakeEdge(start, end).Edge(), "Line");
+}
+
 void ImpExpDxfRead::DrawingEntityCollector::AddObject(const TopoDS_Shape& shape,
                                                       const char* nameBase)
 {
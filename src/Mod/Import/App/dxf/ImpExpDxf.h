@@ -23,6 +23,9 @@
 #ifndef IMPEXPDXF_H
 #define IMPEXPDXF_H
 
+#include <utility>
+#include <vector>
+
 #include <gp_Pnt.hxx>
 
 #include <App/Document.h>
@@ -116,6 +119,9 @@ private:
     // Combine all the shapes in the given shapes collection into a single shape, and AddObject that
     // to the drawing. unref's all the shapes in the collection, possibly freeing them.
     void CombineShapes(std::list<TopoDS_Shape>& shapes, const char* nameBase) const;
+    using LineList = std::vector<std::pair<gp_Pnt, gp_Pnt>>;
+    // Make the edges of the lines in parallel and append them to shapes
+    static void MakeLineEdges(const LineList& lines, std::list<TopoDS_Shape>& shapes);
     PyObject* DraftModule = nullptr;
 
 protected:
@@ -232,6 +238,8 @@ protected:
         // Because we can't readily copy Draft objects, this method instead takes a builder which,
         // when called, creates and returns the object.
         virtual void AddObject(FeaturePythonBuilder shapeBuilder) = 0;
+        // Called by OnReadLine, by default this adds the edge of the line as Part object
+        virtual void AddLine(const gp_Pnt& start, const gp_Pnt& end);
         // Called by OnReadInsert to either remember in a nested block or expand the block into the
         // drawing
         virtual void AddInsert(const Base::Vector3d& point,
@@ -266,21 +274,29 @@ protected:
     class ShapeSavingEntityCollector: public DrawingEntityCollector
     {
         // This places draft objects into the drawing but stashes away Shapes.
+        // The edges of lines are only made later on so that this can be done in parallel.
     public:
         ShapeSavingEntityCollector(
             ImpExpDxfRead& reader,
-            std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& shapesList)
+            std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& shapesList,
+            std::map<CDxfRead::CommonEntityAttributes, LineList>& linesList)
             : DrawingEntityCollector(reader)
             , ShapesList(shapesList)
+            , LinesList(linesList)
         {}
 
         void AddObject(const TopoDS_Shape& shape, const char* /*nameBase*/) override
         {
             ShapesList[Reader.m_entityAttributes].push_back(shape);
         }
+        void AddLine(const gp_Pnt& start, const gp_Pnt& end) override
+        {
+            LinesList[Reader.m_entityAttributes].emplace_back(start, end);
+        }
 
     private:
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& ShapesList;
+        std::map<CDxfRead::CommonEntityAttributes, LineList>& LinesList;
     };
 #ifdef LATER
     class PolylineEntityCollector: public CombiningDrawingEntityCollector
@@ -5,13 +5,18 @@
 
 #include "PreCompiled.h"
 
+#include <charconv>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <exception>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include "dxf.h"
 #include <App/Application.h>
@@ -21,6 +26,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Stream.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 #include <Base/Vector3D.h>
 
@@ -1809,6 +1815,7 @@ CDxfRead::CDxfRead(const std::string& filepath)
         return;
     }
     m_ifs->imbue(std::locale("C"));
+    m_buffer.resize(1 << 20);
 }
 
 CDxfRead::~CDxfRead()
@@ -1869,43 +1876,73 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 
 //
 // Static processing helpers for ProcessCommonEntityAttribute
-void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
+namespace
+{
+// Parses a number the same way as a stream with the "C" locale, without the overhead of a stream
+template<typename T>
+bool parseNumber(std::string_view text, T& value)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
+    std::size_t start = text.find_first_not_of(" \t");
+    if (start == std::string_view::npos) {
+        return false;
+    }
+    text.remove_prefix(start);
+    if (text.front() == '+') {
+        text.remove_prefix(1);
+    }
+#if defined(__cpp_lib_to_chars)
+    return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+#else
+    if constexpr (std::is_floating_point_v<T>) {
+        // libc++ doesn't support std::from_chars for floating point numbers yet
+        std::string str(text);
+        char* end = nullptr;
+        value = static_cast<T>(std::strtod(str.c_str(), &end));
+        return end != str.c_str();
+    }
+    else {
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+    }
+#endif
+}
+}  // namespace
 
-    ss.str(object->m_record_data);
+void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
+{
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!parseNumber(object->m_record_data, value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
+        value = 0;
     }
     *static_cast<double*>(target) = object->mm(value);
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!parseNumber(object->m_record_data, value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
+        value = 0;
     }
     static_cast<std::list<double>*>(target)->push_back(object->mm(value));
 }
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
+    bool failed = false;
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        failed = !parseNumber(object->m_record_data, *static_cast<T*>(target));
+    }
+    else {
+        std::istringstream ss;
+        ss.imbue(std::locale("C"));
 
-    ss.str(object->m_record_data);
-    ss >> *static_cast<T*>(target);
-    if (ss.fail()) {
+        ss.str(object->m_record_data);
+        ss >> *static_cast<T*>(target);
+        failed = ss.fail();
+    }
+    if (failed) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
         *static_cast<T*>(target) = 0;
@@ -2351,6 +2388,39 @@ void CDxfRead::UnsupportedFeature(const char* format, args&&... argValuess)
     }
 }
 
+bool CDxfRead::get_next_line(std::string_view& line)
+{
+    // The returned line points into the buffer and is only valid until the next call
+    while (true) {
+        const char* begin = m_buffer.data() + m_bufferPos;
+        std::size_t available = m_bufferSize - m_bufferPos;
+        if (const auto* end = static_cast<const char*>(std::memchr(begin, '\n', available))) {
+            line = std::string_view(begin, end - begin);
+            m_bufferPos += line.size() + 1;
+            return true;
+        }
+        if (!m_ifs->good()) {
+            // the last line of the file has no line end
+            if (available == 0) {
+                return false;
+            }
+            line = std::string_view(begin, available);
+            m_bufferPos = m_bufferSize;
+            return true;
+        }
+
+        // keep the incomplete line and append the next block of the file
+        std::memmove(m_buffer.data(), begin, available);
+        if (available == m_buffer.size()) {
+            m_buffer.resize(m_buffer.size() * 2);
+        }
+        m_ifs->read(m_buffer.data() + available,
+                    static_cast<std::streamsize>(m_buffer.size() - available));
+        m_bufferSize = available + static_cast<std::size_t>(m_ifs->gcount());
+        m_bufferPos = 0;
+    }
+}
+
 bool CDxfRead::get_next_record()
 {
     if (m_repeat_last_record) {
@@ -2358,35 +2428,34 @@ bool CDxfRead::get_next_record()
         return m_not_eof;
     }
 
+    std::string_view line;
     do {
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(line)) {
             m_not_eof = false;
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (!parseNumber(line, temp)) {
+            m_record_data = line;
             ImportError("CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
                         m_record_data);
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(line)) {
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
     } while (m_record_type == eComment);
 
     // Remove any carriage return at the end of m_str which may occur because of inconsistent
     // handling of LF vs. CRLF line termination.
-    auto last = m_record_data.rbegin();
-    if (last != m_record_data.rend() && *last == '\r') {
-        m_record_data.pop_back();
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
     }
+    // assigning keeps the capacity of m_record_data, so this doesn't allocate per record
+    m_record_data = line;
     // The code that was here just blindly trimmed leading white space, but if you have, for
     // instance, a TEXT entity whose text starts with spaces, or, more plausibly, a long TEXT entity
     // where the text is broken into one or more type-3 records with a final type-1 and the break
@@ -2643,6 +2712,7 @@ void CDxfRead::DoRead(const bool ignore_errors /* = false */)
     }
 
     try {
+        Base::TimeElapsed startTime;
         StartImport();
         // Loop reading the sections.
         while (get_next_record()) {
@@ -2664,6 +2734,9 @@ void CDxfRead::DoRead(const bool ignore_errors /* = false */)
             }
         }
         FinishImport();
+        Base::Console().log("DXF: imported %d lines in %.3f s\n",
+                            m_line,
+                            Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed()));
 
         // Flush out any unsupported features messages
         if (!m_unsupportedFeaturesNoted.empty()) {
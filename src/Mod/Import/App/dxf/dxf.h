@@ -19,6 +19,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <Base/Interpreter.h>
@@ -441,6 +442,10 @@ class ImportExport CDxfRead
 private:
     // Low-level reader members
     std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The file is read in blocks, get_next_record() splits them into lines
+    std::string m_buffer;
+    std::size_t m_bufferPos = 0;
+    std::size_t m_bufferSize = 0;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -664,6 +669,7 @@ private:
     bool ReadBlockInfo();
     bool ResolveEncoding();
 
+    bool get_next_line(std::string_view& line);
     bool get_next_record();
     void repeat_last_record();
 
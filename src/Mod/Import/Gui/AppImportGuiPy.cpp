@@ -311,7 +311,13 @@ private:
             if (mode >= 0) {
                 ocaf.setMode(mode);
             }
-            auto ret = ocaf.loadShapes();
+            App::DocumentObject* ret = nullptr;
+            {
+                // announce the imported objects at once, their colours need the view providers
+                App::Document::ObjectBatch batch(pcDoc);
+                ret = ocaf.loadShapes();
+            }
+            ocaf.applyDeferredColors();
             hApp->Close(hDoc);
             FC_DURATION_PLUS(d2, t);
             FC_DURATION_LOG(d1, "file read");
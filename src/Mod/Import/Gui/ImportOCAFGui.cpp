@@ -38,8 +38,32 @@ ImportOCAFGui::ImportOCAFGui(Handle(TDocStd_Document) hDoc,
     : ImportOCAF2(hDoc, pDoc, name)
 {}
 
+bool ImportOCAFGui::deferColors(App::DocumentObject* obj, std::function<void()> func)
+{
+    if (!obj->getDocument()->isBatchingObjects()) {
+        return false;
+    }
+    deferredColors.emplace_back(App::DocumentObjectT(obj), std::move(func));
+    return true;
+}
+
+void ImportOCAFGui::applyDeferredColors()
+{
+    auto deferred = std::move(deferredColors);
+    deferredColors.clear();
+    for (auto& entry : deferred) {
+        // the object may have been removed meanwhile, e.g. when merging
+        if (entry.first.getObject()) {
+            entry.second();
+        }
+    }
+}
+
 void ImportOCAFGui::applyFaceColors(Part::Feature* part, const std::vector<Base::Color>& colors)
 {
+    if (deferColors(part, [=]() { applyFaceColors(part, colors); })) {
+        return;
+    }
     auto vp = dynamic_cast<PartGui::ViewProviderPartExt*>(
         Gui::Application::Instance->getViewProvider(part));
     if (!vp) {
@@ -60,6 +84,9 @@ void ImportOCAFGui::applyFaceColors(Part::Feature* part, const std::vector<Base:
 
 void ImportOCAFGui::applyEdgeColors(Part::Feature* part, const std::vector<Base::Color>& colors)
 {
+    if (deferColors(part, [=]() { applyEdgeColors(part, colors); })) {
+        return;
+    }
     auto vp = dynamic_cast<PartGui::ViewProviderPartExt*>(
         Gui::Application::Instance->getViewProvider(part));
     if (!vp) {
@@ -75,6 +102,9 @@ void ImportOCAFGui::applyEdgeColors(Part::Feature* part, const std::vector<Base:
 
 void ImportOCAFGui::applyLinkColor(App::DocumentObject* obj, int index, Base::Color color)
 {
+    if (deferColors(obj, [=]() { applyLinkColor(obj, index, color); })) {
+        return;
+    }
     auto vp =
         dynamic_cast<Gui::ViewProviderLink*>(Gui::Application::Instance->getViewProvider(obj));
     if (!vp) {
@@ -25,6 +25,11 @@
 #ifndef IMPORT_IMPORTOCAFGUI_H
 #define IMPORT_IMPORTOCAFGUI_H
 
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <App/DocumentObserver.h>
 #include <Mod/Import/App/ImportOCAF2.h>
 
 namespace ImportGui
@@ -35,12 +40,21 @@ class ImportOCAFGui: public Import::ImportOCAF2
 public:
     ImportOCAFGui(Handle(TDocStd_Document) hDoc, App::Document* pDoc, const std::string& name);
 
+    /** Applies the colours held back while the objects were created in an
+     * App::Document::ObjectBatch, i.e. had no view provider yet.
+     */
+    void applyDeferredColors();
+
 private:
+    bool deferColors(App::DocumentObject* obj, std::function<void()> func);
     void applyFaceColors(Part::Feature* part, const std::vector<Base::Color>& colors) override;
     void applyEdgeColors(Part::Feature* part, const std::vector<Base::Color>& colors) override;
     void applyLinkColor(App::DocumentObject* obj, int index, Base::Color color) override;
     void applyElementColors(App::DocumentObject* obj,
                             const std::map<std::string, Base::Color>& colors) override;
+
+private:
+    std::vector<std::pair<App::DocumentObjectT, std::function<void()>>> deferredColors;
 };
 
 }  // namespace ImportGui
@@ -23,7 +23,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/core/ignore_unused.hpp>
+#include <chrono>
 #include <numeric>
 #include <limits>
 
@@ -41,12 +43,14 @@
 #include <QtConcurrentMap>
 #endif
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/FutureWatcherProgress.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -64,9 +68,15 @@ namespace sp = std::placeholders;
 InspectActualMesh::InspectActualMesh(const Mesh::MeshObject& rMesh)
     : _mesh(rMesh.getKernel())
 {
+    // transform all points at once instead of every single point on access
     Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
+    Base::Matrix4D mat = rMesh.getTransform();
+    _bApply = mat != tmp;
+    if (_bApply) {
+        const MeshCore::MeshPointArray& points = _mesh.GetPoints();
+        _points.assign(points.begin(), points.end());
+        mat.transformPoints(std::span<Base::Vector3f>(_points));
+    }
 }
 
 InspectActualMesh::~InspectActualMesh() = default;
@@ -78,11 +88,10 @@ unsigned long InspectActualMesh::countPoints() const
 
 Base::Vector3f InspectActualMesh::getPoint(unsigned long index) const
 {
-    Base::Vector3f point = _mesh.GetPoint(index);
     if (_bApply) {
-        _clTrf.multVec(point, point);
+        return _points[index];
     }
-    return point;
+    return _mesh.GetPoint(index);
 }
 
 // ----------------------------------------------------------------
@@ -437,6 +446,51 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
+InspectNominalMeshTree::InspectNominalMeshTree(const Mesh::MeshObject& rMesh, float offset)
+    : _mesh(rMesh.getKernel())
+    , _offset(offset)
+{
+    Base::Matrix4D tmp;
+    _clTrf = rMesh.getTransform();
+    _bApply = _clTrf != tmp;
+
+    _pTree = new MeshCore::MeshFacetTree(_mesh, _clTrf);
+    _box = _mesh.GetBoundBox().Transformed(_clTrf);
+    _box.Enlarge(offset);
+}
+
+InspectNominalMeshTree::~InspectNominalMeshTree()
+{
+    delete this->_pTree;
+}
+
+float InspectNominalMeshTree::getDistance(const Base::Vector3f& point) const
+{
+    if (!_box.IsInBox(point)) {
+        return std::numeric_limits<float>::max();  // must be inside bbox
+    }
+
+    // facets outside of the search radius are rejected by the caller anyway
+    float fDist {};
+    MeshCore::FacetIndex index = _pTree->NearestFacet(point, _offset, fDist);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
+    }
+
+    MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(index);
+    if (_bApply) {
+        geomFace.Transform(_clTrf);
+    }
+
+    float fMinDist = geomFace.DistanceToPoint(point);
+    if (point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) <= 0) {
+        fMinDist = -fMinDist;
+    }
+    return fMinDist;
+}
+
+// ----------------------------------------------------------------
+
 InspectNominalPoints::InspectNominalPoints(const Points::PointKernel& Kernel, float /*offset*/)
     : _rKernel(Kernel)
 {
@@ -486,6 +540,7 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
         if (xp.More()) {
             distss->LoadS1(xp.Current());
             isSolid = true;
+            classifier = new BRepClass3d_SolidClassifier(_rShape);
         }
     }
     // distss->SetDeflection(radius);
@@ -494,6 +549,7 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
 InspectNominalShape::~InspectNominalShape()
 {
     delete distss;
+    delete classifier;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
@@ -524,9 +580,8 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
 {
     const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    classifier->Perform(pnt3d, tol);
+    return (classifier->State() == TopAbs_IN);
 }
 
 bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
@@ -556,6 +611,81 @@ bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
 
 // ----------------------------------------------------------------
 
+InspectNominalFastShape::InspectNominalFastShape(const Part::TopoShape& shape, float offset)
+    : _rShape(shape)
+    , _offset(offset)
+{
+    // The tessellation only has to reject the points outside of the search radius,
+    // the other points are refined on the shape anyway
+    double deflection = shape.getAccuracy();
+    if (offset > 0) {
+        deflection = std::min<double>(deflection, offset);
+    }
+
+    std::vector<Base::Vector3d> points;
+    std::vector<Data::ComplexGeoData::Facet> faces;
+    shape.getFaces(points, faces, deflection);
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.reserve(faces.size());
+    for (const auto& it : faces) {
+        facets.emplace_back(Base::toVector<float>(points[it.I1]),
+                            Base::toVector<float>(points[it.I2]),
+                            Base::toVector<float>(points[it.I3]));
+    }
+
+    _pTree = new MeshCore::MeshFacetTree(facets);
+    // the deviation of the tessellation with some margin
+    _tolerance = float(2.0 * deflection);
+}
+
+InspectNominalFastShape::~InspectNominalFastShape()
+{
+    delete this->_pTree;
+}
+
+float InspectNominalFastShape::getDistance(const Base::Vector3f& point) const
+{
+    // a shape without faces cannot be tessellated, then all points are refined
+    if (_pTree->CountFacets() > 0) {
+        float fDist {};
+        if (_pTree->NearestFacet(point, _offset + _tolerance, fDist) == MeshCore::FACET_INDEX_MAX) {
+            return std::numeric_limits<float>::max();  // outside of the search radius
+        }
+    }
+
+    InspectNominalShape* shape = acquireShape();
+    try {
+        float fMinDist = shape->getDistance(point);
+        releaseShape(shape);
+        return fMinDist;
+    }
+    catch (...) {
+        releaseShape(shape);
+        throw;
+    }
+}
+
+InspectNominalShape* InspectNominalFastShape::acquireShape() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeShapes.empty()) {
+        _shapes.push_back(std::make_unique<InspectNominalShape>(_rShape.getShape(), _offset));
+        return _shapes.back().get();
+    }
+
+    InspectNominalShape* shape = _freeShapes.back();
+    _freeShapes.pop_back();
+    return shape;
+}
+
+void InspectNominalFastShape::releaseShape(InspectNominalShape* shape) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _freeShapes.push_back(shape);
+}
+
+// ----------------------------------------------------------------
+
 TYPESYSTEM_SOURCE(Inspection::PropertyDistanceList, App::PropertyLists)
 
 PropertyDistanceList::PropertyDistanceList() = default;
@@ -818,6 +948,12 @@ App::DocumentObjectExecReturn* Feature::execute()
         throw Base::TypeError("Unknown geometric type");
     }
 
+    // the search tree is optional as long as the grid is the reference
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Inspection");
+    bool useSearchTree = hGrp->GetBool("MeshSearchTree", false);
+    bool useFastShape = hGrp->GetBool("ShapeSearchTree", false);
+
     // clang-format off
     // get a list of nominals
     std::vector<InspectNominalGeometry*> inspectNominal;
@@ -826,16 +962,26 @@ App::DocumentObjectExecReturn* Feature::execute()
         InspectNominalGeometry* nominal = nullptr;
         if (it->isDerivedFrom<Mesh::Feature>()) {
             Mesh::Feature* mesh = static_cast<Mesh::Feature*>(it);
-            nominal = new InspectNominalMesh(mesh->Mesh.getValue(), this->SearchRadius.getValue());
+            if (useSearchTree) {
+                nominal = new InspectNominalMeshTree(mesh->Mesh.getValue(), this->SearchRadius.getValue());
+            }
+            else {
+                nominal = new InspectNominalMesh(mesh->Mesh.getValue(), this->SearchRadius.getValue());
+            }
         }
         else if (it->isDerivedFrom<Points::Feature>()) {
             Points::Feature* pts = static_cast<Points::Feature*>(it);
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            if (useFastShape) {
+                nominal = new InspectNominalFastShape(part->Shape.getShape(), this->SearchRadius.getValue());
+            }
+            else {
+                useMultithreading = false;
+                nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            }
         }
 
         if (nominal) {
@@ -900,7 +1046,8 @@ App::DocumentObjectExecReturn* Feature::execute()
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), fRMS);
 #else
     unsigned long count = actual->countPoints();
-    std::vector<float> vals(count);
+    // points that are not inspected yet are shown as out of range
+    std::vector<float> vals(count, std::numeric_limits<float>::max());
     std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
         DistanceInspectionRMS res;
         Base::Vector3f pnt = actual->getPoint(index);
@@ -931,29 +1078,44 @@ App::DocumentObjectExecReturn* Feature::execute()
     DistanceInspectionRMS res;
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS
-        // computation
-        QFuture<DistanceInspectionRMS> future =
-            QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
+        // Inspect the points in blocks so that the distances computed so far
+        // can be shown while the rest is still running
+        const unsigned long blockSize = std::max<unsigned long>(count / 16, 100000);
+        const auto publishInterval = std::chrono::seconds(1);
+        auto lastPublish = std::chrono::steady_clock::now();
         // Setup progress bar
         Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
-        QObject::connect(&watcher,
-                         &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
-                         &progress,
-                         &Base::FutureWatcherProgress::progressValueChanged);
-        // Keep UI responsive during computation
-        QEventLoop loop;
-        QObject::connect(&watcher,
-                         &QFutureWatcher<DistanceInspectionRMS>::finished,
-                         &loop,
-                         &QEventLoop::quit);
-        watcher.setFuture(future);
-        loop.exec();
-        res = future.result();
+        for (unsigned long start = 0; start < count; start += blockSize) {
+            // Build vector of increasing indices
+            std::vector<unsigned long> index(std::min(blockSize, count - start));
+            std::iota(index.begin(), index.end(), start);
+            // Perform map-reduce operation : compute distances and update sum of squares for
+            // RMS computation
+            QFuture<DistanceInspectionRMS> future =
+                QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
+            QFutureWatcher<DistanceInspectionRMS> watcher;
+            QObject::connect(&watcher,
+                             &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
+                             &progress,
+                             [&progress, start](int value) {
+                                 progress.progressValueChanged(static_cast<int>(start) + value);
+                             });
+            // Keep UI responsive during computation
+            QEventLoop loop;
+            QObject::connect(&watcher,
+                             &QFutureWatcher<DistanceInspectionRMS>::finished,
+                             &loop,
+                             &QEventLoop::quit);
+            watcher.setFuture(future);
+            loop.exec();
+            res += future.result();
+
+            auto now = std::chrono::steady_clock::now();
+            if (start + blockSize < count && now - lastPublish >= publishInterval) {
+                Distances.setValues(vals);
+                lastPublish = now;
+            }
+        }
     }
     else {
         // Single-threaded operation
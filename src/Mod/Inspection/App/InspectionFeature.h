@@ -23,6 +23,10 @@
 #ifndef INSPECTION_FEATURE_H
 #define INSPECTION_FEATURE_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -31,6 +35,7 @@
 
 
 class TopoDS_Shape;
+class BRepClass3d_SolidClassifier;
 class BRepExtrema_DistShapeShape;
 class gp_Pnt;
 
@@ -38,6 +43,7 @@ namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshFacetTree;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -78,7 +84,7 @@ public:
 private:
     const MeshCore::MeshKernel& _mesh;
     bool _bApply;
-    Base::Matrix4D _clTrf;
+    std::vector<Base::Vector3f> _points;
 };
 
 class InspectionExport InspectActualPoints: public InspectActualGeometry
@@ -147,6 +153,25 @@ protected:
     Base::Matrix4D _clTrf;
 };
 
+/** Like InspectNominalMesh but uses a bounding volume hierarchy instead of a grid which
+ * doesn't degenerate with very uneven facet sizes.
+ */
+class InspectionExport InspectNominalMeshTree: public InspectNominalGeometry
+{
+public:
+    InspectNominalMeshTree(const Mesh::MeshObject& rMesh, float offset);
+    ~InspectNominalMeshTree() override;
+    float getDistance(const Base::Vector3f&) const override;
+
+private:
+    const MeshCore::MeshKernel& _mesh;
+    MeshCore::MeshFacetTree* _pTree;
+    Base::BoundBox3f _box;
+    float _offset;
+    bool _bApply;
+    Base::Matrix4D _clTrf;
+};
+
 class InspectionExport InspectNominalPoints: public InspectNominalGeometry
 {
 public:
@@ -172,10 +197,37 @@ private:
 
 private:
     BRepExtrema_DistShapeShape* distss;
+    BRepClass3d_SolidClassifier* classifier {nullptr};
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
 
+/** Calculates the distance to a shape from several threads. The distance is first
+ * computed on a tessellation of the shape. Only points that may be within the search
+ * radius are refined on the exact shape. The OCC algorithms aren't thread-safe, so
+ * every thread uses its own InspectNominalShape for this.
+ */
+class InspectionExport InspectNominalFastShape: public InspectNominalGeometry
+{
+public:
+    InspectNominalFastShape(const Part::TopoShape&, float offset);
+    ~InspectNominalFastShape() override;
+    float getDistance(const Base::Vector3f&) const override;
+
+private:
+    InspectNominalShape* acquireShape() const;
+    void releaseShape(InspectNominalShape*) const;
+
+private:
+    const Part::TopoShape& _rShape;
+    MeshCore::MeshFacetTree* _pTree;
+    float _offset;
+    float _tolerance;
+    mutable std::mutex _mutex;
+    mutable std::vector<std::unique_ptr<InspectNominalShape>> _shapes;
+    mutable std::vector<InspectNominalShape*> _freeShapes;
+};
+
 class InspectionExport PropertyDistanceList: public App::PropertyLists
 {
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <future>
+#include <thread>
+
 #include <QApplication>
 #include <QMenu>
 #include <QMessageBox>
@@ -63,6 +66,30 @@
 
 using namespace InspectionGui;
 
+namespace
+{
+
+// Split [0, count) into one chunk per core and process them concurrently
+template<typename Func>
+void parallelFor(std::size_t count, Func&& func)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / 100000));
+    std::size_t chunk = (count + threads - 1) / threads;
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < threads; t++) {
+        futures.push_back(std::async(std::launch::async, [&func, t, chunk, count]() {
+            func(t * chunk, std::min(count, (t + 1) * chunk));
+        }));
+    }
+    func(0, std::min(count, chunk));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace
 
 bool ViewProviderInspection::addflag = false;
 App::PropertyFloatConstraint::Constraints ViewProviderInspection::floatRange = {1.0, 64.0, 1.0};
@@ -424,17 +451,21 @@ void ViewProviderInspection::setDistances()
     SbColor* cols = pcColorMat->diffuseColor.startEditing();
     float* tran = pcColorMat->transparency.startEditing();
 
-    unsigned long j = 0;
-    for (std::vector<float>::const_iterator jt = fValues.begin(); jt != fValues.end(); ++jt, j++) {
-        Base::Color col = pcColorBar->getColor(*jt);
-        cols[j] = SbColor(col.r, col.g, col.b);
-        if (pcColorBar->isVisible(*jt)) {
-            tran[j] = 0.0f;
-        }
-        else {
-            tran[j] = 0.8f;
+    // the colour mapping itself doesn't touch any Coin field, so resolve the
+    // active bar once and map the values concurrently
+    const Gui::SoFCColorBarBase* bar = pcColorBar->getActiveBar();
+    parallelFor(fValues.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t j = begin; j < end; j++) {
+            Base::Color col = bar->getColor(fValues[j]);
+            cols[j] = SbColor(col.r, col.g, col.b);
+            if (bar->isVisible(fValues[j])) {
+                tran[j] = 0.0f;
+            }
+            else {
+                tran[j] = 0.8f;
+            }
         }
-    }
+    });
 
     pcColorMat->diffuseColor.finishEditing();
     pcColorMat->transparency.finishEditing();
@@ -23,10 +23,13 @@
 #ifndef _PreComp_
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QFuture>
 #include <QList>
 #include <QMetaType>
 #include <QRegularExpression>
+#include <QSaveFile>
 #include <QString>
+#include <QtConcurrentRun>
 #endif
 
 #include <App/Application.h>
@@ -363,7 +366,141 @@ MaterialLoader::MaterialLoader(
     : _materialMap(materialMap)
     , _libraryList(libraryList)
 {
+    loadIndex();
     loadLibraries(libraryList);
+    if (_indexChanged || _newIndex.size() != _index.size()) {
+        saveIndex();
+    }
+}
+
+//===
+//
+// The material index caches the parsed YAML of every material file together with the file's
+// modification time and size. Libraries frequently live on slow or network shares, so on
+// start-up only the directory listing is read and unchanged files are never opened.
+//
+//===
+
+namespace
+{
+constexpr int materialIndexVersion = 1;
+}
+
+bool MaterialLoader::IndexEntry::matches(const QFileInfo& file) const
+{
+    return modified == file.lastModified().toMSecsSinceEpoch() && size == file.size();
+}
+
+QString MaterialLoader::getIndexPath()
+{
+    QDir cache(QString::fromStdString(App::Application::getUserCachePath()));
+    return cache.filePath(QStringLiteral("Material/MaterialIndex.yml"));
+}
+
+void MaterialLoader::loadIndex()
+{
+    QString indexPath = getIndexPath();
+    if (!QFileInfo(indexPath).isFile()) {
+        return;
+    }
+
+    Base::FileInfo info(indexPath.toStdString());
+    Base::ifstream fin(info);
+    if (!fin) {
+        return;
+    }
+
+    try {
+        YAML::Node root = YAML::Load(fin);
+        if (root["Version"].as<int>(0) != materialIndexVersion) {
+            return;
+        }
+        for (const auto& it : root["Files"]) {
+            IndexEntry entry {it["Modified"].as<qint64>(),
+                              it["Size"].as<qint64>(),
+                              it["Material"]};
+            _index[QString::fromStdString(it["Path"].as<std::string>())] = entry;
+        }
+    }
+    catch (const YAML::Exception& e) {
+        // A damaged index is rebuilt from the library files
+        Base::Console().log("Ignoring material index '%s': %s\n",
+                            indexPath.toStdString().c_str(),
+                            e.what());
+        _index.clear();
+    }
+}
+
+void MaterialLoader::saveIndex() const
+{
+    // Deep copy the nodes so the writer thread shares no memory with the material entries
+    YAML::Node files(YAML::NodeType::Sequence);
+    for (const auto& [path, entry] : _newIndex) {
+        YAML::Node node;
+        node["Path"] = path.toStdString();
+        node["Modified"] = entry.modified;
+        node["Size"] = entry.size;
+        node["Material"] = YAML::Clone(entry.yaml);
+        files.push_back(node);
+    }
+
+    YAML::Node root;
+    root["Version"] = materialIndexVersion;
+    root["Files"] = files;
+
+    // Only one writer at a time, a refresh may start a new one while the last is still busy
+    static QFuture<void> pending;
+    pending.waitForFinished();
+    pending = QtConcurrent::run(&MaterialLoader::writeIndex, root, getIndexPath());
+}
+
+void MaterialLoader::writeIndex(const YAML::Node& root, const QString& indexPath)
+{
+    QFileInfo info(indexPath);
+    if (!QDir().mkpath(info.absolutePath())) {
+        return;
+    }
+
+    YAML::Emitter out;
+    out << root;
+
+    // QSaveFile replaces the index atomically so a concurrent reader never sees a partial file
+    QSaveFile file(indexPath);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(out.c_str(), static_cast<qint64>(out.size()));
+        if (!file.commit()) {
+            Base::Console().log("Unable to write material index '%s'\n",
+                                indexPath.toStdString().c_str());
+        }
+    }
+}
+
+std::shared_ptr<MaterialEntry>
+MaterialLoader::getMaterialFromIndex(const std::shared_ptr<MaterialLibraryLocal>& library,
+                                     const QFileInfo& file,
+                                     const QString& path)
+{
+    auto entry = _index.find(path);
+    if (entry == _index.end() || !entry->second.matches(file)) {
+        return nullptr;
+    }
+
+    return getMaterialFromYAML(library, entry->second.yaml, path);
+}
+
+void MaterialLoader::addToIndex(const QFileInfo& file,
+                                const QString& path,
+                                const std::shared_ptr<MaterialEntry>& model)
+{
+    // Legacy configuration style files are not indexed
+    auto yamlEntry = std::dynamic_pointer_cast<MaterialYamlEntry>(model);
+    if (!yamlEntry) {
+        return;
+    }
+
+    _newIndex[path] = IndexEntry {file.lastModified().toMSecsSinceEpoch(),
+                                  file.size(),
+                                  yamlEntry->getModel()};
 }
 
 void MaterialLoader::addLibrary(const std::shared_ptr<MaterialLibraryLocal>& model)
@@ -537,14 +674,21 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibraryLocal>& li
 
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
-        auto pathname = it.next();
-        QFileInfo file(pathname);
+        it.next();
+        QFileInfo file = it.fileInfo();
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
                 try {
-                    auto model = getMaterialFromPath(library, file.canonicalFilePath());
+                    auto path = file.canonicalFilePath();
+                    auto model = getMaterialFromIndex(library, file, path);
+                    bool indexed = (model != nullptr);
+                    if (!indexed) {
+                        model = getMaterialFromPath(library, path);
+                    }
                     if (model) {
                         (*_materialEntryMap)[model->getUUID()] = model;
+                        addToIndex(file, path, model);
+                        _indexChanged = _indexChanged || !indexed;
                     }
                 }
                 catch (const MaterialReadError&) {
@@ -22,9 +22,11 @@
 #ifndef MATERIAL_MATERIALLOADER_H
 #define MATERIAL_MATERIALLOADER_H
 
+#include <map>
 #include <memory>
 
 #include <QDir>
+#include <QFileInfo>
 #include <QString>
 #include <yaml-cpp/yaml.h>
 
@@ -130,6 +132,29 @@ public:
 private:
     MaterialLoader();
 
+    /// Cached YAML of a material file, valid while the file's time stamp and size are unchanged
+    struct IndexEntry
+    {
+        qint64 modified;
+        qint64 size;
+        YAML::Node yaml;
+
+        bool matches(const QFileInfo& file) const;
+    };
+    using Index = std::map<QString, IndexEntry>;
+
+    static QString getIndexPath();
+    static void writeIndex(const YAML::Node& root, const QString& indexPath);
+    void loadIndex();
+    void saveIndex() const;
+    std::shared_ptr<MaterialEntry>
+    getMaterialFromIndex(const std::shared_ptr<MaterialLibraryLocal>& library,
+                         const QFileInfo& file,
+                         const QString& path);
+    void addToIndex(const QFileInfo& file,
+                    const QString& path,
+                    const std::shared_ptr<MaterialEntry>& model);
+
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
     std::shared_ptr<MaterialEntry>
@@ -142,6 +167,9 @@ private:
     static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
+    Index _index;
+    Index _newIndex;
+    bool _indexChanged = false;
 };
 
 }  // namespace Materials
@@ -45,6 +45,7 @@
 #include <Mod/Part/App/TopoShapePy.h>
 #include "Mod/Part/App/OCCError.h"
 
+#include "Measurement.h"
 #include "ShapeFinder.h"
 
 
@@ -94,6 +95,28 @@ public:
             "Part.TopoShape = Measure.getLocatedTopoShape(DocumentObject, longSubElement) Resolves "
             "the net placement of DocumentObject and returns the object's shape/subshape with the "
             "net placement applied.  Link scaling operations along the path are also applied.");
+        add_varargs_method(
+            "measureLengths",
+            &Module::measureLengths,
+            "tuple = Measure.measureLengths([(DocumentObject, longSubElement), ...]) Returns the "
+            "length of each referenced shape.  Entries that cannot be measured are NaN.");
+        add_varargs_method(
+            "measureAreas",
+            &Module::measureAreas,
+            "tuple = Measure.measureAreas([(DocumentObject, longSubElement), ...]) Returns the "
+            "area of each referenced shape.  Entries that cannot be measured are NaN.");
+        add_varargs_method(
+            "measureVolumes",
+            &Module::measureVolumes,
+            "tuple = Measure.measureVolumes([(DocumentObject, longSubElement), ...]) Returns the "
+            "volume of each referenced shape.  Entries that cannot be measured are NaN.");
+        add_varargs_method(
+            "measureDistances",
+            &Module::measureDistances,
+            "tuple = Measure.measureDistances(references1, references2) Returns the minimum "
+            "distance between the shapes of references1[i] and references2[i].  Both arguments "
+            "are lists of (DocumentObject, longSubElement) of equal length.  Entries that cannot "
+            "be measured are NaN.");
         initialize("This is a module for measuring");  // register with Python
     }
     ~Module() override
@@ -165,6 +188,82 @@ private:
         auto topoShapePy = new Part::TopoShapePy(new Part::TopoShape(temp));
         return Py::asObject(topoShapePy);
     }
+
+    // converts a sequence of (DocumentObject, subname) to the parallel lists used by Measurement
+    static void getReferences(const Py::Object& pyReferences,
+                              std::vector<App::DocumentObject*>& objects,
+                              std::vector<std::string>& subElements)
+    {
+        Py::Sequence sequence(pyReferences);
+        objects.reserve(sequence.size());
+        subElements.reserve(sequence.size());
+        for (const auto& item : sequence) {
+            Py::Sequence pair(item);
+            if (pair.size() != 2
+                || !PyObject_TypeCheck(pair[0].ptr(), &(App::DocumentObjectPy::Type))) {
+                throw Py::TypeError("expected a list of (DocumentObject, subname)");
+            }
+            objects.push_back(
+                static_cast<App::DocumentObjectPy*>(pair[0].ptr())->getDocumentObjectPtr());
+            subElements.push_back(Py::String(pair[1]).as_std_string("utf-8"));
+        }
+    }
+
+    static Py::Tuple asTuple(const std::vector<double>& values)
+    {
+        Py::Tuple tuple(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            tuple.setItem(i, Py::Float(values[i]));
+        }
+        return tuple;
+    }
+
+    template<typename Func>
+    Py::Object measureReferences(const Py::Tuple& args, Func measure)
+    {
+        PyObject* pyReferences {nullptr};
+        if (!PyArg_ParseTuple(args.ptr(), "O", &pyReferences)) {
+            throw Py::Exception();
+        }
+
+        std::vector<App::DocumentObject*> objects;
+        std::vector<std::string> subElements;
+        getReferences(Py::Object(pyReferences), objects, subElements);
+        return asTuple(measure(objects, subElements));
+    }
+
+    Py::Object measureLengths(const Py::Tuple& args)
+    {
+        return measureReferences(args, &Measurement::lengths);
+    }
+
+    Py::Object measureAreas(const Py::Tuple& args)
+    {
+        return measureReferences(args, &Measurement::areas);
+    }
+
+    Py::Object measureVolumes(const Py::Tuple& args)
+    {
+        return measureReferences(args, &Measurement::volumes);
+    }
+
+    Py::Object measureDistances(const Py::Tuple& args)
+    {
+        PyObject* pyReferences1 {nullptr};
+        PyObject* pyReferences2 {nullptr};
+        if (!PyArg_ParseTuple(args.ptr(), "OO", &pyReferences1, &pyReferences2)) {
+            throw Py::Exception();
+        }
+
+        std::vector<App::DocumentObject*> objects1, objects2;
+        std::vector<std::string> subElements1, subElements2;
+        getReferences(Py::Object(pyReferences1), objects1, subElements1);
+        getReferences(Py::Object(pyReferences2), objects2, subElements2);
+        if (objects1.size() != objects2.size()) {
+            throw Py::ValueError("both reference lists must have the same length");
+        }
+        return asTuple(Measurement::distances(objects1, subElements1, objects2, subElements2));
+    }
 };
 
 }  // namespace Measure
@@ -35,10 +35,12 @@
 #include <gp_Sphere.hxx>
 #include <gp_Lin.hxx>
 #include <GProp_GProps.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #endif
 
+#include <limits>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
@@ -71,6 +73,7 @@ void Measurement::clear()
     std::vector<std::string> SubElements;
     References3D.setValues(Objects, SubElements);
     measureType = MeasureType::Invalid;
+    resolvedShapes.clear();
 }
 
 bool Measurement::has3DReferences()
@@ -94,6 +97,7 @@ int Measurement::addReference3D(App::DocumentObject* obj, const char* subName)
     subElements.emplace_back(subName);
 
     References3D.setValues(objects, subElements);
+    resolvedShapes.clear();
 
     measureType = findType();
     return References3D.getSize();
@@ -284,8 +288,27 @@ MeasureType Measurement::getType()
     return measureType;
 }
 
+void Measurement::resolveShapes()
+{
+    resolvedShapes.clear();
+    const std::vector<App::DocumentObject*>& objects = References3D.getValues();
+    const std::vector<std::string>& subElements = References3D.getSubValues();
+    for (std::size_t i = 0; i < objects.size(); i++) {
+        auto key = std::make_pair(objects[i], subElements[i]);
+        if (resolvedShapes.find(key) == resolvedShapes.end()) {
+            resolvedShapes[key] = ShapeFinder::getLocatedShape(*objects[i], subElements[i]);
+        }
+    }
+}
+
 TopoDS_Shape Measurement::getShape(App::DocumentObject* obj, const char* subName) const
 {
+    if (!resolvedShapes.empty()) {
+        auto it = resolvedShapes.find(std::make_pair(obj, std::string(subName)));
+        if (it != resolvedShapes.end()) {
+            return it->second;
+        }
+    }
     return ShapeFinder::getLocatedShape(*obj, subName);
 }
 
@@ -324,47 +347,146 @@ double Measurement::length() const
 
                 //  Get the length of one edge
                 TopoDS_Shape shape = getShape(*obj, (*subEl).c_str());
-                const TopoDS_Edge& edge = TopoDS::Edge(shape);
-                BRepAdaptor_Curve curve(edge);
-
-                switch (curve.GetType()) {
-                    case GeomAbs_Line: {
-                        gp_Pnt P1 = curve.Value(curve.FirstParameter());
-                        gp_Pnt P2 = curve.Value(curve.LastParameter());
-                        gp_XYZ diff = P2.XYZ() - P1.XYZ();
-                        result += diff.Modulus();
-                        break;
-                    }
-                    case GeomAbs_Circle: {
-                        double u = curve.FirstParameter();
-                        double v = curve.LastParameter();
-                        double radius = curve.Circle().Radius();
-                        if (u > v) {  // if arc is reversed
-                            std::swap(u, v);
-                        }
-
-                        double range = v - u;
-                        result += radius * range;
-                        break;
-                    }
-                    case GeomAbs_Ellipse:
-                    case GeomAbs_BSplineCurve:
-                    case GeomAbs_Hyperbola:
-                    case GeomAbs_BezierCurve: {
-                        result += GCPnts_AbscissaPoint::Length(curve);
-                        break;
-                    }
-                    default: {
-                        throw Base::RuntimeError(
-                            "Measurement - length - Curve type not currently handled");
-                    }
-                }  // end switch
+                result += edgeLength(TopoDS::Edge(shape));
             }  // end for
         }
     }
     return result;
 }
 
+double Measurement::edgeLength(const TopoDS_Edge& edge)
+{
+    BRepAdaptor_Curve curve(edge);
+
+    switch (curve.GetType()) {
+        case GeomAbs_Line: {
+            gp_Pnt P1 = curve.Value(curve.FirstParameter());
+            gp_Pnt P2 = curve.Value(curve.LastParameter());
+            gp_XYZ diff = P2.XYZ() - P1.XYZ();
+            return diff.Modulus();
+        }
+        case GeomAbs_Circle: {
+            double u = curve.FirstParameter();
+            double v = curve.LastParameter();
+            double radius = curve.Circle().Radius();
+            if (u > v) {  // if arc is reversed
+                std::swap(u, v);
+            }
+
+            double range = v - u;
+            return radius * range;
+        }
+        case GeomAbs_Ellipse:
+        case GeomAbs_BSplineCurve:
+        case GeomAbs_Hyperbola:
+        case GeomAbs_BezierCurve: {
+            return GCPnts_AbscissaPoint::Length(curve);
+        }
+        default: {
+            throw Base::RuntimeError("Measurement - length - Curve type not currently handled");
+        }
+    }  // end switch
+}
+
+namespace
+{
+// Runs measure(i) for every index in parallel. OCC algorithms are instantiated inside measure,
+// so every thread works with its own tools. A failing entry is reported as NaN, the worker
+// threads must not touch the console.
+template<typename Func>
+std::vector<double> measureParallel(size_t count, Func measure)
+{
+    std::vector<double> result(count, std::numeric_limits<double>::quiet_NaN());
+    OSD_Parallel::For(0, static_cast<int>(count), [&](int i) {
+        try {
+            result[i] = measure(i);
+        }
+        catch (const Standard_Failure&) {
+        }
+        catch (const Base::Exception&) {
+        }
+    });
+    return result;
+}
+}  // namespace
+
+std::vector<double> Measurement::lengths(const std::vector<App::DocumentObject*>& objects,
+                                         const std::vector<std::string>& subElements)
+{
+    auto shapes = ShapeFinder::getLocatedShapes(objects, subElements);
+    return measureParallel(shapes.size(), [&shapes](int i) {
+        const TopoDS_Shape& shape = shapes[i];
+        if (shape.IsNull()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (shape.ShapeType() == TopAbs_EDGE) {
+            return edgeLength(TopoDS::Edge(shape));
+        }
+        GProp_GProps props;
+        BRepGProp::LinearProperties(shape, props);
+        return props.Mass();
+    });
+}
+
+std::vector<double> Measurement::areas(const std::vector<App::DocumentObject*>& objects,
+                                       const std::vector<std::string>& subElements)
+{
+    auto shapes = ShapeFinder::getLocatedShapes(objects, subElements);
+    return measureParallel(shapes.size(), [&shapes](int i) {
+        if (shapes[i].IsNull()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        GProp_GProps props;
+        BRepGProp::SurfaceProperties(shapes[i], props);
+        return props.Mass();
+    });
+}
+
+std::vector<double> Measurement::volumes(const std::vector<App::DocumentObject*>& objects,
+                                         const std::vector<std::string>& subElements)
+{
+    auto shapes = ShapeFinder::getLocatedShapes(objects, subElements);
+    return measureParallel(shapes.size(), [&shapes](int i) {
+        if (shapes[i].IsNull()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(shapes[i], props);
+        return props.Mass();
+    });
+}
+
+std::vector<double> Measurement::distances(const std::vector<App::DocumentObject*>& objects1,
+                                           const std::vector<std::string>& subElements1,
+                                           const std::vector<App::DocumentObject*>& objects2,
+                                           const std::vector<std::string>& subElements2)
+{
+    if (objects1.size() != objects2.size()) {
+        throw Base::ValueError("Measurement::distances - reference lists differ in size");
+    }
+
+    // Resolve both sides in one go so that elements shared between the sides resolve once
+    std::vector<App::DocumentObject*> objects(objects1);
+    objects.insert(objects.end(), objects2.begin(), objects2.end());
+    std::vector<std::string> subElements(subElements1);
+    subElements.insert(subElements.end(), subElements2.begin(), subElements2.end());
+    auto shapes = ShapeFinder::getLocatedShapes(objects, subElements);
+
+    const size_t count = objects1.size();
+    return measureParallel(count, [&shapes, count](int i) {
+        const TopoDS_Shape& shape1 = shapes[i];
+        const TopoDS_Shape& shape2 = shapes[i + count];
+        if (shape1.IsNull() || shape2.IsNull()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        BRepExtrema_DistShapeShape extrema(shape1, shape2);
+        if (!extrema.IsDone()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return extrema.Value();
+    });
+}
+
 double Measurement::lineLineDistance() const
 {
     // We don't use delta() because BRepExtrema_DistShapeShape return minimum length between line
@@ -23,7 +23,12 @@
 #ifndef MEASURE_MEASUREMENT_H
 #define MEASURE_MEASUREMENT_H
 
+#include <map>
+#include <string>
+#include <utility>
+
 #include <gp_Pnt.hxx>
+#include <TopoDS_Shape.hxx>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -33,7 +38,7 @@
 #include <Mod/Measure/MeasureGlobal.h>
 
 
-class TopoDS_Shape;
+class TopoDS_Edge;
 namespace Measure
 {
 enum class MeasureType
@@ -80,6 +85,10 @@ public:
     MeasureType getType();
     MeasureType findType();
 
+    /// Look up the shapes of all references now, the measurements then no longer access the
+    /// document and can be computed on another thread. Adding a reference or clear() drops them.
+    void resolveShapes();
+
     // from base class
     PyObject* getPyObject() override;
     virtual unsigned int getMemSize() const;
@@ -114,12 +123,35 @@ public:
     bool planesAreParallel() const;
     bool linesAreParallel() const;
 
+    /** @name Batch measurements
+     * Measure each reference (or pair of references) on its own. The references are resolved
+     * once up front and the measurements are computed in parallel. Entries that cannot be
+     * resolved or measured are NaN.
+     */
+    //@{
+    static std::vector<double> lengths(const std::vector<App::DocumentObject*>& objects,
+                                       const std::vector<std::string>& subElements);
+    static std::vector<double> areas(const std::vector<App::DocumentObject*>& objects,
+                                     const std::vector<std::string>& subElements);
+    static std::vector<double> volumes(const std::vector<App::DocumentObject*>& objects,
+                                       const std::vector<std::string>& subElements);
+    /// Minimum distance between the references of objects1[i] and objects2[i]
+    static std::vector<double> distances(const std::vector<App::DocumentObject*>& objects1,
+                                         const std::vector<std::string>& subElements1,
+                                         const std::vector<App::DocumentObject*>& objects2,
+                                         const std::vector<std::string>& subElements2);
+    //@}
+
+    /// Length of a single edge, throws for unsupported curve types
+    static double edgeLength(const TopoDS_Edge& edge);
+
 protected:
     TopoDS_Shape getShape(App::DocumentObject* obj, const char* subName) const;
 
 private:
     MeasureType measureType;
     Py::SmartPtr PythonObject;
+    std::map<std::pair<App::DocumentObject*, std::string>, TopoDS_Shape> resolvedShapes;
 };
 
 
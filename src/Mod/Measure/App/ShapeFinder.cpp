@@ -30,6 +30,8 @@
 #ifndef _PreComp_
 #endif
 
+#include <map>
+
 #include <boost_regex.hpp>
 
 #include <BRep_Builder.hxx>
@@ -142,6 +144,36 @@ Part::TopoShape ShapeFinder::getLocatedTopoShape(const App::DocumentObject& root
 }
 
 
+//! resolve a batch of selections.  Measuring scripts often refer to the same element more than
+//! once (e.g. as the start of one distance and the end of the next), so the resolved shapes are
+//! shared between equal selections.
+std::vector<TopoDS_Shape>
+ShapeFinder::getLocatedShapes(const std::vector<App::DocumentObject*>& rootObjects,
+                              const std::vector<std::string>& leafSubs)
+{
+    if (rootObjects.size() != leafSubs.size()) {
+        throw Base::ValueError("ShapeFinder::getLocatedShapes - object and subname count differ");
+    }
+
+    std::vector<TopoDS_Shape> result;
+    result.reserve(rootObjects.size());
+    std::map<std::pair<const App::DocumentObject*, std::string>, TopoDS_Shape> resolved;
+    for (size_t i = 0; i < rootObjects.size(); ++i) {
+        if (!rootObjects[i]) {
+            result.emplace_back();
+            continue;
+        }
+        auto key = std::make_pair(rootObjects[i], leafSubs[i]);
+        auto it = resolved.find(key);
+        if (it == resolved.end()) {
+            it = resolved.emplace(key, getLocatedShape(*rootObjects[i], leafSubs[i])).first;
+        }
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+
 //! traverse the tree from leafSub up to rootObject, obtaining placements along the way.  Note that
 //! the placements will need to be applied in the reverse order (ie top down) of what is delivered
 //! in plm stack.  leafSub is a dot separated longSubName which DOES NOT include rootObject.  the
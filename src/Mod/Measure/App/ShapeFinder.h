@@ -69,6 +69,11 @@ public:
                                         const std::string& leafSub);
     static Part::TopoShape getLocatedTopoShape(const App::DocumentObject& rootObject,
                                                const std::string& leafSub);
+    //! resolve many selections at once, each distinct selection is only resolved once.
+    //! Unresolvable selections give a null shape.
+    static std::vector<TopoDS_Shape>
+    getLocatedShapes(const std::vector<App::DocumentObject*>& rootObjects,
+                     const std::vector<std::string>& leafSubs);
 
 
     static std::pair<Base::Placement, Base::Matrix4D>
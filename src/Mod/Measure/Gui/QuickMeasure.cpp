@@ -24,10 +24,13 @@
 
 #ifndef _PreComp_
 #include <cmath>
+#include <functional>
 #include <vector>
 #include <QTimer>
+#include <QtConcurrentRun>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/Link.h>
@@ -48,6 +51,7 @@
 
 using namespace Measure;
 using namespace MeasureGui;
+namespace sp = std::placeholders;
 
 FC_LOG_LEVEL_INIT("QuickMeasure", true, true)
 
@@ -56,12 +60,22 @@ QuickMeasure::QuickMeasure(QObject* parent)
     , measurement {new Measure::Measurement()}
 {
     selectionTimer = new QTimer(this);
+    selectionTimer->setSingleShot(true);
     pendingProcessing = false;
     connect(selectionTimer, &QTimer::timeout, this, &QuickMeasure::processSelection);
+    connect(&measureWatcher,
+            &QFutureWatcher<QString>::finished,
+            this,
+            &QuickMeasure::onMeasureFinished);
+    // NOLINTBEGIN
+    connectChangedObject = App::GetApplication().signalChangedObject.connect(
+        std::bind(&QuickMeasure::slotChangedObject, this, sp::_1, sp::_2));
+    // NOLINTEND
 }
 
 QuickMeasure::~QuickMeasure()
 {
+    measureWatcher.waitForFinished();
     delete selectionTimer;
     delete measurement;
 }
@@ -69,16 +83,23 @@ QuickMeasure::~QuickMeasure()
 void QuickMeasure::onSelectionChanged(const Gui::SelectionChanges& msg)
 {
     if (shouldMeasure(msg)) {
-        if (!pendingProcessing) {
-            selectionTimer->start(100);
-        }
+        // measure once the selection has settled
+        selectionTimer->start(100);
         pendingProcessing = true;
     }
 }
 
+void QuickMeasure::slotChangedObject(const App::DocumentObject& obj, const App::Property& prop)
+{
+    (void)obj;
+    (void)prop;
+    results.clear();
+}
+
 void QuickMeasure::processSelection()
 {
-    if (pendingProcessing) {
+    // a running measurement picks up the new selection when it is finished
+    if (pendingProcessing && !measureWatcher.isRunning()) {
         pendingProcessing = false;
         try {
             tryMeasureSelection();
@@ -111,7 +132,63 @@ void QuickMeasure::tryMeasureSelection()
         // we (still) have a doc and are not in a tool dialog where the user needs to click on stuff
         addSelectionToMeasurement();
     }
-    printResult();
+    if (measurement->getType() == MeasureType::Invalid) {
+        print(QStringLiteral(""));
+        return;
+    }
+
+    measureKey = getSelectionKey();
+    auto it = results.find(measureKey);
+    if (it != results.end()) {
+        print(it->second);
+        return;
+    }
+
+    // the shapes are looked up here, the worker thread only computes on them
+    measurement->resolveShapes();
+    Measure::Measurement* toMeasure = measurement;
+    measureWatcher.setFuture(QtConcurrent::run([toMeasure]() {
+        try {
+            return getResult(toMeasure);
+        }
+        catch (const Base::Exception& e) {
+            FC_ERR(e.what());
+        }
+        catch (const Standard_Failure& e) {
+            FC_ERR(e);
+        }
+        catch (...) {
+            FC_ERR("Unhandled unknown exception");
+        }
+        return QString();
+    }));
+}
+
+void QuickMeasure::onMeasureFinished()
+{
+    QString result = measureWatcher.result();
+    results[measureKey] = result;
+    if (!pendingProcessing) {
+        print(result);
+    }
+    else if (!selectionTimer->isActive()) {
+        // the selection has changed meanwhile, this result is outdated
+        processSelection();
+    }
+}
+
+std::string QuickMeasure::getSelectionKey() const
+{
+    std::string key;
+    const std::vector<App::DocumentObject*>& objects = measurement->References3D.getValues();
+    const std::vector<std::string>& subElements = measurement->References3D.getSubValues();
+    for (std::size_t i = 0; i < objects.size(); i++) {
+        key += objects[i]->getFullName();
+        key += '.';
+        key += subElements[i];
+        key += '\n';
+    }
+    return key;
 }
 
 bool QuickMeasure::shouldMeasure(const Gui::SelectionChanges& msg) const
@@ -170,7 +247,7 @@ void QuickMeasure::addSelectionToMeasurement()
         }
 
         for (auto& subName : subNames) {
-            App::DocumentObject* obj = rootObj->getSubObject(subName.c_str());
+            App::DocumentObject* obj = rootObj->getSubObjectCached(subName.c_str());
 
             if (!isObjAcceptable(obj)) {
                 continue;
@@ -198,56 +275,55 @@ static QString angleStr(double value)
     return QString::fromStdString(dist.getUserString());
 }
 
-void QuickMeasure::printResult()
+//! the text shown for the measurement, this may take a while for complex shapes
+QString QuickMeasure::getResult(Measure::Measurement* measurement)
 {
     MeasureType mtype = measurement->getType();
     if (mtype == MeasureType::Surfaces) {
-        print(tr("Total area: %1").arg(areaStr(measurement->area())));
+        return tr("Total area: %1").arg(areaStr(measurement->area()));
     }
     /* deactivated because computing the volumes/area of solids makes a significant
     slow down in selection of complex solids.
-    else if (mtype == MeasureType::Volumes) {
+    if (mtype == MeasureType::Volumes) {
         Base::Quantity area(measurement->area(), Base::Unit::Area);
         Base::Quantity vol(measurement->volume(), Base::Unit::Volume);
-        print(tr("Volume: %1, Area:
-    %2").arg(vol.getSafeUserString()).arg(area.getSafeUserString()));
+        return tr("Volume: %1, Area:
+    %2").arg(vol.getSafeUserString()).arg(area.getSafeUserString());
     }*/
-    else if (mtype == MeasureType::TwoPlanes) {
-        print(tr("Nominal distance: %1").arg(lengthStr(measurement->planePlaneDistance())));
-    }
-    else if (mtype == MeasureType::Cone || mtype == MeasureType::Plane) {
-        print(tr("Area: %1").arg(areaStr(measurement->area())));
+    if (mtype == MeasureType::TwoPlanes) {
+        return tr("Nominal distance: %1").arg(lengthStr(measurement->planePlaneDistance()));
     }
-    else if (mtype == MeasureType::Cylinder || mtype == MeasureType::Sphere
-             || mtype == MeasureType::Torus) {
-        print(tr("Area: %1, Radius: %2")
-                  .arg(areaStr(measurement->area()), lengthStr(measurement->radius())));
+    if (mtype == MeasureType::Cone || mtype == MeasureType::Plane) {
+        return tr("Area: %1").arg(areaStr(measurement->area()));
     }
-    else if (mtype == MeasureType::Edges) {
-        print(tr("Total length: %1").arg(lengthStr(measurement->length())));
+    if (mtype == MeasureType::Cylinder || mtype == MeasureType::Sphere
+        || mtype == MeasureType::Torus) {
+        return tr("Area: %1, Radius: %2")
+            .arg(areaStr(measurement->area()), lengthStr(measurement->radius()));
     }
-    else if (mtype == MeasureType::TwoParallelLines) {
-        print(tr("Nominal distance: %1").arg(lengthStr(measurement->lineLineDistance())));
+    if (mtype == MeasureType::Edges) {
+        return tr("Total length: %1").arg(lengthStr(measurement->length()));
     }
-    else if (mtype == MeasureType::TwoLines) {
-        print(tr("Angle: %1, Total length: %2")
-                  .arg(angleStr(measurement->angle()), lengthStr(measurement->length())));
+    if (mtype == MeasureType::TwoParallelLines) {
+        return tr("Nominal distance: %1").arg(lengthStr(measurement->lineLineDistance()));
     }
-    else if (mtype == MeasureType::Line) {
-        print(tr("Length: %1").arg(lengthStr(measurement->length())));
+    if (mtype == MeasureType::TwoLines) {
+        return tr("Angle: %1, Total length: %2")
+            .arg(angleStr(measurement->angle()), lengthStr(measurement->length()));
     }
-    else if (mtype == MeasureType::Circle) {
-        print(tr("Radius: %1").arg(lengthStr(measurement->radius())));
+    if (mtype == MeasureType::Line) {
+        return tr("Length: %1").arg(lengthStr(measurement->length()));
     }
-    else if (mtype == MeasureType::PointToPoint) {
-        print(tr("Distance: %1").arg(lengthStr(measurement->length())));
+    if (mtype == MeasureType::Circle) {
+        return tr("Radius: %1").arg(lengthStr(measurement->radius()));
     }
-    else if (mtype == MeasureType::PointToEdge || mtype == MeasureType::PointToSurface) {
-        print(tr("Minimum distance: %1").arg(lengthStr(measurement->length())));
+    if (mtype == MeasureType::PointToPoint) {
+        return tr("Distance: %1").arg(lengthStr(measurement->length()));
     }
-    else {
-        print(QStringLiteral(""));
+    if (mtype == MeasureType::PointToEdge || mtype == MeasureType::PointToSurface) {
+        return tr("Minimum distance: %1").arg(lengthStr(measurement->length()));
     }
+    return QStringLiteral("");
 }
 
 void QuickMeasure::print(const QString& message)
@@ -24,6 +24,10 @@
 #ifndef MEASUREGUI_QUICKMEASURE_H
 #define MEASUREGUI_QUICKMEASURE_H
 
+#include <map>
+#include <string>
+#include <boost/signals2.hpp>
+#include <QFutureWatcher>
 #include <QObject>
 
 #include <Mod/Measure/MeasureGlobal.h>
@@ -55,15 +59,25 @@ private:
     bool shouldMeasure(const Gui::SelectionChanges& msg) const;
     void addSelectionToMeasurement();
     bool isObjAcceptable(App::DocumentObject* obj);
-    void printResult();
+    std::string getSelectionKey() const;
+    static QString getResult(Measure::Measurement* measurement);
     void print(const QString& message);
 
     void processSelection();
+    void onMeasureFinished();
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
 
     Measure::Measurement* measurement;
 
     QTimer* selectionTimer;
     bool pendingProcessing;
+
+    // the result is computed on a worker thread, one selection at a time
+    QFutureWatcher<QString> measureWatcher;
+    std::string measureKey;
+    // results by selection, dropped on any change of the document objects
+    std::map<std::string, QString> results;
+    boost::signals2::scoped_connection connectChangedObject;
 };
 
 }  // namespace MeasureGui
@@ -249,11 +249,11 @@ void TaskMeasure::update()
     // Reset selection if the selected object is not valid
     for (auto sel : Gui::Selection().getSelection()) {
         App::DocumentObject* ob = sel.pObject;
-        App::DocumentObject* sub = ob->getSubObject(sel.SubName);
+        App::DocumentObject* sub = ob->getSubObjectCached(sel.SubName);
 
         // Resolve App::Link
         if (auto link = freecad_cast<App::Link*>(sub)) {
-            sub = link->getLinkedObject(true);
+            sub = link->getLinkedObjectCached(true);
         }
 
         std::string mod = Base::Type::getModuleName(sub->getTypeId().getName());
@@ -109,6 +109,7 @@ PyMOD_INIT_FUNC(Mesh)
     Mesh::FixIndices            ::init();
     Mesh::FillHoles             ::init();
     Mesh::RemoveComponents      ::init();
+    Mesh::RepairDefects         ::init();
 
     Mesh::Sphere                ::init();
     Mesh::Ellipsoid             ::init();
@@ -24,7 +24,12 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
 #include <limits>
+#include <thread>
 #endif
 
 #include <Base/Console.h>
@@ -33,6 +38,8 @@
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Elements.h"
+#include "FacetTree.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "Triangulation.h"
@@ -43,6 +50,120 @@ using Base::BoundBox2d;
 using Base::BoundBox3f;
 using Base::Polygon2d;
 
+namespace
+{
+/*
+ * Point in polygon test for many points. The edges are sorted into horizontal bands so that
+ * a point is only tested against the edges of its band. Only edges crossing the horizontal
+ * line through the point count for the number of turns, so the result is the same as of
+ * Polygon2d::Contains().
+ */
+class PolygonBands
+{
+public:
+    explicit PolygonBands(const Polygon2d& poly)
+    {
+        std::size_t count = poly.GetCtVectors();
+        if (count < 3) {
+            return;
+        }
+
+        BoundBox2d box = poly.CalcBoundBox();
+        numBands = std::clamp<std::size_t>(count / 2, 1, 1024);
+        minY = box.MinY;
+        scale = box.Height() > 0.0 ? double(numBands) / box.Height() : 0.0;
+
+        edges.reserve(count);
+        for (std::size_t i = 0; i < count; i++) {
+            const Base::Vector2d& p0 = poly[i];
+            const Base::Vector2d& p1 = poly[(i + 1) % count];
+            edges.push_back({p0.x, p0.y, p1.x, p1.y});
+        }
+
+        // bucket the edges by the bands their y range overlaps
+        std::vector<std::uint32_t> counts(numBands + 1, 0);
+        auto forBands = [this](const std::array<double, 4>& edge, auto&& func) {
+            std::size_t first = band(std::min(edge[1], edge[3]));
+            std::size_t last = band(std::max(edge[1], edge[3]));
+            for (std::size_t b = first; b <= last; b++) {
+                func(b);
+            }
+        };
+        for (const auto& edge : edges) {
+            forBands(edge, [&counts](std::size_t b) {
+                counts[b + 1]++;
+            });
+        }
+        for (std::size_t b = 0; b < numBands; b++) {
+            counts[b + 1] += counts[b];
+        }
+        bandStart = counts;
+        bandEdges.resize(counts.back());
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            forBands(edges[i], [&, i](std::size_t b) {
+                bandEdges[counts[b]++] = static_cast<std::uint32_t>(i);
+            });
+        }
+    }
+
+    bool Contains(double x, double y) const
+    {
+        if (edges.empty()) {
+            return false;
+        }
+
+        int torsion = 0;
+        std::size_t b = band(y);
+        for (std::uint32_t i = bandStart[b]; i < bandStart[b + 1]; i++) {
+            torsion += Torsion(edges[bandEdges[i]], x, y);
+        }
+        return torsion != 0;
+    }
+
+private:
+    std::size_t band(double y) const
+    {
+        double pos = std::floor((y - minY) * scale);
+        return static_cast<std::size_t>(std::clamp(pos, 0.0, double(numBands - 1)));
+    }
+
+    // the turn of an edge around the point as counted by Polygon2d::Contains()
+    static int Torsion(const std::array<double, 4>& line, double x, double y)
+    {
+        std::array<int, 2> quad {};
+        for (std::size_t i = 0; i < 2; i++) {
+            if (line[i * 2] <= x) {
+                quad[i] = (line[i * 2 + 1] > y) ? 0 : 3;
+            }
+            else {
+                quad[i] = (line[i * 2 + 1] > y) ? 1 : 2;
+            }
+        }
+
+        int diff = std::abs(quad[0] - quad[1]);
+        if (diff <= 1) {
+            return 0;
+        }
+        if (diff == 3) {
+            return (quad[0] == 0) ? 1 : -1;
+        }
+
+        double resX = line[0] + (y - line[1]) / ((line[3] - line[1]) / (line[2] - line[0]));
+        if (resX < x) {
+            return (quad[0] <= 1) ? 1 : -1;
+        }
+        return 0;
+    }
+
+    std::vector<std::array<double, 4>> edges;
+    std::vector<std::uint32_t> bandStart;
+    std::vector<std::uint32_t> bandEdges;
+    std::size_t numBands {1};
+    double minY {0.0};
+    double scale {0.0};
+};
+}  // namespace
+
 
 bool MeshAlgorithm::IsVertexVisible(const Base::Vector3f& rcVertex,
                                     const Base::Vector3f& rcView,
@@ -171,6 +292,21 @@ bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
     return false;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                      const Base::Vector3f& rclDir,
+                                      const MeshFacetTree& rclTree,
+                                      Base::Vector3f& rclRes,
+                                      FacetIndex& rulFacet) const
+{
+    FacetIndex index = rclTree.NearestFacetOnRay(rclPt, rclDir, Mathf::PI, rclRes);
+    if (index == FACET_INDEX_MAX) {
+        return false;
+    }
+
+    rulFacet = index;
+    return true;
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
                                       const Base::Vector3f& rclDir,
                                       const std::vector<FacetIndex>& raulFacets,
@@ -687,8 +823,8 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
     PointIndex refPoint0 = *(boundary.begin());
     PointIndex refPoint1 = *(boundary.begin() + 1);
     if (pP2FStructure) {
-        const std::set<FacetIndex>& ring1 = (*pP2FStructure)[refPoint0];
-        const std::set<FacetIndex>& ring2 = (*pP2FStructure)[refPoint1];
+        MeshIndexList ring1 = (*pP2FStructure)[refPoint0];
+        MeshIndexList ring2 = (*pP2FStructure)[refPoint1];
         std::vector<FacetIndex> f_int;
         std::set_intersection(ring1.begin(),
                               ring1.end(),
@@ -1190,6 +1326,7 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid,
     Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
     // Precompute the polygon's bounding box
     Base::BoundBox2d clPolyBBox = rclPoly.CalcBoundBox();
+    PolygonBands clPolyBands(rclPoly);
 
     // if true use grid on mesh to speed up search
     if (bInner) {
@@ -1222,7 +1359,7 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid,
                 clPt2d = fixedProj(pnt);
                 clGravityOfFacet += clPt2d;
                 if (clPolyBBox.Contains(Base::Vector2d(clPt2d.x, clPt2d.y))
-                    && rclPoly.Contains(Base::Vector2d(clPt2d.x, clPt2d.y))) {
+                    && clPolyBands.Contains(clPt2d.x, clPt2d.y)) {
                     raulFacets.push_back(*it);
                     bNoPointInside = false;
                     break;
@@ -1234,7 +1371,7 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid,
                 clGravityOfFacet *= 1.0F / 3.0F;
 
                 if (clPolyBBox.Contains(Base::Vector2d(clGravityOfFacet.x, clGravityOfFacet.y))
-                    && rclPoly.Contains(Base::Vector2d(clGravityOfFacet.x, clGravityOfFacet.y))) {
+                    && clPolyBands.Contains(clGravityOfFacet.x, clGravityOfFacet.y)) {
                     raulFacets.push_back(*it);
                 }
             }
@@ -1266,25 +1403,46 @@ void MeshAlgorithm::CheckFacets(const Base::ViewProjMethod* pclProj,
 {
     const MeshPointArray& p = _rclMesh.GetPoints();
     const MeshFacetArray& f = _rclMesh.GetFacets();
-    Base::Vector3f pt2d;
     // Use a bounding box to reduce number of call to Polygon::Contains
     Base::BoundBox2d bb = rclPoly.CalcBoundBox();
+    PolygonBands bands(rclPoly);
     // Precompute the screen projection matrix as Coin's projection function is expensive
     Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
 
-    FacetIndex index = 0;
-    for (auto it = f.begin(); it != f.end(); ++it, ++index) {
-        for (PointIndex ptIndex : it->_aulPoints) {
-            pt2d = fixedProj(p[ptIndex]);
-
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    auto numBlocks = [hardware](std::size_t count) {
+        return std::min(hardware, std::max<std::size_t>(1, count / 10000));
+    };
+
+    // every point is projected and tested once instead of once per facet
+    std::vector<char> inside(p.size());
+    std::size_t blocks = numBlocks(p.size());
+    parallel_blocks(p.size(), blocks, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Base::Vector3f pt2d = fixedProj(p[i]);
             // First check whether the point is in the bounding box of the polygon
-            if ((bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
-                 && rclPoly.Contains(Base::Vector2d(pt2d.x, pt2d.y)))
-                ^ !bInner) {
-                raulFacets.push_back(index);
-                break;
+            inside[i] = bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
+                && bands.Contains(pt2d.x, pt2d.y);
+        }
+    });
+
+    // collect the facets per block to keep them sorted
+    blocks = numBlocks(f.size());
+    std::vector<std::vector<FacetIndex>> found(blocks);
+    parallel_blocks(f.size(), blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = f[i];
+            auto selected = [&](PointIndex ptIndex) {
+                return (inside[ptIndex] != 0) ^ !bInner;
+            };
+            if (std::any_of(std::begin(face._aulPoints), std::end(face._aulPoints), selected)) {
+                found[b].push_back(i);
             }
         }
+    });
+
+    for (const auto& indices : found) {
+        raulFacets.insert(raulFacets.end(), indices.begin(), indices.end());
     }
 }
 
@@ -1831,25 +1989,155 @@ float MeshAlgorithm::CalculateMinimumGridLength(float fLength,
 
 // ----------------------------------------------------
 
-void MeshRefPointToFacets::Rebuild()
+void MeshIndexLists::Clear()
 {
-    _map.clear();
+    _begin.clear();
+    _size.clear();
+    _capacity.clear();
+    _indices.clear();
+}
 
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    _map.resize(rPoints.size());
+void MeshIndexLists::Build(std::size_t ulLists, unsigned long ulCount, const Entries& entriesOf)
+{
+    Clear();
 
-    auto pFBegin = rFacets.begin();
-    for (auto pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
-        _map[pFIter->_aulPoints[0]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[1]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[2]].insert(pFIter - pFBegin);
+    unsigned long ulThreads = std::max(1U, std::thread::hardware_concurrency());
+    ulThreads = std::max(1UL, std::min(ulThreads, ulCount / 10000));
+    unsigned long ulChunk = (ulCount + ulThreads - 1) / ulThreads;
+
+    auto parallel = [ulThreads](auto&& pass) {
+        std::vector<std::future<void>> futures;
+        for (unsigned long t = 1; t < ulThreads; t++) {
+            futures.push_back(std::async(std::launch::async, pass, t));
+        }
+        pass(0);
+        for (auto& future : futures) {
+            future.get();
+        }
+    };
+    auto forEachEntry = [&](unsigned long t, auto&& func) {
+        std::vector<std::pair<ElementIndex, ElementIndex>> entries;
+        unsigned long ulEnd = std::min(ulCount, (t + 1) * ulChunk);
+        for (unsigned long i = t * ulChunk; i < ulEnd; i++) {
+            entries.clear();
+            entriesOf(i, entries);
+            for (const auto& it : entries) {
+                func(it.first, it.second);
+            }
+        }
+    };
+
+    // count the entries of each list
+    std::vector<std::atomic<std::uint32_t>> counts(ulLists);
+    parallel([&](unsigned long t) {
+        forEachEntry(t, [&counts](ElementIndex list, ElementIndex) {
+            counts[list].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    _begin.resize(ulLists);
+    _size.resize(ulLists);
+    _capacity.resize(ulLists);
+    std::size_t ulTotal = 0;
+    for (std::size_t i = 0; i < ulLists; i++) {
+        _begin[i] = ulTotal;
+        _capacity[i] = counts[i].load(std::memory_order_relaxed);
+        ulTotal += _capacity[i];
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+
+    // scatter the indices, the lists get sorted afterwards
+    _indices.resize(ulTotal);
+    parallel([&](unsigned long t) {
+        forEachEntry(t, [this, &counts](ElementIndex list, ElementIndex index) {
+            std::size_t ulPos = counts[list].fetch_add(1, std::memory_order_relaxed);
+            _indices[_begin[list] + ulPos] = index;
+        });
+    });
+
+    std::size_t ulListChunk = (ulLists + ulThreads - 1) / ulThreads;
+    parallel([&](unsigned long t) {
+        std::size_t ulEnd = std::min(ulLists, (t + 1) * ulListChunk);
+        for (std::size_t i = t * ulListChunk; i < ulEnd; i++) {
+            auto first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[i]);
+            auto last = first + _capacity[i];
+            std::sort(first, last);
+            last = std::unique(first, last);
+            _size[i] = static_cast<std::uint32_t>(last - first);
+        }
+    });
+
+    // drop the space of the removed duplicates
+    std::size_t ulPos = 0;
+    for (std::size_t i = 0; i < ulLists; i++) {
+        auto first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[i]);
+        std::copy(first, first + _size[i], _indices.begin() + static_cast<std::ptrdiff_t>(ulPos));
+        _begin[i] = ulPos;
+        _capacity[i] = _size[i];
+        ulPos += _size[i];
+    }
+    _indices.resize(ulPos);
+    _indices.shrink_to_fit();
+}
+
+void MeshIndexLists::Insert(std::size_t pos, ElementIndex index)
+{
+    auto first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[pos]);
+    auto last = first + _size[pos];
+    auto it = std::lower_bound(first, last, index);
+    if (it != last && *it == index) {
+        return;
+    }
+
+    std::ptrdiff_t offset = it - first;
+    if (_size[pos] == _capacity[pos]) {
+        // move the full list to the end
+        std::size_t ulStart = _indices.size();
+        std::uint32_t ulCapacity = std::max<std::uint32_t>(4, 2 * _capacity[pos]);
+        _indices.resize(ulStart + ulCapacity);
+        first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[pos]);
+        std::copy(first, first + _size[pos], _indices.begin() + static_cast<std::ptrdiff_t>(ulStart));
+        _begin[pos] = ulStart;
+        _capacity[pos] = ulCapacity;
+    }
+
+    first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[pos]);
+    last = first + _size[pos];
+    std::copy_backward(first + offset, last, last + 1);
+    first[offset] = index;
+    _size[pos]++;
+}
+
+void MeshIndexLists::Erase(std::size_t pos, ElementIndex index)
+{
+    auto first = _indices.begin() + static_cast<std::ptrdiff_t>(_begin[pos]);
+    auto last = first + _size[pos];
+    auto it = std::lower_bound(first, last, index);
+    if (it == last || *it != index) {
+        return;
     }
+
+    std::copy(it + 1, last, it);
+    _size[pos]--;
+}
+
+// ----------------------------------------------------
+
+void MeshRefPointToFacets::Rebuild()
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    _map.Build(_rclMesh.CountPoints(),
+               rFacets.size(),
+               [&rFacets](FacetIndex index, std::vector<std::pair<PointIndex, FacetIndex>>& entries) {
+                   for (PointIndex ptIndex : rFacets[index]._aulPoints) {
+                       entries.emplace_back(ptIndex, index);
+                   }
+               });
 }
 
 Base::Vector3f MeshRefPointToFacets::GetNormal(PointIndex pos) const
 {
-    const std::set<FacetIndex>& n = _map[pos];
+    MeshIndexList n = _map[pos];
     Base::Vector3f normal;
     MeshGeomFacet f;
     for (FacetIndex it : n) {
@@ -1871,7 +2159,7 @@ std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(const std::vector<Poi
     for (int i = 0; i < level; i++) {
         std::set<PointIndex> cur;
         for (PointIndex it : lp) {
-            const std::set<FacetIndex>& ft = (*this)[it];
+            MeshIndexList ft = (*this)[it];
             for (FacetIndex jt : ft) {
                 for (PointIndex index : f_it[jt]._aulPoints) {
                     if (cp.find(index) == cp.end() && nb.find(index) == nb.end()) {
@@ -1893,7 +2181,7 @@ std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(const std::vector<Poi
 std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(PointIndex pos) const
 {
     std::set<PointIndex> p;
-    const std::set<FacetIndex>& vf = _map[pos];
+    MeshIndexList vf = _map[pos];
     for (FacetIndex it : vf) {
         PointIndex p1 {}, p2 {}, p3 {};
         _rclMesh.GetFacetPoints(it, p1, p2, p3);
@@ -1941,7 +2229,7 @@ void MeshRefPointToFacets::SearchNeighbours(const MeshFacetArray& rFacets,
     visited.insert(index);
     collect.Append(_rclMesh, index);
     for (PointIndex ptIndex : face._aulPoints) {
-        const std::set<FacetIndex>& f = (*this)[ptIndex];
+        MeshIndexList f = (*this)[ptIndex];
 
         for (FacetIndex j : f) {
             SearchNeighbours(rFacets, j, rclCenter, fMaxDist2, visited, collect);
@@ -1954,7 +2242,7 @@ MeshFacetArray::_TConstIterator MeshRefPointToFacets::GetFacet(FacetIndex index)
     return _rclMesh.GetFacets().begin() + index;
 }
 
-const std::set<FacetIndex>& MeshRefPointToFacets::operator[](PointIndex pos) const
+MeshIndexList MeshRefPointToFacets::operator[](PointIndex pos) const
 {
     return _map[pos];
 }
@@ -1963,8 +2251,8 @@ std::vector<FacetIndex> MeshRefPointToFacets::GetIndices(PointIndex pos1, PointI
 {
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
-    const std::set<FacetIndex>& set1 = _map[pos1];
-    const std::set<FacetIndex>& set2 = _map[pos2];
+    MeshIndexList set1 = _map[pos1];
+    MeshIndexList set2 = _map[pos2];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
@@ -1975,19 +2263,19 @@ MeshRefPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2, PointIndex po
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
     std::vector<FacetIndex> set1 = GetIndices(pos1, pos2);
-    const std::set<FacetIndex>& set2 = _map[pos3];
+    MeshIndexList set2 = _map[pos3];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
 
 void MeshRefPointToFacets::AddNeighbour(PointIndex pos, FacetIndex facet)
 {
-    _map[pos].insert(facet);
+    _map.Insert(pos, facet);
 }
 
 void MeshRefPointToFacets::RemoveNeighbour(PointIndex pos, FacetIndex facet)
 {
-    _map[pos].erase(facet);
+    _map.Erase(pos, facet);
 }
 
 void MeshRefPointToFacets::RemoveFacet(FacetIndex facetIndex)
@@ -1995,33 +2283,30 @@ void MeshRefPointToFacets::RemoveFacet(FacetIndex facetIndex)
     PointIndex p0 {}, p1 {}, p2 {};
     _rclMesh.GetFacetPoints(facetIndex, p0, p1, p2);
 
-    _map[p0].erase(facetIndex);
-    _map[p1].erase(facetIndex);
-    _map[p2].erase(facetIndex);
+    _map.Erase(p0, facetIndex);
+    _map.Erase(p1, facetIndex);
+    _map.Erase(p2, facetIndex);
 }
 
 //----------------------------------------------------------------------------
 
 void MeshRefFacetToFacets::Rebuild()
 {
-    _map.clear();
-
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    _map.resize(rFacets.size());
-
     MeshRefPointToFacets vertexFace(_rclMesh);
-    auto pFBegin = rFacets.begin();
-    for (auto pFIter = pFBegin; pFIter != rFacets.end(); ++pFIter) {
-        for (PointIndex ptIndex : pFIter->_aulPoints) {
-            const std::set<FacetIndex>& faces = vertexFace[ptIndex];
-            for (FacetIndex face : faces) {
-                _map[pFIter - pFBegin].insert(face);
-            }
-        }
-    }
+    _map.Build(rFacets.size(),
+               rFacets.size(),
+               [&rFacets, &vertexFace](FacetIndex index,
+                                       std::vector<std::pair<FacetIndex, FacetIndex>>& entries) {
+                   for (PointIndex ptIndex : rFacets[index]._aulPoints) {
+                       for (FacetIndex face : vertexFace[ptIndex]) {
+                           entries.emplace_back(index, face);
+                       }
+                   }
+               });
 }
 
-const std::set<FacetIndex>& MeshRefFacetToFacets::operator[](FacetIndex pos) const
+MeshIndexList MeshRefFacetToFacets::operator[](FacetIndex pos) const
 {
     return _map[pos];
 }
@@ -2030,8 +2315,8 @@ std::vector<FacetIndex> MeshRefFacetToFacets::GetIndices(FacetIndex pos1, FacetI
 {
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
-    const std::set<FacetIndex>& set1 = _map[pos1];
-    const std::set<FacetIndex>& set2 = _map[pos2];
+    MeshIndexList set1 = _map[pos1];
+    MeshIndexList set2 = _map[pos2];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
@@ -2040,24 +2325,22 @@ std::vector<FacetIndex> MeshRefFacetToFacets::GetIndices(FacetIndex pos1, FacetI
 
 void MeshRefPointToPoints::Rebuild()
 {
-    _map.clear();
-
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    _map.resize(rPoints.size());
-
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    for (const auto& rFacet : rFacets) {
-        PointIndex ulP0 = rFacet._aulPoints[0];
-        PointIndex ulP1 = rFacet._aulPoints[1];
-        PointIndex ulP2 = rFacet._aulPoints[2];
-
-        _map[ulP0].insert(ulP1);
-        _map[ulP0].insert(ulP2);
-        _map[ulP1].insert(ulP0);
-        _map[ulP1].insert(ulP2);
-        _map[ulP2].insert(ulP0);
-        _map[ulP2].insert(ulP1);
-    }
+    _map.Build(_rclMesh.CountPoints(),
+               rFacets.size(),
+               [&rFacets](FacetIndex index, std::vector<std::pair<PointIndex, PointIndex>>& entries) {
+                   const MeshFacet& rFacet = rFacets[index];
+                   PointIndex ulP0 = rFacet._aulPoints[0];
+                   PointIndex ulP1 = rFacet._aulPoints[1];
+                   PointIndex ulP2 = rFacet._aulPoints[2];
+
+                   entries.emplace_back(ulP0, ulP1);
+                   entries.emplace_back(ulP0, ulP2);
+                   entries.emplace_back(ulP1, ulP0);
+                   entries.emplace_back(ulP1, ulP2);
+                   entries.emplace_back(ulP2, ulP0);
+                   entries.emplace_back(ulP2, ulP1);
+               });
 }
 
 Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
@@ -2066,7 +2349,7 @@ Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
     MeshCore::PlaneFit pf;
     pf.AddPoint(rPoints[pos]);
     MeshCore::MeshPoint center = rPoints[pos];
-    const std::set<PointIndex>& cv = _map[pos];
+    MeshIndexList cv = _map[pos];
     for (PointIndex cv_it : cv) {
         pf.AddPoint(rPoints[cv_it]);
         center += rPoints[cv_it];
@@ -2083,7 +2366,7 @@ float MeshRefPointToPoints::GetAverageEdgeLength(PointIndex index) const
 {
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
     float len = 0.0F;
-    const std::set<PointIndex>& n = (*this)[index];
+    MeshIndexList n = (*this)[index];
     const Base::Vector3f& p = rPoints[index];
     for (PointIndex it : n) {
         len += Base::Distance(p, rPoints[it]);
@@ -2091,19 +2374,19 @@ float MeshRefPointToPoints::GetAverageEdgeLength(PointIndex index) const
     return (len / n.size());
 }
 
-const std::set<PointIndex>& MeshRefPointToPoints::operator[](PointIndex pos) const
+MeshIndexList MeshRefPointToPoints::operator[](PointIndex pos) const
 {
     return _map[pos];
 }
 
 void MeshRefPointToPoints::AddNeighbour(PointIndex pos, PointIndex facet)
 {
-    _map[pos].insert(facet);
+    _map.Insert(pos, facet);
 }
 
 void MeshRefPointToPoints::RemoveNeighbour(PointIndex pos, PointIndex facet)
 {
-    _map[pos].erase(facet);
+    _map.Erase(pos, facet);
 }
 
 //----------------------------------------------------------------------------
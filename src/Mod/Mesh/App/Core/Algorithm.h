@@ -23,6 +23,9 @@
 #ifndef MESHALGORITHM_H
 #define MESHALGORITHM_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <set>
 #include <vector>
@@ -46,6 +49,7 @@ class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
 class MeshFacetGrid;
+class MeshFacetTree;
 class MeshFacetArray;
 class MeshRefPointToFacets;
 class AbstractPolygonTriangulator;
@@ -99,6 +103,20 @@ public:
                            const MeshFacetGrid& rclGrid,
                            Base::Vector3f& rclRes,
                            FacetIndex& rulFacet) const;
+    /**
+     * Searches for the nearest facet to the ray defined by
+     * (\a rclPt, \a rclDir).
+     * The point \a rclRes holds the intersection point with the ray and the
+     * nearest facet with index \a rulFacet.
+     * \note This method is optimized by using the bounding volume hierarchy \a rclTree
+     * which must have been built from the attached mesh. Unlike the grid it doesn't
+     * suffer from unevenly sized facets.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           const MeshFacetTree& rclTree,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
     /**
      * Searches for the nearest facet to the ray defined by
      * (\a rclPt, \a rclDir).
@@ -292,7 +310,8 @@ public:
                      bool bInner,
                      std::vector<FacetIndex>& facets) const;
     /**
-     * Does the same as the above method unless that it doesn't use a grid.
+     * Does the same as the above method unless that it doesn't use a grid. Every point is
+     * projected and tested once and the work is split over the available threads.
      */
     void CheckFacets(const Base::ViewProjMethod* pclProj,
                      const Base::Polygon2d& rclPoly,
@@ -465,6 +484,90 @@ private:
     std::vector<FacetIndex>& indices;
 };
 
+/**
+ * A sorted list of indices of a MeshIndexLists structure. It offers the read-only
+ * interface of a std::set.
+ * \note The list becomes invalid if the MeshIndexLists gets changed.
+ */
+class MeshIndexList
+{
+public:
+    using value_type = ElementIndex;
+    using const_iterator = const ElementIndex*;
+    using iterator = const_iterator;
+
+    MeshIndexList(const ElementIndex* first, std::size_t size)
+        : _first(first)
+        , _size(size)
+    {}
+    const_iterator begin() const
+    {
+        return _first;
+    }
+    const_iterator end() const
+    {
+        return _first + _size;
+    }
+    std::size_t size() const
+    {
+        return _size;
+    }
+    bool empty() const
+    {
+        return _size == 0;
+    }
+    /// Returns end() if \a index is not in the list
+    const_iterator find(ElementIndex index) const
+    {
+        const_iterator it = std::lower_bound(begin(), end(), index);
+        return (it != end() && *it == index) ? it : end();
+    }
+    std::size_t count(ElementIndex index) const
+    {
+        return find(index) != end() ? 1 : 0;
+    }
+
+private:
+    const ElementIndex* _first;
+    std::size_t _size;
+};
+
+/**
+ * The MeshIndexLists stores a sorted list of indices for each element of a mesh in one
+ * array (CSR layout). It replaces a std::vector<std::set<>> that needs a tree node per
+ * index. Each list keeps its capacity so that a few indices can be inserted after the
+ * build, a list that runs full is moved to the end of the array.
+ */
+class MeshExport MeshIndexLists
+{
+public:
+    /// Fills the function with the list and the index of each entry of an element
+    using Entries =
+        std::function<void(ElementIndex, std::vector<std::pair<ElementIndex, ElementIndex>>&)>;
+
+    /** Builds \a ulLists lists from the entries of \a ulCount elements. The elements are
+     * processed in parallel, duplicate entries of a list are removed.
+     */
+    void Build(std::size_t ulLists, unsigned long ulCount, const Entries& entriesOf);
+    void Clear();
+    MeshIndexList operator[](std::size_t pos) const
+    {
+        return {_indices.data() + _begin[pos], _size[pos]};
+    }
+    std::size_t size() const
+    {
+        return _begin.size();
+    }
+    void Insert(std::size_t pos, ElementIndex index);
+    void Erase(std::size_t pos, ElementIndex index);
+
+private:
+    std::vector<std::size_t> _begin;      /**< Start of each list. */
+    std::vector<std::uint32_t> _size;     /**< Number of indices of each list. */
+    std::vector<std::uint32_t> _capacity; /**< Reserved number of indices of each list. */
+    std::vector<ElementIndex> _indices;   /**< The indices of all lists. */
+};
+
 /**
  * The MeshRefPointToFacets builds up a structure to have access to all facets indexing
  * a point.
@@ -483,7 +586,7 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild();
-    const std::set<FacetIndex>& operator[](PointIndex) const;
+    MeshIndexList operator[](PointIndex) const;
     std::vector<FacetIndex> GetIndices(PointIndex, PointIndex) const;
     std::vector<FacetIndex> GetIndices(PointIndex, PointIndex, PointIndex) const;
     MeshFacetArray::_TConstIterator GetFacet(FacetIndex) const;
@@ -505,7 +608,7 @@ protected:
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<FacetIndex>> _map;
+    MeshIndexLists _map;
 };
 
 /**
@@ -528,13 +631,13 @@ public:
 
     /// Returns a set of facets sharing one or more points with the facet with
     /// index \a ulFacetIndex.
-    const std::set<FacetIndex>& operator[](FacetIndex) const;
+    MeshIndexList operator[](FacetIndex) const;
     /// Returns an array of common facets of the passed facet indexes.
     std::vector<FacetIndex> GetIndices(FacetIndex, FacetIndex) const;
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<FacetIndex>> _map;
+    MeshIndexLists _map;
 };
 
 /**
@@ -555,7 +658,7 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild();
-    const std::set<PointIndex>& operator[](PointIndex) const;
+    MeshIndexList operator[](PointIndex) const;
     Base::Vector3f GetNormal(PointIndex) const;
     float GetAverageEdgeLength(PointIndex) const;
     void AddNeighbour(PointIndex, PointIndex);
@@ -563,7 +666,7 @@ public:
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<PointIndex>> _map;
+    MeshIndexLists _map;
 };
 
 /**
@@ -61,7 +61,7 @@ Approximation::~Approximation()
 
 void Approximation::GetMgcVectorArray(std::vector<Wm4::Vector3<double>>& rcPts) const
 {
-    std::list<Base::Vector3f>::const_iterator It;
+    std::vector<Base::Vector3f>::const_iterator It;
     rcPts.reserve(_vPoints.size());
     for (It = _vPoints.begin(); It != _vPoints.end(); ++It) {
         rcPts.push_back(Base::convertTo<Wm4::Vector3d>(*It));
@@ -76,7 +76,13 @@ void Approximation::AddPoint(const Base::Vector3f& point)
 
 void Approximation::AddPoints(const std::vector<Base::Vector3f>& points)
 {
-    std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
+    _vPoints.insert(_vPoints.end(), points.begin(), points.end());
+    _bIsFitted = false;
+}
+
+void Approximation::AddPoints(std::span<const Base::Vector3f> points)
+{
+    _vPoints.insert(_vPoints.end(), points.begin(), points.end());
     _bIsFitted = false;
 }
 
@@ -94,6 +100,7 @@ void Approximation::AddPoints(const std::list<Base::Vector3f>& points)
 
 void Approximation::AddPoints(const MeshPointArray& points)
 {
+    _vPoints.reserve(_vPoints.size() + points.size());
     std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
     _bIsFitted = false;
 }
@@ -119,6 +126,7 @@ void Approximation::Clear()
 {
     _vPoints.clear();
     _bIsFitted = false;
+    _fLastResult = std::numeric_limits<float>::max();
 }
 
 float Approximation::GetLastResult() const
@@ -133,49 +141,33 @@ bool Approximation::Done() const
 
 // -------------------------------------------------------------------------------
 
-PlaneFit::PlaneFit()
-    : _vBase(0, 0, 0)
-    , _vDirU(1, 0, 0)
-    , _vDirV(0, 1, 0)
-    , _vDirW(0, 0, 1)
-{}
-
-float PlaneFit::Fit()
+namespace
 {
-    _bIsFitted = true;
-    if (CountPoints() < 3) {
-        return std::numeric_limits<float>::max();
-    }
 
-    double sxx {0.0};
-    double sxy {0.0};
-    double sxz {0.0};
-    double syy {0.0};
-    double syz {0.0};
-    double szz {0.0};
-    double mx {0.0};
-    double my {0.0};
-    double mz {0.0};
-
-    for (const auto& vPoint : _vPoints) {
-        sxx += double(vPoint.x * vPoint.x);
-        sxy += double(vPoint.x * vPoint.y);
-        sxz += double(vPoint.x * vPoint.z);
-        syy += double(vPoint.y * vPoint.y);
-        syz += double(vPoint.y * vPoint.z);
-        szz += double(vPoint.z * vPoint.z);
-        mx += double(vPoint.x);
-        my += double(vPoint.y);
-        mz += double(vPoint.z);
-    }
+struct PlaneMoments
+{
+    double sxx, sxy, sxz, syy, syz, szz;
+    double mx, my, mz;
+};
 
-    size_t nSize = _vPoints.size();
-    sxx = sxx - mx * mx / (double(nSize));
-    sxy = sxy - mx * my / (double(nSize));
-    sxz = sxz - mx * mz / (double(nSize));
-    syy = syy - my * my / (double(nSize));
-    syz = syz - my * mz / (double(nSize));
-    szz = szz - mz * mz / (double(nSize));
+// Fits the plane to the raw first and second moments of nSize points. Returns the standard
+// deviation of the points to the plane or FLOAT_MAX if the fit fails.
+float FitPlaneToMoments(const PlaneMoments& moments,
+                        size_t nSize,
+                        Base::Vector3f& base,
+                        Base::Vector3f& dirU,
+                        Base::Vector3f& dirV,
+                        Base::Vector3f& dirW)
+{
+    double mx = moments.mx;
+    double my = moments.my;
+    double mz = moments.mz;
+    double sxx = moments.sxx - mx * mx / (double(nSize));
+    double sxy = moments.sxy - mx * my / (double(nSize));
+    double sxz = moments.sxz - mx * mz / (double(nSize));
+    double syy = moments.syy - my * my / (double(nSize));
+    double syz = moments.syz - my * mz / (double(nSize));
+    double szz = moments.szz - mz * mz / (double(nSize));
 
 #if defined(FC_USE_EIGEN)
     Eigen::Matrix3d covMat = Eigen::Matrix3d::Zero();
@@ -194,10 +186,10 @@ float PlaneFit::Fit()
     Eigen::Vector3d v = eig.eigenvectors().col(2);
     Eigen::Vector3d w = eig.eigenvectors().col(0);
 
-    _vDirU.Set(u.x(), u.y(), u.z());
-    _vDirV.Set(v.x(), v.y(), v.z());
-    _vDirW.Set(w.x(), w.y(), w.z());
-    _vBase.Set(mx / (float)nSize, my / (float)nSize, mz / (float)nSize);
+    dirU.Set(u.x(), u.y(), u.z());
+    dirV.Set(v.x(), v.y(), v.z());
+    dirW.Set(w.x(), w.y(), w.z());
+    base.Set(mx / (float)nSize, my / (float)nSize, mz / (float)nSize);
 
     float sigma = w.dot(covMat * w);
 #else
@@ -245,10 +237,10 @@ float PlaneFit::Fit()
         Wm4::Vector3<double>::GenerateOrthonormalBasis(U, V, W);
     }
 
-    _vDirU.Set(float(U.X()), float(U.Y()), float(U.Z()));
-    _vDirV.Set(float(V.X()), float(V.Y()), float(V.Z()));
-    _vDirW.Set(float(W.X()), float(W.Y()), float(W.Z()));
-    _vBase.Set(float(mx / nSize), float(my / nSize), float(mz / nSize));
+    dirU.Set(float(U.X()), float(U.Y()), float(U.Z()));
+    dirV.Set(float(V.X()), float(V.Y()), float(V.Z()));
+    dirW.Set(float(W.X()), float(W.Y()), float(W.Z()));
+    base.Set(float(mx / nSize), float(my / nSize), float(mz / nSize));
     float sigma = float(W.Dot(akMat * W));
 #endif
 
@@ -264,10 +256,10 @@ float PlaneFit::Fit()
     }
 
     // make a right-handed system
-    if ((_vDirU % _vDirV) * _vDirW < 0.0F) {
-        Base::Vector3f tmp = _vDirU;
-        _vDirU = _vDirV;
-        _vDirV = tmp;
+    if ((dirU % dirV) * dirW < 0.0F) {
+        Base::Vector3f tmp = dirU;
+        dirU = dirV;
+        dirV = tmp;
     }
 
     if (nSize > 3) {
@@ -277,8 +269,57 @@ float PlaneFit::Fit()
         sigma = 0;
     }
 
-    _fLastResult = sigma;
-    return _fLastResult;
+    return sigma;
+}
+
+}  // namespace
+
+PlaneFit::PlaneFit()
+    : _vBase(0, 0, 0)
+    , _vDirU(1, 0, 0)
+    , _vDirV(0, 1, 0)
+    , _vDirW(0, 0, 1)
+{}
+
+float PlaneFit::Fit()
+{
+    _bIsFitted = true;
+    if (CountPoints() < 3) {
+        return std::numeric_limits<float>::max();
+    }
+
+    double sxx {0.0};
+    double sxy {0.0};
+    double sxz {0.0};
+    double syy {0.0};
+    double syz {0.0};
+    double szz {0.0};
+    double mx {0.0};
+    double my {0.0};
+    double mz {0.0};
+
+    for (const auto& vPoint : _vPoints) {
+        sxx += double(vPoint.x * vPoint.x);
+        sxy += double(vPoint.x * vPoint.y);
+        sxz += double(vPoint.x * vPoint.z);
+        syy += double(vPoint.y * vPoint.y);
+        syz += double(vPoint.y * vPoint.z);
+        szz += double(vPoint.z * vPoint.z);
+        mx += double(vPoint.x);
+        my += double(vPoint.y);
+        mz += double(vPoint.z);
+    }
+
+    float sigma = FitPlaneToMoments(PlaneMoments {sxx, sxy, sxz, syy, syz, szz, mx, my, mz},
+                                    _vPoints.size(),
+                                    _vBase,
+                                    _vDirU,
+                                    _vDirV,
+                                    _vDirW);
+    if (sigma < std::numeric_limits<float>::max()) {
+        _fLastResult = sigma;
+    }
+    return sigma;
 }
 
 Base::Vector3f PlaneFit::GetBase() const
@@ -339,7 +380,7 @@ float PlaneFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
 
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         fDist = GetDistanceToPlane(*cIt);
@@ -366,7 +407,7 @@ float PlaneFit::GetSignedStdDeviation() const
 
     float ulPtCt = float(CountPoints());
     Base::Vector3f clGravity, clPt;
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         clGravity += *cIt;
     }
@@ -413,7 +454,7 @@ void PlaneFit::Dimension(float& length, float& width) const
     const Base::Vector3f& ey = _vDirV;
 
     Base::BoundBox3f bbox;
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         Base::Vector3f pnt = *cIt;
         pnt.TransformToCoordinateSystem(bs, ex, ey);
@@ -458,6 +499,71 @@ Base::BoundBox3f PlaneFit::GetBoundings() const
 
 // -------------------------------------------------------------------------------
 
+void IncrementalPlaneFit::Clear()
+{
+    *this = IncrementalPlaneFit();
+}
+
+void IncrementalPlaneFit::AddPoint(const Base::Vector3f& point)
+{
+    // same summation as in PlaneFit::Fit()
+    _sxx += double(point.x * point.x);
+    _sxy += double(point.x * point.y);
+    _sxz += double(point.x * point.z);
+    _syy += double(point.y * point.y);
+    _syz += double(point.y * point.z);
+    _szz += double(point.z * point.z);
+    _mx += double(point.x);
+    _my += double(point.y);
+    _mz += double(point.z);
+    _nPoints++;
+    _bIsFitted = false;
+}
+
+float IncrementalPlaneFit::Fit()
+{
+    _bIsFitted = true;
+    if (_nPoints < 3) {
+        return std::numeric_limits<float>::max();
+    }
+
+    return FitPlaneToMoments(PlaneMoments {_sxx, _sxy, _sxz, _syy, _syz, _szz, _mx, _my, _mz},
+                             _nPoints,
+                             _vBase,
+                             _vDirU,
+                             _vDirV,
+                             _vDirW);
+}
+
+Base::Vector3f IncrementalPlaneFit::GetBase() const
+{
+    if (_bIsFitted) {
+        return _vBase;
+    }
+
+    return Base::Vector3f();
+}
+
+Base::Vector3f IncrementalPlaneFit::GetNormal() const
+{
+    if (_bIsFitted) {
+        return _vDirW;
+    }
+
+    return Base::Vector3f();
+}
+
+float IncrementalPlaneFit::GetDistanceToPlane(const Base::Vector3f& rcPoint) const
+{
+    float fResult = std::numeric_limits<float>::max();
+    if (_bIsFitted) {
+        fResult = (rcPoint - _vBase) * _vDirW;
+    }
+    return fResult;
+}
+
+// -------------------------------------------------------------------------------
+
 bool QuadraticFit::GetCurvatureInfo(double x,
                                     double y,
                                     double z,
@@ -1305,7 +1411,7 @@ float CylinderFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
 
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         fDist = GetDistanceToCylinder(*cIt);
@@ -1322,7 +1428,7 @@ void CylinderFit::GetBounding(Base::Vector3f& bottom, Base::Vector3f& top) const
     float distMin = std::numeric_limits<float>::max();
     float distMax = std::numeric_limits<float>::min();
 
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         float dist = cIt->DistanceToPlane(_vBase, _vAxis);
         if (dist < distMin) {
@@ -1404,6 +1510,29 @@ float SphereFit::Fit()
         return std::numeric_limits<float>::max();
     }
 
+    MeshCoreFit::SphereFit sphereFit;
+    sphereFit.AddPoints(_vPoints);
+    sphereFit.ComputeApproximations();
+    float result = sphereFit.Fit();
+    if (result < std::numeric_limits<float>::max()) {
+        Base::Vector3d center = sphereFit.GetCenter();
+#if defined(_DEBUG)
+        Base::Console().message("MeshCoreFit::Sphere Fit:  Center: (%0.4f, %0.4f, %0.4f),  Radius: "
+                                "%0.4f,  Std Dev: %0.4f,  Iterations: %d\n",
+                                center.x,
+                                center.y,
+                                center.z,
+                                sphereFit.GetRadius(),
+                                sphereFit.GetStdDeviation(),
+                                sphereFit.GetNumIterations());
+#endif
+        _vCenter = Base::convertTo<Base::Vector3f>(center);
+        _fRadius = (float)sphereFit.GetRadius();
+        _fLastResult = result;
+        return _fLastResult;
+    }
+
+    // the WildMagic fit is only needed if the least-squares fit doesn't converge
     std::vector<Wm4::Vector3d> input;
     std::transform(_vPoints.begin(),
                    _vPoints.end(),
@@ -1430,27 +1559,6 @@ float SphereFit::Fit()
                             GetStdDeviation());
 #endif
 
-    MeshCoreFit::SphereFit sphereFit;
-    sphereFit.AddPoints(_vPoints);
-    sphereFit.ComputeApproximations();
-    float result = sphereFit.Fit();
-    if (result < std::numeric_limits<float>::max()) {
-        Base::Vector3d center = sphereFit.GetCenter();
-#if defined(_DEBUG)
-        Base::Console().message("MeshCoreFit::Sphere Fit:  Center: (%0.4f, %0.4f, %0.4f),  Radius: "
-                                "%0.4f,  Std Dev: %0.4f,  Iterations: %d\n",
-                                center.x,
-                                center.y,
-                                center.z,
-                                sphereFit.GetRadius(),
-                                sphereFit.GetStdDeviation(),
-                                sphereFit.GetNumIterations());
-#endif
-        _vCenter = Base::convertTo<Base::Vector3f>(center);
-        _fRadius = (float)sphereFit.GetRadius();
-        _fLastResult = result;
-    }
-
     return _fLastResult;
 }
 
@@ -1476,7 +1584,7 @@ float SphereFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
+    std::vector<Base::Vector3f>::const_iterator cIt;
 
     for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         fDist = GetDistanceToSphere(*cIt);
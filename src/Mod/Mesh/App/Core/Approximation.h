@@ -31,12 +31,16 @@
 #include <limits>
 #include <list>
 #include <set>
+#include <span>
+#include <thread>
 #include <vector>
 
 #include <Base/BoundBox.h>
 #include <Base/Matrix.h>
 #include <Base/Vector3D.h>
 
+#include "Functional.h"
+
 
 namespace Wm4
 {
@@ -139,6 +143,10 @@ public:
      * Add points for the fit algorithm.
      */
     void AddPoints(const std::vector<Base::Vector3f>& points);
+    /**
+     * Add points for the fit algorithm from a contiguous array.
+     */
+    void AddPoints(std::span<const Base::Vector3f> points);
     /**
      * Add points for the fit algorithm.
      */
@@ -154,7 +162,7 @@ public:
     /**
      * Get all added points.
      */
-    const std::list<Base::Vector3f>& GetPoints() const
+    const std::vector<Base::Vector3f>& GetPoints() const
     {
         return _vPoints;
     }
@@ -169,7 +177,8 @@ public:
      */
     std::size_t CountPoints() const;
     /**
-     * Deletes the inserted points and frees any allocated resources.
+     * Deletes the inserted points and resets the last result. The point storage keeps its
+     * capacity, so a fit object can be reused for many point sets without reallocating.
      */
     void Clear();
     /**
@@ -200,8 +209,8 @@ protected:
 
 protected:
     // NOLINTBEGIN
-    std::list<Base::Vector3f> _vPoints; /**< Holds the points for the fit algorithm.  */
-    bool _bIsFitted {false};            /**< Flag, whether the fit has been called. */
+    std::vector<Base::Vector3f> _vPoints; /**< Holds the points for the fit algorithm.  */
+    bool _bIsFitted {false};              /**< Flag, whether the fit has been called. */
     float _fLastResult {
         std::numeric_limits<float>::max()}; /**< Stores the last result of the fit */
     // NOLINTEND
@@ -276,6 +285,54 @@ protected:
 
 // -------------------------------------------------------------------------------
 
+/**
+ * Least-squares plane through points that are added one by one, e.g. while growing
+ * a region. Unlike PlaneFit only the moments of the points are kept, so adding a
+ * point and refitting the plane take constant time. The fitted plane is the same
+ * as with PlaneFit.
+ */
+class MeshExport IncrementalPlaneFit
+{
+public:
+    IncrementalPlaneFit() = default;
+    void Clear();
+    void AddPoint(const Base::Vector3f& point);
+    std::size_t CountPoints() const
+    {
+        return _nPoints;
+    }
+    /**
+     * Fit a plane into the points added so far. If the fit fails FLOAT_MAX is returned.
+     */
+    float Fit();
+    /**
+     * Returns true if Fit() has been called for the current set of points, false otherwise.
+     */
+    bool Done() const
+    {
+        return _bIsFitted;
+    }
+    Base::Vector3f GetBase() const;
+    Base::Vector3f GetNormal() const;
+    /**
+     * Returns the distance from the point \a rcPoint to the fitted plane. If Fit() has not been
+     * called FLOAT_MAX is returned.
+     */
+    float GetDistanceToPlane(const Base::Vector3f& rcPoint) const;
+
+private:
+    std::size_t _nPoints {0};
+    double _sxx {0.0}, _sxy {0.0}, _sxz {0.0}, _syy {0.0}, _syz {0.0}, _szz {0.0};
+    double _mx {0.0}, _my {0.0}, _mz {0.0};
+    bool _bIsFitted {false};
+    Base::Vector3f _vBase;
+    Base::Vector3f _vDirU {1, 0, 0};
+    Base::Vector3f _vDirV {0, 1, 0};
+    Base::Vector3f _vDirW {0, 0, 1};
+};
+
+// -------------------------------------------------------------------------------
+
 /**
  * Approximation of a quadratic surface into a given set of points. The implicit form of the surface
  * is defined by F(x,y,z) = a * x^2 + b * y^2 + c * z^2 +
@@ -714,6 +771,36 @@ private:
     float _fCoeff[9];
 };
 
+// -------------------------------------------------------------------------------
+
+/**
+ * Fits a primitive of type \a FitT, e.g. PlaneFit, CylinderFit or SphereFit, into each of many
+ * point sets in parallel. The point sets are stored back to back in \a points, set i is the range
+ * [offsets[i], offsets[i+1]). Every thread reuses one fit object for all of its sets, so the
+ * point storage is only allocated once per thread. After each fit \a func(i, fit) is called from
+ * the thread that did the fit and picks up the result, e.g. with GetLastResult() and the getters
+ * of the primitive. If GetLastResult() is FLOAT_MAX the fit failed and the getters may still
+ * return the primitive of the thread's previous set.
+ */
+template<class FitT, class Func>
+void FitPointSets(std::span<const Base::Vector3f> points,
+                  const std::vector<std::size_t>& offsets,
+                  Func func)
+{
+    std::size_t count = offsets.empty() ? 0 : offsets.size() - 1;
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    std::size_t blocks = std::min(hardware, std::max<std::size_t>(1, count / 16));
+    parallel_blocks(count, blocks, [&](std::size_t, std::size_t begin, std::size_t end) {
+        FitT fit;
+        for (std::size_t index = begin; index < end; index++) {
+            fit.Clear();
+            fit.AddPoints(points.subspan(offsets[index], offsets[index + 1] - offsets[index]));
+            fit.Fit();
+            func(index, static_cast<const FitT&>(fit));
+        }
+    });
+}
+
 }  // namespace MeshCore
 
 #endif  // MESH_APPROXIMATION_H
@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstring>
 #endif
 
 #include <Base/Exception.h>
@@ -358,6 +359,40 @@ void MeshFastBuilder::AddFacet(const MeshGeomFacet& facetPoints)
     }
 }
 
+void MeshFastBuilder::AddFacets(const char* data, size_type count, std::size_t stride)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    QVector<Private::Vertex>& verts = p->verts;
+    size_type offset = verts.size();
+    verts.resize(offset + 3 * count);
+    Private::Vertex* out = verts.data() + offset;
+
+    auto convert = [data, stride, out](size_type begin, size_type end) {
+        float pts[9];
+        for (size_type i = begin; i < end; ++i) {
+            std::memcpy(pts, data + static_cast<std::size_t>(i) * stride, sizeof(pts));
+            for (int j = 0; j < 3; j++) {
+                out[3 * i + j] = Private::Vertex(pts[3 * j], pts[3 * j + 1], pts[3 * j + 2]);
+            }
+        }
+    };
+
+    size_type threads = std::max(1, int(std::thread::hardware_concurrency()));
+    size_type chunk = (count + threads - 1) / threads;
+    std::vector<std::future<void>> futures;
+    for (size_type begin = chunk; begin < count; begin += chunk) {
+        futures.push_back(
+            std::async(std::launch::async, convert, begin, std::min(begin + chunk, count)));
+    }
+    convert(0, std::min(chunk, count));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 void MeshFastBuilder::Finish()
 {
     using size_type = QVector<Private::Vertex>::size_type;
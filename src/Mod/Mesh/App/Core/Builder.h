@@ -218,6 +218,13 @@ public:
     /** Add new facet
      */
     void AddFacet(const MeshGeomFacet& facetPoints);
+    /** Add \a count facets from a packed buffer. The three points of each facet
+     * are stored as nine consecutive floats, the first one starting at \a data
+     * and the following ones each \a stride bytes further. The buffer doesn't
+     * need to be aligned, which allows to read from a memory-mapped file. The
+     * conversion is distributed over all available cores.
+     */
+    void AddFacets(const char* data, size_type count, std::size_t stride);
 
     /** Finishes building up the mesh structure. Must be done after adding facets.
      */
@@ -22,9 +22,22 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <limits>
+#include <queue>
+#include <thread>
 #endif
 
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
+
 #include "Decimation.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
@@ -155,3 +168,646 @@ void MeshSimplify::simplify(int targetSize)
 
     myKernel.Adopt(new_points, new_facets, true);
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+Base::Vector3d toVector3d(const Base::Vector3f& v)
+{
+    return Base::convertTo<Base::Vector3d>(v);
+}
+
+// Symmetric 4x4 matrix of the quadric error metric, stored as upper triangle
+struct Quadric
+{
+    double m[10] {};
+
+    void addPlane(const Base::Vector3d& n, double d)
+    {
+        m[0] += n.x * n.x;
+        m[1] += n.x * n.y;
+        m[2] += n.x * n.z;
+        m[3] += n.x * d;
+        m[4] += n.y * n.y;
+        m[5] += n.y * n.z;
+        m[6] += n.y * d;
+        m[7] += n.z * n.z;
+        m[8] += n.z * d;
+        m[9] += d * d;
+    }
+
+    Quadric& operator+=(const Quadric& q)
+    {
+        for (int i = 0; i < 10; i++) {
+            m[i] += q.m[i];
+        }
+        return *this;
+    }
+
+    double error(const Base::Vector3d& v) const
+    {
+        double err = m[0] * v.x * v.x + 2 * m[1] * v.x * v.y + 2 * m[2] * v.x * v.z
+            + 2 * m[3] * v.x + m[4] * v.y * v.y + 2 * m[5] * v.y * v.z + 2 * m[6] * v.y
+            + m[7] * v.z * v.z + 2 * m[8] * v.z + m[9];
+        return std::max(err, 0.0);
+    }
+
+    // Computes the point minimizing the error, fails if the quadric is (nearly) singular
+    bool optimum(Base::Vector3d& v) const
+    {
+        double a00 = m[4] * m[7] - m[5] * m[5];
+        double a01 = m[2] * m[5] - m[1] * m[7];
+        double a02 = m[1] * m[5] - m[2] * m[4];
+        double det = m[0] * a00 + m[1] * a01 + m[2] * a02;
+        if (std::fabs(det) < 1e-10) {
+            return false;
+        }
+        double a11 = m[0] * m[7] - m[2] * m[2];
+        double a12 = m[1] * m[2] - m[0] * m[5];
+        double a22 = m[0] * m[4] - m[1] * m[1];
+        v.x = -(a00 * m[3] + a01 * m[6] + a02 * m[8]) / det;
+        v.y = -(a01 * m[3] + a11 * m[6] + a12 * m[8]) / det;
+        v.z = -(a02 * m[3] + a12 * m[6] + a22 * m[8]) / det;
+        return true;
+    }
+};
+
+struct EdgeCost
+{
+    float cost;
+    // number of collapses done when the cost was computed, to detect outdated entries
+    std::uint32_t stamp;
+    PointIndex keep;
+    PointIndex remove;
+
+    bool operator>(const EdgeCost& other) const
+    {
+        return cost > other.cost;
+    }
+};
+
+// The state of one thread. While the mesh is decimated in parallel each partition only
+// collapses edges whose surrounding points are owned by the partition.
+struct Partition
+{
+    std::uint32_t id {0};
+    std::priority_queue<EdgeCost, std::vector<EdgeCost>, std::greater<>> queue;
+    std::vector<EdgeCost> edges;
+    std::uint32_t collapses {0};
+    std::size_t numFacets {0};
+    std::size_t targetSize {0};
+    // buffers reused by every collapse
+    std::vector<FacetIndex> shared;
+    std::vector<PointIndex> neighbours1;
+    std::vector<PointIndex> neighbours2;
+};
+
+class EdgeCollapser
+{
+public:
+    // points at the border of two partitions are not touched by any thread
+    static constexpr std::uint32_t LockedPoint = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::uint32_t UnusedPoint = LockedPoint - 1;
+    // the parallel decimation is only worth it if there are enough facets per thread
+    static constexpr std::size_t MinFacetsPerThread = 5000;
+
+    EdgeCollapser(MeshPointArray& points, MeshFacetArray& facets)
+        : points(points)
+        , facets(facets)
+    {}
+
+    std::size_t run(std::size_t targetSize,
+                    double maxError,
+                    unsigned int threads,
+                    Base::SequencerLauncher& seq)
+    {
+        setup();
+        std::size_t initialSize = numFacets;
+        auto report = [&]() {
+            for (std::size_t count = removed; reported < count; reported++) {
+                seq.next(true);
+            }
+        };
+
+        // The partitions are reduced proportionally, afterwards the edges along the borders of
+        // the partitions are collapsed together with all the others
+        if (threads > 1 && numFacets / threads >= MinFacetsPerThread) {
+            reduceParallel(threads, targetSize, maxError, report);
+        }
+
+        Partition all;
+        all.numFacets = numFacets;
+        all.targetSize = targetSize;
+        std::fill(owner.begin(), owner.end(), all.id);
+        std::fill(modified.begin(), modified.end(), 0);
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            addEdges(all, index);
+        }
+        reduce(all, maxError, report);
+        numFacets = all.numFacets;
+
+        return initialSize - numFacets;
+    }
+
+private:
+    void setup()
+    {
+        pointFacets.resize(points.size());
+        quadrics.resize(points.size());
+        modified.resize(points.size(), 0);
+        border.resize(points.size(), 0);
+        owner.resize(points.size(), 0);
+
+        numFacets = 0;
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            const MeshFacet& face = facets[index];
+            if (!face.IsValid()) {
+                continue;
+            }
+            numFacets++;
+            for (PointIndex point : face._aulPoints) {
+                pointFacets[point].push_back(index);
+            }
+
+            Base::Vector3d p[3];
+            for (int i = 0; i < 3; i++) {
+                p[i] = toVector3d(points[face._aulPoints[i]]);
+            }
+            Base::Vector3d normal = (p[1] - p[0]).Cross(p[2] - p[0]);
+            if (normal.Length() <= 0.0) {
+                continue;
+            }
+            normal.Normalize();
+            for (PointIndex point : face._aulPoints) {
+                quadrics[point].addPlane(normal, -normal.Dot(p[0]));
+            }
+
+            // penalize moving border points away from the border
+            for (int i = 0; i < 3; i++) {
+                if (face._aulNeighbours[i] != FACET_INDEX_MAX) {
+                    continue;
+                }
+                PointIndex p0 = face._aulPoints[i];
+                PointIndex p1 = face._aulPoints[(i + 1) % 3];
+                border[p0] = 1;
+                border[p1] = 1;
+                Base::Vector3d side = (p[(i + 1) % 3] - p[i]).Cross(normal);
+                if (side.Length() > 0.0) {
+                    side.Normalize();
+                    double d = -side.Dot(p[i]);
+                    quadrics[p0].addPlane(side, d);
+                    quadrics[p1].addPlane(side, d);
+                }
+            }
+        }
+    }
+
+    // Splits the mesh into slabs of equal size along the longest side of its bounding box
+    std::vector<std::uint32_t> makePartitions(std::uint32_t count) const
+    {
+        Base::BoundBox3f box;
+        for (const auto& point : points) {
+            box.Add(point);
+        }
+        int axis = 0;
+        if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+            axis = 1;
+        }
+        else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+            axis = 2;
+        }
+
+        std::vector<float> coords(facets.size());
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            const MeshFacet& face = facets[index];
+            coords[index] = points[face._aulPoints[0]][axis] + points[face._aulPoints[1]][axis]
+                + points[face._aulPoints[2]][axis];
+        }
+
+        std::vector<float> sorted = coords;
+        std::vector<float> bounds;
+        for (std::uint32_t i = 1; i < count; i++) {
+            auto nth = sorted.begin() + static_cast<std::ptrdiff_t>(sorted.size() * i / count);
+            std::nth_element(sorted.begin(), nth, sorted.end());
+            bounds.push_back(*nth);
+        }
+
+        std::vector<std::uint32_t> partitions(facets.size());
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            auto it = std::upper_bound(bounds.begin(), bounds.end(), coords[index]);
+            partitions[index] = static_cast<std::uint32_t>(it - bounds.begin());
+        }
+        return partitions;
+    }
+
+    void reduceParallel(unsigned int threads,
+                        std::size_t targetSize,
+                        double maxError,
+                        const std::function<void()>& report)
+    {
+        std::vector<std::uint32_t> facetPartitions = makePartitions(threads);
+        std::vector<Partition> partitions(threads);
+        for (std::uint32_t i = 0; i < threads; i++) {
+            partitions[i].id = i;
+        }
+
+        std::fill(owner.begin(), owner.end(), UnusedPoint);
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            if (!facets[index].IsValid()) {
+                continue;
+            }
+            std::uint32_t id = facetPartitions[index];
+            partitions[id].numFacets++;
+            for (PointIndex point : facets[index]._aulPoints) {
+                if (owner[point] == UnusedPoint) {
+                    owner[point] = id;
+                }
+                else if (owner[point] != id) {
+                    owner[point] = LockedPoint;
+                }
+            }
+        }
+
+        double ratio = double(targetSize) / double(numFacets);
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            addEdges(partitions[facetPartitions[index]], index);
+        }
+        for (auto& part : partitions) {
+            part.targetSize = static_cast<std::size_t>(double(part.numFacets) * ratio);
+        }
+
+        // the progress can only be reported from the main thread
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 1; i < partitions.size(); i++) {
+            futures.push_back(std::async(std::launch::async, [this, &partitions, i, maxError]() {
+                reduce(partitions[i], maxError, {});
+            }));
+        }
+
+        try {
+            reduce(partitions[0], maxError, report);
+            for (auto& fut : futures) {
+                while (fut.wait_for(std::chrono::milliseconds(20)) != std::future_status::ready) {
+                    report();
+                }
+            }
+            report();
+        }
+        catch (...) {
+            aborted = true;
+            for (auto& fut : futures) {
+                fut.wait();
+            }
+            throw;
+        }
+
+        for (auto& fut : futures) {
+            fut.get();
+        }
+        numFacets = 0;
+        for (const auto& part : partitions) {
+            numFacets += part.numFacets;
+        }
+    }
+
+    // Adds the edges of the facet that can be collapsed by the partition
+    void addEdges(Partition& part, FacetIndex index) const
+    {
+        const MeshFacet& face = facets[index];
+        if (!face.IsValid()) {
+            return;
+        }
+        for (int i = 0; i < 3; i++) {
+            // every inner edge is shared by two facets, add it only once
+            FacetIndex neighbour = face._aulNeighbours[i];
+            PointIndex p0 = face._aulPoints[i];
+            PointIndex p1 = face._aulPoints[(i + 1) % 3];
+            if ((neighbour == FACET_INDEX_MAX || index < neighbour) && owner[p0] == part.id
+                && owner[p1] == part.id) {
+                part.edges.push_back({0.0F, 0, p0, p1});
+            }
+        }
+    }
+
+    void reduce(Partition& part, double maxError, const std::function<void()>& report)
+    {
+        for (auto& edge : part.edges) {
+            edge = makeEdge(part, edge.keep, edge.remove);
+        }
+        // building the heap at once is faster than pushing the edges one by one
+        part.queue = decltype(part.queue)(std::greater<>(), std::move(part.edges));
+
+        while (part.numFacets > part.targetSize && !part.queue.empty() && !aborted) {
+            EdgeCost edge = part.queue.top();
+            part.queue.pop();
+            if (modified[edge.keep] > edge.stamp || modified[edge.remove] > edge.stamp) {
+                continue;
+            }
+            // the queue is sorted, all other collapses are worse
+            if (edge.cost > maxError) {
+                break;
+            }
+            Base::Vector3f pos;
+            computeCost(edge.keep, edge.remove, pos);
+            if (!isLegal(part, edge.keep, edge.remove, pos)) {
+                continue;
+            }
+
+            removed += collapse(part, edge.keep, edge.remove, pos);
+            if (report) {
+                report();
+            }
+        }
+    }
+
+    double computeCost(PointIndex keep, PointIndex remove, Base::Vector3f& position) const
+    {
+        Quadric q = quadrics[keep];
+        q += quadrics[remove];
+
+        Base::Vector3d p1 = toVector3d(points[keep]);
+        Base::Vector3d p2 = toVector3d(points[remove]);
+        Base::Vector3d pos;
+        double cost {};
+        // a border point must not leave the border, only use the end or the middle point
+        bool useOptimum = !(border[keep] && border[remove]) && q.optimum(pos)
+            && Base::DistanceP2(pos, (p1 + p2) / 2) <= Base::DistanceP2(p1, p2);
+        if (useOptimum) {
+            cost = q.error(pos);
+        }
+        else {
+            Base::Vector3d candidates[3] = {p1, p2, (p1 + p2) / 2};
+            cost = std::numeric_limits<double>::max();
+            for (const auto& candidate : candidates) {
+                double err = q.error(candidate);
+                if (err < cost) {
+                    cost = err;
+                    pos = candidate;
+                }
+            }
+        }
+        position = Base::convertTo<Base::Vector3f>(pos);
+        return cost;
+    }
+
+    EdgeCost makeEdge(const Partition& part, PointIndex keep, PointIndex remove) const
+    {
+        Base::Vector3f pos;
+        double cost = computeCost(keep, remove, pos);
+        return {static_cast<float>(std::min<double>(cost, std::numeric_limits<float>::max())),
+                part.collapses,
+                keep,
+                remove};
+    }
+
+    void neighbourPoints(PointIndex point, std::vector<PointIndex>& neighbours) const
+    {
+        neighbours.clear();
+        for (FacetIndex index : pointFacets[point]) {
+            for (PointIndex other : facets[index]._aulPoints) {
+                if (other != point) {
+                    neighbours.push_back(other);
+                }
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+    }
+
+    void edgeFacets(PointIndex p1, PointIndex p2, std::vector<FacetIndex>& shared) const
+    {
+        shared.clear();
+        for (FacetIndex index : pointFacets[p1]) {
+            if (facets[index].HasPoint(p2)) {
+                shared.push_back(index);
+            }
+        }
+    }
+
+    PointIndex oppositePoint(FacetIndex index, PointIndex p1, PointIndex p2) const
+    {
+        for (PointIndex point : facets[index]._aulPoints) {
+            if (point != p1 && point != p2) {
+                return point;
+            }
+        }
+        return POINT_INDEX_MAX;
+    }
+
+    bool isLegal(Partition& part, PointIndex keep, PointIndex remove, const Base::Vector3f& pos) const
+    {
+        std::vector<FacetIndex>& shared = part.shared;
+        edgeFacets(keep, remove, shared);
+        if (shared.empty() || shared.size() > 2) {
+            return false;
+        }
+        // a border point can only be moved along the border
+        bool borderEdge = shared.size() == 1;
+        if (border[keep] != border[remove] || (border[keep] && !borderEdge)) {
+            return false;
+        }
+
+        // the collapse changes the point to facet references of the opposite points
+        PointIndex opposite[2] = {POINT_INDEX_MAX, POINT_INDEX_MAX};
+        for (std::size_t i = 0; i < shared.size(); i++) {
+            opposite[i] = oppositePoint(shared[i], keep, remove);
+            if (owner[opposite[i]] != part.id) {
+                return false;
+            }
+        }
+        if (opposite[0] > opposite[1]) {
+            std::swap(opposite[0], opposite[1]);
+        }
+
+        // link condition: the end points must only share the points opposite to the edge,
+        // otherwise the collapse changes the topology
+        neighbourPoints(keep, part.neighbours1);
+        neighbourPoints(remove, part.neighbours2);
+        std::size_t numCommon = 0;
+        auto it1 = part.neighbours1.begin();
+        auto it2 = part.neighbours2.begin();
+        while (it1 != part.neighbours1.end() && it2 != part.neighbours2.end()) {
+            if (*it1 < *it2) {
+                ++it1;
+            }
+            else if (*it2 < *it1) {
+                ++it2;
+            }
+            else {
+                if (numCommon >= shared.size() || *it1 != opposite[numCommon]) {
+                    return false;
+                }
+                numCommon++;
+                ++it1;
+                ++it2;
+            }
+        }
+        if (numCommon != shared.size()) {
+            return false;
+        }
+
+        // reject facets that would flip or degenerate
+        auto checkFacets = [&](PointIndex moved) {
+            for (FacetIndex index : pointFacets[moved]) {
+                const MeshFacet& face = facets[index];
+                if (face.HasPoint(keep) && face.HasPoint(remove)) {
+                    continue;
+                }
+                unsigned short corner = 0;
+                for (unsigned short i = 0; i < 3; i++) {
+                    if (face._aulPoints[i] == moved) {
+                        corner = i;
+                    }
+                }
+                const Base::Vector3f& p0 = points[face._aulPoints[corner]];
+                const Base::Vector3f& p1 = points[face._aulPoints[(corner + 1) % 3]];
+                const Base::Vector3f& p2 = points[face._aulPoints[(corner + 2) % 3]];
+                Base::Vector3f oldNormal = (p1 - p0) % (p2 - p0);
+                Base::Vector3f d1 = p1 - pos;
+                Base::Vector3f d2 = p2 - pos;
+                d1.Normalize();
+                d2.Normalize();
+                if (std::fabs(d1 * d2) > 0.999F) {
+                    return false;
+                }
+                Base::Vector3f newNormal = d1 % d2;
+                newNormal.Normalize();
+                oldNormal.Normalize();
+                if (newNormal * oldNormal < 0.2F) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        return checkFacets(keep) && checkFacets(remove);
+    }
+
+    std::size_t collapse(Partition& part,
+                         PointIndex keep,
+                         PointIndex remove,
+                         const Base::Vector3f& pos)
+    {
+        std::vector<FacetIndex>& shared = part.shared;
+        edgeFacets(keep, remove, shared);
+        for (FacetIndex index : shared) {
+            MeshFacet& face = facets[index];
+            // the two other neighbours become neighbours of each other
+            unsigned short side = face.Side(keep, remove);
+            FacetIndex n1 = face._aulNeighbours[(side + 1) % 3];
+            FacetIndex n2 = face._aulNeighbours[(side + 2) % 3];
+            if (n1 != FACET_INDEX_MAX) {
+                facets[n1].ReplaceNeighbour(index, n2);
+            }
+            if (n2 != FACET_INDEX_MAX) {
+                facets[n2].ReplaceNeighbour(index, n1);
+            }
+            if (FacetIndex other = face._aulNeighbours[side]; other != FACET_INDEX_MAX) {
+                facets[other].ReplaceNeighbour(index, FACET_INDEX_MAX);
+            }
+            face._aulNeighbours[0] = FACET_INDEX_MAX;
+            face._aulNeighbours[1] = FACET_INDEX_MAX;
+            face._aulNeighbours[2] = FACET_INDEX_MAX;
+            face.SetInvalid();
+            part.numFacets--;
+
+            for (PointIndex point : face._aulPoints) {
+                auto& refs = pointFacets[point];
+                refs.erase(std::remove(refs.begin(), refs.end(), index), refs.end());
+            }
+        }
+
+        auto& keepFacets = pointFacets[keep];
+        for (FacetIndex index : pointFacets[remove]) {
+            facets[index].Transpose(remove, keep);
+            keepFacets.push_back(index);
+        }
+        std::vector<FacetIndex>().swap(pointFacets[remove]);
+        points[remove].SetInvalid();
+        points[keep].Set(pos.x, pos.y, pos.z);
+
+        quadrics[keep] += quadrics[remove];
+        border[keep] = border[keep] || border[remove];
+        part.collapses++;
+        modified[keep] = part.collapses;
+        modified[remove] = part.collapses;
+
+        neighbourPoints(keep, part.neighbours1);
+        for (PointIndex neighbour : part.neighbours1) {
+            if (owner[neighbour] == part.id) {
+                part.queue.push(makeEdge(part, keep, neighbour));
+            }
+        }
+
+        return shared.size();
+    }
+
+private:
+    MeshPointArray& points;
+    MeshFacetArray& facets;
+    std::vector<std::vector<FacetIndex>> pointFacets;
+    std::vector<Quadric> quadrics;
+    std::vector<std::uint32_t> modified;
+    std::vector<std::uint32_t> owner;
+    std::vector<char> border;
+    std::size_t numFacets {0};
+    std::atomic<std::size_t> removed {0};
+    std::atomic<bool> aborted {false};
+    std::size_t reported {0};
+};
+
+}  // namespace
+
+MeshDecimation::MeshDecimation(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+void MeshDecimation::setNumberOfThreads(unsigned int threads)
+{
+    numThreads = threads;
+}
+
+void MeshDecimation::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    auto targetSize = static_cast<std::size_t>(static_cast<float>(numFacets) * (1.0F - reduction));
+    double maxError = tolerance > 0.0F ? double(tolerance) : std::numeric_limits<double>::max();
+    decimate(targetSize, maxError);
+}
+
+void MeshDecimation::simplify(int targetSize)
+{
+    decimate(static_cast<std::size_t>(std::max(targetSize, 0)));
+}
+
+std::size_t MeshDecimation::decimate(std::size_t targetSize, double maxError)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    if (numFacets <= targetSize) {
+        return 0;
+    }
+
+    unsigned int threads = numThreads;
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    Base::SequencerLauncher seq("Decimate mesh...", numFacets - targetSize);
+    EdgeCollapser collapser(myKernel._aclPointArray, myKernel._aclFacetArray);
+    std::size_t removed = 0;
+    try {
+        removed = collapser.run(targetSize, maxError, threads, seq);
+    }
+    catch (const Base::AbortException&) {
+        // keep what has been done so far
+        myKernel.RemoveInvalids();
+        myKernel.RecalcBoundBox();
+        throw;
+    }
+
+    myKernel.RemoveInvalids();
+    myKernel.RecalcBoundBox();
+    return removed;
+}
@@ -24,6 +24,8 @@
 #ifndef MESH_DECIMATION_H
 #define MESH_DECIMATION_H
 
+#include <cstddef>
+#include <limits>
 #include <Mod/Mesh/MeshGlobal.h>
 
 namespace MeshCore
@@ -41,6 +43,41 @@ private:
     MeshKernel& myKernel;
 };
 
+/**
+ * The MeshDecimation class reduces the number of facets of a mesh by edge collapses.
+ * Unlike MeshSimplify it works directly on the arrays of the mesh kernel and always collapses the
+ * edge with the lowest quadric error next, using a priority queue. Border edges are only collapsed
+ * along the border and collapses that would flip a facet or change the topology are rejected.
+ *
+ * Large meshes are split into slabs that are decimated in parallel, the points shared by two
+ * slabs are locked. The edges along the slab borders are collapsed afterwards.
+ *
+ * The progress is reported to the sequencer. If the user cancels the operation the mesh is left
+ * in a consistent state with the collapses done so far and the exception is re-thrown.
+ */
+class MeshExport MeshDecimation
+{
+public:
+    explicit MeshDecimation(MeshKernel&);
+    /// Sets the number of threads, 0 uses the number of cores
+    void setNumberOfThreads(unsigned int threads);
+    /// Removes \a reduction (0..1) of the facets as long as the error is below \a tolerance
+    void simplify(float tolerance, float reduction);
+    /// Reduces the mesh to \a targetSize facets
+    void simplify(int targetSize);
+    /**
+     * Collapses edges until the mesh has at most \a targetSize facets or the quadric error of
+     * every remaining collapse exceeds \a maxError.
+     * @return the number of removed facets
+     */
+    std::size_t decimate(std::size_t targetSize,
+                         double maxError = std::numeric_limits<double>::max());
+
+private:
+    MeshKernel& myKernel;
+    unsigned int numThreads {0};
+};
+
 }  // namespace MeshCore
 
 
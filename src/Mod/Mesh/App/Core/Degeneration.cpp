@@ -598,7 +598,8 @@ bool MeshRemoveNeedles::Fixup()
             ce._removeFacets.push_back(neighbour);
         }
 
-        std::set<FacetIndex> vf = vf_it[ce._fromPoint];
+        MeshIndexList fromFacets = vf_it[ce._fromPoint];
+        std::set<FacetIndex> vf(fromFacets.begin(), fromFacets.end());
         vf.erase(faceedge.first);
         if (neighbour != FACET_INDEX_MAX) {
             vf.erase(neighbour);
@@ -832,9 +833,9 @@ bool MeshFixMergeFacets::Fixup()
         if (vv_it[i].size() == 3 && vf_it[i].size() == 3) {
             VertexCollapse vc;
             vc._point = i;
-            const std::set<PointIndex>& adjPts = vv_it[i];
+            MeshIndexList adjPts = vv_it[i];
             vc._circumPoints.insert(vc._circumPoints.begin(), adjPts.begin(), adjPts.end());
-            const std::set<FacetIndex>& adjFts = vf_it[i];
+            MeshIndexList adjFts = vf_it[i];
             vc._circumFacets.insert(vc._circumFacets.begin(), adjFts.begin(), adjFts.end());
             topAlg.CollapseVertex(vc);
         }
@@ -862,7 +863,7 @@ bool MeshEvalDentsOnSurface::Evaluate()
 
         // get the local neighbourhood of the point
         std::set<PointIndex> nb = clPt2Facets.NeighbourPoints(point, 1);
-        const std::set<FacetIndex>& faces = clPt2Facets[index];
+        MeshIndexList faces = clPt2Facets[index];
 
         for (PointIndex pt : nb) {
             const MeshPoint& mp = rPntAry[pt];
@@ -880,7 +881,7 @@ bool MeshEvalDentsOnSurface::Evaluate()
                 // is the point projectable onto the facet?
                 rTriangle = _rclMesh.GetFacet(f_beg[ft]);
                 if (rTriangle.IntersectWithLine(mp, rTriangle.GetNormal(), tmp)) {
-                    const std::set<FacetIndex>& f = clPt2Facets[pt];
+                    MeshIndexList f = clPt2Facets[pt];
                     this->indices.insert(this->indices.end(), f.begin(), f.end());
                     break;
                 }
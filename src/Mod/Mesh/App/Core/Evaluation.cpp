@@ -24,6 +24,8 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstdint>
+#include <thread>
 #include <vector>
 #endif
 
@@ -33,6 +35,7 @@
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Evaluation.h"
+#include "FacetTree.h"
 #include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -481,10 +484,10 @@ bool MeshEvalPointManifolds::Evaluate()
     unsigned long ctPoints = _rclMesh.CountPoints();
     for (PointIndex index = 0; index < ctPoints; index++) {
         // get the local neighbourhood of the point
-        const std::set<FacetIndex>& nf = vf_it[index];
-        const std::set<PointIndex>& np = vv_it[index];
+        MeshIndexList nf = vf_it[index];
+        MeshIndexList np = vv_it[index];
 
-        std::set<unsigned long>::size_type sp {}, sf {};
+        std::size_t sp {}, sf {};
         sp = np.size();
         sf = nf.size();
         // for an inner point the number of adjacent points is equal to the number of shared faces
@@ -597,81 +600,65 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
 
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
+// Collects the pairs of facets that intersect each other, the search stops after the first
+// pair if firstOnly is set
+std::vector<std::pair<FacetIndex, FacetIndex>> findSelfIntersections(const MeshKernel& mesh,
+                                                                     bool firstOnly)
+{
+    const MeshFacetArray& rFaces = mesh.GetFacets();
+    std::size_t count = rFaces.size();
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / 10000));
 
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes(count);
+    for (std::size_t i = 0; i < count; i++) {
+        boxes[i] = mesh.GetFacet(i).GetBoundBox();
     }
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> results(threads);
+    MeshFacetTree tree(mesh);
+    tree.OverlappingFacets(threads, [&](std::size_t thread, FacetIndex index1, FacetIndex index2) {
+        // If the facets share a common vertex we do not check for self-intersections
+        // because they could but usually do not intersect each other and the algorithm
+        // below would detect false-positives, otherwise
+        const MeshFacet& rface1 = rFaces[index1];
+        const MeshFacet& rface2 = rFaces[index2];
+        for (PointIndex point : rface1._aulPoints) {
+            if (rface2.HasPoint(point)) {
+                return true;  // ignore facets sharing a common vertex
+            }
         }
 
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
+        if (boxes[index1] && boxes[index2]) {
+            Base::Vector3f pt1, pt2;
+            MeshGeomFacet facet1 = mesh.GetFacet(index1);
+            MeshGeomFacet facet2 = mesh.GetFacet(index2);
+            int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+            if (ret == 2) {
+                results[thread].emplace_back(index1, index2);
+                return !firstOnly;
             }
         }
+        return true;
+    });
+
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    for (const auto& it : results) {
+        intersection.insert(intersection.end(), it.begin(), it.end());
     }
+    std::sort(intersection.begin(), intersection.end());
+    return intersection;
+}
 
-    return true;
+}  // namespace
+
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    return findSelfIntersections(_rclMesh, true).empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -702,77 +689,8 @@ void MeshEvalSelfIntersection::GetIntersections(
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
-    }
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs = findSelfIntersections(_rclMesh, false);
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -966,76 +884,138 @@ bool MeshFixNeighbourhood::Fixup()
     return true;
 }
 
-void MeshKernel::RebuildNeighbours(FacetIndex index)
+namespace
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
+// An edge of a facet. The key holds both point indices, the lower one in the upper bits,
+// the value holds the facet index and the side of the edge in the facet.
+struct FacetEdge
+{
+    std::uint64_t key;
+    std::uint64_t value;
+};
 
-    // build up an array of edges
-    auto pB = this->_aclFacetArray.begin();
-    for (auto pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - pB;
-            edges.push_back(item);
-        }
+int bitWidth(std::uint64_t value)
+{
+    int bits = 0;
+    while (value) {
+        value >>= 1;
+        bits++;
     }
+    return bits;
+}
+}  // namespace
 
-    // sort the edges
-    // std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+void MeshKernel::RebuildNeighbours(FacetIndex index)
+{
+    MeshFacetArray& facets = this->_aclFacetArray;
+    if (index >= facets.size()) {
+        return;
+    }
 
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
+    std::size_t numFacets = facets.size() - index;
+    std::size_t numEdges = 3 * numFacets;
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    std::size_t blocks = std::min(hardware, std::max<std::size_t>(1, numFacets / 10000));
+
+    // the highest point index decides about the width of the keys
+    std::vector<PointIndex> maxPoints(blocks, 0);
+    parallel_blocks(numFacets, blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        PointIndex maxPoint = 0;
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = facets[index + i];
+            for (PointIndex point : face._aulPoints) {
+                maxPoint = std::max(maxPoint, point);
+            }
         }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                MeshFacet& rFace0 = this->_aclFacetArray[f0];
-                MeshFacet& rFace1 = this->_aclFacetArray[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                rFace0._aulNeighbours[side0] = f1;
-                rFace1._aulNeighbours[side1] = f0;
+        maxPoints[b] = maxPoint;
+    });
+    int pointBits = std::max(1, bitWidth(*std::max_element(maxPoints.begin(), maxPoints.end())));
+
+    // build up an array of edges
+    std::vector<FacetEdge> edges(numEdges);
+    parallel_blocks(numFacets, blocks, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = facets[index + i];
+            for (unsigned short side = 0; side < 3; side++) {
+                std::uint64_t p0 = face._aulPoints[side];
+                std::uint64_t p1 = face._aulPoints[(side + 1) % 3];
+                FacetEdge& edge = edges[3 * i + side];
+                edge.key = pointBits < 32 ? (std::min(p0, p1) << pointBits) | std::max(p0, p1)
+                                          : 0;
+                edge.value = ((index + i) << 2) | side;
             }
-            else if (count == 1) {
-                MeshFacet& rFace = this->_aclFacetArray[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                rFace._aulNeighbours[side] = FACET_INDEX_MAX;
+        }
+    });
+
+    // sort the edges, radix sort as long as both point indices fit into the key
+    auto keyLess = [](const FacetEdge& x, const FacetEdge& y) {
+        return x.key < y.key;
+    };
+    if (pointBits >= 32) {
+        auto pointsOf = [&facets](const FacetEdge& edge) {
+            const MeshFacet& face = facets[edge.value >> 2];
+            unsigned short side = edge.value & 3;
+            PointIndex p0 = face._aulPoints[side];
+            PointIndex p1 = face._aulPoints[(side + 1) % 3];
+            return std::make_pair(std::min(p0, p1), std::max(p0, p1));
+        };
+        auto pointsLess = [&pointsOf](const FacetEdge& x, const FacetEdge& y) {
+            return pointsOf(x) < pointsOf(y);
+        };
+        MeshCore::parallel_sort(edges.begin(), edges.end(), pointsLess, int(hardware));
+        // replace the keys by the rank of the edge so that equal edges share their key
+        std::uint64_t rank = 0;
+        for (std::size_t i = 0; i < numEdges; i++) {
+            if (i > 0 && pointsLess(edges[i - 1], edges[i])) {
+                rank++;
             }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
+            edges[i].key = rank;
         }
     }
-
-    // we handle only the cases for 1 and 2, for all higher
-    // values we have a non-manifold that is ignored here
-    if (count == 2) {
-        MeshFacet& rFace0 = this->_aclFacetArray[f0];
-        MeshFacet& rFace1 = this->_aclFacetArray[f1];
-        unsigned short side0 = rFace0.Side(p0, p1);
-        unsigned short side1 = rFace1.Side(p0, p1);
-        rFace0._aulNeighbours[side0] = f1;
-        rFace1._aulNeighbours[side1] = f0;
+    else if (numEdges < (std::size_t(1) << 16)) {
+        std::sort(edges.begin(), edges.end(), keyLess);
     }
-    else if (count == 1) {
-        MeshFacet& rFace = this->_aclFacetArray[f0];
-        unsigned short side = rFace.Side(p0, p1);
-        rFace._aulNeighbours[side] = FACET_INDEX_MAX;
+    else {
+        MeshCore::parallel_radix_sort(
+            edges,
+            [](const FacetEdge& edge) {
+                return edge.key;
+            },
+            2 * pointBits,
+            int(blocks));
     }
+
+    // Link the facets sharing an edge. A run of equal keys is handled by the block it
+    // starts in, so every facet side is written by exactly one thread. We handle only
+    // the cases for 1 and 2, for all higher values we have a non-manifold that is
+    // ignored here.
+    parallel_blocks(numEdges, blocks, [&](std::size_t, std::size_t begin, std::size_t end) {
+        if (begin > 0) {
+            while (begin < end && edges[begin].key == edges[begin - 1].key) {
+                ++begin;
+            }
+        }
+        std::size_t pos = begin;
+        while (pos < end) {
+            std::size_t next = pos + 1;
+            while (next < numEdges && edges[next].key == edges[pos].key) {
+                ++next;
+            }
+
+            FacetIndex f0 = edges[pos].value >> 2;
+            unsigned short side0 = edges[pos].value & 3;
+            if (next - pos == 2) {
+                FacetIndex f1 = edges[pos + 1].value >> 2;
+                unsigned short side1 = edges[pos + 1].value & 3;
+                facets[f0]._aulNeighbours[side0] = f1;
+                facets[f1]._aulNeighbours[side1] = f0;
+            }
+            else if (next - pos == 1) {
+                facets[f0]._aulNeighbours[side0] = FACET_INDEX_MAX;
+            }
+            pos = next;
+        }
+    });
 }
 
 void MeshKernel::RebuildNeighbours()
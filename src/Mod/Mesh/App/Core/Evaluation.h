@@ -322,6 +322,7 @@ private:
 
 /**
  * The MeshEvalSelfIntersection class checks the mesh for self intersection.
+ * The candidate pairs of facets come from a MeshFacetTree and are tested in parallel.
  * @author Werner Mayer
  */
 class MeshExport MeshEvalSelfIntersection: public MeshEvaluation
@@ -335,7 +336,7 @@ public:
     /// collect all intersection lines
     void GetIntersections(const std::vector<std::pair<FacetIndex, FacetIndex>>&,
                           std::vector<std::pair<Base::Vector3f, Base::Vector3f>>&) const;
-    /// collect the index of all facets with self intersections
+    /// collect the index of all facets with self intersections, each pair once and sorted
     void GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&) const;
 };
 
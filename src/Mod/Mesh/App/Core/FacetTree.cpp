@@ -0,0 +1,589 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <numeric>
+#endif
+
+#include "FacetTree.h"
+#include "Iterator.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+inline float sqrDistanceToBox(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    float dx = std::max({box.MinX - pnt.x, 0.0F, pnt.x - box.MaxX});
+    float dy = std::max({box.MinY - pnt.y, 0.0F, pnt.y - box.MaxY});
+    float dz = std::max({box.MinZ - pnt.z, 0.0F, pnt.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// squared distance of (px,py,pz) to the segment from (ox,oy,oz) along (dx,dy,dz)
+inline float
+sqrDistanceToSegment(float px, float py, float pz, float ox, float oy, float oz, float dx, float dy, float dz)
+{
+    float wx = px - ox;
+    float wy = py - oy;
+    float wz = pz - oz;
+    // a degenerated segment gives t = 0
+    float len = std::max(dx * dx + dy * dy + dz * dz, std::numeric_limits<float>::min());
+    float t = std::min(std::max((wx * dx + wy * dy + wz * dz) / len, 0.0F), 1.0F);
+    wx -= t * dx;
+    wy -= t * dy;
+    wz -= t * dz;
+    return wx * wx + wy * wy + wz * wz;
+}
+
+// Distance along the ray to the box, in units of the direction. Infinity if the ray misses
+// the box, with backward set the part of the line behind the start counts as well.
+inline float rayParamToBox(const Base::BoundBox3f& box,
+                           const Base::Vector3f& pnt,
+                           const Base::Vector3f& inv,
+                           bool backward)
+{
+    float tmin = backward ? -std::numeric_limits<float>::infinity() : 0.0F;
+    float tmax = std::numeric_limits<float>::infinity();
+    const float boxMin[3] = {box.MinX, box.MinY, box.MinZ};
+    const float boxMax[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    const float start[3] = {pnt.x, pnt.y, pnt.z};
+    const float scale[3] = {inv.x, inv.y, inv.z};
+    for (int i = 0; i < 3; i++) {
+        // NaN for a start on a slab parallel to the ray, std::min/std::max then ignore it
+        float t1 = (boxMin[i] - start[i]) * scale[i];
+        float t2 = (boxMax[i] - start[i]) * scale[i];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+    }
+    if (tmin > tmax) {
+        return std::numeric_limits<float>::infinity();
+    }
+    if (tmin <= 0.0F && tmax >= 0.0F) {
+        return 0.0F;
+    }
+    return std::min(std::fabs(tmin), std::fabs(tmax));
+}
+}  // namespace
+
+MeshFacetTree::MeshFacetTree(const MeshKernel& mesh, const Base::Matrix4D& mat)
+{
+    std::vector<Base::Vector3f> corners;
+    corners.reserve(3 * mesh.CountFacets());
+    MeshFacetIterator it(mesh);
+    it.Transform(mat);
+    for (it.Init(); it.More(); it.Next()) {
+        const MeshGeomFacet& facet = *it;
+        corners.insert(corners.end(), std::begin(facet._aclPoints), std::end(facet._aclPoints));
+    }
+    Build(corners);
+}
+
+MeshFacetTree::MeshFacetTree(const std::vector<MeshGeomFacet>& facets)
+{
+    std::vector<Base::Vector3f> corners;
+    corners.reserve(3 * facets.size());
+    for (const auto& facet : facets) {
+        corners.insert(corners.end(), std::begin(facet._aclPoints), std::end(facet._aclPoints));
+    }
+    Build(corners);
+}
+
+void MeshFacetTree::Build(const std::vector<Base::Vector3f>& corners)
+{
+    std::size_t numFacets = corners.size() / 3;
+    std::vector<Base::Vector3f> centers(numFacets);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        centers[i] = (corners[3 * i] + corners[3 * i + 1] + corners[3 * i + 2]) / 3.0F;
+    }
+
+    std::vector<std::uint32_t> order(numFacets);
+    std::iota(order.begin(), order.end(), 0);
+    _nodes.reserve(2 * numFacets / LeafSize + 1);
+    if (numFacets > 0) {
+        Build(order, centers, 0, static_cast<std::uint32_t>(numFacets));
+    }
+
+    // store the facets in the order of the leaves
+    _facetIndex.resize(numFacets);
+    for (auto* array : {&_ax, &_ay, &_az, &_bx, &_by, &_bz, &_cx, &_cy, &_cz}) {
+        array->resize(numFacets);
+    }
+    for (std::size_t i = 0; i < numFacets; i++) {
+        std::uint32_t index = order[i];
+        const Base::Vector3f& p0 = corners[3 * index];
+        Base::Vector3f e1 = corners[3 * index + 1] - p0;
+        Base::Vector3f e2 = corners[3 * index + 2] - p0;
+        _facetIndex[i] = index;
+        _ax[i] = p0.x;
+        _ay[i] = p0.y;
+        _az[i] = p0.z;
+        _bx[i] = e1.x;
+        _by[i] = e1.y;
+        _bz[i] = e1.z;
+        _cx[i] = e2.x;
+        _cy[i] = e2.y;
+        _cz[i] = e2.z;
+    }
+
+    // the boxes of the leaves, then the inner nodes from the bottom upwards
+    for (auto node = _nodes.rbegin(); node != _nodes.rend(); ++node) {
+        if (node->count > 0) {
+            for (std::uint32_t i = node->first; i < node->first + node->count; i++) {
+                Base::Vector3f p0(_ax[i], _ay[i], _az[i]);
+                node->box.Add(p0);
+                node->box.Add(p0 + Base::Vector3f(_bx[i], _by[i], _bz[i]));
+                node->box.Add(p0 + Base::Vector3f(_cx[i], _cy[i], _cz[i]));
+                // the exact corners as well for the overlap tests
+                node->box.Add(corners[3 * order[i] + 1]);
+                node->box.Add(corners[3 * order[i] + 2]);
+            }
+        }
+        else {
+            std::size_t index = node.base() - _nodes.begin() - 1;
+            node->box.Add(_nodes[index + 1].box);
+            node->box.Add(_nodes[node->first].box);
+        }
+    }
+}
+
+void MeshFacetTree::Build(std::vector<std::uint32_t>& order,
+                          const std::vector<Base::Vector3f>& centers,
+                          std::uint32_t begin,
+                          std::uint32_t end)
+{
+    std::size_t index = _nodes.size();
+    _nodes.emplace_back();
+    if (end - begin <= LeafSize) {
+        _nodes[index].first = begin;
+        _nodes[index].count = end - begin;
+        return;
+    }
+
+    // split at the median of the centers along the longest axis
+    Base::BoundBox3f box;
+    for (std::uint32_t i = begin; i < end; i++) {
+        box.Add(centers[order[i]]);
+    }
+    float Base::Vector3f::*axis = &Base::Vector3f::x;
+    if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+        axis = &Base::Vector3f::y;
+    }
+    else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+        axis = &Base::Vector3f::z;
+    }
+
+    std::uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin,
+                     order.begin() + mid,
+                     order.begin() + end,
+                     [&centers, axis](std::uint32_t lhs, std::uint32_t rhs) {
+                         return centers[lhs].*axis < centers[rhs].*axis;
+                     });
+
+    Build(order, centers, begin, mid);
+    _nodes[index].first = static_cast<std::uint32_t>(_nodes.size());
+    Build(order, centers, mid, end);
+}
+
+void MeshFacetTree::LeafDistances(const Node& node, const Base::Vector3f& pnt, float* sqrDist) const
+{
+    // Distance to the plane if the point projects into the facet, otherwise to the
+    // nearest edge. Everything is computed for every facet and selected afterwards, so
+    // the loop has no branches.
+    const float* pax = _ax.data() + node.first;
+    const float* pay = _ay.data() + node.first;
+    const float* paz = _az.data() + node.first;
+    const float* pbx = _bx.data() + node.first;
+    const float* pby = _by.data() + node.first;
+    const float* pbz = _bz.data() + node.first;
+    const float* pcx = _cx.data() + node.first;
+    const float* pcy = _cy.data() + node.first;
+    const float* pcz = _cz.data() + node.first;
+    const std::uint32_t count = node.count;
+    for (std::uint32_t j = 0; j < count; j++) {
+        float ax = pax[j], ay = pay[j], az = paz[j];
+        float bx = pbx[j], by = pby[j], bz = pbz[j];
+        float cx = pcx[j], cy = pcy[j], cz = pcz[j];
+        float wx = pnt.x - ax, wy = pnt.y - ay, wz = pnt.z - az;
+
+        // normal of the facet
+        float nx = by * cz - bz * cy;
+        float ny = bz * cx - bx * cz;
+        float nz = bx * cy - by * cx;
+        float nn = nx * nx + ny * ny + nz * nz;
+
+        // sub-areas of the projected point, inside if all have the sign of the normal
+        float dx = cx - bx, dy = cy - by, dz = cz - bz;
+        float vx = wx - bx, vy = wy - by, vz = wz - bz;
+        float s1 = (by * wz - bz * wy) * nx + (bz * wx - bx * wz) * ny + (bx * wy - by * wx) * nz;
+        float s2 = (dy * vz - dz * vy) * nx + (dz * vx - dx * vz) * ny + (dx * vy - dy * vx) * nz;
+        float s3 = (wy * cz - wz * cy) * nx + (wz * cx - wx * cz) * ny + (wx * cy - wy * cx) * nz;
+        bool inside = (nn > 0.0F) & (s1 >= 0.0F) & (s2 >= 0.0F) & (s3 >= 0.0F);
+
+        float plane = wx * nx + wy * ny + wz * nz;
+        float planeDist = plane * plane / std::max(nn, std::numeric_limits<float>::min());
+
+        float edge1 = sqrDistanceToSegment(pnt.x, pnt.y, pnt.z, ax, ay, az, bx, by, bz);
+        float edge2 = sqrDistanceToSegment(pnt.x, pnt.y, pnt.z, ax, ay, az, cx, cy, cz);
+        float edge3 = sqrDistanceToSegment(pnt.x, pnt.y, pnt.z, ax + bx, ay + by, az + bz, dx, dy, dz);
+        float edgeDist = std::min(std::min(edge1, edge2), edge3);
+
+        sqrDist[j] = inside ? planeDist : edgeDist;
+    }
+}
+
+FacetIndex MeshFacetTree::NearestFacet(const Base::Vector3f& pnt, float maxDist, float& dist) const
+{
+    if (_nodes.empty()) {
+        return FACET_INDEX_MAX;
+    }
+
+    FacetIndex nearest = FACET_INDEX_MAX;
+    float best = maxDist * maxDist;
+    std::array<float, LeafSize> sqrDist {};
+
+    // the depth of the tree is limited by the 32 bit indices
+    std::array<std::uint32_t, 64> stack {};
+    std::size_t size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node& node = _nodes[stack[--size]];
+        if (sqrDistanceToBox(node.box, pnt) > best) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            LeafDistances(node, pnt, sqrDist.data());
+            for (std::uint32_t j = 0; j < node.count; j++) {
+                if (sqrDist[j] <= best) {
+                    best = sqrDist[j];
+                    nearest = _facetIndex[node.first + j];
+                }
+            }
+        }
+        else {
+            // visit the nearer child first
+            auto first = static_cast<std::uint32_t>(&node - _nodes.data()) + 1;
+            std::uint32_t second = node.first;
+            float dist1 = sqrDistanceToBox(_nodes[first].box, pnt);
+            float dist2 = sqrDistanceToBox(_nodes[second].box, pnt);
+            if (dist1 < dist2) {
+                std::swap(first, second);
+            }
+            stack[size++] = first;
+            stack[size++] = second;
+        }
+    }
+
+    if (nearest != FACET_INDEX_MAX) {
+        dist = std::sqrt(best);
+    }
+    return nearest;
+}
+
+void MeshFacetTree::LeafIntersections(const Node& node,
+                                      const Base::Vector3f& pnt,
+                                      const Base::Vector3f& dir,
+                                      float cosMaxAngle,
+                                      bool backward,
+                                      float* param) const
+{
+    // The same tests as MeshGeomFacet::Foraminate(), done for every facet and combined at the
+    // end so the loop has no branches. The ray parameter of a hit is stored, infinity otherwise.
+    const float eps = 1e-06F;
+    const float dd = dir.x * dir.x + dir.y * dir.y + dir.z * dir.z;
+    const float* pax = _ax.data() + node.first;
+    const float* pay = _ay.data() + node.first;
+    const float* paz = _az.data() + node.first;
+    const float* pbx = _bx.data() + node.first;
+    const float* pby = _by.data() + node.first;
+    const float* pbz = _bz.data() + node.first;
+    const float* pcx = _cx.data() + node.first;
+    const float* pcy = _cy.data() + node.first;
+    const float* pcz = _cz.data() + node.first;
+    const std::uint32_t count = node.count;
+    for (std::uint32_t j = 0; j < count; j++) {
+        float ux = pbx[j], uy = pby[j], uz = pbz[j];
+        float vx = pcx[j], vy = pcy[j], vz = pcz[j];
+        float wx = pnt.x - pax[j], wy = pnt.y - pay[j], wz = pnt.z - paz[j];
+
+        float nx = uy * vz - uz * vy;
+        float ny = uz * vx - ux * vz;
+        float nz = ux * vy - uy * vx;
+        float nn = nx * nx + ny * ny + nz * nz;
+        float nd = nx * dir.x + ny * dir.y + nz * dir.z;
+
+        // the angle to the normal and the line mustn't be parallel to the facet
+        bool facing = nd >= cosMaxAngle * std::sqrt(nn * dd);
+        bool crossing = (nd * nd) > (eps * dd * nn);
+        float r = -(nx * wx + ny * wy + nz * wz) / (crossing ? nd : 1.0F);
+        wx += r * dir.x;
+        wy += r * dir.y;
+        wz += r * dir.z;
+
+        float uu = ux * ux + uy * uy + uz * uz;
+        float uv = ux * vx + uy * vy + uz * vz;
+        float vv = vx * vx + vy * vy + vz * vz;
+        float wu = wx * ux + wy * uy + wz * uz;
+        float wv = wx * vx + wy * vy + wz * vz;
+        float det = std::fabs((uu * vv) - (uv * uv));
+        float s = (vv * wu) - (uv * wv);
+        float t = (uu * wv) - (uv * wu);
+
+        bool hit = facing & crossing & (s >= 0.0F) & (t >= 0.0F) & ((s + t) <= det)
+            & (backward | (r >= 0.0F));
+        param[j] = hit ? std::fabs(r) : std::numeric_limits<float>::infinity();
+    }
+}
+
+FacetIndex MeshFacetTree::NearestFacetOnRay(const Base::Vector3f& pnt,
+                                            const Base::Vector3f& dir,
+                                            float maxAngle,
+                                            Base::Vector3f& res,
+                                            bool backward) const
+{
+    if (_nodes.empty()) {
+        return FACET_INDEX_MAX;
+    }
+
+    // no angle is greater than pi, also with rounding errors
+    const float cosMaxAngle = maxAngle < Mathf::PI ? std::cos(maxAngle) : -2.0F;
+    const Base::Vector3f inv(1.0F / dir.x, 1.0F / dir.y, 1.0F / dir.z);
+
+    std::uint32_t nearest = 0;
+    float best = std::numeric_limits<float>::infinity();
+    std::array<float, LeafSize> param {};
+
+    std::array<std::uint32_t, 64> stack {};
+    std::size_t size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node& node = _nodes[stack[--size]];
+        // also skips the boxes missed by the ray as long as nothing is hit
+        if (rayParamToBox(node.box, pnt, inv, backward) >= best) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            LeafIntersections(node, pnt, dir, cosMaxAngle, backward, param.data());
+            for (std::uint32_t j = 0; j < node.count; j++) {
+                if (param[j] < best) {
+                    best = param[j];
+                    nearest = node.first + j;
+                }
+            }
+        }
+        else {
+            // visit the nearer child first
+            auto first = static_cast<std::uint32_t>(&node - _nodes.data()) + 1;
+            std::uint32_t second = node.first;
+            float dist1 = rayParamToBox(_nodes[first].box, pnt, inv, backward);
+            float dist2 = rayParamToBox(_nodes[second].box, pnt, inv, backward);
+            if (dist1 < dist2) {
+                std::swap(first, second);
+            }
+            stack[size++] = first;
+            stack[size++] = second;
+        }
+    }
+
+    if (best == std::numeric_limits<float>::infinity()) {
+        return FACET_INDEX_MAX;
+    }
+
+    // the intersection point as Foraminate computes it, the facet's plane at the ray parameter
+    Base::Vector3f base(_ax[nearest], _ay[nearest], _az[nearest]);
+    Base::Vector3f normal = Base::Vector3f(_bx[nearest], _by[nearest], _bz[nearest])
+        % Base::Vector3f(_cx[nearest], _cy[nearest], _cz[nearest]);
+    float r = -(normal * (pnt - base)) / (normal * dir);
+    res = pnt + r * dir;
+    return _facetIndex[nearest];
+}
+
+bool MeshFacetTree::Overlaps(const MeshFacetTree& other,
+                             std::size_t thread,
+                             std::uint32_t node1,
+                             std::uint32_t node2,
+                             const OverlapFunc& func,
+                             const std::atomic<bool>& stop) const
+{
+    // within the same tree a node paired with itself stands for the pairs of its own facets
+    const bool self = (&other == this);
+    auto report = [&](std::uint32_t i, std::uint32_t j) {
+        FacetIndex facet1 = _facetIndex[i];
+        FacetIndex facet2 = other._facetIndex[j];
+        if (self && facet2 < facet1) {
+            std::swap(facet1, facet2);
+        }
+        return func(thread, facet1, facet2);
+    };
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack;
+    stack.emplace_back(node1, node2);
+    while (!stack.empty()) {
+        if (stop) {
+            return false;
+        }
+        auto [index1, index2] = stack.back();
+        stack.pop_back();
+        const Node& first = _nodes[index1];
+        const Node& second = other._nodes[index2];
+        if (self && index1 == index2) {
+            if (first.count > 0) {
+                for (std::uint32_t i = first.first; i < first.first + first.count; i++) {
+                    for (std::uint32_t j = i + 1; j < first.first + first.count; j++) {
+                        if (!report(i, j)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            else {
+                stack.emplace_back(index1 + 1, index1 + 1);
+                stack.emplace_back(first.first, first.first);
+                stack.emplace_back(index1 + 1, first.first);
+            }
+        }
+        else if (!(first.box && second.box)) {
+            continue;
+        }
+        else if (first.count > 0 && second.count > 0) {
+            for (std::uint32_t i = first.first; i < first.first + first.count; i++) {
+                for (std::uint32_t j = second.first; j < second.first + second.count; j++) {
+                    if (!report(i, j)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        else if (second.count > 0
+                 || (first.count == 0
+                     && first.box.CalcDiagonalLength() >= second.box.CalcDiagonalLength())) {
+            // descend into the larger node
+            stack.emplace_back(index1 + 1, index2);
+            stack.emplace_back(first.first, index2);
+        }
+        else {
+            stack.emplace_back(index1, index2 + 1);
+            stack.emplace_back(index1, second.first);
+        }
+    }
+
+    return true;
+}
+
+void MeshFacetTree::OverlappingFacets(std::size_t threads, const OverlapFunc& func) const
+{
+    Overlapping(*this, threads, func);
+}
+
+void MeshFacetTree::OverlappingFacets(const MeshFacetTree& other,
+                                      std::size_t threads,
+                                      const OverlapFunc& func) const
+{
+    Overlapping(other, threads, func);
+}
+
+void MeshFacetTree::Overlapping(const MeshFacetTree& other,
+                                std::size_t threads,
+                                const OverlapFunc& func) const
+{
+    if (_nodes.empty() || other._nodes.empty()) {
+        return;
+    }
+
+    // Split the upper levels of the traversal into enough tasks for the threads. The
+    // pairs of a node with itself are split into those of its children and the pairs
+    // between its children.
+    const bool self = (&other == this);
+    threads = std::max<std::size_t>(threads, 1);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> tasks;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> level;
+    level.emplace_back(0, 0);
+    while (threads > 1 && !level.empty() && tasks.size() + level.size() < 16 * threads) {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> next;
+        for (auto [index1, index2] : level) {
+            const Node& first = _nodes[index1];
+            const Node& second = other._nodes[index2];
+            if (self && index1 == index2) {
+                if (first.count > 0) {
+                    tasks.emplace_back(index1, index2);
+                }
+                else {
+                    next.emplace_back(index1 + 1, index1 + 1);
+                    next.emplace_back(first.first, first.first);
+                    next.emplace_back(index1 + 1, first.first);
+                }
+            }
+            else if (!(first.box && second.box)) {
+                continue;
+            }
+            else if (first.count == 0) {
+                next.emplace_back(index1 + 1, index2);
+                next.emplace_back(first.first, index2);
+            }
+            else if (second.count == 0) {
+                next.emplace_back(index1, index2 + 1);
+                next.emplace_back(index1, second.first);
+            }
+            else {
+                tasks.emplace_back(index1, index2);
+            }
+        }
+        level.swap(next);
+    }
+    tasks.insert(tasks.end(), level.begin(), level.end());
+    if (tasks.empty()) {
+        return;
+    }
+
+    std::atomic<std::size_t> nextTask {0};
+    std::atomic<bool> stop {false};
+    auto work = [&](std::size_t thread) {
+        for (std::size_t task = nextTask++; task < tasks.size(); task = nextTask++) {
+            if (!Overlaps(other, thread, tasks[task].first, tasks[task].second, func, stop)) {
+                stop = true;
+                return;
+            }
+        }
+    };
+
+    threads = std::min(threads, tasks.size());
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < threads; t++) {
+        futures.push_back(std::async(std::launch::async, work, t));
+    }
+    work(0);
+    for (auto& future : futures) {
+        future.get();
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_FACETTREE_H
+#define MESH_FACETTREE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+
+#include "Definitions.h"
+
+namespace MeshCore
+{
+class MeshKernel;
+class MeshGeomFacet;
+
+/**
+ * The MeshFacetTree class is a bounding volume hierarchy over the facets of a mesh to
+ * find the nearest facet of a point or the facet hit by a ray. Unlike a regular grid it adapts to very uneven
+ * facet sizes.
+ *
+ * The tree keeps its own copy of the facets, optionally transformed by a matrix, so the
+ * mesh may be changed afterwards. The facets of a leaf are stored as separate coordinate
+ * arrays and the point-triangle distances and ray intersections of a leaf are computed
+ * without branches, which lets the compiler vectorize the loops. The class is thread-safe for queries.
+ */
+class MeshExport MeshFacetTree
+{
+public:
+    explicit MeshFacetTree(const MeshKernel& mesh, const Base::Matrix4D& mat = Base::Matrix4D());
+    /// The facet indices refer to the position in \a facets
+    explicit MeshFacetTree(const std::vector<MeshGeomFacet>& facets);
+
+    /**
+     * Searches for the facet nearest to \a pnt within the distance \a maxDist.
+     * Returns FACET_INDEX_MAX if there is none, otherwise \a dist is set to the
+     * distance.
+     */
+    FacetIndex NearestFacet(const Base::Vector3f& pnt, float maxDist, float& dist) const;
+    /**
+     * Searches for the facet hit by the ray from \a pnt along \a dir with the intersection
+     * nearest to \a pnt. Facets whose normal has an angle greater than \a maxAngle to \a dir
+     * are skipped. With \a backward set intersections behind \a pnt count as well, like
+     * MeshGeomFacet::Foraminate() does. Returns FACET_INDEX_MAX if there is none, otherwise
+     * \a res is set to the intersection point.
+     */
+    FacetIndex NearestFacetOnRay(const Base::Vector3f& pnt,
+                                 const Base::Vector3f& dir,
+                                 float maxAngle,
+                                 Base::Vector3f& res,
+                                 bool backward = false) const;
+    /// Called for a candidate pair with the thread number and the facet indices
+    using OverlapFunc = std::function<bool(std::size_t, FacetIndex, FacetIndex)>;
+    /**
+     * Calls \a func for all pairs of facets in leaves with overlapping boxes, i.e. the
+     * candidates for intersections of the mesh with itself. Each pair is passed once with
+     * the lower index first, the boxes of the facets themselves aren't tested. The search
+     * runs on \a threads threads, so \a func is called concurrently with the number of the
+     * calling thread in [0, threads), 0 being the calling thread. The search stops as soon
+     * as \a func returns false.
+     */
+    void OverlappingFacets(std::size_t threads, const OverlapFunc& func) const;
+    /**
+     * Same as above for the pairs of a facet of this tree and a facet of \a other, the
+     * first index refers to this tree and the second one to \a other.
+     */
+    void OverlappingFacets(const MeshFacetTree& other,
+                           std::size_t threads,
+                           const OverlapFunc& func) const;
+    /// Number of facets
+    std::size_t CountFacets() const
+    {
+        return _facetIndex.size();
+    }
+
+private:
+    static constexpr std::uint32_t LeafSize = 8;
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        // a leaf refers to its facets, an inner node to its second child, the first
+        // child directly follows the node
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    // the corners of the facets, three per facet
+    void Build(const std::vector<Base::Vector3f>& corners);
+    void Build(std::vector<std::uint32_t>& order,
+               const std::vector<Base::Vector3f>& centers,
+               std::uint32_t begin,
+               std::uint32_t end);
+    void LeafDistances(const Node& node, const Base::Vector3f& pnt, float* sqrDist) const;
+    void LeafIntersections(const Node& node,
+                           const Base::Vector3f& pnt,
+                           const Base::Vector3f& dir,
+                           float cosMaxAngle,
+                           bool backward,
+                           float* param) const;
+    void
+    Overlapping(const MeshFacetTree& other, std::size_t threads, const OverlapFunc& func) const;
+    bool Overlaps(const MeshFacetTree& other,
+                  std::size_t thread,
+                  std::uint32_t node1,
+                  std::uint32_t node2,
+                  const OverlapFunc& func,
+                  const std::atomic<bool>& stop) const;
+
+private:
+    std::vector<Node> _nodes;
+    std::vector<FacetIndex> _facetIndex;
+    // first corner and the two edges from it of every facet in the order of the leaves
+    std::vector<float> _ax, _ay, _az;
+    std::vector<float> _bx, _by, _bz;
+    std::vector<float> _cx, _cy, _cz;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_FACETTREE_H
@@ -24,7 +24,9 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <cstdint>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,74 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/*!
+ * \brief Splits the range [0, count) into \a blocks contiguous blocks and calls
+ * \a func(block, begin, end) for each of them in its own thread. The split only
+ * depends on \a count and \a blocks, so two calls with the same arguments see
+ * the same blocks.
+ */
+template<class Func>
+static void parallel_blocks(std::size_t count, std::size_t blocks, Func func)
+{
+    blocks = std::max<std::size_t>(1, blocks);
+    std::size_t chunk = (count + blocks - 1) / blocks;
+    std::vector<std::future<void>> futures;
+    futures.reserve(blocks);
+    for (std::size_t b = 1; b < blocks; b++) {
+        std::size_t begin = std::min(count, b * chunk);
+        std::size_t end = std::min(count, begin + chunk);
+        futures.push_back(std::async(std::launch::async, func, b, begin, end));
+    }
+    func(std::size_t(0), std::size_t(0), std::min(count, chunk));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+/*!
+ * \brief Stable LSD radix sort of \a data by the unsigned integer \a key(element),
+ * of which only the lower \a keyBits bits are used. Every pass handles 16 bits,
+ * counting and scattering is split over \a threads threads.
+ */
+template<class T, class Key>
+static void parallel_radix_sort(std::vector<T>& data, Key key, int keyBits, int threads)
+{
+    constexpr int digitBits = 16;
+    constexpr std::size_t buckets = std::size_t(1) << digitBits;
+    constexpr std::size_t mask = buckets - 1;
+
+    std::size_t blocks = std::max(1, threads);
+    std::vector<T> buffer(data.size());
+    std::vector<std::size_t> offsets(blocks * buckets);
+    for (int shift = 0; shift < keyBits; shift += digitBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        parallel_blocks(data.size(), blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+            std::size_t* count = &offsets[b * buckets];
+            for (std::size_t i = begin; i < end; i++) {
+                ++count[(std::uint64_t(key(data[i])) >> shift) & mask];
+            }
+        });
+
+        // digits first, then blocks keeps the order of equal keys
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d < buckets; d++) {
+            for (std::size_t b = 0; b < blocks; b++) {
+                std::size_t count = offsets[b * buckets + d];
+                offsets[b * buckets + d] = sum;
+                sum += count;
+            }
+        }
+
+        parallel_blocks(data.size(), blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+            std::size_t* offset = &offsets[b * buckets];
+            for (std::size_t i = begin; i < end; i++) {
+                buffer[offset[(std::uint64_t(key(data[i])) >> shift) & mask]++] = data[i];
+            }
+        });
+        data.swap(buffer);
+    }
+}
+
 }  // namespace MeshCore
 
 
@@ -25,7 +25,9 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <future>
 #include <limits>
+#include <thread>
 #endif
 
 #include "Algorithm.h"
@@ -73,9 +75,28 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 void MeshGrid::Clear()
 {
     _aulGrid.clear();
+    _aulCellOffsets.clear();
+    _aulCellElements.clear();
     _pclMesh = nullptr;
 }
 
+void MeshGrid::SetCompactStorage(bool on)
+{
+    if (!SupportsCompactStorage() || _bCompact == on) {
+        return;
+    }
+
+    _bCompact = on;
+    if (_pclMesh) {
+        if (on) {
+            PackCompactStorage();
+        }
+        else {
+            RebuildGrid();
+        }
+    }
+}
+
 void MeshGrid::Rebuild(unsigned long ulX, unsigned long ulY, unsigned long ulZ)
 {
     _ulCtGridsX = ulX;
@@ -131,6 +152,13 @@ void MeshGrid::InitGrid()
 
     // Create data structure
     _aulGrid.clear();
+    _aulCellOffsets.clear();
+    _aulCellElements.clear();
+    if (_bCompact) {
+        // filled by BuildCompactStorage()
+        return;
+    }
+
     _aulGrid.resize(_ulCtGridsX);
     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
         _aulGrid[i].resize(_ulCtGridsY);
@@ -140,6 +168,142 @@ void MeshGrid::InitGrid()
     }
 }
 
+void MeshGrid::CopyElements(unsigned long ulX,
+                            unsigned long ulY,
+                            unsigned long ulZ,
+                            std::vector<ElementIndex>& raulElements) const
+{
+    if (_bCompact) {
+        unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+        auto first = _aulCellElements.begin() + _aulCellOffsets[ulCell];
+        auto last = _aulCellElements.begin() + _aulCellOffsets[ulCell + 1];
+        raulElements.insert(raulElements.end(), first, last);
+    }
+    else {
+        const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+        raulElements.insert(raulElements.end(), rclSet.begin(), rclSet.end());
+    }
+}
+
+void MeshGrid::CopyElements(unsigned long ulX,
+                            unsigned long ulY,
+                            unsigned long ulZ,
+                            std::set<ElementIndex>& raulElements) const
+{
+    if (_bCompact) {
+        unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+        auto first = _aulCellElements.begin() + _aulCellOffsets[ulCell];
+        auto last = _aulCellElements.begin() + _aulCellOffsets[ulCell + 1];
+        raulElements.insert(first, last);
+    }
+    else {
+        const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+        raulElements.insert(rclSet.begin(), rclSet.end());
+    }
+}
+
+void MeshGrid::PackCompactStorage()
+{
+    // the grid elements are visited in the order of CellIndex()
+    std::size_t ulTotal = 0;
+    for (const auto& rclPlane : _aulGrid) {
+        for (const auto& rclLine : rclPlane) {
+            for (const auto& rclSet : rclLine) {
+                ulTotal += rclSet.size();
+            }
+        }
+    }
+
+    std::size_t ulCells = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+    _aulCellOffsets.clear();
+    _aulCellOffsets.reserve(ulCells + 1);
+    _aulCellElements.clear();
+    _aulCellElements.reserve(ulTotal);
+    for (unsigned long ulZ = 0; ulZ < _ulCtGridsZ; ulZ++) {
+        for (unsigned long ulY = 0; ulY < _ulCtGridsY; ulY++) {
+            for (unsigned long ulX = 0; ulX < _ulCtGridsX; ulX++) {
+                const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+                _aulCellOffsets.push_back(_aulCellElements.size());
+                _aulCellElements.insert(_aulCellElements.end(), rclSet.begin(), rclSet.end());
+            }
+        }
+    }
+    _aulCellOffsets.push_back(_aulCellElements.size());
+
+    // release the memory of the sets
+    decltype(_aulGrid)().swap(_aulGrid);
+}
+
+void MeshGrid::BuildCompactStorage(
+    unsigned long ulCount,
+    const std::function<void(ElementIndex, std::vector<unsigned long>&)>& cellsOf)
+{
+    std::size_t ulCells = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+
+    // Every thread handles a contiguous range of elements so that the indices in each grid
+    // element end up sorted in ascending order as with the std::set storage.
+    unsigned long ulThreads = std::max(1U, std::thread::hardware_concurrency());
+    ulThreads = std::max(1UL, std::min(ulThreads, ulCount / 10000));
+    unsigned long ulChunk = (ulCount + ulThreads - 1) / ulThreads;
+
+    struct Bucket
+    {
+        std::vector<unsigned long> cells;
+        std::vector<ElementIndex> elements;
+        std::vector<std::size_t> counts;
+    };
+    std::vector<Bucket> buckets(ulThreads);
+
+    auto parallel = [&](auto&& pass) {
+        std::vector<std::future<void>> futures;
+        for (unsigned long t = 1; t < ulThreads; t++) {
+            futures.push_back(std::async(std::launch::async, pass, t));
+        }
+        pass(0);
+        for (auto& future : futures) {
+            future.get();
+        }
+    };
+
+    // collect the grid elements of each element and count them per thread
+    parallel([&](unsigned long t) {
+        Bucket& bucket = buckets[t];
+        bucket.counts.resize(ulCells, 0);
+        unsigned long ulEnd = std::min(ulCount, (t + 1) * ulChunk);
+        for (unsigned long i = t * ulChunk; i < ulEnd; i++) {
+            std::size_t ulPos = bucket.cells.size();
+            cellsOf(i, bucket.cells);
+            bucket.elements.resize(bucket.cells.size(), i);
+            for (; ulPos < bucket.cells.size(); ulPos++) {
+                bucket.counts[bucket.cells[ulPos]]++;
+            }
+        }
+    });
+
+    // compute the offsets of the grids and the start position of each thread inside a grid
+    _aulCellOffsets.resize(ulCells + 1);
+    std::size_t ulTotal = 0;
+    for (std::size_t ulCell = 0; ulCell < ulCells; ulCell++) {
+        _aulCellOffsets[ulCell] = ulTotal;
+        for (auto& bucket : buckets) {
+            std::size_t ulNum = bucket.counts[ulCell];
+            bucket.counts[ulCell] = ulTotal;
+            ulTotal += ulNum;
+        }
+    }
+    _aulCellOffsets[ulCells] = ulTotal;
+
+    // scatter the element indices
+    _aulCellElements.resize(ulTotal);
+    parallel([&](unsigned long t) {
+        Bucket& bucket = buckets[t];
+        for (std::size_t k = 0; k < bucket.cells.size(); k++) {
+            _aulCellElements[bucket.counts[bucket.cells[k]]++] = bucket.elements[k];
+        }
+        bucket = Bucket();
+    });
+}
+
 unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
                                std::vector<ElementIndex>& raulElements,
                                bool bDelDoubles) const
@@ -160,9 +324,7 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                CopyElements(i, j, k, raulElements);
             }
         }
     }
@@ -202,9 +364,7 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    CopyElements(i, j, k, raulElements);
                 }
             }
         }
@@ -239,7 +399,7 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                CopyElements(i, j, k, raulElements);
             }
         }
     }
@@ -463,7 +623,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            CopyElements(nX, i, j, indices);
                         }
                     }
                     nX++;
@@ -475,7 +635,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            CopyElements(nX, i, j, indices);
                         }
                     }
                     nX++;
@@ -487,7 +647,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            CopyElements(i, nY, j, indices);
                         }
                     }
                     nY++;
@@ -499,7 +659,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            CopyElements(i, nY, j, indices);
                         }
                     }
                     nY--;
@@ -511,7 +671,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            CopyElements(i, j, nZ, indices);
                         }
                     }
                     nZ++;
@@ -523,7 +683,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            CopyElements(i, j, nZ, indices);
                         }
                     }
                     nZ--;
@@ -611,13 +771,8 @@ unsigned long MeshGrid::GetElements(unsigned long ulX,
                                     unsigned long ulZ,
                                     std::set<ElementIndex>& raclInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
-    }
-
-    return 0;
+    CopyElements(ulX, ulY, ulZ, raclInd);
+    return GetCtElements(ulX, ulY, ulZ);
 }
 
 unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
@@ -630,9 +785,8 @@ unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    aulFacets.clear();
+    CopyElements(ulX, ulY, ulZ, aulFacets);
     return aulFacets.size();
 }
 
@@ -748,6 +902,17 @@ void MeshFacetGrid::RebuildGrid()
 
     InitGrid();
 
+    if (_bCompact) {
+        auto cellsOf = [this](ElementIndex index, std::vector<unsigned long>& cells) {
+            VisitFacet(_pclMesh->GetFacet(index),
+                       [this, &cells](unsigned long ulX, unsigned long ulY, unsigned long ulZ) {
+                           cells.push_back(CellIndex(ulX, ulY, ulZ));
+                       });
+        };
+        BuildCompactStorage(_ulCtElements, cellsOf);
+        return;
+    }
+
     // Fill data structure
     MeshFacetIterator clFIter(*_pclMesh);
 
@@ -986,14 +1151,13 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
                                              float& rfMinDist,
                                              ElementIndex& rulFacetInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    ForEachElement(ulX, ulY, ulZ, [&](ElementIndex pI) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
             rulFacetInd = pI;
         }
-    }
+    });
 }
 
 //----------------------------------------------------------------------------
@@ -1033,6 +1197,9 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
 void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
 {
     (void)fEpsilon;
+    if (_bCompact) {
+        throw Base::RuntimeError("Cannot add a point to a grid with compact storage");
+    }
     unsigned long ulX {};
     unsigned long ulY {};
     unsigned long ulZ {};
@@ -1094,6 +1261,20 @@ void MeshPointGrid::RebuildGrid()
 
     InitGrid();
 
+    if (_bCompact) {
+        auto cellsOf = [this](ElementIndex index, std::vector<unsigned long>& cells) {
+            unsigned long ulX {};
+            unsigned long ulY {};
+            unsigned long ulZ {};
+            Pos(_pclMesh->GetPoint(index), ulX, ulY, ulZ);
+            if (CheckPos(ulX, ulY, ulZ)) {
+                cells.push_back(CellIndex(ulX, ulY, ulZ));
+            }
+        };
+        BuildCompactStorage(_ulCtElements, cellsOf);
+        return;
+    }
+
     // Fill data structure
 
     MeshPointIterator cPIter(*_pclMesh);
@@ -1166,9 +1347,7 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.CopyElements(_ulX, _ulY, _ulZ, raulElements);
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1183,9 +1362,7 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            _rclGrid.CopyElements(_ulX, _ulY, _ulZ, raulElements);
             _bValidRay = true;
         }
     }
@@ -1249,9 +1426,7 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.CopyElements(_ulX, _ulY, _ulZ, raulElements);
     }
     else {
         _bValidRay = false;  // Beam leaked
@@ -23,10 +23,13 @@
 #ifndef MESH_GRID_H
 #define MESH_GRID_H
 
+#include <functional>
 #include <limits>
 #include <set>
+#include <vector>
 
 #include <Base/BoundBox.h>
+#include <Base/Exception.h>
 
 #include "MeshKernel.h"
 
@@ -80,6 +83,18 @@ public:
     virtual void Rebuild(int iCtGridPerAxis = MESH_CT_GRID_PER_AXIS);
     /** Rebuilds the grid structure. */
     virtual void Rebuild(unsigned long ulX, unsigned long ulY, unsigned long ulZ);
+    /** Switches between the default storage with a std::set per grid element and a compact
+     * storage that keeps all element indices in one contiguous array plus an offset per grid
+     * element (CSR layout). The compact storage needs considerably less memory and is built with
+     * a counting pass that runs in parallel. Sub-classes must support it by overriding
+     * SupportsCompactStorage(). If supported, the elements of an attached mesh are moved into
+     * the new storage. In the compact storage no single elements can be added. */
+    void SetCompactStorage(bool on);
+    /** Returns true if the compact storage is used. */
+    bool IsCompactStorage() const
+    {
+        return _bCompact;
+    }
 
     /** @name Search */
     //@{
@@ -152,6 +167,11 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
+        if (_bCompact) {
+            unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+            return static_cast<unsigned long>(_aulCellOffsets[ulCell + 1]
+                                              - _aulCellOffsets[ulCell]);
+        }
         return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
@@ -193,11 +213,62 @@ protected:
     virtual void RebuildGrid() = 0;
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
+    /** Returns true if the sub-class can fill the compact storage in RebuildGrid(). */
+    virtual bool SupportsCompactStorage() const
+    {
+        return false;
+    }
+
+    /** @name Element access */
+    //@{
+    /** Returns the index of a grid element in the compact storage. */
+    unsigned long CellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        return (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+    }
+    /** Calls \a func with the index of each element in the given grid. */
+    template<typename Func>
+    void ForEachElement(unsigned long ulX, unsigned long ulY, unsigned long ulZ, Func&& func) const
+    {
+        if (_bCompact) {
+            unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+            for (std::size_t i = _aulCellOffsets[ulCell]; i < _aulCellOffsets[ulCell + 1]; i++) {
+                func(_aulCellElements[i]);
+            }
+        }
+        else {
+            for (ElementIndex index : _aulGrid[ulX][ulY][ulZ]) {
+                func(index);
+            }
+        }
+    }
+    /** Appends the indices of the elements in the given grid to \a raulElements. */
+    void CopyElements(unsigned long ulX,
+                      unsigned long ulY,
+                      unsigned long ulZ,
+                      std::vector<ElementIndex>& raulElements) const;
+    /** Inserts the indices of the elements in the given grid to \a raulElements. */
+    void CopyElements(unsigned long ulX,
+                      unsigned long ulY,
+                      unsigned long ulZ,
+                      std::set<ElementIndex>& raulElements) const;
+    /** Moves the elements of the std::set storage into the compact storage. */
+    void PackCompactStorage();
+    /** Fills the compact storage with \a ulCount elements using a parallel counting sort.
+     * \a cellsOf is called once for every element index and must append the index of each grid
+     * element (see CellIndex()) the element belongs to, to the given array. */
+    void BuildCompactStorage(
+        unsigned long ulCount,
+        const std::function<void(ElementIndex, std::vector<unsigned long>&)>& cellsOf);
+    //@}
 
 protected:
     // NOLINTBEGIN
     std::vector<std::vector<std::vector<std::set<ElementIndex>>>>
         _aulGrid;                /**< Grid data structure. */
+    std::vector<std::size_t> _aulCellOffsets; /**< Compact storage: start of each grid element. */
+    std::vector<ElementIndex> _aulCellElements; /**< Compact storage: element indices. */
+    bool _bCompact {false};                     /**< Use compact storage. */
     const MeshKernel* _pclMesh;  /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
@@ -287,14 +358,22 @@ protected:
                              unsigned long& rulZ) const;
     /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
      * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
-     * element that intersects the facet. */
+     * element that intersects the facet. Throws a Base::RuntimeError in the compact storage. */
     inline void
     AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    /** Calls \a func with the position of each grid element that intersects the facet. */
+    template<typename Func>
+    inline void VisitFacet(const MeshGeomFacet& rclFacet, Func&& func) const;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
         return _pclMesh->CountFacets();
     }
+    /** The facet grid supports the compact storage. */
+    bool SupportsCompactStorage() const override
+    {
+        return true;
+    }
     /** Rebuilds the grid structure. */
     void RebuildGrid() override;
 };
@@ -338,7 +417,8 @@ public:
 
 protected:
     /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the mesh kernel. */
+     * ulPtIndex the corresponding index in the mesh kernel. Throws a Base::RuntimeError in the
+     * compact storage. */
     void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3f& rclPoint,
@@ -350,6 +430,11 @@ protected:
     {
         return _pclMesh->CountPoints();
     }
+    /** The point grid supports the compact storage. */
+    bool SupportsCompactStorage() const override
+    {
+        return true;
+    }
     /** Rebuilds the grid structure. */
     void RebuildGrid() override;
 };
@@ -371,9 +456,7 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.CopyElements(_ulX, _ulY, _ulZ, raulElements);
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -561,14 +644,9 @@ inline void MeshFacetGrid::PosWithCheck(const Base::Vector3f& rclPoint,
     assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
-                                    ElementIndex ulFacetIndex,
-                                    float /*fEpsilon*/)
+template<typename Func>
+inline void MeshFacetGrid::VisitFacet(const MeshGeomFacet& rclFacet, Func&& func) const
 {
-    unsigned long ulX {};
-    unsigned long ulY {};
-    unsigned long ulZ {};
-
     unsigned long ulX1 {};
     unsigned long ulY1 {};
     unsigned long ulZ1 {};
@@ -582,38 +660,37 @@ inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
     clBB.Add(rclFacet._aclPoints[1]);
     clBB.Add(rclFacet._aclPoints[2]);
 
-    // float fDiagonalLength = clBB.CalcDiagonalLength();
-
-    // clBB.Enlarge(fEpsilon*fDiagonalLength);
-
     Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
     Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
 
-    /*
-    if (ulX1 > 0) ulX1--;
-    if (ulY1 > 0) ulY1--;
-    if (ulZ1 > 0) ulZ1--;
-
-    if (ulX2 < (_ulCtGridsX-1)) ulX2++;
-    if (ulY2 < (_ulCtGridsY-1)) ulY2++;
-    if (ulZ2 < (_ulCtGridsZ-1)) ulZ2++;
-    */
-
     // falls Facet ueber mehrere BB reicht
     if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
-        for (ulX = ulX1; ulX <= ulX2; ulX++) {
-            for (ulY = ulY1; ulY <= ulY2; ulY++) {
-                for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
+        for (unsigned long ulX = ulX1; ulX <= ulX2; ulX++) {
+            for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
+                for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                     if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        func(ulX, ulY, ulZ);
                     }
                 }
             }
         }
     }
     else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+        func(ulX1, ulY1, ulZ1);
+    }
+}
+
+inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
+                                    ElementIndex ulFacetIndex,
+                                    float /*fEpsilon*/)
+{
+    if (_bCompact) {
+        throw Base::RuntimeError("Cannot add a facet to a grid with compact storage");
     }
+    VisitFacet(rclFacet,
+               [this, ulFacetIndex](unsigned long ulX, unsigned long ulY, unsigned long ulZ) {
+                   _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+               });
 }
 
 }  // namespace MeshCore
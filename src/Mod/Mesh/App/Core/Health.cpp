@@ -0,0 +1,618 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <tuple>
+#endif
+
+#include "Degeneration.h"
+#include "Functional.h"
+#include "Health.h"
+#include "TopoAlgorithm.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+std::size_t blockCount(std::size_t count)
+{
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    return std::min(hardware, std::max<std::size_t>(1, count / 10000));
+}
+
+template<class T>
+void sortUnique(std::vector<T>& items)
+{
+    std::sort(items.begin(), items.end());
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+}
+
+// The facets around every point in compressed row form: the facets of point p are
+// facets[offsets[p]] up to facets[offsets[p + 1]], in ascending order.
+struct PointFacetAdjacency
+{
+    std::vector<std::size_t> offsets;
+    std::vector<FacetIndex> facets;
+};
+
+struct Corner
+{
+    std::uint64_t point;
+    FacetIndex facet;
+};
+
+PointFacetAdjacency buildAdjacency(const MeshFacetArray& facets,
+                                   std::size_t numPoints,
+                                   const std::vector<bool>& skip)
+{
+    std::vector<Corner> corners;
+    corners.reserve(3 * facets.size());
+    for (FacetIndex index = 0; index < facets.size(); index++) {
+        if (!skip[index]) {
+            for (PointIndex point : facets[index]._aulPoints) {
+                corners.push_back({point, index});
+            }
+        }
+    }
+
+    // a stable sort keeps the facets of a point in ascending order
+    int bits = 1;
+    while ((std::uint64_t(1) << bits) < numPoints) {
+        bits++;
+    }
+    std::size_t blocks = blockCount(corners.size());
+    if (corners.size() < (std::size_t(1) << 16)) {
+        std::stable_sort(corners.begin(), corners.end(), [](const Corner& x, const Corner& y) {
+            return x.point < y.point;
+        });
+    }
+    else {
+        parallel_radix_sort(
+            corners,
+            [](const Corner& corner) {
+                return corner.point;
+            },
+            bits,
+            int(blocks));
+    }
+
+    PointFacetAdjacency adjacency;
+    adjacency.offsets.resize(numPoints + 1, corners.size());
+    adjacency.facets.resize(corners.size());
+    parallel_blocks(corners.size(), blocks, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            adjacency.facets[i] = corners[i].facet;
+            // a point starts here, also for the points before without any facet
+            std::uint64_t first = i > 0 ? corners[i - 1].point + 1 : 0;
+            if (i == 0 || corners[i - 1].point != corners[i].point) {
+                for (std::uint64_t point = first; point <= corners[i].point; point++) {
+                    adjacency.offsets[point] = i;
+                }
+            }
+        }
+    });
+    return adjacency;
+}
+}  // namespace
+
+bool MeshHealthReport::IsValid() const
+{
+    return pointsOutOfRange.empty() && neighboursOutOfRange.empty() && corruptedFacets.empty()
+        && invalidNeighbourhood.empty() && invalidPoints.empty() && duplicatedPoints.empty()
+        && duplicatedFacets.empty() && degeneratedFacets.empty() && nonManifoldEdges.empty()
+        && nonManifoldPoints.empty() && wrongOrientation.empty() && selfIntersections.empty();
+}
+
+// ----------------------------------------------------------------------
+
+bool MeshEvalHealth::Evaluate()
+{
+    report = MeshHealthReport();
+    EvaluateFacets();
+    EvaluatePoints();
+    EvaluateDuplicates();
+    EvaluateTopology();
+
+    // the spatial search needs valid point indices
+    if (checkSelfIntersections && report.pointsOutOfRange.empty()) {
+        MeshEvalSelfIntersection eval(_rclMesh);
+        eval.GetIntersections(report.selfIntersections);
+    }
+
+    return report.IsValid();
+}
+
+void MeshEvalHealth::EvaluateFacets()
+{
+    const MeshFacetArray& facets = _rclMesh.GetFacets();
+    std::size_t numFacets = facets.size();
+    std::size_t numPoints = _rclMesh.CountPoints();
+    std::size_t blocks = blockCount(numFacets);
+
+    struct Defects
+    {
+        std::vector<FacetIndex> pointsOutOfRange;
+        std::vector<FacetIndex> neighboursOutOfRange;
+        std::vector<FacetIndex> corruptedFacets;
+        std::vector<FacetIndex> degeneratedFacets;
+    };
+    std::vector<Defects> parts(blocks);
+    parallel_blocks(numFacets, blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        Defects& part = parts[b];
+        for (FacetIndex index = begin; index < end; index++) {
+            const MeshFacet& face = facets[index];
+            bool inRange = std::all_of(std::begin(face._aulPoints),
+                                       std::end(face._aulPoints),
+                                       [numPoints](PointIndex point) {
+                                           return point < numPoints;
+                                       });
+            if (!inRange) {
+                part.pointsOutOfRange.push_back(index);
+            }
+            if (std::any_of(std::begin(face._aulNeighbours),
+                            std::end(face._aulNeighbours),
+                            [numFacets](FacetIndex neighbour) {
+                                return neighbour >= numFacets && neighbour < FACET_INDEX_MAX;
+                            })) {
+                part.neighboursOutOfRange.push_back(index);
+            }
+            if (face.IsDegenerated()) {
+                part.corruptedFacets.push_back(index);
+            }
+            else if (inRange && _rclMesh.GetFacet(face).IsDegenerated(fEpsilon)) {
+                part.degeneratedFacets.push_back(index);
+            }
+        }
+    });
+
+    for (const auto& part : parts) {
+        report.pointsOutOfRange.insert(report.pointsOutOfRange.end(),
+                                       part.pointsOutOfRange.begin(),
+                                       part.pointsOutOfRange.end());
+        report.neighboursOutOfRange.insert(report.neighboursOutOfRange.end(),
+                                           part.neighboursOutOfRange.begin(),
+                                           part.neighboursOutOfRange.end());
+        report.corruptedFacets.insert(report.corruptedFacets.end(),
+                                      part.corruptedFacets.begin(),
+                                      part.corruptedFacets.end());
+        report.degeneratedFacets.insert(report.degeneratedFacets.end(),
+                                        part.degeneratedFacets.begin(),
+                                        part.degeneratedFacets.end());
+    }
+}
+
+void MeshEvalHealth::EvaluatePoints()
+{
+    const MeshPointArray& points = _rclMesh.GetPoints();
+    std::size_t blocks = blockCount(points.size());
+
+    std::vector<std::vector<PointIndex>> parts(blocks);
+    parallel_blocks(points.size(), blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        for (PointIndex index = begin; index < end; index++) {
+            const MeshPoint& point = points[index];
+            if (std::isnan(point.x) || std::isnan(point.y) || std::isnan(point.z)) {
+                parts[b].push_back(index);
+            }
+        }
+    });
+
+    for (const auto& part : parts) {
+        report.invalidPoints.insert(report.invalidPoints.end(), part.begin(), part.end());
+    }
+}
+
+void MeshEvalHealth::EvaluateDuplicates()
+{
+    int threads = int(std::thread::hardware_concurrency());
+
+    // Points with equal coordinates end up next to each other, the one with the lowest index
+    // first. NaN coordinates would break the ordering, such points are left out.
+    const MeshPointArray& points = _rclMesh.GetPoints();
+    std::vector<PointIndex> order;
+    order.reserve(points.size() - report.invalidPoints.size());
+    auto nan = report.invalidPoints.begin();
+    for (PointIndex index = 0; index < points.size(); index++) {
+        if (nan != report.invalidPoints.end() && *nan == index) {
+            ++nan;
+        }
+        else {
+            order.push_back(index);
+        }
+    }
+    parallel_sort(
+        order.begin(),
+        order.end(),
+        [&points](PointIndex x, PointIndex y) {
+            if (points[x] < points[y]) {
+                return true;
+            }
+            if (points[y] < points[x]) {
+                return false;
+            }
+            return x < y;
+        },
+        threads);
+    for (std::size_t i = 1, first = 0; i < order.size(); i++) {
+        if (points[order[first]] < points[order[i]]) {
+            first = i;
+        }
+        else {
+            report.duplicatedPoints.emplace_back(order[i], order[first]);
+        }
+    }
+
+    // Facets are equal if they reference the same points, regardless of the orientation.
+    // Of a group of equal facets all but the one with the lowest index are duplicates.
+    const MeshFacetArray& facets = _rclMesh.GetFacets();
+    std::vector<std::array<PointIndex, 3>> keys(facets.size());
+    parallel_blocks(facets.size(),
+                    blockCount(facets.size()),
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; i++) {
+                            const PointIndex* pts = facets[i]._aulPoints;
+                            keys[i] = {pts[0], pts[1], pts[2]};
+                            std::sort(keys[i].begin(), keys[i].end());
+                        }
+                    });
+    std::vector<FacetIndex> faces(facets.size());
+    std::iota(faces.begin(), faces.end(), FacetIndex(0));
+    parallel_sort(
+        faces.begin(),
+        faces.end(),
+        [&keys](FacetIndex x, FacetIndex y) {
+            return std::tie(keys[x], x) < std::tie(keys[y], y);
+        },
+        threads);
+    for (std::size_t i = 1; i < faces.size(); i++) {
+        if (keys[faces[i - 1]] == keys[faces[i]]) {
+            report.duplicatedFacets.push_back(faces[i]);
+        }
+    }
+    std::sort(report.duplicatedFacets.begin(), report.duplicatedFacets.end());
+}
+
+void MeshEvalHealth::EvaluateTopology()
+{
+    // Facets with invalid or repeated point indices have no sensible edges, they are already
+    // reported and left out of the adjacency.
+    const MeshFacetArray& facets = _rclMesh.GetFacets();
+    std::size_t numPoints = _rclMesh.CountPoints();
+    std::vector<bool> skip(facets.size(), false);
+    for (FacetIndex index : report.pointsOutOfRange) {
+        skip[index] = true;
+    }
+    for (FacetIndex index : report.corruptedFacets) {
+        skip[index] = true;
+    }
+    PointFacetAdjacency adjacency = buildAdjacency(facets, numPoints, skip);
+
+    // an edge from the point to a point with a higher index
+    struct PointEdge
+    {
+        PointIndex other;
+        FacetIndex facet;
+        unsigned short side;
+        bool outgoing;
+    };
+
+    struct Defects
+    {
+        std::vector<FacetIndex> invalidNeighbourhood;
+        std::vector<FacetIndex> wrongOrientation;
+        std::list<std::vector<FacetIndex>> nonManifoldEdges;
+        std::vector<PointIndex> nonManifoldPoints;
+        std::vector<FacetIndex> facetsOfNonManifoldPoints;
+        std::size_t openEdges {0};
+    };
+
+    // Every edge is handled by its point with the lower index, so each block only reads the
+    // shared adjacency and writes to its own part of the result.
+    std::size_t blocks = blockCount(numPoints);
+    std::vector<Defects> parts(blocks);
+    parallel_blocks(numPoints, blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        Defects& part = parts[b];
+        std::vector<PointEdge> edges;
+        std::vector<PointIndex> others;
+        for (PointIndex point = begin; point < end; point++) {
+            auto first = adjacency.facets.begin() + adjacency.offsets[point];
+            auto last = adjacency.facets.begin() + adjacency.offsets[point + 1];
+            edges.clear();
+            others.clear();
+            for (auto it = first; it != last; ++it) {
+                const MeshFacet& face = facets[*it];
+                unsigned short corner = face._aulPoints[0] == point ? 0
+                    : face._aulPoints[1] == point                   ? 1
+                                                                    : 2;
+                PointIndex next = face._aulPoints[(corner + 1) % 3];
+                PointIndex prev = face._aulPoints[(corner + 2) % 3];
+                others.push_back(next);
+                others.push_back(prev);
+                if (next > point) {
+                    edges.push_back({next, *it, corner, true});
+                }
+                if (prev > point) {
+                    auto side = static_cast<unsigned short>((corner + 2) % 3);
+                    edges.push_back({prev, *it, side, false});
+                }
+            }
+
+            // for an inner point the number of adjacent points is equal to the number of
+            // facets, for a boundary point it's higher by one, see MeshEvalPointManifolds
+            sortUnique(others);
+            std::size_t numFacets = last - first;
+            if (others.size() > numFacets + 1) {
+                part.nonManifoldPoints.push_back(point);
+                part.facetsOfNonManifoldPoints.insert(part.facetsOfNonManifoldPoints.end(),
+                                                      first,
+                                                      last);
+            }
+
+            std::sort(edges.begin(), edges.end(), [](const PointEdge& x, const PointEdge& y) {
+                return std::tie(x.other, x.facet) < std::tie(y.other, y.facet);
+            });
+            for (std::size_t i = 0; i < edges.size();) {
+                std::size_t j = i + 1;
+                while (j < edges.size() && edges[j].other == edges[i].other) {
+                    j++;
+                }
+
+                const PointEdge& e0 = edges[i];
+                if (j - i == 1) {
+                    part.openEdges++;
+                    if (facets[e0.facet]._aulNeighbours[e0.side] != FACET_INDEX_MAX) {
+                        part.invalidNeighbourhood.push_back(e0.facet);
+                    }
+                }
+                else if (j - i == 2) {
+                    const PointEdge& e1 = edges[i + 1];
+                    if (facets[e0.facet]._aulNeighbours[e0.side] != e1.facet
+                        || facets[e1.facet]._aulNeighbours[e1.side] != e0.facet) {
+                        part.invalidNeighbourhood.push_back(e0.facet);
+                        part.invalidNeighbourhood.push_back(e1.facet);
+                    }
+                    // consistently oriented neighbours run through their edge in opposite
+                    // directions
+                    if (e0.outgoing == e1.outgoing) {
+                        part.wrongOrientation.push_back(e0.facet);
+                        part.wrongOrientation.push_back(e1.facet);
+                    }
+                }
+                else {
+                    std::vector<FacetIndex> shared;
+                    for (std::size_t k = i; k < j; k++) {
+                        shared.push_back(edges[k].facet);
+                    }
+                    part.nonManifoldEdges.push_back(shared);
+                }
+                i = j;
+            }
+        }
+    });
+
+    for (auto& part : parts) {
+        report.invalidNeighbourhood.insert(report.invalidNeighbourhood.end(),
+                                           part.invalidNeighbourhood.begin(),
+                                           part.invalidNeighbourhood.end());
+        report.wrongOrientation.insert(report.wrongOrientation.end(),
+                                       part.wrongOrientation.begin(),
+                                       part.wrongOrientation.end());
+        report.nonManifoldEdges.splice(report.nonManifoldEdges.end(), part.nonManifoldEdges);
+        report.nonManifoldPoints.insert(report.nonManifoldPoints.end(),
+                                        part.nonManifoldPoints.begin(),
+                                        part.nonManifoldPoints.end());
+        report.facetsOfNonManifoldPoints.insert(report.facetsOfNonManifoldPoints.end(),
+                                                part.facetsOfNonManifoldPoints.begin(),
+                                                part.facetsOfNonManifoldPoints.end());
+        report.openEdges += part.openEdges;
+    }
+    sortUnique(report.invalidNeighbourhood);
+    sortUnique(report.wrongOrientation);
+    sortUnique(report.facetsOfNonManifoldPoints);
+}
+
+// ----------------------------------------------------------------------
+
+bool MeshFixHealth::Fixup()
+{
+    countPoints = _rclMesh.CountPoints();
+    countFacets = _rclMesh.CountFacets();
+    modified = false;
+
+    FixIndices();
+    FixPoints();
+    FixFacets();
+    FixTopology();
+    FixOrientation();
+
+    return true;
+}
+
+bool MeshFixHealth::Changed()
+{
+    // every fix that renumbers points or facets also changes their number
+    if (_rclMesh.CountPoints() != countPoints || _rclMesh.CountFacets() != countFacets) {
+        countPoints = _rclMesh.CountPoints();
+        countFacets = _rclMesh.CountFacets();
+        modified = true;
+    }
+    return modified;
+}
+
+void MeshFixHealth::FixIndices()
+{
+    // rebuilding the neighbourhood keeps all indices, removing facets relies on it
+    if (!report.neighboursOutOfRange.empty() || !report.invalidNeighbourhood.empty()) {
+        _rclMesh.RebuildNeighbours();
+    }
+
+    if (!report.pointsOutOfRange.empty()) {
+        MeshFixRangePoint fix(_rclMesh);
+        fix.Fixup();
+        Changed();
+    }
+
+    if (!report.corruptedFacets.empty()) {
+        // a facet referencing a point twice gets bogus links when rebuilding the neighbourhood
+        MeshFixCorruptedFacets fix(_rclMesh);
+        fix.Fixup();
+        _rclMesh.RebuildNeighbours();
+        Changed();
+    }
+}
+
+void MeshFixHealth::FixPoints()
+{
+    if (!report.invalidPoints.empty()) {
+        if (Changed()) {
+            MeshFixNaNPoints fix(_rclMesh);
+            fix.Fixup();
+        }
+        else {
+            _rclMesh.DeletePoints(report.invalidPoints);
+        }
+        Changed();
+    }
+
+    if (!report.duplicatedPoints.empty()) {
+        if (Changed()) {
+            MeshFixDuplicatePoints fix(_rclMesh);
+            fix.Fixup();
+        }
+        else {
+            std::vector<PointIndex> target(_rclMesh.CountPoints());
+            std::iota(target.begin(), target.end(), PointIndex(0));
+            std::vector<PointIndex> duplicates;
+            duplicates.reserve(report.duplicatedPoints.size());
+            for (const auto& it : report.duplicatedPoints) {
+                target[it.first] = it.second;
+                duplicates.push_back(it.first);
+            }
+
+            const MeshFacetArray& facets = _rclMesh.GetFacets();
+            for (FacetIndex index = 0; index < facets.size(); index++) {
+                const PointIndex* pts = facets[index]._aulPoints;
+                if (target[pts[0]] != pts[0] || target[pts[1]] != pts[1]
+                    || target[pts[2]] != pts[2]) {
+                    _rclMesh.SetFacetPoints(index, target[pts[0]], target[pts[1]], target[pts[2]]);
+                }
+            }
+
+            _rclMesh.DeletePoints(duplicates);
+            _rclMesh.RebuildNeighbours();
+        }
+        Changed();
+
+        // merged points can collapse facets and make them coincide
+        MeshFixCorruptedFacets fix(_rclMesh);
+        fix.Fixup();
+        Changed();
+    }
+}
+
+void MeshFixHealth::FixFacets()
+{
+    bool merged = !report.duplicatedPoints.empty();
+    if (!report.duplicatedFacets.empty() || merged) {
+        if (Changed()) {
+            MeshFixDuplicateFacets fix(_rclMesh);
+            fix.Fixup();
+        }
+        else {
+            _rclMesh.DeleteFacets(report.duplicatedFacets);
+        }
+        Changed();
+    }
+
+    if (!report.degeneratedFacets.empty()) {
+        MeshFixDegeneratedFacets fix(_rclMesh, fEpsilon);
+        fix.Fixup();
+        Changed();
+    }
+
+    if (!report.selfIntersections.empty()) {
+        if (Changed()) {
+            MeshEvalSelfIntersection eval(_rclMesh);
+            std::vector<std::pair<FacetIndex, FacetIndex>> intersections;
+            eval.GetIntersections(intersections);
+            MeshFixSelfIntersection fix(_rclMesh, intersections);
+            fix.Fixup();
+        }
+        else {
+            MeshFixSelfIntersection fix(_rclMesh, report.selfIntersections);
+            fix.Fixup();
+        }
+        Changed();
+    }
+}
+
+void MeshFixHealth::FixTopology()
+{
+    bool merged = !report.duplicatedPoints.empty();
+    if (!report.nonManifoldEdges.empty() || merged) {
+        if (Changed()) {
+            MeshEvalTopology eval(_rclMesh);
+            if (!eval.Evaluate()) {
+                MeshFixTopology fix(_rclMesh, eval.GetFacets());
+                fix.Fixup();
+            }
+        }
+        else {
+            MeshFixTopology fix(_rclMesh, report.nonManifoldEdges);
+            fix.Fixup();
+        }
+        Changed();
+    }
+
+    if (!report.nonManifoldPoints.empty() || merged) {
+        if (Changed()) {
+            MeshEvalPointManifolds eval(_rclMesh);
+            if (!eval.Evaluate()) {
+                std::vector<FacetIndex> faces;
+                eval.GetFacetIndices(faces);
+                _rclMesh.DeleteFacets(faces);
+            }
+        }
+        else {
+            _rclMesh.DeleteFacets(report.facetsOfNonManifoldPoints);
+        }
+        Changed();
+    }
+}
+
+void MeshFixHealth::FixOrientation()
+{
+    // harmonizing evaluates the orientation on its own and keeps all indices
+    if (!report.wrongOrientation.empty() || !report.duplicatedPoints.empty()) {
+        MeshTopoAlgorithm alg(_rclMesh);
+        alg.HarmonizeNormals();
+    }
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_HEALTH_H
+#define MESH_HEALTH_H
+
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "Evaluation.h"
+
+
+namespace MeshCore
+{
+
+/**
+ * The MeshHealthReport holds the defects found by MeshEvalHealth, one list per category.
+ * All indices refer to the mesh as it was when the report was created.
+ */
+struct MeshExport MeshHealthReport
+{
+    /// facets referencing points that don't exist, see MeshEvalRangePoint
+    std::vector<FacetIndex> pointsOutOfRange;
+    /// facets referencing neighbours that don't exist, see MeshEvalRangeFacet
+    std::vector<FacetIndex> neighboursOutOfRange;
+    /// facets referencing a point more than once, see MeshEvalCorruptedFacets
+    std::vector<FacetIndex> corruptedFacets;
+    /// facets whose neighbour indices don't match the shared edges, see MeshEvalNeighbourhood
+    std::vector<FacetIndex> invalidNeighbourhood;
+    /// points with NaN coordinates, see MeshEvalNaNPoints
+    std::vector<PointIndex> invalidPoints;
+    /// pairs of a duplicated point and the point it equals, see MeshEvalDuplicatePoints
+    std::vector<std::pair<PointIndex, PointIndex>> duplicatedPoints;
+    /// facets referencing the same points as a facet with lower index, see MeshEvalDuplicateFacets
+    std::vector<FacetIndex> duplicatedFacets;
+    /// facets with (almost) collinear corners, see MeshEvalDegeneratedFacets
+    std::vector<FacetIndex> degeneratedFacets;
+    /// the facets of every edge shared by more than two facets, see MeshEvalTopology
+    std::list<std::vector<FacetIndex>> nonManifoldEdges;
+    /// points where facet fans only touch each other, see MeshEvalPointManifolds
+    std::vector<PointIndex> nonManifoldPoints;
+    /// the facets around the non-manifold points, sorted and unique
+    std::vector<FacetIndex> facetsOfNonManifoldPoints;
+    /// facets sharing an edge with a facet of opposite orientation, see MeshEvalOrientation
+    std::vector<FacetIndex> wrongOrientation;
+    /// pairs of intersecting facets, only filled if requested, see MeshEvalSelfIntersection
+    std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
+    /// the number of edges with only one facet, a hint rather than a defect
+    std::size_t openEdges {0};
+
+    /// Returns true if no defect category has an entry.
+    bool IsValid() const;
+};
+
+/**
+ * The MeshEvalHealth class checks a mesh for all defect categories of the single evaluation
+ * classes at once. The point to facet adjacency is built once in compressed row form and shared
+ * by the topology checks, points, facets and edges are then checked in parallel.
+ * Self-intersections need a spatial search and are only checked on request.
+ */
+class MeshExport MeshEvalHealth: public MeshEvaluation
+{
+public:
+    explicit MeshEvalHealth(const MeshKernel& rclM,
+                            float fEps = MeshDefinitions::_fMinPointDistanceP2)
+        : MeshEvaluation(rclM)
+        , fEpsilon(fEps)
+    {}
+    /// Also collect self-intersections, off by default.
+    void SetCheckSelfIntersections(bool on)
+    {
+        checkSelfIntersections = on;
+    }
+    /// Returns true if the mesh has no defects.
+    bool Evaluate() override;
+    const MeshHealthReport& GetReport() const
+    {
+        return report;
+    }
+
+private:
+    void EvaluateFacets();
+    void EvaluatePoints();
+    void EvaluateDuplicates();
+    void EvaluateTopology();
+
+private:
+    float fEpsilon;
+    bool checkSelfIntersections {false};
+    MeshHealthReport report;
+};
+
+/**
+ * The MeshFixHealth class repairs the defects of a MeshHealthReport in an order where every fix
+ * finds the structure the next one depends on: valid indices first, then merged points, removed
+ * facets and self-intersections, non-manifolds and at last the orientation. The lists of the report are used as long as
+ * the mesh hasn't changed. Once a fix has changed the indices, only the categories that follow
+ * are evaluated again, categories without defects in the report aren't touched at all unless an
+ * earlier fix can have introduced them.
+ */
+class MeshExport MeshFixHealth: public MeshValidation
+{
+public:
+    MeshFixHealth(MeshKernel& rclM,
+                  const MeshHealthReport& rep,
+                  float fEps = MeshDefinitions::_fMinPointDistanceP2)
+        : MeshValidation(rclM)
+        , report(rep)
+        , fEpsilon(fEps)
+    {}
+    bool Fixup() override;
+
+private:
+    void FixIndices();
+    void FixPoints();
+    void FixFacets();
+    void FixTopology();
+    void FixOrientation();
+    bool Changed();
+
+private:
+    const MeshHealthReport& report;
+    float fEpsilon;
+    bool modified {false};
+    std::size_t countPoints {0};
+    std::size_t countFacets {0};
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_HEALTH_H
@@ -22,14 +22,23 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <istream>
+#include <string_view>
+#include <thread>
 #include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
 #include <boost/tokenizer.hpp>
-#include <istream>
 #endif
 
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
+#include <Base/Console.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 
 #include "ReaderOBJ.h"
@@ -37,6 +46,304 @@
 
 using namespace MeshCore;
 
+namespace
+{
+
+// The line parser accepts exactly the lines that were matched by the regular
+// expressions of former versions, e.g. numbers like '1.' or faces with more
+// than four points are still skipped.
+
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+std::size_t skipDigits(std::string_view str, std::size_t pos)
+{
+    while (pos < str.size() && isDigit(str[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+std::size_t skipSign(std::string_view str, std::size_t pos)
+{
+    if (pos < str.size() && (str[pos] == '-' || str[pos] == '+')) {
+        pos++;
+    }
+    return pos;
+}
+
+// [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?
+bool isFloat(std::string_view str)
+{
+    std::size_t pos = skipSign(str, 0);
+    std::size_t digits = skipDigits(str, pos);
+    if (digits < str.size() && str[digits] == '.') {
+        pos = skipDigits(str, digits + 1);
+        if (pos == digits + 1) {
+            return false;
+        }
+    }
+    else if (digits == pos) {
+        return false;
+    }
+    else {
+        pos = digits;
+    }
+    if (pos < str.size() && (str[pos] == 'e' || str[pos] == 'E')) {
+        std::size_t exp = skipSign(str, pos + 1);
+        pos = skipDigits(str, exp);
+        if (pos == exp) {
+            return false;
+        }
+    }
+    return pos == str.size();
+}
+
+// The tokens are followed by white space or the terminating null of the buffer
+// so that they can be passed to the C functions
+float toFloat(std::string_view str)
+{
+    if (str.front() == '+') {
+        str.remove_prefix(1);
+    }
+#if defined(__cpp_lib_to_chars)
+    double value {};
+    if (std::from_chars(str.data(), str.data() + str.size(), value).ec == std::errc()) {
+        return static_cast<float>(value);
+    }
+#endif
+    return static_cast<float>(std::atof(str.data()));
+}
+
+int toInt(std::string_view str)
+{
+    const char* first = str.data() + (str.front() == '+' ? 1 : 0);
+    int value {};
+    if (std::from_chars(first, str.data() + str.size(), value).ec == std::errc()) {
+        return value;
+    }
+    return std::atoi(str.data());
+}
+
+// ([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*, returns the first number
+bool toPointIndex(std::string_view str, int& index)
+{
+    std::size_t sign = skipSign(str, 0);
+    std::size_t pos = skipDigits(str, sign);
+    if (pos == sign) {
+        return false;
+    }
+    std::size_t last = pos;
+    for (int i = 0; i < 2; i++) {
+        if (pos < str.size() && str[pos] == '/') {
+            pos++;
+        }
+        pos = skipDigits(str, skipSign(str, pos));
+    }
+    if (pos != str.size()) {
+        return false;
+    }
+    index = toInt(str.substr(0, last));
+    return true;
+}
+
+// \d{1,3}
+bool isColorValue(std::string_view str)
+{
+    return !str.empty() && str.size() <= 3 && skipDigits(str, 0) == str.size();
+}
+
+// [\x21-\x7E]+
+bool isName(std::string_view str)
+{
+    return std::all_of(str.begin(), str.end(), [](char c) {
+        return c >= 0x21 && c <= 0x7E;
+    });
+}
+
+struct Statement
+{
+    enum Type
+    {
+        Group,
+        Material,
+        Library
+    };
+    Type type;
+    // number of facets of the chunk before the statement
+    std::size_t facets;
+    // not converted yet because this needs the Python interpreter
+    std::string name;
+};
+
+// The data of a chunk of lines, the point indices of its facets are local
+struct Chunk
+{
+    MeshPointArray points;
+    MeshFacetArray facets;
+    // corners (3 * facet + corner) that refer to points relative to the end of the chunk
+    std::vector<std::size_t> relative;
+    std::vector<Statement> statements;
+    bool hasColors = false;
+
+    void addPoint(const std::array<std::string_view, 8>& tokens, std::size_t count)
+    {
+        if (count != 4 && count != 7) {
+            return;
+        }
+        for (std::size_t i = 1; i < count; i++) {
+            if (!isFloat(tokens[i])) {
+                return;
+            }
+        }
+
+        MeshPoint point(Base::Vector3f(toFloat(tokens[1]), toFloat(tokens[2]), toFloat(tokens[3])));
+        if (count == 7) {
+            float r {}, g {}, b {};
+            if (isColorValue(tokens[4]) && isColorValue(tokens[5]) && isColorValue(tokens[6])) {
+                r = float(std::min<int>(toInt(tokens[4]), 255)) / 255.0F;
+                g = float(std::min<int>(toInt(tokens[5]), 255)) / 255.0F;
+                b = float(std::min<int>(toInt(tokens[6]), 255)) / 255.0F;
+            }
+            else {
+                r = toFloat(tokens[4]);
+                g = toFloat(tokens[5]);
+                b = toFloat(tokens[6]);
+            }
+            Base::Color c(r, g, b);
+            point.SetProperty(static_cast<uint32_t>(c.getPackedValue()));
+            hasColors = true;
+        }
+        points.push_back(point);
+    }
+
+    void addFacets(const std::array<std::string_view, 8>& tokens, std::size_t count)
+    {
+        if (count != 4 && count != 5) {
+            return;
+        }
+        std::array<int, 4> index {};
+        for (std::size_t i = 1; i < count; i++) {
+            if (!toPointIndex(tokens[i], index[i - 1])) {
+                return;
+            }
+        }
+
+        // the same integer arithmetics as in the former versions
+        std::array<PointIndex, 4> pnt {};
+        std::array<bool, 4> rel {};
+        for (std::size_t i = 0; i + 1 < count; i++) {
+            rel[i] = index[i] <= 0;
+            pnt[i] = rel[i] ? index[i] + static_cast<int>(points.size()) : index[i] - 1;
+        }
+
+        addFacet({pnt[0], pnt[1], pnt[2]}, {rel[0], rel[1], rel[2]});
+        if (count == 5) {
+            addFacet({pnt[2], pnt[3], pnt[0]}, {rel[2], rel[3], rel[0]});
+        }
+    }
+
+    void addFacet(const std::array<PointIndex, 3>& pnt, const std::array<bool, 3>& rel)
+    {
+        for (std::size_t i = 0; i < 3; i++) {
+            if (rel[i]) {
+                relative.push_back(3 * facets.size() + i);
+            }
+        }
+        facets.emplace_back(pnt[0], pnt[1], pnt[2]);
+    }
+
+    void parse(const char* begin, const char* end)
+    {
+        std::array<std::string_view, 8> tokens;
+        while (begin < end) {
+            const char* eol = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+            if (!eol) {
+                eol = end;
+            }
+            // the former versions matched the line as C string
+            const char* nul = static_cast<const char*>(std::memchr(begin, '\0', eol - begin));
+            parseLine(begin, nul ? nul : eol, tokens);
+            begin = eol + 1;
+        }
+    }
+
+    void parseLine(const char* begin, const char* end, std::array<std::string_view, 8>& tokens)
+    {
+        const char* pos = begin;
+        while (pos < end && !isSpace(*pos)) {
+            pos++;
+        }
+        std::string_view keyword(begin, pos - begin);
+        if (keyword == "mtllib") {
+            addLibrary(pos, end);
+            return;
+        }
+        if (keyword != "v" && keyword != "f" && keyword != "g" && keyword != "usemtl") {
+            return;
+        }
+
+        std::size_t count = 1;
+        while (pos < end && isSpace(*pos)) {
+            pos++;
+        }
+        while (pos < end) {
+            if (count == tokens.size()) {
+                return;  // too many tokens
+            }
+            const char* token = pos;
+            while (pos < end && !isSpace(*pos)) {
+                pos++;
+            }
+            tokens[count++] = std::string_view(token, pos - token);
+            while (pos < end && isSpace(*pos)) {
+                pos++;
+            }
+        }
+
+        if (keyword == "v") {
+            addPoint(tokens, count);
+        }
+        else if (keyword == "f") {
+            addFacets(tokens, count);
+        }
+        else if (count == 2 && isName(tokens[1])) {
+            // the name includes trailing white space as before
+            statements.push_back({keyword == "g" ? Statement::Group : Statement::Material,
+                                  facets.size(),
+                                  std::string(tokens[1].data(), end)});
+        }
+    }
+
+    // \s+(.+)\s*$ after mtllib, the name may contain white space
+    void addLibrary(const char* pos, const char* end)
+    {
+        const char* name = pos;
+        while (name < end && isSpace(*name)) {
+            name++;
+        }
+        if (name == pos) {
+            return;
+        }
+        if (name == end) {
+            if (name - pos < 2) {
+                return;
+            }
+            name--;
+        }
+        statements.push_back({Statement::Library, facets.size(), std::string(name, end)});
+    }
+};
+
+}  // namespace
+
 ReaderOBJ::ReaderOBJ(MeshKernel& kernel, Material* material)
     : _kernel(kernel)
     , _material(material)
@@ -44,40 +351,6 @@ ReaderOBJ::ReaderOBJ(MeshKernel& kernel, Material* material)
 
 bool ReaderOBJ::Load(std::istream& str)
 {
-    boost::regex rx_m("^mtllib\\s+(.+)\\s*$");
-    boost::regex rx_u(R"(^usemtl\s+([\x21-\x7E]+)\s*$)");
-    boost::regex rx_g(R"(^g\s+([\x21-\x7E]+)\s*$)");
-    boost::regex rx_p("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::regex rx_c("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+(\\d{1,3})\\s+(\\d{1,3})\\s+(\\d{1,3})\\s*$");
-    boost::regex rx_t("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                      "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    boost::regex rx_f3("^f\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*\\s*$");
-    boost::regex rx_f4("^f\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*"
-                       "\\s+([-+]?[0-9]+)/?[-+]?[0-9]*/?[-+]?[0-9]*\\s*$");
-    boost::cmatch what;
-
-    unsigned long segment = 0;
-    MeshPointArray meshPoints;
-    MeshFacetArray meshFacets;
-
-    std::string line;
-    float fX {}, fY {}, fZ {};
-    int i1 = 1, i2 = 1, i3 = 1, i4 = 1;
-    MeshFacet item;
-
     if (!str || str.bad()) {
         return false;
     }
@@ -87,117 +360,147 @@ bool ReaderOBJ::Load(std::istream& str)
         return false;
     }
 
+    Base::TimeElapsed start;
+
+    unsigned long segment = 0;
+    MeshPointArray meshPoints;
+    MeshFacetArray meshFacets;
+
     MeshIO::Binding rgb_value = MeshIO::OVERALL;
     bool new_segment = true;
     std::string groupName;
     std::string materialName;
     unsigned long countMaterialFacets = 0;
 
-    while (std::getline(str, line)) {
-        if (boost::regex_match(line.c_str(), what, rx_p)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_c)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            float r = std::min<int>(std::atof(what[10].first), 255) / 255.0F;
-            float g = std::min<int>(std::atof(what[11].first), 255) / 255.0F;
-            float b = std::min<int>(std::atof(what[12].first), 255) / 255.0F;
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-
-            Base::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
-            rgb_value = MeshIO::PER_VERTEX;
+    // assigns the current segment to the facets in [begin, end)
+    auto setSegment = [&](std::size_t begin, std::size_t end) {
+        if (begin == end) {
+            return;
         }
-        else if (boost::regex_match(line.c_str(), what, rx_t)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            float r = static_cast<float>(std::atof(what[10].first));
-            float g = static_cast<float>(std::atof(what[13].first));
-            float b = static_cast<float>(std::atof(what[16].first));
-            meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
-
-            Base::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
-            rgb_value = MeshIO::PER_VERTEX;
+        // starts a new segment
+        if (new_segment) {
+            if (!groupName.empty()) {
+                _groupNames.push_back(groupName);
+                groupName.clear();
+            }
+            new_segment = false;
+            segment++;
         }
-        else if (boost::regex_match(line.c_str(), what, rx_g)) {
-            new_segment = true;
-            groupName = Base::Tools::escapedUnicodeToUtf8(what[1].first);
+        for (std::size_t i = begin; i < end; i++) {
+            meshFacets[i].SetProperty(segment);
         }
-        else if (boost::regex_match(line.c_str(), what, rx_m)) {
-            if (_material) {
-                _material->library = Base::Tools::escapedUnicodeToUtf8(what[1].first);
-            }
+        countMaterialFacets += end - begin;
+    };
+
+    // appends the chunks in their order, this keeps the state of the statements
+    auto merge = [&](Chunk& chunk) {
+        std::size_t pointOffset = meshPoints.size();
+        std::size_t facetOffset = meshFacets.size();
+        meshPoints.insert(meshPoints.end(), chunk.points.begin(), chunk.points.end());
+        meshFacets.insert(meshFacets.end(), chunk.facets.begin(), chunk.facets.end());
+        for (std::size_t corner : chunk.relative) {
+            PointIndex& index = meshFacets[facetOffset + corner / 3]._aulPoints[corner % 3];
+            index = static_cast<int>(index) + static_cast<int>(pointOffset);
         }
-        else if (boost::regex_match(line.c_str(), what, rx_u)) {
-            if (!materialName.empty()) {
-                _materialNames.emplace_back(materialName, countMaterialFacets);
+        if (chunk.hasColors) {
+            rgb_value = MeshIO::PER_VERTEX;
+        }
+
+        std::size_t pos = 0;
+        for (const auto& it : chunk.statements) {
+            setSegment(facetOffset + pos, facetOffset + it.facets);
+            pos = it.facets;
+            if (it.type == Statement::Group) {
+                new_segment = true;
+                groupName = Base::Tools::escapedUnicodeToUtf8(it.name);
             }
-            materialName = Base::Tools::escapedUnicodeToUtf8(what[1].first);
-            countMaterialFacets = 0;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_f3)) {
-            // starts a new segment
-            if (new_segment) {
-                if (!groupName.empty()) {
-                    _groupNames.push_back(groupName);
-                    groupName.clear();
+            else if (it.type == Statement::Library) {
+                if (_material) {
+                    _material->library = Base::Tools::escapedUnicodeToUtf8(it.name);
                 }
-                new_segment = false;
-                segment++;
             }
-
-            // 3-vertex face
-            i1 = std::atoi(what[1].first);
-            i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-            i2 = std::atoi(what[2].first);
-            i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-            i3 = std::atoi(what[3].first);
-            i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-            item.SetVertices(i1, i2, i3);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_f4)) {
-            // starts a new segment
-            if (new_segment) {
-                if (!groupName.empty()) {
-                    _groupNames.push_back(groupName);
-                    groupName.clear();
+            else {
+                if (!materialName.empty()) {
+                    _materialNames.emplace_back(materialName, countMaterialFacets);
                 }
-                new_segment = false;
-                segment++;
+                materialName = Base::Tools::escapedUnicodeToUtf8(it.name);
+                countMaterialFacets = 0;
             }
+        }
+        setSegment(facetOffset + pos, meshFacets.size());
+    };
 
-            // 4-vertex face
-            i1 = std::atoi(what[1].first);
-            i1 = i1 > 0 ? i1 - 1 : i1 + static_cast<int>(meshPoints.size());
-            i2 = std::atoi(what[2].first);
-            i2 = i2 > 0 ? i2 - 1 : i2 + static_cast<int>(meshPoints.size());
-            i3 = std::atoi(what[3].first);
-            i3 = i3 > 0 ? i3 - 1 : i3 + static_cast<int>(meshPoints.size());
-            i4 = std::atoi(what[4].first);
-            i4 = i4 > 0 ? i4 - 1 : i4 + static_cast<int>(meshPoints.size());
-
-            item.SetVertices(i1, i2, i3);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
-
-            item.SetVertices(i3, i4, i1);
-            item.SetProperty(segment);
-            meshFacets.push_back(item);
-            countMaterialFacets++;
+    // Read the file in blocks of whole lines. The lines of a block are parsed in
+    // parallel chunks, which are merged in their order afterwards. The blocks
+    // grow up to the maximum size to not allocate too much for small files.
+    constexpr std::size_t maxBlockSize = std::size_t(1) << 26;
+    constexpr std::size_t minChunkSize = std::size_t(1) << 20;
+    std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    std::size_t blockSize = std::size_t(1) << 16;
+    std::string block;
+    std::size_t used = 0;
+    std::size_t bytes = 0;
+    for (bool eof = false; !eof;) {
+        // one more byte to terminate the last token for the C functions
+        block.resize(used + blockSize + 1);
+        str.read(&block[used], static_cast<std::streamsize>(blockSize));
+        blockSize = std::min(2 * blockSize, maxBlockSize);
+        std::size_t size = used + static_cast<std::size_t>(str.gcount());
+        bytes += size - used;
+        eof = !str;
+
+        // keep an incomplete last line for the next block
+        std::size_t length = size;
+        if (!eof) {
+            std::size_t last = block.rfind('\n', size - 1);
+            if (last == std::string::npos) {
+                used = size;
+                continue;
+            }
+            length = last + 1;
         }
+        char next = block[length];
+        block[length] = '\0';
+
+        std::size_t numChunks = std::clamp<std::size_t>(length / minChunkSize, 1, numThreads);
+        std::vector<Chunk> chunks(numChunks);
+        std::vector<std::future<void>> futures;
+        const char* data = block.data();
+        const char* begin = data;
+        const char* end = data + length;
+        for (std::size_t i = 0; i < numChunks; i++) {
+            const char* split = end;
+            if (i + 1 < numChunks) {
+                split = std::find(std::max(begin, data + (i + 1) * length / numChunks), end, '\n');
+                split = split < end ? split + 1 : end;
+            }
+            if (i + 1 < numChunks) {
+                futures.push_back(
+                    std::async(std::launch::async, &Chunk::parse, &chunks[i], begin, split));
+            }
+            else {
+                chunks[i].parse(begin, split);
+            }
+            begin = split;
+        }
+        for (auto& it : futures) {
+            it.get();
+        }
+        for (auto& it : chunks) {
+            merge(it);
+        }
+
+        block[length] = next;
+        used = size - length;
+        std::memmove(block.data(), block.data() + length, used);
+    }
+
+    float seconds = Base::TimeElapsed::diffTimeF(start, Base::TimeElapsed());
+    if (seconds > 0.0F) {
+        Base::Console().log("Read %zu bytes of OBJ in %.3f s (%.1f MB/s)\n",
+                            bytes,
+                            seconds,
+                            double(bytes) / (1024.0 * 1024.0) / seconds);
     }
 
     // Add the last added material name
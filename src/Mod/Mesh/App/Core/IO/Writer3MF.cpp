@@ -22,8 +22,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <charconv>
+#include <future>
 #include <ostream>
 #include <sstream>
+#include <thread>
 #endif
 
 #include "Core/Evaluation.h"
@@ -35,6 +39,63 @@
 
 using namespace MeshCore;
 
+namespace
+{
+
+void appendNumber(std::string& str, PointIndex value)
+{
+    char buf[16];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    str.append(buf, result.ptr);
+}
+
+// the same as an ostream with the default precision writes
+void appendNumber(std::string& str, float value)
+{
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, 6);
+    str.append(buf, result.ptr);
+}
+
+// Formats the lines [0, count) with format(index, str) into buffers in parallel and
+// writes the buffers in order. Only one buffer per thread is kept at a time.
+template<typename Format>
+void writeLines(std::ostream& out, std::size_t count, Format format)
+{
+    constexpr std::size_t linesPerChunk = 16384;
+    const std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::string> buffers(numThreads);
+
+    for (std::size_t batchStart = 0; batchStart < count;
+         batchStart += linesPerChunk * numThreads) {
+        auto fill = [&](std::size_t chunk) {
+            std::string& buffer = buffers[chunk];
+            buffer.clear();
+            const std::size_t first = batchStart + chunk * linesPerChunk;
+            const std::size_t last = std::min(count, first + linesPerChunk);
+            for (std::size_t i = first; i < last; i++) {
+                format(i, buffer);
+            }
+        };
+
+        const std::size_t batchEnd = std::min(count, batchStart + linesPerChunk * numThreads);
+        const std::size_t numChunks = (batchEnd - batchStart + linesPerChunk - 1) / linesPerChunk;
+        std::vector<std::future<void>> futures;
+        for (std::size_t chunk = 1; chunk < numChunks; chunk++) {
+            futures.push_back(std::async(std::launch::async, fill, chunk));
+        }
+        fill(0);
+        for (auto& future : futures) {
+            future.get();
+        }
+        for (std::size_t chunk = 0; chunk < numChunks; chunk++) {
+            out.write(buffers[chunk].data(), std::streamsize(buffers[chunk].size()));
+        }
+    }
+}
+
+}  // namespace
+
 Writer3MF::Writer3MF(std::ostream& str)
     : zip(str)
 {
@@ -126,19 +187,30 @@ bool Writer3MF::SaveObject(std::ostream& str, int id, const MeshKernel& mesh) co
 
     // vertices
     str << Base::blanks(4) << "<vertices>\n";
-    std::size_t index = 0;
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        str << Base::blanks(5) << "<vertex x=\"" << it->x << "\" y=\"" << it->y << "\" z=\""
-            << it->z << "\" />\n";
-    }
+    writeLines(str, rPoints.size(), [&rPoints](std::size_t index, std::string& line) {
+        const MeshPoint& pnt = rPoints[index];
+        line += "     <vertex x=\"";
+        appendNumber(line, pnt.x);
+        line += "\" y=\"";
+        appendNumber(line, pnt.y);
+        line += "\" z=\"";
+        appendNumber(line, pnt.z);
+        line += "\" />\n";
+    });
     str << Base::blanks(4) << "</vertices>\n";
 
     // facet indices
     str << Base::blanks(4) << "<triangles>\n";
-    for (const auto& it : rFacets) {
-        str << Base::blanks(5) << "<triangle v1=\"" << it._aulPoints[0] << "\" v2=\""
-            << it._aulPoints[1] << "\" v3=\"" << it._aulPoints[2] << "\" />\n";
-    }
+    writeLines(str, rFacets.size(), [&rFacets](std::size_t index, std::string& line) {
+        const MeshFacet& face = rFacets[index];
+        line += "     <triangle v1=\"";
+        appendNumber(line, face._aulPoints[0]);
+        line += "\" v2=\"";
+        appendNumber(line, face._aulPoints[1]);
+        line += "\" v3=\"";
+        appendNumber(line, face._aulPoints[2]);
+        line += "\" />\n";
+    });
     str << Base::blanks(4) << "</triangles>\n";
 
     str << Base::blanks(3) << "</mesh>\n";
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <bit>
+#include <limits>
+#endif
+
+#include <Base/Matrix.h>
+
+#include "Layout.h"
+
+
+using namespace MeshCore;
+
+MeshPointCoordinates::MeshPointCoordinates(const MeshPointArray& points)
+{
+    Assign(points);
+}
+
+void MeshPointCoordinates::Assign(const MeshPointArray& points)
+{
+    std::size_t count = points.size();
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+}
+
+void MeshPointCoordinates::CopyTo(MeshPointArray& points) const
+{
+    std::size_t count = std::min(points.size(), x.size());
+    for (std::size_t i = 0; i < count; i++) {
+        points[i].Set(x[i], y[i], z[i]);
+    }
+}
+
+Base::BoundBox3f MeshPointCoordinates::GetBoundBox() const
+{
+    if (x.empty()) {
+        return Base::BoundBox3f();
+    }
+
+    // Min/max reductions with independent lanes, a single accumulator would serialize the loop
+    // and keep the compiler from using vector registers.
+    constexpr std::size_t lanes = 8;
+    auto range = [](const std::vector<float>& values) {
+        float lo[lanes];
+        float hi[lanes];
+        std::fill(lo, lo + lanes, values.front());
+        std::fill(hi, hi + lanes, values.front());
+        std::size_t count = values.size() - values.size() % lanes;
+        const float* data = values.data();
+        for (std::size_t i = 0; i < count; i += lanes) {
+            for (std::size_t j = 0; j < lanes; j++) {
+                lo[j] = data[i + j] < lo[j] ? data[i + j] : lo[j];
+                hi[j] = data[i + j] > hi[j] ? data[i + j] : hi[j];
+            }
+        }
+        for (std::size_t i = count; i < values.size(); i++) {
+            lo[0] = std::min(lo[0], data[i]);
+            hi[0] = std::max(hi[0], data[i]);
+        }
+        return std::make_pair(*std::min_element(lo, lo + lanes), *std::max_element(hi, hi + lanes));
+    };
+    auto [minX, maxX] = range(x);
+    auto [minY, maxY] = range(y);
+    auto [minZ, maxZ] = range(z);
+    return Base::BoundBox3f(minX, minY, minZ, maxX, maxY, maxZ);
+}
+
+void MeshPointCoordinates::Transform(const Base::Matrix4D& mat)
+{
+    // same precision as Matrix4D::multVec()
+    const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+    const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+
+    float* px = x.data();
+    float* py = y.data();
+    float* pz = z.data();
+    std::size_t count = x.size();
+    for (std::size_t i = 0; i < count; i++) {
+        double vx = px[i];
+        double vy = py[i];
+        double vz = pz[i];
+        px[i] = static_cast<float>(m00 * vx + m01 * vy + m02 * vz + m03);
+        py[i] = static_cast<float>(m10 * vx + m11 * vy + m12 * vz + m13);
+        pz[i] = static_cast<float>(m20 * vx + m21 * vy + m22 * vz + m23);
+    }
+}
+
+void MeshPointCoordinates::SquaredDistances(const Base::Vector3f& pnt,
+                                            std::vector<float>& dist) const
+{
+    std::size_t count = x.size();
+    dist.resize(count);
+    const float* px = x.data();
+    const float* py = y.data();
+    const float* pz = z.data();
+    float* pd = dist.data();
+    for (std::size_t i = 0; i < count; i++) {
+        float dx = px[i] - pnt.x;
+        float dy = py[i] - pnt.y;
+        float dz = pz[i] - pnt.z;
+        pd[i] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+PointIndex MeshPointCoordinates::NearestPoint(const Base::Vector3f& pnt) const
+{
+    // distances in blocks that fit into the cache, the search over a block is a reduction
+    constexpr std::size_t blockSize = 1024;
+    float dist[blockSize];
+    float minDist = std::numeric_limits<float>::max();
+    PointIndex nearest = POINT_INDEX_MAX;
+
+    std::size_t count = x.size();
+    for (std::size_t begin = 0; begin < count; begin += blockSize) {
+        std::size_t num = std::min(blockSize, count - begin);
+        const float* px = x.data() + begin;
+        const float* py = y.data() + begin;
+        const float* pz = z.data() + begin;
+        for (std::size_t i = 0; i < num; i++) {
+            float dx = px[i] - pnt.x;
+            float dy = py[i] - pnt.y;
+            float dz = pz[i] - pnt.z;
+            dist[i] = dx * dx + dy * dy + dz * dz;
+        }
+        const float* it = std::min_element(dist, dist + num);
+        if (*it < minDist) {
+            minDist = *it;
+            nearest = begin + (it - dist);
+        }
+    }
+
+    return nearest;
+}
+
+// ----------------------------------------------------------------------
+
+void MeshFlagBits::Resize(std::size_t num)
+{
+    size = num;
+    words.assign((num + 63) / 64, 0);
+}
+
+void MeshFlagBits::SetAll()
+{
+    std::fill(words.begin(), words.end(), ~std::uint64_t(0));
+    // keep the bits beyond the size reset so that Count() stays correct
+    if (size % 64 != 0) {
+        words.back() = (std::uint64_t(1) << (size % 64)) - 1;
+    }
+}
+
+void MeshFlagBits::ResetAll()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+std::size_t MeshFlagBits::Count() const
+{
+    std::size_t count = 0;
+    for (std::uint64_t word : words) {
+        count += std::popcount(word);
+    }
+    return count;
+}
+
+std::vector<std::size_t> MeshFlagBits::GetIndices() const
+{
+    std::vector<std::size_t> indices;
+    indices.reserve(Count());
+    for (std::size_t i = 0; i < words.size(); i++) {
+        std::uint64_t word = words[i];
+        while (word) {
+            indices.push_back(64 * i + std::countr_zero(word));
+            word &= word - 1;
+        }
+    }
+    return indices;
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_LAYOUT_H
+#define MESH_LAYOUT_H
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Elements.h"
+
+
+namespace Base
+{
+class Matrix4D;
+}
+
+namespace MeshCore
+{
+
+/**
+ * The MeshPointCoordinates class keeps the coordinates of a point array in three separate,
+ * tightly packed arrays. A MeshPoint also carries its flag and property, so loops over the
+ * coordinates of a MeshPointArray move twice the memory they need and can hardly be vectorized.
+ * Algorithms that run several passes over the coordinates take a copy in this layout, work on it
+ * and write the coordinates back.
+ */
+class MeshExport MeshPointCoordinates
+{
+public:
+    MeshPointCoordinates() = default;
+    explicit MeshPointCoordinates(const MeshPointArray& points);
+
+    /// Copies the coordinates of \a points.
+    void Assign(const MeshPointArray& points);
+    /// Writes the coordinates to \a points that must have the same size. Flags and properties
+    /// of the points are kept.
+    void CopyTo(MeshPointArray& points) const;
+
+    std::size_t Size() const
+    {
+        return x.size();
+    }
+    Base::Vector3f GetPoint(PointIndex index) const
+    {
+        return Base::Vector3f(x[index], y[index], z[index]);
+    }
+    const float* X() const
+    {
+        return x.data();
+    }
+    const float* Y() const
+    {
+        return y.data();
+    }
+    const float* Z() const
+    {
+        return z.data();
+    }
+    float* X()
+    {
+        return x.data();
+    }
+    float* Y()
+    {
+        return y.data();
+    }
+    float* Z()
+    {
+        return z.data();
+    }
+
+    /** @name Kernels */
+    //@{
+    /// The bounding box of all points.
+    Base::BoundBox3f GetBoundBox() const;
+    /// Transforms all points.
+    void Transform(const Base::Matrix4D& mat);
+    /// Fills \a dist with the squared distance of every point to \a pnt.
+    void SquaredDistances(const Base::Vector3f& pnt, std::vector<float>& dist) const;
+    /// The index of the point closest to \a pnt or POINT_INDEX_MAX if there are no points.
+    PointIndex NearestPoint(const Base::Vector3f& pnt) const;
+    //@}
+
+private:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+};
+
+/**
+ * The MeshFlagBits class holds one flag per point or facet as a bit array. Used instead of the
+ * flag byte of MeshPoint or MeshFacet it keeps temporary marks away from the geometry, and
+ * resetting all marks clears a few words instead of writing to every element of the array.
+ */
+class MeshExport MeshFlagBits
+{
+public:
+    MeshFlagBits() = default;
+    explicit MeshFlagBits(std::size_t size)
+    {
+        Resize(size);
+    }
+
+    /// Changes the number of flags, all flags are reset.
+    void Resize(std::size_t size);
+    std::size_t Size() const
+    {
+        return size;
+    }
+    void Set(std::size_t index)
+    {
+        words[index >> 6] |= std::uint64_t(1) << (index & 63);
+    }
+    void Reset(std::size_t index)
+    {
+        words[index >> 6] &= ~(std::uint64_t(1) << (index & 63));
+    }
+    bool Test(std::size_t index) const
+    {
+        return (words[index >> 6] >> (index & 63)) & 1;
+    }
+    /// Sets the flag and returns true if it was reset before.
+    bool TestAndSet(std::size_t index)
+    {
+        std::uint64_t bit = std::uint64_t(1) << (index & 63);
+        std::uint64_t& word = words[index >> 6];
+        bool wasReset = (word & bit) == 0;
+        word |= bit;
+        return wasReset;
+    }
+    void SetAll();
+    void ResetAll();
+    /// The number of set flags.
+    std::size_t Count() const;
+    /// The indices of all set flags in ascending order.
+    std::vector<std::size_t> GetIndices() const;
+
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t size {0};
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_LAYOUT_H
@@ -25,6 +25,7 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
@@ -35,6 +36,7 @@
 #include <boost/convert/spirit.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
+#include <QFile>
 
 #include "IO/Reader3MF.h"
 #include "IO/ReaderOBJ.h"
@@ -50,6 +52,7 @@
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 #include <zipios++/gzipoutputstream.h>
@@ -109,6 +112,14 @@ struct QUAD
     int iV[4];
 };
 
+// Checks the (upper case) buffer read after the 80 bytes header of an STL file
+// for keywords that only occur in ASCII files.
+bool hasAsciiSTLKeywords(const char* szBuf)
+{
+    return strstr(szBuf, "SOLID") || strstr(szBuf, "FACET") || strstr(szBuf, "NORMAL")
+        || strstr(szBuf, "VERTEX") || strstr(szBuf, "ENDFACET") || strstr(szBuf, "ENDLOOP");
+}
+
 // This is a workaround for the issue described at:
 // https://github.com/Zipios/Zipios/issues/43#issue-1618151314
 //
@@ -241,6 +252,44 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
+        // Binary STL files are read directly from a memory-mapped file if possible
+        QFile file(QString::fromUtf8(FileName));
+        const uchar* data = nullptr;
+        qint64 size = 0;
+        if (file.open(QIODevice::ReadOnly)) {
+            size = file.size();
+            data = size > 0 ? file.map(0, size) : nullptr;
+        }
+
+        if (data) {
+            // Apply the same heuristic as LoadSTL() to decide if the file is binary
+            const char* bytes = reinterpret_cast<const char*>(data);
+            uint32_t ulCt {};
+            std::size_t ulBytes = 0;
+            if (size >= 84) {
+                std::memcpy(&ulCt, bytes + 80, sizeof(ulCt));
+                ulBytes = std::min<std::size_t>(ulCt > 1 ? 100 : 50, size - 84);
+            }
+            std::string szBuf(bytes + std::min<qint64>(84, size), ulBytes);
+            boost::algorithm::to_upper(szBuf);
+            if (size >= 84 && !hasAsciiSTLKeywords(szBuf.c_str())) {
+                try {
+                    ok = LoadBinarySTL(bytes, static_cast<std::size_t>(size));
+                }
+                catch (const Base::MemoryException&) {
+                    _rclMesh.Clear();
+                    throw;
+                }
+                catch (const Base::AbortException&) {
+                    _rclMesh.Clear();
+                    ok = false;
+                }
+                file.unmap(const_cast<uchar*>(data));
+                return ok;
+            }
+            file.unmap(const_cast<uchar*>(data));
+        }
+
         ok = LoadSTL(str);
     }
     else if (fi.hasExtension("iv")) {
@@ -348,9 +397,7 @@ bool MeshInput::LoadSTL(std::istream& input)
     boost::algorithm::to_upper(szBuf);
 
     try {
-        if (!strstr(szBuf, "SOLID") && !strstr(szBuf, "FACET") && !strstr(szBuf, "NORMAL")
-            && !strstr(szBuf, "VERTEX") && !strstr(szBuf, "ENDFACET")
-            && !strstr(szBuf, "ENDLOOP")) {
+        if (!hasAsciiSTLKeywords(szBuf)) {
             // probably binary STL
             buf->pubseekoff(0, std::ios::beg, std::ios::in);
             return LoadBinarySTL(input);
@@ -858,6 +905,56 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
     return true;
 }
 
+bool MeshInput::LoadBinarySTL(const char* data, std::size_t size)
+{
+    // 80 bytes header, 4 bytes facet count and 50 bytes per facet record:
+    // 12 bytes normal, 36 bytes points and 2 bytes attribute
+    constexpr std::size_t headerSize = 80 + sizeof(uint32_t);
+    constexpr std::size_t recordSize = 50;
+    if (!data || size < headerSize) {
+        return false;
+    }
+
+    uint32_t ulCt = 0;
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+
+    // compare the calculated with the read value
+    std::size_t ulFac = (size - headerSize) / recordSize;
+    if (ulCt > ulFac) {
+        return false;  // not a valid STL file
+    }
+
+    Base::TimeElapsed start;
+
+    MeshFastBuilder builder(this->_rclMesh);
+    builder.Initialize(static_cast<MeshFastBuilder::size_type>(ulCt));
+
+    // convert the records in blocks to be able to report progress
+    constexpr uint32_t blockSize = 1 << 20;
+    Base::SequencerLauncher seq("Loading STL...", (ulCt + blockSize - 1) / blockSize);
+    const char* records = data + headerSize;
+    for (uint32_t i = 0; i < ulCt; i += blockSize) {
+        uint32_t count = std::min(blockSize, ulCt - i);
+        builder.AddFacets(records + std::size_t(i) * recordSize + 3 * sizeof(float),
+                          static_cast<MeshFastBuilder::size_type>(count),
+                          recordSize);
+        seq.next(true);
+    }
+
+    builder.Finish();
+
+    float seconds = Base::TimeElapsed::diffTimeF(start, Base::TimeElapsed());
+    std::size_t bytes = headerSize + std::size_t(ulCt) * recordSize;
+    if (seconds > 0.0F) {
+        Base::Console().log("Read %zu bytes of binary STL in %.3f s (%.1f MB/s)\n",
+                            bytes,
+                            seconds,
+                            double(bytes) / (1024.0 * 1024.0) / seconds);
+    }
+
+    return true;
+}
+
 /** Loads the mesh object from an XML file. */
 void MeshInput::LoadXML(Base::XMLReader& reader)
 {
@@ -131,6 +131,11 @@ public:
     bool LoadAsciiSTL(std::istream& input);
     /** Loads a binary STL file. */
     bool LoadBinarySTL(std::istream& input);
+    /** Loads a binary STL file from a memory buffer such as a memory-mapped file.
+     * The facet records are converted in parallel and the points are merged without
+     * going through the stream based reader.
+     */
+    bool LoadBinarySTL(const char* data, std::size_t size);
     /** Loads an OBJ Mesh file. */
     bool LoadOBJ(std::istream& input);
     /** Loads an OBJ Mesh file. */
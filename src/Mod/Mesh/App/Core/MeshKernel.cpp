@@ -34,11 +34,13 @@
 #include <Base/Exception.h>
 #include <Base/Stream.h>
 #include <Base/Swap.h>
+#include <Base/Writer.h>
 
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Evaluation.h"
 #include "Iterator.h"
+#include "Layout.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -916,6 +918,138 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
 }
 
+namespace
+{
+// The number of elements that are converted at once for the raw format
+constexpr std::size_t rawBlockSize = 4096;
+constexpr uint32_t rawVersion = 0x020000;
+constexpr uint32_t rawHeaderSize = 40;
+
+std::size_t rawPadding(std::size_t size)
+{
+    const std::size_t alignment = Base::Writer::storedAlignment;
+    return (alignment - size % alignment) % alignment;
+}
+
+void writeRawPadding(std::ostream& out, std::size_t size)
+{
+    std::vector<char> padding(rawPadding(size), 0);
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+}
+}  // namespace
+
+void MeshKernel::WriteRaw(std::ostream& rclOut) const
+{
+    if (!rclOut || rclOut.bad()) {
+        return;
+    }
+
+    Base::OutputStream str(rclOut);
+    str << static_cast<uint32_t>(0xA0B0C0D0) << rawVersion;
+    str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
+    str << _clBoundBox.MinX << _clBoundBox.MaxX;
+    str << _clBoundBox.MinY << _clBoundBox.MaxY;
+    str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
+    writeRawPadding(rclOut, rawHeaderSize);
+
+    // the elements have further members, so they are packed block by block
+    std::vector<float> coords;
+    for (std::size_t begin = 0; begin < _aclPointArray.size(); begin += rawBlockSize) {
+        std::size_t end = std::min(_aclPointArray.size(), begin + rawBlockSize);
+        coords.clear();
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshPoint& pnt = _aclPointArray[index];
+            coords.insert(coords.end(), {pnt.x, pnt.y, pnt.z});
+        }
+        str.writeArray(coords.data(), coords.size());
+    }
+    writeRawPadding(rclOut, 3 * sizeof(float) * _aclPointArray.size());
+
+    // open edges are written as 0xffffffff
+    std::vector<uint32_t> indices;
+    for (std::size_t begin = 0; begin < _aclFacetArray.size(); begin += rawBlockSize) {
+        std::size_t end = std::min(_aclFacetArray.size(), begin + rawBlockSize);
+        indices.clear();
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& face = _aclFacetArray[index];
+            for (PointIndex pnt : face._aulPoints) {
+                indices.push_back(static_cast<uint32_t>(pnt));
+            }
+            for (FacetIndex nb : face._aulNeighbours) {
+                indices.push_back(static_cast<uint32_t>(nb));
+            }
+        }
+        str.writeArray(indices.data(), indices.size());
+    }
+}
+
+void MeshKernel::ReadRaw(Base::InputStream& str, std::istream& rclIn)
+{
+    uint32_t uCtPts = 0, uCtFts = 0;
+    str >> uCtPts >> uCtFts;
+    Base::BoundBox3f box;
+    str >> box.MinX >> box.MaxX;
+    str >> box.MinY >> box.MaxY;
+    str >> box.MinZ >> box.MaxZ;
+    rclIn.ignore(static_cast<std::streamsize>(rawPadding(rawHeaderSize)));
+
+    try {
+        MeshPointArray pointArray;
+        pointArray.resize(uCtPts);
+        std::vector<float> coords;
+        for (std::size_t begin = 0; begin < pointArray.size(); begin += rawBlockSize) {
+            std::size_t end = std::min(pointArray.size(), begin + rawBlockSize);
+            coords.resize(3 * (end - begin));
+            str.readArray(coords.data(), coords.size());
+            for (std::size_t index = begin; index < end; index++) {
+                const float* xyz = &coords[3 * (index - begin)];
+                pointArray[index].Set(xyz[0], xyz[1], xyz[2]);
+            }
+        }
+        rclIn.ignore(static_cast<std::streamsize>(rawPadding(3 * sizeof(float) * uCtPts)));
+
+        const uint32_t open_edge = 0xffffffff;
+        MeshFacetArray facetArray;
+        facetArray.resize(uCtFts);
+        std::vector<uint32_t> indices;
+        for (std::size_t begin = 0; begin < facetArray.size(); begin += rawBlockSize) {
+            std::size_t end = std::min(facetArray.size(), begin + rawBlockSize);
+            indices.resize(6 * (end - begin));
+            str.readArray(indices.data(), indices.size());
+            for (std::size_t index = begin; index < end; index++) {
+                const uint32_t* values = &indices[6 * (index - begin)];
+                MeshFacet& face = facetArray[index];
+                for (int i = 0; i < 3; i++) {
+                    // make sure to have valid indices
+                    if (values[i] >= uCtPts) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
+                    uint32_t nb = values[i + 3];
+                    if (nb >= uCtFts && nb < open_edge) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
+                    face._aulPoints[i] = values[i];
+                    face._aulNeighbours[i] = nb < open_edge ? nb : FACET_INDEX_MAX;
+                }
+            }
+        }
+
+        if (!rclIn) {
+            throw Base::BadFormatError("Reading from stream failed");
+        }
+
+        _aclPointArray.swap(pointArray);
+        _aclFacetArray.swap(facetArray);
+        _clBoundBox = box;
+    }
+    catch (std::bad_alloc&) {
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+    catch (std::length_error&) {
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+}
+
 void MeshKernel::Read(std::istream& rclIn)
 {
     if (!rclIn || rclIn.bad()) {
@@ -934,6 +1068,11 @@ void MeshKernel::Read(std::istream& rclIn)
     Base::SwapEndian(swap_version);
     uint32_t open_edge = 0xffffffff;  // value to mark an open edge
 
+    if (magic == 0xA0B0C0D0 && version == rawVersion) {
+        ReadRaw(str, rclIn);
+        return;
+    }
+
     // is it the new or old format?
     bool new_format = false;
     if (magic == 0xA0B0C0D0 && version == 0x010000) {
@@ -1112,14 +1251,8 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    rclMat.transformPoints(_aclPointArray.begin(), _aclPointArray.end());
+    RecalcBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1128,6 +1261,17 @@ void MeshKernel::Smooth(int iterations, float stepsize)
     LaplaceSmoothing(*this).Smooth(iterations);
 }
 
+MeshPointCoordinates MeshKernel::GetPointCoordinates() const
+{
+    return MeshPointCoordinates(_aclPointArray);
+}
+
+void MeshKernel::SetPointCoordinates(const MeshPointCoordinates& coords)
+{
+    coords.CopyTo(_aclPointArray);
+    _clBoundBox = coords.GetBoundBox();
+}
+
 void MeshKernel::RecalcBoundBox() const
 {
     _clBoundBox.SetVoid();
@@ -34,6 +34,7 @@
 
 namespace Base
 {
+class InputStream;
 class Polygon2d;
 class ViewProjMethod;
 }  // namespace Base
@@ -49,6 +50,7 @@ class MeshFacet;
 class MeshFacetVisitor;
 class MeshPointVisitor;
 class MeshFacetGrid;
+class MeshPointCoordinates;
 
 
 /**
@@ -79,6 +81,11 @@ public:
     //@{
     /// Binary streaming of data
     void Write(std::ostream& rclOut) const;
+    /** Writes the points and facets as little endian arrays, each one aligned to
+     * Base::Writer::storedAlignment bytes from the start of the stream. Read() detects
+     * this format, it restores the arrays with bulk reads instead of value by value.
+     */
+    void WriteRaw(std::ostream& rclOut) const;
     void Read(std::istream& rclIn);
     //@}
 
@@ -99,8 +106,8 @@ public:
     /// Returns the number of required memory in bytes
     unsigned int GetMemSize() const
     {
-        return static_cast<unsigned int>(_aclPointArray.size() * sizeof(MeshPoint)
-                                         + _aclFacetArray.size() * sizeof(MeshFacet));
+        return static_cast<unsigned int>(_aclPointArray.capacity() * sizeof(MeshPoint)
+                                         + _aclFacetArray.capacity() * sizeof(MeshFacet));
     }
     /// Determines the bounding box
     const Base::BoundBox3f& GetBoundBox() const
@@ -176,6 +183,14 @@ public:
     {
         return MeshPointModifier(_aclPointArray);
     }
+    /** Returns a copy of the point coordinates in separate arrays per axis. Loops over many
+     * points run much faster on this layout, see MeshPointCoordinates.
+     */
+    MeshPointCoordinates GetPointCoordinates() const;
+    /** Replaces the coordinates of all points with \a coords that must have been taken from this
+     * kernel, flags and properties of the points are kept. The bounding box gets updated.
+     */
+    void SetPointCoordinates(const MeshPointCoordinates& coords);
 
     /** Returns the array of all facets */
     const MeshFacetArray& GetFacets() const
@@ -402,6 +417,11 @@ public:
     void RemoveInvalids();
     /** Rebuilds the neighbour indices for all facets. */
     void RebuildNeighbours();
+    /** Rebuilds the neighbour indices of the facets from index \a index on. Only edges shared
+     * by facets of this range are linked, so algorithms that append facets can use it instead
+     * of a complete rebuild as long as they connect the new facets with the old ones themselves.
+     */
+    void RebuildNeighbours(FacetIndex index);
     /** Removes unreferenced points or facets with invalid indices from the mesh. */
     void Cleanup();
     /** Clears the whole data structure. */
@@ -464,8 +484,6 @@ public:
     //@}
 
 protected:
-    /** Rebuilds the neighbour indices for subset of all facets from index \a index on. */
-    void RebuildNeighbours(FacetIndex);
     /** Checks if this point is associated to no other facet and deletes if so.
      * The point indices of the facets get adjusted.
      * \a ulIndex is the index of the point to be deleted. \a ulFacetIndex is the index
@@ -482,6 +500,8 @@ protected:
     inline Base::Vector3f GetGravityPoint(const MeshFacet& rclFacet) const;
 
 private:
+    void ReadRaw(Base::InputStream& str, std::istream& rclIn);
+
     MeshPointArray _aclPointArray;        /**< Holds the array of geometric points. */
     MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
@@ -496,6 +516,7 @@ private:
     friend class MeshFixDuplicatePoints;
     friend class MeshBuilder;
     friend class MeshTrimming;
+    friend class MeshDecimation;
 };
 
 inline MeshPoint MeshKernel::GetPoint(PointIndex ulIndex) const
@@ -23,8 +23,11 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <future>
 #include <limits>
+#include <thread>
 #endif
 
 #include "Algorithm.h"
@@ -68,7 +71,7 @@ MeshDistancePlanarSegment::MeshDistancePlanarSegment(const MeshKernel& mesh,
                                                      unsigned long minFacets,
                                                      float tol)
     : MeshDistanceSurfaceSegment(mesh, minFacets, tol)
-    , fitter(new PlaneFit)
+    , fitter(new IncrementalPlaneFit)
 {}
 
 MeshDistancePlanarSegment::~MeshDistancePlanarSegment()
@@ -112,7 +115,7 @@ void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
-    : fitter(new PlaneFit)
+    : fitter(new IncrementalPlaneFit)
 {}
 
 PlaneSurfaceFit::PlaneSurfaceFit(const Base::Vector3f& b, const Base::Vector3f& n)
@@ -554,6 +557,182 @@ bool MeshSurfaceVisitor::Visit(const MeshFacet& face,
 
 // --------------------------------------------------------
 
+namespace
+{
+
+template<typename Func>
+void parallelFor(std::size_t count, Func&& func)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / 10000));
+    std::size_t chunk = (count + threads - 1) / threads;
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < threads; t++) {
+        futures.push_back(std::async(std::launch::async, [&func, t, chunk, count]() {
+            func(t * chunk, std::min(count, (t + 1) * chunk));
+        }));
+    }
+    func(0, std::min(count, chunk));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+// The facets of a component point to a facet with a lower index, the root is the lowest facet
+FacetIndex findRoot(std::vector<std::atomic<FacetIndex>>& parent, FacetIndex index)
+{
+    while (true) {
+        FacetIndex next = parent[index].load();
+        if (next == index) {
+            return index;
+        }
+        FacetIndex grand = parent[next].load();
+        if (grand != next) {
+            parent[index].compare_exchange_weak(next, grand);
+        }
+        index = grand;
+    }
+}
+
+void joinComponents(std::vector<std::atomic<FacetIndex>>& parent,
+                    FacetIndex index1,
+                    FacetIndex index2)
+{
+    while (true) {
+        index1 = findRoot(parent, index1);
+        index2 = findRoot(parent, index2);
+        if (index1 == index2) {
+            return;
+        }
+        if (index1 < index2) {
+            std::swap(index1, index2);
+        }
+        // fails if another thread has linked the root in the meantime
+        FacetIndex expected = index1;
+        if (parent[index1].compare_exchange_strong(expected, index2)) {
+            return;
+        }
+    }
+}
+
+void claimMin(std::atomic<FacetIndex>& owner, FacetIndex index)
+{
+    FacetIndex current = owner.load();
+    while (index < current && !owner.compare_exchange_weak(current, index)) {}
+}
+
+}  // namespace
+
+void MeshSegmentAlgorithm::FindStatelessSegments(MeshSurfaceSegment& segm,
+                                                 std::vector<FacetIndex>& resetVisited)
+{
+    // Growing a segment from a start facet visits all connected facets that pass TestFacet(),
+    // so the segments are the connected components of these facets. A component is claimed by
+    // the facet it is grown from first: its own lowest facet or a lower, failing facet that is
+    // adjacent to it. This gives the same segments as growing them one after the other.
+    enum State : char
+    {
+        Visited,
+        Failed,
+        Passed
+    };
+
+    const MeshFacetArray& rFAry = myKernel.GetFacets();
+    std::size_t count = rFAry.size();
+    std::vector<char> state(count);
+    std::vector<char> initial(count);
+    std::vector<std::atomic<FacetIndex>> parent(count);
+    std::vector<std::atomic<FacetIndex>> owner(count);
+
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            parent[i].store(i, std::memory_order_relaxed);
+            owner[i].store(i, std::memory_order_relaxed);
+            if (rFAry[i].IsFlag(MeshFacet::VISIT)) {
+                state[i] = Visited;
+            }
+            else {
+                state[i] = segm.TestFacet(rFAry[i]) ? Passed : Failed;
+                initial[i] = segm.TestInitialFacet(i);
+            }
+        }
+    });
+
+    auto passedNeighbours = [&](std::size_t index, auto&& func) {
+        for (FacetIndex nb : rFAry[index]._aulNeighbours) {
+            if (nb < count && state[nb] == Passed) {
+                func(nb);
+            }
+        }
+    };
+
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            if (state[i] == Passed) {
+                passedNeighbours(i, [&](FacetIndex nb) {
+                    joinComponents(parent, i, nb);
+                });
+            }
+        }
+    });
+
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            if (state[i] == Passed) {
+                parent[i].store(findRoot(parent, i));
+            }
+            else if (state[i] == Failed) {
+                passedNeighbours(i, [&](FacetIndex nb) {
+                    claimMin(owner[findRoot(parent, nb)], i);
+                });
+            }
+        }
+    });
+
+    // sort the facets by their start facet
+    std::vector<FacetIndex> start(count, FACET_INDEX_MAX);
+    std::vector<FacetIndex> offset(count + 1, 0);
+    for (std::size_t i = 0; i < count; i++) {
+        if (state[i] == Passed) {
+            start[i] = owner[parent[i].load()].load();
+        }
+        else if (state[i] == Failed) {
+            start[i] = i;
+        }
+        else {
+            continue;
+        }
+        if (start[i] != i || initial[i]) {
+            offset[start[i] + 1]++;
+        }
+        rFAry[i].SetFlag(MeshFacet::VISIT);
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        offset[i + 1] += offset[i];
+    }
+    std::vector<FacetIndex> facets(offset[count]);
+    std::vector<FacetIndex> fill(offset.begin(), offset.end() - 1);
+    for (std::size_t i = 0; i < count; i++) {
+        if (start[i] != FACET_INDEX_MAX && (start[i] != i || initial[i])) {
+            facets[fill[start[i]]++] = i;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        if (start[i] != i) {
+            continue;
+        }
+        if (offset[i + 1] - offset[i] <= 1) {
+            resetVisited.push_back(i);
+        }
+        else {
+            segm.AddSegment(std::vector<FacetIndex>(facets.begin() + long(offset[i]),
+                                                    facets.begin() + long(offset[i + 1])));
+        }
+    }
+}
+
 void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm)
 {
     // reset VISIT flags
@@ -574,6 +753,11 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
         resetVisited.clear();
 
+        if (it->IsStateless()) {
+            FindStatelessSegments(*it, resetVisited);
+            continue;
+        }
+
         MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
         iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::VISIT);
@@ -34,7 +34,7 @@
 namespace MeshCore
 {
 
-class PlaneFit;
+class IncrementalPlaneFit;
 class CylinderFit;
 class SphereFit;
 class MeshFacet;
@@ -58,6 +58,13 @@ public:
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
     virtual void AddFacet(const MeshFacet& rclFacet);
+    /** Returns true if TestFacet() and TestInitialFacet() only depend on the tested facet
+     * and not on the facets added before. The segments of such a type are searched in parallel.
+     */
+    virtual bool IsStateless() const
+    {
+        return false;
+    }
     void AddSegment(const std::vector<FacetIndex>&);
     const std::vector<MeshSegment>& GetSegments() const
     {
@@ -111,7 +118,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport AbstractSurfaceFit
@@ -162,7 +169,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport CylinderSurfaceFit: public AbstractSurfaceFit
@@ -270,6 +277,10 @@ public:
     {
         return info.at(pos);
     }
+    bool IsStateless() const override
+    {
+        return true;
+    }
 
 private:
     const std::vector<CurvatureInfo>& info;
@@ -392,6 +403,9 @@ public:
     {}
     void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
 
+private:
+    void FindStatelessSegments(MeshSurfaceSegment&, std::vector<FacetIndex>& resetVisited);
+
 private:
     const MeshKernel& myKernel;
 };
@@ -23,8 +23,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <fstream>
+#include <future>
 #include <ios>
+#include <thread>
 #endif
 
 #include <Base/Builder3D.h>
@@ -34,6 +37,7 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "FacetTree.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "SetOperations.h"
@@ -174,224 +178,259 @@ void SetOperations::Do()
 void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0,
                         std::set<FacetIndex>& facetsCuttingEdge1)
 {
-    MeshFacetGrid grid1(_cutMesh0, 20);
-    MeshFacetGrid grid2(_cutMesh1, 20);
-
-    unsigned long ctGx1 {}, ctGy1 {}, ctGz1 {};
-    grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
-
-    for (auto gx1 = 0UL; gx1 < ctGx1; gx1++) {
-        for (auto gy1 = 0UL; gy1 < ctGy1; gy1++) {
-            for (auto gz1 = 0UL; gz1 < ctGz1; gz1++) {
-                if (grid1.GetCtElements(gx1, gy1, gz1) > 0) {
-                    std::vector<FacetIndex> vecFacets2;
-                    grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-
-                    if (!vecFacets2.empty()) {
-                        std::set<FacetIndex> vecFacets1;
-                        grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-
-                        std::set<FacetIndex>::iterator it1;
-                        for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
-                            FacetIndex fidx1 = *it1;
-                            MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-
-                            std::vector<FacetIndex>::iterator it2;
-                            for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
-                                FacetIndex fidx2 = *it2;
-                                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                                MeshPoint p0, p1;
-
-                                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                                if (isect > 0) {
-                                    // optimize cut line if distance to nearest point is too small
-                                    float minDist1 = _minDistanceToPoint,
-                                          minDist2 = _minDistanceToPoint;
-                                    MeshPoint np0 = p0, np1 = p1;
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f1._aclPoints[i] - p0).Length();
-                                        float d2 = (f1._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f1._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            p1 = f1._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    // optimize cut line if distance to nearest point is too small
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f2._aclPoints[i] - p0).Length();
-                                        float d2 = (f2._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f2._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            np1 = f2._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    MeshPoint mp0 = np0;
-                                    MeshPoint mp1 = np1;
-
-                                    if (mp0 != mp1) {
-                                        facetsCuttingEdge0.insert(fidx1);
-                                        facetsCuttingEdge1.insert(fidx2);
-
-                                        _cutPoints.insert(mp0);
-                                        _cutPoints.insert(mp1);
-
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit0 =
-                                            _cutPoints.insert(mp0);
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit1 =
-                                            _cutPoints.insert(mp1);
-
-                                        _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                                        _facet2points[0][fidx1].push_back(pit0.first);
-                                        _facet2points[0][fidx1].push_back(pit1.first);
-                                        _facet2points[1][fidx2].push_back(pit0.first);
-                                        _facet2points[1][fidx2].push_back(pit1.first);
-                                    }
-                                    else {
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit =
-                                            _cutPoints.insert(mp0);
-
-                                        // do not insert a facet when only one corner point cuts the
-                                        // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
-                                        // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge0.insert(fidx1);
-                                            _facet2points[0][fidx1].push_back(pit.first);
-                                        }
-
-                                        // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
-                                        // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge1.insert(fidx2);
-                                            _facet2points[1][fidx2].push_back(pit.first);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
+    // The cut of a pair of facets, both points are equal if the facets only touch
+    struct FacetCut
+    {
+        FacetIndex facet1;
+        FacetIndex facet2;
+        MeshPoint mp0;
+        MeshPoint mp1;
+    };
+
+    // The candidate pairs come from the search trees and are intersected in parallel
+    std::size_t count = _cutMesh0.CountFacets() + _cutMesh1.CountFacets();
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / 10000));
+    std::vector<std::vector<FacetCut>> cutsOf(threads);
+
+    MeshFacetTree tree0(_cutMesh0);
+    MeshFacetTree tree1(_cutMesh1);
+    auto intersect = [&](std::size_t thread, FacetIndex fidx1, FacetIndex fidx2) {
+        MeshGeomFacet f1 = _cutMesh0.GetFacet(fidx1);
+        MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
+
+        MeshPoint p0, p1;
+
+        int isect = f1.IntersectWithFacet(f2, p0, p1);
+        if (isect > 0) {
+            // optimize cut line if distance to nearest point is too small
+            float minDist1 = _minDistanceToPoint,
+                  minDist2 = _minDistanceToPoint;
+            MeshPoint np0 = p0, np1 = p1;
+            for (int i = 0; i < 3; i++)  // NOLINT
+            {
+                float d1 = (f1._aclPoints[i] - p0).Length();
+                float d2 = (f1._aclPoints[i] - p1).Length();
+                if (d1 < minDist1) {
+                    minDist1 = d1;
+                    np0 = f1._aclPoints[i];
                 }
-            }
+                if (d2 < minDist2) {
+                    minDist2 = d2;
+                    p1 = f1._aclPoints[i];
+                }
+            }  // for (int i = 0; i < 3; i++)
+
+            // optimize cut line if distance to nearest point is too small
+            for (int i = 0; i < 3; i++)  // NOLINT
+            {
+                float d1 = (f2._aclPoints[i] - p0).Length();
+                float d2 = (f2._aclPoints[i] - p1).Length();
+                if (d1 < minDist1) {
+                    minDist1 = d1;
+                    np0 = f2._aclPoints[i];
+                }
+                if (d2 < minDist2) {
+                    minDist2 = d2;
+                    np1 = f2._aclPoints[i];
+                }
+            }  // for (int i = 0; i < 3; i++)
+
+            cutsOf[thread].push_back({fidx1, fidx2, np0, np1});
         }
+        return true;
+    };
+    tree0.OverlappingFacets(tree1, threads, intersect);
+
+    // add the cuts in an order that doesn't depend on the threads
+    std::vector<FacetCut> cuts;
+    for (const auto& it : cutsOf) {
+        cuts.insert(cuts.end(), it.begin(), it.end());
     }
-}
+    std::sort(cuts.begin(), cuts.end(), [](const FacetCut& cut1, const FacetCut& cut2) {
+        return std::make_pair(cut1.facet1, cut1.facet2) < std::make_pair(cut2.facet1, cut2.facet2);
+    });
 
-void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
-{
-    // Triangulate Mesh
-    std::map<FacetIndex, std::list<std::set<MeshPoint>::iterator>>::iterator it1;
-    for (it1 = _facet2points[side].begin(); it1 != _facet2points[side].end(); ++it1) {
-        std::vector<Vector3f> points;
-        std::set<MeshPoint> pointsSet;
+    for (const auto& cut : cuts) {
+        FacetIndex fidx1 = cut.facet1;
+        FacetIndex fidx2 = cut.facet2;
+        const MeshPoint& mp0 = cut.mp0;
+        const MeshPoint& mp1 = cut.mp1;
 
-        FacetIndex fidx = it1->first;
-        MeshGeomFacet f = cutMesh.GetFacet(fidx);
+        if (mp0 != mp1) {
+            facetsCuttingEdge0.insert(fidx1);
+            facetsCuttingEdge1.insert(fidx2);
 
-        // if (side == 1)
-        //     _builder.addSingleTriangle(f._aclPoints[0], f._aclPoints[1], f._aclPoints[2], 3, 0,
-        //     1, 1);
-
-        // facet corner points
-        // const MeshFacet& mf = cutMesh._aclFacetArray[fidx];
-        for (int i = 0; i < 3; i++)  // NOLINT
-        {
-            pointsSet.insert(f._aclPoints[i]);
-            points.push_back(f._aclPoints[i]);
+            std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+            std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
+
+            _edges[Edge(mp0, mp1)] = EdgeInfo();
+
+            _facet2points[0][fidx1].push_back(pit0.first);
+            _facet2points[0][fidx1].push_back(pit1.first);
+            _facet2points[1][fidx2].push_back(pit0.first);
+            _facet2points[1][fidx2].push_back(pit1.first);
         }
+        else {
+            std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+            // do not insert a facet when only one corner point cuts the
+            // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
+            // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
+            {
+                facetsCuttingEdge0.insert(fidx1);
+                _facet2points[0][fidx1].push_back(pit.first);
+            }
 
-        // triangulated facets
-        std::list<std::set<MeshPoint>::iterator>::iterator it2;
-        for (it2 = it1->second.begin(); it2 != it1->second.end(); ++it2) {
-            if (pointsSet.find(*(*it2)) == pointsSet.end()) {
-                pointsSet.insert(*(*it2));
-                points.push_back(*(*it2));
+            // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
+            // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
+            {
+                facetsCuttingEdge1.insert(fidx2);
+                _facet2points[1][fidx2].push_back(pit.first);
             }
         }
+    }
+}
 
-        Vector3f normal = f.GetNormal();
-        Vector3f base = points[0];
-        Vector3f dirX = points[1] - points[0];
-        dirX.Normalize();
-        Vector3f dirY = dirX % normal;
-
-        // project points to 2D plane
-        std::vector<Vector3f>::iterator it;
-        std::vector<Vector3f> vertices;
-        for (it = points.begin(); it != points.end(); ++it) {
-            Vector3f pv = *it;
-            pv.TransformToCoordinateSystem(base, dirX, dirY);
-            vertices.push_back(pv);
+std::vector<MeshGeomFacet>
+SetOperations::TriangulateFacet(const MeshGeomFacet& f,
+                                const std::list<std::set<MeshPoint>::iterator>& cutPoints) const
+{
+    std::vector<MeshGeomFacet> newFacets;
+    std::vector<Vector3f> points;
+    std::set<MeshPoint> pointsSet;
+
+    // if (side == 1)
+    //     _builder.addSingleTriangle(f._aclPoints[0], f._aclPoints[1], f._aclPoints[2], 3, 0,
+    //     1, 1);
+
+    // facet corner points
+    // const MeshFacet& mf = cutMesh._aclFacetArray[fidx];
+    for (int i = 0; i < 3; i++)  // NOLINT
+    {
+        pointsSet.insert(f._aclPoints[i]);
+        points.push_back(f._aclPoints[i]);
+    }
+
+    // triangulated facets
+    for (auto it2 = cutPoints.begin(); it2 != cutPoints.end(); ++it2) {
+        if (pointsSet.find(*(*it2)) == pointsSet.end()) {
+            pointsSet.insert(*(*it2));
+            points.push_back(*(*it2));
         }
+    }
 
-        DelaunayTriangulator tria;
-        tria.SetPolygon(vertices);
-        tria.TriangulatePolygon();
+    Vector3f normal = f.GetNormal();
+    Vector3f base = points[0];
+    Vector3f dirX = points[1] - points[0];
+    dirX.Normalize();
+    Vector3f dirY = dirX % normal;
+
+    // project points to 2D plane
+    std::vector<Vector3f>::iterator it;
+    std::vector<Vector3f> vertices;
+    for (it = points.begin(); it != points.end(); ++it) {
+        Vector3f pv = *it;
+        pv.TransformToCoordinateSystem(base, dirX, dirY);
+        vertices.push_back(pv);
+    }
 
-        std::vector<MeshFacet> facets = tria.GetFacets();
-        for (auto& it : facets) {
-            if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
-                || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
-                continue;
-            }
+    DelaunayTriangulator tria;
+    tria.SetPolygon(vertices);
+    tria.TriangulatePolygon();
 
-            MeshGeomFacet facet(points[it._aulPoints[0]],
-                                points[it._aulPoints[1]],
-                                points[it._aulPoints[2]]);
-
-            // if (side == 1)
-            //  _builder.addSingleTriangle(facet._aclPoints[0], facet._aclPoints[1],
-            //  facet._aclPoints[2], true, 3, 0, 1, 1);
-
-            // if (facet.Area() < 0.0001f)
-            //{ // too small facet
-            //   continue;
-            // }
-
-            float dist0 =
-                facet._aclPoints[0].DistanceToLine(facet._aclPoints[1],
-                                                   facet._aclPoints[1] - facet._aclPoints[2]);
-            float dist1 =
-                facet._aclPoints[1].DistanceToLine(facet._aclPoints[0],
-                                                   facet._aclPoints[0] - facet._aclPoints[2]);
-            float dist2 =
-                facet._aclPoints[2].DistanceToLine(facet._aclPoints[0],
-                                                   facet._aclPoints[0] - facet._aclPoints[1]);
-
-            if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
-                || (dist2 < _minDistanceToPoint)) {
-                continue;
-            }
+    std::vector<MeshFacet> facets = tria.GetFacets();
+    for (auto& it : facets) {
+        if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
+            || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
+            continue;
+        }
+
+        MeshGeomFacet facet(points[it._aulPoints[0]],
+                            points[it._aulPoints[1]],
+                            points[it._aulPoints[2]]);
+
+        // if (side == 1)
+        //  _builder.addSingleTriangle(facet._aclPoints[0], facet._aclPoints[1],
+        //  facet._aclPoints[2], true, 3, 0, 1, 1);
+
+        // if (facet.Area() < 0.0001f)
+        //{ // too small facet
+        //   continue;
+        // }
 
-            // dist0 = (facet._aclPoints[0] - facet._aclPoints[1]).Length();
-            // dist1 = (facet._aclPoints[1] - facet._aclPoints[2]).Length();
-            // dist2 = (facet._aclPoints[2] - facet._aclPoints[3]).Length();
+        float dist0 =
+            facet._aclPoints[0].DistanceToLine(facet._aclPoints[1],
+                                               facet._aclPoints[1] - facet._aclPoints[2]);
+        float dist1 =
+            facet._aclPoints[1].DistanceToLine(facet._aclPoints[0],
+                                               facet._aclPoints[0] - facet._aclPoints[2]);
+        float dist2 =
+            facet._aclPoints[2].DistanceToLine(facet._aclPoints[0],
+                                               facet._aclPoints[0] - facet._aclPoints[1]);
+
+        if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
+            || (dist2 < _minDistanceToPoint)) {
+            continue;
+        }
+
+        // dist0 = (facet._aclPoints[0] - facet._aclPoints[1]).Length();
+        // dist1 = (facet._aclPoints[1] - facet._aclPoints[2]).Length();
+        // dist2 = (facet._aclPoints[2] - facet._aclPoints[3]).Length();
 
-            // if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint) || (dist2 <
-            // _minDistanceToPoint))
-            //{
-            //   continue;
-            // }
+        // if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint) || (dist2 <
+        // _minDistanceToPoint))
+        //{
+        //   continue;
+        // }
 
+        facet.CalcNormal();
+        if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
+            std::swap(facet._aclPoints[0], facet._aclPoints[1]);
             facet.CalcNormal();
-            if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
-                std::swap(facet._aclPoints[0], facet._aclPoints[1]);
-                facet.CalcNormal();
-            }
+        }
 
+        newFacets.push_back(facet);
+    }
+
+    return newFacets;
+}
+
+void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
+{
+    // Triangulate Mesh, the facets are independent of each other
+    using CutPoints = std::map<FacetIndex, std::list<std::set<MeshPoint>::iterator>>;
+    std::vector<CutPoints::iterator> cutFacets;
+    for (auto it1 = _facet2points[side].begin(); it1 != _facet2points[side].end(); ++it1) {
+        cutFacets.push_back(it1);
+    }
+
+    std::vector<std::vector<MeshGeomFacet>> newFacets(cutFacets.size());
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, cutFacets.size() / 1000));
+    std::size_t chunk = (cutFacets.size() + threads - 1) / threads;
+    auto triangulate = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            newFacets[i] =
+                TriangulateFacet(cutMesh.GetFacet(cutFacets[i]->first), cutFacets[i]->second);
+        }
+    };
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < threads; t++) {
+        futures.push_back(std::async(std::launch::async,
+                                     triangulate,
+                                     t * chunk,
+                                     std::min(cutFacets.size(), (t + 1) * chunk)));
+    }
+    triangulate(0, std::min(cutFacets.size(), chunk));
+    for (auto& future : futures) {
+        future.get();
+    }
 
+    // register the new facets at the cut edges
+    for (std::size_t i = 0; i < cutFacets.size(); i++) {
+        FacetIndex fidx = cutFacets[i]->first;
+        for (auto& facet : newFacets[i]) {
             for (int j = 0; j < 3; j++) {
                 auto eit = _edges.find(Edge(facet._aclPoints[j], facet._aclPoints[(j + 1) % 3]));
 
@@ -22,7 +22,11 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
+#include <future>
+#include <iterator>
+#include <thread>
 #endif
 
 #include <Base/Tools.h>
@@ -49,219 +53,210 @@ void AbstractSmoothing::initialize(Component comp, Continuity cont)
     this->continuity = cont;
 }
 
+void AbstractSmoothing::PointBuffer::Load(const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    x.resize(points.size());
+    y.resize(points.size());
+    z.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+}
+
+void AbstractSmoothing::PointBuffer::Store(MeshKernel& kernel) const
+{
+    for (std::size_t i = 0; i < x.size(); i++) {
+        kernel.SetPoint(i, x[i], y[i], z[i]);
+    }
+}
+
+void AbstractSmoothing::ParallelFor(std::size_t count,
+                                    const std::function<void(std::size_t, std::size_t)>& func)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / 10000));
+    std::size_t chunk = (count + threads - 1) / threads;
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < threads; t++) {
+        futures.push_back(std::async(std::launch::async,
+                                     func,
+                                     t * chunk,
+                                     std::min(count, (t + 1) * chunk)));
+    }
+    func(0, std::min(count, chunk));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
 void PlaneFitSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
-
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
-
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
-
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
-
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
-
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
-
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
-    }
+    std::vector<PointIndex> point_indices(kernel.CountPoints());
+    std::generate(point_indices.begin(), point_indices.end(), Base::iotaGen<PointIndex>(0));
+    SmoothPoints(iterations, point_indices);
 }
 
 void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
                                      const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
     MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
 
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (PointIndex it : point_indices) {
-            v_it.Set(it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
+    PointBuffer src;
+    src.Load(kernel);
+    PointBuffer dst = src;
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+    for (unsigned int i = 0; i < iterations; i++) {
+        ParallelFor(point_indices.size(), [&](std::size_t begin, std::size_t end) {
+            Base::Vector3f N, L;
+            for (std::size_t j = begin; j < end; j++) {
+                PointIndex it = point_indices[j];
+                MeshIndexList cv = vv_it[it];
+                if (cv.size() < 3) {
+                    continue;
+                }
 
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
+                Base::Vector3f point(src.x[it], src.y[it], src.z[it]);
+                MeshCore::PlaneFit pf;
+                pf.AddPoint(point);
+                Base::Vector3f center = point;
+                for (PointIndex cv_it : cv) {
+                    Base::Vector3f neighbour(src.x[cv_it], src.y[cv_it], src.z[cv_it]);
+                    pf.AddPoint(neighbour);
+                    center += neighbour;
+                }
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+                float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
+                center.Scale(scale, scale, scale);
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+                // get the mean plane of the current vertex with the surrounding vertices
+                pf.Fit();
+                N = pf.GetNormal();
+                N.Normalize();
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+                // look in which direction we should move the vertex
+                L = point - center;
+                if (N * L < 0.0F) {
+                    N.Scale(-1.0, -1.0, -1.0);
+                }
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+                // maximum value to move is distance to mean plane
+                float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
+                N.Scale(d, d, d);
 
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+                dst.x[it] = point.x - N.x;
+                dst.y[it] = point.y - N.y;
+                dst.z[it] = point.z - N.z;
+            }
+        });
+        std::swap(src, dst);
     }
+
+    src.Store(kernel);
 }
 
 LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
+std::vector<PointIndex>
+LaplaceSmoothing::MovablePoints(const MeshRefPointToPoints& vv_it,
                                 const MeshRefPointToFacets& vf_it,
-                                double stepsize)
+                                const std::vector<PointIndex>* point_indices) const
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
-
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+    auto isMovable = [&](PointIndex pos) {
+        std::size_t n_count = vv_it[pos].size();
+        // do nothing for border points
+        return n_count >= 3 && n_count == vf_it[pos].size();
+    };
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
+    std::vector<PointIndex> indices;
+    if (point_indices) {
+        std::copy_if(point_indices->begin(),
+                     point_indices->end(),
+                     std::back_inserter(indices),
+                     isMovable);
+    }
+    else {
+        for (PointIndex pos = 0; pos < kernel.CountPoints(); pos++) {
+            if (isMovable(pos)) {
+                indices.push_back(pos);
+            }
         }
-
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
     }
+    return indices;
 }
 
 void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
+                                const std::vector<PointIndex>& indices,
                                 double stepsize,
-                                const std::vector<PointIndex>& point_indices)
+                                const PointBuffer& src,
+                                PointBuffer& dst)
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+    ParallelFor(indices.size(), [&](std::size_t begin, std::size_t end) {
+        const float* px = src.x.data();
+        const float* py = src.y.data();
+        const float* pz = src.z.data();
+        for (std::size_t i = begin; i < end; i++) {
+            PointIndex pos = indices[i];
+            MeshIndexList cv = vv_it[pos];
+
+            double x = px[pos];
+            double y = py[pos];
+            double z = pz[pos];
+            double sumx = 0.0, sumy = 0.0, sumz = 0.0;
+            for (PointIndex cv_it : cv) {
+                sumx += px[cv_it];
+                sumy += py[cv_it];
+                sumz += pz[cv_it];
+            }
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
+            double w = stepsize / double(cv.size());
+            dst.x[pos] = static_cast<float>(x + w * (sumx - double(cv.size()) * x));
+            dst.y[pos] = static_cast<float>(y + w * (sumy - double(cv.size()) * y));
+            dst.z[pos] = static_cast<float>(z + w * (sumz - double(cv.size()) * z));
         }
-
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
-    }
+    });
 }
 
-void LaplaceSmoothing::Smooth(unsigned int iterations)
+void LaplaceSmoothing::SmoothSteps(unsigned int iterations,
+                                   const std::vector<double>& stepsizes,
+                                   const std::vector<PointIndex>* point_indices)
 {
     MeshCore::MeshRefPointToPoints vv_it(kernel);
     MeshCore::MeshRefPointToFacets vf_it(kernel);
+    std::vector<PointIndex> indices = MovablePoints(vv_it, vf_it, point_indices);
+
+    PointBuffer src;
+    src.Load(kernel);
+    PointBuffer dst = src;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        for (double stepsize : stepsizes) {
+            Umbrella(vv_it, indices, stepsize, src, dst);
+            std::swap(src, dst);
+        }
     }
+
+    src.Store(kernel);
+}
+
+void LaplaceSmoothing::Smooth(unsigned int iterations)
+{
+    SmoothSteps(iterations, {lambda}, nullptr);
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
                                     const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
-    for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
-    }
+    SmoothSteps(iterations, {lambda}, &point_indices);
 }
 
 TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
@@ -270,29 +265,17 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
-    for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
-    }
+    SmoothSteps(iterations, {GetLambda(), -(GetLambda() + micro)}, nullptr);
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations,
                                    const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
-    for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
-    }
+    SmoothSteps(iterations, {GetLambda(), -(GetLambda() + micro)}, &point_indices);
 }
 
 namespace
@@ -329,12 +312,7 @@ void MedianFilterSmoothing::Smooth(unsigned int iterations)
 {
     std::vector<unsigned long> point_indices(kernel.CountPoints());
     std::generate(point_indices.begin(), point_indices.end(), Base::iotaGen<unsigned long>(0));
-    MeshCore::MeshRefFacetToFacets ff_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
-    for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
-    }
+    SmoothPoints(iterations, point_indices);
 }
 
 void MedianFilterSmoothing::SmoothPoints(unsigned int iterations,
@@ -343,78 +321,84 @@ void MedianFilterSmoothing::SmoothPoints(unsigned int iterations,
     MeshCore::MeshRefFacetToFacets ff_it(kernel);
     MeshCore::MeshRefPointToFacets vf_it(kernel);
 
+    std::vector<Base::Vector3d> faceNormals(kernel.CountFacets());
+    std::vector<Base::Vector3f> newPoints(point_indices.size());
     for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
+        UpdatePoints(ff_it, vf_it, point_indices, faceNormals, newPoints);
     }
 }
 
 void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
                                          const MeshRefPointToFacets& vf_it,
-                                         const std::vector<PointIndex>& point_indices)
+                                         const std::vector<PointIndex>& point_indices,
+                                         std::vector<Base::Vector3d>& faceNormals,
+                                         std::vector<Base::Vector3f>& newPoints)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
     const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
-
-    // Initialize the array with the real normals
-    std::vector<Base::Vector3d> faceNormals;
-    faceNormals.reserve(facets.size());
-    MeshCore::MeshFacetIterator iter(kernel);
-    for (iter.Init(); iter.More(); iter.Next()) {
-        faceNormals.emplace_back(Base::toVector<double>(iter->GetNormal()));
-    }
+    const MeshKernel& rKernel = kernel;
 
     // Step 1: determine face normals
-    for (FacetIndex pos = 0; pos < facets.size(); pos++) {
-        iter.Set(pos);
-        Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
-        const MeshCore::MeshFacet& facet = facets[pos];
-
+    ParallelFor(facets.size(), [&](std::size_t begin, std::size_t end) {
         std::vector<AngleNormal> anglesWithFaces;
-        for (auto fi : cv) {
-            iter.Set(fi);
-            Base::Vector3d faceNormal = Base::toVector<double>(iter->GetNormal());
-            double angle = refNormal.GetAngle(faceNormal);
-
-            int absWeight = std::abs(weights);
-            if (absWeight > 1 && facet.IsNeighbour(fi)) {
-                if (weights < 0) {
-                    angle = -angle;
+        for (FacetIndex pos = begin; pos < end; pos++) {
+            Base::Vector3d refNormal = Base::toVector<double>(rKernel.GetFacet(pos).GetNormal());
+            MeshIndexList cv = ff_it[pos];
+            const MeshCore::MeshFacet& facet = facets[pos];
+
+            anglesWithFaces.clear();
+            for (auto fi : cv) {
+                Base::Vector3d faceNormal =
+                    Base::toVector<double>(rKernel.GetFacet(fi).GetNormal());
+                double angle = refNormal.GetAngle(faceNormal);
+
+                int absWeight = std::abs(weights);
+                if (absWeight > 1 && facet.IsNeighbour(fi)) {
+                    if (weights < 0) {
+                        angle = -angle;
+                    }
+                    for (int i = 0; i < absWeight; i++) {
+                        anglesWithFaces.emplace_back(angle, faceNormal);
+                    }
                 }
-                for (int i = 0; i < absWeight; i++) {
+                else {
                     anglesWithFaces.emplace_back(angle, faceNormal);
                 }
             }
-            else {
-                anglesWithFaces.emplace_back(angle, faceNormal);
-            }
+
+            faceNormals[pos] = find_median(anglesWithFaces);
         }
+    });
 
-        faceNormals[pos] = find_median(anglesWithFaces);
-    }
+    // Step 2: move vertices, all of them from their old position
+    ParallelFor(point_indices.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            PointIndex pos = point_indices[i];
+            Base::Vector3d P = Base::toVector<double>(points[pos]);
+            MeshIndexList cv = vf_it[pos];
 
-    // Step 2: move vertices
-    for (auto pos : point_indices) {
-        Base::Vector3d P = Base::toVector<double>(points[pos]);
-        const std::set<FacetIndex>& cv = vf_it[pos];
+            double totalArea = 0.0;
+            Base::Vector3d totalvT;
+            for (auto it : cv) {
+                MeshGeomFacet face = rKernel.GetFacet(it);
 
-        double totalArea = 0.0;
-        Base::Vector3d totalvT;
-        for (auto it : cv) {
-            iter.Set(it);
+                double faceArea = face.Area();
+                totalArea += faceArea;
 
-            double faceArea = iter->Area();
-            totalArea += faceArea;
+                Base::Vector3d C = Base::toVector<double>(face.GetGravityPoint());
 
-            Base::Vector3d C = Base::toVector<double>(iter->GetGravityPoint());
+                Base::Vector3d PC = C - P;
+                Base::Vector3d mT = faceNormals[it];
+                Base::Vector3d vT = (PC * mT) * mT;
+                totalvT += vT * faceArea;
+            }
 
-            Base::Vector3d PC = C - P;
-            Base::Vector3d mT = faceNormals[it];
-            Base::Vector3d vT = (PC * mT) * mT;
-            totalvT += vT * faceArea;
+            P = P + totalvT / totalArea;
+            newPoints[i] = Base::toVector<float>(P);
         }
+    });
 
-        P = P + totalvT / totalArea;
-        kernel.SetPoint(pos, Base::toVector<float>(P));
+    for (std::size_t i = 0; i < point_indices.size(); i++) {
+        kernel.SetPoint(point_indices[i], newPoints[i]);
     }
 }
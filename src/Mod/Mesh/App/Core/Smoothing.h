@@ -23,9 +23,12 @@
 #ifndef MESH_SMOOTHING_H
 #define MESH_SMOOTHING_H
 
+#include <functional>
 #include <limits>
 #include <vector>
 
+#include <Base/Vector3D.h>
+
 #include "Definitions.h"
 
 
@@ -67,6 +70,26 @@ public:
     virtual void Smooth(unsigned int) = 0;
     virtual void SmoothPoints(unsigned int, const std::vector<PointIndex>&) = 0;
 
+protected:
+    /** The point coordinates in separate arrays. The smoothing steps read the positions of
+     * one buffer and write the new positions to another one, so that all points are moved
+     * at once and the points can be processed in parallel.
+     */
+    struct PointBuffer
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+
+        void Load(const MeshKernel&);
+        void Store(MeshKernel&) const;
+    };
+
+    /** Splits [0, count) into ranges and calls \a func with the begin and end of each
+     * range in parallel. */
+    static void ParallelFor(std::size_t count,
+                            const std::function<void(std::size_t, std::size_t)>& func);
+
 protected:
     // NOLINTBEGIN
     MeshKernel& kernel;
@@ -107,11 +130,23 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
-                  double,
-                  const std::vector<PointIndex>&);
+    /** Applies the step sizes one after the other in every iteration. If \a point_indices
+     * is null all points are smoothed. */
+    void SmoothSteps(unsigned int iterations,
+                     const std::vector<double>& stepsizes,
+                     const std::vector<PointIndex>* point_indices);
+    /** Returns the points that can be moved, i.e. all except border points and points
+     * with less than three neighbours. */
+    std::vector<PointIndex> MovablePoints(const MeshRefPointToPoints&,
+                                          const MeshRefPointToFacets&,
+                                          const std::vector<PointIndex>* point_indices) const;
+    /** Moves the points \a indices of \a src by \a stepsize times their umbrella vector
+     * and writes them to \a dst. */
+    static void Umbrella(const MeshRefPointToPoints&,
+                         const std::vector<PointIndex>& indices,
+                         double stepsize,
+                         const PointBuffer& src,
+                         PointBuffer& dst);
 
 private:
     double lambda {0.6307};
@@ -151,7 +186,9 @@ public:
 private:
     void UpdatePoints(const MeshRefFacetToFacets&,
                       const MeshRefPointToFacets&,
-                      const std::vector<PointIndex>&);
+                      const std::vector<PointIndex>&,
+                      std::vector<Base::Vector3d>& faceNormals,
+                      std::vector<Base::Vector3f>& newPoints);
 
 private:
     int weights {1};
@@ -24,10 +24,10 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <thread>
 #endif
 
-#include <Base/Sequencer.h>
-
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "Trim.h"
@@ -35,6 +35,15 @@
 
 using namespace MeshCore;
 
+namespace
+{
+std::size_t blockCount(std::size_t count)
+{
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    return std::min(hardware, std::max<std::size_t>(1, count / 10000));
+}
+}  // namespace
+
 MeshTrimming::MeshTrimming(MeshKernel& mesh,
                            const Base::ViewProjMethod* proj,
                            const Base::Polygon2d& poly)
@@ -58,8 +67,22 @@ void MeshTrimming::SetInnerOrOuter(TMode tMode)
 void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
                                std::vector<FacetIndex>& raulFacets) const
 {
-    std::vector<FacetIndex>::iterator it;
-    MeshFacetIterator clIter(myMesh, 0);
+    // the candidates are tested in parallel, the blocks are joined in order to keep them sorted
+    auto checkElements = [this, &raulFacets](std::size_t count, auto&& element) {
+        std::size_t blocks = blockCount(count);
+        std::vector<std::vector<FacetIndex>> parts(blocks);
+        parallel_blocks(count, blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; index++) {
+                FacetIndex facet = element(index);
+                if (HasIntersection(myMesh.GetFacet(facet))) {
+                    parts[b].push_back(facet);
+                }
+            }
+        });
+        for (const auto& part : parts) {
+            raulFacets.insert(raulFacets.end(), part.begin(), part.end());
+        }
+    };
 
     // cut inner: use grid to accelerate search
     if (myInner) {
@@ -85,25 +108,15 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
         aulAllElements.erase(std::unique(aulAllElements.begin(), aulAllElements.end()),
                              aulAllElements.end());
 
-        Base::SequencerLauncher seq("Check facets for intersection...", aulAllElements.size());
-
-        for (it = aulAllElements.begin(); it != aulAllElements.end(); ++it) {
-            MeshGeomFacet clFacet = myMesh.GetFacet(*it);
-            if (HasIntersection(clFacet)) {
-                raulFacets.push_back(*it);
-            }
-            seq.next();
-        }
+        checkElements(aulAllElements.size(), [&aulAllElements](std::size_t index) {
+            return aulAllElements[index];
+        });
     }
     // cut outer
     else {
-        Base::SequencerLauncher seq("Check facets for intersection...", myMesh.CountFacets());
-        for (clIter.Init(); clIter.More(); clIter.Next()) {
-            if (HasIntersection(*clIter)) {
-                raulFacets.push_back(clIter.Position());
-            }
-            seq.next();
-        }
+        checkElements(myMesh.CountFacets(), [](std::size_t index) {
+            return FacetIndex(index);
+        });
     }
 }
 
@@ -772,31 +785,43 @@ bool MeshTrimming::CreateFacets(FacetIndex ulFacetPos,
 void MeshTrimming::TrimFacets(const std::vector<FacetIndex>& raulFacets,
                               std::vector<MeshGeomFacet>& aclNewFacets)
 {
-    Base::Vector3f clP;
-    std::vector<Base::Vector3f> clIntsct;
-    int iSide {};
-
-    Base::SequencerLauncher seq("trimming facets...", raulFacets.size());
-    for (FacetIndex index : raulFacets) {
-        clIntsct.clear();
-        if (!IsPolygonPointInFacet(index, clP)) {
-            // facet must be trimmed
-            if (!PolygonContainsCompleteFacet(myInner, index)) {
-                // generate new facets
-                if (GetIntersectionPointsOfPolygonAndFacet(index, iSide, clIntsct)) {
-                    CreateFacets(index, iSide, clIntsct, myTriangles);
-                }
-            }
-        }
-        // facet contains a polygon point
-        else {
-            // generate new facets
-            if (GetIntersectionPointsOfPolygonAndFacet(index, iSide, clIntsct)) {
-                CreateFacets(index, iSide, clIntsct, clP, myTriangles);
-            }
-        }
-        seq.next();
-    }
+    // every facet is only touched by its own block, the new triangles are joined in order
+    std::size_t blocks = blockCount(raulFacets.size());
+    std::vector<std::vector<MeshGeomFacet>> parts(blocks);
+    parallel_blocks(raulFacets.size(),
+                    blocks,
+                    [&](std::size_t b, std::size_t begin, std::size_t end) {
+                        Base::Vector3f clP;
+                        std::vector<Base::Vector3f> clIntsct;
+                        int iSide {};
+                        for (std::size_t pos = begin; pos < end; pos++) {
+                            FacetIndex index = raulFacets[pos];
+                            clIntsct.clear();
+                            if (!IsPolygonPointInFacet(index, clP)) {
+                                // facet must be trimmed
+                                if (!PolygonContainsCompleteFacet(myInner, index)) {
+                                    // generate new facets
+                                    if (GetIntersectionPointsOfPolygonAndFacet(index,
+                                                                               iSide,
+                                                                               clIntsct)) {
+                                        CreateFacets(index, iSide, clIntsct, parts[b]);
+                                    }
+                                }
+                            }
+                            // facet contains a polygon point
+                            else {
+                                // generate new facets
+                                if (GetIntersectionPointsOfPolygonAndFacet(index,
+                                                                           iSide,
+                                                                           clIntsct)) {
+                                    CreateFacets(index, iSide, clIntsct, clP, parts[b]);
+                                }
+                            }
+                        }
+                    });
 
+    for (const auto& part : parts) {
+        myTriangles.insert(myTriangles.end(), part.begin(), part.end());
+    }
     aclNewFacets = myTriangles;
 }
@@ -23,8 +23,13 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #endif
 
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "TrimByPlane.h"
@@ -32,6 +37,28 @@
 
 using namespace MeshCore;
 
+namespace
+{
+std::size_t blockCount(std::size_t count)
+{
+    std::size_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    return std::min(hardware, std::max<std::size_t>(1, count / 10000));
+}
+
+struct EdgeHash
+{
+    std::size_t operator()(const std::pair<PointIndex, PointIndex>& edge) const
+    {
+        return std::hash<PointIndex>()(edge.first) * 31 + std::hash<PointIndex>()(edge.second);
+    }
+};
+
+std::pair<PointIndex, PointIndex> makeEdge(PointIndex p1, PointIndex p2)
+{
+    return p1 < p2 ? std::make_pair(p1, p2) : std::make_pair(p2, p1);
+}
+}  // namespace
+
 MeshTrimByPlane::MeshTrimByPlane(MeshKernel& mesh)
     : myMesh(mesh)
 {}
@@ -176,3 +203,171 @@ void MeshTrimByPlane::TrimFacets(const std::vector<FacetIndex>& trimFacets,
         }
     }
 }
+
+void MeshTrimByPlane::Trim(const Base::Vector3f& base,
+                           const Base::Vector3f& normal,
+                           std::vector<FacetIndex>& removeFacets)
+{
+    const MeshPointArray& points = myMesh.GetPoints();
+    const MeshFacetArray& facets = myMesh.GetFacets();
+    std::size_t numPoints = points.size();
+    std::size_t numFacets = facets.size();
+
+    // the distance is computed once per point so that adjacent facets agree on every edge
+    std::vector<float> dist(numPoints);
+    parallel_blocks(numPoints,
+                    blockCount(numPoints),
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t index = begin; index < end; index++) {
+                            dist[index] = points[index].DistanceToPlane(base, normal);
+                        }
+                    });
+
+    // facets without a point above the plane are kept, facets without a point below are removed
+    struct Classes
+    {
+        std::vector<FacetIndex> keep;
+        std::vector<FacetIndex> split;
+    };
+    std::size_t blocks = blockCount(numFacets);
+    std::vector<Classes> parts(blocks);
+    parallel_blocks(numFacets, blocks, [&](std::size_t b, std::size_t begin, std::size_t end) {
+        Classes& part = parts[b];
+        for (FacetIndex index = begin; index < end; index++) {
+            bool below = false;
+            bool above = false;
+            for (PointIndex point : facets[index]._aulPoints) {
+                below = below || dist[point] < 0.0F;
+                above = above || dist[point] > 0.0F;
+            }
+            if (!above) {
+                part.keep.push_back(index);
+            }
+            else if (below) {
+                part.split.push_back(index);
+            }
+        }
+    });
+
+    std::vector<FacetIndex> keepFacets;
+    std::vector<FacetIndex> splitFacets;
+    for (const auto& part : parts) {
+        keepFacets.insert(keepFacets.end(), part.keep.begin(), part.keep.end());
+        splitFacets.insert(splitFacets.end(), part.split.begin(), part.split.end());
+    }
+
+    // every cut edge gets exactly one new point, appended after the existing points
+    std::unordered_map<std::pair<PointIndex, PointIndex>, PointIndex, EdgeHash> cutPoints;
+    std::vector<std::pair<PointIndex, PointIndex>> cutEdges;
+    for (FacetIndex index : splitFacets) {
+        const MeshFacet& face = facets[index];
+        for (int i = 0; i < 3; i++) {
+            PointIndex p1 = face._aulPoints[i];
+            PointIndex p2 = face._aulPoints[(i + 1) % 3];
+            if ((dist[p1] < 0.0F && dist[p2] > 0.0F) || (dist[p1] > 0.0F && dist[p2] < 0.0F)) {
+                auto edge = makeEdge(p1, p2);
+                if (cutPoints.emplace(edge, numPoints + cutEdges.size()).second) {
+                    cutEdges.push_back(edge);
+                }
+            }
+        }
+    }
+
+    MeshPointArray newPoints(cutEdges.size());
+    parallel_blocks(cutEdges.size(),
+                    blockCount(cutEdges.size()),
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t index = begin; index < end; index++) {
+                            auto [p1, p2] = cutEdges[index];
+                            float t = dist[p1] / (dist[p1] - dist[p2]);
+                            newPoints[index] = points[p1] + t * (points[p2] - points[p1]);
+                        }
+                    });
+
+    // clip each split facet to the part below the plane and triangulate it as a fan
+    std::size_t splitBlocks = blockCount(splitFacets.size());
+    std::vector<MeshFacetArray> splitParts(splitBlocks);
+    parallel_blocks(splitFacets.size(),
+                    splitBlocks,
+                    [&](std::size_t b, std::size_t begin, std::size_t end) {
+                        MeshFacetArray& part = splitParts[b];
+                        for (std::size_t index = begin; index < end; index++) {
+                            const MeshFacet& face = facets[splitFacets[index]];
+                            std::array<PointIndex, 4> poly {};
+                            int count = 0;
+                            for (int i = 0; i < 3; i++) {
+                                PointIndex p1 = face._aulPoints[i];
+                                PointIndex p2 = face._aulPoints[(i + 1) % 3];
+                                if (dist[p1] <= 0.0F) {
+                                    poly[count++] = p1;
+                                }
+                                if ((dist[p1] < 0.0F && dist[p2] > 0.0F)
+                                    || (dist[p1] > 0.0F && dist[p2] < 0.0F)) {
+                                    poly[count++] = cutPoints.find(makeEdge(p1, p2))->second;
+                                }
+                            }
+
+                            MeshFacet facet(face);
+                            facet._aulNeighbours[0] = FACET_INDEX_MAX;
+                            facet._aulNeighbours[1] = FACET_INDEX_MAX;
+                            facet._aulNeighbours[2] = FACET_INDEX_MAX;
+                            for (int i = 2; i < count; i++) {
+                                facet._aulPoints[0] = poly[0];
+                                facet._aulPoints[1] = poly[i - 1];
+                                facet._aulPoints[2] = poly[i];
+                                part.push_back(facet);
+                            }
+                        }
+                    });
+
+    MeshFacetArray newFacets;
+    newFacets.reserve(keepFacets.size() + 2 * splitFacets.size());
+    for (FacetIndex index : keepFacets) {
+        newFacets.push_back(facets[index]);
+    }
+    for (const auto& part : splitParts) {
+        newFacets.insert(newFacets.end(), part.begin(), part.end());
+    }
+
+    // drop the points that are only referenced by removed facets
+    std::vector<bool> used(numPoints + newPoints.size(), false);
+    for (const auto& facet : newFacets) {
+        for (PointIndex point : facet._aulPoints) {
+            used[point] = true;
+        }
+    }
+
+    std::vector<PointIndex> pointMap(used.size(), POINT_INDEX_MAX);
+    MeshPointArray finalPoints;
+    finalPoints.reserve(used.size());
+    for (PointIndex index = 0; index < used.size(); index++) {
+        if (used[index]) {
+            pointMap[index] = finalPoints.size();
+            finalPoints.push_back(index < numPoints ? points[index] : newPoints[index - numPoints]);
+        }
+    }
+
+    parallel_blocks(newFacets.size(),
+                    blockCount(newFacets.size()),
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t index = begin; index < end; index++) {
+                            for (PointIndex& point : newFacets[index]._aulPoints) {
+                                point = pointMap[point];
+                            }
+                        }
+                    });
+
+    removeFacets.clear();
+    removeFacets.reserve(numFacets - keepFacets.size());
+    std::size_t pos = 0;
+    for (FacetIndex index = 0; index < numFacets; index++) {
+        if (pos < keepFacets.size() && keepFacets[pos] == index) {
+            pos++;
+        }
+        else {
+            removeFacets.push_back(index);
+        }
+    }
+
+    myMesh.Adopt(finalPoints, newFacets, true);
+}
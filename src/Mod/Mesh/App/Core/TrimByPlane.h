@@ -58,6 +58,16 @@ public:
                     const Base::Vector3f& normal,
                     std::vector<MeshGeomFacet>& trimmedFacets);
 
+    /**
+     * Removes the part of the mesh above the plane in one pass and splits the facets crossing it.
+     * The point on a cut edge is shared by the split facets of both sides, so no point merging is
+     * needed afterwards. The kept facets stay in their order, the split parts are appended.
+     *  removeFacets gets the original indices of all removed and split facets.
+     */
+    void Trim(const Base::Vector3f& base,
+              const Base::Vector3f& normal,
+              std::vector<FacetIndex>& removeFacets);
+
 private:
     void CreateOneFacet(const Base::Vector3f& base,
                         const Base::Vector3f& normal,
@@ -309,3 +309,30 @@ App::DocumentObjectExecReturn* RemoveComponents::execute()
 
     return App::DocumentObject::StdReturn;
 }
+
+// ----------------------------------------------------------------------
+
+PROPERTY_SOURCE(Mesh::RepairDefects, Mesh::FixDefects)
+
+RepairDefects::RepairDefects()
+{
+    ADD_PROPERTY(SelfIntersections, (false));
+}
+
+App::DocumentObjectExecReturn* RepairDefects::execute()
+{
+    App::DocumentObject* link = Source.getValue();
+    if (!link) {
+        return new App::DocumentObjectExecReturn("No mesh linked");
+    }
+    App::Property* prop = link->getPropertyByName("Mesh");
+    if (prop && prop->is<Mesh::PropertyMeshKernel>()) {
+        Mesh::PropertyMeshKernel* kernel = static_cast<Mesh::PropertyMeshKernel*>(prop);
+        std::unique_ptr<MeshObject> mesh(new MeshObject);
+        *mesh = kernel->getValue();
+        mesh->repairDefects(static_cast<float>(Epsilon.getValue()), SelfIntersections.getValue());
+        this->Mesh.setValuePtr(mesh.release());
+    }
+
+    return App::DocumentObject::StdReturn;
+}
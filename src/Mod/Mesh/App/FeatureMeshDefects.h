@@ -258,6 +258,26 @@ public:
     //@}
 };
 
+/**
+ * The RepairDefects class analyzes all defect categories at once and repairs them in the order
+ * they depend on each other, instead of chaining the single fix features.
+ */
+class MeshExport RepairDefects: public Mesh::FixDefects
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Mesh::RepairDefects);
+
+public:
+    /// Constructor
+    RepairDefects();
+    App::PropertyBool SelfIntersections;
+
+    /** @name methods override Feature */
+    //@{
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    //@}
+};
+
 }  // namespace Mesh
 
 
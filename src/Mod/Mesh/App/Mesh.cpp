@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <limits>
 #include <sstream>
 #endif
 
@@ -41,7 +42,9 @@
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
+#include "Core/FacetTree.h"
 #include "Core/Grid.h"
+#include "Core/Health.h"
 #include "Core/Info.h"
 #include "Core/Iterator.h"
 #include "Core/MeshKernel.h"
@@ -156,6 +159,7 @@ void MeshObject::getFacesFromSubElement(const Data::Segment* element,
 
 void MeshObject::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    clearFacetTree();
     MeshCore::MeshKernel kernel;
     swap(kernel);
     kernel.Transform(rclMat);
@@ -218,6 +222,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 MeshObject& MeshObject::operator=(const MeshObject& mesh)
 {
     if (this != &mesh) {
+        clearFacetTree();
         // copy the mesh structure
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
@@ -230,6 +235,7 @@ MeshObject& MeshObject::operator=(const MeshObject& mesh)
 MeshObject& MeshObject::operator=(MeshObject&& mesh)
 {
     if (this != &mesh) {
+        clearFacetTree();
         // copy the mesh structure
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
@@ -241,12 +247,14 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
+    clearFacetTree();
     this->_kernel = m;
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
+    clearFacetTree();
     this->_kernel.Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
@@ -255,6 +263,8 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
+    clearFacetTree();
+    mesh.clearFacetTree();
     this->_kernel.Swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp = this->_Mtrx;
@@ -369,7 +379,13 @@ void MeshObject::getFaces(std::vector<Base::Vector3d>& Points,
 
 unsigned int MeshObject::getMemSize() const
 {
-    return _kernel.GetMemSize();
+    std::size_t size = sizeof(MeshObject) + _kernel.GetMemSize();
+    for (const auto& segment : _segments) {
+        size += sizeof(Segment) + segment.getIndices().capacity() * sizeof(FacetIndex);
+        size += segment.getName().capacity() + segment.getColor().capacity();
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void MeshObject::Save(Base::Writer& /*writer*/) const
@@ -379,7 +395,12 @@ void MeshObject::Save(Base::Writer& /*writer*/) const
 
 void MeshObject::SaveDocFile(Base::Writer& writer) const
 {
-    _kernel.Write(writer.Stream());
+    if (writer.getMode("RawKernel")) {
+        _kernel.WriteRaw(writer.Stream());
+    }
+    else {
+        _kernel.Write(writer.Stream());
+    }
 }
 
 void MeshObject::Restore(Base::XMLReader& /*reader*/)
@@ -389,6 +410,7 @@ void MeshObject::Restore(Base::XMLReader& /*reader*/)
 
 void MeshObject::RestoreDocFile(Base::Reader& reader)
 {
+    clearFacetTree();
     load(reader);
 }
 
@@ -452,6 +474,7 @@ void MeshObject::save(std::ostream& str,
 
 bool MeshObject::load(const char* file, MeshCore::Material* mat)
 {
+    clearFacetTree();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadAny(file)) {
@@ -464,6 +487,7 @@ bool MeshObject::load(const char* file, MeshCore::Material* mat)
 
 bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::Material* mat)
 {
+    clearFacetTree();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadFormat(str, f)) {
@@ -476,6 +500,7 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g)
 {
+    clearFacetTree();
     _kernel.Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
@@ -519,6 +544,7 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
+    clearFacetTree();
     _kernel.Read(in);
     this->_segments.clear();
 
@@ -573,16 +599,19 @@ void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
+    clearFacetTree();
     _kernel.AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    clearFacetTree();
     _kernel.AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets, bool checkManifolds)
 {
+    clearFacetTree();
     _kernel.AddFacets(facets, checkManifolds);
 }
 
@@ -590,6 +619,7 @@ void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
+    clearFacetTree();
     _kernel.AddFacets(facets, points, checkManifolds);
 }
 
@@ -597,6 +627,7 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
                            const std::vector<Base::Vector3d>& points,
                            bool checkManifolds)
 {
+    clearFacetTree();
     std::vector<MeshCore::MeshFacet> facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -619,12 +650,14 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    clearFacetTree();
     _kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
                            const std::vector<Base::Vector3d>& points)
 {
+    clearFacetTree();
     MeshCore::MeshFacetArray facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -647,16 +680,19 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
+    clearFacetTree();
     _kernel.Merge(mesh._kernel);
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
+    clearFacetTree();
     _kernel.Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 {
+    clearFacetTree();
     if (removeIndices.empty()) {
         return;
     }
@@ -666,6 +702,7 @@ void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 
 void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
 {
+    clearFacetTree();
     if (removeIndices.empty()) {
         return;
     }
@@ -792,6 +829,21 @@ std::vector<PointIndex> MeshObject::getPointsFromFacets(const std::vector<FacetI
     return _kernel.GetFacetPoints(facets);
 }
 
+std::shared_ptr<const MeshCore::MeshFacetTree> MeshObject::getFacetTree() const
+{
+    std::lock_guard<std::mutex> lock(_treeMutex);
+    if (!_facetTree) {
+        _facetTree = std::make_shared<MeshCore::MeshFacetTree>(_kernel);
+    }
+    return _facetTree;
+}
+
+void MeshObject::clearFacetTree()
+{
+    std::lock_guard<std::mutex> lock(_treeMutex);
+    _facetTree.reset();
+}
+
 bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
                                    double maxAngle,
                                    MeshObject::TFaceSection& output) const
@@ -806,11 +858,12 @@ bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
     inv.multVec(pnt, pnt);
     inv.getRotation().multVec(dir, dir);
 
-    FacetIndex index = 0;
+    // intersections behind the base point count as well
     Base::Vector3f res;
-    MeshCore::MeshAlgorithm alg(getKernel());
+    FacetIndex index =
+        getFacetTree()->NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), res, true);
 
-    if (alg.NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), res, index)) {
+    if (index != MeshCore::FACET_INDEX_MAX) {
         plm.multVec(res, res);
         output.first = index;
         output.second = Base::toVector<double>(res);
@@ -892,6 +945,7 @@ unsigned long MeshObject::countComponents() const
 
 void MeshObject::removeComponents(unsigned long count)
 {
+    clearFacetTree();
     std::vector<FacetIndex> removeIndices;
     MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
     _kernel.DeleteFacets(removeIndices);
@@ -929,6 +983,7 @@ void MeshObject::fillupHoles(unsigned long length,
                              int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
+    clearFacetTree();
     std::list<std::vector<PointIndex>> aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
@@ -936,6 +991,7 @@ void MeshObject::fillupHoles(unsigned long length,
 
 void MeshObject::offset(float fSize)
 {
+    clearFacetTree();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -1015,6 +1071,7 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
+    clearFacetTree();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -1034,6 +1091,7 @@ void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 
 void MeshObject::clear()
 {
+    clearFacetTree();
     _kernel.Clear();
     this->_segments.clear();
     setTransform(Base::Matrix4D());
@@ -1041,6 +1099,7 @@ void MeshObject::clear()
 
 void MeshObject::transformToEigenSystem()
 {
+    clearFacetTree();
     MeshCore::MeshEigensystem cMeshEval(_kernel);
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
@@ -1057,6 +1116,7 @@ Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 
 void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 {
+    clearFacetTree();
     // v is a vector, hence we must not apply the translation part
     // of the transformation to the vector
     Base::Vector3d vec(v);
@@ -1068,23 +1128,27 @@ void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 
 void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 {
+    clearFacetTree();
     _kernel.SetPoint(index, transformPointToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    clearFacetTree();
     _kernel.Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
+    clearFacetTree();
+    MeshCore::MeshDecimation dm(this->_kernel);
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
+    clearFacetTree();
+    MeshCore::MeshDecimation dm(this->_kernel);
     dm.simplify(targetSize);
 }
 
@@ -1115,7 +1179,9 @@ void MeshObject::crossSections(const std::vector<MeshObject::TPlane>& planes,
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(this->_Mtrx);
 
+    // the grid is only searched, and for many planes
     MeshCore::MeshFacetGrid grid(kernel);
+    grid.SetCompactStorage(true);
     MeshCore::MeshAlgorithm algo(kernel);
     for (const auto& plane : planes) {
         MeshObject::TPolylines polylines;
@@ -1128,6 +1194,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj,
                      MeshObject::CutType type)
 {
+    clearFacetTree();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1158,6 +1225,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj,
                       MeshObject::CutType type)
 {
+    clearFacetTree();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1194,9 +1262,9 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
 
 void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
+    clearFacetTree();
     MeshCore::MeshTrimByPlane trim(this->_kernel);
-    std::vector<FacetIndex> trimFacets, removeFacets;
-    std::vector<MeshCore::MeshGeomFacet> triangle;
+    std::vector<FacetIndex> removeFacets;
 
     // Apply the inverted mesh placement to the plane because the trimming is done
     // on the untransformed mesh data
@@ -1206,15 +1274,9 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     meshPlacement.multVec(base, basePlane);
     meshPlacement.getRotation().multVec(normal, normalPlane);
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
-    trim.CheckFacets(meshGrid, basePlane, normalPlane, trimFacets, removeFacets);
-    trim.TrimFacets(trimFacets, basePlane, normalPlane, triangle);
-    if (!removeFacets.empty()) {
-        this->deleteFacets(removeFacets);
-    }
-    if (!triangle.empty()) {
-        this->_kernel.AddFacets(triangle);
-    }
+    // the split facets are appended to the kernel, the segments only lose the removed ones
+    trim.Trim(basePlane, normalPlane, removeFacets);
+    deletedFacets(removeFacets);
 }
 
 MeshObject* MeshObject::unite(const MeshObject& mesh) const
@@ -1338,6 +1400,7 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
+    clearFacetTree();
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1357,6 +1420,7 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshRemoveNeedles eval(_kernel, length);
     eval.Fixup();
@@ -1367,12 +1431,14 @@ void MeshObject::removeNeedles(float length)
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
+    clearFacetTree();
     MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0F) {
         topalg.OptimizeTopology(fMaxAngle);
@@ -1388,12 +1454,14 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
+    clearFacetTree();
     std::vector<std::pair<FacetIndex, FacetIndex>> adjacentFacet;
     MeshCore::MeshAlgorithm alg(_kernel);
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
@@ -1426,24 +1494,28 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(FacetIndex facet, FacetIndex neighbour, const Base::Vector3f& v)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseEdge(facet, neighbour);
 
@@ -1455,6 +1527,7 @@ void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 
 void MeshObject::collapseFacet(FacetIndex facet)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseFacet(facet);
 
@@ -1465,6 +1538,7 @@ void MeshObject::collapseFacet(FacetIndex facet)
 
 void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     for (FacetIndex it : facets) {
         alg.CollapseFacet(it);
@@ -1475,12 +1549,14 @@ void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 
 void MeshObject::insertVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SnapVertex(facet, v);
 }
@@ -1494,12 +1570,14 @@ unsigned long MeshObject::countNonUniformOrientedFacets() const
 
 void MeshObject::flipNormals()
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
+    clearFacetTree();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.HarmonizeNormals();
 }
@@ -1512,6 +1590,7 @@ bool MeshObject::hasNonManifolds() const
 
 void MeshObject::removeNonManifolds()
 {
+    clearFacetTree();
     MeshCore::MeshEvalTopology f_eval(_kernel);
     if (!f_eval.Evaluate()) {
         MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
@@ -1522,6 +1601,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
+    clearFacetTree();
     MeshCore::MeshEvalPointManifolds p_eval(_kernel);
     if (!p_eval.Evaluate()) {
         std::vector<FacetIndex> faces;
@@ -1568,6 +1648,7 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 
 void MeshObject::removeSelfIntersections()
 {
+    clearFacetTree();
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
     MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
     cMeshEval.GetIntersections(selfIntersections);
@@ -1580,6 +1661,7 @@ void MeshObject::removeSelfIntersections()
 
 void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 {
+    clearFacetTree();
     // make sure that the number of indices is even and are in range
     if (indices.size() % 2 != 0) {
         return;
@@ -1612,6 +1694,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 
 void MeshObject::removeFoldsOnSurface()
 {
+    clearFacetTree();
     std::vector<FacetIndex> indices;
     MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
     MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
@@ -1646,6 +1729,7 @@ void MeshObject::removeFoldsOnSurface()
 
 void MeshObject::removeFullBoundaryFacets()
 {
+    clearFacetTree();
     std::vector<FacetIndex> facets;
     if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
         deleteFacets(facets);
@@ -1660,6 +1744,7 @@ bool MeshObject::hasInvalidPoints() const
 
 void MeshObject::removeInvalidPoints()
 {
+    clearFacetTree();
     MeshCore::MeshEvalNaNPoints nan(_kernel);
     deletePoints(nan.GetIndices());
 }
@@ -1672,12 +1757,14 @@ bool MeshObject::hasPointsOnEdge() const
 
 void MeshObject::removePointsOnEdge(bool fillBoundary)
 {
+    clearFacetTree();
     MeshCore::MeshFixPointOnEdge nan(_kernel, fillBoundary);
     nan.Fixup();
 }
 
 void MeshObject::mergeFacets()
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixMergeFacets merge(_kernel);
     merge.Fixup();
@@ -1688,6 +1775,7 @@ void MeshObject::mergeFacets()
 
 void MeshObject::validateIndices()
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
 
     // for invalid neighbour indices we don't need to check first
@@ -1744,6 +1832,7 @@ bool MeshObject::hasCorruptedFacets() const
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDeformedFacets eval(_kernel,
                                          Base::toRadians(15.0F),
@@ -1758,6 +1847,7 @@ void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 
 void MeshObject::validateDegenerations(float fEps)
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
     eval.Fixup();
@@ -1768,6 +1858,7 @@ void MeshObject::validateDegenerations(float fEps)
 
 void MeshObject::removeDuplicatedPoints()
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicatePoints eval(_kernel);
     eval.Fixup();
@@ -1778,6 +1869,7 @@ void MeshObject::removeDuplicatedPoints()
 
 void MeshObject::removeDuplicatedFacets()
 {
+    clearFacetTree();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicateFacets eval(_kernel);
     eval.Fixup();
@@ -1786,6 +1878,23 @@ void MeshObject::removeDuplicatedFacets()
     }
 }
 
+void MeshObject::repairDefects(float fEps, bool selfIntersections)
+{
+    clearFacetTree();
+    MeshCore::MeshEvalHealth eval(_kernel, fEps);
+    eval.SetCheckSelfIntersections(selfIntersections);
+    if (eval.Evaluate()) {
+        return;
+    }
+
+    unsigned long count = _kernel.CountFacets();
+    MeshCore::MeshFixHealth fix(_kernel, eval.GetReport(), fEps);
+    fix.Fixup();
+    if (_kernel.CountFacets() != count) {
+        this->_segments.clear();
+    }
+}
+
 MeshObject* MeshObject::createMeshFromList(Py::List& list)
 {
     std::vector<MeshCore::MeshGeomFacet> facets;
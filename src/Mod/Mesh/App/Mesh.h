@@ -25,6 +25,8 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -58,6 +60,7 @@ class ViewProjMethod;
 namespace MeshCore
 {
 class AbstractPolygonTriangulator;
+class MeshFacetTree;
 }
 
 namespace Mesh
@@ -178,12 +181,19 @@ public:
     void setKernel(const MeshCore::MeshKernel& m);
     MeshCore::MeshKernel& getKernel()
     {
+        // the caller may modify the mesh
+        clearFacetTree();
         return _kernel;
     }
     const MeshCore::MeshKernel& getKernel() const
     {
         return _kernel;
     }
+    /**
+     * Returns a bounding volume hierarchy over the facets of the kernel for ray and
+     * nearest facet queries. It is built on first use and kept until the mesh changes.
+     */
+    std::shared_ptr<const MeshCore::MeshFacetTree> getFacetTree() const;
 
     Base::BoundBox3d getBoundBox() const override;
     bool getCenterOfGravity(Base::Vector3d& center) const override;
@@ -351,6 +361,8 @@ public:
     void mergeFacets();
     bool hasPointsOnEdge() const;
     void removePointsOnEdge(bool fillBoundary);
+    /// Analyzes all defect categories in one pass and repairs them in dependency order
+    void repairDefects(float fEps, bool selfIntersections = false);
     //@}
 
     /** @name Mesh segments */
@@ -466,11 +478,14 @@ private:
     void swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g);
     void copySegments(const MeshObject&);
     void swapSegments(MeshObject&);
+    void clearFacetTree();
 
 private:
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    mutable std::mutex _treeMutex;
+    mutable std::shared_ptr<const MeshCore::MeshFacetTree> _facetTree;
     static const float Epsilon;
 };
 
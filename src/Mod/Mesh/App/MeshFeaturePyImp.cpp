@@ -281,6 +281,26 @@ PyObject* MeshFeaturePy::removeInvalidPoints(PyObject* args)
     Py_Return;
 }
 
+PyObject* MeshFeaturePy::repairDefects(PyObject* args)
+{
+    float fEpsilon = MeshCore::MeshDefinitions::_fMinPointDistanceP2;
+    PyObject* self = Py_False;
+    if (!PyArg_ParseTuple(args, "|fO!", &fEpsilon, &PyBool_Type, &self)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        Mesh::Feature* obj = getFeaturePtr();
+        MeshObject* kernel = obj->Mesh.startEditing();
+        kernel->repairDefects(fEpsilon, Base::asBoolean(self));
+        obj->Mesh.finishEditing();
+    }
+    PY_CATCH;
+
+    Py_Return;
+}
+
 PyObject* MeshFeaturePy::getCustomAttributes(const char* /*attr*/) const
 {
     return nullptr;
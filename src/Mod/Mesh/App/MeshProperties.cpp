@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#endif
 
 #include <Base/Converter.h>
 #include <Base/Exception.h>
@@ -729,12 +732,69 @@ PropertyMeshKernel::PropertyMeshKernel()
 }
 
 PropertyMeshKernel::~PropertyMeshKernel()
+{
+    leaveSharedGroup();
+    releasePyObject();
+}
+
+void PropertyMeshKernel::releasePyObject()
 {
     if (meshPyObject) {
         // Note: Do not call setInvalid() of the Python binding
         // because the mesh should still be accessible afterwards.
         meshPyObject->parentProperty = nullptr;
         Py_DECREF(meshPyObject);
+        meshPyObject = nullptr;
+    }
+}
+
+void PropertyMeshKernel::leaveSharedGroup()
+{
+    if (!sharedGroup) {
+        return;
+    }
+    if (sharedGroup->original == this) {
+        sharedGroup->original = nullptr;
+    }
+    else {
+        auto& copies = sharedGroup->copies;
+        copies.erase(std::remove(copies.begin(), copies.end(), this), copies.end());
+    }
+    sharedGroup.reset();
+}
+
+void PropertyMeshKernel::detach(bool keepContent)
+{
+    if (!sharedGroup) {
+        return;
+    }
+    auto group = sharedGroup;
+    leaveSharedGroup();
+
+    if (!group->original && group->copies.empty()) {
+        return;
+    }
+    Base::Matrix4D mat = _meshObject->getTransform();
+    if (group->original) {
+        // this is a copy, the mesh object may be replaced
+        _meshObject = keepContent ? new MeshObject(*_meshObject) : new MeshObject();
+        _meshObject->setTransform(mat);
+        releasePyObject();
+    }
+    else {
+        // move the content to a new mesh object for the copies
+        Base::Reference<MeshObject> mesh(new MeshObject());
+        mesh->swap(*_meshObject);
+        for (auto copy : group->copies) {
+            copy->_meshObject = mesh;
+            copy->releasePyObject();
+        }
+        if (keepContent) {
+            *_meshObject = *mesh;
+        }
+        else {
+            _meshObject->setTransform(mat);
+        }
     }
 }
 
@@ -743,56 +803,70 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
+    deferredFile.reset();
     aboutToSetValue();
+    leaveSharedGroup();
     _meshObject = mesh;
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
+    deferredFile.reset();
     aboutToSetValue();
+    detach(&mesh == static_cast<MeshObject*>(_meshObject));
     *_meshObject = mesh;
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
+    deferredFile.reset();
     aboutToSetValue();
+    detach(&mesh == &_meshObject->getKernel());
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detach(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detach(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
+    restoreDeferred();
     return *_meshObject;
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _meshObject->getBoundBox();
 }
 
@@ -800,13 +874,16 @@ unsigned int PropertyMeshKernel::getMemSize() const
 {
     unsigned int size = 0;
     size += _meshObject->getMemSize();
+    size += deferredFile.getSize();
 
     return size;
 }
 
 MeshObject* PropertyMeshKernel::startEditing()
 {
+    restoreDeferred();
     aboutToSetValue();
+    detach();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -817,7 +894,9 @@ void PropertyMeshKernel::finishEditing()
 
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detach();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -825,7 +904,9 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detach();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,16 +916,20 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    restoreDeferred();
+    detach();
     _meshObject->setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyMeshKernel::getTransform() const
 {
+    restoreDeferred();
     return _meshObject->getTransform();
 }
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
+    restoreDeferred();
     if (!meshPyObject) {
         meshPyObject = new MeshPy(
             &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
@@ -882,14 +967,17 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
 
 void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
         MeshCore::MeshOutput saver(_meshObject->getKernel());
         saver.SaveXML(writer);
     }
     else {
-        writer.Stream() << writer.ind() << "<Mesh file=\"" << writer.addFile("MeshKernel.bms", this)
-                        << "\"/>" << std::endl;
+        // raw meshes are stored uncompressed so that restoring them is a plain copy
+        bool raw = writer.getMode("RawKernel");
+        writer.Stream() << writer.ind() << "<Mesh file=\""
+                        << writer.addFile("MeshKernel.bms", this, raw) << "\"/>" << std::endl;
     }
 }
 
@@ -910,6 +998,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detach();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -921,29 +1010,56 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    restoreDeferred();
+    _meshObject->SaveDocFile(writer);
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _meshObject->load(reader);
     hasSetValue();
 }
 
+bool PropertyMeshKernel::deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file)
+{
+    detach();
+    deferredFile.set(file);
+    return true;
+}
+
+void PropertyMeshKernel::restoreDeferred() const
+{
+    // The mesh belongs to the restored document, so it is loaded without notifying the owner
+    deferredFile.restore([this](Base::Reader& reader) {
+        _meshObject->load(reader);
+    });
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    restoreDeferred();
+    // Note: The copy shares the mesh object until one of both gets modified
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
+    if (!sharedGroup) {
+        sharedGroup = std::make_shared<SharedGroup>();
+        sharedGroup->original = const_cast<PropertyMeshKernel*>(this);  // NOLINT
+    }
+    sharedGroup->copies.push_back(prop);
+    prop->sharedGroup = sharedGroup;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
     // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
+    prop.restoreDeferred();
+    deferredFile.reset();
+    aboutToSetValue();
+    detach(&prop == this);
     *(this->_meshObject) = *(prop._meshObject);
     hasSetValue();
 }
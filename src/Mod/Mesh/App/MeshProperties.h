@@ -25,12 +25,14 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 #include <Base/Handle.h>
 #include <Base/Matrix.h>
+#include <Base/Reader.h>
 
 #include <Mod/Mesh/App/Core/MeshIO.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -228,6 +230,8 @@ private:
 };
 
 /** The mesh kernel property class.
+ * A copy made with Copy(), e.g. to undo a change, shares the mesh object with
+ * this property until one of them gets modified.
  * @author Werner Mayer
  */
 class MeshExport PropertyMeshKernel: public App::PropertyComplexGeoData
@@ -315,14 +319,36 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    /// Defer reading the mesh until it is accessed
+    bool deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
 private:
+    void restoreDeferred() const;
+    /** Stops sharing the mesh object with the copies of this property or the
+     * property it was copied from. If \a keepContent is false the content is
+     * about to be replaced and only the transformation is kept.
+     */
+    void detach(bool keepContent = true);
+    void leaveSharedGroup();
+    void releasePyObject();
+
+private:
+    // The properties that share a mesh object, the original keeps the mesh
+    // object when it's modified because it may be referenced from outside.
+    struct SharedGroup
+    {
+        PropertyMeshKernel* original {nullptr};
+        std::vector<PropertyMeshKernel*> copies;
+    };
+
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
+    mutable Base::LazyDocFile deferredFile;
+    mutable std::shared_ptr<SharedGroup> sharedGroup;
 };
 
 }  // namespace Mesh
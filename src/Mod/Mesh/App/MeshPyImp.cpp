@@ -24,7 +24,9 @@
 
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBufferTools.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
@@ -47,6 +49,21 @@
 
 using namespace Mesh;
 
+namespace
+{
+// Run a boolean operation on copies of the two meshes without holding the
+// GIL, so other Python threads can keep on working meanwhile
+MeshObject* runUnlocked(const MeshObject& mesh1,
+                        const MeshObject& mesh2,
+                        MeshObject* (MeshObject::*func)(const MeshObject&) const)
+{
+    MeshObject copy1(mesh1);
+    MeshObject copy2(mesh2);
+    Base::PyGILStateRelease unlock;
+    return (copy1.*func)(copy2);
+}
+}  // namespace
+
 
 struct MeshPropertyLock
 {
@@ -465,7 +482,9 @@ PyObject* MeshPy::unite(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->unite(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh = runUnlocked(*getMeshObjectPtr(),
+                                       *pcObject->getMeshObjectPtr(),
+                                       &MeshObject::unite);
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -485,7 +504,9 @@ PyObject* MeshPy::intersect(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->intersect(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh = runUnlocked(*getMeshObjectPtr(),
+                                       *pcObject->getMeshObjectPtr(),
+                                       &MeshObject::intersect);
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -505,7 +526,9 @@ PyObject* MeshPy::difference(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->subtract(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh = runUnlocked(*getMeshObjectPtr(),
+                                       *pcObject->getMeshObjectPtr(),
+                                       &MeshObject::subtract);
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -525,7 +548,9 @@ PyObject* MeshPy::inner(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->inner(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh = runUnlocked(*getMeshObjectPtr(),
+                                       *pcObject->getMeshObjectPtr(),
+                                       &MeshObject::inner);
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -545,7 +570,9 @@ PyObject* MeshPy::outer(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->outer(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh = runUnlocked(*getMeshObjectPtr(),
+                                       *pcObject->getMeshObjectPtr(),
+                                       &MeshObject::outer);
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -577,10 +604,14 @@ PyObject* MeshPy::section(PyObject* args, PyObject* kwds) const
 
     MeshPy* pcObject = static_cast<MeshPy*>(pcObj);
 
-    std::vector<std::vector<Base::Vector3f>> curves =
-        getMeshObjectPtr()->section(*pcObject->getMeshObjectPtr(),
-                                    Base::asBoolean(connectLines),
-                                    fMinDist);
+    MeshObject mesh1(*getMeshObjectPtr());
+    MeshObject mesh2(*pcObject->getMeshObjectPtr());
+    bool connect = Base::asBoolean(connectLines);
+    std::vector<std::vector<Base::Vector3f>> curves;
+    {
+        Base::PyGILStateRelease unlock;
+        curves = mesh1.section(mesh2, connect, fMinDist);
+    }
     Py::List outer;
     for (const auto& it : curves) {
         Py::List inner;
@@ -958,6 +989,108 @@ PyObject* MeshPy::getPointNormals(PyObject* args) const
     PY_CATCH;
 }
 
+PyObject* MeshPy::getPointArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshObject* mesh = getMeshObjectPtr();
+        float* data = nullptr;
+        PyObject* array = Base::newArrayView(Py_ssize_t(mesh->countPoints()), 3, data);
+        if (!array) {
+            return nullptr;
+        }
+        for (MeshObject::const_point_iterator it = mesh->points_begin(); it != mesh->points_end();
+             ++it) {
+            *data++ = float(it->x);  // NOLINT
+            *data++ = float(it->y);  // NOLINT
+            *data++ = float(it->z);  // NOLINT
+        }
+        return array;
+    }
+    PY_CATCH;
+}
+
+PyObject* MeshPy::getFacetArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshCore::MeshFacetArray& facets = getMeshObjectPtr()->getKernel().GetFacets();
+        PointIndex* data = nullptr;
+        PyObject* array = Base::newArrayView(Py_ssize_t(facets.size()), 3, data);
+        if (!array) {
+            return nullptr;
+        }
+        for (const auto& facet : facets) {
+            data = std::copy(std::begin(facet._aulPoints), std::end(facet._aulPoints), data);
+        }
+        return array;
+    }
+    PY_CATCH;
+}
+
+PyObject* MeshPy::fromArrays(PyObject* args)
+{
+    PyObject* pyPoints {};
+    PyObject* pyFacets {};
+    if (!PyArg_ParseTuple(args, "OO", &pyPoints, &pyFacets)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        MeshCore::MeshPointArray points;
+        bool ok = Base::forEachBufferValue(pyPoints, 3, [&points](Py_ssize_t index, auto value) {
+            std::size_t pos = std::size_t(index) / 3;
+            if (pos == points.size()) {
+                points.emplace_back();
+            }
+            points[pos][static_cast<unsigned short>(index % 3)] = float(value);
+        });
+        if (!ok) {
+            return nullptr;
+        }
+
+        MeshCore::MeshFacetArray facets;
+        std::size_t numPoints = points.size();
+        ok = Base::forEachBufferValue(pyFacets, 3, [&](Py_ssize_t index, auto value) {
+            using T = decltype(value);
+            if constexpr (!std::is_integral_v<T>) {
+                throw Py::TypeError("Point indices must be integers");
+            }
+            else {
+                bool negative = false;
+                if constexpr (std::is_signed_v<T>) {
+                    negative = value < 0;
+                }
+                if (negative || std::size_t(value) >= numPoints) {
+                    throw Py::IndexError("Point index out of range");
+                }
+                std::size_t pos = std::size_t(index) / 3;
+                if (pos == facets.size()) {
+                    facets.emplace_back();
+                }
+                facets[pos]._aulPoints[index % 3] = PointIndex(value);
+            }
+        });
+        if (!ok) {
+            return nullptr;
+        }
+
+        MeshObject* mesh = new MeshObject();
+        mesh->getKernel().Adopt(points, facets, true);
+        return new MeshPy(mesh);
+    }
+    PY_CATCH;
+}
+
 PyObject* MeshPy::addSegment(PyObject* args)
 {
     PyObject* pylist {};
@@ -2018,38 +2151,48 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds) const
 
     PY_TRY
     {
-        MeshPropertyLock lock(this->parentProperty);
-        MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
+        // smooth a copy without holding the GIL and swap it in afterwards
+        MeshObject mesh(*getMeshObjectPtr());
+        MeshCore::MeshKernel& kernel = mesh.getKernel();
+        std::unique_ptr<MeshCore::AbstractSmoothing> smooth;
         if (strcmp(method, "Laplace") == 0) {
-            MeshCore::LaplaceSmoothing smooth(kernel);
+            auto laplace = std::make_unique<MeshCore::LaplaceSmoothing>(kernel);
             if (lambda > 0) {
-                smooth.SetLambda(lambda);
+                laplace->SetLambda(lambda);
             }
-            smooth.Smooth(iter);
+            smooth = std::move(laplace);
         }
         else if (strcmp(method, "Taubin") == 0) {
-            MeshCore::TaubinSmoothing smooth(kernel);
+            auto taubin = std::make_unique<MeshCore::TaubinSmoothing>(kernel);
             if (lambda > 0) {
-                smooth.SetLambda(lambda);
+                taubin->SetLambda(lambda);
             }
             if (micro > 0) {
-                smooth.SetMicro(micro);
+                taubin->SetMicro(micro);
             }
-            smooth.Smooth(iter);
+            smooth = std::move(taubin);
         }
         else if (strcmp(method, "PlaneFit") == 0) {
-            MeshCore::PlaneFitSmoothing smooth(kernel);
-            smooth.SetMaximum(maximum);
-            smooth.Smooth(iter);
+            auto planeFit = std::make_unique<MeshCore::PlaneFitSmoothing>(kernel);
+            planeFit->SetMaximum(maximum);
+            smooth = std::move(planeFit);
         }
         else if (strcmp(method, "MedianFilter") == 0) {
-            MeshCore::MedianFilterSmoothing smooth(kernel);
-            smooth.SetWeight(weight);
-            smooth.Smooth(iter);
+            auto median = std::make_unique<MeshCore::MedianFilterSmoothing>(kernel);
+            median->SetWeight(weight);
+            smooth = std::move(median);
         }
         else {
             throw Py::ValueError("No such smoothing algorithm");
         }
+
+        {
+            Base::PyGILStateRelease unlock;
+            smooth->Smooth(iter);
+        }
+
+        MeshPropertyLock lock(this->parentProperty);
+        getMeshObjectPtr()->swap(mesh);
     }
     PY_CATCH;
 
@@ -2063,7 +2206,13 @@ PyObject* MeshPy::decimate(PyObject* args)
     if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(fTol, fRed);
+            MeshObject mesh(*getMeshObjectPtr());
+            {
+                Base::PyGILStateRelease unlock;
+                mesh.decimate(fTol, fRed);
+            }
+            MeshPropertyLock lock(this->parentProperty);
+            getMeshObjectPtr()->swap(mesh);
         }
         PY_CATCH;
 
@@ -2075,7 +2224,13 @@ PyObject* MeshPy::decimate(PyObject* args)
     if (PyArg_ParseTuple(args, "i", &targetSize)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(targetSize);
+            MeshObject mesh(*getMeshObjectPtr());
+            {
+                Base::PyGILStateRelease unlock;
+                mesh.decimate(targetSize);
+            }
+            MeshPropertyLock lock(this->parentProperty);
+            getMeshObjectPtr()->swap(mesh);
         }
         PY_CATCH;
 
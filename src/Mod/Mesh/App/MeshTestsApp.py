@@ -708,6 +708,33 @@ class MeshSubElement(unittest.TestCase):
         pass
 
 
+class MeshArrays(unittest.TestCase):
+    def testRoundTrip(self):
+        mesh = Mesh.createBox(1.0, 1.0, 1.0)
+        points = mesh.getPointArray()
+        facets = mesh.getFacetArray()
+        self.assertEqual(points.shape, (8, 3))
+        self.assertEqual(facets.shape, (12, 3))
+        self.assertAlmostEqual(points[1, 2], mesh.Points[1].z)
+        self.assertEqual(facets[3, 1], mesh.Facets[3].PointIndices[1])
+
+        copy = Mesh.Mesh.fromArrays(points, facets)
+        self.assertEqual(copy.CountPoints, 8)
+        self.assertEqual(copy.CountFacets, 12)
+        self.assertAlmostEqual(copy.Volume, 1.0, 5)
+
+    def testInvalidArrays(self):
+        import array
+
+        points = array.array("d", [0, 0, 0, 1, 0, 0, 0, 1, 0])
+        with self.assertRaises(IndexError):
+            Mesh.Mesh.fromArrays(points, array.array("i", [0, 1, 3]))
+        with self.assertRaises(TypeError):
+            Mesh.Mesh.fromArrays(points, array.array("f", [0, 1, 2]))
+        with self.assertRaises(ValueError):
+            Mesh.Mesh.fromArrays(points, array.array("i", [0, 1]))
+
+
 class MeshProperty(unittest.TestCase):
     def setUp(self):
         self.doc = FreeCAD.newDocument("MeshTest")
@@ -39,6 +39,7 @@
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Mesh/App/Core/Evaluation.h>
 #include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/Health.h>
 
 #include "DlgEvaluateMeshImp.h"
 #include "ui_DlgEvaluateMesh.h"
@@ -1211,67 +1212,17 @@ void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
                     qApp->processEvents();
                 }
                 {
-                    MeshEvalOrientation eval(rMesh);
+                    // all other defects are analyzed in one pass and repaired in the order
+                    // they depend on each other
+                    MeshEvalHealth eval(rMesh, d->epsilonDegenerated);
                     if (!eval.Evaluate()) {
                         Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").harmonizeNormals()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalTopology eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeNonManifolds()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalRangeFacet rf(rMesh);
-                    MeshEvalRangePoint rp(rMesh);
-                    MeshEvalCorruptedFacets cf(rMesh);
-                    MeshEvalNeighbourhood nb(rMesh);
-                    if (!rf.Evaluate() || !rp.Evaluate() || !cf.Evaluate() || !nb.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").fixIndices()",
-                            docName, objName);
-                        run = true;
-                    }
-                }
-                {
-                    MeshEvalDegeneratedFacets eval(rMesh, d->epsilonDegenerated);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").fixDegenerations(%f)",
+                            "App.getDocument(\"%s\").getObject(\"%s\").repairDefects(%f)",
                             docName, objName, d->epsilonDegenerated);
                         run = true;
                     }
                     qApp->processEvents();
                 }
-                {
-                    MeshEvalDuplicateFacets eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeDuplicatedFacets()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
-                {
-                    MeshEvalDuplicatePoints eval(rMesh);
-                    if (!eval.Evaluate()) {
-                        Gui::Command::doCommand(Gui::Command::App,
-                            "App.getDocument(\"%s\").getObject(\"%s\").removeDuplicatedPoints()",
-                            docName, objName);
-                        run = true;
-                    }
-                    qApp->processEvents();
-                }
             } while(d->ui.checkRepeatButton->isChecked() && run && (--max_iter > 0));
         }
         catch (const Base::Exception& e) {
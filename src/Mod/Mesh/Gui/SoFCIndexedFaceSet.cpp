@@ -411,13 +411,10 @@ bool MeshRenderer::matchMaterial(SoState* state) const
     return p->pcolors == pcolors;
 }
 
-bool MeshRenderer::shouldRenderDirectly([[maybe_unused]] bool direct)
+bool MeshRenderer::shouldRenderDirectly(bool direct)
 {
-#ifdef RENDER_GL_VAO
-    return false;
-#else
+    // huge meshes are rendered in chunks with levels of detail by SoFCMeshObjectShape
     return direct;
-#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -23,15 +23,23 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <limits>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
 #ifdef FC_OS_WIN32
 #include <windows.h>
 #endif
 #ifdef FC_OS_MACOSX
 #include <OpenGL/gl.h>
+#include <OpenGL/glext.h>
 #include <OpenGL/glu.h>
 #else
 #include <GL/gl.h>
+#include <GL/glext.h>
 #include <GL/glu.h>
 #endif
 #include <Inventor/SbLine.h>
@@ -47,16 +55,22 @@
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/elements/SoCullElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
 #include <Inventor/misc/SoState.h>
+#include <Inventor/sensors/SoTimerSensor.h>
 #endif
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
 #include <Mod/Mesh/App/Core/Elements.h>
-#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 
 #include "SoFCMeshObject.h"
@@ -358,10 +372,7 @@ SoFCMeshPickNode::SoFCMeshPickNode()
 /*!
   Destructor.
 */
-SoFCMeshPickNode::~SoFCMeshPickNode()
-{
-    delete meshGrid;
-}
+SoFCMeshPickNode::~SoFCMeshPickNode() = default;
 
 // Doc from superclass.
 void SoFCMeshPickNode::initClass()
@@ -369,20 +380,6 @@ void SoFCMeshPickNode::initClass()
     SO_NODE_INIT_CLASS(SoFCMeshPickNode, SoNode, "Node");
 }
 
-void SoFCMeshPickNode::notify(SoNotList* list)
-{
-    SoField* f = list->getLastField();
-    if (f == &mesh) {
-        const Mesh::MeshObject* meshObject = mesh.getValue();
-        if (meshObject) {
-            MeshCore::MeshAlgorithm alg(meshObject->getKernel());
-            float fAvgLen = alg.GetAverageEdgeLength();
-            delete meshGrid;
-            meshGrid = new MeshCore::MeshFacetGrid(meshObject->getKernel(), 5.0F * fAvgLen);
-        }
-    }
-}
-
 // Doc from superclass.
 void SoFCMeshPickNode::rayPick(SoRayPickAction* /*action*/)
 {}
@@ -402,7 +399,8 @@ void SoFCMeshPickNode::pick(SoPickAction* action)
     Base::Vector3f pt(pos[0], pos[1], pos[2]);
     Base::Vector3f dr(dir[0], dir[1], dir[2]);
     Mesh::FacetIndex index {};
-    if (alg.NearestFacetOnRay(pt, dr, *meshGrid, pt, index)) {
+    // the facet tree is cached by the mesh object and rebuilt after changes only
+    if (alg.NearestFacetOnRay(pt, dr, *meshObject->getFacetTree(), pt, index)) {
         SoPickedPoint* pp = raypick->addIntersection(SbVec3f(pt.x, pt.y, pt.z));
         if (pp) {
             SoFaceDetail* det = new SoFaceDetail();
@@ -599,6 +597,389 @@ inline SbVec3f sbvec3f(const Base::Vector3f& _v)
     return {_v.x, _v.y, _v.z};
 }
 
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// the meshes that are rendered in chunks and the number of triangles per chunk
+constexpr unsigned long minChunkedFacets = 1UL << 19;
+constexpr std::size_t facetsPerChunk = std::size_t(1) << 16;
+// the cluster sizes of the simplified levels relative to the mean edge length
+constexpr std::array<float, 2> clusterSizes = {3.0F, 12.0F};
+// per vertex a normal and a point
+constexpr std::size_t floatsPerVertex = 6;
+
+void appendTriangle(std::vector<float>& array,
+                    const Base::Vector3f& v0,
+                    const Base::Vector3f& v1,
+                    const Base::Vector3f& v2)
+{
+    // Calculate the normal n = (v1-v0)x(v2-v0)
+    float n[3];
+    n[0] = (v1.y - v0.y) * (v2.z - v0.z) - (v1.z - v0.z) * (v2.y - v0.y);
+    n[1] = (v1.z - v0.z) * (v2.x - v0.x) - (v1.x - v0.x) * (v2.z - v0.z);
+    n[2] = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+    float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    if (length > 0.0F) {
+        n[0] /= length;
+        n[1] /= length;
+        n[2] /= length;
+    }
+    for (const Base::Vector3f* v : {&v0, &v1, &v2}) {
+        array.insert(array.end(), {n[0], n[1], n[2], v->x, v->y, v->z});
+    }
+}
+}  // namespace
+
+/**
+ * The triangles of a mesh split into spatial chunks of about the same number of triangles.
+ * Besides all its triangles every chunk has simplified levels that are made by clustering
+ * the vertices on a grid. The clusters are shared by all chunks so that there are no gaps
+ * between them. Each level is kept as a flat shaded N3F_V3F array, which is uploaded into
+ * a vertex buffer when it's rendered the first time.
+ */
+class SoFCMeshObjectShape::Chunks
+{
+public:
+    static constexpr std::size_t numLevels = clusterSizes.size() + 1;
+
+    /// Builds the chunks, returns early without chunks if \a cancel is set meanwhile
+    Chunks(const MeshCore::MeshKernel& kernel, const std::atomic<bool>& cancel);
+    void render(SoGLRenderAction* action, SbBool interactive);
+
+private:
+    struct Chunk
+    {
+        SbBox3f box;
+        std::array<std::vector<float>, numLevels> vertices;
+        std::array<std::unique_ptr<Gui::OpenGLMultiBuffer>, numLevels> buffers;
+
+        std::size_t countTriangles(std::size_t level) const
+        {
+            return vertices[level].size() / (3 * floatsPerVertex);
+        }
+    };
+
+    struct Clusters
+    {
+        std::vector<uint32_t> ofPoint;
+        std::vector<Base::Vector3f> points;
+    };
+
+    using FacetRange = std::pair<std::size_t, std::size_t>;
+    static void split(const MeshCore::MeshKernel& kernel,
+                      std::vector<MeshCore::FacetIndex>& facets,
+                      std::vector<FacetRange>& ranges);
+    static Clusters makeClusters(const MeshCore::MeshPointArray& points, float size);
+    static void makeLevel(const MeshCore::MeshKernel& kernel,
+                          const MeshCore::FacetIndex* begin,
+                          const MeshCore::FacetIndex* end,
+                          const Clusters& clusters,
+                          std::vector<float>& vertices);
+    static void renderLevel(SoGLRenderAction* action, Chunk& chunk, std::size_t level);
+
+private:
+    std::vector<Chunk> chunks;
+};
+
+SoFCMeshObjectShape::Chunks::Chunks(const MeshCore::MeshKernel& kernel,
+                                    const std::atomic<bool>& cancel)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+
+    std::vector<MeshCore::FacetIndex> order(facets.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<FacetRange> ranges;
+    split(kernel, order, ranges);
+
+    double length = 0.0;
+    for (const auto& it : facets) {
+        for (int i = 0; i < 3; i++) {
+            length += Base::Distance(points[it._aulPoints[i]], points[it._aulPoints[(i + 1) % 3]]);
+        }
+    }
+    std::size_t numEdges = 3 * std::max<std::size_t>(1, facets.size());
+    auto meanLength = static_cast<float>(length / double(numEdges));
+
+    std::vector<Clusters> clusters;
+    for (float size : clusterSizes) {
+        if (cancel) {
+            return;
+        }
+        clusters.push_back(makeClusters(points, size * meanLength));
+    }
+
+    std::vector<Chunk> result(ranges.size());
+    auto build = [&](std::size_t first, std::size_t step) {
+        for (std::size_t i = first; i < ranges.size() && !cancel; i += step) {
+            Chunk& chunk = result[i];
+            const MeshCore::FacetIndex* begin = order.data() + ranges[i].first;
+            const MeshCore::FacetIndex* end = order.data() + ranges[i].second;
+            for (auto it = begin; it != end; ++it) {
+                for (MeshCore::PointIndex index : facets[*it]._aulPoints) {
+                    const MeshCore::MeshPoint& pnt = points[index];
+                    chunk.box.extendBy(SbVec3f(pnt.x, pnt.y, pnt.z));
+                }
+            }
+            makeLevel(kernel, begin, end, Clusters(), chunk.vertices[0]);
+            for (std::size_t level = 1; level < numLevels; level++) {
+                makeLevel(kernel, begin, end, clusters[level - 1], chunk.vertices[level]);
+            }
+        }
+    };
+
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < threads; i++) {
+        futures.push_back(std::async(std::launch::async, build, i, threads));
+    }
+    build(0, threads);
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    if (!cancel) {
+        chunks.swap(result);
+    }
+}
+
+/**
+ * Splits the facets recursively at the median of their centers along the longest axis of
+ * the box of the centers until there are at most facetsPerChunk facets in a range.
+ */
+void SoFCMeshObjectShape::Chunks::split(const MeshCore::MeshKernel& kernel,
+                                        std::vector<MeshCore::FacetIndex>& facets,
+                                        std::vector<FacetRange>& ranges)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = kernel.GetFacets();
+    // three times the center of a facet
+    auto center = [&](MeshCore::FacetIndex index, int axis) {
+        const MeshCore::MeshFacet& face = rFacets[index];
+        float sum = 0.0F;
+        for (MeshCore::PointIndex it : face._aulPoints) {
+            const MeshCore::MeshPoint& pnt = points[it];
+            sum += axis == 0 ? pnt.x : (axis == 1 ? pnt.y : pnt.z);
+        }
+        return sum;
+    };
+
+    std::vector<FacetRange> stack;
+    if (!facets.empty()) {
+        stack.emplace_back(0, facets.size());
+    }
+    while (!stack.empty()) {
+        FacetRange range = stack.back();
+        stack.pop_back();
+        if (range.second - range.first <= facetsPerChunk) {
+            ranges.push_back(range);
+            continue;
+        }
+
+        std::array<float, 3> length {};
+        for (int axis = 0; axis < 3; axis++) {
+            auto minmax = std::minmax_element(facets.begin() + std::ptrdiff_t(range.first),
+                                              facets.begin() + std::ptrdiff_t(range.second),
+                                              [&](MeshCore::FacetIndex a, MeshCore::FacetIndex b) {
+                                                  return center(a, axis) < center(b, axis);
+                                              });
+            length[axis] = center(*minmax.second, axis) - center(*minmax.first, axis);
+        }
+        int axis = int(std::max_element(length.begin(), length.end()) - length.begin());
+
+        auto begin = facets.begin() + std::ptrdiff_t(range.first);
+        auto end = facets.begin() + std::ptrdiff_t(range.second);
+        auto mid = begin + (end - begin) / 2;
+        std::nth_element(begin, mid, end, [&](MeshCore::FacetIndex a, MeshCore::FacetIndex b) {
+            return center(a, axis) < center(b, axis);
+        });
+        std::size_t split = range.first + std::size_t(mid - begin);
+        stack.emplace_back(split, range.second);
+        stack.emplace_back(range.first, split);
+    }
+}
+
+/**
+ * Assigns the points to the cells of a grid with the given cell size, the points of a
+ * cluster are replaced by their mean point.
+ */
+SoFCMeshObjectShape::Chunks::Clusters
+SoFCMeshObjectShape::Chunks::makeClusters(const MeshCore::MeshPointArray& points, float size)
+{
+    Base::BoundBox3f box;
+    for (const auto& it : points) {
+        box.Add(it);
+    }
+    // 21 bits per axis for the key of a cell
+    constexpr float maxCells = float(1 << 21) - 1.0F;
+    size = std::max({size,
+                     box.LengthX() / maxCells,
+                     box.LengthY() / maxCells,
+                     box.LengthZ() / maxCells,
+                     std::numeric_limits<float>::min()});
+
+    Clusters clusters;
+    clusters.ofPoint.reserve(points.size());
+    std::vector<uint32_t> counts;
+    std::unordered_map<uint64_t, uint32_t> cells;
+    cells.reserve(points.size() / 4);
+    for (const auto& it : points) {
+        auto cell = [&](float value, float min) {
+            return uint64_t((value - min) / size);
+        };
+        uint64_t key = cell(it.x, box.MinX) | (cell(it.y, box.MinY) << 21)
+            | (cell(it.z, box.MinZ) << 42);
+        auto result = cells.emplace(key, uint32_t(clusters.points.size()));
+        if (result.second) {
+            clusters.points.emplace_back(0.0F, 0.0F, 0.0F);
+            counts.push_back(0);
+        }
+        uint32_t index = result.first->second;
+        clusters.points[index] += it;
+        counts[index]++;
+        clusters.ofPoint.push_back(index);
+    }
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        clusters.points[i] /= float(counts[i]);
+    }
+    return clusters;
+}
+
+/**
+ * Appends the facets to \a vertices. With clusters the facets are made of the clusters of
+ * their points, facets with less than three clusters and duplicates are skipped.
+ */
+void SoFCMeshObjectShape::Chunks::makeLevel(const MeshCore::MeshKernel& kernel,
+                                            const MeshCore::FacetIndex* begin,
+                                            const MeshCore::FacetIndex* end,
+                                            const Clusters& clusters,
+                                            std::vector<float>& vertices)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    if (clusters.ofPoint.empty()) {
+        vertices.reserve(std::size_t(end - begin) * 3 * floatsPerVertex);
+        for (auto it = begin; it != end; ++it) {
+            const MeshCore::MeshFacet& face = facets[*it];
+            appendTriangle(vertices,
+                           points[face._aulPoints[0]],
+                           points[face._aulPoints[1]],
+                           points[face._aulPoints[2]]);
+        }
+        return;
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (auto it = begin; it != end; ++it) {
+        const MeshCore::MeshFacet& face = facets[*it];
+        std::array<uint32_t, 3> triangle {clusters.ofPoint[face._aulPoints[0]],
+                                          clusters.ofPoint[face._aulPoints[1]],
+                                          clusters.ofPoint[face._aulPoints[2]]};
+        if (triangle[0] == triangle[1] || triangle[1] == triangle[2]
+            || triangle[2] == triangle[0]) {
+            continue;
+        }
+        // the smallest index first keeps the orientation
+        std::rotate(triangle.begin(),
+                    std::min_element(triangle.begin(), triangle.end()),
+                    triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+
+    vertices.reserve(triangles.size() * 3 * floatsPerVertex);
+    for (const auto& it : triangles) {
+        appendTriangle(vertices,
+                       clusters.points[it[0]],
+                       clusters.points[it[1]],
+                       clusters.points[it[2]]);
+    }
+    vertices.shrink_to_fit();
+}
+
+/**
+ * Renders the chunks inside the view volume. Of each chunk the finest level is rendered
+ * that has at most as many triangles as the chunk covers pixels, or a quarter of them in
+ * interactive mode.
+ */
+void SoFCMeshObjectShape::Chunks::render(SoGLRenderAction* action, SbBool interactive)
+{
+    SoState* state = action->getState();
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    const SbMatrix& mat = SoModelMatrixElement::get(state);
+    SbVec2s size = SoViewportRegionElement::get(state).getViewportSizePixels();
+    float pixels = float(size[0]) * float(size[1]) * (interactive ? 0.25F : 1.0F);
+
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    for (auto& chunk : chunks) {
+        if (SoCullElement::cullTest(state, chunk.box)) {
+            continue;
+        }
+
+        SbBox3f box = chunk.box;
+        box.transform(mat);
+        SbVec2f extent = vv.projectBox(box);
+        float area = extent[0] * extent[1] * pixels;
+        std::size_t level = 0;
+        while (level + 1 < numLevels && float(chunk.countTriangles(level)) > area
+               && chunk.countTriangles(level + 1) > 0) {
+            level++;
+        }
+        renderLevel(action, chunk, level);
+    }
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+}
+
+void SoFCMeshObjectShape::Chunks::renderLevel(SoGLRenderAction* action,
+                                              Chunk& chunk,
+                                              std::size_t level)
+{
+    static bool init = false;
+    static bool vboAvailable = false;
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+        init = true;
+    }
+
+    const std::vector<float>& vertices = chunk.vertices[level];
+    auto count = static_cast<GLsizei>(vertices.size() / floatsPerVertex);
+    if (count == 0) {
+        return;
+    }
+
+    if (!vboAvailable) {
+        glInterleavedArrays(GL_N3F_V3F, 0, vertices.data());
+        glDrawArrays(GL_TRIANGLES, 0, count);
+        return;
+    }
+
+    auto& buffer = chunk.buffers[level];
+    if (!buffer) {
+        buffer = std::make_unique<Gui::OpenGLMultiBuffer>(GL_ARRAY_BUFFER);
+    }
+    uint32_t context = action->getCacheContext();
+    buffer->setCurrentContext(context);
+    if (!buffer->isCreated(context)) {
+        buffer->create();
+        buffer->bind();
+        buffer->allocate(vertices.data(), static_cast<int>(vertices.size() * sizeof(float)));
+    }
+    else {
+        buffer->bind();
+    }
+    glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, count);
+    buffer->release();
+}
+
+// ----------------------------------------------------------------------------
+
 SO_NODE_SOURCE(SoFCMeshObjectShape)
 
 void SoFCMeshObjectShape::initClass()
@@ -611,14 +992,81 @@ SoFCMeshObjectShape::SoFCMeshObjectShape()
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
+    chunkSensor = new SoTimerSensor(chunksBuiltCB, this);
+    chunkSensor->setInterval(SbTime(0.1));
 }
 
-SoFCMeshObjectShape::~SoFCMeshObjectShape() = default;
+SoFCMeshObjectShape::~SoFCMeshObjectShape()
+{
+    delete chunkSensor;
+    cancelChunks = true;
+    if (pendingChunks.valid()) {
+        pendingChunks.wait();
+    }
+}
 
 void SoFCMeshObjectShape::notify(SoNotList* node)
 {
     inherited::notify(node);
     updateGLArray = true;
+    if (!touchedByChunks) {
+        updateChunks = true;
+        cancelChunks = true;
+    }
+}
+
+/**
+ * Renders the chunks of the mesh and returns true if they are built. Otherwise their build
+ * is started in a background thread with a copy of the mesh, which may be modified meanwhile.
+ */
+bool SoFCMeshObjectShape::renderChunks(SoGLRenderAction* action,
+                                       const Mesh::MeshObject* mesh,
+                                       SbBool interactive)
+{
+    if (updateChunks) {
+        chunks.reset();
+        // an outdated build is cancelled, the sensor restarts it when it's finished
+        if (!pendingChunks.valid()) {
+            updateChunks = false;
+            cancelChunks = false;
+            auto kernel = std::make_shared<MeshCore::MeshKernel>(mesh->getKernel());
+            pendingChunks = std::async(std::launch::async, [this, kernel]() {
+                return std::make_unique<Chunks>(*kernel, cancelChunks);
+            });
+            chunkSensor->schedule();
+        }
+    }
+
+    if (!chunks) {
+        return false;
+    }
+    chunks->render(action, interactive);
+    return true;
+}
+
+void SoFCMeshObjectShape::chunksBuiltCB(void* data, SoSensor* sensor)
+{
+    auto self = static_cast<SoFCMeshObjectShape*>(data);
+    if (!self->pendingChunks.valid()
+        || self->pendingChunks.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+
+    static_cast<SoTimerSensor*>(sensor)->unschedule();
+    try {
+        std::unique_ptr<Chunks> result = self->pendingChunks.get();
+        if (!self->updateChunks) {
+            self->chunks = std::move(result);
+        }
+    }
+    catch (const std::exception& e) {
+        Base::Console().warning("Failed to build the chunks of the mesh: %s\n", e.what());
+    }
+
+    // redraw with the chunks or with a restarted build
+    self->touchedByChunks = true;
+    self->touch();
+    self->touchedByChunks = false;
 }
 
 #define RENDER_GLARRAYS
@@ -655,6 +1103,20 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
             ccw = false;
         }
 
+        if (mbind == OVERALL && mesh->countFacets() >= minChunkedFacets) {
+            if (renderChunks(action, mesh, mode)) {
+                return;
+            }
+            // as long as the chunks are built
+            if (!mode || mesh->countFacets() <= this->renderTriangleLimit) {
+                drawFaces(mesh, nullptr, mbind, needNormals, ccw);
+            }
+            else {
+                drawPoints(mesh, needNormals, ccw);
+            }
+            return;
+        }
+
         if (!mode || mesh->countFacets() <= this->renderTriangleLimit) {
             if (mbind != OVERALL) {
                 drawFaces(mesh, &mb, mbind, needNormals, ccw);
@@ -23,6 +23,10 @@
 #ifndef MESHGUI_SOFCMESHOBJECT_H
 #define MESHGUI_SOFCMESHOBJECT_H
 
+#include <atomic>
+#include <future>
+#include <memory>
+
 #include <Inventor/elements/SoReplacedElement.h>
 #include <Inventor/fields/SoSFUInt32.h>
 #include <Inventor/fields/SoSFVec3f.h>
@@ -32,15 +36,13 @@
 #include <Mod/Mesh/App/Mesh.h>
 
 
+class SoSensor;
+class SoTimerSensor;
+
 using GLuint = unsigned int;
 using GLint = int;
 using GLfloat = float;
 
-namespace MeshCore
-{
-class MeshFacetGrid;
-}
-
 namespace MeshGui
 {
 
@@ -94,7 +96,6 @@ class MeshGuiExport SoFCMeshPickNode: public SoNode
 public:
     static void initClass();
     SoFCMeshPickNode();
-    void notify(SoNotList*) override;
 
     SoSFMeshObject mesh;  // NOLINT
 
@@ -103,9 +104,6 @@ public:
 
 protected:
     ~SoFCMeshPickNode() override;
-
-private:
-    MeshCore::MeshFacetGrid* meshGrid {nullptr};
 };
 
 // -------------------------------------------------------
@@ -166,6 +164,11 @@ protected:
  * The limit of maximum allowed triangles can be specified in \a renderTriangleLimit, the
  * default value is set to 100.000.
  *
+ * Meshes with at least 2^19 triangles and an overall material are split into spatial chunks
+ * in a background thread, see \ref Chunks. They are rendered from vertex buffers, chunks
+ * outside of the view volume are culled and chunks covering few pixels are rendered with a
+ * simplified level. In interactive mode coarser levels are used instead of the points.
+ *
  * The GLRender() method checks the status of the SoFCInteractiveElement to decide to be in
  * interactive mode or not.
  * To take advantage of this facility the client programmer must set the status of the
@@ -210,6 +213,8 @@ private:
         NONE = OVERALL
     };
 
+    class Chunks;
+
 private:
     void notify(SoNotList* node) override;
     Binding findMaterialBinding(SoState* const state) const;
@@ -220,6 +225,8 @@ private:
                    SbBool needNormals,
                    SbBool ccw) const;
     void drawPoints(const Mesh::MeshObject*, SbBool needNormals, SbBool ccw) const;
+    bool renderChunks(SoGLRenderAction* action, const Mesh::MeshObject*, SbBool interactive);
+    static void chunksBuiltCB(void* data, SoSensor* sensor);
     unsigned int countTriangles(SoAction* action) const;
 
     void startSelection(SoAction* action, const Mesh::MeshObject*);
@@ -238,6 +245,13 @@ private:
     std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
     SbBool updateGLArray {false};
+    // Chunks of huge meshes
+    std::unique_ptr<Chunks> chunks;
+    std::future<std::unique_ptr<Chunks>> pendingChunks;
+    std::atomic<bool> cancelChunks {false};
+    SoTimerSensor* chunkSensor {nullptr};
+    SbBool updateChunks {true};
+    SbBool touchedByChunks {false};
 };
 
 class MeshGuiExport SoFCMeshSegmentShape: public SoShape
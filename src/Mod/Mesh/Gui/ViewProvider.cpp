@@ -1525,15 +1525,6 @@ std::vector<Mesh::FacetIndex> ViewProviderMesh::getVisibleFacets(const SbViewpor
     lm->model = SoLightModel::BASE_COLOR;
     root->addChild(lm);
     auto mat = new SoMaterial();
-    mat->diffuseColor.setNum(count);
-    SbColor* diffcol = mat->diffuseColor.startEditing();
-    for (uint32_t i = 0; i < count; i++) {
-        float t {};
-        diffcol[i].setPackedValue(i << 8, t);
-    }
-
-    mat->diffuseColor.finishEditing();
-
     auto bind = new SoMaterialBinding();
     bind->value = SoMaterialBinding::PER_FACE;
 
@@ -1547,25 +1538,39 @@ std::vector<Mesh::FacetIndex> ViewProviderMesh::getVisibleFacets(const SbViewpor
     Gui::SoQtOffscreenRenderer renderer(vp);
     renderer.setBackgroundColor(SbColor4f(0.0F, 0.0F, 0.0F));
 
-    QImage img;
-    renderer.render(root);
-    renderer.writeToImage(img);
-    root->unref();
-
-    int width = img.width();
-    int height = img.height();
-    QRgb color = 0;
+    // Every facet is rendered with its index plus one as color, black is the background. The
+    // colors have 24 bits, so larger meshes take several passes. Each pass renders the facets
+    // of the other passes black so that they still hide what is behind them.
+    const uint32_t maxId = 0xffffff;
     std::vector<Mesh::FacetIndex> faces;
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            QRgb rgb = img.pixel(x, y);
-            rgb = rgb - (0xff << 24);
-            if (rgb != 0 && rgb != color) {
-                color = rgb;
-                faces.push_back((Mesh::FacetIndex)rgb);
+    for (uint32_t base = 0; base < count; base += std::min(maxId, count - base)) {
+        mat->diffuseColor.setNum(count);
+        SbColor* diffcol = mat->diffuseColor.startEditing();
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t id = (i >= base && i - base < maxId) ? i - base + 1 : 0;
+            float t {};
+            diffcol[i].setPackedValue(id << 8, t);
+        }
+        mat->diffuseColor.finishEditing();
+
+        QImage img;
+        renderer.render(root);
+        renderer.writeToImage(img);
+
+        int width = img.width();
+        int height = img.height();
+        QRgb color = 0;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                QRgb rgb = img.pixel(x, y) & 0xffffff;
+                if (rgb != 0 && rgb != color) {
+                    color = rgb;
+                    faces.push_back(Mesh::FacetIndex(base + rgb - 1));
+                }
             }
         }
     }
+    root->unref();
 
     std::sort(faces.begin(), faces.end());
     faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
@@ -101,46 +101,79 @@ void ViewProviderMeshFaceSet::updateData(const App::Property* prop)
 {
     ViewProviderMesh::updateData(prop);
     if (const auto* meshProp = dynamic_cast<const Mesh::PropertyMeshKernel*>(prop)) {
-        const Mesh::MeshObject* mesh = meshProp->getValuePtr();
-
-        bool direct = MeshRenderer::shouldRenderDirectly(mesh->countFacets() > this->triangleCount);
-        if (direct) {
-            this->pcMeshNode->mesh.setValue(mesh);
-            // Needs to update internal bounding box caches
-            this->pcMeshShape->touch();
-            pcMeshCoord->point.setNum(0);
-            pcMeshFaces->coordIndex.setNum(0);
+        // hidden meshes get their nodes when they are shown for the first time
+        if (isUpdateForced() || Visibility.getValue()) {
+            updateMesh(meshProp);
         }
         else {
-            ViewProviderMeshBuilder builder;
-            builder.createMesh(prop, pcMeshCoord, pcMeshFaces);
-            pcMeshFaces->invalidate();
+            visualTouched = true;
         }
+    }
+}
 
-        if (direct != directRendering) {
-            directRendering = direct;
-            Gui::coinRemoveAllChildren(pcShapeGroup);
+void ViewProviderMeshFaceSet::onChanged(const App::Property* prop)
+{
+    if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && visualTouched) {
+        updateMesh(&getMeshProperty());
+    }
 
-            if (directRendering) {
-                pcShapeGroup->addChild(pcMeshNode);
-                pcShapeGroup->addChild(pcMeshShape);
-            }
-            else {
-                pcShapeGroup->addChild(pcMeshCoord);
-                pcShapeGroup->addChild(pcMeshFaces);
-            }
+    ViewProviderMesh::onChanged(prop);
+}
+
+void ViewProviderMeshFaceSet::forceUpdate(bool enable)
+{
+    if (enable) {
+        if (++forceUpdateCount == 1 && !isShow() && visualTouched) {
+            updateMesh(&getMeshProperty());
         }
+    }
+    else if (forceUpdateCount) {
+        --forceUpdateCount;
+    }
+}
+
+void ViewProviderMeshFaceSet::updateMesh(const Mesh::PropertyMeshKernel* meshProp)
+{
+    visualTouched = false;
+    const Mesh::MeshObject* mesh = meshProp->getValuePtr();
+
+    bool direct = MeshRenderer::shouldRenderDirectly(mesh->countFacets() > this->triangleCount);
+    if (direct) {
+        this->pcMeshNode->mesh.setValue(mesh);
+        // Needs to update internal bounding box caches
+        this->pcMeshShape->touch();
+        pcMeshCoord->point.setNum(0);
+        pcMeshFaces->coordIndex.setNum(0);
+    }
+    else {
+        ViewProviderMeshBuilder builder;
+        builder.createMesh(meshProp, pcMeshCoord, pcMeshFaces);
+        pcMeshFaces->invalidate();
+    }
 
-        showOpenEdges(OpenEdges.getValue());
-        std::vector<Mesh::FacetIndex> selection;
-        mesh->getFacetsFromSelection(selection);
-        if (selection.empty()) {
-            unhighlightSelection();
+    if (direct != directRendering) {
+        directRendering = direct;
+        Gui::coinRemoveAllChildren(pcShapeGroup);
+
+        if (directRendering) {
+            pcShapeGroup->addChild(pcMeshNode);
+            pcShapeGroup->addChild(pcMeshShape);
         }
         else {
-            highlightSelection();
+            pcShapeGroup->addChild(pcMeshCoord);
+            pcShapeGroup->addChild(pcMeshFaces);
         }
     }
+
+    showOpenEdges(OpenEdges.getValue());
+    std::vector<Mesh::FacetIndex> selection;
+    mesh->getFacetsFromSelection(selection);
+    if (selection.empty()) {
+        unhighlightSelection();
+    }
+    else {
+        highlightSelection();
+    }
 }
 
 void ViewProviderMeshFaceSet::showOpenEdges(bool show)
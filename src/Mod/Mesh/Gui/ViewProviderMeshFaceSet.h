@@ -58,12 +58,25 @@ public:
     void attach(App::DocumentObject* obj) override;
     void updateData(const App::Property* prop) override;
 
+    bool isUpdateForced() const override
+    {
+        return forceUpdateCount > 0;
+    }
+    void forceUpdate(bool enable = true) override;
+
 protected:
+    void onChanged(const App::Property* prop) override;
     void showOpenEdges(bool show) override;
     SoShape* getShapeNode() const override;
     SoNode* getCoordNode() const override;
 
 private:
+    /// Build the nodes of the mesh, deferred by updateData() while the object is hidden
+    void updateMesh(const Mesh::PropertyMeshKernel* prop);
+
+private:
+    bool visualTouched {false};
+    int forceUpdateCount {0};
     bool directRendering;
     unsigned long triangleCount;
     SoCoordinate3* pcMeshCoord;
@@ -22,7 +22,11 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <limits>
+#include <thread>
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
@@ -51,6 +55,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -60,6 +65,41 @@
 
 
 using namespace MeshPart;
+
+namespace
+{
+
+// Calls func for all indices below count in parallel, the progress is shown per block
+void parallelFor(std::size_t count,
+                 std::size_t blockSize,
+                 const char* text,
+                 const std::function<void(std::size_t)>& func)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    auto run = [&func](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            func(i);
+        }
+    };
+
+    Base::SequencerLauncher seq(text, (count + blockSize - 1) / blockSize);
+    for (std::size_t block = 0; block < count; block += blockSize) {
+        std::size_t end = std::min(count, block + blockSize);
+        std::size_t chunk = (end - block + threads - 1) / threads;
+        std::vector<std::future<void>> futures;
+        for (std::size_t begin = block + chunk; begin < end; begin += chunk) {
+            futures.push_back(
+                std::async(std::launch::async, run, begin, std::min(end, begin + chunk)));
+        }
+        run(block, std::min(end, block + chunk));
+        for (auto& future : futures) {
+            future.get();
+        }
+        seq.next();
+    }
+}
+
+}  // namespace
 using MeshCore::MeshAlgorithm;
 using MeshCore::MeshFacet;
 using MeshCore::MeshFacetGrid;
@@ -665,10 +705,9 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                    float tolerance,
                                    std::vector<Base::Vector3f>& pointsOut) const
 {
-    // calculate the average edge length and create a grid
+    // unlike a grid the tree doesn't visit lots of cells for unevenly sized facets
     MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshCore::MeshFacetTree cTree(_rcMesh);
 
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
@@ -690,20 +729,24 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
         }
     }
 
-    Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
-
-    for (auto it : pointsIn) {
+    // the points are projected independently of each other
+    std::vector<Base::Vector3f> projected(pointsIn.size());
+    std::vector<char> hit(pointsIn.size(), 0);
+    parallelFor(pointsIn.size(), 10000, "Project points on mesh", [&](std::size_t i) {
+        const Base::Vector3f& it = pointsIn[i];
         Base::Vector3f result;
         MeshCore::FacetIndex index;
-        if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
+        if (clAlg.NearestFacetOnRay(it, dir, cTree, result, index)) {
             MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
-                    pointsOut.push_back(result);
+                    projected[i] = result;
+                    hit[i] = 1;
                 }
             }
             else {
-                pointsOut.push_back(result);
+                projected[i] = result;
+                hit[i] = 1;
             }
         }
         else {
@@ -718,7 +761,8 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                             });
 
             if (boundaryPnt != boundaryPoints.end()) {
-                pointsOut.push_back(*boundaryPnt);
+                projected[i] = *boundaryPnt;
+                hit[i] = 1;
             }
             else {
                 // go through the boundary edges and check if the point can be directly projected
@@ -730,14 +774,19 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                     Base::Vector3f vec = result1 - it;
                     float angle = vec.GetAngle(dir);
                     if (dot <= 0 && angle < 1e-6f) {
-                        pointsOut.push_back(result1);
+                        projected[i] = result1;
+                        hit[i] = 1;
                         break;
                     }
                 }
             }
         }
+    });
 
-        seq.next();
+    for (std::size_t i = 0; i < pointsIn.size(); i++) {
+        if (hit[i]) {
+            pointsOut.push_back(projected[i]);
+        }
     }
 }
 
@@ -745,60 +794,16 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    std::vector<PolyLine> polylines;
     TopExp_Explorer Ex;
-
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
-    }
-
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
-
     for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
         const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        std::vector<Base::Vector3f> points;
-        discretize(aEdge, points, 5);
-
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
-        std::vector<HitPoint> hitPoints;
-        using HitPoints = std::pair<HitPoint, HitPoint>;
-        std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
-
-                if (hitPoints.size() > 1) {
-                    HitPoint p1 = hitPoints[hitPoints.size() - 2];
-                    HitPoint p2 = hitPoints[hitPoints.size() - 1];
-                    hitPointPairs.emplace_back(p1, p2);
-                }
-            }
-        }
-
-        MeshCore::MeshProjection meshProjection(_rcMesh);
         PolyLine polyline;
-        for (auto it : hitPointPairs) {
-            points.clear();
-            if (meshProjection.projectLineOnMesh(cGrid,
-                                                 it.first.first,
-                                                 it.first.second,
-                                                 it.second.first,
-                                                 it.second.second,
-                                                 dir,
-                                                 points)) {
-                polyline.points.insert(polyline.points.end(), points.begin(), points.end());
-            }
-        }
-        rPolyLines.push_back(polyline);
-
-        seq.next();
+        discretize(aEdge, polyline.points, 5);
+        polylines.push_back(polyline);
     }
+
+    projectParallelToMesh(polylines, dir, rPolyLines);
 }
 
 void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
@@ -810,10 +815,10 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
 
-    Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
-
-    for (const auto& it : aEdges) {
-        std::vector<Base::Vector3f> points = it.points;
+    // the polylines are projected independently of each other
+    std::vector<PolyLine> projected(aEdges.size());
+    parallelFor(aEdges.size(), 16, "Project curve on mesh", [&](std::size_t i) {
+        std::vector<Base::Vector3f> points = aEdges[i].points;
 
         using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
         std::vector<HitPoint> hitPoints;
@@ -847,10 +852,10 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
                 polyline.points.insert(polyline.points.end(), points.begin(), points.end());
             }
         }
-        rPolyLines.push_back(polyline);
+        projected[i].points.swap(polyline.points);
+    });
 
-        seq.next();
-    }
+    rPolyLines.insert(rPolyLines.end(), projected.begin(), projected.end());
 }
 
 void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
@@ -22,12 +22,16 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <future>
 #include <iostream>
 #include <map>
 #include <numbers>
 #include <set>
+#include <thread>
 #include <vector>
 #endif
 
@@ -144,65 +148,96 @@ LscmRelax::LscmRelax(
 //////////////////////////////////////////////////////////////////////////
 void LscmRelax::relax(double weight)
 {
+    using clock = std::chrono::steady_clock;
+    clock::time_point start = clock::now();
     ColMat<double, 3> d_q_l_g = this->q_l_m - this->q_l_g;
-    // for every triangle
-    Eigen::Matrix<double, 3, 6> B;
-    Eigen::Matrix<double, 2, 2> T;
-    Eigen::Matrix<double, 6, 6> K_m;
-    Eigen::Matrix<double, 6, 1> u_m, rhs_m;
     Eigen::VectorXd rhs(this->vertices.cols() * 2 + 3);
     if (this->sol.size() == 0)
         this->sol.Zero(this->vertices.cols() * 2 + 3);
     spMat K_g(this->vertices.cols() * 2 + 3, this->vertices.cols() * 2 + 3);
-    std::vector<trip> K_g_triplets;
-    Vector2 v1, v2, v3, v12, v23, v31;
-    long row_pos, col_pos;
-    double A;
-
-    rhs.setZero();
 
-    for (long i=0; i<this->triangles.cols(); i++)
+    // every triangle writes to its own triplets and rhs entries, so the
+    // triangles are assembled in parallel
+    long num_triangles = this->triangles.cols();
+    std::vector<trip> K_g_triplets(num_triangles * 36);
+    K_g_triplets.reserve(num_triangles * 36 + this->flat_vertices.cols() * 8);
+    std::vector<double> rhs_triangles(num_triangles * 6);
+    auto assemble = [&](long begin, long end)
     {
-        // 1: construct B-mat in m-system
-        v1 = this->flat_vertices.col(this->triangles(0, i));
-        v2 = this->flat_vertices.col(this->triangles(1, i));
-        v3 = this->flat_vertices.col(this->triangles(2, i));
-        v12 = v2 - v1;
-        v23 = v3 - v2;
-        v31 = v1 - v3;
-        B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
-              0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
-             -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
-        T << v12.x(), -v12.y(),
-             v12.y(), v12.x();
-        T /= v12.norm();
-        A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
-        B /= A * 2; // (2*area)
-
-        // 2: sigma due dqlg in m-system
-        u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
-
-        // 3: rhs_m = B.T * C * B * dqlg_m
-        //    K_m = B.T * C * B
-        rhs_m = B.transpose() * this->C * B * u_m * A;
-        K_m = B.transpose() * this->C * B * A;
-
-        // 5: add to rhs_g, K_g
-        for (int j=0; j < 3; j++)
+        Eigen::Matrix<double, 3, 6> B;
+        Eigen::Matrix<double, 2, 2> T;
+        Eigen::Matrix<double, 6, 6> K_m;
+        Eigen::Matrix<double, 6, 1> u_m, rhs_m;
+        Vector2 v1, v2, v3, v12, v23, v31;
+        long row_pos, col_pos;
+        double A;
+
+        for (long i=begin; i<end; i++)
         {
-            row_pos = this->triangles(j, i);
-            rhs[row_pos * 2]     += rhs_m[j * 2];
-            rhs[row_pos * 2 + 1] += rhs_m[j * 2 +1];
-            for (int k=0; k < 3; k++)
+            // 1: construct B-mat in m-system
+            v1 = this->flat_vertices.col(this->triangles(0, i));
+            v2 = this->flat_vertices.col(this->triangles(1, i));
+            v3 = this->flat_vertices.col(this->triangles(2, i));
+            v12 = v2 - v1;
+            v23 = v3 - v2;
+            v31 = v1 - v3;
+            B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
+                  0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
+                 -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
+            T << v12.x(), -v12.y(),
+                 v12.y(), v12.x();
+            T /= v12.norm();
+            A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
+            B /= A * 2; // (2*area)
+
+            // 2: sigma due dqlg in m-system
+            u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
+
+            // 3: rhs_m = B.T * C * B * dqlg_m
+            //    K_m = B.T * C * B
+            rhs_m = B.transpose() * this->C * B * u_m * A;
+            K_m = B.transpose() * this->C * B * A;
+
+            // 5: add to rhs_g, K_g
+            for (int j=0; j < 3; j++)
             {
-                col_pos = this->triangles(k, i);
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1)));
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1)));
-                // we don't have to fill all because the matrix is symmetric.
+                row_pos = this->triangles(j, i);
+                rhs_triangles[i * 6 + j * 2]     = rhs_m[j * 2];
+                rhs_triangles[i * 6 + j * 2 + 1] = rhs_m[j * 2 +1];
+                for (int k=0; k < 3; k++)
+                {
+                    col_pos = this->triangles(k, i);
+                    trip* K_g_trip = &K_g_triplets[(i * 9 + j * 3 + k) * 4];
+                    K_g_trip[0] = trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2));
+                    K_g_trip[1] = trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2));
+                    K_g_trip[2] = trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1));
+                    K_g_trip[3] = trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1));
+                    // we don't have to fill all because the matrix is symmetric.
+                }
             }
         }
+    };
+
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, num_triangles / 10000));
+    long chunk = (num_triangles + long(threads) - 1) / long(threads);
+    std::vector<std::future<void>> futures;
+    for (long begin = chunk; begin < num_triangles; begin += chunk)
+        futures.push_back(std::async(std::launch::async, assemble, begin, std::min(num_triangles, begin + chunk)));
+    assemble(0, std::min(num_triangles, chunk));
+    for (auto& future : futures)
+        future.get();
+
+    // sum up the rhs in the order of the triangles
+    rhs.setZero();
+    for (long i=0; i<num_triangles; i++)
+    {
+        for (int j=0; j < 3; j++)
+        {
+            long row_pos = this->triangles(j, i);
+            rhs[row_pos * 2]     += rhs_triangles[i * 6 + j * 2];
+            rhs[row_pos * 2 + 1] += rhs_triangles[i * 6 + j * 2 + 1];
+        }
     }
     // FIXING SOME PINS:
     // - if there are no pins (or only one pin) selected solve the system without the nullspace solution.
@@ -282,12 +317,26 @@ void LscmRelax::relax(double weight)
     K_g.setFromTriplets(K_g_triplets.begin(), K_g_triplets.end());
     // rhs +=  K_g * Eigen::VectorXd::Ones(K_g.rows());
 
+    clock::time_point assembled = clock::now();
+
     // solve linear system (privately store the value for guess in next step)
-    Eigen::SimplicialLDLT<spMat, Eigen::Lower> solver;
-    solver.compute(K_g);
-    this->sol = solver.solve(-rhs);
+    // the pattern only depends on the triangles, so it's analyzed once
+    std::vector<spMat::StorageIndex> pattern(K_g.outerIndexPtr(), K_g.outerIndexPtr() + K_g.outerSize() + 1);
+    pattern.insert(pattern.end(), K_g.innerIndexPtr(), K_g.innerIndexPtr() + K_g.nonZeros());
+    if (!this->relax_solver || pattern != this->relax_pattern)
+    {
+        this->relax_solver = std::make_shared<Eigen::SimplicialLDLT<spMat, Eigen::Lower>>();
+        this->relax_solver->analyzePattern(K_g);
+        this->relax_pattern.swap(pattern);
+    }
+    this->relax_solver->factorize(K_g);
+    this->sol = this->relax_solver->solve(-rhs);
     this->set_shift(this->sol.head(this->vertices.cols() * 2) * weight);
     this->set_q_l_m();
+
+    clock::time_point solved = clock::now();
+    this->assembly_time = std::chrono::duration<double>(assembled - start).count();
+    this->solve_time = std::chrono::duration<double>(solved - assembled).count();
 }
 
 
@@ -40,6 +40,8 @@
 #include <tuple>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+
 #include "MeshFlattening.h"
 
 
@@ -86,6 +88,11 @@ private:
     Eigen::Matrix<double, 3, 3> C;
     Eigen::VectorXd sol;
 
+    // the symbolic factorization of relax() is reused as long as the pattern of the
+    // stiffness matrix doesn't change
+    std::shared_ptr<Eigen::SimplicialLDLT<spMat, Eigen::Lower>> relax_solver;
+    std::vector<spMat::StorageIndex> relax_pattern;
+
     std::vector<long> get_fem_fixed_pins();
     Eigen::MatrixXd get_nullspace();
 
@@ -106,6 +113,10 @@ public:
     double nue=0.9;
     double elasticity=1.;
 
+    // the time in seconds of the last relax() step to assemble and to solve the system
+    double assembly_time=0.;
+    double solve_time=0.;
+
     void lscm();
     void relax(double);
     void area_relax(double);
@@ -113,6 +113,8 @@ PYBIND11_MODULE(flatmesh, m)
         .def("transform", &lscmrelax::LscmRelax::transform)
         .def_readonly("rhs", &lscmrelax::LscmRelax::rhs)
         .def_readonly("MATRIX", &lscmrelax::LscmRelax::MATRIX)
+        .def_readonly("assembly_time", &lscmrelax::LscmRelax::assembly_time)
+        .def_readonly("solve_time", &lscmrelax::LscmRelax::solve_time)
         .def_property_readonly("area", &lscmrelax::LscmRelax::get_area)
         .def_property_readonly("flat_area", &lscmrelax::LscmRelax::get_flat_area)
         .def_property_readonly("flat_vertices", [](lscmrelax::LscmRelax& L){return L.flat_vertices.transpose();}, py::return_value_policy::copy)
@@ -23,10 +23,22 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <thread>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
 #include <Standard_Version.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #endif
 
@@ -34,6 +46,7 @@
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -129,12 +142,162 @@ class BrepMesh
     bool segments;
     std::vector<uint32_t> colors;
 
+    // the nodes of an edge in the triangulation of a face
+    struct EdgeNodes
+    {
+        int edge = 0;
+        int first = 0;
+        int last = 0;
+        bool degenerated = false;
+        // from the first to the last vertex
+        std::vector<int> nodes;
+    };
+
+    struct FaceMesh
+    {
+        std::vector<Base::Vector3d> points;
+        std::vector<Part::TopoShape::Facet> facets;
+        std::vector<EdgeNodes> edges;
+        bool valid = true;
+    };
+
 public:
     BrepMesh(bool s, const std::vector<uint32_t>& c)
         : segments(s)
         , colors(c)
     {}
 
+    /** Creates the mesh from the triangulations of the faces of \a shape.
+     * The nodes of neighbour faces are joined by the discretisation of their common
+     * edge, only the nodes of free edges are merged by their position. Returns null
+     * if the triangulations don't fit together.
+     */
+    Mesh::MeshObject* create(const TopoDS_Shape& shape) const
+    {
+        std::vector<TopoDS_Face> faces;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            faces.push_back(TopoDS::Face(xp.Current()));
+        }
+        TopTools_IndexedMapOfShape vertexMap;
+        TopTools_IndexedMapOfShape edgeMap;
+        TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+        TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+        // the faces are independent of each other
+        std::vector<FaceMesh> faceMeshes(faces.size());
+        std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+        threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, faces.size() / 100));
+        std::size_t chunk = (faces.size() + threads - 1) / threads;
+        auto collect = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                faceMeshes[i] = getFaceMesh(faces[i], vertexMap, edgeMap);
+            }
+        };
+        std::vector<std::future<void>> futures;
+        for (std::size_t t = 1; t < threads; t++) {
+            futures.push_back(std::async(std::launch::async,
+                                         collect,
+                                         t * chunk,
+                                         std::min(faces.size(), (t + 1) * chunk)));
+        }
+        collect(0, std::min(faces.size(), chunk));
+        for (auto& future : futures) {
+            future.get();
+        }
+
+        // The keys of the nodes: the vertices, then the inner nodes of the edges and
+        // then the nodes of the faces
+        int numKeys = vertexMap.Extent();
+        std::vector<int> edgeOffset(edgeMap.Extent(), -1);
+        std::vector<std::size_t> edgeSize(edgeMap.Extent(), 0);
+        std::vector<int> edgeUses(edgeMap.Extent(), 0);
+        std::vector<int> faceOffset;
+        faceOffset.reserve(faceMeshes.size());
+        for (const auto& faceMesh : faceMeshes) {
+            if (!faceMesh.valid) {
+                return nullptr;
+            }
+            for (const auto& it : faceMesh.edges) {
+                if (edgeOffset[it.edge] < 0) {
+                    edgeOffset[it.edge] = numKeys;
+                    edgeSize[it.edge] = it.nodes.size();
+                    numKeys += int(it.nodes.size()) - 2;
+                }
+                else if (edgeSize[it.edge] != it.nodes.size()) {
+                    return nullptr;
+                }
+                edgeUses[it.edge]++;
+            }
+            faceOffset.push_back(numKeys);
+            numKeys += int(faceMesh.points.size());
+        }
+
+        std::vector<Base::Vector3d> keyPoints(numKeys);
+        std::vector<std::vector<int>> faceKeys(faceMeshes.size());
+        std::vector<int> freeKeys;
+        for (std::size_t i = 0; i < faceMeshes.size(); i++) {
+            const FaceMesh& faceMesh = faceMeshes[i];
+            std::vector<int>& keys = faceKeys[i];
+            keys.resize(faceMesh.points.size());
+            std::iota(keys.begin(), keys.end(), faceOffset[i]);
+            for (const auto& it : faceMesh.edges) {
+                // a seam is used twice by its face
+                bool freeEdge = !it.degenerated && edgeUses[it.edge] == 1;
+                for (std::size_t j = 0; j < it.nodes.size(); j++) {
+                    int key = edgeOffset[it.edge] + int(j) - 1;
+                    if (it.degenerated || j == 0) {
+                        key = it.first;
+                    }
+                    else if (j + 1 == it.nodes.size()) {
+                        key = it.last;
+                    }
+                    keys[it.nodes[j]] = key;
+                    if (freeEdge) {
+                        freeKeys.push_back(key);
+                    }
+                }
+            }
+            for (std::size_t j = 0; j < keys.size(); j++) {
+                keyPoints[keys[j]] = faceMesh.points[j];
+            }
+        }
+
+        // the free edges of faces that aren't sewed may still touch each other
+        std::vector<int> mergedKeys(numKeys);
+        std::iota(mergedKeys.begin(), mergedKeys.end(), 0);
+        mergeKeys(freeKeys, keyPoints, mergedKeys);
+
+        MeshCore::MeshPointArray verts;
+        MeshCore::MeshFacetArray facets;
+        std::vector<std::size_t> segmentOffsets(1, 0);
+        std::vector<int> pointIndex(numKeys, -1);
+        auto addPoint = [&](int key) {
+            if (pointIndex[key] < 0) {
+                pointIndex[key] = int(verts.size());
+                const Base::Vector3d& pnt = keyPoints[key];
+                verts.emplace_back(float(pnt.x), float(pnt.y), float(pnt.z));
+            }
+            return MeshCore::PointIndex(pointIndex[key]);
+        };
+        for (std::size_t i = 0; i < faceMeshes.size(); i++) {
+            const std::vector<int>& keys = faceKeys[i];
+            for (const auto& it : faceMeshes[i].facets) {
+                int key1 = mergedKeys[keys[it.I1]];
+                int key2 = mergedKeys[keys[it.I2]];
+                int key3 = mergedKeys[keys[it.I3]];
+                // make sure that we don't insert invalid facets
+                if (key1 != key2 && key2 != key3 && key3 != key1) {
+                    facets.emplace_back(addPoint(key1), addPoint(key2), addPoint(key3));
+                }
+            }
+            segmentOffsets.push_back(facets.size());
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(verts, facets, true);
+        return createObject(kernel, segmentOffsets, faces.size());
+    }
+
     Mesh::MeshObject* create(const std::vector<Part::TopoShape::Domain>& domains) const
     {
         std::vector<Base::Vector3d> points;
@@ -159,7 +322,106 @@ public:
 
         MeshCore::MeshKernel kernel;
         kernel.Adopt(verts, faces, true);
+        return createObject(kernel, mesh.getSegmentOffsets(), domains.size());
+    }
+
+private:
+    static FaceMesh getFaceMesh(const TopoDS_Face& face,
+                                const TopTools_IndexedMapOfShape& vertexMap,
+                                const TopTools_IndexedMapOfShape& edgeMap)
+    {
+        FaceMesh mesh;
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (!Part::Tools::getTriangulation(face, points, facets)) {
+            // an empty domain as in TopoShape::getDomains()
+            return mesh;
+        }
+
+        mesh.points.reserve(points.size());
+        for (const auto& it : points) {
+            mesh.points.emplace_back(it.X(), it.Y(), it.Z());
+        }
+        mesh.facets.reserve(facets.size());
+        for (const auto& it : facets) {
+            Standard_Integer N1, N2, N3;
+            it.Get(N1, N2, N3);
+            Part::TopoShape::Facet tria;
+            tria.I1 = N1;
+            tria.I2 = N2;
+            tria.I3 = N3;
+            mesh.facets.push_back(tria);
+        }
+
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) hTria = BRep_Tool::Triangulation(face, loc);
+        for (TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+            const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+            Handle(Poly_PolygonOnTriangulation) hPoly =
+                BRep_Tool::PolygonOnTriangulation(edge, hTria, loc);
+            TopoDS_Vertex v1, v2;
+            TopExp::Vertices(edge, v1, v2);
+            if (hPoly.IsNull() || hPoly->NbNodes() < 2 || v1.IsNull() || v2.IsNull()) {
+                mesh.valid = false;
+                return mesh;
+            }
+
+            EdgeNodes nodes;
+            nodes.edge = edgeMap.FindIndex(edge) - 1;
+            nodes.first = vertexMap.FindIndex(v1) - 1;
+            nodes.last = vertexMap.FindIndex(v2) - 1;
+            nodes.degenerated = BRep_Tool::Degenerated(edge);
+            const TColStd_Array1OfInteger& indices = hPoly->Nodes();
+            for (Standard_Integer i = indices.Lower(); i <= indices.Upper(); i++) {
+                nodes.nodes.push_back(indices(i) - 1);
+            }
+
+            // the polygon should already start at the first vertex
+            const Base::Vector3d& start = mesh.points[nodes.nodes.front()];
+            gp_Pnt pnt(start.x, start.y, start.z);
+            if (BRep_Tool::Pnt(v1).SquareDistance(pnt) > BRep_Tool::Pnt(v2).SquareDistance(pnt)) {
+                std::reverse(nodes.nodes.begin(), nodes.nodes.end());
+            }
+            mesh.edges.push_back(nodes);
+        }
+        return mesh;
+    }
 
+    // redirects the keys with coincident points to the first one
+    static void mergeKeys(std::vector<int> keys,
+                          const std::vector<Base::Vector3d>& points,
+                          std::vector<int>& mergedKeys)
+    {
+        double tol3d = Precision::Confusion();
+        auto vertexLess = [&](int key1, int key2) {
+            const Base::Vector3d& v1 = points[key1];
+            const Base::Vector3d& v2 = points[key2];
+            if (std::fabs(v1.x - v2.x) >= tol3d) {
+                return v1.x < v2.x;
+            }
+            if (std::fabs(v1.y - v2.y) >= tol3d) {
+                return v1.y < v2.y;
+            }
+            if (std::fabs(v1.z - v2.z) >= tol3d) {
+                return v1.z < v2.z;
+            }
+            return false;  // points are considered to be equal
+        };
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        std::stable_sort(keys.begin(), keys.end(), vertexLess);
+        for (std::size_t i = 1; i < keys.size(); i++) {
+            if (!vertexLess(keys[i - 1], keys[i])) {
+                mergedKeys[keys[i]] = mergedKeys[keys[i - 1]];
+            }
+        }
+    }
+
+    Mesh::MeshObject* createObject(MeshCore::MeshKernel& kernel,
+                                   const std::vector<std::size_t>& segmentOffsets,
+                                   std::size_t numDomains) const
+    {
         // mesh segments
         std::vector<std::vector<MeshCore::FacetIndex>> meshSegments;
 
@@ -168,20 +430,16 @@ public:
             colorMap[colors[i]].push_back(i);
         }
 
-        bool createSegm = (colors.size() == domains.size());
+        bool createSegm = (colors.size() == numDomains);
 
         // add a segment for the face
         if (createSegm || this->segments) {
-            auto segments = mesh.createSegments();
-            meshSegments.reserve(segments.size());
-            std::transform(segments.cbegin(),
-                           segments.cend(),
-                           std::back_inserter(meshSegments),
-                           [](const Part::BRepMesh::Segment& segm) {
-                               std::vector<MeshCore::FacetIndex> faces;
-                               faces.insert(faces.end(), segm.cbegin(), segm.cend());
-                               return faces;
-                           });
+            meshSegments.reserve(numDomains);
+            for (std::size_t i = 1; i < segmentOffsets.size(); i++) {
+                std::vector<MeshCore::FacetIndex> faces(segmentOffsets[i] - segmentOffsets[i - 1]);
+                std::iota(faces.begin(), faces.end(), segmentOffsets[i - 1]);
+                meshSegments.push_back(std::move(faces));
+            }
         }
 
         Mesh::MeshObject* meshdata = new Mesh::MeshObject();
@@ -225,13 +483,17 @@ Mesh::MeshObject* Mesher::createStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        // the faces are meshed in parallel on the common discretisation of their edges
+        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection, true);
+    }
+
+    BrepMesh brepmesh(this->segments, this->colors);
+    if (Mesh::MeshObject* mesh = brepmesh.create(shape)) {
+        return mesh;
     }
 
     std::vector<Part::TopoShape::Domain> domains;
     Part::TopoShape(shape).getDomains(domains);
-
-    BrepMesh brepmesh(this->segments, this->colors);
     return brepmesh.create(domains);
 }
 
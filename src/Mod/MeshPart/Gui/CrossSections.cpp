@@ -305,6 +305,7 @@ void CrossSections::apply()
         kernel.Transform(mesh.getTransform());
 
         MeshCore::MeshFacetGrid grid(kernel);
+        grid.SetCompactStorage(true);
 
         // NOLINTBEGIN
         MeshCrossSection cs(kernel, grid, a, b, c, connectEdges, eps);
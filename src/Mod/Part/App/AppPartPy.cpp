@@ -96,6 +96,7 @@
 #include "OCCError.h"
 #include "PartFeature.h"
 #include "PartPyCXX.h"
+#include "ShapeCache.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapePy.h"
@@ -607,6 +608,26 @@ public:
         add_varargs_method("clearShapeCache",&Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method("getShapeCacheStats",&Module::getShapeCacheStats,
+            "getShapeCacheStats(reset=False) -- Returns a dict with the hits, misses, outdated\n"
+            "entries and evictions of the internal shape cache, its entries and their estimated\n"
+            "memory and the memory budget in bytes. Optionally reset the counters."
+        );
+        add_varargs_method("checkShapes",&Module::checkShapes,
+            "checkShapes(shapes, runBopCheck=False) -- Checks the shapes in parallel and returns a list\n"
+            "with a tuple (valid, report) for each shape, see TopoShape.check()."
+        );
+        add_keyword_method("massProperties",&Module::massProperties,
+            "massProperties(shapes, tolerance=0.0, triangulation=False) -- Returns a list with a dict\n"
+            "of the mass properties of each shape: Dimension (3 volume, 2 surface, 1 length), Mass,\n"
+            "CenterOfMass, MatrixOfInertia (at the center of mass) and Error (estimated absolute\n"
+            "error of Mass, negative if unknown). The shapes are integrated in parallel and the\n"
+            "results are cached with the shapes.\n\n"
+            "* tolerance: relative error for an adaptive integration, 0 for Gauss integration. In\n"
+            "             triangulation mode the linear deflection, 0 for a thousandth of the size.\n"
+            "* triangulation: integrate a triangulation of the shapes, much faster for curved\n"
+            "             faces. The error of a volume is bound by its area times the deflection."
+        );
         add_keyword_method("getShape",&Module::getShape,
             "getShape(obj,subname=None,mat=None,needSubElement=False,transform=True,retType=0):\n"
             "Obtain the TopoShape of a given object with SubName reference\n\n"
@@ -2310,6 +2331,44 @@ private:
                 subObj?Py::Object(subObj->getPyObject(),true):Py::Object());
     }
 
+    Py::Object checkShapes(const Py::Tuple& args) {
+        PyObject *pcObj;
+        PyObject *runBopCheck = Py_False;
+        if (!PyArg_ParseTuple(args.ptr(), "O|O!", &pcObj, &PyBool_Type, &runBopCheck))
+            throw Py::Exception();
+
+        auto results = TopoShape::analyzeShapes(getPyShapes(pcObj), Base::asBoolean(runBopCheck));
+        Py::List res;
+        for (const auto &result : results) {
+            res.append(Py::TupleN(Py::Boolean(result.first), Py::String(result.second)));
+        }
+        return res;
+    }
+
+    Py::Object massProperties(const Py::Tuple& args, const Py::Dict &kwds) {
+        PyObject *pcObj;
+        double tolerance = 0.0;
+        PyObject *triangulation = Py_False;
+        static const std::array<const char *, 4> kwd_list {"shapes", "tolerance", "triangulation", nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O|dO!", kwd_list,
+                                                 &pcObj, &tolerance, &PyBool_Type, &triangulation))
+            throw Py::Exception();
+
+        auto props = TopoShape::getMassProperties(getPyShapes(pcObj), tolerance,
+                                                  Base::asBoolean(triangulation));
+        Py::List res;
+        for (const auto &prop : props) {
+            Py::Dict dict;
+            dict.setItem("Dimension", Py::Long(prop.dimension));
+            dict.setItem("Mass", Py::Float(prop.mass));
+            dict.setItem("CenterOfMass", Py::Vector(prop.centerOfMass));
+            dict.setItem("MatrixOfInertia", Py::Matrix(prop.matrixOfInertia));
+            dict.setItem("Error", Py::Float(prop.error));
+            res.append(dict);
+        }
+        return res;
+    }
+
     Py::Object clearShapeCache(const Py::Tuple &args) {
         if (!PyArg_ParseTuple(args.ptr(),""))
             throw Py::Exception();
@@ -2317,6 +2376,25 @@ private:
         return Py::Object();
     }
 
+    Py::Object getShapeCacheStats(const Py::Tuple &args) {
+        PyObject *reset = Py_False;
+        if (!PyArg_ParseTuple(args.ptr(),"|O!",&PyBool_Type,&reset))
+            throw Py::Exception();
+        auto &cache = Part::ShapeCache::instance();
+        auto stats = cache.getStatistics();
+        if (Base::asBoolean(reset))
+            cache.resetStatistics();
+        Py::Dict res;
+        res.setItem("Hits", Py::Long(static_cast<unsigned long long>(stats.hits)));
+        res.setItem("Misses", Py::Long(static_cast<unsigned long long>(stats.misses)));
+        res.setItem("Outdated", Py::Long(static_cast<unsigned long long>(stats.outdated)));
+        res.setItem("Evictions", Py::Long(static_cast<unsigned long long>(stats.evictions)));
+        res.setItem("Entries", Py::Long(static_cast<unsigned long long>(stats.entries)));
+        res.setItem("MemSize", Py::Long(static_cast<unsigned long long>(stats.memSize)));
+        res.setItem("MemoryBudget", Py::Long(static_cast<unsigned long long>(stats.memoryBudget)));
+        return res;
+    }
+
     Py::Object splitSubname(const Py::Tuple& args) {
         const char *subname;
         if (!PyArg_ParseTuple(args.ptr(), "s",&subname))
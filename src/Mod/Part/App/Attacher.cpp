@@ -1019,7 +1019,7 @@ Base::Placement AttachEngine::calculateAttachedPlacement(const Base::Placement&
             auto [_oldname, newname] = namechange;
             subs[subkey] = newname;
         }
-        auto pla = _calculateAttachedPlacement(objs, subs, origPlacement);
+        auto pla = cachedAttachedPlacement(objs, subs, origPlacement);
         // check equal placement with some tolerance
         if (pla.getPosition().IsEqual(origPlacement.getPosition(),    Precision::Confusion())
             && pla.getRotation().isSame(origPlacement.getRotation(), Precision::Angular())) {
@@ -1036,7 +1036,95 @@ Base::Placement AttachEngine::calculateAttachedPlacement(const Base::Placement&
             return pla;
         }
     }
-    return _calculateAttachedPlacement(objs, subnames, origPlacement);
+    return cachedAttachedPlacement(objs, subnames, origPlacement);
+}
+
+namespace
+{
+// Unlike TopoDS_Shape::IsEqual() the locations are compared by value, because the sub-shapes
+// are transformed anew on each call
+bool isSameLocatedShape(const TopoDS_Shape& a, const TopoDS_Shape& b)
+{
+    if (a.TShape() != b.TShape() || a.Orientation() != b.Orientation()) {
+        return false;
+    }
+    const gp_Trsf ta = a.Location().Transformation();
+    const gp_Trsf tb = b.Location().Transformation();
+    for (int row = 1; row <= 3; ++row) {
+        for (int col = 1; col <= 4; ++col) {
+            if (ta.Value(row, col) != tb.Value(row, col)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+bool AttachEngine::AttachCache::matches(const AttachCache& other) const
+{
+    if (!valid || objs != other.objs || subs != other.subs
+        || shapes.size() != other.shapes.size()) {
+        return false;
+    }
+    if (mapMode != other.mapMode || mapReverse != other.mapReverse
+        || attachParameter != other.attachParameter || surfU != other.surfU
+        || surfV != other.surfV || !(attachmentOffset == other.attachmentOffset)
+        || !(origPlacement == other.origPlacement) || !(refPlacement == other.refPlacement)) {
+        return false;
+    }
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        if (!isSameLocatedShape(shapes[i], other.shapes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Base::Placement AttachEngine::cachedAttachedPlacement(const std::vector<App::DocumentObject*>& objs,
+                                                      const std::vector<std::string>& subs,
+                                                      const Base::Placement& origPlacement)
+{
+    if (mapMode == mmDeactivated || objs.empty() || objs.size() != subs.size()) {
+        lastAttach.valid = false;
+        return _calculateAttachedPlacement(objs, subs, origPlacement);
+    }
+
+    AttachCache current;
+    try {
+        // Only the referenced sub-shapes are fetched here, and with the shape cache in place a
+        // repeated fetch of an unchanged support returns the very same TopoDS_TShape
+        current.shapes.reserve(objs.size());
+        for (std::size_t i = 0; i < objs.size(); ++i) {
+            current.shapes.push_back(extractSubShape(objs[i], subs[i]).getShape());
+        }
+        App::DocumentObject* subObj = objs[0]->getSubObject(subs[0].c_str());
+        current.refPlacement = App::GeoFeature::getGlobalPlacement(subObj, objs[0], subs[0]);
+    }
+    catch (const Base::Exception&) {
+        // Let the regular calculation report the problem
+        lastAttach.valid = false;
+        return _calculateAttachedPlacement(objs, subs, origPlacement);
+    }
+    current.objs = objs;
+    current.subs = subs;
+    current.origPlacement = origPlacement;
+    current.mapMode = mapMode;
+    current.mapReverse = mapReverse;
+    current.attachParameter = attachParameter;
+    current.surfU = surfU;
+    current.surfV = surfV;
+    current.attachmentOffset = attachmentOffset;
+
+    if (lastAttach.matches(current)) {
+        return lastAttach.result;
+    }
+
+    lastAttach.valid = false;
+    current.result = _calculateAttachedPlacement(objs, subs, origPlacement);
+    current.valid = true;
+    lastAttach = std::move(current);
+    return lastAttach.result;
 }
 
 
@@ -461,6 +461,37 @@ protected:
      * @throws AttachEngineException If given sub shape does not exist or is impossible to obtain.
      */
     static Part::TopoShape extractSubShape(App::DocumentObject* obj, const std::string& subname);
+
+private:
+    /// Inputs and result of the last successful placement calculation
+    struct AttachCache
+    {
+        bool valid = false;
+        std::vector<App::DocumentObject*> objs;
+        std::vector<std::string> subs;
+        std::vector<TopoDS_Shape> shapes;
+        Base::Placement refPlacement;
+        Base::Placement origPlacement;
+        eMapMode mapMode = mmDeactivated;
+        bool mapReverse = false;
+        double attachParameter = 0.0;
+        double surfU = 0.0, surfV = 0.0;
+        Base::Placement attachmentOffset;
+        Base::Placement result;
+
+        bool matches(const AttachCache& other) const;
+    };
+
+    /**
+     * Calls _calculateAttachedPlacement() unless neither the referenced sub-shapes nor any of
+     * the attachment parameters changed since the last call, in which case the last result is
+     * returned.
+     */
+    Base::Placement cachedAttachedPlacement(const std::vector<App::DocumentObject*>& objs,
+                                            const std::vector<std::string>& subs,
+                                            const Base::Placement& origPlacement);
+
+    AttachCache lastAttach;
 };
 
 
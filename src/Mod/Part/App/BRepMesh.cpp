@@ -25,6 +25,10 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #endif
 
@@ -34,289 +38,183 @@
 using namespace Part;
 
 namespace {
-struct MeshVertex
+enum class PointKind : unsigned char
 {
-    Base::Vector3d p;
-    std::size_t i = 0;
-
-    explicit MeshVertex(const Base::Vector3d& p)
-        : p(p)
-    {
-    }
-
-    Base::Vector3d toPoint() const
-    {
-        return p;
-    }
-
-    bool operator < (const MeshVertex &v) const
-    {
-        if (p.x != v.p.x) {
-            return p.x < v.p.x;
-        }
-        if (p.y != v.p.y) {
-            return p.y < v.p.y;
-        }
-        if (p.z != v.p.z) {
-            return p.z < v.p.z;
-        }
-
-        // points are equal
-        return false;
-    }
+    Unused,
+    Inner,
+    Boundary
 };
 
-class MergeVertex
+/** Returns which points of \a domain are used by its facets and which of them
+ * are on its free edges. Only the points on the free edges of a domain can be
+ * shared with another domain, the inner points are its own.
+ */
+std::vector<PointKind> getPointKinds(const BRepMesh::Domain& domain)
 {
-public:
-    using Facet = BRepMesh::Facet;
-
-    MergeVertex(std::vector<Base::Vector3d> points,
-                std::vector<Facet> faces,
-                double tolerance)
-        : points{std::move(points)}
-        , faces{std::move(faces)}
-        , tolerance{tolerance}
-    {
-        setDefaultMap();
-        check();
-    }
-
-    bool hasDuplicatedPoints() const
-    {
-        return duplicatedPoints > 0;
-    }
-
-    void mergeDuplicatedPoints()
-    {
-        if (!hasDuplicatedPoints()) {
-            return;
-        }
-
-        redirectPointIndex();
-        auto degreeMap = getPointDegrees();
-        decrementPointIndex(degreeMap);
-        removeUnusedPoints(degreeMap);
-        reset();
-    }
-
-    std::vector<Base::Vector3d> getPoints() const
-    {
-        return points;
-    }
-
-    std::vector<Facet> getFacets() const
-    {
-        return faces;
-    }
-
-private:
-    void setDefaultMap()
-    {
-        // by default map point index to itself
-        mapPointIndex.resize(points.size());
-        std::generate(mapPointIndex.begin(),
-                      mapPointIndex.end(),
-                      Base::iotaGen<std::size_t>(0));
-    }
-
-    void reset()
-    {
-        mapPointIndex.clear();
-        duplicatedPoints = 0;
-    }
-
-    void check()
-    {
-        using VertexIterator = std::vector<Base::Vector3d>::const_iterator;
-
-        double tol3d = tolerance;
-        auto vertexLess = [tol3d](const VertexIterator& v1,
-                                  const VertexIterator& v2)
-        {
-            if (fabs(v1->x - v2->x) >= tol3d) {
-                return v1->x < v2->x;
-            }
-            if (fabs(v1->y - v2->y) >= tol3d) {
-                return v1->y < v2->y;
-            }
-            if (fabs(v1->z - v2->z) >= tol3d) {
-                return v1->z < v2->z;
-            }
-            return false;  // points are considered to be equal
-        };
-        auto vertexEqual = [&](const VertexIterator& v1,
-                               const VertexIterator& v2)
-        {
-            if (vertexLess(v1, v2)) {
-                return false;
-            }
-            if (vertexLess(v2, v1)) {
-                return false;
-            }
-            return true;
-        };
-
-        std::vector<VertexIterator> vertices;
-        vertices.reserve(points.size());
-        for (auto it = points.cbegin(); it != points.cend(); ++it) {
-            vertices.push_back(it);
+    std::vector<PointKind> kinds(domain.points.size(), PointKind::Unused);
+    std::vector<std::uint64_t> edges;
+    edges.reserve(domain.facets.size() * 3);
+    auto addEdge = [&edges](std::uint64_t p1, std::uint64_t p2) {
+        edges.push_back(p1 < p2 ? (p1 << 32) | p2 : (p2 << 32) | p1);
+    };
+    for (const auto& facet : domain.facets) {
+        kinds[facet.I1] = PointKind::Inner;
+        kinds[facet.I2] = PointKind::Inner;
+        kinds[facet.I3] = PointKind::Inner;
+        addEdge(facet.I1, facet.I2);
+        addEdge(facet.I2, facet.I3);
+        addEdge(facet.I3, facet.I1);
+    }
+
+    // an edge of only one facet is a free edge
+    std::sort(edges.begin(), edges.end());
+    for (std::size_t i = 0; i < edges.size();) {
+        std::size_t next = i + 1;
+        while (next < edges.size() && edges[next] == edges[i]) {
+            next++;
         }
-
-        std::sort(vertices.begin(), vertices.end(), vertexLess);
-
-        auto next = vertices.begin();
-        while (next != vertices.end()) {
-            next = std::adjacent_find(next, vertices.end(), vertexEqual);
-            if (next != vertices.end()) {
-                auto first = next;
-                std::size_t first_index = *first - points.begin();
-                ++next;
-                while (next != vertices.end() && vertexEqual(*first, *next)) {
-                    std::size_t next_index = *next - points.begin();
-                    mapPointIndex[next_index] = first_index;
-                    ++duplicatedPoints;
-                    ++next;
-                }
-            }
+        if (next - i == 1) {
+            kinds[edges[i] >> 32] = PointKind::Boundary;
+            kinds[edges[i] & 0xffffffff] = PointKind::Boundary;  // NOLINT
         }
+        i = next;
     }
+    return kinds;
+}
 
-    void redirectPointIndex()
-    {
-        for (auto& face : faces) {
-            face.I1 = int(mapPointIndex[face.I1]);
-            face.I2 = int(mapPointIndex[face.I2]);
-            face.I3 = int(mapPointIndex[face.I3]);
+/** Merges the points within \a tolerance, \a merged is set to the index of
+ * the first point each point is merged into
+ */
+void mergePoints(const std::vector<Base::Vector3d>& points,
+                 double tolerance,
+                 std::vector<std::size_t>& merged)
+{
+    auto vertexLess = [&points, tolerance](std::size_t i1, std::size_t i2) {
+        const Base::Vector3d& v1 = points[i1];
+        const Base::Vector3d& v2 = points[i2];
+        if (std::fabs(v1.x - v2.x) >= tolerance) {
+            return v1.x < v2.x;
         }
-    }
-
-    std::vector<std::size_t> getPointDegrees() const
-    {
-        std::vector<std::size_t> degreeMap;
-        degreeMap.resize(points.size());
-        for (const auto& face : faces) {
-            degreeMap[face.I1]++;
-            degreeMap[face.I2]++;
-            degreeMap[face.I3]++;
+        if (std::fabs(v1.y - v2.y) >= tolerance) {
+            return v1.y < v2.y;
         }
-
-        return degreeMap;
-    }
-
-    void decrementPointIndex(const std::vector<std::size_t>& degreeMap)
-    {
-        std::vector<std::size_t> decrements;
-        decrements.resize(points.size());
-
-        std::size_t decr = 0;
-        for (std::size_t pos = 0; pos < points.size(); pos++) {
-            decrements[pos] = decr;
-            if (degreeMap[pos] == 0) {
-                decr++;
-            }
+        if (std::fabs(v1.z - v2.z) >= tolerance) {
+            return v1.z < v2.z;
         }
+        return false;  // points are considered to be equal
+    };
 
-        for (auto& face : faces) {
-            face.I1 -= int(decrements[face.I1]);
-            face.I2 -= int(decrements[face.I2]);
-            face.I3 -= int(decrements[face.I3]);
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), vertexLess);
+
+    merged.resize(points.size());
+    for (std::size_t i = 0; i < order.size();) {
+        std::size_t next = i + 1;
+        std::size_t first = order[i];
+        while (next < order.size() && !vertexLess(order[next - 1], order[next])) {
+            first = std::min(first, order[next]);
+            next++;
         }
-    }
-
-    void removeUnusedPoints(const std::vector<std::size_t>& degreeMap)
-    {
-        // remove unreferenced points
-        std::vector<Base::Vector3d> new_points;
-        new_points.reserve(points.size() - duplicatedPoints);
-        for (std::size_t pos = 0; pos < points.size(); ++pos) {
-            if (degreeMap[pos] > 0) {
-                new_points.push_back(points[pos]);
-            }
+        for (; i < next; i++) {
+            merged[order[i]] = first;
         }
-
-        points.swap(new_points);
     }
-
-private:
-    std::vector<Base::Vector3d> points;
-    std::vector<Facet> faces;
-    double tolerance = 0.0;
-    std::size_t duplicatedPoints = 0;
-    std::vector<std::size_t> mapPointIndex;
-};
-
+}
 }
 
 void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
                                    std::vector<Base::Vector3d>& points,
                                    std::vector<Facet>& faces)
 {
-    std::size_t numFaces = 0;
-    for (const auto& it : domains) {
-        numFaces += it.facets.size();
+    // the domains are independent of each other
+    std::vector<std::vector<PointKind>> pointKinds(domains.size());
+    OSD_Parallel::For(0, static_cast<int>(domains.size()), [&](int i) {
+        pointKinds[i] = getPointKinds(domains[i]);
+    });
+
+    std::vector<Base::Vector3d> boundaryPoints;
+    for (std::size_t i = 0; i < domains.size(); i++) {
+        for (std::size_t j = 0; j < pointKinds[i].size(); j++) {
+            if (pointKinds[i][j] == PointKind::Boundary) {
+                boundaryPoints.push_back(domains[i].points[j]);
+            }
+        }
     }
-    faces.reserve(numFaces);
+    std::vector<std::size_t> mergedBoundary;
+    mergePoints(boundaryPoints, Precision::Confusion(), mergedBoundary);
 
-    std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
-    };
+    // A boundary point is merged into an earlier one, so the points keep the
+    // order of the domains
+    std::vector<Base::Vector3d> meshPoints;
+    std::vector<std::vector<uint32_t>> pointIndex(domains.size());
+    std::vector<uint32_t> boundaryIndex(boundaryPoints.size());
+    std::size_t numBoundary = 0;
+    for (std::size_t i = 0; i < domains.size(); i++) {
+        const std::vector<PointKind>& kinds = pointKinds[i];
+        std::vector<uint32_t>& index = pointIndex[i];
+        index.resize(kinds.size());
+        for (std::size_t j = 0; j < kinds.size(); j++) {
+            if (kinds[j] == PointKind::Unused) {
+                continue;
+            }
+            if (kinds[j] == PointKind::Boundary) {
+                std::size_t merged = mergedBoundary[numBoundary];
+                if (merged != numBoundary++) {
+                    index[j] = boundaryIndex[merged];
+                    continue;
+                }
+                boundaryIndex[merged] = uint32_t(meshPoints.size());
+            }
+            index[j] = uint32_t(meshPoints.size());
+            meshPoints.push_back(domains[i].points[j]);
+        }
+    }
+    points.swap(meshPoints);
 
-    for (const auto & domain : domains) {
-        std::size_t numDomainFaces = 0;
-        for (const Facet& df : domain.facets) {
+    std::vector<std::vector<Facet>> domainFaces(domains.size());
+    OSD_Parallel::For(0, static_cast<int>(domains.size()), [&](int i) {
+        const std::vector<uint32_t>& index = pointIndex[i];
+        std::vector<Facet>& facets = domainFaces[i];
+        facets.reserve(domains[i].facets.size());
+        for (const Facet& df : domains[i].facets) {
             Facet face;
-
-            // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
-
-            // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
-
-            // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
+            face.I1 = index[df.I1];
+            face.I2 = index[df.I2];
+            face.I3 = index[df.I3];
 
             // make sure that we don't insert invalid facets
-            if (face.I1 != face.I2 &&
-                face.I2 != face.I3 &&
-                face.I3 != face.I1) {
-                faces.push_back(face);
-                numDomainFaces++;
+            if (face.I1 != face.I2 && face.I2 != face.I3 && face.I3 != face.I1) {
+                facets.push_back(face);
             }
         }
+    });
 
-        domainSizes.push_back(numDomainFaces);
+    segmentOffsets.assign(1, 0);
+    segmentOffsets.reserve(domains.size() + 1);
+    for (const auto& it : domainFaces) {
+        segmentOffsets.push_back(segmentOffsets.back() + it.size());
     }
-
-    std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto & vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
+    faces.clear();
+    faces.reserve(segmentOffsets.back());
+    for (const auto& it : domainFaces) {
+        faces.insert(faces.end(), it.begin(), it.end());
     }
-    points.swap(meshPoints);
+}
 
-    MergeVertex merge(points, faces, Precision::Confusion());
-    if (merge.hasDuplicatedPoints()) {
-        merge.mergeDuplicatedPoints();
-        points = merge.getPoints();
-        faces = merge.getFacets();
-    }
+const std::vector<std::size_t>& BRepMesh::getSegmentOffsets() const
+{
+    return segmentOffsets;
 }
 
 std::vector<BRepMesh::Segment> BRepMesh::createSegments() const
 {
-    std::size_t numMeshFaces = 0;
     std::vector<Segment> segm;
-    for (size_t numDomainFaces : domainSizes) {
-        Segment segment(numDomainFaces);
+    for (std::size_t i = 1; i < segmentOffsets.size(); i++) {
+        Segment segment(segmentOffsets[i] - segmentOffsets[i - 1]);
         std::generate(segment.begin(),
                       segment.end(),
-                      Base::iotaGen<std::size_t>(numMeshFaces));
-        numMeshFaces += numDomainFaces;
+                      Base::iotaGen<std::size_t>(segmentOffsets[i - 1]));
         segm.push_back(segment);
     }
 
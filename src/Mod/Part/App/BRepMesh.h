@@ -36,13 +36,21 @@ public:
     using Domain = Data::ComplexGeoData::Domain;
     using Segment = std::vector<std::size_t>;
 
+    /** Joins the domains into one mesh
+     * The points on the free edges of the domains are merged by their
+     * position, the domains are processed in parallel.
+     */
     void getFacesFromDomains(const std::vector<Domain>& domains,
                              std::vector<Base::Vector3d>& points,
                              std::vector<Facet>& faces);
+    /** Returns the facets of the domains of the last getFacesFromDomains()
+     * call as offsets, the facets of domain i are [offsets[i], offsets[i+1])
+     */
+    const std::vector<std::size_t>& getSegmentOffsets() const;
     std::vector<Segment> createSegments() const;
 
 private:
-    std::vector<std::size_t> domainSizes;
+    std::vector<std::size_t> segmentOffsets;
 };
 
 }
@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <algorithm>
+# include <exception>
+# include <memory>
+# include <BRep_Builder.hxx>
 # include <BRepAdaptor_Surface.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 # include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
@@ -31,18 +34,25 @@
 # include <BRepBuilderAPI_MakeWire.hxx>
 # include <BRepPrimAPI_MakeHalfSpace.hxx>
 # include <gp_Pln.hxx>
+# include <OSD_Parallel.hxx>
 # include <Precision.hxx>
 # include <ShapeAnalysis_FreeBounds.hxx>
 # include <ShapeFix_Wire.hxx>
 # include <TopExp.hxx>
 # include <TopExp_Explorer.hxx>
 # include <TopTools_HSequenceOfShape.hxx>
+# include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 # include <TopTools_IndexedMapOfShape.hxx>
+# include <TopTools_MapOfShape.hxx>
 # include <TopoDS.hxx>
+# include <TopoDS_Compound.hxx>
 # include <TopoDS_Edge.hxx>
+# include <TopoDS_Vertex.hxx>
 # include <TopoDS_Wire.hxx>
 #endif
 
+#include <Base/Exception.h>
+
 #include "CrossSection.h"
 #include "TopoShapeOpCode.h"
 
@@ -73,6 +83,24 @@ std::list<TopoDS_Wire> CrossSection::slice(double d) const
     return removeDuplicates(wires);
 }
 
+std::vector<std::list<TopoDS_Wire>> CrossSection::slices(const std::vector<double>& d) const
+{
+    // The boolean operations don't modify the shape, so the slices can be
+    // made at the same time
+    std::vector<std::list<TopoDS_Wire>> wires(d.size());
+    std::vector<std::exception_ptr> errors(d.size());
+    OSD_Parallel::For(0, static_cast<int>(d.size()), [&](int i) {
+        try {
+            wires[i] = slice(d[i]);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    Base::rethrowFirstException(errors);
+    return wires;
+}
+
 std::list<TopoDS_Wire> CrossSection::removeDuplicates(const std::list<TopoDS_Wire>& wires) const
 {
     std::list<TopoDS_Wire> wires_reduce;
@@ -158,32 +186,51 @@ void CrossSection::sliceSolid(double d, const TopoDS_Shape& shape, std::list<Top
 
 void CrossSection::connectEdges (const std::list<TopoDS_Edge>& edges, std::list<TopoDS_Wire>& wires) const
 {
-    // Hint: Use ShapeAnalysis_FreeBounds::ConnectEdgesToWires() as an alternative
-    std::list<TopoDS_Edge> edge_list = edges;
-    while (!edge_list.empty()) {
-        BRepBuilderAPI_MakeWire mkWire;
-        // add and erase first edge
-        mkWire.Add(edge_list.front());
-        edge_list.erase(edge_list.begin());
+    // The edges of a section share their vertices, so look up the edges to
+    // add to a wire by its vertices instead of trying all remaining edges
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    for (const auto& edge : edges) {
+        builder.Add(comp, edge);
+    }
+    TopTools_IndexedDataMapOfShapeListOfShape vertexEdges;
+    TopExp::MapShapesAndAncestors(comp, TopAbs_VERTEX, TopAbs_EDGE, vertexEdges);
+
+    TopTools_MapOfShape used;
+    for (const auto& edge : edges) {
+        if (!used.Add(edge))
+            continue;
 
+        BRepBuilderAPI_MakeWire mkWire;
+        mkWire.Add(edge);
         TopoDS_Wire new_wire = mkWire.Wire();  // current new wire
 
-        // try to connect each edge to the wire, the wire is complete if no more edges are connectible
-        bool found = false;
-        do {
-            found = false;
-            for (std::list<TopoDS_Edge>::iterator pE = edge_list.begin(); pE != edge_list.end();++pE) {
-                mkWire.Add(*pE);
-                if (mkWire.Error() != BRepBuilderAPI_DisconnectedWire) {
-                    // edge added ==> remove it from list
-                    found = true;
-                    edge_list.erase(pE);
-                    new_wire = mkWire.Wire();
-                    break;
-                }
+        // the wire is complete if no more edges are connected to its vertices
+        std::vector<TopoDS_Vertex> vertices;
+        TopoDS_Vertex v1, v2;
+        TopExp::Vertices(edge, v1, v2);
+        vertices.push_back(v1);
+        vertices.push_back(v2);
+        while (!vertices.empty()) {
+            TopoDS_Vertex vertex = vertices.back();
+            vertices.pop_back();
+            int index = vertex.IsNull() ? 0 : vertexEdges.FindIndex(vertex);
+            if (index == 0)
+                continue;
+            for (const auto& next : vertexEdges.FindFromIndex(index)) {
+                if (used.Contains(next))
+                    continue;
+                mkWire.Add(TopoDS::Edge(next));
+                if (mkWire.Error() == BRepBuilderAPI_DisconnectedWire)
+                    continue;
+                used.Add(next);
+                new_wire = mkWire.Wire();
+                TopExp::Vertices(TopoDS::Edge(next), v1, v2);
+                vertices.push_back(v1);
+                vertices.push_back(v2);
             }
         }
-        while (found);
 
         // Fix any topological issues of the wire
         wires.push_back(fixWire(new_wire));
@@ -225,24 +272,74 @@ TopoCrossSection::TopoCrossSection(double a, double b, double c, const TopoShape
 {
 }
 
-void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) const
+struct TopoCrossSection::Section
+{
+    const TopoShape* shape = nullptr;
+    TopoDS_Face face;
+    std::unique_ptr<BRepPrimAPI_MakeHalfSpace> mkSolid;
+    std::unique_ptr<FCBRepAlgoAPI_Cut> mkCut;
+    std::unique_ptr<FCBRepAlgoAPI_Section> mkSection;
+};
+
+std::vector<TopoShape> TopoCrossSection::getSlicedShapes(bool& solid) const
 {
     // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
     // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
-    bool found = false;
-    for (auto& s : shape.getSubTopoShapes(TopAbs_SOLID)) {
-        sliceSolid(idx, d, s, wires);
-        found = true;
+    auto shapes = shape.getSubTopoShapes(TopAbs_SOLID);
+    solid = !shapes.empty();
+    if (shapes.empty()) {
+        shapes = shape.getSubTopoShapes(TopAbs_SHELL);
     }
-    if (!found) {
-        for (auto& s : shape.getSubTopoShapes(TopAbs_SHELL)) {
-            sliceNonSolid(idx, d, s, wires);
-            found = true;
-        }
-        if (!found) {
-            for (auto& s : shape.getSubTopoShapes(TopAbs_FACE)) {
-                sliceNonSolid(idx, d, s, wires);
+    if (shapes.empty()) {
+        shapes = shape.getSubTopoShapes(TopAbs_FACE);
+    }
+    return shapes;
+}
+
+void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) const
+{
+    bool solid = false;
+    for (auto& s : getSlicedShapes(solid)) {
+        Section section;
+        section.shape = &s;
+        makeSection(d, solid, section);
+        mapSection(idx, d, section, wires);
+    }
+}
+
+void TopoCrossSection::slices(int idx, const std::vector<double>& d, std::vector<TopoShape>& wires) const
+{
+    bool solid = false;
+    auto shapes = getSlicedShapes(solid);
+    if (shapes.empty()) {
+        return;
+    }
+
+    // The element maps share the string hasher of the shape, so only the
+    // boolean operations run in parallel. They are kept until their element
+    // maps are made, a block of distances at a time to limit the memory.
+    std::size_t blockSize = std::max(1, OSD_Parallel::NbLogicalProcessors()) * 4;
+    std::vector<Section> sections;
+    std::vector<std::exception_ptr> errors;
+    for (std::size_t start = 0; start < d.size(); start += blockSize) {
+        std::size_t count = std::min(blockSize, d.size() - start) * shapes.size();
+        sections.clear();
+        sections.resize(count);
+        errors.assign(count, nullptr);
+        OSD_Parallel::For(0, static_cast<int>(count), [&](int i) {
+            Section& section = sections[i];
+            section.shape = &shapes[i % shapes.size()];
+            try {
+                makeSection(d[start + i / shapes.size()], solid, section);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
             }
+        });
+        Base::rethrowFirstException(errors);
+        for (std::size_t i = 0; i < count; i++) {
+            std::size_t n = start + i / shapes.size();
+            mapSection(idx + static_cast<int>(n), d[n], sections[i], wires);
         }
     }
 }
@@ -257,32 +354,17 @@ TopoShape TopoCrossSection::slice(int idx, double d) const
         TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
 }
 
-void TopoCrossSection::sliceNonSolid(int idx,
-                                     double d,
-                                     const TopoShape& shape,
-                                     std::vector<TopoShape>& wires) const
+void TopoCrossSection::makeSection(double d, bool solid, Section& section) const
 {
-    FCBRepAlgoAPI_Section cs(shape.getShape(), gp_Pln(a, b, c, -d));
-    if (cs.IsDone()) {
-        std::string prefix(op);
-        prefix += Data::indexSuffix(idx);
-        auto res = TopoShape()
-                       .makeElementShape(cs, shape, prefix.c_str())
-                       .makeElementWires()
-                       .getSubTopoShapes(TopAbs_WIRE);
-        wires.insert(wires.end(), res.begin(), res.end());
+    const TopoDS_Shape& shape = section.shape->getShape();
+    if (!solid) {
+        section.mkSection = std::make_unique<FCBRepAlgoAPI_Section>(shape, gp_Pln(a, b, c, -d));
+        return;
     }
-}
 
-void TopoCrossSection::sliceSolid(int idx,
-                                  double d,
-                                  const TopoShape& shape,
-                                  std::vector<TopoShape>& wires) const
-{
     gp_Pln slicePlane(a, b, c, -d);
     BRepBuilderAPI_MakeFace mkFace(slicePlane);
-    TopoShape face(idx);
-    face.setShape(mkFace.Face());
+    section.face = mkFace.Face();
 
     // Make sure to choose a point that does not lie on the plane (fixes #0001228)
     gp_Vec tempVector(a, b, c);
@@ -291,19 +373,42 @@ void TopoCrossSection::sliceSolid(int idx,
     gp_Pnt refPoint(0.0, 0.0, 0.0);
     refPoint.Translate(tempVector);
 
-    BRepPrimAPI_MakeHalfSpace mkSolid(TopoDS::Face(face.getShape()), refPoint);
-    TopoShape solid(idx);
+    section.mkSolid = std::make_unique<BRepPrimAPI_MakeHalfSpace>(section.face, refPoint);
+    section.mkCut = std::make_unique<FCBRepAlgoAPI_Cut>(shape, section.mkSolid->Solid());
+}
+
+void TopoCrossSection::mapSection(int idx,
+                                  double d,
+                                  Section& section,
+                                  std::vector<TopoShape>& wires) const
+{
+    const TopoShape& shape = *section.shape;
     std::string prefix(op);
     prefix += Data::indexSuffix(idx);
-    solid.makeElementShape(mkSolid, face, prefix.c_str());
-    FCBRepAlgoAPI_Cut mkCut(shape.getShape(), solid.getShape());
 
-    if (mkCut.IsDone()) {
+    if (section.mkSection) {
+        if (section.mkSection->IsDone()) {
+            auto res = TopoShape()
+                           .makeElementShape(*section.mkSection, shape, prefix.c_str())
+                           .makeElementWires()
+                           .getSubTopoShapes(TopAbs_WIRE);
+            wires.insert(wires.end(), res.begin(), res.end());
+        }
+        return;
+    }
+
+    gp_Pln slicePlane(a, b, c, -d);
+    TopoShape face(idx);
+    face.setShape(section.face);
+    TopoShape solid(idx);
+    solid.makeElementShape(*section.mkSolid, face, prefix.c_str());
+
+    if (section.mkCut->IsDone()) {
         TopoShape res(shape.Tag, shape.Hasher);
         std::vector<TopoShape> shapes;
         shapes.push_back(shape);
         shapes.push_back(solid);
-        res.makeElementShape(mkCut, shapes, prefix.c_str());
+        res.makeElementShape(*section.mkCut, shapes, prefix.c_str());
         for (auto& face : res.getSubTopoShapes(TopAbs_FACE)) {
             BRepAdaptor_Surface adapt(TopoDS::Face(face.getShape()));
             if (adapt.GetType() == GeomAbs_Plane) {
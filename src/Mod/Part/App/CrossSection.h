@@ -24,6 +24,7 @@
 #define PART_CROSSSECTION_H
 
 #include <list>
+#include <vector>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <Mod/Part/PartGlobal.h>
 #include "TopoShape.h"
@@ -39,6 +40,8 @@ class PartExport CrossSection
 public:
     CrossSection(double a, double b, double c, const TopoDS_Shape& s);
     std::list<TopoDS_Wire> slice(double d) const;
+    /// Makes the slices at the distances \a d in parallel
+    std::vector<std::list<TopoDS_Wire>> slices(const std::vector<double>& d) const;
 
 private:
     void sliceNonSolid(double d, const TopoDS_Shape&, std::list<TopoDS_Wire>& wires) const;
@@ -59,10 +62,18 @@ public:
     TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op = 0);
     void slice(int idx, double d, std::vector<TopoShape>& wires) const;
     TopoShape slice(int idx, double d) const;
+    /** Makes the slices at the distances \a d, the first one gets the index \a idx
+     *
+     * The boolean operations of the slices run in parallel, the element maps
+     * are made afterwards in the order of the distances.
+     */
+    void slices(int idx, const std::vector<double>& d, std::vector<TopoShape>& wires) const;
 
 private:
-    void sliceNonSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
-    void sliceSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
+    struct Section;
+    std::vector<TopoShape> getSlicedShapes(bool& solid) const;
+    void makeSection(double d, bool solid, Section& section) const;
+    void mapSection(int idx, double d, Section& section, std::vector<TopoShape>& wires) const;
 
 private:
     double a, b, c;
@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <exception>
+# include <memory>
 # include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 # include <BRepBuilderAPI_MakeFace.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
@@ -34,6 +36,7 @@
 # include <gp_Dir.hxx>
 # include <gp_Trsf.hxx>
 # include <GProp_GProps.hxx>
+# include <OSD_Parallel.hxx>
 # include <Precision.hxx>
 # include <TopExp_Explorer.hxx>
 # include <TopoDS.hxx>
@@ -100,30 +103,31 @@ void ExtrusionHelper::makeDraft(const TopoDS_Shape& shape,
 
     // we need for all found wires an offset copy of them
     // we store them in an array
-    TopoDS_Wire offsetWire;
     std::vector<std::vector<TopoDS_Shape>> extrusionSections(wiresections.size(), std::vector<TopoDS_Shape>());
-    size_t rows = 0;
-    int numEdges = 0;
 
     // We need to find out what are outer wires and what are inner ones
     // methods like checking the center of mass etc. don't help us here.
     // As solution we build a prism with every wire, then subtract every prism from each other.
     // If the moment of inertia changes by a subtraction, we have an inner wire prism.
     //
-    // first build the prisms
-    std::vector<TopoDS_Shape> resultPrisms;
-    TopoDS_Shape singlePrism;
-    for (auto& wireVector : wiresections) {
-        for (auto& singleWire : wireVector) {
-            BRepBuilderAPI_MakeFace mkFace(TopoDS::Wire(singleWire));
+    // first build the prisms, every row of wiresections holds a single wire
+    // and the prisms of the wires can be made at the same time
+    std::vector<TopoDS_Shape> resultPrisms(numWires);
+    std::vector<std::exception_ptr> errors(numWires);
+    OSD_Parallel::For(0, static_cast<int>(numWires), [&](int i) {
+        try {
+            BRepBuilderAPI_MakeFace mkFace(TopoDS::Wire(wiresections[i].front()));
             auto tempFace = mkFace.Shape();
             BRepPrimAPI_MakePrism mkPrism(tempFace, vecFwd);
             if (!mkPrism.IsDone())
                 Standard_Failure::Raise("Extrusion: Generating prism failed");
-            singlePrism = mkPrism.Shape();
-            resultPrisms.push_back(singlePrism);
+            resultPrisms[i] = mkPrism.Shape();
         }
-    }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    Base::rethrowFirstException(errors);
     // create an array with false to store later which wires are inner ones
     std::vector<bool> isInnerWire(resultPrisms.size(), false);
     std::vector<bool> checklist(resultPrisms.size(), true);
@@ -137,109 +141,81 @@ void ExtrusionHelper::makeDraft(const TopoDS_Shape& shape,
             ++numInnerWires;
     }
 
-    // at first create offset wires for the reversed part of extrusion
-    // it is important that these wires are the first loft section
-    if (bRev) {
-        // create an offset for all source wires
-        rows = 0;
-        for (auto& wireVector : wiresections) {
-            for (auto& singleWire : wireVector) {
-                // count number of edges
-                numEdges = 0;
-                TopExp_Explorer xp(singleWire, TopAbs_EDGE);
-                while (xp.More()) {
-                    numEdges++;
-                    xp.Next();
-                }
-                // create an offset copy of the wire
-                if (!isInnerWire[rows]) {
-                    // this is an outer wire
-                    createTaperedPrismOffset(TopoDS::Wire(singleWire), vecRev, distanceRev, true, offsetWire);
-                }
-                else {
-                    // there is an OCC bug with single-edge wires (circles), see inside createTaperedPrismOffset
-                    if (numEdges > 1 || !isPartDesign)
-                        // inner wires must get the negated offset
-                        createTaperedPrismOffset(TopoDS::Wire(singleWire), vecRev, -distanceRev, true, offsetWire);
-                    else
-                        // circles in PartDesign must not get the negated offset
-                        createTaperedPrismOffset(TopoDS::Wire(singleWire), vecRev, distanceRev, true, offsetWire);
-                }
-                if (offsetWire.IsNull())
-                    return;
-                extrusionSections[rows].push_back(offsetWire);
-            }
-            ++rows;
+    // create the offset copies of all wires, inner wires get the negated offset
+    auto makeOffset = [&](const TopoDS_Shape& singleWire, bool isInner, const gp_Vec& vec,
+                          double distance, bool isSecond, TopoDS_Wire& offsetWire) {
+        // count number of edges
+        int numEdges = 0;
+        TopExp_Explorer xp(singleWire, TopAbs_EDGE);
+        while (xp.More()) {
+            numEdges++;
+            xp.Next();
         }
-    }
+        // there is an OCC bug with single-edge wires (circles), see inside createTaperedPrismOffset
+        // therefore circles in PartDesign must not get the negated offset
+        if (isInner && (numEdges > 1 || !isPartDesign))
+            distance = -distance;
+        createTaperedPrismOffset(TopoDS::Wire(singleWire), vec, distance, isSecond, offsetWire);
+    };
 
-    // add the source wire as middle section
-    // it is important to add them after the reversed part
-    if (bMid) {
-        // transfer all source wires as they are to the array from which we build the shells
-        rows = 0;
-        for (auto& wireVector : wiresections) {
-            for (auto& singleWire : wireVector) {
-                extrusionSections[rows].push_back(singleWire);
-            }
-            rows++;
+    // the offsets of the wires are independent of each other
+    std::vector<TopoDS_Wire> offsetsRev(numWires);
+    std::vector<TopoDS_Wire> offsetsFwd(numWires);
+    OSD_Parallel::For(0, static_cast<int>(numWires), [&](int i) {
+        try {
+            const TopoDS_Shape& singleWire = wiresections[i].front();
+            if (bRev)
+                makeOffset(singleWire, isInnerWire[i], vecRev, distanceRev, true, offsetsRev[i]);
+            if (bFwd)
+                makeOffset(singleWire, isInnerWire[i], vecFwd, distanceFwd, false, offsetsFwd[i]);
         }
-    }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    Base::rethrowFirstException(errors);
 
-    // finally add the forward extrusion offset wires
-    // these wires must be the last loft section
-    if (bFwd) {
-        rows = 0;
-        for (auto& wireVector : wiresections) {
-            for (auto& singleWire : wireVector) {
-                // count number of edges
-                numEdges = 0;
-                TopExp_Explorer xp(singleWire, TopAbs_EDGE);
-                while (xp.More()) {
-                    numEdges++;
-                    xp.Next();
-                }
-                // create an offset copy of the wire
-                if (!isInnerWire[rows]) {
-                    // this is an outer wire
-                    createTaperedPrismOffset(TopoDS::Wire(singleWire), vecFwd, distanceFwd, false, offsetWire);
-                }
-                else {
-                    // there is an OCC bug with single-edge wires (circles), see inside createTaperedPrismOffset
-                    if (numEdges > 1 || !isPartDesign)
-                        // inner wires must get the negated offset
-                        createTaperedPrismOffset(TopoDS::Wire(singleWire), vecFwd, -distanceFwd, false, offsetWire);
-                    else
-                        // circles in PartDesign must not get the negated offset
-                        createTaperedPrismOffset(TopoDS::Wire(singleWire), vecFwd, distanceFwd, false, offsetWire);
-                }
-                if (offsetWire.IsNull())
-                    return;
-                extrusionSections[rows].push_back(offsetWire);
-            }
-            ++rows;
+    // the loft sections of every wire: at first the offset wire for the reversed part,
+    // then the source wire as middle section and finally the forward offset wire
+    for (size_t rows = 0; rows < numWires; ++rows) {
+        if (bRev) {
+            if (offsetsRev[rows].IsNull())
+                return;
+            extrusionSections[rows].push_back(offsetsRev[rows]);
+        }
+        if (bMid)
+            extrusionSections[rows].push_back(wiresections[rows].front());
+        if (bFwd) {
+            if (offsetsFwd[rows].IsNull())
+                return;
+            extrusionSections[rows].push_back(offsetsFwd[rows]);
         }
     }
 
     try {
-        // build all shells
-        std::vector<TopoDS_Shape> shells;
-
-        for (auto& wires : extrusionSections) {
-            BRepOffsetAPI_ThruSections mkTS(isSolid, /*ruled=*/Standard_True, Precision::Confusion());
+        // build all shells, the lofts of the wires are made at the same time
+        std::vector<TopoDS_Shape> shells(extrusionSections.size());
+        OSD_Parallel::For(0, static_cast<int>(extrusionSections.size()), [&](int i) {
+            try {
+                BRepOffsetAPI_ThruSections mkTS(isSolid, /*ruled=*/Standard_True, Precision::Confusion());
+
+                for (auto& singleWire : extrusionSections[i]) {
+                    if (singleWire.ShapeType() == TopAbs_VERTEX)
+                        mkTS.AddVertex(TopoDS::Vertex(singleWire));
+                    else
+                        mkTS.AddWire(TopoDS::Wire(singleWire));
+                }
+                mkTS.Build();
+                if (!mkTS.IsDone())
+                    Standard_Failure::Raise("Extrusion: Loft could not be built");
 
-            for (auto& singleWire : wires) {
-                if (singleWire.ShapeType() == TopAbs_VERTEX)
-                    mkTS.AddVertex(TopoDS::Vertex(singleWire));
-                else
-                    mkTS.AddWire(TopoDS::Wire(singleWire));
+                shells[i] = mkTS.Shape();
             }
-            mkTS.Build();
-            if (!mkTS.IsDone())
-                Standard_Failure::Raise("Extrusion: Loft could not be built");
-
-            shells.push_back(mkTS.Shape());
-        }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        Base::rethrowFirstException(errors);
 
         if (isSolid) {
             // we only need to cut if we have inner wires
@@ -481,10 +457,36 @@ void ExtrusionHelper::createTaperedPrismOffset(TopoDS_Wire sourceWire,
 
 }
 
-void ExtrusionHelper::makeElementDraft(const ExtrusionParameters& params,
-                                       const TopoShape& _shape,
-                                       std::vector<TopoShape>& drafts,
-                                       App::StringHasherRef hasher)
+namespace {
+
+// the source wire of a drafted extrusion and its loft, the loft only uses OCC
+// and can therefore be made for several wires at the same time
+struct DraftLoft
+{
+    TopoShape sourceWire;
+    TopoDS_Wire offsetRev;
+    TopoDS_Wire offsetFwd;
+    bool bRev {false};
+    bool bMid {false};
+    bool bFwd {false};
+    std::unique_ptr<BRepOffsetAPI_ThruSections> generator;
+};
+
+TopoShape makeDraftSourceWire(const TopoShape& shape)
+{
+    ShapeFix_Wire aFix;
+    aFix.Load(TopoDS::Wire(shape.getShape()));
+    aFix.FixReorder();
+    aFix.FixConnected();
+    aFix.FixClosed();
+    TopoShape sourceWire;
+    sourceWire.setShape(aFix.Wire());
+    sourceWire.Tag = shape.Tag;
+    sourceWire.mapSubElement(shape);
+    return sourceWire;
+}
+
+void buildDraftLoft(const ExtrusionParameters& params, DraftLoft& loft)
 {
     double distanceFwd = tan(params.taperAngleFwd) * params.lengthFwd;
     double distanceRev = tan(params.taperAngleRev) * params.lengthRev;
@@ -496,9 +498,73 @@ void ExtrusionHelper::makeElementDraft(const ExtrusionParameters& params,
     bool bRev = fabs(params.lengthRev) > Precision::Confusion();
     bool bMid = !bFwd || !bRev
         || params.lengthFwd * params.lengthRev > 0.0;  // include the source shape as loft section?
+    loft.bRev = bRev;
+    loft.bMid = bMid;
+    loft.bFwd = bFwd;
+
+    const TopoDS_Wire& sourceWire = TopoDS::Wire(loft.sourceWire.getShape());
+    if (bRev) {
+        ExtrusionHelper::createTaperedPrismOffset(sourceWire, vecRev, distanceRev, false, loft.offsetRev);
+    }
+    if (bFwd) {
+        ExtrusionHelper::createTaperedPrismOffset(sourceWire, vecFwd, distanceFwd, false, loft.offsetFwd);
+    }
+
+    try {
+        // make loft, the order of the sections is important
+        loft.generator = std::make_unique<BRepOffsetAPI_ThruSections>(
+            params.solid ? Standard_True : Standard_False,
+            /*ruled=*/Standard_True);
+        if (bRev) {
+            loft.generator->AddWire(loft.offsetRev);
+        }
+        if (bMid) {
+            loft.generator->AddWire(sourceWire);
+        }
+        if (bFwd) {
+            loft.generator->AddWire(loft.offsetFwd);
+        }
+        loft.generator->Build();
+    }
+    catch (Standard_Failure&) {
+        throw;
+    }
+    catch (...) {
+        throw Base::CADKernelError("Unknown exception from BRepOffsetAPI_ThruSections");
+    }
+}
+
+TopoShape makeDraftShape(const DraftLoft& loft, App::StringHasherRef hasher)
+{
+    std::vector<TopoShape> list_of_sections;
+    if (loft.bRev) {
+        list_of_sections.emplace_back(loft.offsetRev, loft.sourceWire.Tag);
+    }
+    if (loft.bMid) {
+        list_of_sections.push_back(loft.sourceWire);
+    }
+    if (loft.bFwd) {
+        list_of_sections.emplace_back(loft.offsetFwd, loft.sourceWire.Tag);
+    }
+
+    try {
+        return TopoShape(0, hasher).makeElementShape(*loft.generator, list_of_sections);
+    }
+    catch (Standard_Failure&) {
+        throw;
+    }
+    catch (...) {
+        throw Base::CADKernelError("Unknown exception from BRepOffsetAPI_ThruSections");
+    }
+}
 
+// reduce the shape to what gets extruded: a wire, a compound or an outer wire with
+// the inner wires of a face
+TopoShape prepareDraftShape(const ExtrusionParameters& params,
+                            const TopoShape& _shape,
+                            std::vector<TopoShape>& innerWires)
+{
     TopoShape shape = _shape;
-    TopoShape sourceWire;
     if (shape.isNull()) {
         Standard_Failure::Raise("Not a valid shape");
     }
@@ -508,103 +574,115 @@ void ExtrusionHelper::makeElementDraft(const ExtrusionParameters& params,
     }
 
     if (shape.shapeType() == TopAbs_FACE) {
-        std::vector<TopoShape> wires;
-        TopoShape outerWire = shape.splitWires(&wires, TopoShape::ReorientForward);
+        TopoShape outerWire = shape.splitWires(&innerWires, TopoShape::ReorientForward);
         if (outerWire.isNull()) {
             Standard_Failure::Raise("Missing outer wire");
         }
-        if (wires.empty()) {
-            shape = outerWire;
-        }
-        else {
-            unsigned pos = drafts.size();
-            makeElementDraft(params, outerWire, drafts, hasher);
-            if (drafts.size() != pos + 1) {
-                Standard_Failure::Raise("Failed to make drafted extrusion");
-            }
-            std::vector<TopoShape> inner;
-            TopoShape innerWires(0);
-            innerWires.makeElementCompound(
-                wires,
-                "",
-                TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
-            makeElementDraft(params, innerWires, inner, hasher);
-            if (inner.empty()) {
-                Standard_Failure::Raise("Failed to make drafted extrusion with inner hole");
-            }
-            inner.insert(inner.begin(), drafts.back());
-            drafts.back().makeElementCut(inner);
-            return;
-        }
+        shape = outerWire;
     }
+    return shape;
+}
 
-    if (shape.shapeType() == TopAbs_WIRE) {
-        ShapeFix_Wire aFix;
-        aFix.Load(TopoDS::Wire(shape.getShape()));
-        aFix.FixReorder();
-        aFix.FixConnected();
-        aFix.FixClosed();
-        sourceWire.setShape(aFix.Wire());
-        sourceWire.Tag = shape.Tag;
-        sourceWire.mapSubElement(shape);
-    }
-    else if (shape.shapeType() == TopAbs_COMPOUND) {
-        for (auto& s : shape.getSubTopoShapes()) {
-            makeElementDraft(params, s, drafts, hasher);
+void makeElementDraftOfShape(const ExtrusionParameters& params,
+                             const TopoShape& shape,
+                             const std::vector<TopoShape>& innerWires,
+                             std::vector<TopoShape>& drafts,
+                             App::StringHasherRef hasher);
+
+void makeElementDrafts(const ExtrusionParameters& params,
+                       const std::vector<TopoShape>& subShapes,
+                       std::vector<TopoShape>& drafts,
+                       App::StringHasherRef hasher)
+{
+    std::vector<TopoShape> shapes(subShapes.size());
+    std::vector<std::vector<TopoShape>> innerWires(subShapes.size());
+    std::vector<DraftLoft> lofts(subShapes.size());
+    std::vector<int> wires;
+    for (std::size_t i = 0; i < subShapes.size(); ++i) {
+        shapes[i] = prepareDraftShape(params, subShapes[i], innerWires[i]);
+        if (innerWires[i].empty() && shapes[i].shapeType() == TopAbs_WIRE) {
+            lofts[i].sourceWire = makeDraftSourceWire(shapes[i]);
+            wires.push_back(static_cast<int>(i));
         }
     }
-    else {
-        Standard_Failure::Raise("Only a wire or a face is supported");
-    }
 
-    if (!sourceWire.isNull()) {
-        std::vector<TopoShape> list_of_sections;
-        if (bRev) {
-            TopoDS_Wire offsetWire;
-            createTaperedPrismOffset(TopoDS::Wire(sourceWire.getShape()),
-                                     vecRev,
-                                     distanceRev,
-                                     false,
-                                     offsetWire);
-            list_of_sections.push_back(TopoShape(offsetWire, sourceWire.Tag));
+    // The element mapping is not thread safe, only the lofts are made at the
+    // same time. The drafts are then mapped in the order of the sub-shapes.
+    std::vector<std::exception_ptr> errors(subShapes.size());
+    OSD_Parallel::For(0, static_cast<int>(wires.size()), [&](int i) {
+        try {
+            buildDraftLoft(params, lofts[wires[i]]);
+        }
+        catch (...) {
+            errors[wires[i]] = std::current_exception();
         }
+    });
+    Base::rethrowFirstException(errors);
 
-        // next. Add source wire as middle section. Order is important.
-        if (bMid) {
-            list_of_sections.push_back(sourceWire);
+    for (std::size_t i = 0; i < subShapes.size(); ++i) {
+        if (lofts[i].generator) {
+            drafts.push_back(makeDraftShape(lofts[i], hasher));
+        }
+        else {
+            makeElementDraftOfShape(params, shapes[i], innerWires[i], drafts, hasher);
         }
+    }
+}
 
-        // finally. Forward extrusion offset wire.
-        if (bFwd) {
-            TopoDS_Wire offsetWire;
-            createTaperedPrismOffset(TopoDS::Wire(sourceWire.getShape()),
-                                     vecFwd,
-                                     distanceFwd,
-                                     false,
-                                     offsetWire);
-            list_of_sections.push_back(TopoShape(offsetWire, sourceWire.Tag));
+void makeElementDraftOfShape(const ExtrusionParameters& params,
+                             const TopoShape& shape,
+                             const std::vector<TopoShape>& innerWires,
+                             std::vector<TopoShape>& drafts,
+                             App::StringHasherRef hasher)
+{
+    if (!innerWires.empty()) {
+        unsigned pos = drafts.size();
+        ExtrusionHelper::makeElementDraft(params, shape, drafts, hasher);
+        if (drafts.size() != pos + 1) {
+            Standard_Failure::Raise("Failed to make drafted extrusion");
+        }
+        std::vector<TopoShape> inner;
+        TopoShape innerCompound(0);
+        innerCompound.makeElementCompound(
+            innerWires,
+            "",
+            TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
+        ExtrusionHelper::makeElementDraft(params, innerCompound, inner, hasher);
+        if (inner.empty()) {
+            Standard_Failure::Raise("Failed to make drafted extrusion with inner hole");
         }
+        inner.insert(inner.begin(), drafts.back());
+        drafts.back().makeElementCut(inner);
+        return;
+    }
 
-        try {
+    if (shape.shapeType() == TopAbs_WIRE) {
+        DraftLoft loft;
+        loft.sourceWire = makeDraftSourceWire(shape);
+        {
 #if defined(__GNUC__) && defined(FC_OS_LINUX)
             Base::SignalException se;
 #endif
-
-            // make loft
-            BRepOffsetAPI_ThruSections mkGenerator(params.solid ? Standard_True : Standard_False,
-                                                   /*ruled=*/Standard_True);
-            for (auto& s : list_of_sections) {
-                mkGenerator.AddWire(TopoDS::Wire(s.getShape()));
-            }
-
-            mkGenerator.Build();
-            drafts.push_back(TopoShape(0, hasher).makeElementShape(mkGenerator, list_of_sections));
-        }
-        catch (Standard_Failure&) {
-            throw;
-        }
-        catch (...) {
-            throw Base::CADKernelError("Unknown exception from BRepOffsetAPI_ThruSections");
+            buildDraftLoft(params, loft);
+            drafts.push_back(makeDraftShape(loft, hasher));
         }
     }
+    else if (shape.shapeType() == TopAbs_COMPOUND) {
+        makeElementDrafts(params, shape.getSubTopoShapes(), drafts, hasher);
+    }
+    else {
+        Standard_Failure::Raise("Only a wire or a face is supported");
+    }
+}
+
+}
+
+void ExtrusionHelper::makeElementDraft(const ExtrusionParameters& params,
+                                       const TopoShape& _shape,
+                                       std::vector<TopoShape>& drafts,
+                                       App::StringHasherRef hasher)
+{
+    std::vector<TopoShape> innerWires;
+    TopoShape shape = prepareDraftShape(params, _shape, innerWires);
+    makeElementDraftOfShape(params, shape, innerWires, drafts, hasher);
 }
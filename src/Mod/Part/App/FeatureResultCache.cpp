@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cstring>
+#include <functional>
+#include <iterator>
+#endif
+
+#include <App/Application.h>
+#include <App/GeoFeature.h>
+#include <App/GeoFeatureGroupExtension.h>
+#include <Base/Writer.h>
+
+#include "FeatureResultCache.h"
+#include "PartFeature.h"
+#include "ShapeMapHasher.h"
+
+
+using namespace Part;
+
+namespace
+{
+
+void hashCombine(std::size_t& seed, std::size_t value)
+{
+    // copied from boost::hash_combine
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+bool isKeyProperty(const App::Property* prop)
+{
+    if (prop->isDerivedFrom<PropertyPartShape>()
+        || (prop->getContainer()->getPropertyType(prop)
+            & (App::Prop_Output | App::Prop_Transient))) {
+        return false;
+    }
+    const char* name = prop->getName();
+    return name && std::strcmp(name, "Label") != 0 && std::strcmp(name, "Label2") != 0
+        && std::strcmp(name, "Visibility") != 0;
+}
+
+ParameterGrp::handle getParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+}
+
+}  // namespace
+
+FeatureResultCache& FeatureResultCache::instance()
+{
+    static FeatureResultCache cache;
+    return cache;
+}
+
+FeatureResultCache::FeatureResultCache()
+{
+    // NOLINTNEXTLINE
+    memoryBudget = getParameter()->GetUnsigned("FeatureResultCacheSize", 256) * 1024 * 1024;
+    App::GetApplication().signalDeletedObject.connect([](const App::DocumentObject& obj) {
+        FeatureResultCache::instance().remove(&obj);
+    });
+    // closing a document doesn't signal the deletion of its objects
+    App::GetApplication().signalDeleteDocument.connect([](const App::Document& doc) {
+        FeatureResultCache::instance().remove(&doc);
+    });
+}
+
+bool FeatureResultCache::isEnabled() const
+{
+    return getParameter()->GetBool("FeatureResultCache", false);
+}
+
+bool FeatureResultCache::Key::operator==(const Key& other) const
+{
+    if (feature != other.feature || hash != other.hash || inputs.size() != other.inputs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        if (!inputs[i].IsEqual(other.inputs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+FeatureResultCache::Key FeatureResultCache::makeKey(const Feature* feature)
+{
+    Key key;
+    key.feature = feature;
+    key.hash = std::hash<std::string> {}(feature->getTypeId().getName());
+
+    std::vector<App::Property*> props;
+    feature->getPropertyList(props);
+    Base::StringWriter writer;
+    for (auto prop : props) {
+        if (isKeyProperty(prop)) {
+            writer.Stream() << prop->getName() << '\n';
+            prop->Save(writer);
+        }
+    }
+    hashCombine(key.hash, std::hash<std::string> {}(writer.getString()));
+    hashCombine(key.hash, std::hash<std::string> {}(feature->getResultCacheKey()));
+
+    // the body of a PartDesign feature links to all features of the body
+    auto group = App::GeoFeatureGroupExtension::getGroupOfObject(feature);
+    for (auto obj : feature->getOutList()) {
+        if (obj == group) {
+            continue;
+        }
+        hashCombine(key.hash, std::hash<std::string> {}(obj->getFullName()));
+        if (obj->isDerivedFrom<Feature>()) {
+            std::vector<App::Property*> linkedProps;
+            obj->getPropertyList(linkedProps);
+            for (auto prop : linkedProps) {
+                if (auto shapeProp = freecad_cast<PropertyPartShape*>(prop)) {
+                    const TopoDS_Shape& shape = shapeProp->getValue();
+                    hashCombine(key.hash, shape.IsNull() ? 0 : ShapeMapHasher {}(shape));
+                    key.inputs.push_back(shape);
+                }
+            }
+        }
+        else if (auto geo = freecad_cast<App::GeoFeature*>(obj)) {
+            Base::StringWriter placement;
+            geo->Placement.Save(placement);
+            hashCombine(key.hash, std::hash<std::string> {}(placement.getString()));
+        }
+    }
+    return key;
+}
+
+bool FeatureResultCache::restore(Feature* feature)
+{
+    Key key = makeKey(feature);
+    auto range = index.equal_range(key.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto entry = it->second;
+        if (!(entry->key == key)) {
+            continue;
+        }
+        for (const auto& result : entry->results) {
+            auto prop = freecad_cast<PropertyPartShape*>(
+                feature->getPropertyByName(result.first.c_str()));
+            if (!prop) {
+                return false;
+            }
+            prop->setValue(result.second);
+        }
+        entries.splice(entries.begin(), entries, entry);
+        return true;
+    }
+    return false;
+}
+
+void FeatureResultCache::store(const Feature* feature)
+{
+    Entry entry;
+    entry.key = makeKey(feature);
+    auto range = index.equal_range(entry.key.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->key == entry.key) {
+            memoryUsed -= it->second->memSize;
+            entries.erase(it->second);
+            index.erase(it);
+            break;
+        }
+    }
+
+    std::vector<App::Property*> props;
+    feature->getPropertyList(props);
+    for (auto prop : props) {
+        if (auto shapeProp = freecad_cast<PropertyPartShape*>(prop)) {
+            entry.results.emplace_back(prop->getName(), shapeProp->getShape());
+            entry.memSize += shapeProp->getMemSize();
+        }
+    }
+    if (entry.memSize > memoryBudget) {
+        return;
+    }
+    memoryUsed += entry.memSize;
+    std::size_t hash = entry.key.hash;
+    entries.push_front(std::move(entry));
+    index.emplace(hash, entries.begin());
+    limitMemory();
+}
+
+void FeatureResultCache::remove(const App::DocumentObject* obj)
+{
+    for (auto it = index.begin(); it != index.end();) {
+        if (it->second->key.feature == obj) {
+            memoryUsed -= it->second->memSize;
+            entries.erase(it->second);
+            it = index.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void FeatureResultCache::remove(const App::Document* doc)
+{
+    for (auto it = index.begin(); it != index.end();) {
+        if (it->second->key.feature->getDocument() == doc) {
+            memoryUsed -= it->second->memSize;
+            entries.erase(it->second);
+            it = index.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void FeatureResultCache::clear()
+{
+    index.clear();
+    entries.clear();
+    memoryUsed = 0;
+}
+
+void FeatureResultCache::setMemoryBudget(std::size_t bytes)
+{
+    memoryBudget = bytes;
+    limitMemory();
+}
+
+void FeatureResultCache::limitMemory()
+{
+    while (memoryUsed > memoryBudget && !entries.empty()) {
+        auto last = std::prev(entries.end());
+        auto range = index.equal_range(last->key.hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                index.erase(it);
+                break;
+            }
+        }
+        memoryUsed -= last->memSize;
+        entries.pop_back();
+    }
+}
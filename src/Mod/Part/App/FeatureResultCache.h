@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PART_FEATURERESULTCACHE_H
+#define PART_FEATURERESULTCACHE_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace App
+{
+class Document;
+class DocumentObject;
+}
+
+namespace Part
+{
+
+class Feature;
+
+/** Cache of the results of shape features
+ *
+ * Recomputing a feature whose inputs didn't change, e.g. after undo/redo or
+ * when touching all objects, restores its last result with these inputs from
+ * here. The key is made from the type and the saved property values of the
+ * feature and the shapes of the objects it links to. Only shape properties are
+ * restored, see Feature::canCacheResult() for the features that may be cached.
+ *
+ * The cache is off by default, it's turned on with the parameter
+ * FeatureResultCache of Mod/Part/General. The least recently used results are
+ * dropped when the results take more than FeatureResultCacheSize MB.
+ */
+class PartExport FeatureResultCache
+{
+public:
+    static FeatureResultCache& instance();
+
+    bool isEnabled() const;
+    /// Sets the shape properties of \a feature to its cached result, returns false if there is none
+    bool restore(Feature* feature);
+    /// Stores the shape properties of \a feature as the result of its current inputs
+    void store(const Feature* feature);
+    /// Drops all results of \a obj
+    void remove(const App::DocumentObject* obj);
+    /// Drops all results of the objects of \a doc
+    void remove(const App::Document* doc);
+    void clear();
+
+    /// Number of cached results
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+    /// Estimated memory of the cached results in bytes
+    std::size_t memSize() const
+    {
+        return memoryUsed;
+    }
+    void setMemoryBudget(std::size_t bytes);
+
+private:
+    struct Key
+    {
+        const Feature* feature = nullptr;
+        std::size_t hash = 0;
+        // the shapes of the linked objects, compared on a hit
+        std::vector<TopoDS_Shape> inputs;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::vector<std::pair<std::string, TopoShape>> results;
+        std::size_t memSize = 0;
+    };
+
+    FeatureResultCache();
+    static Key makeKey(const Feature* feature);
+    void limitMemory();
+
+private:
+    // most recently used first
+    std::list<Entry> entries;
+    std::unordered_multimap<std::size_t, std::list<Entry>::iterator> index;
+    std::size_t memoryUsed = 0;
+    std::size_t memoryBudget = 0;
+};
+
+}  // namespace Part
+
+#endif  // PART_FEATURERESULTCACHE_H
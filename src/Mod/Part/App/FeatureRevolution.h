@@ -53,6 +53,9 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn *execute() override;
     short mustExecute() const override;
+    bool canCacheResult() const override {
+        return true;
+    }
 
     void onChanged(const App::Property* prop) override;
 
@@ -101,7 +101,8 @@ Base::Axis Part2DObject::getAxis(int axId) const
 bool Part2DObject::seekTrimPoints(const std::vector<Geometry *> &geomlist,
                                   int geometryIndex, const Base::Vector3d &point,
                                   int &geometryIndex1, Base::Vector3d &intersect1,
-                                  int &geometryIndex2, Base::Vector3d &intersect2)
+                                  int &geometryIndex2, Base::Vector3d &intersect2,
+                                  const std::vector<int> *candidates)
 {
     if ( geometryIndex >= int(geomlist.size()))
         return false;
@@ -137,7 +138,9 @@ bool Part2DObject::seekTrimPoints(const std::vector<Geometry *> &geomlist,
     double param1=-1e10,param2=1e10;
     gp_Pnt2d p1,p2;
     Handle(Geom2d_Curve) secondaryCurve;
-    for (int id=0; id < int(geomlist.size()); id++) {
+    int count = candidates ? int(candidates->size()) : int(geomlist.size());
+    for (int k=0; k < count; k++) {
+        int id = candidates ? (*candidates)[k] : k;
         // #0000624: Trim tool doesn't work with construction lines
         if (id != geometryIndex/* && !geomlist[id]->Construction*/) {
             geom = (geomlist[id])->handle();
@@ -72,11 +72,15 @@ public:
       * the curve geometryIndex.
       *
       * If intersection is found, the associated geometryIndex1 or geometryIndex2 returns -1.
+      *
+      * If candidates is given, only the curves with these indexes, in ascending order, are
+      * tested, e.g. those whose bounding box overlaps the one of the curve geometryIndex.
       */
     static bool seekTrimPoints(const std::vector<Geometry *> &geomlist,
                                int geometryIndex, const Base::Vector3d &point,
                                int &geometryIndex1, Base::Vector3d &intersect1,
-                               int &geometryIndex2, Base::Vector3d &intersect2);
+                               int &geometryIndex2, Base::Vector3d &intersect2,
+                               const std::vector<int> *candidates = nullptr);
 
     static const int H_Axis;
     static const int V_Axis;
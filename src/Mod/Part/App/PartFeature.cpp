@@ -72,10 +72,12 @@
 #include <Base/Tools.h>
 #include <Mod/Material/App/MaterialManager.h>
 
+#include "FeatureResultCache.h"
 #include "Geometry.h"
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
 #include "PartPyCXX.h"
+#include "ShapeCache.h"
 #include "TopoShapePy.h"
 #include "Tools.h"
 
@@ -103,8 +105,23 @@ short Feature::mustExecute() const
 
 App::DocumentObjectExecReturn *Feature::recompute()
 {
+    auto& cache = FeatureResultCache::instance();
+    bool useCache = canCacheResult() && !hasExtensions() && !getPropertyByName("Proxy")
+        && cache.isEnabled();
+    if (useCache) {
+        Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> exe(App::Recompute, this);
+        if (cache.restore(this)) {
+            onCachedResultRestored();
+            return App::DocumentObject::StdReturn;
+        }
+    }
+
     try {
-        return App::GeoFeature::recompute();
+        auto ret = App::GeoFeature::recompute();
+        if (useCache && ret == App::DocumentObject::StdReturn) {
+            cache.store(this);
+        }
+        return ret;
     }
     catch (Standard_Failure& e) {
 
@@ -430,13 +447,12 @@ App::DocumentObject* Feature::getSubObject(const char* subname,
             ts = ts.getSubTopoShape(subname,true);
         }
         if (doTransform && !ts.isNull()) {
-            static int sCopy = -1;
-            if (sCopy < 0) {
-                ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
-                    "User parameter:BaseApp/Preferences/Mod/Part/General");
-                sCopy = hGrp->GetBool("CopySubShape", false) ? 1 : 0;
-            }
-            bool copy = sCopy ? true : false;
+            static ParameterValue<bool> copySubShape(
+                App::GetApplication().GetParameterGroupByPath(
+                    "User parameter:BaseApp/Preferences/Mod/Part/General"),
+                "CopySubShape",
+                false);
+            bool copy = copySubShape.getValue();
             if (!copy) {
                 // Work around OCC bug on transforming circular edge with an
                 // offset surface. The bug probably affect other shape type,
@@ -892,9 +908,8 @@ void Feature::setMaterialAppearance(const App::Material& material)
     }
 }
 
-// Toponaming project March 2024:  This method should be going away when we get to the python layer.
 void Feature::clearShapeCache() {
-//    _ShapeCache.cache.clear();
+    ShapeCache::instance().clear();
 }
 
 /*
@@ -993,7 +1008,7 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
                     if (obj->getDocument() != linked->getDocument()
                         || mat.hasScale() != Base::ScaleType::NoScaling
                         || (linked != owner && linkMat.hasScale() != Base::ScaleType::NoScaling)) {
-                        PropertyShapeCache::setShape(obj, shape, subname);
+                        PropertyShapeCache::setShape(obj, shape, subname, linked);
                     }
                 }
                 if (options.testFlag(ShapeOption::NoElementMap)) {
@@ -1093,11 +1108,11 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
             bool scaled = shape.transformShape(mat, false, true);
             if (owner->getDocument() != obj->getDocument()) {
                 shape.reTagElementMap(obj->getID(), obj->getDocument()->getStringHasher());
-                PropertyShapeCache::setShape(obj, shape, subname);
+                PropertyShapeCache::setShape(obj, shape, subname, owner);
             }
             else if (scaled
                      || (linked != owner && linkMat.hasScale() != Base::ScaleType::NoScaling)) {
-                PropertyShapeCache::setShape(obj, shape, subname);
+                PropertyShapeCache::setShape(obj, shape, subname, owner);
             }
         }
         if (!shape.isNull()) {
@@ -1249,7 +1264,7 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
             scaled = true;  // force cache
         }
         if (canCache(obj) && scaled) {
-            PropertyShapeCache::setShape(obj, shape, subname);
+            PropertyShapeCache::setShape(obj, shape, subname, owner);
         }
     }
     if (options.testFlag(ShapeOption::NoElementMap)) {
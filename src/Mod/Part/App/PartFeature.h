@@ -168,6 +168,23 @@ public:
 
     bool getCameraAlignmentDirection(Base::Vector3d &directionZ, Base::Vector3d &directionX, const char *subname) const override;
 
+    /** Whether the result of the feature may be taken from the FeatureResultCache
+     *
+     * A feature returns true if its shape properties only depend on its own
+     * saved properties and the shapes of the objects it links to.
+     */
+    virtual bool canCacheResult() const {
+        return false;
+    }
+    /** What the result depends on besides the saved properties and the linked shapes
+     *
+     * Added to the key of the FeatureResultCache, e.g. the properties of a
+     * parent or the preferences that execute() reads.
+     */
+    virtual std::string getResultCacheKey() const {
+        return {};
+    }
+
     static void guessNewLink(std::string &replacementName, DocumentObject *base, const char *oldLink);
 
     const std::vector<std::string>& searchElementCache(const std::string &element,
@@ -182,6 +199,8 @@ protected:
     void onBeforeChange(const App::Property* prop) override;
     void onChanged(const App::Property* prop) override;
     void onDocumentRestored() override;
+    /// Called instead of execute() after the shapes were restored from the FeatureResultCache
+    virtual void onCachedResultRestored() {}
 
     void copyMaterial(Feature* feature);
     void copyMaterial(App::DocumentObject* link);
@@ -228,6 +247,9 @@ public:
 
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
+    bool canCacheResult() const override {
+        return true;
+    }
     void onUpdateElementReference(const App::Property* prop) override;
 
 protected:
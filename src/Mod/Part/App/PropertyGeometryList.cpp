@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <OSD_Parallel.hxx>
+#endif
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -37,6 +40,11 @@ using namespace Base;
 using namespace std;
 using namespace Part;
 
+namespace {
+// below this number of geometries cloning them in parallel doesn't pay off
+const std::size_t minParallelClones = 64;
+}
+
 
 //**************************************************************************
 // PropertyGeometryList
@@ -87,15 +95,21 @@ void PropertyGeometryList::setValues(const std::vector<Geometry*>& lValue)
     auto copy = lValue;
     aboutToSetValue();
     std::sort(_lValueList.begin(), _lValueList.end());
-    for (auto & geo : copy) {
-        auto range = std::equal_range(_lValueList.begin(), _lValueList.end(), geo);
+    std::vector<std::size_t> clones;
+    for (std::size_t i = 0; i < copy.size(); i++) {
+        auto range = std::equal_range(_lValueList.begin(), _lValueList.end(), copy[i]);
         // clone if the new entry does not exist in the original value list, or
         // else, simply reuse it (i.e. erase it so that it won't get deleted below).
         if (range.first == range.second)
-            geo = geo->clone();
+            clones.push_back(i);
         else
             _lValueList.erase(range.first, range.second);
     }
+    // The clones are independent of each other. This is what Copy() and Paste()
+    // spend their time on for the undo of a large sketch.
+    OSD_Parallel::For(0, static_cast<int>(clones.size()), [&copy, &clones](int i) {
+        copy[clones[i]] = copy[clones[i]]->clone();
+    }, clones.size() < minParallelClones);
     for (auto v : _lValueList)
         delete v;
     _lValueList = std::move(copy);
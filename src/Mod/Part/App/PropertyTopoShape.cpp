@@ -49,6 +49,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PropertyTopoShape.h"
+#include "ShapeCache.h"
 #include "TopoShapePy.h"
 #include "PartFeature.h"
 
@@ -65,8 +66,24 @@ PropertyPartShape::~PropertyPartShape() = default;
 
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
+    _DeferredFile.reset();
     aboutToSetValue();
     _Shape = sh;
+    updateTag();
+    hasSetValue();
+    _Ver.clear();
+}
+
+void PropertyPartShape::hasSetValue()
+{
+    // the cached shapes made from the old shape are outdated
+    if (auto obj = freecad_cast<App::DocumentObject*>(getContainer()))
+        ShapeCache::instance().touchShape(obj);
+    PropertyComplexGeoData::hasSetValue();
+}
+
+void PropertyPartShape::updateTag()
+{
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if(obj) {
         auto tag = obj->getID();
@@ -80,12 +97,11 @@ void PropertyPartShape::setValue(const TopoShape& sh)
             _Shape.hashChildMaps();
         }
     }
-    hasSetValue();
-    _Ver.clear();
 }
 
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
+    _DeferredFile.reset();
     aboutToSetValue();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if(obj)
@@ -97,11 +113,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    restoreDeferred();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    restoreDeferred();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -118,12 +136,14 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    restoreDeferred();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
 
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
+    restoreDeferred();
     Base::BoundBox3d box;
     if (_Shape.getShape().IsNull())
         return box;
@@ -150,16 +170,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    restoreDeferred();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -167,6 +190,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    restoreDeferred();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -203,6 +227,7 @@ void PropertyPartShape::setPyObject(PyObject *value)
 
 App::Property *PropertyPartShape::Copy() const
 {
+    restoreDeferred();
     PropertyPartShape *prop = new PropertyPartShape();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
@@ -221,6 +246,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if(prop) {
+        prop->restoreDeferred();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -228,7 +254,8 @@ void PropertyPartShape::Paste(const App::Property &from)
 
 unsigned int PropertyPartShape::getMemSize () const
 {
-    return _Shape.getMemSize();
+    // the shape of a deferred file takes at least as much memory once restored
+    return _Shape.getMemSize() + _DeferredFile.getSize();
 }
 
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) const
@@ -247,6 +274,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    restoreDeferred();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
@@ -259,6 +287,7 @@ void PropertyPartShape::beforeSave() const
 }
 void PropertyPartShape::Save (Base::Writer &writer) const
 {
+    restoreDeferred();
     //See SaveDocFile(), RestoreDocFile()
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
@@ -289,7 +318,8 @@ void PropertyPartShape::Save (Base::Writer &writer) const
                         << "\"/>\n";
     } else if(binary) {
         writer.Stream() << " binary=\"1\">\n";
-        _Shape.exportBinary(writer.beginCharStream(Base::CharStreamFormat::Base64Encoded));
+        _Shape.exportBinary(writer.beginCharStream(Base::CharStreamFormat::Base64Encoded),
+                            writer.getMode("BrepTriangulation"));
         writer.endCharStream() <<  writer.ind() << "</Part>\n";
     } else {
         writer.Stream() << " brep=\"1\">\n";
@@ -504,7 +534,7 @@ void PropertyPartShape::saveToFile(Base::Writer &writer) const
     fi.deleteFile();
 }
 
-void PropertyPartShape::loadFromFile(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromFile(Base::Reader &reader)
 {
     BRep_Builder builder;
     // create a temporary file and copy the content from the zip stream
@@ -544,26 +574,27 @@ void PropertyPartShape::loadFromFile(Base::Reader &reader)
 
     // delete the temp file
     fi.deleteFile();
-    setValue(shape);
+    return shape;
 }
 
-void PropertyPartShape::loadFromStream(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromStream(Base::Reader &reader)
 {
+    TopoDS_Shape shape;
     try {
         reader.exceptions(std::istream::failbit | std::istream::badbit);
         BRep_Builder builder;
-        TopoDS_Shape shape;
         BRepTools::Read(shape, reader, builder);
-        setValue(shape);
     }
     catch (const std::exception&) {
         if (!reader.eof())
             Base::Console().warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
     }
+    return shape;
 }
 
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
+    restoreDeferred();
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull())
@@ -572,7 +603,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), writer.getMode("BrepTriangulation"));
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
@@ -590,22 +621,22 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 
 void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
 {
-
-    // save the element map
-    auto elementMap = _Shape.resetElementMap();
-    auto hasher = _Shape.Hasher;
-
-    Base::FileInfo brep(reader.getFileName());
-    TopoShape shape;
-
     // In LS3 the following statement is executed right before shape.Hasher = hasher;
     // https://github.com/realthunder/FreeCAD/blob/a9810d509a6f112b5ac03d4d4831b67e6bffd5b7/src/Mod/Part/App/PropertyTopoShape.cpp#L639
-    // Now it's not possible anymore because both PropertyPartShape::loadFromFile() and
-    // PropertyPartShape::loadFromStream() calls PropertyPartShape::setValue() which clears the
+    // Now it's not possible anymore because PropertyPartShape::setValue() clears the
     // value of _Ver.
     // Therefore we're storing the value of _Ver here so that we don't lose it.
 
     std::string ver = _Ver;
+    TopoShape shape = readDocFile(reader);
+    setValue(shape);
+    _Ver = ver;
+}
+
+TopoShape PropertyPartShape::readDocFile(Base::Reader &reader)
+{
+    Base::FileInfo brep(reader.getFileName());
+    TopoShape shape;
 
     if (brep.hasExtension("bin")) {
         shape.importBinary(reader);
@@ -614,21 +645,69 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
         bool direct = App::GetApplication().GetParameterGroupByPath
             ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
         if (!direct) {
-            loadFromFile(reader);
+            shape.setShape(loadFromFile(reader));
         }
         else {
             auto iostate = reader.exceptions();
-            loadFromStream(reader);
+            shape.setShape(loadFromStream(reader));
             reader.exceptions(iostate);
         }
-        shape = getValue();
     }
 
-    // restore the element map
-    shape.Hasher = hasher;
+    adoptElementMap(shape);
+    return shape;
+}
+
+void PropertyPartShape::adoptElementMap(TopoShape &shape)
+{
+    // keep the element map restored from the document
+    auto elementMap = _Shape.resetElementMap();
+    shape.Hasher = _Shape.Hasher;
     shape.resetElementMap(elementMap);
-    setValue(shape);
-    _Ver = ver;
+}
+
+Base::Persistence::DocFileDecoder PropertyPartShape::getDocFileDecoder()
+{
+    bool direct = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+    // the shape is read from a temporary file otherwise
+    if (!direct)
+        return {};
+
+    return [this](Base::Reader &reader) -> std::function<void()> {
+        auto shape = std::make_shared<TopoShape>();
+        if (Base::FileInfo(reader.getFileName()).hasExtension("bin")) {
+            shape->importBinary(reader);
+        }
+        else {
+            shape->setShape(loadFromStream(reader));
+        }
+
+        return [this, shape]() {
+            // see RestoreDocFile()
+            std::string ver = _Ver;
+            adoptElementMap(*shape);
+            setValue(*shape);
+            _Ver = ver;
+        };
+    };
+}
+
+bool PropertyPartShape::deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file)
+{
+    _DeferredFile.set(file);
+    return true;
+}
+
+void PropertyPartShape::restoreDeferred() const
+{
+    // The shape belongs to the restored document, so it is assigned without notifying the
+    // owner as if it had been read together with the document
+    auto self = const_cast<PropertyPartShape*>(this);
+    _DeferredFile.restore([self](Base::Reader& reader) {
+        self->_Shape = self->readDocFile(reader);
+        self->updateTag();
+    });
 }
 
 // -------------------------------------------------------------------------
@@ -896,7 +975,8 @@ App::Property *PropertyShapeCache::Copy(void) const {
 }
 
 void PropertyShapeCache::Paste(const App::Property &) {
-    cache.clear();
+    if (auto obj = freecad_cast<App::DocumentObject*>(getContainer()))
+        ShapeCache::instance().remove(obj);
 }
 
 void PropertyShapeCache::Save (Base::Writer &) const
@@ -913,8 +993,10 @@ void PropertyShapeCache::Restore(Base::XMLReader &)
  */
 PyObject *PropertyShapeCache::getPyObject() {
     Py::List res;
-    for(auto &v : cache)
-        res.append(Py::TupleN(Py::String(v.first),shape2pyshape(v.second)));
+    if (auto obj = freecad_cast<App::DocumentObject*>(getContainer())) {
+        for(auto &v : ShapeCache::instance().getShapes(obj))
+            res.append(Py::TupleN(Py::String(v.first),shape2pyshape(v.second)));
+    }
     return Py::new_reference_to(res);
 }
 
@@ -923,16 +1005,17 @@ PyObject *PropertyShapeCache::getPyObject() {
  * @param value A python list of entry names
  */
 void PropertyShapeCache::setPyObject(PyObject *value) {
-    if(!value)
+    auto obj = freecad_cast<App::DocumentObject*>(getContainer());
+    if(!value || !obj)
         return;
     if(value == Py_None) {
-        cache.clear();
+        ShapeCache::instance().remove(obj);
         return;
     }
     App::PropertyStringList prop;
     prop.setPyObject(value);
     for(const auto &sub : prop.getValues())
-        cache.erase(sub);
+        ShapeCache::instance().removeShape(obj, sub);
 }
 
 #define SHAPE_CACHE_NAME "_Part_ShapeCache"
@@ -974,16 +1057,10 @@ bool PropertyShapeCache::getShape(const App::DocumentObject *obj, TopoShape &sha
 // that has not been kept:
 //    if (PartParams::getDisableShapeCache())
 //        return false;
-    auto prop = get(obj,false);
-    if(!prop)
+    if(!get(obj,false))
         return false;
     if(!subname) subname = "";
-    auto it = prop->cache.find(subname);
-    if(it!=prop->cache.end()) {
-        shape = it->second;
-        return !shape.isNull();
-    }
-    return false;
+    return ShapeCache::instance().getShape(obj, subname, shape);
 }
 
 /**
@@ -991,9 +1068,11 @@ bool PropertyShapeCache::getShape(const App::DocumentObject *obj, TopoShape &sha
  * @param obj The Object
  * @param shape The shape to cache
  * @param subname The key to point at that shape
+ * @param source The object the shape is made from, if its shape changes the entry is outdated
  */
 void PropertyShapeCache::setShape(
-    const App::DocumentObject *obj, const TopoShape &shape, const char *subname)
+    const App::DocumentObject *obj, const TopoShape &shape, const char *subname,
+    const App::DocumentObject *source)
 {
 // March, 2024 Toponaming project:  There was originally a feature to disable shape cache
 // that has not been kept:
@@ -1003,10 +1082,10 @@ void PropertyShapeCache::setShape(
     if(!prop)
         return;
     if(!subname) subname = "";
-    prop->cache[subname] = shape;
+    ShapeCache::instance().setShape(obj, subname, shape, source);
 }
 
-void PropertyShapeCache::slotChanged(const App::DocumentObject &, const App::Property &prop) {
+void PropertyShapeCache::slotChanged(const App::DocumentObject &obj, const App::Property &prop) {
     auto propName = prop.getName();
     if(!propName) return;
     if(strcmp(propName,"Group")==0 ||
@@ -1014,7 +1093,7 @@ void PropertyShapeCache::slotChanged(const App::DocumentObject &, const App::Pro
         strstr(propName,"Touched")!=0)
     {
         FC_LOG("clear shape cache on changed " << prop.getFullName());
-        cache.clear();
+        ShapeCache::instance().remove(&obj);
     }
 }
 
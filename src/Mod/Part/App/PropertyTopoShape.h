@@ -27,6 +27,7 @@
 #include <vector>
 
 #include <App/PropertyGeo.h>
+#include <Base/Reader.h>
 
 #include "TopoShape.h"
 #include <TopAbs_ShapeEnum.hxx>
@@ -90,6 +91,10 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    /// Defer reading the shape until it is accessed
+    bool deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file) override;
+    /// Parse the shape concurrently with those of other objects
+    DocFileDecoder getDocFileDecoder() override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -106,16 +111,24 @@ public:
 
     friend class Feature;
 
+protected:
+    void hasSetValue() override;
+
 private:
     void saveToFile(Base::Writer &writer) const;
-    void loadFromFile(Base::Reader &reader);
-    void loadFromStream(Base::Reader &reader);
+    TopoDS_Shape loadFromFile(Base::Reader &reader);
+    TopoDS_Shape loadFromStream(Base::Reader &reader);
+    TopoShape readDocFile(Base::Reader &reader);
+    void adoptElementMap(TopoShape &shape);
+    void restoreDeferred() const;
+    void updateTag();
 
 private:
     TopoShape _Shape;
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    mutable Base::LazyDocFile _DeferredFile;
 };
 
 struct PartExport ShapeHistory {
@@ -274,13 +287,14 @@ public:
 
     static PropertyShapeCache *get(const App::DocumentObject *obj, bool create);
     static bool getShape(const App::DocumentObject *obj, TopoShape &shape, const char *subname=0);
-    static void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=0);
+    /// Stores the shape in the ShapeCache, \a source is the object the shape is made from
+    static void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=0,
+                         const App::DocumentObject *source=0);
 
 private:
-    void slotChanged(const App::DocumentObject &, const App::Property &prop);
+    void slotChanged(const App::DocumentObject &obj, const App::Property &prop);
 
 private:
-    std::unordered_map<std::string, TopoShape> cache;
     boost::signals2::scoped_connection connChanged;
 };
 
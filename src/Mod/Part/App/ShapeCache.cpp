@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <iterator>
+#endif
+
+#include <App/Application.h>
+#include <App/DocumentObject.h>
+
+#include "ShapeCache.h"
+
+
+using namespace Part;
+
+ShapeCache& ShapeCache::instance()
+{
+    static ShapeCache cache;
+    return cache;
+}
+
+ShapeCache::ShapeCache()
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    memoryBudget = hGrp->GetUnsigned("ShapeCacheSize", 512) * 1024 * 1024;  // NOLINT
+    App::GetApplication().signalDeletedObject.connect([](const App::DocumentObject& obj) {
+        ShapeCache::instance().forget(&obj);
+    });
+    // closing a document deletes its objects without signalDeletedObject
+    App::GetApplication().signalDeleteDocument.connect([](const App::Document& doc) {
+        ShapeCache::instance().forget(&doc);
+    });
+}
+
+std::uint64_t ShapeCache::getRevision(const App::DocumentObject* obj)
+{
+    // an object gets its first revision when it is used, so an object
+    // created later at the same address doesn't match the entries
+    auto res = revisions.emplace(obj, 0);
+    if (res.second) {
+        res.first->second = ++lastRevision;
+    }
+    return res.first->second;
+}
+
+bool ShapeCache::getShape(const App::DocumentObject* obj,
+                          const std::string& subname,
+                          TopoShape& shape)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto itObj = index.find(obj);
+    if (itObj == index.end()) {
+        ++stats.misses;
+        return false;
+    }
+    auto it = itObj->second.find(subname);
+    if (it == itObj->second.end()) {
+        ++stats.misses;
+        return false;
+    }
+
+    auto entry = it->second;
+    if (entry->source) {
+        auto itRev = revisions.find(entry->source);
+        if (itRev == revisions.end() || itRev->second != entry->revision) {
+            ++stats.outdated;
+            ++stats.misses;
+            erase(entry);
+            return false;
+        }
+    }
+
+    ++stats.hits;
+    entries.splice(entries.begin(), entries, entry);
+    shape = entry->shape;
+    return !shape.isNull();
+}
+
+void ShapeCache::setShape(const App::DocumentObject* obj,
+                          const std::string& subname,
+                          const TopoShape& shape,
+                          const App::DocumentObject* source)
+{
+    if (memoryBudget == 0) {
+        return;
+    }
+    // estimated before locking, it walks the whole shape
+    std::size_t memSize = shape.getMemSize();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& objIndex = index[obj];
+    auto it = objIndex.find(subname);
+    if (it != objIndex.end()) {
+        memoryUsed -= it->second->memSize;
+        entries.erase(it->second);
+        objIndex.erase(it);
+    }
+    if (memSize > memoryBudget) {
+        if (objIndex.empty()) {
+            index.erase(obj);
+        }
+        return;
+    }
+
+    Entry entry;
+    entry.obj = obj;
+    entry.subname = subname;
+    entry.shape = shape;
+    if (source && source != obj) {
+        entry.source = source;
+        entry.revision = getRevision(source);
+    }
+    entry.memSize = memSize;
+    memoryUsed += memSize;
+    entries.push_front(std::move(entry));
+    objIndex.emplace(subname, entries.begin());
+    limitMemory();
+}
+
+std::vector<std::pair<std::string, TopoShape>>
+ShapeCache::getShapes(const App::DocumentObject* obj) const
+{
+    std::vector<std::pair<std::string, TopoShape>> res;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto itObj = index.find(obj);
+    if (itObj != index.end()) {
+        for (const auto& v : itObj->second) {
+            res.emplace_back(v.first, v.second->shape);
+        }
+    }
+    return res;
+}
+
+void ShapeCache::removeShape(const App::DocumentObject* obj, const std::string& subname)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto itObj = index.find(obj);
+    if (itObj == index.end()) {
+        return;
+    }
+    auto it = itObj->second.find(subname);
+    if (it != itObj->second.end()) {
+        erase(it->second);
+    }
+}
+
+void ShapeCache::remove(const App::DocumentObject* obj)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto itObj = index.find(obj);
+    if (itObj == index.end()) {
+        return;
+    }
+    for (const auto& v : itObj->second) {
+        memoryUsed -= v.second->memSize;
+        entries.erase(v.second);
+    }
+    index.erase(itObj);
+}
+
+void ShapeCache::forget(const App::DocumentObject* obj)
+{
+    remove(obj);
+    std::lock_guard<std::mutex> lock(mutex);
+    revisions.erase(obj);
+}
+
+void ShapeCache::forget(const App::Document* doc)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto entry = it++;
+        if (entry->obj->getDocument() == doc
+            || (entry->source && entry->source->getDocument() == doc)) {
+            erase(entry);
+        }
+    }
+    for (auto it = revisions.begin(); it != revisions.end();) {
+        if (it->first->getDocument() == doc) {
+            it = revisions.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void ShapeCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+    memoryUsed = 0;
+}
+
+void ShapeCache::touchShape(const App::DocumentObject* obj)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = revisions.find(obj);
+    // only the objects the cached shapes are made from have a revision
+    if (it != revisions.end()) {
+        it->second = ++lastRevision;
+    }
+}
+
+ShapeCache::Statistics ShapeCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Statistics res = stats;
+    res.entries = entries.size();
+    res.memSize = memoryUsed;
+    res.memoryBudget = memoryBudget;
+    return res;
+}
+
+void ShapeCache::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stats = Statistics();
+}
+
+void ShapeCache::setMemoryBudget(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    memoryBudget = bytes;
+    limitMemory();
+}
+
+void ShapeCache::erase(EntryList::iterator entry)
+{
+    auto itObj = index.find(entry->obj);
+    if (itObj != index.end()) {
+        itObj->second.erase(entry->subname);
+        if (itObj->second.empty()) {
+            index.erase(itObj);
+        }
+    }
+    memoryUsed -= entry->memSize;
+    entries.erase(entry);
+}
+
+void ShapeCache::limitMemory()
+{
+    while (memoryUsed > memoryBudget && !entries.empty()) {
+        ++stats.evictions;
+        erase(std::prev(entries.end()));
+    }
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PART_SHAPECACHE_H
+#define PART_SHAPECACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace App
+{
+class Document;
+class DocumentObject;
+}
+
+namespace Part
+{
+
+/** Cache of the shapes returned by Feature::getTopoShape()
+ *
+ * The shapes of sub-objects, e.g. the transformed shapes of links, are kept
+ * here for the object and sub-name they were asked for. An entry is dropped
+ * when the object changes, see PropertyShapeCache, or when the shape of the
+ * object it was made from gets a new revision. Every change of a
+ * PropertyPartShape gives its object a new revision. The entries and
+ * revisions of an object are dropped when it or its document is deleted.
+ *
+ * The least recently used shapes are dropped when the shapes take more than
+ * ShapeCacheSize MB of Mod/Part/General, a size of 0 turns the cache off.
+ */
+class PartExport ShapeCache
+{
+public:
+    static ShapeCache& instance();
+
+    /// Sets \a shape to the cached shape of \a obj and \a subname, returns false if there is none
+    bool getShape(const App::DocumentObject* obj, const std::string& subname, TopoShape& shape);
+    /** Stores the shape of \a obj and \a subname
+     * @param source: the object the shape is made from, the entry is dropped
+     * when the shape of \a source changes
+     */
+    void setShape(const App::DocumentObject* obj,
+                  const std::string& subname,
+                  const TopoShape& shape,
+                  const App::DocumentObject* source = nullptr);
+    /// Returns the cached shapes of \a obj with their sub-names
+    std::vector<std::pair<std::string, TopoShape>> getShapes(const App::DocumentObject* obj) const;
+    /// Drops the shape of \a obj and \a subname
+    void removeShape(const App::DocumentObject* obj, const std::string& subname);
+    /// Drops all shapes of \a obj
+    void remove(const App::DocumentObject* obj);
+    void clear();
+
+    /// Gives \a obj a new shape revision, the shapes made from the old one are dropped
+    void touchShape(const App::DocumentObject* obj);
+
+    struct Statistics
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        /// Entries dropped on lookup because their source changed
+        std::uint64_t outdated = 0;
+        /// Entries dropped to stay within the memory budget
+        std::uint64_t evictions = 0;
+        std::size_t entries = 0;
+        /// Estimated memory of the cached shapes in bytes
+        std::size_t memSize = 0;
+        std::size_t memoryBudget = 0;
+    };
+    Statistics getStatistics() const;
+    void resetStatistics();
+    void setMemoryBudget(std::size_t bytes);
+
+private:
+    struct Entry
+    {
+        const App::DocumentObject* obj = nullptr;
+        std::string subname;
+        TopoShape shape;
+        const App::DocumentObject* source = nullptr;
+        std::uint64_t revision = 0;
+        std::size_t memSize = 0;
+    };
+    using EntryList = std::list<Entry>;
+
+    ShapeCache();
+    std::uint64_t getRevision(const App::DocumentObject* obj);
+    void erase(EntryList::iterator entry);
+    void forget(const App::DocumentObject* obj);
+    void forget(const App::Document* doc);
+    void limitMemory();
+
+private:
+    mutable std::mutex mutex;
+    // most recently used first
+    EntryList entries;
+    std::unordered_map<const App::DocumentObject*,
+                       std::unordered_map<std::string, EntryList::iterator>>
+        index;
+    std::unordered_map<const App::DocumentObject*, std::uint64_t> revisions;
+    std::uint64_t lastRevision = 0;
+    std::size_t memoryUsed = 0;
+    std::size_t memoryBudget = 0;
+    Statistics stats;
+};
+
+}  // namespace Part
+
+#endif  // PART_SHAPECACHE_H
@@ -59,6 +59,7 @@
 # include <TColStd_ListOfTransient.hxx>
 # include <TColgp_SequenceOfXY.hxx>
 # include <TColgp_SequenceOfXYZ.hxx>
+# include <TopExp_Explorer.hxx>
 # include <TopoDS.hxx>
 # if OCC_VERSION_HEX < 0x070600
 # include <Adaptor3d_HCurveOnSurface.hxx>
@@ -295,6 +296,20 @@ bool Part::Tools::getTriangulation(const TopoDS_Face& face, std::vector<gp_Pnt>&
     return true;
 }
 
+bool Part::Tools::hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    bool hasFaces = false;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) hTria = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (hTria.IsNull() || hTria->Deflection() > deflection)
+            return false;
+        hasFaces = true;
+    }
+
+    return hasFaces;
+}
+
 bool Part::Tools::getPolygonOnTriangulation(const TopoDS_Edge& edge, const TopoDS_Face& face, std::vector<gp_Pnt>& points)
 {
     TopLoc_Location loc;
@@ -124,6 +124,15 @@ public:
      * @return true if a triangulation exists or false otherwise
      */
     static bool getTriangulation(const TopoDS_Face& face, std::vector<gp_Pnt>& points, std::vector<Poly_Triangle>& facets);
+    /*!
+     * \brief hasTriangulation
+     * Checks whether the shape is already tessellated finely enough, e.g. for the 3D view,
+     * so that it doesn't need to be meshed again.
+     * \param shape
+     * \param deflection
+     * \return true if all faces have a triangulation with a deflection not above \a deflection
+     */
+    static bool hasTriangulation(const TopoDS_Shape& shape, double deflection);
     /*!
      * \brief getPolygonOnTriangulation
      * Get the polygon of edge.
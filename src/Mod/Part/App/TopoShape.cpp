@@ -26,6 +26,7 @@
 # include <array>
 # include <cmath>
 # include <cstdlib>
+# include <limits>
 # include <sstream>
 # include <boost/regex.hpp>
 
@@ -121,6 +122,8 @@
 # include <Law_BSpline.hxx>
 # include <Law_BSpFunc.hxx>
 # include <Law_Constant.hxx>
+# include <Poly_Polygon3D.hxx>
+# include <Poly_Triangulation.hxx>
 # include <ShapeAnalysis_FreeBoundsProperties.hxx>
 # include <ShapeExtend_Explorer.hxx>
 # include <ShapeFix_Shape.hxx>
@@ -148,6 +151,7 @@
 
 # include <BOPAlgo_ArgumentAnalyzer.hxx>
 # include <BOPAlgo_ListOfCheckResult.hxx>
+# include <OSD_Parallel.hxx>
 
 # include <BRepAlgoAPI_Defeaturing.hxx>
 
@@ -906,7 +910,7 @@ void TopoShape::exportBrep(std::ostream& out) const
     SS.Write(this->_Shape, out);
 }
 
-void TopoShape::exportBinary(std::ostream& out) const
+void TopoShape::exportBinary(std::ostream& out, bool withTriangulation) const
 {
     // See BinTools_FormatVersion of OCCT 7.6
     enum {
@@ -917,7 +921,13 @@ void TopoShape::exportBinary(std::ostream& out) const
     };
 
     // An example how to use BinTools_ShapeSet can be found in BinMNaming_NamedShapeDriver.cxx
+    // The triangulation is read back by importBinary() in any case
+#if OCC_VERSION_HEX >= 0x070600
     BinTools_ShapeSet theShapeSet;
+    theShapeSet.SetWithTriangles(withTriangulation);
+#else
+    BinTools_ShapeSet theShapeSet(withTriangulation);
+#endif
     theShapeSet.SetFormatNb(VERSION_3);
     if (this->_Shape.IsNull()) {
         theShapeSet.Add(this->_Shape);
@@ -946,11 +956,14 @@ void TopoShape::dump(std::ostream& out) const
 void TopoShape::exportStl(const char *filename, double deflection) const
 {
     StlAPI_Writer writer;
-    BRepMesh_IncrementalMesh aMesh(this->_Shape, deflection,
-                                   /*isRelative*/ Standard_False,
-                                   /*theAngDeflection*/
-                                   defaultAngularDeflection(deflection),
-                                   /*isInParallel*/ true);
+    // reuse the tessellation of the 3D view if it's fine enough
+    if (!Tools::hasTriangulation(this->_Shape, deflection)) {
+        BRepMesh_IncrementalMesh aMesh(this->_Shape, deflection,
+                                       /*isRelative*/ Standard_False,
+                                       /*theAngDeflection*/
+                                       defaultAngularDeflection(deflection),
+                                       /*isInParallel*/ true);
+    }
     writer.Write(this->_Shape,encodeFilename(filename).c_str());
 }
 
@@ -1209,7 +1222,7 @@ unsigned int TopoShape::getMemSize () const
 {
     if (!_Shape.IsNull()) {
         // Count total amount of references of TopoDS_Shape objects
-        unsigned int memsize = (sizeof(TopoDS_Shape)+sizeof(TopoDS_TShape)) * TopoShape_RefCountShapes(_Shape);
+        std::size_t memsize = (sizeof(TopoDS_Shape)+sizeof(TopoDS_TShape)) * TopoShape_RefCountShapes(_Shape);
 
         // Now get a map of TopoDS_Shape objects without duplicates
         TopTools_IndexedMapOfShape M;
@@ -1230,6 +1243,19 @@ unsigned int TopoShape::getMemSize () const
                     // first, last, tolerance
                     memsize += 5*sizeof(Standard_Real);
                     const TopoDS_Face& face = TopoDS::Face(shape);
+                    // the tessellation kept for display and export
+                    TopLoc_Location loc;
+                    Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+                    if (!mesh.IsNull()) {
+                        std::size_t nodes = mesh->NbNodes();
+                        memsize += sizeof(Poly_Triangulation);
+                        memsize += nodes * sizeof(gp_Pnt);
+                        memsize += mesh->NbTriangles() * sizeof(Poly_Triangle);
+                        if (mesh->HasUVNodes())
+                            memsize += nodes * sizeof(gp_Pnt2d);
+                        if (mesh->HasNormals())
+                            memsize += nodes * 3 * sizeof(float);
+                    }
                     // if no geometry is attached to a face an exception is raised
                     BRepAdaptor_Surface surface;
                     try {
@@ -1286,6 +1312,12 @@ unsigned int TopoShape::getMemSize () const
                     // first, last, tolerance
                     memsize += 3*sizeof(Standard_Real);
                     const TopoDS_Edge& edge = TopoDS::Edge(shape);
+                    TopLoc_Location loc;
+                    Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, loc);
+                    if (!polygon.IsNull()) {
+                        memsize += sizeof(Poly_Polygon3D);
+                        memsize += polygon->NbNodes() * (sizeof(gp_Pnt) + sizeof(Standard_Real));
+                    }
                     // if no geometry is attached to an edge an exception is raised
                     BRepAdaptor_Curve curve;
                     try {
@@ -1342,8 +1374,12 @@ unsigned int TopoShape::getMemSize () const
             }
         }
 
+        // the element map of the topological naming
+        memsize += Data::ComplexGeoData::getMemSize();
+
         // estimated memory usage
-        return memsize;
+        return static_cast<unsigned int>(
+            std::min<std::size_t>(memsize, std::numeric_limits<unsigned int>::max()));
     }
 
     // in case the shape is invalid
@@ -1612,6 +1648,30 @@ bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
     return true;
 }
 
+std::vector<std::pair<bool, std::string>>
+TopoShape::analyzeShapes(const std::vector<TopoShape>& shapes, bool runBopCheck)
+{
+    std::vector<std::pair<bool, std::string>> results(shapes.size());
+    std::vector<std::exception_ptr> failures(shapes.size());
+    OSD_Parallel::For(0, static_cast<int>(shapes.size()), [&](int i) {
+        std::stringstream str;
+        try {
+            results[i].first = shapes[i].analyze(runBopCheck, str);
+        }
+        catch (const Standard_Failure& e) {
+            // a shape the checker chokes on is reported instead of aborting the whole batch
+            results[i].first = false;
+            str << "Check failed: " << e.GetMessageString() << std::endl;
+        }
+        catch (...) {
+            failures[i] = std::current_exception();
+        }
+        results[i].second = str.str();
+    });
+    Base::rethrowFirstException(failures);
+    return results;
+}
+
 bool TopoShape::isClosed() const
 {
     if (this->_Shape.IsNull())
@@ -1859,11 +1919,8 @@ std::list<TopoDS_Wire> TopoShape::slice(const Base::Vector3d& dir, double d) con
 
 TopoDS_Compound TopoShape::slices(const Base::Vector3d& dir, const std::vector<double>& d) const
 {
-    std::vector< std::list<TopoDS_Wire> > wire_list;
     CrossSection cs(dir.x, dir.y, dir.z, this->_Shape);
-    for (double jt : d) {
-        wire_list.push_back(cs.slice(jt));
-    }
+    std::vector< std::list<TopoDS_Wire> > wire_list = cs.slices(d);
 
     std::vector< std::list<TopoDS_Wire> >::const_iterator ft;
     TopoDS_Compound comp;
@@ -3340,12 +3397,15 @@ void TopoShape::getFaces(std::vector<Base::Vector3d> &aPoints,
     if (this->_Shape.IsNull())
         return;
 
-    // get the meshes of all faces and then merge them
-    BRepMesh_IncrementalMesh aMesh(this->_Shape, accuracy,
-                                   /*isRelative*/ Standard_False,
-                                   /*theAngDeflection*/
-                                   defaultAngularDeflection(accuracy),
-                                   /*isInParallel*/ true);
+    // get the meshes of all faces and then merge them, an existing tessellation
+    // is reused if it's fine enough
+    if (!Tools::hasTriangulation(this->_Shape, accuracy)) {
+        BRepMesh_IncrementalMesh aMesh(this->_Shape, accuracy,
+                                       /*isRelative*/ Standard_False,
+                                       /*theAngDeflection*/
+                                       defaultAngularDeflection(accuracy),
+                                       /*isInParallel*/ true);
+    }
     std::vector<Domain> domains;
     getDomains(domains);
     getFacesFromDomains(domains, aPoints, aTopo);
@@ -270,6 +270,20 @@ enum class RevolMode {
     None = 2
 };
 
+/// Result of TopoShape::getMassProperties()
+struct PartExport MassProperties
+{
+    /// Dimension integrated over: 3 volume, 2 surface, 1 length, 0 points only
+    int dimension = 0;
+    /// Volume, area or length according to dimension
+    double mass = 0.0;
+    Base::Vector3d centerOfMass;
+    /// Matrix of inertia with respect to the center of mass
+    Base::Matrix4D matrixOfInertia;
+    /// Estimated absolute error of mass, negative if it is unknown
+    double error = -1.0;
+};
+
 /** The representation for a CAD Shape
  */
 // NOLINTNEXTLINE cppcoreguidelines-special-member-functions
@@ -477,7 +491,8 @@ public:
     void exportStep(const char* FileName) const;
     void exportBrep(const char* FileName) const;
     void exportBrep(std::ostream&) const;
-    void exportBinary(std::ostream&) const;
+    /// With \a withTriangulation the triangulation of the faces is written too
+    void exportBinary(std::ostream&, bool withTriangulation = false) const;
     void exportStl(const char* FileName, double deflection) const;
     void exportFaceSet(double, double, const std::vector<Base::Color>&, std::ostream&) const;
     void exportLineSet(std::ostream&) const;
@@ -488,6 +503,12 @@ public:
     bool isNull() const;
     bool isValid() const;
     bool analyze(bool runBopCheck, std::ostream&) const;
+    /** Runs analyze() for all shapes in parallel
+     *
+     * @return for each shape whether it is valid and the error report
+     */
+    static std::vector<std::pair<bool, std::string>>
+    analyzeShapes(const std::vector<TopoShape>& shapes, bool runBopCheck);
     bool isClosed() const;
     bool isCoplanar(const TopoShape& other, double tol = -1) const;
     bool findPlane(gp_Pln& plane, double tol = -1, double atol = -1) const;
@@ -823,6 +844,9 @@ public:
      *            the operation
      * @param no_fail: if throwException, throw exception if failed to refine. Or else,
      *                 if shapeUntouched the shape remains untouched if failed.
+     * @param refinedBase: optional shape that is refined already, e.g. the base
+     *                     shape of the operation. Only the faces of the input
+     *                     shape that are not in it and their neighbours are refined.
      *
      * @return The original content of this TopoShape is discarded and replaced
      *         with the refined shape. The function returns the TopoShape
@@ -831,7 +855,8 @@ public:
      */
     TopoShape& makeElementRefine(const TopoShape& shape,
                                  const char* op = nullptr,
-                                 RefineFail no_fail = RefineFail::throwException);
+                                 RefineFail no_fail = RefineFail::throwException,
+                                 const TopoDS_Shape& refinedBase = TopoDS_Shape());
 
     /** Refine the input shape by merging faces/edges that share the same geometry
      *
@@ -840,13 +865,17 @@ public:
      *            the operation
      * @param no_fail: if throwException, throw exception if failed to refine. Or else,
      *                 if shapeUntouched the shape remains untouched if failed.
+     * @param refinedBase: optional shape that is refined already, e.g. the base
+     *                     shape of the operation. Only the faces of the input
+     *                     shape that are not in it and their neighbours are refined.
      *
      * @return Return a refined shape. The shape itself is not modified
      */
     TopoShape makeElementRefine(const char* op = nullptr,
-                                RefineFail no_fail = RefineFail::throwException) const
+                                RefineFail no_fail = RefineFail::throwException,
+                                const TopoDS_Shape& refinedBase = TopoDS_Shape()) const
     {
-        return TopoShape(Tag, Hasher).makeElementRefine(*this, op, no_fail);
+        return TopoShape(Tag, Hasher).makeElementRefine(*this, op, no_fail, refinedBase);
     }
 
 
@@ -1468,6 +1497,54 @@ public:
     std::vector<int> findAncestors(const TopoDS_Shape& subshape, TopAbs_ShapeEnum type) const;
     std::vector<TopoDS_Shape> findAncestorsShapes(const TopoDS_Shape& subshape,
                                                   TopAbs_ShapeEnum type) const;
+    /** Spatial search of sub shapes
+     *
+     * The bounding boxes of the sub shapes are kept in a tree in the cache,
+     * which is built on first use. The functions return the indices of the
+     * sub shapes of the given type whose bounding box matches, the caller has
+     * to do the exact check.
+     */
+    //@{
+    /// Sorted indices of the sub shapes whose bounding box intersects \a box enlarged by \a tol
+    std::vector<int> findSubShapesInBox(TopAbs_ShapeEnum type,
+                                        const Base::BoundBox3d& box,
+                                        double tol = 0.0) const;
+    /// Sorted indices of the sub shapes whose bounding box is closer than \a tol to \a pnt
+    std::vector<int> findSubShapesNearPoint(TopAbs_ShapeEnum type,
+                                            const Base::Vector3d& pnt,
+                                            double tol) const;
+    /// Sorted indices of the sub shapes whose bounding box is hit by the ray
+    std::vector<int> findSubShapesOnRay(TopAbs_ShapeEnum type,
+                                        const Base::Vector3d& base,
+                                        const Base::Vector3d& dir) const;
+    /// At most \a count indices ordered by the distance of the bounding box to \a pnt
+    std::vector<int> findNearestSubShapes(TopAbs_ShapeEnum type,
+                                          const Base::Vector3d& pnt,
+                                          int count) const;
+    //@}
+
+    /** Mass properties
+     *
+     * The properties are integrated face by face (edge by edge for shapes
+     * without faces) in parallel and kept in the cache, so asking again for
+     * an unchanged shape is free. Shapes with solids give volume properties,
+     * shapes with faces surface properties and shapes with edges linear ones.
+     *
+     * @param tolerance: with  triangulation false, the relative error of
+     * an adaptive integration, 0 for the plain Gauss integration. With
+     *  triangulation true, the linear deflection of the triangulation, 0
+     * for a thousandth of the bounding box diagonal.
+     * @param triangulation: integrate over a triangulation of the shape
+     * instead of the exact geometry, which is a lot faster for curved
+     * surfaces. The error of a volume is then bound by area x deflection.
+     * Requires OCC 7.6, older versions integrate the exact geometry.
+     */
+    //@{
+    MassProperties getMassProperties(double tolerance = 0.0, bool triangulation = false) const;
+    static std::vector<MassProperties> getMassProperties(const std::vector<TopoShape>& shapes,
+                                                         double tolerance = 0.0,
+                                                         bool triangulation = false);
+    //@}
     /** Find sub shapes with shared Vertexes.
      *
      * Renamed: searchSubShape -> findSubShapesWithSharedVertex
@@ -23,10 +23,142 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <BRepBndLib.hxx>
+#endif
+
+#include <boost/geometry.hpp>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+class TopoShapeCache::BoxTree
+{
+public:
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, int>;
+
+    explicit BoxTree(const TopTools_IndexedMapOfShape& shapes)
+    {
+        std::vector<Value> values;
+        values.reserve(shapes.Extent());
+        for (int i = 1; i <= shapes.Extent(); ++i) {
+            Bnd_Box bounds;
+            try {
+                BRepBndLib::Add(shapes.FindKey(i), bounds, false);
+            }
+            catch (Standard_Failure&) {
+                bounds.SetWhole();
+            }
+            if (bounds.IsVoid()) {
+                continue;
+            }
+            if (bounds.IsOpen()) {
+                unbounded.push_back(i);
+                continue;
+            }
+            values.emplace_back(toBox(bounds), i);
+        }
+
+        // the range constructor uses bulk loading which gives a better tree
+        tree = Tree(values.begin(), values.end());
+    }
+
+    static Point toPoint(const gp_Pnt& pnt)
+    {
+        return {pnt.X(), pnt.Y(), pnt.Z()};
+    }
+
+    static Box toBox(const Bnd_Box& bounds)
+    {
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;  // NOLINT
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        return {Point(xMin, yMin, zMin), Point(xMax, yMax, zMax)};
+    }
+
+    template<typename Predicate>
+    std::vector<int> query(const Predicate& predicate) const
+    {
+        std::vector<Value> values;
+        tree.query(predicate, std::back_inserter(values));
+        std::vector<int> res(unbounded);
+        res.reserve(res.size() + values.size());
+        for (const auto& it : values) {
+            res.push_back(it.second);
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+    std::vector<int> findInBox(const Bnd_Box& bounds) const
+    {
+        return query(bgi::intersects(toBox(bounds)));
+    }
+
+    std::vector<int> findOnRay(const gp_Pnt& base, const gp_Dir& dir) const
+    {
+        if (tree.empty()) {
+            return unbounded;
+        }
+
+        // a segment that reaches beyond all boxes replaces the ray
+        Box bounds = tree.bounds();
+        gp_Pnt minPnt(bounds.min_corner().get<0>(),
+                      bounds.min_corner().get<1>(),
+                      bounds.min_corner().get<2>());
+        gp_Pnt maxPnt(bounds.max_corner().get<0>(),
+                      bounds.max_corner().get<1>(),
+                      bounds.max_corner().get<2>());
+        double length = base.Distance(minPnt) + minPnt.Distance(maxPnt);
+        gp_Pnt end = base.Translated(gp_Vec(dir) * length);
+        return query(bgi::intersects(bg::model::segment<Point>(toPoint(base), toPoint(end))));
+    }
+
+    std::vector<int> findNearest(const gp_Pnt& pnt, int count) const
+    {
+        if (count <= 0) {
+            return {};
+        }
+
+        Point point = toPoint(pnt);
+        std::vector<Value> values;
+        tree.query(bgi::nearest(point, static_cast<unsigned>(count)), std::back_inserter(values));
+        // the results of the nearest query are not ordered
+        std::sort(values.begin(), values.end(), [&point](const Value& a, const Value& b) {
+            return bg::comparable_distance(point, a.first) < bg::comparable_distance(point, b.first);
+        });
+
+        std::vector<int> res(unbounded);
+        for (const auto& it : values) {
+            res.push_back(it.second);
+        }
+        res.resize(std::min(res.size(), static_cast<std::size_t>(count)));
+        return res;
+    }
+
+private:
+    using Tree = bgi::rtree<Value, bgi::linear<16>>;
+    Tree tree;
+    // shapes with an infinite bounding box
+    std::vector<int> unbounded;
+};
+
+namespace
+{
+// The cached shape is stripped of its location, so the queries have to be moved back
+gp_Trsf toCachedShape(const TopoDS_Shape& parent)
+{
+    return parent.Location().Transformation().Inverted();
+}
+}  // namespace
+
 ShapeRelationKey::ShapeRelationKey(Data::MappedName name, HistoryTraceType historyTraceType)
     : name(std::move(name))
     , historyTraceType(historyTraceType)
@@ -160,6 +292,8 @@ TopoShapeCache::TopoShapeCache(const TopoDS_Shape& tds)
     : shape(tds.Located(TopLoc_Location()))
 {}
 
+TopoShapeCache::~TopoShapeCache() = default;
+
 void TopoShapeCache::insertRelation(const ShapeRelationKey& key,
                                     const QVector<Data::MappedElement>& value)
 {
@@ -257,3 +391,53 @@ TopoDS_Shape TopoShapeCache::findAncestor(const TopoDS_Shape& parent,
     }
     return TopoShape::moved(shapes.First(), parent.Location());
 }
+
+TopoShapeCache::BoxTree& TopoShapeCache::getBoxTree(TopAbs_ShapeEnum type)
+{
+    auto& tree = boxTrees.at(type);
+    if (!tree) {
+        tree = std::make_unique<BoxTree>(getAncestry(type).shapes);
+    }
+    return *tree;
+}
+
+std::vector<int>
+TopoShapeCache::findShapesInBox(const TopoDS_Shape& parent, TopAbs_ShapeEnum type, const Bnd_Box& box)
+{
+    if (shape.IsNull() || box.IsVoid()) {
+        return {};
+    }
+    if (parent.Location().IsIdentity()) {
+        return getBoxTree(type).findInBox(box);
+    }
+    return getBoxTree(type).findInBox(box.Transformed(toCachedShape(parent)));
+}
+
+std::vector<int> TopoShapeCache::findShapesOnRay(const TopoDS_Shape& parent,
+                                                 TopAbs_ShapeEnum type,
+                                                 const gp_Pnt& base,
+                                                 const gp_Dir& dir)
+{
+    if (shape.IsNull()) {
+        return {};
+    }
+    if (parent.Location().IsIdentity()) {
+        return getBoxTree(type).findOnRay(base, dir);
+    }
+    gp_Trsf trsf = toCachedShape(parent);
+    return getBoxTree(type).findOnRay(base.Transformed(trsf), dir.Transformed(trsf));
+}
+
+std::vector<int> TopoShapeCache::findNearestShapes(const TopoDS_Shape& parent,
+                                                   TopAbs_ShapeEnum type,
+                                                   const gp_Pnt& pnt,
+                                                   int count)
+{
+    if (shape.IsNull()) {
+        return {};
+    }
+    if (parent.Location().IsIdentity()) {
+        return getBoxTree(type).findNearest(pnt, count);
+    }
+    return getBoxTree(type).findNearest(pnt.Transformed(toCachedShape(parent)), count);
+}
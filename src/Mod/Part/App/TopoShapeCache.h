@@ -29,6 +29,10 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <memory>
+#include <Bnd_Box.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
@@ -120,6 +124,7 @@ public:
     };
 
     explicit TopoShapeCache(const TopoDS_Shape& tds);
+    ~TopoShapeCache();
     void insertRelation(const ShapeRelationKey& key, const QVector<Data::MappedElement>& value);
     bool isTouched(const TopoDS_Shape& tds) const;
     Ancestry& getAncestry(TopAbs_ShapeEnum type);
@@ -136,12 +141,48 @@ public:
                               TopAbs_ShapeEnum type,
                               std::vector<TopoDS_Shape>* ancestors = nullptr);
 
+    /** @name Spatial search of sub-shapes
+     *
+     * The bounding boxes of the sub-shapes of a type are kept in a tree that is built on first
+     * use. As the cache is replaced whenever the shape changes, the tree never gets outdated.
+     * The queries are given in the coordinate system of \a parent. The functions return the
+     * indices of the sub-shapes whose bounding box matches, so the caller has to do the exact
+     * check. Sub-shapes with an infinite bounding box match every query.
+     */
+    //@{
+    /// Sorted indices of the sub-shapes whose bounding box intersects \a box
+    std::vector<int> findShapesInBox(const TopoDS_Shape& parent,
+                                     TopAbs_ShapeEnum type,
+                                     const Bnd_Box& box);
+    /// Sorted indices of the sub-shapes whose bounding box is hit by the ray
+    std::vector<int> findShapesOnRay(const TopoDS_Shape& parent,
+                                     TopAbs_ShapeEnum type,
+                                     const gp_Pnt& base,
+                                     const gp_Dir& dir);
+    /// At most \a count indices ordered by the distance of the bounding box to \a pnt
+    std::vector<int> findNearestShapes(const TopoDS_Shape& parent,
+                                       TopAbs_ShapeEnum type,
+                                       const gp_Pnt& pnt,
+                                       int count);
+    //@}
+
     /// Ancestor and children shape caches of all shape types. Note that
     /// shapeAncestryCache[TopAbs_SHAPE] is also valid and stores the direct children of a
     /// compound shape.
     std::array<Ancestry, TopAbs_SHAPE + 1> shapeAncestryCache;
 
     std::map<ShapeRelationKey, QVector<Data::MappedElement>> relations;
+
+    /// Mass properties of the cached shape (i.e. without location), keyed by the tolerance and
+    /// triangulation arguments of TopoShape::getMassProperties()
+    std::map<std::pair<double, bool>, MassProperties> massProperties;
+
+private:
+    class BoxTree;
+    BoxTree& getBoxTree(TopAbs_ShapeEnum type);
+
+    /// Bounding box trees of all shape types, created on demand
+    std::array<std::unique_ptr<BoxTree>, TopAbs_SHAPE + 1> boxTrees;
 };
 
 }  // namespace Part
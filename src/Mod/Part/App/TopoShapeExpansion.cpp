@@ -42,6 +42,7 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_BooleanOperation.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
@@ -84,7 +85,12 @@
 
 #endif
 
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <GProp_GProps.hxx>
 #include <OSD_Parallel.hxx>
+#include <Standard_Version.hxx>
 
 #include "modelRefine.h"
 #include "CrossSection.h"
@@ -330,7 +336,6 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(const TopoShape&
         return res;
     }
     double tol2 = tol * tol;
-    int index = 0;
     TopAbs_ShapeEnum shapeType = subshape.shapeType();
 
     // This is an intentionally recursive method, which will exit after looking through all
@@ -435,16 +440,18 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(const TopoShape&
                 }
             }
             break;
-        case TopAbs_VERTEX:
+        case TopAbs_VERTEX: {
             // Vertex search will do comparison with tolerance to account for
-            // rounding error inccured through transformation.
-            for (auto& shape : getSubTopoShapes(TopAbs_VERTEX)) {
-                ++index;
-                if (BRep_Tool::Pnt(TopoDS::Vertex(shape.getShape()))
-                        .SquareDistance(BRep_Tool::Pnt(TopoDS::Vertex(subshape.getShape())))
-                    <= tol2) {
+            // rounding error inccured through transformation. Only the vertexes
+            // close to the point are checked.
+            gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(subshape.getShape()));
+            for (int idx : findSubShapesNearPoint(TopAbs_VERTEX,
+                                                  Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z()),
+                                                  tol)) {
+                auto shape = getSubTopoShape(TopAbs_VERTEX, idx);
+                if (BRep_Tool::Pnt(TopoDS::Vertex(shape.getShape())).SquareDistance(pnt) <= tol2) {
                     if (names) {
-                        names->push_back(std::string("Vertex") + std::to_string(index));
+                        names->push_back(std::string("Vertex") + std::to_string(idx));
                     }
                     res.push_back(shape);
                     if (singleSearch) {
@@ -453,6 +460,7 @@ std::vector<TopoShape> TopoShape::findSubShapesWithSharedVertex(const TopoShape&
                 }
             }
             break;
+        }
         case TopAbs_EDGE:
         case TopAbs_FACE: {
             std::unique_ptr<Geometry> geom;
@@ -702,6 +710,292 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(const TopoDS_Shape& sub
     return shapes;
 }
 
+std::vector<int>
+TopoShape::findSubShapesInBox(TopAbs_ShapeEnum type, const Base::BoundBox3d& box, double tol) const
+{
+    if (!box.IsValid()) {
+        return {};
+    }
+    Bnd_Box bounds;
+    bounds.Update(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ);
+    bounds.Enlarge(tol);
+    initCache();
+    return _cache->findShapesInBox(_Shape, type, bounds);
+}
+
+std::vector<int>
+TopoShape::findSubShapesNearPoint(TopAbs_ShapeEnum type, const Base::Vector3d& pnt, double tol) const
+{
+    Bnd_Box bounds;
+    bounds.Set(gp_Pnt(pnt.x, pnt.y, pnt.z));
+    bounds.Enlarge(tol);
+    initCache();
+    return _cache->findShapesInBox(_Shape, type, bounds);
+}
+
+std::vector<int> TopoShape::findSubShapesOnRay(TopAbs_ShapeEnum type,
+                                               const Base::Vector3d& base,
+                                               const Base::Vector3d& dir) const
+{
+    if (dir.Length() < Precision::Confusion()) {
+        FC_THROWM(Base::ValueError, "Null direction");
+    }
+    initCache();
+    return _cache->findShapesOnRay(_Shape,
+                                   type,
+                                   gp_Pnt(base.x, base.y, base.z),
+                                   gp_Dir(dir.x, dir.y, dir.z));
+}
+
+std::vector<int>
+TopoShape::findNearestSubShapes(TopAbs_ShapeEnum type, const Base::Vector3d& pnt, int count) const
+{
+    initCache();
+    return _cache->findNearestShapes(_Shape, type, gp_Pnt(pnt.x, pnt.y, pnt.z), count);
+}
+
+namespace
+{
+// Default linear deflection of the triangulation relative to the bounding box diagonal
+constexpr double massPropertiesDeflection = 1e-3;
+
+// Integrates a single face or edge and returns the estimated absolute error, negative if
+// unknown. A positive deflection selects the triangulation based integration.
+double integrateMassPropertiesItem(const TopoDS_Shape& item,
+                                   int dimension,
+                                   double tolerance,
+                                   double deflection,
+                                   GProp_GProps& props)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    if (deflection > 0.0) {
+        switch (dimension) {
+            case 3: {
+                BRepGProp::VolumeProperties(item, props, false, false, true);
+                GProp_GProps area;
+                BRepGProp::SurfaceProperties(item, area, false, true);
+                // every point of the triangulation is within the deflection of the face
+                return std::abs(area.Mass()) * deflection;
+            }
+            case 2:
+                BRepGProp::SurfaceProperties(item, props, false, true);
+                return -1.0;
+            default:
+                BRepGProp::LinearProperties(item, props, false, true);
+                return -1.0;
+        }
+    }
+#else
+    (void)deflection;
+#endif
+    switch (dimension) {
+        case 3:
+            if (tolerance > 0.0) {
+                return std::abs(BRepGProp::VolumeProperties(item, props, tolerance) * props.Mass());
+            }
+            BRepGProp::VolumeProperties(item, props);
+            return -1.0;
+        case 2:
+            if (tolerance > 0.0) {
+                return std::abs(BRepGProp::SurfaceProperties(item, props, tolerance)
+                                * props.Mass());
+            }
+            BRepGProp::SurfaceProperties(item, props);
+            return -1.0;
+        default:
+            BRepGProp::LinearProperties(item, props);
+            return -1.0;
+    }
+}
+
+MassProperties
+integrateMassProperties(const TopoDS_Shape& shape, double tolerance, bool triangulation, bool parallel)
+{
+    MassProperties result;
+    TopAbs_ShapeEnum itemType = TopAbs_FACE;
+    if (TopExp_Explorer(shape, TopAbs_SOLID).More()) {
+        result.dimension = 3;
+    }
+    else if (TopExp_Explorer(shape, TopAbs_FACE).More()) {
+        result.dimension = 2;
+    }
+    else if (TopExp_Explorer(shape, TopAbs_EDGE).More()) {
+        result.dimension = 1;
+        itemType = TopAbs_EDGE;
+    }
+    else {
+        // Same as getCenterOfGravity(), the center of a set of vertexes is their average
+        gp_XYZ sum;
+        int count = 0;
+        for (TopExp_Explorer xp(shape, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            sum += BRep_Tool::Pnt(TopoDS::Vertex(xp.Current())).XYZ();
+            ++count;
+        }
+        if (count > 0) {
+            sum /= count;
+            result.centerOfMass = Base::Vector3d(sum.X(), sum.Y(), sum.Z());
+        }
+        return result;
+    }
+
+    double deflection = 0.0;
+    TopoDS_Shape itemShape = shape;
+#if OCC_VERSION_HEX >= 0x070600
+    if (triangulation) {
+        deflection = tolerance;
+        if (deflection <= 0.0) {
+            Bnd_Box bounds;
+            BRepBndLib::Add(shape, bounds);
+            deflection = std::sqrt(bounds.SquareExtent()) * massPropertiesDeflection;
+        }
+        // mesh a copy, the triangulation of the given shape is shared with its owner and
+        // may be displayed or used by other threads at the same time
+        itemShape = BRepBuilderAPI_Copy(shape, false, false).Shape();
+        BRepMesh_IncrementalMesh(itemShape, deflection, false, 0.5, parallel);
+    }
+#else
+    (void)triangulation;
+#endif
+
+    // Each item is wrapped in a compound without location, so that BRepGProp integrates all of
+    // them relative to the same origin, which is what it does for the whole shape, too. The
+    // partial results can then simply be added up.
+    std::vector<TopoDS_Shape> items;
+    BRep_Builder builder;
+    for (TopExp_Explorer xp(itemShape, itemType); xp.More(); xp.Next()) {
+        TopoDS_Compound comp;
+        builder.MakeCompound(comp);
+        builder.Add(comp, xp.Current());
+        items.push_back(comp);
+    }
+
+    std::vector<GProp_GProps> props(items.size());
+    std::vector<double> errors(items.size());
+    std::vector<std::exception_ptr> failures(items.size());
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(items.size()),
+        [&](int i) {
+            try {
+                errors[i] = integrateMassPropertiesItem(items[i],
+                                                        result.dimension,
+                                                        tolerance,
+                                                        deflection,
+                                                        props[i]);
+            }
+            catch (...) {
+                failures[i] = std::current_exception();
+            }
+        },
+        !parallel);
+    Base::rethrowFirstException(failures);
+
+    GProp_GProps total;
+    result.error = 0.0;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        total.Add(props[i]);
+        if (errors[i] < 0.0 || result.error < 0.0) {
+            result.error = -1.0;
+        }
+        else {
+            result.error += errors[i];
+        }
+    }
+
+    result.mass = total.Mass();
+    if (std::abs(result.mass) > 0.0) {
+        gp_Pnt center = total.CentreOfMass();
+        result.centerOfMass = Base::Vector3d(center.X(), center.Y(), center.Z());
+        gp_Mat inertia = total.MatrixOfInertia();
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                result.matrixOfInertia[row][col] = inertia.Value(row + 1, col + 1);
+            }
+        }
+    }
+    return result;
+}
+
+// Moves properties integrated on the cached shape to the location of the shape
+MassProperties transformMassProperties(MassProperties props, const TopLoc_Location& loc)
+{
+    if (loc.IsIdentity()) {
+        return props;
+    }
+    Base::Matrix4D mat = TopoShape::convert(loc.Transformation());
+    props.centerOfMass = mat * props.centerOfMass;
+    mat[0][3] = mat[1][3] = mat[2][3] = 0.0;
+    Base::Matrix4D transposed(mat);
+    transposed.transpose();
+    props.matrixOfInertia = mat * props.matrixOfInertia * transposed;
+    return props;
+}
+}  // namespace
+
+MassProperties TopoShape::getMassProperties(double tolerance, bool triangulation) const
+{
+    return getMassProperties(std::vector<TopoShape> {*this}, tolerance, triangulation).front();
+}
+
+std::vector<MassProperties> TopoShape::getMassProperties(const std::vector<TopoShape>& shapes,
+                                                         double tolerance,
+                                                         bool triangulation)
+{
+    std::vector<MassProperties> result(shapes.size());
+    const auto key = std::make_pair(tolerance, triangulation);
+
+    // The caches are not thread safe, so look them up first and only integrate in parallel.
+    // Copies of a shape share their cache and are integrated once.
+    std::vector<TopoShapeCache*> pending;
+    std::map<TopoShapeCache*, std::vector<std::size_t>> waiting;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        const auto& shape = shapes[i];
+        if (shape.isNull()) {
+            continue;
+        }
+        shape.initCache();
+        auto cache = shape._cache.get();
+        auto it = cache->massProperties.find(key);
+        if (it != cache->massProperties.end()) {
+            result[i] = transformMassProperties(it->second, shape._Shape.Location());
+            continue;
+        }
+        auto& indices = waiting[cache];
+        if (indices.empty()) {
+            pending.push_back(cache);
+        }
+        indices.push_back(i);
+    }
+
+    // Many shapes are integrated in parallel one by one, a few shapes face by face. The
+    // triangulation mode meshes a copy of each shape, so shapes sharing faces don't race.
+    const bool perShape = static_cast<int>(pending.size()) >= OSD_Parallel::NbLogicalProcessors();
+    std::vector<MassProperties> computed(pending.size());
+    std::vector<std::exception_ptr> failures(pending.size());
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(pending.size()),
+        [&](int k) {
+            try {
+                computed[k] =
+                    integrateMassProperties(pending[k]->shape, tolerance, triangulation, !perShape);
+            }
+            catch (...) {
+                failures[k] = std::current_exception();
+            }
+        },
+        !perShape);
+    Base::rethrowFirstException(failures);
+
+    for (std::size_t k = 0; k < pending.size(); ++k) {
+        pending[k]->massProperties[key] = computed[k];
+        for (auto i : waiting[pending[k]]) {
+            result[i] = transformMassProperties(computed[k], shapes[i]._Shape.Location());
+        }
+    }
+    return result;
+}
+
 // The following lines should be used for now to replace the original macros (in the future we can
 // refactor to use std::source_location and eliminate the use of the macros entirely).
 //     FC_THROWM(NullShapeException, "Null shape");
@@ -1385,6 +1679,127 @@ void checkForParallelOrCoplanar(const TopoDS_Shape& newShape,
     }
 }
 
+// The shapes that an operation reports as modified or generated from one
+// element of an input shape
+struct ElementHistory
+{
+    struct Entry
+    {
+        TopAbs_ShapeEnum type = TopAbs_SHAPE;
+        // nullptr if the type is unknown
+        ShapeInfo* info = nullptr;
+        // index in the new shape, 0 if not found
+        int index = 0;
+        // see NameInfo::index
+        int nameIndex = 0;
+        // added to NameKey::shapetype for higher level shapes
+        int shapeOffset = 0;
+    };
+
+    ShapeInfo* info = nullptr;
+    const TopoShape* source = nullptr;
+    int sourceIndex = 0;
+    TopoDS_Shape element;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+
+    // the entries of the modified shapes come first
+    std::vector<Entry> entries;
+    std::size_t modifiedCount = 0;
+};
+
+void findElementHistory(ElementHistory& history,
+                        const std::array<ShapeInfo*, TopAbs_SHAPE>& infoMap)
+{
+    int newShapeCounter = 0;
+    for (auto& newShape : history.modified) {
+        ++newShapeCounter;
+        auto& entry = history.entries.emplace_back();
+        entry.type = newShape.ShapeType();
+        entry.nameIndex = newShapeCounter;
+        if (entry.type >= TopAbs_SHAPE) {
+            continue;
+        }
+        entry.info = infoMap.at(entry.type);
+        if (entry.info->type == entry.type) {
+            entry.index = entry.info->find(newShape);
+        }
+    }
+    history.modifiedCount = history.entries.size();
+
+    int checkParallel = -1;
+    gp_Pln pln;
+
+    // Find all new objects that were generated from an old object
+    // (e.g. a face generated from an edge)
+    newShapeCounter = 0;
+    for (auto& newShape : history.generated) {
+        if (newShape.ShapeType() >= TopAbs_SHAPE) {
+            history.entries.emplace_back().type = newShape.ShapeType();
+            continue;
+        }
+
+        int parallelFace = -1;
+        int coplanarFace = -1;
+        auto& newInfo = *infoMap.at(newShape.ShapeType());
+        std::vector<TopoDS_Shape> newShapes;
+        int shapeOffset = 0;
+        if (newInfo.type == newShape.ShapeType()) {
+            newShapes.push_back(newShape);
+        }
+        else {
+            // It is possible for the maker to report generating a
+            // higher level shape, such as shell or solid. For
+            // example, when extruding, OCC will report the
+            // extruding face generating the entire solid. However,
+            // it will also report the edges of the extruding face
+            // generating the side faces. In this case, too much
+            // information is bad for us. We don't want the name of
+            // the side face (and its edges) to be coupled with
+            // incomingShape (unrelated) edges in the extruding face.
+            //
+            // shapeOffset below is used to make sure the higher
+            // level mapped names comes late after sorting. We'll
+            // ignore those names if there are more precise mapping
+            // available.
+            shapeOffset = 3;
+
+            if (history.info->type == TopAbs_FACE && checkParallel < 0) {
+                if (!TopoShape(history.element).findPlane(pln)) {
+                    checkParallel = 0;
+                }
+                else {
+                    checkParallel = 1;
+                }
+            }
+            checkForParallelOrCoplanar(newShape,
+                                       newInfo,
+                                       newShapes,
+                                       pln,
+                                       parallelFace,
+                                       coplanarFace,
+                                       checkParallel);
+        }
+        for (auto& workingShape : newShapes) {
+            ++newShapeCounter;
+            auto& entry = history.entries.emplace_back();
+            entry.type = workingShape.ShapeType();
+            entry.info = &newInfo;
+            entry.index = newInfo.find(workingShape);
+            entry.shapeOffset = shapeOffset;
+            if (newShapeCounter == parallelFace) {
+                entry.nameIndex = std::numeric_limits<int>::min();
+            }
+            else if (newShapeCounter == coplanarFace) {
+                entry.nameIndex = std::numeric_limits<int>::min() + 1;
+            }
+            else {
+                entry.nameIndex = -newShapeCounter;
+            }
+        }
+    }
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const Mapper& mapper,
@@ -1444,7 +1859,9 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
 
     // First, collect names from other shapes that generates or modifies the
-    // new shape
+    // new shape. The history is queried from the mapper for all elements
+    // first, because the maker can only be used by one thread.
+    std::vector<ElementHistory> histories;
     for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
         auto& info = *pinfo;
         for (const auto& incomingShape : shapes) {
@@ -1457,154 +1874,94 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
             }
             for (int i = 1; i <= otherMap.count(); i++) {
                 const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
-                                                true,
-                                                &sids));
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown modified shape type " << newShape.ShapeType() << " from "
-                                                              << info.shapetype << i);
-                        continue;
-                    }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
-                                                           << " mismatch with " << info.shapetype
-                                                           << i);
-                        }
-                        continue;
-                    }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // NOLINTNEXTLINE
-                            FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
-                                                   << " from " << info.shapetype << i);
-                        }
-                        continue;
-                    }
-
-                    Data::IndexedName element =
-                        Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
-                        continue;
-                    }
-
-                    key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
+                // The mapper may return the same buffer for both queries
+                std::vector<TopoDS_Shape> modified = mapper.modified(otherElement);
+                const auto& generated = mapper.generated(otherElement);
+                if (modified.empty() && generated.empty()) {
+                    continue;
                 }
+                ElementHistory& history = histories.emplace_back();
+                history.info = &info;
+                history.source = &incomingShape;
+                history.sourceIndex = i;
+                history.element = otherElement;
+                history.modified = std::move(modified);
+                history.generated = generated;
+            }
+        }
+    }
 
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
-                                                               << info.shapetype << i);
-                        continue;
-                    }
+    // Find the modified and generated shapes in the new shape. The ancestry
+    // of the new shape is already built, so the lookup can run in parallel
+    // unless the new shape is located.
+    auto findHistory = [&infoMap, &histories](int index) {
+        findElementHistory(histories[index], infoMap);
+    };
+    if (_Shape.Location().IsIdentity()) {
+        OSD_Parallel::For(0, static_cast<int>(histories.size()), findHistory);
+    }
+    else {
+        for (int i = 0; i < static_cast<int>(histories.size()); i++) {
+            findHistory(i);
+        }
+    }
 
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
-                    }
-                    else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(newShape,
-                                                   newInfo,
-                                                   newShapes,
-                                                   pln,
-                                                   parallelFace,
-                                                   coplanarFace,
-                                                   checkParallel);
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
-                                                       << " from " << info.shapetype << i);
-                            }
-                            continue;
-                        }
+    for (auto& history : histories) {
+        auto& info = *history.info;
+        const auto& incomingShape = *history.source;
+        int i = history.sourceIndex;
 
-                        Data::IndexedName element =
-                            Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
+        Data::ElementIDRefs sids;
+        NameKey key(info.type,
+                    incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
+                                                true,
+                                                &sids));
 
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
-                    }
-                    key.shapetype -= shapeOffset;
+        for (std::size_t j = 0; j < history.entries.size(); ++j) {
+            const auto& entry = history.entries[j];
+            const char* kind = j < history.modifiedCount ? "modified" : "generated";
+            if (!entry.info) {
+                // NOLINTNEXTLINE
+                FC_ERR("unknown " << kind << " shape type " << entry.type << " from "
+                                  << info.shapetype << i);
+                continue;
+            }
+            if (entry.info->type != entry.type) {
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // TODO: it seems modified shape may report higher
+                    // level shape type just like generated shape below.
+                    // Maybe we shall do the same for name construction.
+                    // NOLINTNEXTLINE
+                    FC_WARN("modified shape type " << shapeName(entry.type) << " mismatch with "
+                                                   << info.shapetype << i);
                 }
+                continue;
+            }
+            if (entry.index == 0) {
+                // This warning occurs in makeElementRevolve. It generates
+                // some shape from a vertex that never made into the
+                // final shape. There may be incomingShape cases there.
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // NOLINTNEXTLINE
+                    FC_WARN("Cannot find " << op << " " << kind << " " << entry.info->shapetype
+                                           << " from " << info.shapetype << i);
+                }
+                continue;
+            }
+
+            Data::IndexedName element =
+                Data::IndexedName::fromConst(entry.info->shapetype, entry.index);
+            if (getMappedName(element)) {
+                continue;
             }
+
+            key.tag = incomingShape.Tag;
+            key.shapetype += entry.shapeOffset;
+            auto& name_info = newNames[element][key];
+            key.shapetype -= entry.shapeOffset;
+            name_info.sids = sids;
+            name_info.index = entry.nameIndex;
+            name_info.shapetype = info.shapetype;
         }
     }
 
@@ -1613,6 +1970,10 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     // below, we set delayed=true, and start using those excluded names.
     bool delayed = false;
 
+    // The names of one pass are added together, no name depends on another
+    // one of the same pass
+    std::vector<Data::ElementMap::ElementName> elementNames;
+
     while (true) {
         constexpr int intMin = std::numeric_limits<int>::min();
 
@@ -1757,11 +2118,13 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
 
             ensureElementMap()
                 ->encodeElementName(element[0], first_name, ss, &sids, Tag, op, first_key.tag);
-            elementMap()->setElementName(element, first_name, Tag, &sids);
+            elementNames.push_back({element, first_name, sids});
             if (!delayed && first_key.shapetype < 3) {
                 newNames.erase(itName);
             }
         }
+        ensureElementMap()->setElementNames(elementNames, Tag);
+        elementNames.clear();
 
         // The reverse pass. Starting from the highest level element, i.e.
         // Face, for any element that are named, assign names for its lower unnamed
@@ -1846,9 +2209,11 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                     }
 
                     ensureElementMap()->encodeElementName(indexedName[0], newName, ss, &sids, Tag, op);
-                    elementMap()->setElementName(indexedName, newName, Tag, &sids);
+                    elementNames.push_back({indexedName, newName, sids});
                }
             }
+            ensureElementMap()->setElementNames(elementNames, Tag);
+            elementNames.clear();
         }
 
         // The forward pass. For any elements that are not named, try construct its
@@ -3944,10 +4309,7 @@ TopoShape& TopoShape::makeElementSlices(const TopoShape& shape,
 {
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
-    int index = 0;
-    for (auto& distance : distances) {
-        cs.slice(++index, distance, wires);
-    }
+    cs.slices(1, distances, wires);
     return makeElementCompound(wires, op, SingleShapeCompoundCreationPolicy::returnShape);
 }
 
@@ -4674,6 +5036,9 @@ public:
     explicit MyRefineMaker(const TopoDS_Shape& s)
         : BRepBuilderAPI_RefineModel(s)
     {}
+    MyRefineMaker(const TopoDS_Shape& s, const TopoDS_Shape& refinedBase)
+        : BRepBuilderAPI_RefineModel(s, refinedBase)
+    {}
 
     void populate(ShapeMapper& mapper)
     {
@@ -4687,7 +5052,10 @@ public:
     }
 };
 
-TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op, RefineFail no_fail)
+TopoShape& TopoShape::makeElementRefine(const TopoShape& shape,
+                                        const char* op,
+                                        RefineFail no_fail,
+                                        const TopoDS_Shape& refinedBase)
 {
     if (shape.isNull()) {
         if (no_fail == RefineFail::throwException) {
@@ -4701,7 +5069,7 @@ TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op,
     }
     bool closed = shape.isClosed();
     try {
-        MyRefineMaker mkRefine(shape.getShape());
+        MyRefineMaker mkRefine(shape.getShape(), refinedBase);
         GenericShapeMapper mapper;
         mkRefine.populate(mapper);
         mapper.init(shape, mkRefine.Shape());
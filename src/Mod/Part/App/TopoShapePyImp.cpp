@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <limits>
+# include <memory>
+# include <mutex>
 # include <sstream>
 # include <boost/regex.hpp>
 
@@ -71,6 +73,7 @@
 #include <App/StringHasherPy.h>
 #include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Rotation.h>
@@ -102,6 +105,51 @@
 
 using namespace Part;
 
+// The STEP and IGES writers share OCC's global interface parameters, so
+// exports running without the GIL still have to be serialized.
+static std::mutex exchangeMutex;
+
+// Returns a copy of the shape for use without the GIL. A plain copy of the TopoShape shares
+// its sub-shapes with every other reference, so meshing or cleaning it would change their
+// triangulation while other threads may read or mesh them. The geometry is shared, only
+// the topology and, if requested, the triangulation is copied.
+static TopoShape unlockedCopy(const TopoShape& shape, bool copyMesh)
+{
+    if (shape.isNull()) {
+        return shape;
+    }
+    return TopoShape(BRepBuilderAPI_Copy(shape.getShape(), false, copyMesh).Shape());
+}
+
+// Releases the GIL around an operation that maps the elements of its result, unless one of
+// the shapes uses a string hasher that is not in the thread-safe mode. Holding the GIL then
+// keeps other Python threads from using the same hasher meanwhile.
+class ShapeGILRelease
+{
+public:
+    explicit ShapeGILRelease(const TopoShape& shape,
+                             const std::vector<TopoShape>& shapes = {})
+    {
+        if (!isThreadSafe(shape)) {
+            return;
+        }
+        for (const auto& sh : shapes) {
+            if (!isThreadSafe(sh)) {
+                return;
+            }
+        }
+        unlock = std::make_unique<Base::PyGILStateRelease>();
+    }
+
+private:
+    static bool isThreadSafe(const TopoShape& shape)
+    {
+        return shape.Hasher.isNull() || shape.Hasher->isThreadSafe();
+    }
+
+    std::unique_ptr<Base::PyGILStateRelease> unlock;
+};
+
 static Py_hash_t _TopoShapeHash(PyObject* self)
 {
     if (!self) {
@@ -347,7 +395,10 @@ PyObject*  TopoShapePy::exportIges(PyObject *args) const
 
     try {
         // write iges file
-        getTopoShapePtr()->exportIges(EncodedName.c_str());
+        TopoShape shape = unlockedCopy(*getTopoShapePtr(), false);
+        Base::PyGILStateRelease unlock;
+        std::lock_guard<std::mutex> lock(exchangeMutex);
+        shape.exportIges(EncodedName.c_str());
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError,e.what());
@@ -368,7 +419,10 @@ PyObject*  TopoShapePy::exportStep(PyObject *args) const
 
     try {
         // write step file
-        getTopoShapePtr()->exportStep(EncodedName.c_str());
+        TopoShape shape = unlockedCopy(*getTopoShapePtr(), false);
+        Base::PyGILStateRelease unlock;
+        std::lock_guard<std::mutex> lock(exchangeMutex);
+        shape.exportStep(EncodedName.c_str());
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError,e.what());
@@ -387,7 +441,9 @@ PyObject*  TopoShapePy::exportBrep(PyObject *args) const
 
         try {
             // write brep file
-            getTopoShapePtr()->exportBrep(EncodedName.c_str());
+            TopoShape shape = unlockedCopy(*getTopoShapePtr(), false);
+            Base::PyGILStateRelease unlock;
+            shape.exportBrep(EncodedName.c_str());
         }
         catch (const Base::Exception& e) {
             PyErr_SetString(PartExceptionOCCError,e.what());
@@ -608,8 +664,10 @@ PyObject*  TopoShapePy::exportStl(PyObject *args) const
     PyMem_Free(Name);
 
     try {
-        // write stl file
-        getTopoShapePtr()->exportStl(EncodedName.c_str(), deflection);
+        // write stl file, a fine enough triangulation of the shape is reused
+        TopoShape shape = unlockedCopy(*getTopoShapePtr(), true);
+        Base::PyGILStateRelease unlock;
+        shape.exportStl(EncodedName.c_str(), deflection);
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PartExceptionOCCError,e.what());
@@ -685,7 +743,13 @@ static PyObject *makeShape(const char *op,const TopoShape &shape, PyObject *args
         std::vector<TopoShape> shapes;
         shapes.push_back(shape);
         getPyShapes(pcObj,shapes);
-        return Py::new_reference_to(shape2pyshape(TopoShape().makeElementBoolean(op,shapes,0,tol)));
+        TopoShape res;
+        {
+            // The operation works on copies of the shapes, let other Python threads run meanwhile
+            ShapeGILRelease unlock(shape, shapes);
+            res.makeElementBoolean(op,shapes,0,tol);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     } PY_CATCH_OCC
 }
 
@@ -719,8 +783,14 @@ PyObject*  TopoShapePy::slice(PyObject *args) const
     Base::Vector3d vec = Py::Vector(dir, false).toVector();
 
     try {
+        TopoShape shape = *getTopoShapePtr();
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape);
+            res = shape.makeElementSlice(vec, d);
+        }
         Py::List wires;
-        for (auto& w : getTopoShapePtr()->makeElementSlice(vec, d).getSubTopoShapes(TopAbs_WIRE)) {
+        for (auto& w : res.getSubTopoShapes(TopAbs_WIRE)) {
             wires.append(shape2pyshape(w));
         }
         return Py::new_reference_to(wires);
@@ -749,7 +819,13 @@ PyObject*  TopoShapePy::slices(PyObject *args) const
         d.reserve(list.size());
         for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it)
             d.push_back((double)Py::Float(*it));
-        return Py::new_reference_to(shape2pyshape(getTopoShapePtr()->makeElementSlices(vec, d)));
+        TopoShape shape = *getTopoShapePtr();
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape);
+            res = shape.makeElementSlices(vec, d);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     catch (Standard_Failure& e) {
         PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
@@ -779,7 +855,10 @@ PyObject*  TopoShapePy::generalFuse(PyObject *args) const
     try {
         getPyShapes(pcObj, shapes);
         TopoShape res;
-        res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        {
+            ShapeGILRelease unlock(shapes.front(), shapes);
+            res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        }
         Py::List mapPy;
         for (auto& mod : modifies) {
             Py::List shapesPy;
@@ -1137,8 +1216,14 @@ PyObject* TopoShapePy::makeFillet(PyObject *args) const
     }
     PY_TRY
     {
-        return Py::new_reference_to(shape2pyshape(
-            getTopoShapePtr()->makeElementFillet(getPyShapes(obj), radius1, radius2)));
+        TopoShape shape = *getTopoShapePtr();
+        std::vector<TopoShape> edges = getPyShapes(obj);
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape, edges);
+            res = shape.makeElementFillet(edges, radius1, radius2);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     PY_CATCH_OCC
     PyErr_Clear();
@@ -1191,8 +1276,14 @@ PyObject* TopoShapePy::makeChamfer(PyObject *args) const
     }
     PY_TRY
     {
-        return Py::new_reference_to(shape2pyshape(
-            getTopoShapePtr()->makeElementChamfer(getPyShapes(obj), Part::ChamferType::twoDistances, radius1, radius2)));
+        TopoShape shape = *getTopoShapePtr();
+        std::vector<TopoShape> edges = getPyShapes(obj);
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape, edges);
+            res = shape.makeElementChamfer(edges, Part::ChamferType::twoDistances, radius1, radius2);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     PY_CATCH_OCC
     PyErr_Clear();
@@ -1244,14 +1335,22 @@ PyObject* TopoShapePy::makeThickness(PyObject *args) const
         return nullptr;
 
     try {
-        return Py::new_reference_to(shape2pyshape(
-            getTopoShapePtr()->makeElementThickSolid(getPyShapes(obj),
-                                                     offset,
-                                                     tolerance,
-                                                     PyObject_IsTrue(inter) ? true : false,
-                                                     PyObject_IsTrue(self_inter) ? true : false,
-                                                     offsetMode,
-                                                     static_cast<JoinType>(join))));
+        TopoShape shape = *getTopoShapePtr();
+        std::vector<TopoShape> faces = getPyShapes(obj);
+        bool intersection = PyObject_IsTrue(inter) ? true : false;
+        bool selfInter = PyObject_IsTrue(self_inter) ? true : false;
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape, faces);
+            res = shape.makeElementThickSolid(faces,
+                                              offset,
+                                              tolerance,
+                                              intersection,
+                                              selfInter,
+                                              offsetMode,
+                                              static_cast<JoinType>(join));
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     catch (Standard_Failure& e) {
         PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
@@ -1275,14 +1374,22 @@ PyObject* TopoShapePy::makeOffsetShape(PyObject *args, PyObject *keywds) const
     }
 
     try {
-        return Py::new_reference_to(shape2pyshape(getTopoShapePtr()->makeElementOffset(
-            offset,
-            tolerance,
-            PyObject_IsTrue(inter) ? true : false,
-            PyObject_IsTrue(self_inter) ? true : false,
-            offsetMode,
-            static_cast<JoinType>(join),
-            PyObject_IsTrue(fill) ? FillType::fill : FillType::noFill)));
+        TopoShape shape = *getTopoShapePtr();
+        bool intersection = PyObject_IsTrue(inter) ? true : false;
+        bool selfInter = PyObject_IsTrue(self_inter) ? true : false;
+        FillType fillType = PyObject_IsTrue(fill) ? FillType::fill : FillType::noFill;
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape);
+            res = shape.makeElementOffset(offset,
+                                          tolerance,
+                                          intersection,
+                                          selfInter,
+                                          offsetMode,
+                                          static_cast<JoinType>(join),
+                                          fillType);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     catch (Standard_Failure& e) {
         PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
@@ -1305,12 +1412,21 @@ PyObject* TopoShapePy::makeOffset2D(PyObject *args, PyObject *keywds) const
     }
 
     try {
-        return Py::new_reference_to(shape2pyshape(getTopoShapePtr()->makeElementOffset2D(
-            offset,
-            static_cast<JoinType>(join),
-            PyObject_IsTrue(fill) ? FillType::fill : FillType::noFill,
-            PyObject_IsTrue(openResult) ? OpenResult::allowOpenResult : OpenResult::noOpenResult,
-            PyObject_IsTrue(inter) ? true : false)));
+        TopoShape shape = *getTopoShapePtr();
+        FillType fillType = PyObject_IsTrue(fill) ? FillType::fill : FillType::noFill;
+        OpenResult open =
+            PyObject_IsTrue(openResult) ? OpenResult::allowOpenResult : OpenResult::noOpenResult;
+        bool intersection = PyObject_IsTrue(inter) ? true : false;
+        TopoShape res;
+        {
+            ShapeGILRelease unlock(shape);
+            res = shape.makeElementOffset2D(offset,
+                                            static_cast<JoinType>(join),
+                                            fillType,
+                                            open,
+                                            intersection);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     PY_CATCH_OCC;
 }
@@ -1523,9 +1639,13 @@ PyObject* TopoShapePy::tessellate(PyObject *args) const
     try {
         std::vector<Base::Vector3d> Points;
         std::vector<Data::ComplexGeoData::Facet> Facets;
-        if (Base::asBoolean(ok))
-            BRepTools::Clean(getTopoShapePtr()->getShape());
-        getTopoShapePtr()->getFaces(Points, Facets,tolerance);
+        // without copying the old triangulation the copy is as good as cleaned
+        bool clean = Base::asBoolean(ok);
+        TopoShape shape = unlockedCopy(*getTopoShapePtr(), !clean);
+        {
+            Base::PyGILStateRelease unlock;
+            shape.getFaces(Points, Facets,tolerance);
+        }
         Py::Tuple tuple(2);
         Py::List vertex;
         for (const auto & Point : Points)
@@ -41,6 +41,7 @@
 # include <BRepTools.hxx>
 # include <BRepTools_WireExplorer.hxx>
 # include <gp_Pln.hxx>
+# include <OSD_Parallel.hxx>
 # include <GeomAdaptor_Curve.hxx>
 # include <GeomLProp_CLProps.hxx>
 # include <GProp_GProps.hxx>
@@ -61,6 +62,7 @@
 #include <unordered_set>
 #include <deque>
 #include <boost/geometry.hpp>
+#include <tuple>
 #include <utility>
 
 #include <Base/Console.h>
@@ -1002,7 +1004,7 @@ public:
         }
     };
 
-    void checkSelfIntersection(const EdgeInfo &info, std::set<IntersectInfo> &params) const
+    void checkSelfIntersection(const EdgeInfo &info, std::vector<IntersectInfo> &params) const
     {
         // Early return if checking for self intersection (only for non linear spline curves)
         if (info.type <= GeomAbs_Parabola || info.isLinear) {
@@ -1037,8 +1039,8 @@ public:
 
         assert(points2d.Length() == points3d.Length());
         for (int i=1; i<=points2d.Length(); ++i) {
-            params.emplace(points2d(i).ParamOnFirst(), points3d(i), info.edge);
-            params.emplace(points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            params.emplace_back(points2d(i).ParamOnFirst(), points3d(i), info.edge);
+            params.emplace_back(points2d(i).ParamOnSecond(), points3d(i), info.edge);
         }
     }
 
@@ -1046,11 +1048,11 @@ public:
     // cognitive complexity
     bool checkIntersectionPlanar(const EdgeInfo& info,
                                  const EdgeInfo& other,
-                                 std::set<IntersectInfo>& params1,
-                                 std::set<IntersectInfo>& params2)
+                                 bool planar,
+                                 std::vector<IntersectInfo>& params1,
+                                 std::vector<IntersectInfo>& params2) const
     {
         gp_Pln pln;
-        bool planar = TopoShape(info.edge).findPlane(pln);
         if (!planar) {
             TopoDS_Compound comp;
             builder.MakeCompound(comp);
@@ -1071,11 +1073,11 @@ public:
                     auto s2 = extss.SupportOnShape2(i);
                     if (s1.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS1(i, par);
-                        pushIntersection(params1, par, extss.PointOnShape1(i), other.edge);
+                        params1.emplace_back(par, extss.PointOnShape1(i), other.edge);
                     }
                     if (s2.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS2(i, par);
-                        pushIntersection(params2, par, extss.PointOnShape2(i), info.edge);
+                        params2.emplace_back(par, extss.PointOnShape2(i), info.edge);
                     }
                 }
                 return false;
@@ -1168,12 +1170,16 @@ public:
         return true;
     }
 
+    // The intersections are collected in the order they are found, they are
+    // merged by pushIntersection() afterwards. \a planar tells whether the edge
+    // of \a info is planar.
     void checkIntersection(const EdgeInfo &info,
                            const EdgeInfo &other,
-                           std::set<IntersectInfo> &params1,
-                           std::set<IntersectInfo> &params2)
+                           bool planar,
+                           std::vector<IntersectInfo> &params1,
+                           std::vector<IntersectInfo> &params2) const
     {
-        if(!checkIntersectionPlanar(info, other, params1, params2)){
+        if(!checkIntersectionPlanar(info, other, planar, params1, params2)){
             return;
         }
 
@@ -1207,17 +1213,14 @@ public:
 
         assert(points2d.Length() == points3d.Length());
         for (int i=1; i<=points2d.Length(); ++i) {
-            pushIntersection(params1, points2d(i).ParamOnFirst(), points3d(i), other.edge);
-            pushIntersection(params2, points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            params1.emplace_back(points2d(i).ParamOnFirst(), points3d(i), other.edge);
+            params2.emplace_back(points2d(i).ParamOnSecond(), points3d(i), info.edge);
         }
     }
 
-    void pushIntersection(std::set<IntersectInfo>& params,
-                          double param,
-                          const gp_Pnt& pt,
-                          const TopoDS_Shape& shape)
+    void pushIntersection(std::set<IntersectInfo>& params, const IntersectInfo& info) const
     {
-        IntersectInfo info(param, pt, shape);
+        const gp_Pnt& pt = info.point;
         auto it = params.upper_bound(info);
         if (it != params.end()) {
             if (it->point.SquareDistance(pt) < myTol2) {
@@ -1294,11 +1297,20 @@ public:
         }
     }
 
-    // Try splitting any edges that intersects other edge
-    void splitEdges()
-    {
-        std::unordered_map<const EdgeInfo*, std::set<IntersectInfo>> intersects;
+    struct EdgeIntersections {
+        const EdgeInfo* info = nullptr;
+        std::vector<IntersectInfo> self;
+        // the intersections with the following edges, on this and on the other edge
+        std::vector<std::tuple<const EdgeInfo*, std::vector<IntersectInfo>, std::vector<IntersectInfo>>>
+            others;
+    };
 
+    // This method was originally part of WireJoinerP::splitEdges(). The
+    // intersections of a block of edges are computed in parallel, and then
+    // merged in the same order as a serial run would do.
+    void splitEdgesFindIntersections(
+        std::unordered_map<const EdgeInfo*, std::set<IntersectInfo>>& intersects)
+    {
         int idx=0;
         for (auto& info : edges) {
             info.iteration = ++idx;
@@ -1307,24 +1319,65 @@ public:
         std::unique_ptr<Base::SequencerLauncher> seq(
                 new Base::SequencerLauncher("Splitting edges", edges.size()));
 
-        idx = 0;
-        for (auto& info : edges) {
-            seq->next(true);
-            ++idx;
-            auto &params = intersects[&info];
-            checkSelfIntersection(info, params);
+        const std::size_t blockSize = 256;
+        std::vector<EdgeIntersections> block;
+        block.reserve(blockSize);
+        auto it = edges.begin();
+        while (it != edges.end()) {
+            block.clear();
+            for (; it != edges.end() && block.size() < blockSize; ++it) {
+                block.emplace_back();
+                auto& entry = block.back();
+                entry.info = &(*it);
+                for (auto vit=boxMap.qbegin(bgi::intersects(it->box)); vit!=boxMap.qend(); ++vit) {
+                    const auto &other = *(*vit);
+                    if (other.iteration <= it->iteration) {
+                        // means the edge is before us, and we've already checked intersection
+                        continue;
+                    }
+                    entry.others.emplace_back(&other,
+                                              std::vector<IntersectInfo>(),
+                                              std::vector<IntersectInfo>());
+                }
+            }
 
-            for (auto vit=boxMap.qbegin(bgi::intersects(info.box)); vit!=boxMap.qend(); ++vit) {
-                const auto &other = *(*vit);
-                if (other.iteration <= idx) {
-                    // means the edge is before us, and we've already checked intersection
-                    continue;
+            OSD_Parallel::For(0, static_cast<int>(block.size()), [this, &block](int i) {
+                auto& entry = block[i];
+                checkSelfIntersection(*entry.info, entry.self);
+                if (entry.others.empty()) {
+                    return;
+                }
+                gp_Pln pln;
+                bool planar = TopoShape(entry.info->edge).findPlane(pln);
+                for (auto& [other, params1, params2] : entry.others) {
+                    checkIntersection(*entry.info, *other, planar, params1, params2);
+                }
+            });
+
+            for (auto& entry : block) {
+                seq->next(true);
+                auto &params = intersects[entry.info];
+                params.insert(entry.self.begin(), entry.self.end());
+                for (auto& [other, params1, params2] : entry.others) {
+                    for (const auto& info : params1) {
+                        pushIntersection(params, info);
+                    }
+                    auto &otherParams = intersects[other];
+                    for (const auto& info : params2) {
+                        pushIntersection(otherParams, info);
+                    }
                 }
-                checkIntersection(info, other, params, intersects[&other]);
             }
         }
+    }
 
-        idx=0;
+    // Try splitting any edges that intersects other edge
+    void splitEdges()
+    {
+        std::unordered_map<const EdgeInfo*, std::set<IntersectInfo>> intersects;
+        splitEdgesFindIntersections(intersects);
+
+        int idx=0;
         std::vector<SplitInfo> splits;
         for (auto it=edges.begin(); it!=edges.end(); ) {
             ++idx;
@@ -162,6 +162,8 @@ void FaceTypeSplitter::split()
     TopExp_Explorer shellIt;
     for (shellIt.Init(shell, TopAbs_FACE); shellIt.More(); shellIt.Next())
     {
+        if (ignoredFaces.Contains(shellIt.Current()))
+            continue;
         TopoDS_Face tempFace(TopoDS::Face(shellIt.Current()));
         GeomAbs_SurfaceType currentType = FaceTypedBase::getFaceType(tempFace);
         SplitMapType::iterator mapIt = typeMap.find(currentType);
@@ -1027,12 +1029,49 @@ FaceUniter::FaceUniter(const TopoDS_Shell &shellIn) : modifiedSignal(false)
     workShell = shellIn;
 }
 
+// Faces that are refined already can only be united with a face that was changed
+// afterwards, as they would have been united before otherwise. So only the changed
+// faces and their neighbours need to be checked.
+bool FaceUniter::findUnchangedFaces(TopTools_MapOfShape &unchanged) const
+{
+    TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
+    TopExp::MapShapesAndAncestors(workShell, TopAbs_EDGE, TopAbs_FACE, edgeToFaceMap);
+
+    TopTools_MapOfShape candidates;
+    TopExp_Explorer shellIt;
+    for (shellIt.Init(workShell, TopAbs_FACE); shellIt.More(); shellIt.Next())
+    {
+        const TopoDS_Shape &face = shellIt.Current();
+        if (refinedFaces.Contains(face.Located(TopLoc_Location())))
+            continue;
+        candidates.Add(face);
+        TopExp_Explorer edgeIt;
+        for (edgeIt.Init(face, TopAbs_EDGE); edgeIt.More(); edgeIt.Next())
+        {
+            TopTools_ListIteratorOfListOfShape faceIt;
+            for (faceIt.Initialize(edgeToFaceMap.FindFromKey(edgeIt.Current())); faceIt.More(); faceIt.Next())
+                candidates.Add(faceIt.Value());
+        }
+    }
+
+    for (shellIt.Init(workShell, TopAbs_FACE); shellIt.More(); shellIt.Next())
+    {
+        if (!candidates.Contains(shellIt.Current()))
+            unchanged.Add(shellIt.Current());
+    }
+    return !candidates.IsEmpty();
+}
+
 bool FaceUniter::process()
 {
     if (workShell.IsNull())
         return false;
     modifiedShapes.clear();
     deletedShapes.clear();
+
+    TopTools_MapOfShape unchangedFaces;
+    if (!refinedFaces.IsEmpty() && !findUnchangedFaces(unchangedFaces))
+        return true;
     typeObjects.push_back(&getPlaneObject());
     typeObjects.push_back(&getCylinderObject());
     typeObjects.push_back(&getBSplineObject());
@@ -1041,6 +1080,7 @@ bool FaceUniter::process()
     bool checkFinalShell = false;
     ModelRefine::FaceTypeSplitter splitter;
     splitter.addShell(workShell);
+    splitter.ignoreFaces(unchangedFaces);
     std::vector<FaceTypedBase *>::iterator typeIt;
     for(typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt)
         splitter.registerType((*typeIt)->getType());
@@ -1223,6 +1263,16 @@ Part::BRepBuilderAPI_RefineModel::BRepBuilderAPI_RefineModel(const TopoDS_Shape&
     Build();
 }
 
+Part::BRepBuilderAPI_RefineModel::BRepBuilderAPI_RefineModel(const TopoDS_Shape& shape,
+                                                             const TopoDS_Shape& refinedBase)
+{
+    myShape = shape;
+    TopExp_Explorer xp;
+    for (xp.Init(refinedBase, TopAbs_FACE); xp.More(); xp.Next())
+        myRefinedFaces.Add(xp.Current().Located(TopLoc_Location()));
+    Build();
+}
+
 #if OCC_VERSION_HEX >= 0x070600
 void Part::BRepBuilderAPI_RefineModel::Build(const Message_ProgressRange&)
 #else
@@ -1239,6 +1289,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
         for (it.Init(solid, TopAbs_SHELL); it.More(); it.Next()) {
             const TopoDS_Shell &currentShell = TopoDS::Shell(it.Current());
             ModelRefine::FaceUniter uniter(currentShell);
+            uniter.setRefinedFaces(myRefinedFaces);
             if (uniter.process()) {
                 if (uniter.isModified()) {
                     const TopoDS_Shell &newShell = uniter.getShell();
@@ -1258,6 +1309,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
     else if (myShape.ShapeType() == TopAbs_SHELL) {
         const TopoDS_Shell& shell = TopoDS::Shell(myShape);
         ModelRefine::FaceUniter uniter(shell);
+        uniter.setRefinedFaces(myRefinedFaces);
         if (uniter.process()) {
             // TODO: Why not check for uniter.isModified()?
             myShape = uniter.getShell();
@@ -1281,6 +1333,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
             for (it.Init(solid, TopAbs_SHELL); it.More(); it.Next()) {
                 const TopoDS_Shell &currentShell = TopoDS::Shell(it.Current());
                 ModelRefine::FaceUniter uniter(currentShell);
+                uniter.setRefinedFaces(myRefinedFaces);
                 if (uniter.process()) {
                     if (uniter.isModified()) {
                         const TopoDS_Shell &newShell = uniter.getShell();
@@ -1295,6 +1348,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
         for (xp.Init(myShape, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next()) {
             const TopoDS_Shell& shell = TopoDS::Shell(xp.Current());
             ModelRefine::FaceUniter uniter(shell);
+            uniter.setRefinedFaces(myRefinedFaces);
             if (uniter.process()) {
                 builder.Add(comp, uniter.getShell());
                 LogModifications(uniter);
@@ -118,11 +118,14 @@ namespace ModelRefine
         void addShell(const TopoDS_Shell &shellIn);
         void registerType(const GeomAbs_SurfaceType &type);
         bool hasType(const GeomAbs_SurfaceType &type) const;
+        /// faces of the shell that are left out by split()
+        void ignoreFaces(const TopTools_MapOfShape &faces){ignoredFaces = faces;}
         void split();
         const FaceVectorType& getTypedFaceVector(const GeomAbs_SurfaceType &type) const;
     private:
         SplitMapType typeMap;
         TopoDS_Shell shell;
+        TopTools_MapOfShape ignoredFaces;
     };
 
     class FaceAdjacencySplitter
@@ -162,6 +165,11 @@ namespace ModelRefine
         FaceUniter() = default;
     public:
         FaceUniter(const TopoDS_Shell &shellIn);
+        /** Faces that are known to be refined already, e.g. the faces of the base shape
+         * of the last operation. Only the other faces of the shell and their neighbours
+         * are united then. The faces are compared without their location.
+         */
+        void setRefinedFaces(const TopTools_MapOfShape &faces){refinedFaces = faces;}
         bool process();
         const TopoDS_Shell& getShell() const {return workShell;}
         bool isModified(){return modifiedSignal;}
@@ -171,7 +179,10 @@ namespace ModelRefine
         {return deletedShapes;}
 
     private:
+        bool findUnchangedFaces(TopTools_MapOfShape &unchanged) const;
+
         TopoDS_Shell workShell;
+        TopTools_MapOfShape refinedFaces;
         std::vector<FaceTypedBase *> typeObjects;
         std::vector<ShapePairType> modifiedShapes;
         ShapeVectorType deletedShapes;
@@ -199,6 +210,11 @@ class PartExport BRepBuilderAPI_RefineModel : public BRepBuilderAPI_MakeShape
 {
 public:
     BRepBuilderAPI_RefineModel(const TopoDS_Shape&);
+    /** Only refines the faces of the shape that are not in \a refinedBase and their
+     * neighbours. \a refinedBase must be refined already, typically it's the base
+     * shape of the operation that made the shape.
+     */
+    BRepBuilderAPI_RefineModel(const TopoDS_Shape&, const TopoDS_Shape& refinedBase);
 #if OCC_VERSION_HEX >= 0x070600
     void Build(const Message_ProgressRange& theRange = Message_ProgressRange()) override;
 #else
@@ -214,6 +230,7 @@ protected:
     TopTools_DataMapOfShapeListOfShape myModified;
     TopTools_ListOfShape myEmptyList;
     TopTools_ListOfShape myDeleted;
+    TopTools_MapOfShape myRefinedFaces;
 };
 }
 
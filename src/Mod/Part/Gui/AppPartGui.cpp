@@ -37,6 +37,7 @@
 
 #include "AttacherTexts.h"
 #include "PropertyEnumAttacherItem.h"
+#include "PropertyTessellationCache.h"
 #include "DlgSettings3DViewPartImp.h"
 #include "DlgSettingsGeneral.h"
 #include "DlgSettingsObjectColor.h"
@@ -158,6 +159,7 @@ PyMOD_INIT_FUNC(PartGui)
 
     // clang-format off
     PartGui::PropertyEnumAttacherItem               ::init();
+    PartGui::PropertyTessellationCache              ::init();
     PartGui::SoBrepFaceSet                          ::initClass();
     PartGui::SoBrepEdgeSet                          ::initClass();
     PartGui::SoBrepPointSet                         ::initClass();
@@ -111,6 +111,7 @@ void DlgSettings3DViewPart::saveSettings()
 {
     ui->maxDeviation->onSave();
     ui->maxAngularDeflection->onSave();
+    ui->saveTessellation->onSave();
 
     // search for Part view providers and apply the new settings
     std::vector<App::Document*> docs = App::GetApplication().getDocuments();
@@ -127,6 +128,7 @@ void DlgSettings3DViewPart::loadSettings()
 {
     ui->maxDeviation->onRestore();
     ui->maxAngularDeflection->onRestore();
+    ui->saveTessellation->onRestore();
 }
 
 /**
@@ -49,6 +49,7 @@
 
 // STL
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <sstream>
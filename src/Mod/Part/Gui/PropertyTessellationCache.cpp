@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <numeric>
+# include <ostream>
+# include <streambuf>
+# include <TopoDS_Shape.hxx>
+#endif
+
+#include <App/Application.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include "PropertyTessellationCache.h"
+#include "ViewProviderExt.h"
+
+
+using namespace PartGui;
+
+namespace
+{
+
+constexpr std::uint32_t fileVersion = 1;
+
+// A 64-bit FNV-1a hash of everything written to it
+class DigestBuffer: public std::streambuf
+{
+public:
+    std::uint64_t value() const
+    {
+        return hash;
+    }
+    void add(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            char c = traits_type::to_char_type(ch);
+            add(&c, 1);
+        }
+        return traits_type::not_eof(ch);
+    }
+    std::streamsize xsputn(const char* str, std::streamsize count) override
+    {
+        add(str, static_cast<std::size_t>(count));
+        return count;
+    }
+
+private:
+    std::uint64_t hash = 14695981039346656037ULL;
+};
+
+static_assert(sizeof(SbVec3f) == 3 * sizeof(float), "SbVec3f is written as three floats");
+
+template<typename T>
+void writeVector(Base::OutputStream& str, const std::vector<T>& values)
+{
+    str << static_cast<std::uint32_t>(values.size());
+    str.writeArray(values.data(), values.size());
+}
+
+void writeVector(Base::OutputStream& str, const std::vector<SbVec3f>& values)
+{
+    str << static_cast<std::uint32_t>(values.size());
+    if (!values.empty()) {
+        str.writeArray(values.front().getValue(), 3 * values.size());
+    }
+}
+
+template<typename T>
+bool readVector(Base::InputStream& str, std::vector<T>& values)
+{
+    std::uint32_t count = 0;
+    str >> count;
+    if (!str) {
+        return false;
+    }
+    values.resize(count);
+    str.readArray(values.data(), values.size());
+    return true;
+}
+
+bool readVector(Base::InputStream& str, std::vector<SbVec3f>& values)
+{
+    std::uint32_t count = 0;
+    str >> count;
+    if (!str) {
+        return false;
+    }
+    values.resize(count);
+    std::vector<float> coords(3 * std::size_t(count));
+    str.readArray(coords.data(), coords.size());
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i].setValue(&coords[3 * i]);
+    }
+    return true;
+}
+
+// checks the indices before they are passed to the scene graph
+bool isConsistent(const Tessellation& tess)
+{
+    auto numPoints = static_cast<int32_t>(tess.points.size());
+    if (tess.normals.size() > tess.points.size() || tess.pointStart < 0
+        || tess.pointStart > numPoints || tess.faceIndex.size() % 4 != 0) {
+        return false;
+    }
+    std::size_t numTriangles = std::accumulate(tess.partIndex.begin(), tess.partIndex.end(),
+                                               std::size_t(0));
+    if (numTriangles != tess.faceIndex.size() / 4) {
+        return false;
+    }
+    auto isIndex = [numPoints](int32_t index) {
+        return index < numPoints && index >= -1;
+    };
+    return std::all_of(tess.faceIndex.begin(), tess.faceIndex.end(), isIndex)
+        && std::all_of(tess.lineIndex.begin(), tess.lineIndex.end(), isIndex);
+}
+
+}  // namespace
+
+TYPESYSTEM_SOURCE(PartGui::PropertyTessellationCache, App::Property)
+
+void PropertyTessellationCache::setValue()
+{
+    restored.reset();
+}
+
+std::shared_ptr<Tessellation> PropertyTessellationCache::takeRestored()
+{
+    return std::move(restored);
+}
+
+bool PropertyTessellationCache::isEnabled()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part")
+        ->GetBool("SaveTessellation", false);
+}
+
+std::uint64_t PropertyTessellationCache::digest(const TopoDS_Shape& shape,
+                                                double deflection,
+                                                double angularDeflection,
+                                                bool uvNormals)
+{
+    DigestBuffer buffer;
+    std::ostream str(&buffer);
+    Part::TopoShape(shape).exportBinary(str);
+    buffer.add(&deflection, sizeof(deflection));
+    buffer.add(&angularDeflection, sizeof(angularDeflection));
+    buffer.add(&uvNormals, sizeof(uvNormals));
+    // zero means no tessellation is saved
+    return std::max<std::uint64_t>(buffer.value(), 1);
+}
+
+void PropertyTessellationCache::Save(Base::Writer& writer) const
+{
+    saving.reset();
+    auto vp = freecad_cast<ViewProviderPartExt*>(getContainer());
+    if (vp && !writer.isForceXML() && isEnabled()) {
+        auto tess = std::make_shared<Tessellation>();
+        if (vp->getTessellation(*tess)) {
+            saving = tess;
+        }
+        else {
+            // keep the tessellation of a shape that hasn't been displayed since
+            saving = restored;
+        }
+    }
+
+    if (saving) {
+        writer.Stream() << writer.ind() << "<TessellationCache file=\""
+                        << writer.addFile("TessellationCache", this) << "\"/>\n";
+    }
+    else {
+        writer.Stream() << writer.ind() << "<TessellationCache/>\n";
+    }
+}
+
+void PropertyTessellationCache::Restore(Base::XMLReader& reader)
+{
+    restored.reset();
+    reader.readElement("TessellationCache");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute<const char*>("file"));
+        if (!file.empty()) {
+            reader.addFile(file.c_str(), this);
+        }
+    }
+}
+
+void PropertyTessellationCache::SaveDocFile(Base::Writer& writer) const
+{
+    auto tess = std::move(saving);
+    saving.reset();
+    if (!tess) {
+        return;
+    }
+
+    Base::OutputStream str(writer.Stream());
+    str << fileVersion << tess->key << tess->pointStart;
+    writeVector(str, tess->points);
+    writeVector(str, tess->normals);
+    writeVector(str, tess->faceIndex);
+    writeVector(str, tess->partIndex);
+    writeVector(str, tess->lineIndex);
+}
+
+void PropertyTessellationCache::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    auto tess = std::make_shared<Tessellation>();
+    std::uint32_t version = 0;
+    str >> version;
+    if (!str || version != fileVersion) {
+        return;
+    }
+    str >> tess->key >> tess->pointStart;
+    if (readVector(str, tess->points) && readVector(str, tess->normals)
+        && readVector(str, tess->faceIndex) && readVector(str, tess->partIndex)
+        && readVector(str, tess->lineIndex) && !reader.fail() && isConsistent(*tess)) {
+        restored = tess;
+    }
+}
+
+App::Property* PropertyTessellationCache::Copy() const
+{
+    // the cache belongs to the shape of its view provider
+    return new PropertyTessellationCache();
+}
+
+void PropertyTessellationCache::Paste(const App::Property& /*from*/)
+{
+    restored.reset();
+}
+
+unsigned int PropertyTessellationCache::getMemSize() const
+{
+    if (!restored) {
+        return 0;
+    }
+    return static_cast<unsigned int>(
+        (restored->points.size() + restored->normals.size()) * sizeof(SbVec3f)
+        + (restored->faceIndex.size() + restored->partIndex.size() + restored->lineIndex.size())
+            * sizeof(int32_t));
+}
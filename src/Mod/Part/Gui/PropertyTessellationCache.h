@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PARTGUI_PROPERTYTESSELLATIONCACHE_H
+#define PARTGUI_PROPERTYTESSELLATIONCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Inventor/SbVec3f.h>
+
+#include <App/Property.h>
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Shape;
+
+namespace PartGui
+{
+
+/// The display buffers of a shape as built by ViewProviderPartExt::updateVisual()
+struct Tessellation
+{
+    /// Identifies the shape and the tessellation settings, see PropertyTessellationCache::digest()
+    std::uint64_t key = 0;
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    std::vector<int32_t> faceIndex;
+    std::vector<int32_t> partIndex;
+    std::vector<int32_t> lineIndex;
+    int32_t pointStart = 0;
+};
+
+/** Saves the display tessellation of a Part view provider with the document
+ *
+ * The tessellation is written to a file of GuiDocument.xml when the document is saved and read
+ * back when it is opened, so that shapes whose geometry didn't change are displayed without
+ * meshing them again. The property doesn't hold a value of its own, it takes the buffers from its
+ * view provider when it is saved.
+ */
+class PartGuiExport PropertyTessellationCache: public App::Property
+{
+    TYPESYSTEM_HEADER_WITH_OVERRIDE();
+
+public:
+    /// Discards the restored tessellation
+    void setValue();
+    /// Returns the tessellation read from the document and releases it
+    std::shared_ptr<Tessellation> takeRestored();
+
+    /// Whether the tessellation is saved with the document
+    static bool isEnabled();
+    /** A digest of the geometry of \a shape and the tessellation settings
+     * The shape is hashed in the binary BRep format without triangulation, which gives the
+     * same value for a shape and its copy read from a file.
+     */
+    static std::uint64_t
+    digest(const TopoDS_Shape& shape, double deflection, double angularDeflection, bool uvNormals);
+
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
+    App::Property* Copy() const override;
+    void Paste(const App::Property& from) override;
+    unsigned int getMemSize() const override;
+
+private:
+    // taken from the view provider in Save(), because SaveDocFile() may run in another thread
+    mutable std::shared_ptr<Tessellation> saving;
+    std::shared_ptr<Tessellation> restored;
+};
+
+}  // namespace PartGui
+
+#endif  // PARTGUI_PROPERTYTESSELLATIONCACHE_H
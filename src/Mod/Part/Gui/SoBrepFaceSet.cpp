@@ -89,18 +89,23 @@ public:
         uint32_t myvbo[2];
         std::size_t vertex_array_size;
         std::size_t index_array_size;
+        std::size_t geometryKey;
+        uint32_t indice_array;
         bool updateVbo;
+        bool updateColors;
         bool vboLoaded;
+        // the parts whose colours must be uploaded, all of them if empty
+        std::set<int> changedParts;
     };
 
     static SbBool vboAvailable;
-    uint32_t indice_array;
+    std::size_t geometryKey;
     std::map<uint32_t, Buffer> vbomap;
 
     VBO()
     {
         SoContextHandler::addContextDestructionCallback(context_destruction_cb, this);
-        indice_array = 0;
+        geometryKey = 0;
     }
     ~VBO()
     {
@@ -132,6 +137,22 @@ public:
                 const int mbind,
                 SbBool texture);
 
+    static void fillColors(SoState * state,
+                           const int32_t *partindices,
+                           int num_partindices,
+                           int mbind,
+                           std::size_t num_vertices,
+                           float * color_array);
+
+    using ColorRun = std::pair<std::size_t, std::vector<float>>;
+    static bool getPartColors(SoState * state,
+                              const int32_t *partindices,
+                              int num_partindices,
+                              int mbind,
+                              std::size_t num_vertices,
+                              const std::set<int>& parts,
+                              std::vector<ColorRun>& runs);
+
     static void context_destruction_cb(uint32_t context, void * userdata)
     {
         VBO * self = static_cast<VBO*>(userdata);
@@ -177,6 +198,36 @@ SoBrepFaceSet::SoBrepFaceSet()
 
 SoBrepFaceSet::~SoBrepFaceSet() = default;
 
+void SoBrepFaceSet::setGeometryKey(std::size_t key)
+{
+    PRIVATE(this)->geometryKey = key;
+}
+
+std::size_t SoBrepFaceSet::getGeometryKey() const
+{
+    return PRIVATE(this)->geometryKey;
+}
+
+void SoBrepFaceSet::updatePartColors(const std::set<int>& parts)
+{
+    std::size_t key = PRIVATE(this)->geometryKey;
+    for (auto &v : PRIVATE(this)->vbomap) {
+        VBO::Buffer &buf = v.second;
+        if (key == 0 || buf.geometryKey != key) {
+            buf.updateVbo = true;
+            buf.vboLoaded = false;
+        }
+        else if (!buf.updateColors) {
+            buf.updateColors = true;
+            buf.changedParts = parts;
+        }
+        else if (!buf.changedParts.empty()) {
+            // an earlier change that is not yet uploaded
+            buf.changedParts.insert(parts.begin(), parts.end());
+        }
+    }
+}
+
 void SoBrepFaceSet::doAction(SoAction* action)
 {
     if (action->getTypeId() == Gui::SoHighlightElementAction::getClassTypeId()) {
@@ -333,9 +384,18 @@ void SoBrepFaceSet::doAction(SoAction* action)
     // but the base class made this method private so that we can't override it.
     // So, the alternative way is to write a custom SoAction class.
     else if (action->getTypeId() == Gui::SoUpdateVBOAction::getClassTypeId()) {
+        // If the buffers still hold the tessellation identified by the geometry key only
+        // the colours must be refreshed. A changed key is detected when rendering.
+        std::size_t key = PRIVATE(this)->geometryKey;
         for(auto &v : PRIVATE(this)->vbomap) {
-            v.second.updateVbo = true;
-            v.second.vboLoaded = false;
+            if (key != 0 && v.second.geometryKey == key) {
+                v.second.updateColors = true;
+                v.second.changedParts.clear();
+            }
+            else {
+                v.second.updateVbo = true;
+                v.second.vboLoaded = false;
+            }
         }
     }
 
@@ -1364,6 +1424,70 @@ void SoBrepFaceSet::renderSelection(SoGLRenderAction *action, SelContextPtr ctx,
         this->readUnlockNormalCache();
 }
 
+void SoBrepFaceSet::VBO::fillColors(SoState * state,
+                                    const int32_t *partindices,
+                                    int num_partindices,
+                                    int mbind,
+                                    std::size_t num_vertices,
+                                    float * color_array)
+{
+    // Only per-part colours are supported, for all other bindings the first
+    // diffuse colour is used
+    int numColors = SoLazyElement::getInstance(state)->getNumDiffuse();
+    SbColor color = SoLazyElement::getDiffuse(state, 0);
+    std::size_t vertex = 0;
+    auto setColor = [&](std::size_t end) {
+        for (; vertex < end; vertex++) {
+            float * rgba = color_array + 4 * vertex;
+            color.getValue(rgba[0], rgba[1], rgba[2]);
+            rgba[3] = 1.0F;
+        }
+    };
+
+    for (int part = 0; part < num_partindices && vertex < num_vertices; part++) {
+        if (mbind == PER_PART && part < numColors)
+            color = SoLazyElement::getDiffuse(state, part);
+        std::size_t numTria = static_cast<std::size_t>(std::max(partindices[part], 0));
+        setColor(std::min(num_vertices, vertex + 3 * numTria));
+    }
+
+    // triangles not covered by partIndex keep the last colour
+    setColor(num_vertices);
+}
+
+bool SoBrepFaceSet::VBO::getPartColors(SoState * state,
+                                       const int32_t *partindices,
+                                       int num_partindices,
+                                       int mbind,
+                                       std::size_t num_vertices,
+                                       const std::set<int>& parts,
+                                       std::vector<ColorRun>& runs)
+{
+    // Uploading most of the parts one by one is slower than uploading all colours
+    if (mbind != PER_PART || 2 * parts.size() > static_cast<std::size_t>(num_partindices)
+        || SoLazyElement::getInstance(state)->getNumDiffuse() < num_partindices)
+        return false;
+
+    // The colours of adjacent parts are collected into a single run that
+    // starts at the first vertex of the first part
+    std::size_t vertex = 0;
+    for (int part = 0; part < num_partindices && vertex < num_vertices; part++) {
+        std::size_t numTria = static_cast<std::size_t>(std::max(partindices[part], 0));
+        std::size_t end = std::min(num_vertices, vertex + 3 * numTria);
+        if (end > vertex && parts.count(part)) {
+            if (runs.empty() || runs.back().first + runs.back().second.size() / 4 != vertex)
+                runs.emplace_back(vertex, std::vector<float>());
+            std::vector<float>& rgba = runs.back().second;
+            float r, g, b;
+            SoLazyElement::getDiffuse(state, part).getValue(r, g, b);
+            for (std::size_t i = vertex; i < end; i++)
+                rgba.insert(rgba.end(), {r, g, b, 1.0F});
+        }
+        vertex = end;
+    }
+    return true;
+}
+
 void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
                                 const SoGLCoordinateElement * const vertexlist,
                                 const int32_t *vertexindices,
@@ -1400,13 +1524,10 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
 
     float * vertex_array = nullptr;
     GLuint * index_array = nullptr;
-    SbColor  mycolor1,mycolor2,mycolor3;
     SbVec3f *mynormal1 = const_cast<SbVec3f *>(currnormal);
     SbVec3f *mynormal2 = const_cast<SbVec3f *>(currnormal);
     SbVec3f *mynormal3 = const_cast<SbVec3f *>(currnormal);
     int indice=0;
-    uint32_t RGBA,R,G,B,A;
-    float Rf,Gf,Bf,Af;
 
     uint32_t contextId = action->getCacheContext();
     auto res = this->vbomap.insert(std::make_pair(contextId,VBO::Buffer()));
@@ -1419,6 +1540,9 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
         glGenBuffersARB(2, buf.myvbo);
         buf.vertex_array_size = 0;
         buf.index_array_size = 0;
+        buf.geometryKey = 0;
+        buf.indice_array = 0;
+        buf.updateColors = false;
         buf.vboLoaded = false;
     }
 
@@ -1428,13 +1552,25 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             buf.updateVbo = true;
     }
 
+    // the tessellation has changed since the buffers were filled
+    if (buf.vboLoaded && buf.geometryKey != this->geometryKey)
+        buf.updateVbo = true;
+
     // vbo loaded is defining if we must pre-load data into the VBO. When the variable is set to 0
     // it means that the VBO has not been initialized
     // updateVbo is tracking the need to update the content of the VBO which act as a buffer within
     // the graphic card
-    // TODO FINISHING THE COLOR SUPPORT !
+    // updateColors only requests to re-upload the colour block of the vertex buffer, this is what
+    // happens when only the face colours have changed.
+    //
+    // The vertex buffer holds the interleaved vertex coordinates and normals of all triangles
+    // followed by a block with the RGBA values of each vertex. This way the colours can be
+    // replaced without touching the geometry.
+
+    SoState * state = action->getState();
 
     if (!buf.vboLoaded || buf.updateVbo) {
+        ZoneScopedN("VBO upload");
 #ifdef FC_OS_WIN32
         const cc_glglue * glue = cc_glglue_instance(action->getCacheContext());
 
@@ -1452,14 +1588,7 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
         index_array = ( GLuint *) malloc ( sizeof(GLuint) * num_indices );
         buf.vertex_array_size = sizeof(float) * num_indices * 10;
         buf.index_array_size = sizeof(GLuint) * num_indices;
-        this->vbomap[contextId] = buf;
-        this->indice_array = 0;
-
-        // Get the initial colors
-        SoState * state = action->getState();
-        mycolor1=SoLazyElement::getDiffuse(state,0);
-        mycolor2=SoLazyElement::getDiffuse(state,0);
-        mycolor3=SoLazyElement::getDiffuse(state,0);
+        buf.indice_array = 0;
 
         pi = piptr < piendptr ? *piptr++ : -1;
         while (pi == 0) {
@@ -1484,12 +1613,8 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             (void)v4;
 
             if (mbind == PER_PART) {
-                if (trinr == 0) {
+                if (trinr == 0)
                     materials->send(matnr++, true);
-                    mycolor1=SoLazyElement::getDiffuse(state,matnr-1);
-                    mycolor2=mycolor1;
-                    mycolor3=mycolor1;
-                }
             }
             else if (mbind == PER_PART_INDEXED) {
                 if (trinr == 0)
@@ -1547,12 +1672,12 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
 
             /* We building the Vertex dataset there and push it to a VBO */
             /* The Vertex array shall contain per element vertex_coordinates[3],
-            normal_coordinates[3], color_value[3] (RGBA format) */
+            normal_coordinates[3]. The colours are added as a separate block. */
 
-            index_array[this->indice_array] =   this->indice_array;
-            index_array[this->indice_array+1] = this->indice_array + 1;
-            index_array[this->indice_array+2] = this->indice_array + 2;
-            this->indice_array += 3;
+            index_array[buf.indice_array] =   buf.indice_array;
+            index_array[buf.indice_array+1] = buf.indice_array + 1;
+            index_array[buf.indice_array+2] = buf.indice_array + 2;
+            buf.indice_array += 3;
 
 
             ((SbVec3f *)(cur_coords3d+v1 ))->getValue(vertex_array[indice+0],
@@ -1562,24 +1687,7 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             ((SbVec3f *)(mynormal1))->getValue(vertex_array[indice+3],
                                                vertex_array[indice+4],
                                                vertex_array[indice+5]);
-
-            /* We decode the Vertex1 color */
-            RGBA = mycolor1.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
+            indice+=6;
 
             ((SbVec3f *)(cur_coords3d+v2))->getValue(vertex_array[indice+0],
                                                      vertex_array[indice+1],
@@ -1587,23 +1695,7 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             ((SbVec3f *)(mynormal2))->getValue(vertex_array[indice+3],
                                                vertex_array[indice+4],
                                                vertex_array[indice+5]);
-
-            RGBA = mycolor2.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
+            indice+=6;
 
             ((SbVec3f *)(cur_coords3d+v3))->getValue(vertex_array[indice+0],
                                                      vertex_array[indice+1],
@@ -1611,23 +1703,7 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             ((SbVec3f *)(mynormal3))->getValue(vertex_array[indice+3],
                                                vertex_array[indice+4],
                                                vertex_array[indice+5]);
-
-            RGBA = mycolor3.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
+            indice+=6;
 
             /* ============================================================ */
             trinr++;
@@ -1645,20 +1721,57 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             }
         }
 
+        // the colour block directly follows the vertex data
+        float * color_array = vertex_array + indice;
+        fillColors(state, partindices, num_partindices, mbind, buf.indice_array, color_array);
+        std::size_t color_size = sizeof(float) * 4 * buf.indice_array;
+
         glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * indice , vertex_array, GL_DYNAMIC_DRAW_ARB);
+        glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * indice + color_size , vertex_array, GL_DYNAMIC_DRAW_ARB);
 
         glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
-        glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLuint) * this->indice_array , &index_array[0], GL_DYNAMIC_DRAW_ARB);
+        glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLuint) * buf.indice_array , &index_array[0], GL_DYNAMIC_DRAW_ARB);
 
         glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
         glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
 
+        buf.geometryKey = this->geometryKey;
         buf.vboLoaded = true;
         buf.updateVbo = false;
+        buf.updateColors = false;
+        buf.changedParts.clear();
         free(vertex_array);
         free(index_array);
     }
+    else if (buf.updateColors) {
+        ZoneScopedN("VBO colour update");
+#ifdef FC_OS_WIN32
+        const cc_glglue * glue = cc_glglue_instance(action->getCacheContext());
+        PFNGLBINDBUFFERARBPROC glBindBufferARB = (PFNGLBINDBUFFERARBPROC) cc_glglue_getprocaddress(glue, "glBindBufferARB");
+        PFNGLBUFFERSUBDATAARBPROC glBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)cc_glglue_getprocaddress(glue, "glBufferSubDataARB");
+#endif
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
+        std::vector<VBO::ColorRun> runs;
+        if (!buf.changedParts.empty() &&
+            getPartColors(state, partindices, num_partindices, mbind, buf.indice_array, buf.changedParts, runs)) {
+            // Only replace the colours of the changed parts
+            for (const auto& run : runs) {
+                glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * (6 * buf.indice_array + 4 * run.first),
+                                   sizeof(float) * run.second.size(), run.second.data());
+            }
+        }
+        else {
+            // Only replace the colour block behind the vertex data
+            std::vector<float> color_array(4 * buf.indice_array);
+            fillColors(state, partindices, num_partindices, mbind, buf.indice_array, color_array.data());
+            glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * 6 * buf.indice_array,
+                               sizeof(float) * color_array.size(), color_array.data());
+        }
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+
+        buf.updateColors = false;
+        buf.changedParts.clear();
+    }
 
     // This is the VBO rendering code
 #ifdef FC_OS_WIN32
@@ -1675,11 +1788,11 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_COLOR_ARRAY);
 
-    glVertexPointer(3,GL_FLOAT,10*sizeof(GLfloat),nullptr);
-    glNormalPointer(GL_FLOAT,10*sizeof(GLfloat),(GLvoid *)(3*sizeof(GLfloat)));
-    glColorPointer(4,GL_FLOAT,10*sizeof(GLfloat),(GLvoid *)(6*sizeof(GLfloat)));
+    glVertexPointer(3,GL_FLOAT,6*sizeof(GLfloat),nullptr);
+    glNormalPointer(GL_FLOAT,6*sizeof(GLfloat),(GLvoid *)(3*sizeof(GLfloat)));
+    glColorPointer(4,GL_FLOAT,0,(GLvoid *)(6*sizeof(GLfloat)*buf.indice_array));
 
-    glDrawElements(GL_TRIANGLES, this->indice_array, GL_UNSIGNED_INT, (void *)nullptr);
+    glDrawElements(GL_TRIANGLES, buf.indice_array, GL_UNSIGNED_INT, (void *)nullptr);
 
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
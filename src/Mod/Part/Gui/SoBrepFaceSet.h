@@ -27,6 +27,7 @@
 #include <Inventor/fields/SoSFInt32.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
 #include <memory>
+#include <set>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
 #include <Mod/Part/PartGlobal.h>
@@ -82,6 +83,23 @@ public:
 
     SoMFInt32 partIndex;
 
+    /**
+     * Sets a key that identifies the tessellation currently stored in the coordinate,
+     * normal and index fields, e.g. a hash of the shape and the tessellation parameters.
+     * As long as the key doesn't change a SoUpdateVBOAction only refreshes the colours
+     * of the vertex buffer objects instead of re-uploading the whole geometry.
+     * A key of 0 (the default) disables this and every SoUpdateVBOAction rebuilds the
+     * buffers.
+     */
+    void setGeometryKey(std::size_t key);
+    std::size_t getGeometryKey() const;
+    /**
+     * Tells that only the colours of the given parts have changed. Like a SoUpdateVBOAction
+     * this refreshes the colours of the vertex buffer objects, but only the vertices of these
+     * parts are uploaded. The colours must be bound per part to make use of it.
+     */
+    void updatePartColors(const std::set<int>& parts);
+
 protected:
     ~SoBrepFaceSet() override;
     void GLRender(SoGLRenderAction *action) override;
@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
+# include <memory>
 # include <QCheckBox>
 # include <QCoreApplication>
 # include <QHeaderView>
@@ -41,6 +43,7 @@
 # include <BRepCheck_ListIteratorOfListOfStatus.hxx>
 # include <BRepCheck_Result.hxx>
 # include <BRepTools_ShapeSet.hxx>
+# include <OSD_Parallel.hxx>
 # include <ShapeAnalysis_FreeBounds.hxx>
 # include <TopoDS.hxx>
 # include <TopoDS_Compound.hxx>
@@ -431,7 +434,45 @@ void TaskCheckGeometryResults::goCheck()
                                    selection.size());
     theScope.Show();
 
-    for(const auto &sel :  selection) {
+    // Resolving the shapes touches the document, so only BRepCheck_Analyzer runs in parallel
+    // over the selection. This is done a block at a time to bound the memory held by the
+    // analyzers of big selections.
+    const std::size_t blockSize = std::max(1, OSD_Parallel::NbLogicalProcessors()) * 4;
+    std::vector<TopoDS_Shape> blockShapes;
+    std::vector<std::unique_ptr<BRepCheck_Analyzer>> blockChecks;
+    auto checkBlock = [&](std::size_t first) {
+        std::size_t count = std::min(blockSize, selection.size() - first);
+        blockShapes.assign(count, TopoDS_Shape());
+        blockChecks.clear();
+        blockChecks.resize(count);
+        for (std::size_t k = 0; k < count; ++k) {
+            const auto& sel = selection[first + k];
+            blockShapes[k] = Part::Feature::getShape(
+                sel.pObject,
+                  Part::ShapeOption::NeedSubElement
+                | Part::ShapeOption::ResolveLink
+                | Part::ShapeOption::Transform,
+                sel.SubName);
+        }
+        OSD_Parallel::For(0, static_cast<int>(count), [&](int k) {
+            const TopoDS_Shape& shape = blockShapes[k];
+            if (shape.IsNull() || shape.Infinite()) {
+                return;
+            }
+            try {
+                blockChecks[k] = std::make_unique<BRepCheck_Analyzer>(shape);
+            }
+            catch (const Standard_Failure&) {
+                // left to the serial pass below, which reports the failure as before
+            }
+        });
+    };
+
+    for (std::size_t index = 0; index < selection.size(); ++index) {
+        const auto& sel = selection[index];
+        if (index % blockSize == 0) {
+            checkBlock(index);
+        }
         selectedCount++;
         int localInvalidShapeCount(0);
         QString baseName;
@@ -443,13 +484,7 @@ void TaskCheckGeometryResults::goCheck()
             baseStream << " (" << label.c_str() << ")";
         }
 
-        TopoDS_Shape shape = Part::Feature::getShape(
-            sel.pObject,
-              Part::ShapeOption::NeedSubElement 
-            | Part::ShapeOption::ResolveLink
-            | Part::ShapeOption::Transform,
-            sel.SubName);
-            
+        TopoDS_Shape shape = blockShapes[index % blockSize];
         if (shape.IsNull()) {
             ResultEntry *entry = new ResultEntry();
             entry->parent = theRoot;
@@ -482,7 +517,11 @@ void TaskCheckGeometryResults::goCheck()
 
         buildShapeContent(sel.pObject, baseName, shape);
 
-        BRepCheck_Analyzer shapeCheck(shape);
+        auto& shapeCheckPtr = blockChecks[index % blockSize];
+        if (!shapeCheckPtr) {
+            shapeCheckPtr = std::make_unique<BRepCheck_Analyzer>(shape);
+        }
+        const BRepCheck_Analyzer& shapeCheck = *shapeCheckPtr;
         if (!shapeCheck.IsValid())
         {
             invalidShapes++;
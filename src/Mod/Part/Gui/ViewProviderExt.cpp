@@ -50,6 +50,8 @@
 
 # include <QAction>
 # include <QMenu>
+# include <cmath>
+# include <functional>
 # include <sstream>
 
 # include <Inventor/SoPickedPoint.h>
@@ -70,6 +72,8 @@
 # include <boost/algorithm/string/predicate.hpp>
 #endif
 
+#include <QtConcurrentMap>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Console.h>
@@ -97,6 +101,19 @@ FC_LOG_LEVEL_INIT("Part", true, true)
 
 using namespace PartGui;
 
+namespace {
+// The triangulation of a face and where its data starts in the Inventor arrays
+struct FaceTriangulation
+{
+    TopoDS_Face face;
+    Handle(Poly_Triangulation) mesh;
+    TopLoc_Location location;
+    int part {0};
+    int nodeOffset {0};
+    int triaOffset {0};
+};
+}
+
 PROPERTY_SOURCE(PartGui::ViewProviderPartExt, Gui::ViewProviderGeometryObject)
 
 
@@ -185,6 +202,7 @@ ViewProviderPartExt::ViewProviderPartExt()
     ADD_PROPERTY_TYPE(DrawStyle,((long int)0), osgroup, App::Prop_None, "Defines the style of the edges in the 3D view.");
     DrawStyle.setEnums(DrawStyleEnums);
     ADD_PROPERTY_TYPE(ShowPlacement,(false), "Display Options", App::Prop_None, "If true, placement of object is additionally rendered.");
+    ADD_PROPERTY_TYPE(TessellationCache, (), "", App::Prop_Hidden, "The tessellation saved with the document.");
 
     coords = new SoCoordinate3();
     coords->ref();
@@ -275,13 +293,13 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     // to freeze the GUI
     // https://forum.freecad.org/viewtopic.php?f=3&t=24912&p=195613
     if (prop == &Deviation) {
-        if(isUpdateForced()||Visibility.getValue())
+        if((isUpdateForced()||Visibility.getValue()) && !isRestoring())
             updateVisual();
         else
             VisualTouched = true;
     }
     if (prop == &AngularDeflection) {
-        if(isUpdateForced()||Visibility.getValue())
+        if((isUpdateForced()||Visibility.getValue()) && !isRestoring())
             updateVisual();
         else
             VisualTouched = true;
@@ -379,17 +397,11 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     }
     else {
         // if the object was invisible and has been changed, recreate the visual
-        if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && VisualTouched) {
-            updateVisual();
-            // updateVisual() may not be triggered by any change (e.g.
-            // triggered by an external object through forceUpdate()). And
-            // since ShapeAppearance is not changed here either, do not falsely set
-            // the document modified status
-            Base::ObjectStatusLocker<App::Property::Status,App::Property> guard(
-                    App::Property::NoModify, &ShapeAppearance);
-            // The material has to be checked again (#0001736)
-            onChanged(&ShapeAppearance);
-            onChanged(&ShowPlacement);
+        // While restoring this is done in finishRestoring(), after the tessellation
+        // saved with the document has been read
+        if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && VisualTouched
+            && !isRestoring()) {
+            updateTouchedVisual();
         }
     }
 
@@ -660,7 +672,47 @@ void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Material>&
 
 void ViewProviderPartExt::setHighlightedFaces(const App::PropertyMaterialList& appearance)
 {
-    setHighlightedFaces(appearance.getValues());
+    // If only some faces got a new material and the materials are already bound
+    // per face, just these are replaced
+    const std::set<int>& touched = appearance.getTouchList();
+    const std::vector<App::Material>& materials = appearance.getValues();
+    int size = static_cast<int>(materials.size());
+    if (touched.empty() || size < 2 || size != this->faceset->partIndex.getNum()
+        || pcFaceBind->value.getValue() != SoMaterialBinding::PER_PART
+        || pcShapeMaterial->diffuseColor.getNum() != size) {
+        setHighlightedFaces(materials);
+        return;
+    }
+
+    if (getObject() && getObject()->testStatus(App::ObjectStatus::TouchOnColorChange))
+        getObject()->touch(true);
+
+    SbColor* dc = pcShapeMaterial->diffuseColor.startEditing();
+    SbColor* ac = pcShapeMaterial->ambientColor.startEditing();
+    SbColor* sc = pcShapeMaterial->specularColor.startEditing();
+    SbColor* ec = pcShapeMaterial->emissiveColor.startEditing();
+    float* sh = pcShapeMaterial->shininess.startEditing();
+    float* tr = pcShapeMaterial->transparency.startEditing();
+
+    for (int i : touched) {
+        if (i < 0 || i >= size)
+            continue;
+        dc[i].setValue(materials[i].diffuseColor.r, materials[i].diffuseColor.g, materials[i].diffuseColor.b);
+        ac[i].setValue(materials[i].ambientColor.r, materials[i].ambientColor.g, materials[i].ambientColor.b);
+        sc[i].setValue(materials[i].specularColor.r, materials[i].specularColor.g, materials[i].specularColor.b);
+        ec[i].setValue(materials[i].emissiveColor.r, materials[i].emissiveColor.g, materials[i].emissiveColor.b);
+        sh[i] = materials[i].shininess;
+        tr[i] = materials[i].transparency;
+    }
+
+    pcShapeMaterial->diffuseColor.finishEditing();
+    pcShapeMaterial->ambientColor.finishEditing();
+    pcShapeMaterial->specularColor.finishEditing();
+    pcShapeMaterial->emissiveColor.finishEditing();
+    pcShapeMaterial->shininess.finishEditing();
+    pcShapeMaterial->transparency.finishEditing();
+
+    this->faceset->updatePartColors(touched);
 }
 
 std::map<std::string,Base::Color> ViewProviderPartExt::getElementColors(const char *element) const {
@@ -865,6 +917,20 @@ void ViewProviderPartExt::updateData(const App::Property* prop)
     Gui::ViewProviderGeometryObject::updateData(prop);
 }
 
+void ViewProviderPartExt::updateTouchedVisual()
+{
+    updateVisual();
+    // updateVisual() may not be triggered by any change (e.g.
+    // triggered by an external object through forceUpdate()). And
+    // since ShapeAppearance is not changed here either, do not falsely set
+    // the document modified status
+    Base::ObjectStatusLocker<App::Property::Status,App::Property> guard(
+            App::Property::NoModify, &ShapeAppearance);
+    // The material has to be checked again (#0001736)
+    onChanged(&ShapeAppearance);
+    onChanged(&ShowPlacement);
+}
+
 void ViewProviderPartExt::startRestoring()
 {
     Gui::ViewProviderGeometryObject::startRestoring();
@@ -872,6 +938,10 @@ void ViewProviderPartExt::startRestoring()
 
 void ViewProviderPartExt::finishRestoring()
 {
+    // The visual was left over while restoring, see onChanged()
+    if ((isUpdateForced() || Visibility.getValue()) && VisualTouched) {
+        updateTouchedVisual();
+    }
     // The ShapeAppearance property is restored after DiffuseColor
     // and currently sets a single color.
     // In case DiffuseColor has defined multiple colors they will
@@ -926,6 +996,40 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
+bool ViewProviderPartExt::getTessellation(Tessellation& tess) const
+{
+    if (VisualTouched || tessellationDigest == 0) {
+        return false;
+    }
+
+    auto copy = [](auto& values, const auto& field) {
+        const auto* begin = field.getValues(0);
+        values.assign(begin, begin + field.getNum());
+    };
+    tess.key = tessellationDigest;
+    copy(tess.points, coords->point);
+    copy(tess.normals, norm->vector);
+    copy(tess.faceIndex, faceset->coordIndex);
+    copy(tess.partIndex, faceset->partIndex);
+    copy(tess.lineIndex, lineset->coordIndex);
+    tess.pointStart = nodeset->startIndex.getValue();
+    return true;
+}
+
+void ViewProviderPartExt::setTessellation(const Tessellation& tess)
+{
+    auto assign = [](auto& field, const auto& values) {
+        field.setNum(static_cast<int>(values.size()));
+        field.setValues(0, static_cast<int>(values.size()), values.data());
+    };
+    assign(coords->point, tess.points);
+    assign(norm->vector, tess.normals);
+    assign(faceset->coordIndex, tess.faceIndex);
+    assign(faceset->partIndex, tess.partIndex);
+    assign(lineset->coordIndex, tess.lineIndex);
+    nodeset->startIndex.setValue(tess.pointStart);
+}
+
 void ViewProviderPartExt::updateVisual()
 {
     Gui::SoUpdateVBOAction action;
@@ -949,6 +1053,7 @@ void ViewProviderPartExt::updateVisual()
         norm    ->vector     .setNum(0);
         faceset ->coordIndex .setNum(0);
         faceset ->partIndex  .setNum(0);
+        faceset ->setGeometryKey(0);
         lineset ->coordIndex .setNum(0);
         nodeset ->startIndex .setValue(0);
         VisualTouched = false;
@@ -959,11 +1064,21 @@ void ViewProviderPartExt::updateVisual()
     Base::TimeElapsed start_time;
     int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
     std::set<int> faceEdges;
+    std::size_t geometryKey = 0;
 
     try {
         // calculating the deflection value
+        // Use the bounds of the untransformed shape unless it's scaled, so that all
+        // placed instances of a shape ask for the same tessellation and the one
+        // stored with the shared sub-shapes is reused
         Bnd_Box bounds;
-        BRepBndLib::Add(cShape, bounds);
+        const gp_Trsf& trsf = cShape.Location().Transformation();
+        if (std::abs(trsf.ScaleFactor() - 1.0) < Precision::Confusion()) {
+            BRepBndLib::Add(cShape.Located(TopLoc_Location()), bounds);
+        }
+        else {
+            BRepBndLib::Add(cShape, bounds);
+        }
         bounds.SetGap(0.0);
         Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
         bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
@@ -983,6 +1098,35 @@ void ViewProviderPartExt::updateVisual()
         // create or use the mesh on the data structure
         Standard_Real AngDeflectionRads = Base::toRadians(AngularDeflection.getValue());
 
+        // The same shape meshed with the same parameters gives the same tessellation, so
+        // the face set can keep its vertex buffers
+        auto hashCombine = [](std::size_t& seed, auto value) {
+            seed ^= std::hash<decltype(value)>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        std::size_t tessellationKey = Part::ShapeMapHasher{}(cShape);
+        hashCombine(tessellationKey, deflection);
+        hashCombine(tessellationKey, AngDeflectionRads);
+        hashCombine(tessellationKey, NormalsFromUV);
+
+        // The tessellation saved with the document is used if the geometry of the shape is
+        // still the same. The untransformed shape is compared because the placement is applied
+        // by the scene graph.
+        std::shared_ptr<Tessellation> restored = TessellationCache.takeRestored();
+        tessellationDigest = 0;
+        if (restored || PropertyTessellationCache::isEnabled()) {
+            tessellationDigest = PropertyTessellationCache::digest(
+                cShape.Located(TopLoc_Location()), deflection, AngDeflectionRads, NormalsFromUV);
+        }
+        if (restored && restored->key == tessellationDigest) {
+            setTessellation(*restored);
+            faceset->setGeometryKey(tessellationKey);
+            VisualTouched = false;
+            setHighlightedFaces(ShapeAppearance.getValues());
+            setHighlightedEdges(LineColorArray.getValues());
+            setHighlightedPoints(PointColorArray.getValue());
+            return;
+        }
+
         IMeshTools_Parameters meshParams;
         meshParams.Deflection = deflection;
         meshParams.Relative = Standard_False;
@@ -1000,10 +1144,16 @@ void ViewProviderPartExt::updateVisual()
         // count triangles and nodes in the mesh
         TopTools_IndexedMapOfShape faceMap;
         TopExp::MapShapes(cShape, TopAbs_FACE, faceMap);
+        std::vector<FaceTriangulation> faceMeshes(faceMap.Extent());
         for (int i=1; i <= faceMap.Extent(); i++) {
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
+            FaceTriangulation& faceMesh = faceMeshes[i-1];
+            faceMesh.face = TopoDS::Face(faceMap(i));
+            faceMesh.part = i-1;
+            faceMesh.nodeOffset = numNodes;
+            faceMesh.triaOffset = numTriangles;
+            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(faceMesh.face, faceMesh.location);
             if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
+                mesh = Part::Tools::triangulationOfFace(faceMesh.face);
             }
             // Note: we must also count empty faces
             if (!mesh.IsNull()) {
@@ -1011,6 +1161,7 @@ void ViewProviderPartExt::updateVisual()
                 numNodes     += mesh->NbNodes();
                 numNorms     += mesh->NbNodes();
             }
+            faceMesh.mesh = mesh;
 
             TopExp_Explorer xp;
             for (xp.Init(faceMap(i),TopAbs_EDGE);xp.More();xp.Next()) {
@@ -1073,33 +1224,32 @@ void ViewProviderPartExt::updateVisual()
         for (int i=0;i < numNorms;i++)
             norms[i]= SbVec3f(0.0,0.0,0.0);
 
-        int ii = 0,faceNodeOffset=0,faceTriaOffset=0;
-        for (int i=1; i <= faceMap.Extent(); i++, ii++) {
-            TopLoc_Location aLoc;
-            const TopoDS_Face &actFace = TopoDS::Face(faceMap(i));
-            // get the mesh of the shape
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace,aLoc);
-            if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(actFace);
-            }
+        // Every face writes its nodes, normals and triangles into its own range of the arrays.
+        // So, the faces can be processed in parallel while keeping the order of the face map
+        // for the part indexes.
+        auto fillFace = [&](const FaceTriangulation& faceMesh) {
+            const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
             if (mesh.IsNull()) {
-                parts[ii] = 0;
-                continue;
+                parts[faceMesh.part] = 0;
+                return;
             }
 
             // getting the transformation of the shape/face
             gp_Trsf myTransf;
             Standard_Boolean identity = true;
-            if (!aLoc.IsIdentity()) {
+            if (!faceMesh.location.IsIdentity()) {
                 identity = false;
-                myTransf = aLoc.Transformation();
+                myTransf = faceMesh.location.Transformation();
             }
 
+            int faceNodeOffset = faceMesh.nodeOffset;
+            int faceTriaOffset = faceMesh.triaOffset;
+
             // getting size of node and triangle array of this face
             int nbNodesInFace = mesh->NbNodes();
             int nbTriInFace   = mesh->NbTriangles();
             // check orientation
-            TopAbs_Orientation orient = actFace.Orientation();
+            TopAbs_Orientation orient = faceMesh.face.Orientation();
 
 
             // cycling through the poly mesh
@@ -1108,11 +1258,10 @@ void ViewProviderPartExt::updateVisual()
             const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
             TColgp_Array1OfDir Normals (Nodes.Lower(), Nodes.Upper());
 #else
-            int numNodes =  mesh->NbNodes();
-            TColgp_Array1OfDir Normals (1, numNodes);
+            TColgp_Array1OfDir Normals (1, nbNodesInFace);
 #endif
             if (NormalsFromUV)
-                Part::Tools::getPointNormals(actFace, mesh, Normals);
+                Part::Tools::getPointNormals(faceMesh.face, mesh, Normals);
 
             for (int g=1;g<=nbTriInFace;g++) {
                 // Get the triangle
@@ -1183,11 +1332,35 @@ void ViewProviderPartExt::updateVisual()
                 index[faceTriaOffset*4+4*(g-1)+3] = SO_END_FACE_INDEX;
             }
 
-            parts[ii] = nbTriInFace; // new part
+            parts[faceMesh.part] = nbTriInFace; // new part
+
+            // normalize the normals of this face
+            for (int i = faceNodeOffset; i < faceNodeOffset + nbNodesInFace; i++)
+                norms[i].normalize();
+        };
+        QtConcurrent::blockingMap(faceMeshes, fillFace);
+
+        // handling the edges lying on the faces
+        for (const FaceTriangulation& faceMesh : faceMeshes) {
+            const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
+            if (mesh.IsNull()) {
+                continue;
+            }
+
+            // getting the transformation of the shape/face
+            gp_Trsf myTransf;
+            Standard_Boolean identity = true;
+            if (!faceMesh.location.IsIdentity()) {
+                identity = false;
+                myTransf = faceMesh.location.Transformation();
+            }
 
-            // handling the edges lying on this face
+#if OCC_VERSION_HEX < 0x070600
+            const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
+#endif
+            TopLoc_Location aLoc = faceMesh.location;
             TopExp_Explorer Exp;
-            for(Exp.Init(actFace,TopAbs_EDGE);Exp.More();Exp.Next()) {
+            for(Exp.Init(faceMesh.face,TopAbs_EDGE);Exp.More();Exp.Next()) {
                 const TopoDS_Edge &curEdge = TopoDS::Edge(Exp.Current());
                 // get the overall index of this edge
                 int edgeIndex = edgeMap.FindIndex(curEdge);
@@ -1204,7 +1377,7 @@ void ViewProviderPartExt::updateVisual()
                     const TColStd_Array1OfInteger& indices = aPoly->Nodes();
                     for (Standard_Integer i=indices.Lower();i <= indices.Upper();i++) {
                         int nodeIndex = indices(i);
-                        int index = faceNodeOffset+nodeIndex-1;
+                        int index = faceMesh.nodeOffset+nodeIndex-1;
                         lineSetMap[edgeIndex].push_back(index);
 
                         // usually the coordinates for this edge are already set by the
@@ -1228,12 +1401,10 @@ void ViewProviderPartExt::updateVisual()
             }
 
             edgeVector.push_back(-1);
-
-            // counting up the per Face offsets
-            faceNodeOffset += nbNodesInFace;
-            faceTriaOffset += nbTriInFace;
         }
 
+        int faceNodeOffset = numNorms;
+
         // handling of the free edges
         for (int i=1; i <= edgeMap.Extent(); i++) {
             const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
@@ -1276,10 +1447,6 @@ void ViewProviderPartExt::updateVisual()
             verts[faceNodeOffset+i].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
         }
 
-        // normalize all normals
-        for (int i = 0; i< numNorms ;i++)
-            norms[i].normalize();
-
         std::vector<int32_t> lineSetCoords;
         for (const auto & it : lineSetMap) {
             lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
@@ -1301,15 +1468,20 @@ void ViewProviderPartExt::updateVisual()
         faceset ->coordIndex  .finishEditing();
         faceset ->partIndex   .finishEditing();
         lineset ->coordIndex  .finishEditing();
+        geometryKey = tessellationKey;
     }
     catch (const Standard_Failure& e) {
         FC_ERR("Cannot compute Inventor representation for the shape of "
                << pcObject->getFullName() << ": " << e.GetMessageString());
+        tessellationDigest = 0;
     }
     catch (...) {
         FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+        tessellationDigest = 0;
     }
 
+    faceset->setGeometryKey(geometryKey);
+
 #   ifdef FC_DEBUG
         // printing some information
         Base::Console().log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
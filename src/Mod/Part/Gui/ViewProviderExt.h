@@ -32,6 +32,8 @@
 #include <Mod/Part/App/PartFeature.h>
 #include <Mod/Part/PartGlobal.h>
 
+#include "PropertyTessellationCache.h"
+
 
 class TopoDS_Shape;
 class TopoDS_Edge;
@@ -89,6 +91,8 @@ public:
     App::PropertyColor LineColor;
     App::PropertyMaterial LineMaterial;
     App::PropertyColorList LineColorArray;
+    /// The display tessellation saved with the document
+    PropertyTessellationCache TessellationCache;
 
     void attach(App::DocumentObject *) override;
     void setDisplayMode(const char* ModeName) override;
@@ -96,6 +100,8 @@ public:
     std::vector<std::string> getDisplayModes() const override;
     /// Update the view representation
     void reload();
+    /// Copies the display buffers if they are up to date and are to be saved
+    bool getTessellation(Tessellation& tess) const;
     /// If no other task is pending it opens a dialog to allow one to change face colors
     bool changeFaceAppearances();
 
@@ -166,6 +172,7 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    void setTessellation(const Tessellation& tess);
     void handleChangedPropertyName(Base::XMLReader& reader,
                                    const char* TypeName,
                                    const char* PropName) override;
@@ -191,6 +198,10 @@ protected:
     bool NormalsFromUV;
 
 private:
+    void updateTouchedVisual();
+
+    // the digest of the displayed tessellation if it's to be saved, otherwise 0
+    std::uint64_t tessellationDigest = 0;
     Gui::ViewProviderFaceTexture texture;
     // settings stuff
     int forceUpdateCount;
@@ -43,6 +43,9 @@ PROPERTY_SOURCE(PartDesign::Body, Part::BodyBase)
 
 Body::Body() {
     ADD_PROPERTY_TYPE(AllowCompound, (false), "Experimental", App::Prop_None, "Allow multiple solids in Body (experimental)");
+    ADD_PROPERTY_TYPE(CheckpointInterval, (0), "Experimental", App::Prop_None,
+        "Keep the shape of every n-th feature before the Tip and drop the others to save memory.\n"
+        "Dropped shapes are recomputed when needed. 0 keeps all shapes (experimental)");
 
     _GroupTouched.setStatus(App::Property::Output, true);
 
@@ -403,6 +406,9 @@ App::DocumentObjectExecReturn *Body::execute()
             return new App::DocumentObjectExecReturn (QT_TRANSLATE_NOOP("Exception", "Linked object is not a PartDesign feature" ));
         }
 
+        // the Tip may have been moved back onto a feature whose shape was dropped
+        static_cast<PartDesign::Feature*>(tip)->restoreShape();
+
         // get the shape of the tip
         tipShape = static_cast<Part::Feature *>(tip)->Shape.getShape();
 
@@ -418,10 +424,57 @@ App::DocumentObjectExecReturn *Body::execute()
     }
 
     Shape.setValue ( tipShape );
+    releaseIntermediateShapes();
     return App::DocumentObject::StdReturn;
 
 }
 
+void Body::releaseIntermediateShapes()
+{
+    int interval = CheckpointInterval.getValue();
+    App::DocumentObject* tip = Tip.getValue();
+    if (interval <= 0 || !tip) {
+        return;
+    }
+
+    int index = 0;
+    for (auto obj : Group.getValues()) {
+        if (obj == tip) {
+            break;
+        }
+        if (!isSolidFeature(obj)) {
+            continue;
+        }
+        auto feature = static_cast<PartDesign::Feature*>(obj);
+        if (++index % interval == 0 || feature->isShapeReleased() || feature->isTouched()
+            || feature->Visibility.getValue()) {
+            continue;
+        }
+        // only the next feature of the chain may use the shape, it restores it on demand.
+        // Anything else, like a sketch attached to a face or a pattern, keeps it resident.
+        const auto& inList = feature->getInList();
+        bool chained = std::all_of(inList.begin(), inList.end(), [this, feature](auto in) {
+            if (in == this) {
+                return true;
+            }
+            auto next = freecad_cast<PartDesign::Feature*>(in);
+            return next && next->BaseFeature.getValue() == feature;
+        });
+        if (chained) {
+            feature->releaseShape();
+        }
+    }
+}
+
+void Body::restoreIntermediateShapes()
+{
+    for (auto obj : Group.getValues()) {
+        if (auto feature = freecad_cast<PartDesign::Feature*>(obj)) {
+            feature->restoreShape();
+        }
+    }
+}
+
 void Body::onSettingDocument() {
 
     if(connection.connected())
@@ -464,6 +517,11 @@ void Body::onChanged(const App::Property* prop) {
                     BaseFeature.setValue(nullptr);
             }
         }
+        else if (prop == &CheckpointInterval) {
+            if (CheckpointInterval.getValue() <= 0) {
+                restoreIntermediateShapes();
+            }
+        }
         else if (prop == &AllowCompound) {
             // As disallowing compounds can break the model we need to recompute the whole tree.
             // This will inform user about first place where there is more than one solid.
@@ -42,6 +42,8 @@ class PartDesignExport Body : public Part::BodyBase
 
 public:
     App::PropertyBool AllowCompound;
+    /// Keep the shape of every n-th solid feature before the Tip, drop the others, 0 keeps all
+    App::PropertyInteger CheckpointInterval;
 
     /// True if this body feature is active or was active when the document was last closed
     //App::PropertyBool IsActive;
@@ -152,6 +154,10 @@ protected:
     void onDocumentRestored() override;
 
 private:
+    /// Drop the shapes of the features between the checkpoints, see CheckpointInterval
+    void releaseIntermediateShapes();
+    void restoreIntermediateShapes();
+
     boost::signals2::scoped_connection connection;
     bool showTip = false;
 };
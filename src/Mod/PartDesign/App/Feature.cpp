@@ -38,6 +38,7 @@
 #include <App/ElementNamingUtils.h>
 #include <App/FeaturePythonPyImp.h>
 #include <Base/Console.h>
+#include <Base/Tools.h>
 
 #include "Feature.h"
 #include "FeaturePy.h"
@@ -66,6 +67,8 @@ Feature::Feature()
     ADD_PROPERTY_TYPE(_Body,(nullptr),"Base",(App::PropertyType)(
                 App::Prop_ReadOnly|App::Prop_Hidden|App::Prop_Output|App::Prop_Transient),0);
     ADD_PROPERTY(SuppressedShape,(TopoShape()));
+    ADD_PROPERTY_TYPE(ShapeReleased,(false),"Base",(App::PropertyType)(
+                App::Prop_ReadOnly|App::Prop_Hidden|App::Prop_Output),0);
     Placement.setStatus(App::Property::Hidden, true);
     BaseFeature.setStatus(App::Property::Hidden, true);
 
@@ -259,6 +262,33 @@ const gp_Pnt Feature::getPointFromFace(const TopoDS_Face& f)
     throw Base::NotImplementedError("getPointFromFace(): Not implemented yet for this case");
 }
 
+void Feature::releaseShape()
+{
+    // the shape is a product of the recompute, dropping it must not touch the feature
+    Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> guard(App::NoTouch, this);
+    ShapeReleased.setValue(true);
+    Shape.setValue(TopoShape());
+    SuppressedShape.setValue(TopoShape());
+}
+
+bool Feature::restoreShape()
+{
+    if (!isShapeReleased()) {
+        return true;
+    }
+    if (auto base = freecad_cast<Feature*>(BaseFeature.getValue())) {
+        base->restoreShape();
+    }
+
+    Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> guard(App::NoTouch, this);
+    ShapeReleased.setValue(false);
+    std::unique_ptr<App::DocumentObjectExecReturn> ret(recompute());
+    if (ret) {
+        FC_ERR("Failed to restore the shape of " << getFullName() << ": " << ret->Why);
+    }
+    return !ret;
+}
+
 Part::Feature* Feature::getBaseObject(bool silent) const {
     App::DocumentObject* BaseLink = BaseFeature.getValue();
     Part::Feature* BaseObject = nullptr;
@@ -268,6 +298,9 @@ Part::Feature* Feature::getBaseObject(bool silent) const {
         if (BaseLink->isDerivedFrom<Part::Feature>()) {
             BaseObject = static_cast<Part::Feature*>(BaseLink);
         }
+        if (auto feature = freecad_cast<Feature*>(BaseLink)) {
+            feature->restoreShape();
+        }
         if (!BaseObject) {
             err =  "No base feature linked";
         }
@@ -412,6 +445,9 @@ Body* Feature::getFeatureBody() const {
 App::DocumentObject *Feature::getSubObject(const char *subname,
         PyObject **pyObj, Base::Matrix4D *pmat, bool transform, int depth) const
 {
+    if (isShapeReleased()) {
+        const_cast<Feature*>(this)->restoreShape();
+    }
     if (subname && subname != Data::findElementName(subname)) {
         const char * dot = strchr(subname,'.');
         if (dot) {
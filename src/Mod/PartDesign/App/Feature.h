@@ -62,6 +62,8 @@ public:
     Part::PropertyPartShape SuppressedShape;
     /// Keep a copy of the placement before suppression to restore it back when unsuppressed, fix #20205
     Base::Placement SuppressedPlacement;
+    /// Set while the shape is dropped by the memory mode of the body, see Body::CheckpointInterval
+    App::PropertyBool ShapeReleased;
     App::DocumentObjectExecReturn* recompute() override;
 
     short mustExecute() const override;
@@ -84,6 +86,17 @@ public:
     /// Returns the BaseFeature property's TopoShape (if any)
     Part::TopoShape getBaseTopoShape(bool silent=false) const;
 
+    /** @name intermediate shape memory mode */
+    //@{
+    /// Drop the shape to save memory, restoreShape() regenerates it on demand
+    virtual void releaseShape();
+    /// Recompute a released shape and the released base features it depends on
+    bool restoreShape();
+    bool isShapeReleased() const {
+        return ShapeReleased.getValue();
+    }
+    //@}
+
     PyObject* getPyObject() override;
 
     const char* getViewProviderName() const override {
@@ -27,6 +27,7 @@
 #endif
 
 #include <App/FeaturePythonPyImp.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/modelRefine.h>
 
 #include "FeatureAddSub.h"
@@ -58,6 +59,13 @@ short FeatureAddSub::mustExecute() const
     return PartDesign::Feature::mustExecute();
 }
 
+void FeatureAddSub::releaseShape()
+{
+    Base::ObjectStatusLocker<App::ObjectStatus, App::DocumentObject> guard(App::NoTouch, this);
+    PartDesign::Feature::releaseShape();
+    AddSubShape.setValue(TopoDS_Shape());
+}
+
 void FeatureAddSub::getAddSubShape(Part::TopoShape &addShape, Part::TopoShape &subShape)
 {
     if (addSubType == Additive)
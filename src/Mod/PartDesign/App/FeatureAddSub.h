@@ -48,6 +48,8 @@ public:
 
     virtual void getAddSubShape(Part::TopoShape &addShape, Part::TopoShape &subShape);
 
+    void releaseShape() override;
+
     Part::PropertyPartShape   AddSubShape;
 
 
@@ -2259,13 +2259,18 @@ TopoShape Hole::findHoles(std::vector<TopoShape> &holes,
 {
     TopoShape result(0);
 
+    // The faces of the prototype are the same for every hole, only their names are
+    // generated per profile element. The holes share the prototype's geometry, the
+    // translation only sets their location.
+    std::vector<TopoShape> protoFaces = TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE);
+
     auto addHole = [&](Part::TopoShape const& baseshape, gp_Pnt loc) {
         gp_Trsf localSketchTransformation;
         localSketchTransformation.SetTranslation( gp_Pnt( 0, 0, 0 ),
                                                   gp_Pnt(loc.X(), loc.Y(), loc.Z()) );
 
         Part::ShapeMapper mapper;
-        mapper.populate(Part::MappingStatus::Modified, baseshape, TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE));
+        mapper.populate(Part::MappingStatus::Modified, baseshape, protoFaces);
 
         TopoShape hole(-getID());
         hole.makeShapeWithElementMap(protoHole, mapper, {baseshape});
@@ -32,6 +32,7 @@
 #include <Base/Parameter.h>
 #include <Mod/Part/App/modelRefine.h>
 
+#include "Body.h"
 #include "FeatureRefine.h"
 #include "FeaturePy.h"
 
@@ -87,7 +88,9 @@ TopoShape FeatureRefine::refineShapeIfActive(const TopoShape& oldShape,
     }
     TopoShape shape(oldShape);
     try {
-        return shape.makeElementRefine();
+        return shape.makeElementRefine(nullptr,
+                                       Part::RefineFail::throwException,
+                                       getRefinedBaseShape());
     }
     catch (Standard_Failure& err) {
         if (onError == RefineErrorPolicy::Warn) {
@@ -101,6 +104,30 @@ TopoShape FeatureRefine::refineShapeIfActive(const TopoShape& oldShape,
     return oldShape;
 }
 
+std::string FeatureRefine::getResultCacheKey() const
+{
+    // The result is checked against the solids allowed by the body, and it is refined
+    // incrementally depending on the preference and the base feature
+    auto body = getFeatureBody();
+    bool allowCompound = body && body->AllowCompound.getValue();
+    bool incremental = Refine.getValue() && !getRefinedBaseShape().IsNull();
+    return std::string(allowCompound ? "1" : "0") + (incremental ? "1" : "0");
+}
+
+TopoDS_Shape FeatureRefine::getRefinedBaseShape() const
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/PartDesign");
+    if (!hGrp->GetBool("IncrementalRefine", true)) {
+        return {};
+    }
+    auto base = dynamic_cast<FeatureRefine*>(getBaseObject(true));
+    if (!base || !base->Refine.getValue()) {
+        return {};
+    }
+    return base->Shape.getValue();
+}
+
 }  // namespace PartDesign
 
 
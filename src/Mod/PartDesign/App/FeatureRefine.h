@@ -46,7 +46,16 @@ public:
 
     App::PropertyBool Refine;
 
+    bool canCacheResult() const override {
+        return true;
+    }
+    std::string getResultCacheKey() const override;
+
 protected:
+    void onCachedResultRestored() override {
+        rawShape = TopoShape();
+    }
+
     //store the shape before refinement
     TopoShape rawShape;
 
@@ -62,6 +71,10 @@ protected:
      */
     bool onlyHaveRefined();
     TopoShape refineShapeIfActive(const TopoShape& oldShape, const RefineErrorPolicy onError = RefineErrorPolicy::Raise) const;
+    /** The shape of the base feature if it's refined. Its faces don't need to be
+     * checked again, only the faces changed by this feature and their neighbours.
+     */
+    TopoDS_Shape getRefinedBaseShape() const;
 };
 
 using FeatureRefinePython = App::FeaturePythonT<FeatureRefine>;
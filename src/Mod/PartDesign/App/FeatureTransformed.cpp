@@ -76,6 +76,13 @@ Transformed::Transformed()
     TransformMode.setEnums(transformModeEnums.data());
 }
 
+void Transformed::onCachedResultRestored()
+{
+    FeatureRefine::onCachedResultRestored();
+    // the rejected shapes aren't cached
+    rejected = TopoDS_Shape();
+}
+
 void Transformed::positionBySupport()
 {
     // TODO May be here better to throw exception (silent=false) (2015-07-27, Fat-Zer)
@@ -105,6 +105,7 @@ protected:
                                    const char* TypeName,
                                    App::Property* prop) override;
 
+    void onCachedResultRestored() override;
     virtual void positionBySupport();
     static TopoDS_Shape getRemainingSolids(const TopoDS_Shape&);
 
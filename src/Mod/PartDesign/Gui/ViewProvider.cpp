@@ -178,6 +178,14 @@ void ViewProvider::updateData(const App::Property* prop)
     }
 
     inherited::updateData(prop);
+
+    // a hidden feature would keep the tessellation of a shape that the body dropped,
+    // update the visual now to free it, see PartDesign::Body::CheckpointInterval
+    auto feature = freecad_cast<PartDesign::Feature*>(getObject());
+    if (feature && prop == &feature->Shape && feature->isShapeReleased()
+        && !Visibility.getValue()) {
+        updateVisual();
+    }
 }
 
 void ViewProvider::onChanged(const App::Property* prop) {
@@ -199,6 +207,11 @@ void ViewProvider::onChanged(const App::Property* prop) {
                 }
             }
         }
+
+        // showing a feature whose shape was dropped by the body regenerates it
+        if (auto feature = freecad_cast<PartDesign::Feature*>(getObject())) {
+            feature->restoreShape();
+        }
     }
 
     PartGui::ViewProviderPartExt::onChanged(prop);
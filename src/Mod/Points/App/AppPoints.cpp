@@ -25,6 +25,7 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 
+#include "Downsample.h"
 #include "Points.h"
 #include "PointsPy.h"
 #include "Properties.h"
@@ -59,6 +60,7 @@ PyMOD_INIT_FUNC(Points)
     Points::Structured              ::init();
     Points::FeatureCustom           ::init();
     Points::StructuredCustom        ::init();
+    Points::Downsample              ::init();
     Points::FeaturePython           ::init();
     PyMOD_Return(pointsModule);
     // clang-format on
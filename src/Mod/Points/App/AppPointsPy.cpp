@@ -60,7 +60,7 @@ public:
     }
 
 private:
-    std::tuple<bool, bool, double> readE57Settings() const
+    std::tuple<bool, bool, double, double> readE57Settings() const
     {
         Base::Reference<ParameterGrp> hGrp = App::GetApplication()
                                                  .GetUserParameter()
@@ -70,8 +70,19 @@ private:
         bool useColor = hGrp->GetBool("UseColor", true);
         bool checkState = hGrp->GetBool("CheckInvalidState", true);
         double minDistance = hGrp->GetFloat("MinDistance", -1.);
+        double pointSpacing = hGrp->GetFloat("PointSpacing", 0.0);
 
-        return std::make_tuple(useColor, checkState, minDistance);
+        return std::make_tuple(useColor, checkState, minDistance, pointSpacing);
+    }
+    std::size_t readOutOfCoreThreshold() const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points");
+        // larger clouds are paged out to disk
+        return hGrp->GetUnsigned("OutOfCoreThreshold", 100000000);
     }
     Py::Object open(const Py::Tuple& args)
     {
@@ -97,9 +108,11 @@ private:
             }
             else if (file.hasExtension("e57")) {
                 auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
+                auto e57 = std::make_unique<E57Reader>(std::get<0>(setting),
+                                                       std::get<1>(setting),
+                                                       std::get<2>(setting));
+                e57->setPointSpacing(std::get<3>(setting));
+                reader = std::move(e57);
             }
             else if (file.hasExtension("ply")) {
                 reader = std::make_unique<PlyReader>();
@@ -111,6 +124,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            reader->setOutOfCoreThreshold(readOutOfCoreThreshold());
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().newDocument();
@@ -219,9 +233,11 @@ private:
             }
             else if (file.hasExtension("e57")) {
                 auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
+                auto e57 = std::make_unique<E57Reader>(std::get<0>(setting),
+                                                       std::get<1>(setting),
+                                                       std::get<2>(setting));
+                e57->setPointSpacing(std::get<3>(setting));
+                reader = std::move(e57);
             }
             else if (file.hasExtension("ply")) {
                 reader = std::make_unique<PlyReader>();
@@ -233,6 +249,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            reader->setOutOfCoreThreshold(readOutOfCoreThreshold());
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().getDocument(DocName);
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <memory>
+#endif
+
+#include <Base/Exception.h>
+
+#include "Downsample.h"
+#include "PointsFilter.h"
+#include "Properties.h"
+#include "Tools.h"
+
+
+using namespace Points;
+
+namespace
+{
+const App::PropertyFloatConstraint::Constraints ratioRange = {0.0, 1.0, 0.05};
+}
+
+const char* Downsample::MethodEnums[] = {"VoxelGrid", "Random", "PoissonDisk", nullptr};
+
+PROPERTY_SOURCE(Points::Downsample, Points::Feature)
+
+Downsample::Downsample()
+{
+    ADD_PROPERTY_TYPE(Source, (nullptr), "Downsample", App::Prop_None, "The points to thin out");
+    ADD_PROPERTY_TYPE(Method,
+                      (0L),
+                      "Downsample",
+                      App::Prop_None,
+                      "One point per voxel, a random share or a Poisson-disk sample");
+    Method.setEnums(MethodEnums);
+    ADD_PROPERTY_TYPE(Distance,
+                      (1.0),
+                      "Downsample",
+                      App::Prop_None,
+                      "The edge length of a voxel or the minimum distance of the points");
+    ADD_PROPERTY_TYPE(Ratio, (0.1), "Downsample", App::Prop_None, "The share of random points");
+    Ratio.setConstraints(&ratioRange);
+    ADD_PROPERTY_TYPE(Seed, (0L), "Downsample", App::Prop_None, "The seed of the random points");
+}
+
+short Downsample::mustExecute() const
+{
+    if (Source.isTouched() || Method.isTouched() || Distance.isTouched() || Ratio.isTouched()
+        || Seed.isTouched()) {
+        return 1;
+    }
+    if (Source.getValue() && Source.getValue()->isTouched()) {
+        return 1;
+    }
+    return 0;
+}
+
+App::DocumentObjectExecReturn* Downsample::execute()
+{
+    auto source = freecad_cast<Points::Feature*>(Source.getValue());
+    if (!source) {
+        return new App::DocumentObjectExecReturn("No points specified.\n");
+    }
+    if (source->isError()) {
+        return new App::DocumentObjectExecReturn("No valid points.\n");
+    }
+
+    try {
+        std::unique_ptr<PointsFilter> filter;
+        switch (Method.getValue()) {
+            case 1:
+                filter = std::make_unique<RandomFilter>(Ratio.getValue(),
+                                                        static_cast<std::uint32_t>(Seed.getValue()));
+                break;
+            case 2:
+                filter = std::make_unique<PoissonDiskFilter>(Distance.getValue());
+                break;
+            default:
+                filter = std::make_unique<VoxelGridFilter>(Distance.getValue());
+                break;
+        }
+
+        const PointKernel& kernel = source->Points.getValue();
+        Points.setValue(filter->apply(kernel));
+
+        std::vector<std::size_t> indices = filter->getIndices();
+        copyPropertyValues<PropertyNormalList>(this, source, "Normal", indices);
+        copyPropertyValues<App::PropertyColorList>(this, source, "Color", indices);
+        copyPropertyValues<PropertyGreyValueList>(this, source, "Intensity", indices);
+    }
+    catch (const Base::Exception& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
+
+    return App::DocumentObject::StdReturn;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_DOWNSAMPLE_H
+#define POINTS_DOWNSAMPLE_H
+
+#include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+
+#include "PointsFeature.h"
+
+
+namespace Points
+{
+
+/** The Downsample class thins out the points of another points feature
+ *
+ * Depending on Method one point per voxel of edge length Distance, a random share
+ * Ratio of the points or a Poisson-disk sample with the minimum spacing Distance
+ * is kept. The Normal, Color and Intensity properties of the source are reduced
+ * to the kept points as well.
+ */
+class PointsExport Downsample: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::Downsample);
+
+public:
+    Downsample();
+
+    App::PropertyLink Source;
+    App::PropertyEnumeration Method;
+    App::PropertyLength Distance;
+    App::PropertyFloatConstraint Ratio;
+    App::PropertyInteger Seed;
+
+    /** @name methods override Feature */
+    //@{
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    short mustExecute() const override;
+    //@}
+
+private:
+    static const char* MethodEnums[];
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_DOWNSAMPLE_H
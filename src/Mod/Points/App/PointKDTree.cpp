@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <thread>
+#endif
+
+#include <Eigen/Eigenvalues>
+
+#include "PointKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// the maximum number of points of a leaf
+constexpr std::uint32_t leafSize = 16;
+// the number of points a thread takes at a time in forEachNeighbourhood()
+constexpr std::uint32_t batchSize = 4096;
+
+float distance2(const Base::Vector3f& a, const Base::Vector3f& b)
+{
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    float dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+float coordinate(const Base::Vector3f& pnt, std::uint8_t axis)
+{
+    return axis == 0 ? pnt.x : (axis == 1 ? pnt.y : pnt.z);
+}
+
+// a lambda instead of a function so that the heap operations inline it
+constexpr auto compareDistance = [](const PointKDTree::Neighbour& a,
+                                    const PointKDTree::Neighbour& b) {
+    return a.second < b.second;
+};
+}  // namespace
+
+PointKDTree::PointKDTree(const std::vector<value_type>& source)
+    : numPoints(source.size())
+{
+    // the points are sorted together with their indices, which is more cache friendly
+    // than sorting only the indices
+    std::vector<Entry> entries;
+    entries.reserve(source.size());
+    for (std::size_t i = 0; i < source.size(); i++) {
+        const value_type& pnt = source[i];
+        if (std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z)) {
+            entries.push_back(Entry {pnt, static_cast<std::uint32_t>(i)});
+        }
+    }
+    if (entries.empty()) {
+        return;
+    }
+
+    nodes.reserve(2 * entries.size() / leafSize + 1);
+    build(entries, 0, static_cast<std::uint32_t>(entries.size()));
+
+    points.reserve(entries.size());
+    indices.reserve(entries.size());
+    for (const auto& entry : entries) {
+        points.push_back(entry.point);
+        indices.push_back(entry.index);
+    }
+}
+
+std::uint32_t
+PointKDTree::build(std::vector<Entry>& entries, std::uint32_t begin, std::uint32_t end)
+{
+    auto index = static_cast<std::uint32_t>(nodes.size());
+    nodes.emplace_back();
+    if (end - begin <= leafSize) {
+        nodes[index].first = begin;
+        nodes[index].second = end;
+        return index;
+    }
+
+    // split at the median of the widest axis
+    std::array<float, 3> min {};
+    std::array<float, 3> max {};
+    for (std::uint8_t j = 0; j < 3; j++) {
+        min[j] = max[j] = coordinate(entries[begin].point, j);
+    }
+    for (std::uint32_t i = begin + 1; i < end; i++) {
+        const value_type& pnt = entries[i].point;
+        for (std::uint8_t j = 0; j < 3; j++) {
+            min[j] = std::min(min[j], coordinate(pnt, j));
+            max[j] = std::max(max[j], coordinate(pnt, j));
+        }
+    }
+    std::uint8_t axis = 0;
+    for (std::uint8_t j = 1; j < 3; j++) {
+        if (max[j] - min[j] > max[axis] - min[axis]) {
+            axis = j;
+        }
+    }
+
+    std::uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(entries.begin() + begin,
+                     entries.begin() + mid,
+                     entries.begin() + end,
+                     [axis](const Entry& a, const Entry& b) {
+                         return coordinate(a.point, axis) < coordinate(b.point, axis);
+                     });
+    float split = coordinate(entries[mid].point, axis);
+
+    std::uint32_t left = build(entries, begin, mid);
+    std::uint32_t right = build(entries, mid, end);
+    nodes[index].first = left;
+    nodes[index].second = right;
+    nodes[index].split = split;
+    nodes[index].axis = axis;
+    return index;
+}
+
+/**
+ * Collects the \a k nearest points of the subtree in the max-heap \a heap. \a offsets
+ * are the distances of \a pnt to the box of the subtree along each axis, \a boxDist
+ * is the squared distance to the box.
+ */
+void PointKDTree::search(std::uint32_t index,
+                         const value_type& pnt,
+                         std::size_t k,
+                         std::vector<Neighbour>& heap,
+                         std::array<float, 3>& offsets,
+                         float boxDist) const
+{
+    const Node& node = nodes[index];
+    if (node.axis == 3) {
+        for (std::uint32_t i = node.first; i < node.second; i++) {
+            float dist = distance2(pnt, points[i]);
+            if (heap.size() < k) {
+                heap.emplace_back(i, dist);
+                std::push_heap(heap.begin(), heap.end(), compareDistance);
+            }
+            else if (dist < heap.front().second) {
+                std::pop_heap(heap.begin(), heap.end(), compareDistance);
+                heap.back() = Neighbour(i, dist);
+                std::push_heap(heap.begin(), heap.end(), compareDistance);
+            }
+        }
+        return;
+    }
+
+    float diff = coordinate(pnt, node.axis) - node.split;
+    std::uint32_t nearChild = diff < 0.0F ? node.first : node.second;
+    std::uint32_t farChild = diff < 0.0F ? node.second : node.first;
+    search(nearChild, pnt, k, heap, offsets, boxDist);
+
+    // the far box is at least as far away as the split plane
+    float offset = offsets[node.axis];
+    float farDist = boxDist - offset * offset + diff * diff;
+    if (heap.size() < k || farDist < heap.front().second) {
+        offsets[node.axis] = diff;
+        search(farChild, pnt, k, heap, offsets, farDist);
+        offsets[node.axis] = offset;
+    }
+}
+
+void PointKDTree::search(const value_type& pnt, std::size_t k, std::vector<Neighbour>& heap) const
+{
+    std::array<float, 3> offsets {};
+    search(0, pnt, k, heap, offsets, 0.0F);
+}
+
+std::size_t PointKDTree::findNearest(const value_type& pnt, float& dist) const
+{
+    std::vector<Neighbour> result;
+    findNearest(pnt, 1, result);
+    if (result.empty()) {
+        return NoPoint;
+    }
+    dist = std::sqrt(result.front().second);
+    return result.front().first;
+}
+
+void PointKDTree::findNearest(const value_type& pnt,
+                              std::size_t k,
+                              std::vector<Neighbour>& result) const
+{
+    result.clear();
+    if (nodes.empty() || k == 0) {
+        return;
+    }
+    search(pnt, k, result);
+    std::sort_heap(result.begin(), result.end(), compareDistance);
+    for (auto& neighbour : result) {
+        neighbour.first = indices[neighbour.first];
+    }
+}
+
+void PointKDTree::forEachPosition(
+    std::size_t k,
+    const std::function<void(std::uint32_t, const std::vector<Neighbour>&)>& func) const
+{
+    if (nodes.empty() || k == 0) {
+        return;
+    }
+
+    // the points are taken in the order of the tree so that a batch covers a small region
+    auto count = static_cast<std::uint32_t>(points.size());
+    std::atomic<std::uint32_t> next {0};
+    auto worker = [&]() {
+        std::vector<Neighbour> heap;
+        heap.reserve(k);
+        std::uint32_t begin {};
+        while ((begin = next.fetch_add(batchSize)) < count) {
+            std::uint32_t end = std::min(count, begin + batchSize);
+            for (std::uint32_t i = begin; i < end; i++) {
+                heap.clear();
+                search(points[i], k, heap);
+                std::sort_heap(heap.begin(), heap.end(), compareDistance);
+                func(i, heap);
+            }
+        }
+    };
+
+    unsigned int numThreads = std::min<unsigned int>(
+        std::max(1U, std::thread::hardware_concurrency()),
+        (count + batchSize - 1) / batchSize);
+    std::vector<std::future<void>> futures;
+    for (unsigned int i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void PointKDTree::forEachNeighbourhood(
+    std::size_t k,
+    const std::function<void(std::size_t, const std::vector<Neighbour>&)>& func) const
+{
+    forEachPosition(k, [&](std::uint32_t pos, const std::vector<Neighbour>& neighbours) {
+        thread_local std::vector<Neighbour> result;
+        result = neighbours;
+        for (auto& neighbour : result) {
+            neighbour.first = indices[neighbour.first];
+        }
+        func(indices[pos], result);
+    });
+}
+
+std::vector<PointKDTree::value_type> PointKDTree::estimateNormals(std::size_t k) const
+{
+    std::vector<value_type> normals(numPoints);
+    forEachPosition(k, [&](std::uint32_t pos, const std::vector<Neighbour>& neighbours) {
+        if (neighbours.size() < 3) {
+            return;
+        }
+
+        // covariance of the neighbours relative to their centroid
+        Eigen::Vector3d center = Eigen::Vector3d::Zero();
+        for (const auto& neighbour : neighbours) {
+            const value_type& pnt = points[neighbour.first];
+            center += Eigen::Vector3d(pnt.x, pnt.y, pnt.z);
+        }
+        center /= double(neighbours.size());
+        Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+        for (const auto& neighbour : neighbours) {
+            const value_type& pnt = points[neighbour.first];
+            Eigen::Vector3d diff = Eigen::Vector3d(pnt.x, pnt.y, pnt.z) - center;
+            covariance += diff * diff.transpose();
+        }
+
+        // the eigenvalues are sorted in increasing order
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+        solver.computeDirect(covariance);
+        Eigen::Vector3d normal = solver.eigenvectors().col(0);
+        const value_type& pnt = points[pos];
+        if (normal.dot(Eigen::Vector3d(pnt.x, pnt.y, pnt.z)) > 0.0) {
+            normal = -normal;
+        }
+        normals[indices[pos]].Set(float(normal.x()), float(normal.y()), float(normal.z()));
+    });
+    return normals;
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_POINTKDTREE_H
+#define POINTS_POINTKDTREE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+
+/** Static kd-tree for nearest neighbour queries on a point cloud
+ *
+ * The tree is built once by splitting the points at the median of their widest
+ * axis until at most a few points are left per leaf. The points are stored in
+ * the order of the leaves, so neighbouring points are close in memory. Points
+ * with non-finite coordinates are skipped, all indices refer to the array the
+ * tree is built from.
+ *
+ * The queries are const and may be run from several threads at a time.
+ */
+class PointsExport PointKDTree
+{
+public:
+    using value_type = Base::Vector3f;
+    static constexpr std::size_t NoPoint = std::numeric_limits<std::size_t>::max();
+
+    /// Pair of the index of a point and its squared distance to the query point
+    using Neighbour = std::pair<std::size_t, float>;
+
+    explicit PointKDTree(const std::vector<value_type>& points);
+
+    /// Number of points in the tree
+    std::size_t size() const
+    {
+        return indices.size();
+    }
+    /// Index of the nearest point to \a pnt or NoPoint for an empty tree
+    std::size_t findNearest(const value_type& pnt, float& dist) const;
+    /// The at most \a k nearest points to \a pnt, nearest first
+    void findNearest(const value_type& pnt, std::size_t k, std::vector<Neighbour>& result) const;
+    /** Calls \a func with the index of each point of the tree and its at most \a k nearest
+     * points, which include the point itself. The points are split up between all hardware
+     * threads, so \a func is called concurrently.
+     */
+    void forEachNeighbourhood(
+        std::size_t k,
+        const std::function<void(std::size_t, const std::vector<Neighbour>&)>& func) const;
+    /** Estimates the normal of every point as the axis of the least variance of its \a k
+     * nearest points. The normals point towards the origin like the ones of PCL. Skipped
+     * points and points with less than three neighbours get a null vector.
+     */
+    std::vector<value_type> estimateNormals(std::size_t k) const;
+
+private:
+    struct Node
+    {
+        // the range of the points of a leaf, the children of an inner node
+        std::uint32_t first = 0;
+        std::uint32_t second = 0;
+        float split = 0.0F;
+        // the split axis or 3 for a leaf
+        std::uint8_t axis = 3;
+    };
+
+    struct Entry
+    {
+        value_type point;
+        std::uint32_t index;
+    };
+
+    std::uint32_t build(std::vector<Entry>& entries, std::uint32_t begin, std::uint32_t end);
+    // the neighbours are given by their position in the tree
+    void search(std::uint32_t index,
+                const value_type& pnt,
+                std::size_t k,
+                std::vector<Neighbour>& heap,
+                std::array<float, 3>& offsets,
+                float boxDist) const;
+    void search(const value_type& pnt, std::size_t k, std::vector<Neighbour>& heap) const;
+    void forEachPosition(
+        std::size_t k,
+        const std::function<void(std::uint32_t, const std::vector<Neighbour>&)>& func) const;
+
+private:
+    // the points in the order of the leaves and their original indices
+    std::vector<value_type> points;
+    std::vector<std::uint32_t> indices;
+    std::vector<Node> nodes;
+    std::size_t numPoints = 0;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_POINTKDTREE_H
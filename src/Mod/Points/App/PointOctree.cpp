@@ -0,0 +1,536 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+
+#include "PointOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+bool isFinite(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+
+}  // namespace
+
+PointOctree::PointOctree()
+    : PointOctree(Settings())
+{}
+
+PointOctree::PointOctree(const Settings& settings)
+    : settings(settings)
+{
+    this->settings.gridSize = std::clamp(settings.gridSize, 1U, 1024U);
+    this->settings.maxLeafSize = std::max<std::size_t>(settings.maxLeafSize, 1);
+}
+
+PointOctree::~PointOctree()
+{
+    if (pageFile.is_open()) {
+        pageFile.close();
+        Base::FileInfo(pageFileName).deleteFile();
+    }
+}
+
+std::unique_ptr<PointOctree> PointOctree::clone() const
+{
+    auto copy = std::make_unique<PointOctree>(settings);
+    copy->matrix = matrix;
+    copy->root = root;
+    copy->hasCube = hasCube;
+    copy->numPoints = numPoints;
+    copy->nodes.resize(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        const Node& node = access(static_cast<std::uint32_t>(i));
+        Node& other = copy->nodes[i];
+        other.origin = node.origin;
+        other.length = node.length;
+        other.level = node.level;
+        other.leaf = node.leaf;
+        other.children = node.children;
+        other.count = node.count;
+        other.points = node.points;
+        other.cells = node.cells;
+        other.dirty = true;
+        copy->residentPoints += other.count;
+        copy->limitMemory(NoNode);
+    }
+    return copy;
+}
+
+void PointOctree::add(const value_type& pnt)
+{
+    if (!isFinite(pnt)) {
+        return;
+    }
+    if (root == NoNode) {
+        root = 0;
+        nodes.emplace_back();
+    }
+    if (hasCube) {
+        growRoot(pnt);
+    }
+
+    insert(root, pnt);
+    numPoints++;
+    changed();
+    limitMemory(NoNode);
+}
+
+void PointOctree::add(const std::vector<value_type>& pnts)
+{
+    for (const auto& pnt : pnts) {
+        add(pnt);
+    }
+}
+
+void PointOctree::clear()
+{
+    nodes.clear();
+    root = NoNode;
+    hasCube = false;
+    numPoints = 0;
+    residentPoints = 0;
+    // the page file is reused
+    pageFileSize = 0;
+    changed();
+}
+
+void PointOctree::transform(const Base::Matrix4D& mat)
+{
+    matrix = mat * matrix;
+    changed();
+}
+
+void PointOctree::forEachChunk(
+    const std::function<void(const std::vector<value_type>&)>& func) const
+{
+    bool unity = matrix.isUnity();
+    std::vector<value_type> transformed;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].count == 0) {
+            continue;
+        }
+        const Node& node = access(static_cast<std::uint32_t>(i));
+        if (unity) {
+            func(node.points);
+        }
+        else {
+            transformed.resize(node.points.size());
+            for (std::size_t j = 0; j < node.points.size(); j++) {
+                matrix.multVec(node.points[j], transformed[j]);
+            }
+            func(transformed);
+        }
+    }
+}
+
+Base::BoundBox3d PointOctree::getBoundBox(const Base::Matrix4D& placement) const
+{
+    if (boxValid && boxPlacement == placement) {
+        return boundBox;
+    }
+
+    Base::Matrix4D mat = placement * matrix;
+    Base::BoundBox3d box;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].count == 0) {
+            continue;
+        }
+        const Node& node = access(static_cast<std::uint32_t>(i));
+        for (const auto& pnt : node.points) {
+            box.Add(mat * Base::Vector3d(pnt.x, pnt.y, pnt.z));
+        }
+    }
+
+    boxValid = true;
+    boxPlacement = placement;
+    boundBox = box;
+    return box;
+}
+
+std::vector<PointOctree::value_type> PointOctree::getLevelOfDetail(std::size_t budget) const
+{
+    std::vector<value_type> result;
+    if (root == NoNode) {
+        return result;
+    }
+
+    // breadth-first so that all parts of the cloud get the same density
+    std::deque<std::uint32_t> queue;
+    queue.push_back(root);
+    while (!queue.empty()) {
+        std::uint32_t index = queue.front();
+        queue.pop_front();
+        if (result.size() + nodes[index].count > budget) {
+            break;
+        }
+        const Node& node = access(index);
+        for (const auto& pnt : node.points) {
+            result.push_back(matrix * pnt);
+        }
+        for (std::uint32_t child : node.children) {
+            if (child != NoNode) {
+                queue.push_back(child);
+            }
+        }
+    }
+    return result;
+}
+
+Base::BoundBox3d PointOctree::getNodeBox(std::uint32_t index) const
+{
+    if (!hasCube) {
+        return getBoundBox();
+    }
+    return nodeBox(nodes[index], matrix);
+}
+
+std::vector<PointOctree::value_type> PointOctree::getNodePoints(std::uint32_t index) const
+{
+    const Node& node = access(index);
+    std::vector<value_type> result(node.points);
+    if (!matrix.isUnity()) {
+        for (auto& pnt : result) {
+            matrix.multVec(pnt, pnt);
+        }
+    }
+    return result;
+}
+
+std::size_t PointOctree::crop(const Base::BoundBox3d& box, const Base::Matrix4D& placement)
+{
+    Base::Matrix4D mat = placement * matrix;
+    std::size_t removed = 0;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].count == 0) {
+            continue;
+        }
+
+        // nodes completely inside or outside don't need to be loaded
+        Base::BoundBox3d cube = nodeBox(nodes[i], mat);
+        if (box.IsInBox(cube)) {
+            continue;
+        }
+        if (!box.Intersect(cube)) {
+            Node& node = nodes[i];
+            removed += node.count;
+            if (node.resident) {
+                residentPoints -= node.points.size();
+            }
+            node.count = 0;
+            std::vector<value_type>().swap(node.points);
+            node.cells.clear();
+            node.resident = true;
+            node.dirty = true;
+            continue;
+        }
+
+        Node& node = access(static_cast<std::uint32_t>(i));
+        auto it = std::remove_if(node.points.begin(), node.points.end(), [&](const value_type& p) {
+            return !box.IsInBox(mat * Base::Vector3d(p.x, p.y, p.z));
+        });
+        std::size_t count = std::distance(it, node.points.end());
+        if (count > 0) {
+            node.points.erase(it, node.points.end());
+            node.count = node.points.size();
+            node.dirty = true;
+            updateCells(node);
+            residentPoints -= count;
+            removed += count;
+        }
+    }
+
+    numPoints -= removed;
+    changed();
+    return removed;
+}
+
+void PointOctree::insert(std::uint32_t index, const value_type& pnt)
+{
+    for (;;) {
+        Node& node = access(index);
+        if (node.leaf) {
+            node.points.push_back(pnt);
+            node.count++;
+            node.dirty = true;
+            residentPoints++;
+            if (node.count > settings.maxLeafSize && node.level < MaxLevel) {
+                split(index);
+            }
+            return;
+        }
+
+        // keep one point per grid cell, the others go to the children
+        if (node.cells.insert(cellIndex(node, pnt)).second) {
+            node.points.push_back(pnt);
+            node.count++;
+            node.dirty = true;
+            residentPoints++;
+            return;
+        }
+        index = child(index, pnt);
+    }
+}
+
+void PointOctree::split(std::uint32_t index)
+{
+    Node& node = access(index);
+    if (!hasCube) {
+        // the root gets its cube from the first points
+        Base::BoundBox3f box;
+        for (const auto& pnt : node.points) {
+            box.Add(pnt);
+        }
+        float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+        node.origin = Base::Vector3f(box.MinX, box.MinY, box.MinZ);
+        node.length = length > 0.0F ? length * 1.001F : 1.0F;
+        hasCube = true;
+    }
+
+    std::vector<value_type> points;
+    points.swap(node.points);
+    residentPoints -= points.size();
+    node.count = 0;
+    node.leaf = false;
+    for (const auto& pnt : points) {
+        insert(index, pnt);
+    }
+}
+
+void PointOctree::growRoot(const value_type& pnt)
+{
+    for (;;) {
+        const Node& top = nodes[root];
+        Base::Vector3f max = top.origin + Base::Vector3f(top.length, top.length, top.length);
+        if (pnt.x >= top.origin.x && pnt.y >= top.origin.y && pnt.z >= top.origin.z
+            && pnt.x < max.x && pnt.y < max.y && pnt.z < max.z) {
+            return;
+        }
+
+        // double the cube towards the point, the old root becomes one of its octants
+        Node parent;
+        parent.length = 2.0F * top.length;
+        parent.origin = top.origin;
+        parent.leaf = false;
+        std::uint32_t octant = 0;
+        if (pnt.x < top.origin.x) {
+            parent.origin.x -= top.length;
+            octant |= 1;
+        }
+        if (pnt.y < top.origin.y) {
+            parent.origin.y -= top.length;
+            octant |= 2;
+        }
+        if (pnt.z < top.origin.z) {
+            parent.origin.z -= top.length;
+            octant |= 4;
+        }
+        parent.children[octant] = root;
+        parent.lastUse = ++useCounter;
+        for (auto& node : nodes) {
+            node.level++;
+        }
+        root = static_cast<std::uint32_t>(nodes.size());
+        nodes.push_back(std::move(parent));
+    }
+}
+
+std::uint32_t PointOctree::child(std::uint32_t index, const value_type& pnt)
+{
+    const Node& node = nodes[index];
+    float half = node.length / 2.0F;
+    std::uint32_t octant = 0;
+    Base::Vector3f origin = node.origin;
+    if (pnt.x >= origin.x + half) {
+        origin.x += half;
+        octant |= 1;
+    }
+    if (pnt.y >= origin.y + half) {
+        origin.y += half;
+        octant |= 2;
+    }
+    if (pnt.z >= origin.z + half) {
+        origin.z += half;
+        octant |= 4;
+    }
+
+    std::uint32_t child = node.children[octant];
+    if (child == NoNode) {
+        Node leaf;
+        leaf.origin = origin;
+        leaf.length = half;
+        leaf.level = node.level + 1;
+        child = static_cast<std::uint32_t>(nodes.size());
+        nodes[index].children[octant] = child;
+        nodes.push_back(std::move(leaf));
+    }
+    return child;
+}
+
+std::uint32_t PointOctree::cellIndex(const Node& node, const value_type& pnt) const
+{
+    auto grid = static_cast<int>(settings.gridSize);
+    auto cell = [&](float value, float origin) {
+        auto index = static_cast<int>((value - origin) / node.length * float(grid));
+        return static_cast<std::uint32_t>(std::clamp(index, 0, grid - 1));
+    };
+    std::uint32_t x = cell(pnt.x, node.origin.x);
+    std::uint32_t y = cell(pnt.y, node.origin.y);
+    std::uint32_t z = cell(pnt.z, node.origin.z);
+    return (x * settings.gridSize + y) * settings.gridSize + z;
+}
+
+void PointOctree::updateCells(Node& node) const
+{
+    node.cells.clear();
+    if (!node.leaf) {
+        for (const auto& pnt : node.points) {
+            node.cells.insert(cellIndex(node, pnt));
+        }
+    }
+}
+
+Base::BoundBox3d PointOctree::nodeBox(const Node& node, const Base::Matrix4D& mat) const
+{
+    if (!hasCube) {
+        // the unsplit root has no cube
+        double max = std::numeric_limits<double>::max();
+        return Base::BoundBox3d(-max, -max, -max, max, max, max);
+    }
+
+    Base::BoundBox3d box;
+    for (int i = 0; i < 8; i++) {
+        Base::Vector3d corner(node.origin.x, node.origin.y, node.origin.z);
+        corner.x += (i & 1) ? node.length : 0.0;
+        corner.y += (i & 2) ? node.length : 0.0;
+        corner.z += (i & 4) ? node.length : 0.0;
+        box.Add(mat * corner);
+    }
+    return box;
+}
+
+void PointOctree::changed()
+{
+    boxValid = false;
+}
+
+PointOctree::Node& PointOctree::access(std::uint32_t index) const
+{
+    Node& node = nodes[index];
+    if (!node.resident) {
+        load(node);
+        limitMemory(index);
+    }
+    node.lastUse = ++useCounter;
+    return node;
+}
+
+void PointOctree::load(Node& node) const
+{
+    node.points.resize(node.count);
+    if (node.count > 0) {
+        pageFile.seekg(static_cast<std::streamoff>(node.offset));
+        pageFile.read(reinterpret_cast<char*>(node.points.data()),
+                      static_cast<std::streamsize>(node.count * sizeof(value_type)));
+        if (!pageFile) {
+            throw Base::FileException("Cannot read from page file", pageFileName);
+        }
+    }
+    node.resident = true;
+    node.dirty = false;
+    residentPoints += node.count;
+    updateCells(node);
+}
+
+void PointOctree::pageOut(Node& node) const
+{
+    if (node.dirty && !node.points.empty()) {
+        if (!pageFile.is_open()) {
+            pageFileName = Base::FileInfo::getTempFileName("PointOctree");
+            pageFile.open(Base::FileInfo::stringToPath(pageFileName),
+                          std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!pageFile) {
+                throw Base::FileException("Cannot create page file", pageFileName);
+            }
+        }
+        // a node that has grown gets a new slot at the end of the file
+        if (node.points.size() > node.capacity) {
+            node.offset = pageFileSize;
+            node.capacity = node.points.size();
+            pageFileSize += node.capacity * sizeof(value_type);
+        }
+        pageFile.seekp(static_cast<std::streamoff>(node.offset));
+        pageFile.write(reinterpret_cast<const char*>(node.points.data()),
+                       static_cast<std::streamsize>(node.points.size() * sizeof(value_type)));
+        if (!pageFile) {
+            throw Base::FileException("Cannot write to page file", pageFileName);
+        }
+    }
+
+    residentPoints -= node.points.size();
+    std::vector<value_type>().swap(node.points);
+    std::unordered_set<std::uint32_t>().swap(node.cells);
+    node.resident = false;
+    node.dirty = false;
+}
+
+void PointOctree::limitMemory(std::uint32_t keep) const
+{
+    if (residentPoints <= settings.memoryBudget) {
+        return;
+    }
+
+    // page out the least recently used nodes until a quarter of the budget is free again
+    std::vector<std::uint32_t> resident;
+    for (std::uint32_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].resident && !nodes[i].points.empty() && i != keep) {
+            resident.push_back(i);
+        }
+    }
+    std::sort(resident.begin(), resident.end(), [this](std::uint32_t a, std::uint32_t b) {
+        return nodes[a].lastUse < nodes[b].lastUse;
+    });
+
+    std::size_t target = settings.memoryBudget / 4 * 3;
+    for (std::uint32_t index : resident) {
+        if (residentPoints <= target) {
+            break;
+        }
+        pageOut(nodes[index]);
+    }
+}
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_POINTOCTREE_H
+#define POINTS_POINTOCTREE_H
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+
+/** Out-of-core storage for point clouds that don't fit into memory
+ *
+ * The points are sorted into an octree where every inner node keeps a sample of
+ * at most one point per cell of a regular grid and passes the others on to its
+ * children. Walking the tree from the root therefore gives an evenly thinned out
+ * cloud of increasing density which is used as level of detail.
+ *
+ * Only a limited number of points is kept in memory, the points of the least
+ * recently used nodes are paged out to a temporary file. All operations work on
+ * one node at a time. Points with non-finite coordinates are skipped.
+ *
+ * The class is not thread-safe, even the const methods change the page cache.
+ */
+class PointsExport PointOctree
+{
+public:
+    using value_type = Base::Vector3f;
+    static constexpr std::uint32_t NoNode = std::numeric_limits<std::uint32_t>::max();
+
+    struct Settings
+    {
+        /// Number of grid cells along each axis of an inner node
+        unsigned int gridSize = 128;
+        /// A leaf is split as soon as it holds more points
+        std::size_t maxLeafSize = 100000;
+        /// Number of points that are kept in memory
+        std::size_t memoryBudget = 50000000;
+    };
+
+    PointOctree();
+    explicit PointOctree(const Settings& settings);
+    ~PointOctree();
+
+    PointOctree(const PointOctree&) = delete;
+    PointOctree(PointOctree&&) = delete;
+    PointOctree& operator=(const PointOctree&) = delete;
+    PointOctree& operator=(PointOctree&&) = delete;
+
+    /// Returns a deep copy that uses its own page file
+    std::unique_ptr<PointOctree> clone() const;
+
+    void add(const value_type& pnt);
+    void add(const std::vector<value_type>& pnts);
+    void clear();
+
+    /// Number of stored points
+    std::size_t size() const
+    {
+        return numPoints;
+    }
+    std::size_t countNodes() const
+    {
+        return nodes.size();
+    }
+    /// Number of points currently held in memory
+    std::size_t countResident() const
+    {
+        return residentPoints;
+    }
+    const Settings& getSettings() const
+    {
+        return settings;
+    }
+
+    /** @name Transformation
+     * The points are stored untransformed, the transformation is applied whenever
+     * points are handed out.
+     */
+    //@{
+    void transform(const Base::Matrix4D& mat);
+    const Base::Matrix4D& getTransform() const
+    {
+        return matrix;
+    }
+    //@}
+
+    /// Calls \a func with the points of every non-empty node
+    void forEachChunk(const std::function<void(const std::vector<value_type>&)>& func) const;
+    /// Bounding box of the points additionally transformed by \a placement
+    Base::BoundBox3d getBoundBox(const Base::Matrix4D& placement = Base::Matrix4D()) const;
+    /** Collects the nodes from the root downwards as long as the number of points
+     * doesn't exceed \a budget.
+     */
+    std::vector<value_type> getLevelOfDetail(std::size_t budget) const;
+    /** Removes all points that are outside of \a box after being transformed by
+     * \a placement and returns the number of removed points.
+     */
+    std::size_t crop(const Base::BoundBox3d& box,
+                     const Base::Matrix4D& placement = Base::Matrix4D());
+
+    /** @name Nodes
+     * The nodes are numbered from 0 to countNodes() - 1, e.g. to walk the tree for
+     * rendering. Every node holds an evenly spaced sample of its cube whose spacing
+     * is the edge length of the cube divided by the grid size. Missing nodes are
+     * NoNode.
+     */
+    //@{
+    std::uint32_t getRootNode() const
+    {
+        return root;
+    }
+    const std::array<std::uint32_t, 8>& getChildNodes(std::uint32_t index) const
+    {
+        return nodes[index].children;
+    }
+    /// Number of points of the node, also if they are paged out
+    std::size_t countNodePoints(std::uint32_t index) const
+    {
+        return nodes[index].count;
+    }
+    /// Transformed bounding box of the cube of the node, of the points for the unsplit root
+    Base::BoundBox3d getNodeBox(std::uint32_t index) const;
+    /// Transformed points of the node, which are paged in if needed
+    std::vector<value_type> getNodePoints(std::uint32_t index) const;
+    //@}
+
+private:
+    static constexpr unsigned int MaxLevel = 20;
+
+    struct Node
+    {
+        // the cube covered by the node
+        Base::Vector3f origin;
+        float length = 0.0F;
+        unsigned int level = 0;
+        bool leaf = true;
+        std::array<std::uint32_t, 8> children {NoNode, NoNode, NoNode, NoNode,
+                                               NoNode, NoNode, NoNode, NoNode};
+        // the number of points, also if they are paged out
+        std::size_t count = 0;
+        std::vector<value_type> points;
+        // the occupied grid cells of an inner node
+        std::unordered_set<std::uint32_t> cells;
+        bool resident = true;
+        bool dirty = false;
+        // location in the page file
+        std::uint64_t offset = 0;
+        std::size_t capacity = 0;
+        std::uint64_t lastUse = 0;
+    };
+
+    void insert(std::uint32_t index, const value_type& pnt);
+    void split(std::uint32_t index);
+    void growRoot(const value_type& pnt);
+    std::uint32_t child(std::uint32_t index, const value_type& pnt);
+    std::uint32_t cellIndex(const Node& node, const value_type& pnt) const;
+    void updateCells(Node& node) const;
+    Base::BoundBox3d nodeBox(const Node& node, const Base::Matrix4D& mat) const;
+    void changed();
+
+    /** @name Page cache */
+    //@{
+    Node& access(std::uint32_t index) const;
+    void load(Node& node) const;
+    void pageOut(Node& node) const;
+    void limitMemory(std::uint32_t keep) const;
+    //@}
+
+private:
+    Settings settings;
+    Base::Matrix4D matrix;
+    // the root is a leaf without a cube until it's split the first time
+    std::uint32_t root = NoNode;
+    bool hasCube = false;
+    std::size_t numPoints = 0;
+
+    mutable std::vector<Node> nodes;
+    mutable std::size_t residentPoints = 0;
+    mutable std::uint64_t useCounter = 0;
+    mutable std::fstream pageFile;
+    mutable std::uint64_t pageFileSize = 0;
+    mutable std::string pageFileName;
+
+    // the bounding box is only recomputed after a change
+    mutable bool boxValid = false;
+    mutable Base::Matrix4D boxPlacement;
+    mutable Base::BoundBox3d boundBox;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_POINTOCTREE_H
@@ -23,12 +23,16 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <QtConcurrentMap>
+#include <algorithm>
+#include <array>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <cmath>
 #include <iostream>
 #endif
 
+#include <Base/Exception.h>
 #include <Base/Matrix.h>
+#include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
@@ -47,13 +51,21 @@ TYPESYSTEM_SOURCE(Points::PointKernel, Data::ComplexGeoData)
 
 PointKernel::PointKernel(const PointKernel& pts)
     : _Mtrx(pts._Mtrx)
-    , _Points(pts._Points)
-{}
+    , _Paged(pts._Paged)
+{
+    if (!_Paged) {
+        _Points = pts._Points;
+    }
+}
 
 PointKernel::PointKernel(PointKernel&& pts) noexcept
     : _Mtrx(pts._Mtrx)
     , _Points(std::move(pts._Points))
-{}
+    , _Paged(std::move(pts._Paged))
+    , _PagedLoaded(pts._PagedLoaded)
+{
+    pts._PagedLoaded = false;
+}
 
 std::vector<const char*> PointKernel::getElementTypes() const
 {
@@ -83,24 +95,42 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    if (_Paged) {
+        // only the matrix of the octree is changed
+        detachPaged();
+        _Paged->transform(rclMat);
+        return;
+    }
+
+    // the blocks are distributed to the threads and each is transformed with the
+    // batch kernel of the matrix
+    const std::size_t blockSize = 4096;
     std::vector<value_type>& kernel = getBasicPoints();
+    std::vector<std::span<value_type>> blocks;
+    for (std::size_t index = 0; index < kernel.size(); index += blockSize) {
+        blocks.emplace_back(kernel.data() + index, std::min(blockSize, kernel.size() - index));
+    }
 #ifdef _MSC_VER
-    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
-    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
-    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
-    // for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
-    });
+    // Win32-only at the moment since ppl.h is a Microsoft library. Other option: openMP. But with
+    // VC2013 results in high CPU usage even after computation (busy-waits for >100ms)
+    Concurrency::parallel_for_each(blocks.begin(),
+                                   blocks.end(),
+                                   [&rclMat](std::span<value_type>& block) {
+                                       rclMat.transformPoints(block);
+                                   });
 #else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) {
-        rclMat.multVec(value, value);
+    QtConcurrent::blockingMap(blocks, [&rclMat](std::span<value_type>& block) {
+        rclMat.transformPoints(block);
     });
 #endif
 }
 
 Base::BoundBox3d PointKernel::getBoundBox() const
 {
+    if (_Paged) {
+        return _Paged->getBoundBox(_Mtrx);
+    }
+
     Base::BoundBox3d bnd;
 
 #ifdef _MSC_VER
@@ -131,7 +161,14 @@ PointKernel& PointKernel::operator=(const PointKernel& Kernel)
     if (this != &Kernel) {
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
-        this->_Points = Kernel._Points;
+        this->_Paged = Kernel._Paged;
+        this->_PagedLoaded = false;
+        if (this->_Paged) {
+            this->_Points.clear();
+        }
+        else {
+            this->_Points = Kernel._Points;
+        }
     }
 
     return *this;
@@ -143,6 +180,9 @@ PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
         this->_Points = std::move(Kernel._Points);
+        this->_Paged = std::move(Kernel._Paged);
+        this->_PagedLoaded = Kernel._PagedLoaded;
+        Kernel._PagedLoaded = false;
     }
 
     return *this;
@@ -150,11 +190,20 @@ PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
 
 unsigned int PointKernel::getMemSize() const
 {
-    return _Points.size() * sizeof(value_type);
+    if (_Paged) {
+        // only the resident points
+        return (_Paged->countResident() + _Points.capacity()) * sizeof(value_type);
+    }
+    return _Points.capacity() * sizeof(value_type);
 }
 
 PointKernel::size_type PointKernel::countValid() const
 {
+    if (_Paged) {
+        // the octree only holds valid points
+        return _Paged->size();
+    }
+
     size_type num = 0;
     for (const auto& it : *this) {
         if (!(boost::math::isnan(it.x) || boost::math::isnan(it.y) || boost::math::isnan(it.z))) {
@@ -178,11 +227,22 @@ std::vector<PointKernel::value_type> PointKernel::getValidPoints() const
     return valid;
 }
 
+namespace
+{
+// The raw format starts with a count that doesn't occur in the old format. Its header
+// fills Base::Writer::storedAlignment bytes, so the points are aligned in the archive.
+constexpr uint32_t rawMarker = 0xFFFFFFFF;
+constexpr uint32_t rawVersion = 1;
+constexpr std::size_t rawPadding = Base::Writer::storedAlignment - 16;
+}  // namespace
+
 void PointKernel::Save(Base::Writer& writer) const
 {
     if (!writer.isForceXML()) {
+        // raw points are stored uncompressed so that restoring them is a plain copy
+        bool raw = writer.getMode("RawKernel");
         writer.Stream() << writer.ind() << "<Points file=\""
-                        << writer.addFile(writer.ObjectName.c_str(), this) << "\" "
+                        << writer.addFile(writer.ObjectName.c_str(), this, raw) << "\" "
                         << "mtrx=\"" << _Mtrx.toString() << "\"/>" << std::endl;
     }
 }
@@ -190,9 +250,22 @@ void PointKernel::Save(Base::Writer& writer) const
 void PointKernel::SaveDocFile(Base::Writer& writer) const
 {
     Base::OutputStream str(writer.Stream());
+    if (writer.getMode("RawKernel")) {
+        saveRaw(str);
+        return;
+    }
+
     uint32_t uCt = (uint32_t)size();
     str << uCt;
     // store the data without transforming it
+    if (_Paged) {
+        _Paged->forEachChunk([&str](const std::vector<value_type>& points) {
+            for (const auto& pnt : points) {
+                str << pnt.x << pnt.y << pnt.z;
+            }
+        });
+        return;
+    }
     for (const auto& pnt : _Points) {
         str << pnt.x << pnt.y << pnt.z;
     }
@@ -215,11 +288,52 @@ void PointKernel::Restore(Base::XMLReader& reader)
     }
 }
 
+void PointKernel::saveRaw(Base::OutputStream& str) const
+{
+    static_assert(sizeof(value_type) == 3 * sizeof(float));
+
+    // the points are written as little endian floats in one go
+    str << rawMarker << rawVersion << static_cast<uint64_t>(size());
+    std::array<char, rawPadding> padding {};
+    str.write(padding.data(), static_cast<int>(padding.size()));
+    if (_Paged) {
+        _Paged->forEachChunk([&str](const std::vector<value_type>& points) {
+            str.writeArray(reinterpret_cast<const float*>(points.data()),  // NOLINT
+                           3 * points.size());
+        });
+        return;
+    }
+    str.writeArray(reinterpret_cast<const float*>(_Points.data()), 3 * _Points.size());  // NOLINT
+}
+
+void PointKernel::restoreRaw(Base::InputStream& str, std::istream& in)
+{
+    uint32_t version = 0;
+    uint64_t count = 0;
+    str >> version >> count;
+    if (version != rawVersion) {
+        throw Base::BadFormatError("Unsupported version of raw points");
+    }
+    std::array<char, rawPadding> padding {};
+    str.read(padding.data(), static_cast<int>(padding.size()));
+
+    std::vector<value_type> points(count);
+    str.readArray(reinterpret_cast<float*>(points.data()), 3 * points.size());  // NOLINT
+    if (!in) {
+        throw Base::BadFormatError("Reading raw points failed");
+    }
+    _Points.swap(points);
+}
+
 void PointKernel::RestoreDocFile(Base::Reader& reader)
 {
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    if (uCt == rawMarker) {
+        restoreRaw(str, reader);
+        return;
+    }
     _Points.resize(uCt);
     for (unsigned long i = 0; i < uCt; i++) {
         float x {};
@@ -244,6 +358,14 @@ void PointKernel::load(const char* file)
 void PointKernel::save(std::ostream& out) const
 {
     out << "# ASCII" << std::endl;
+    if (_Paged) {
+        _Paged->forEachChunk([&out](const std::vector<value_type>& points) {
+            for (const auto& pnt : points) {
+                out << pnt.x << " " << pnt.y << " " << pnt.z << std::endl;
+            }
+        });
+        return;
+    }
     for (const auto& pnt : _Points) {
         out << pnt.x << " " << pnt.y << " " << pnt.z << std::endl;
     }
@@ -254,6 +376,7 @@ void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
                             double /*Accuracy*/,
                             uint16_t /*flags*/) const
 {
+    loadPaged();
     unsigned long ctpoints = _Points.size();
     Points.reserve(ctpoints);
     for (unsigned long i = 0; i < ctpoints; i++) {
@@ -261,6 +384,92 @@ void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
     }
 }
 
+void PointKernel::setPaged(const PointOctree::Settings& settings)
+{
+    auto octree = std::make_shared<PointOctree>(settings);
+    if (_Paged) {
+        _Paged->forEachChunk([&octree](const std::vector<value_type>& points) {
+            octree->add(points);
+        });
+    }
+    else {
+        octree->add(_Points);
+    }
+
+    std::vector<value_type>().swap(_Points);
+    _Paged = octree;
+    _PagedLoaded = false;
+}
+
+std::vector<PointKernel::value_type> PointKernel::getLevelOfDetail(size_type budget) const
+{
+    if (_Paged) {
+        return _Paged->getLevelOfDetail(budget);
+    }
+    if (_Points.size() <= budget) {
+        return _Points;
+    }
+
+    std::vector<value_type> points;
+    if (budget > 0) {
+        size_type step = (_Points.size() + budget - 1) / budget;
+        points.reserve(budget);
+        for (size_type i = 0; i < _Points.size(); i += step) {
+            points.push_back(_Points[i]);
+        }
+    }
+    return points;
+}
+
+PointKernel::size_type PointKernel::crop(const Base::BoundBox3d& box)
+{
+    if (_Paged) {
+        detachPaged();
+        return _Paged->crop(box, _Mtrx);
+    }
+
+    auto it = std::remove_if(_Points.begin(), _Points.end(), [&](const value_type& pnt) {
+        return !box.IsInBox(_Mtrx * Base::Vector3d(pnt.x, pnt.y, pnt.z));
+    });
+    auto removed = static_cast<size_type>(std::distance(it, _Points.end()));
+    _Points.erase(it, _Points.end());
+    return removed;
+}
+
+void PointKernel::loadPaged() const
+{
+    if (_Paged && !_PagedLoaded) {
+        _Points.clear();
+        _Points.reserve(_Paged->size());
+        _Paged->forEachChunk([this](const std::vector<value_type>& points) {
+            _Points.insert(_Points.end(), points.begin(), points.end());
+        });
+        _PagedLoaded = true;
+    }
+}
+
+void PointKernel::makePlain()
+{
+    loadPaged();
+    resetPaged();
+}
+
+void PointKernel::detachPaged()
+{
+    if (_Paged.use_count() > 1) {
+        _Paged = _Paged->clone();
+    }
+    // the loaded points are outdated
+    std::vector<value_type>().swap(_Points);
+    _PagedLoaded = false;
+}
+
+void PointKernel::addPaged(const Base::Vector3d& point)
+{
+    detachPaged();
+    _Paged->add(transformPointToInside(point));
+}
+
 // ----------------------------------------------------------------------------
 
 PointKernel::const_point_iterator::const_point_iterator(
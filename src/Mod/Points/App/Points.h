@@ -25,6 +25,7 @@
 #define POINTS_POINT_H
 
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #include <App/ComplexGeoData.h>
@@ -37,6 +38,14 @@
 
 #include <Mod/Points/PointsGlobal.h>
 
+#include "PointOctree.h"
+
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
+
 namespace Points
 {
 
@@ -86,18 +95,22 @@ public:
     }
     std::vector<value_type>& getBasicPoints()
     {
+        makePlain();
         return this->_Points;
     }
     const std::vector<value_type>& getBasicPoints() const
     {
+        loadPaged();
         return this->_Points;
     }
     void setBasicPoints(const std::vector<value_type>& pts)
     {
+        resetPaged();
         this->_Points = pts;
     }
     void swap(std::vector<value_type>& pts)
     {
+        makePlain();
         this->_Points.swap(pts);
     }
 
@@ -122,33 +135,77 @@ public:
     void load(std::istream&);
     //@}
 
+    /** @name Out-of-core storage
+     * A paged kernel keeps its points in a PointOctree, so the order of the points
+     * is not preserved. Size, bounding box, transformation, cropping and saving work
+     * on the octree node by node. All other access to the points loads them into a
+     * plain array, the non-const methods also switch the kernel back to it.
+     */
+    //@{
+    /// Moves the points into a new octree
+    void setPaged(const PointOctree::Settings& settings);
+    bool isPaged() const
+    {
+        return static_cast<bool>(_Paged);
+    }
+    const PointOctree* getPagedPoints() const
+    {
+        return _Paged.get();
+    }
+    /// At most \a budget untransformed points to display the kernel
+    std::vector<value_type> getLevelOfDetail(size_type budget) const;
+    /// Removes the points outside of the box and returns the number of removed points
+    size_type crop(const Base::BoundBox3d& box);
+    //@}
+
+private:
+    void saveRaw(Base::OutputStream& str) const;
+    void restoreRaw(Base::InputStream& str, std::istream& in);
+    void loadPaged() const;
+    void makePlain();
+    void resetPaged()
+    {
+        _Paged.reset();
+        _PagedLoaded = false;
+    }
+    void detachPaged();
+    void addPaged(const Base::Vector3d& point);
+
 private:
     Base::Matrix4D _Mtrx;
-    std::vector<value_type> _Points;
+    // holds a copy of the points of a paged kernel once they have been accessed
+    mutable std::vector<value_type> _Points;
+    // copies of the kernel share the octree until one of them is modified
+    std::shared_ptr<PointOctree> _Paged;
+    mutable bool _PagedLoaded = false;
 
 public:
     /// number of points stored
     size_type size() const
     {
-        return this->_Points.size();
+        return _Paged ? _Paged->size() : this->_Points.size();
     }
     size_type countValid() const;
     std::vector<value_type> getValidPoints() const;
     void resize(size_type n)
     {
+        makePlain();
         _Points.resize(n);
     }
     void reserve(size_type n)
     {
+        makePlain();
         _Points.reserve(n);
     }
     inline void erase(size_type first, size_type last)
     {
+        makePlain();
         _Points.erase(_Points.begin() + first, _Points.begin() + last);
     }
 
     void clear()
     {
+        resetPaged();
         _Points.clear();
     }
 
@@ -156,17 +213,24 @@ public:
     /// get the points
     inline const Base::Vector3d getPoint(const int idx) const
     {
+        loadPaged();
         return transformPointToOutside(_Points[idx]);
     }
     /// set the points
     inline void setPoint(const int idx, const Base::Vector3d& point)
     {
+        makePlain();
         _Points[idx] = transformPointToInside(point);
     }
     /// insert the points
     inline void push_back(const Base::Vector3d& point)
     {
-        _Points.push_back(transformPointToInside(point));
+        if (_Paged) {
+            addPaged(point);
+        }
+        else {
+            _Points.push_back(transformPointToInside(point));
+        }
     }
 
     class PointsExport const_point_iterator
@@ -215,10 +279,12 @@ public:
     //@{
     const_point_iterator begin() const
     {
+        loadPaged();
         return {this, _Points.begin()};
     }
     const_point_iterator end() const
     {
+        loadPaged();
         return {this, _Points.end()};
     }
     const_reverse_iterator rbegin() const
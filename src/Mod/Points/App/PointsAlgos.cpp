@@ -25,8 +25,14 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
 #include <memory>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
@@ -47,7 +53,7 @@
 
 using namespace Points;
 
-void PointsAlgos::Load(PointKernel& points, const char* FileName)
+void PointsAlgos::Load(PointKernel& points, const char* FileName, std::size_t outOfCoreThreshold)
 {
     Base::FileInfo File(FileName);
 
@@ -57,14 +63,16 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
     }
 
     if (File.hasExtension("asc")) {
-        LoadAscii(points, FileName);
+        LoadAscii(points, FileName, outOfCoreThreshold);
     }
     else {
         throw Base::RuntimeError("Unknown ending");
     }
 }
 
-void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
+void PointsAlgos::LoadAscii(PointKernel& points,
+                            const char* FileName,
+                            std::size_t outOfCoreThreshold)
 {
     boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
                     "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
@@ -86,8 +94,15 @@ void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
         LineCnt++;
     }
 
-    // resize the PointKernel
-    points.resize(LineCnt);
+    // resize the PointKernel or stream the points into the octree
+    bool paged = outOfCoreThreshold > 0 && std::size_t(LineCnt) > outOfCoreThreshold;
+    if (paged) {
+        points.clear();
+        points.setPaged(PointOctree::Settings());
+    }
+    else {
+        points.resize(LineCnt);
+    }
 
     Base::SequencerLauncher seq("Loading points...", LineCnt);
 
@@ -103,7 +118,12 @@ void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
                 pt.y = std::atof(what[4].first);
                 pt.z = std::atof(what[7].first);
 
-                points.setPoint(LineCnt, pt);
+                if (paged) {
+                    points.push_back(pt);
+                }
+                else {
+                    points.setPoint(LineCnt, pt);
+                }
                 seq.next();
                 LineCnt++;
             }
@@ -117,7 +137,7 @@ void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
     // now remove the last points from the kernel
     // Note: first we allocate memory corresponding to the number of lines (points and comments)
     //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
+    if (!paged && LineCnt < (int)points.size()) {
         points.erase(LineCnt, points.size());
     }
 }
@@ -190,13 +210,23 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setOutOfCoreThreshold(std::size_t threshold)
+{
+    outOfCoreThreshold = threshold;
+}
+
+std::size_t Reader::getOutOfCoreThreshold() const
+{
+    return outOfCoreThreshold;
+}
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
 
 void AscReader::read(const std::string& filename)
 {
-    points.load(filename.c_str());
+    PointsAlgos::Load(points, filename.c_str(), outOfCoreThreshold);
     this->height = 1;
     this->width = points.size();
 }
@@ -1394,22 +1424,118 @@ void PcdReader::readBinary(bool transpose,
 
 namespace
 {
+struct E57Options
+{
+    bool useColor;
+    bool checkState;
+    double minDistance;
+    double pointSpacing;
+    std::size_t outOfCoreThreshold;
+};
+
+// A cell of the grid used to subsample the points
+struct Voxel
+{
+    int64_t x;
+    int64_t y;
+    int64_t z;
+
+    bool operator==(const Voxel& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+struct VoxelHash
+{
+    std::size_t operator()(const Voxel& v) const
+    {
+        return std::hash<int64_t>()((v.x * 73856093) ^ (v.y * 19349663) ^ (v.z * 83492791));
+    }
+};
+
 class E57ReaderImp
 {
 public:
-    E57ReaderImp(const std::string& filename, bool color, bool state, double distance)
+    E57ReaderImp(const std::string& filename, const E57Options& options)
         : imfi(filename, "r")
-        , useColor {color}
-        , checkState {state}
-        , minDistance {distance}
+        , useColor {options.useColor}
+        , checkState {options.checkState}
+        , minDistance {options.minDistance}
+        , pointSpacing {options.pointSpacing}
+        , outOfCoreThreshold {options.outOfCoreThreshold}
     {}
 
     void read()
+    {
+        if (needsPaging()) {
+            points.setPaged(PointOctree::Settings());
+        }
+        for (int index = 0; index < countScans(); ++index) {
+            readScan(index);
+        }
+    }
+
+    int countScans() const
     {
         e57::StructureNode root = imfi.root();
-        if (root.isDefined("data3D")) {
-            e57::VectorNode data3D(root.get("data3D"));
-            readData3D(data3D);
+        if (!root.isDefined("data3D")) {
+            return 0;
+        }
+        return static_cast<int>(e57::VectorNode(root.get("data3D")).childCount());
+    }
+
+    bool needsPaging() const
+    {
+        if (outOfCoreThreshold == 0) {
+            return false;
+        }
+
+        int64_t numPoints = 0;
+        e57::VectorNode data3D(imfi.root().get("data3D"));
+        for (int child = 0; child < countScans(); ++child) {
+            e57::StructureNode scan_data(data3D.get(child));
+            numPoints += e57::CompressedVectorNode(scan_data.get("points")).childCount();
+        }
+        return numPoints > static_cast<int64_t>(outOfCoreThreshold);
+    }
+
+    void readScan(int index)
+    {
+        e57::VectorNode data3D(imfi.root().get("data3D"));
+        e57::StructureNode scan_data(data3D.get(index));
+        Base::Placement plm;
+        bool hasPlacement = getPlacement(scan_data, plm);
+
+        e57::CompressedVectorNode cvn(scan_data.get("points"));
+        e57::StructureNode prototype(cvn.prototype());
+        Proto proto = readProto(prototype);
+        processProto(cvn, proto, hasPlacement, plm);
+    }
+
+    /// Appends the points of a scan that has been read separately
+    void merge(E57ReaderImp& scan)
+    {
+        const std::vector<Base::Vector3f>& pts = scan.points.getBasicPoints();
+        std::vector<Base::Vector3f>& kernel = points.getBasicPoints();
+        bool hasColor = scan.colors.size() == pts.size();
+        bool hasItensity = scan.intensity.size() == pts.size();
+        bool hasNormal = scan.normals.size() == pts.size();
+        for (std::size_t i = 0; i < pts.size(); ++i) {
+            // the scans are subsampled independently
+            if (pointSpacing > 0.0 && !addVoxel(Base::convertTo<Base::Vector3d>(pts[i]))) {
+                continue;
+            }
+            kernel.push_back(pts[i]);
+            if (hasColor) {
+                colors.push_back(scan.colors[i]);
+            }
+            if (hasItensity) {
+                intensity.push_back(scan.intensity[i]);
+            }
+            if (hasNormal) {
+                normals.push_back(scan.normals[i]);
+            }
         }
     }
 
@@ -1434,20 +1560,6 @@ public:
     }
 
 private:
-    void readData3D(const e57::VectorNode& data3D)
-    {
-        for (int child = 0; child < data3D.childCount(); ++child) {
-            e57::StructureNode scan_data(data3D.get(child));
-            Base::Placement plm;
-            bool hasPlacement = getPlacement(scan_data, plm);
-
-            e57::CompressedVectorNode cvn(scan_data.get("points"));
-            e57::StructureNode prototype(cvn.prototype());
-            Proto proto = readProto(prototype);
-            processProto(cvn, proto, hasPlacement, plm);
-        }
-    }
-
     struct Proto
     {
         bool inty = false;
@@ -1628,7 +1740,7 @@ private:
     }
 
     void processProto(e57::CompressedVectorNode& cvn,
-                      const Proto& proto,
+                      Proto& proto,
                       bool hasPlacement,
                       const Base::Placement& plm)
     {
@@ -1638,14 +1750,21 @@ private:
         unsigned count;
         unsigned cnt_pts = 0;
         Base::Vector3d pt, last;
+        Base::Matrix4D mat = plm.toMatrix();
         e57::CompressedVectorReader cvr(cvn.reader(proto.sdb));
-        bool hasColor = (proto.cnt_rgb == 3) && useColor;
-        bool hasItensity = proto.inty;
-        bool hasNormal = (proto.cnt_nor == 3);
+        // the octree doesn't keep the order of the points, so the properties would be
+        // assigned to the wrong points
+        bool properties = !points.isPaged();
+        bool hasColor = (proto.cnt_rgb == 3) && useColor && properties;
+        bool hasItensity = proto.inty && properties;
+        bool hasNormal = (proto.cnt_nor == 3) && properties;
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
 
         while ((count = cvr.read())) {
+            if (hasPlacement) {
+                transformBlock(proto, count, mat, hasNormal);
+            }
             for (size_t i = 0; i < count; ++i) {
                 filter = false;
                 if (hasState) {
@@ -1654,13 +1773,16 @@ private:
                     }
                 }
 
-                pt = getCoord(proto, i, hasPlacement, plm);
+                pt = getCoord(proto, i);
 
                 if ((!filter) && (cnt_pts > 0)) {
                     if (Base::Distance(last, pt) < minDistance) {
                         filter = true;
                     }
                 }
+                if ((!filter) && (pointSpacing > 0.0)) {
+                    filter = !addVoxel(pt);
+                }
                 if (!filter) {
                     cnt_pts++;
                     points.push_back(pt);
@@ -1672,39 +1794,77 @@ private:
                         intensity.push_back(proto.intensity[i]);
                     }
                     if (hasNormal) {
-                        normals.push_back(getNormal(proto, i, hasPlacement, plm.getRotation()));
+                        normals.push_back(getNormal(proto, i));
                     }
                 }
             }
         }
     }
 
-    Base::Vector3d
-    getCoord(const Proto& proto, size_t index, bool hasPlacement, const Base::Placement& plm) const
+    // Applies the pose of the scan to a whole block. Working on the separate
+    // coordinate arrays lets the compiler vectorize the loops.
+    static void
+    transformBlock(Proto& proto, std::size_t count, const Base::Matrix4D& mat, bool normals)
+    {
+        double* xs = proto.xData.data();
+        double* ys = proto.yData.data();
+        double* zs = proto.zData.data();
+        const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+        const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+        const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+        for (std::size_t i = 0; i < count; ++i) {
+            double x = xs[i];
+            double y = ys[i];
+            double z = zs[i];
+            xs[i] = m00 * x + m01 * y + m02 * z + m03;
+            ys[i] = m10 * x + m11 * y + m12 * z + m13;
+            zs[i] = m20 * x + m21 * y + m22 * z + m23;
+        }
+
+        if (normals) {
+            // rotation only
+            xs = proto.xNormal.data();
+            ys = proto.yNormal.data();
+            zs = proto.zNormal.data();
+            for (std::size_t i = 0; i < count; ++i) {
+                double x = xs[i];
+                double y = ys[i];
+                double z = zs[i];
+                xs[i] = m00 * x + m01 * y + m02 * z;
+                ys[i] = m10 * x + m11 * y + m12 * z;
+                zs[i] = m20 * x + m21 * y + m22 * z;
+            }
+        }
+    }
+
+    Base::Vector3d getCoord(const Proto& proto, size_t index) const
     {
         Base::Vector3d pt;
         pt.x = proto.xData[index];
         pt.y = proto.yData[index];
         pt.z = proto.zData[index];
-        if (hasPlacement) {
-            plm.multVec(pt, pt);
-        }
         return pt;
     }
 
-    Base::Vector3f
-    getNormal(const Proto& proto, size_t index, bool hasPlacement, const Base::Rotation& rot) const
+    Base::Vector3f getNormal(const Proto& proto, size_t index) const
     {
         Base::Vector3f pt;
-        pt.x = proto.xNormal[index];
-        pt.y = proto.yNormal[index];
-        pt.z = proto.zNormal[index];
-        if (hasPlacement) {
-            rot.multVec(pt, pt);
-        }
+        pt.x = static_cast<float>(proto.xNormal[index]);
+        pt.y = static_cast<float>(proto.yNormal[index]);
+        pt.z = static_cast<float>(proto.zNormal[index]);
         return pt;
     }
 
+    // Keeps at most one point per cube with the edge length of the point spacing.
+    // Returns false if the cube of the point is already occupied.
+    bool addVoxel(const Base::Vector3d& pt)
+    {
+        Voxel v {static_cast<int64_t>(std::floor(pt.x / pointSpacing)),
+                 static_cast<int64_t>(std::floor(pt.y / pointSpacing)),
+                 static_cast<int64_t>(std::floor(pt.z / pointSpacing))};
+        return voxels.insert(v).second;
+    }
+
     Base::Color getColor(const Proto& proto, size_t index) const
     {
         Base::Color c;
@@ -1768,12 +1928,49 @@ private:
     bool useColor;
     bool checkState;
     double minDistance;
+    double pointSpacing;
+    std::size_t outOfCoreThreshold;
     const size_t buf_size = 1024;
+    std::unordered_set<Voxel, VoxelHash> voxels;
     std::vector<Base::Color> colors;
     std::vector<float> intensity;
     PointKernel points;
     std::vector<Base::Vector3f> normals;
 };
+
+// libE57Format isn't thread-safe for a single image file, so every scan is read from
+// its own instance of the file. The scans are merged in their original order.
+void readParallel(const std::string& filename,
+                  const E57Options& options,
+                  int numScans,
+                  unsigned int numThreads,
+                  E57ReaderImp& result)
+{
+    std::vector<std::unique_ptr<E57ReaderImp>> scans(numScans);
+    std::atomic<int> next {0};
+    auto worker = [&]() {
+        int index {};
+        while ((index = next++) < numScans) {
+            auto scan = std::make_unique<E57ReaderImp>(filename, options);
+            scan->readScan(index);
+            scans[index] = std::move(scan);
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (unsigned int i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    for (auto& scan : scans) {
+        result.merge(*scan);
+        scan.reset();
+    }
+}
 }  // namespace
 
 E57Reader::E57Reader(bool Color, bool State, double Distance)
@@ -1782,11 +1979,26 @@ E57Reader::E57Reader(bool Color, bool State, double Distance)
     , minDistance {Distance}
 {}
 
+void E57Reader::setPointSpacing(double spacing)
+{
+    pointSpacing = spacing;
+}
+
 void E57Reader::read(const std::string& filename)
 {
     try {
-        E57ReaderImp reader(filename, useColor, checkState, minDistance);
-        reader.read();
+        E57Options options {useColor, checkState, minDistance, pointSpacing, outOfCoreThreshold};
+        E57ReaderImp reader(filename, options);
+        int numScans = reader.countScans();
+        unsigned int numThreads =
+            std::min<unsigned int>(numScans, std::max(1U, std::thread::hardware_concurrency()));
+        // an out-of-core cloud is streamed into the octree scan by scan
+        if (numThreads > 1 && !reader.needsPaging()) {
+            readParallel(filename, options, numScans, numThreads, reader);
+        }
+        else {
+            reader.read();
+        }
         points = reader.getPoints();
         normals = reader.getNormals();
         colors = reader.getColors();
@@ -38,11 +38,13 @@ class PointsExport PointsAlgos
 {
 public:
     /** Load a point cloud
+     * If the file has more than \a outOfCoreThreshold points they are streamed into a
+     * paged kernel, 0 disables it.
      */
-    static void Load(PointKernel&, const char* FileName);
+    static void Load(PointKernel&, const char* FileName, std::size_t outOfCoreThreshold = 0);
     /** Load a point cloud
      */
-    static void LoadAscii(PointKernel&, const char* FileName);
+    static void LoadAscii(PointKernel&, const char* FileName, std::size_t outOfCoreThreshold = 0);
 };
 
 class PointsExport Reader
@@ -64,6 +66,12 @@ public:
     bool isStructured() const;
     int getWidth() const;
     int getHeight() const;
+    /** Files with more than \a threshold points are streamed into a paged kernel,
+     * 0 disables it. Only the ASCII and E57 readers support it, the per-point
+     * properties of a paged kernel are dropped.
+     */
+    void setOutOfCoreThreshold(std::size_t threshold);
+    std::size_t getOutOfCoreThreshold() const;
 
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
@@ -78,6 +86,7 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    std::size_t outOfCoreThreshold {0};
     // NOLINTEND
 };
 
@@ -134,11 +143,14 @@ class PointsExport E57Reader: public Reader
 {
 public:
     E57Reader(bool Color, bool State, double Distance);
+    /// Keeps at most one point per cube with the edge length \a spacing, 0 keeps all
+    void setPointSpacing(double spacing);
     void read(const std::string& filename) override;
 
 protected:
     bool useColor, checkState;
     double minDistance;
+    double pointSpacing {0.0};
 };
 
 class PointsExport Writer
@@ -0,0 +1,381 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <thread>
+#endif
+
+#include <Base/Exception.h>
+
+#include "Points.h"
+#include "PointsFilter.h"
+
+
+using namespace Points;
+
+namespace
+{
+// the points a thread takes at a time
+constexpr std::size_t batchSize = 65536;
+
+bool isFinite(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+
+float distance2(const Base::Vector3f& a, const Base::Vector3f& b)
+{
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    float dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+std::uint64_t mix(std::uint64_t value)
+{
+    // splitmix64
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+unsigned int countThreads()
+{
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+}  // namespace
+
+std::size_t PointsFilter::CellHash::operator()(const Cell& cell) const
+{
+    auto x = std::uint64_t(std::uint32_t(cell.x));
+    auto y = std::uint64_t(std::uint32_t(cell.y));
+    auto z = std::uint64_t(std::uint32_t(cell.z));
+    return static_cast<std::size_t>(mix((x << 32 | y) ^ mix(z)));
+}
+
+PointsFilter::Cell PointsFilter::cellOf(const value_type& pnt, double size)
+{
+    constexpr double limit = double(std::numeric_limits<std::int32_t>::max());
+    double x = std::floor(double(pnt.x) / size);
+    double y = std::floor(double(pnt.y) / size);
+    double z = std::floor(double(pnt.z) / size);
+    if (std::fabs(x) >= limit || std::fabs(y) >= limit || std::fabs(z) >= limit) {
+        throw Base::ValueError("The cell size is too small for the extent of the points");
+    }
+    return Cell {std::int32_t(x), std::int32_t(y), std::int32_t(z)};
+}
+
+void PointsFilter::parallelFor(std::size_t count,
+                               std::size_t grain,
+                               const std::function<void(std::size_t, std::size_t)>& func)
+{
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        std::size_t begin {};
+        while ((begin = next.fetch_add(grain)) < count) {
+            func(begin, std::min(count, begin + grain));
+        }
+    };
+
+    auto numThreads = static_cast<unsigned int>(
+        std::min<std::size_t>(countThreads(), (count + grain - 1) / grain));
+    std::vector<std::future<void>> futures;
+    for (unsigned int i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void PointsFilter::addChunk(const std::vector<value_type>& points)
+{
+    filter(points, numInput);
+    numInput += points.size();
+}
+
+void PointsFilter::addKernel(const PointKernel& kernel)
+{
+    if (const PointOctree* octree = kernel.getPagedPoints()) {
+        octree->forEachChunk([this](const std::vector<value_type>& points) {
+            addChunk(points);
+        });
+    }
+    else {
+        addChunk(kernel.getBasicPoints());
+    }
+}
+
+std::vector<std::pair<std::size_t, PointsFilter::value_type>> PointsFilter::getResult() const
+{
+    std::vector<std::pair<std::size_t, value_type>> result;
+    collect(result);
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    return result;
+}
+
+std::vector<std::size_t> PointsFilter::getIndices() const
+{
+    std::vector<std::pair<std::size_t, value_type>> result = getResult();
+    std::vector<std::size_t> indices;
+    indices.reserve(result.size());
+    for (const auto& it : result) {
+        indices.push_back(it.first);
+    }
+    return indices;
+}
+
+PointKernel PointsFilter::apply(const PointKernel& kernel)
+{
+    addKernel(kernel);
+    std::vector<std::pair<std::size_t, value_type>> result = getResult();
+    std::vector<value_type> points;
+    points.reserve(result.size());
+    for (const auto& it : result) {
+        points.push_back(it.second);
+    }
+
+    PointKernel output;
+    output.swap(points);
+    output.setTransform(kernel.getTransform());
+    return output;
+}
+
+// ----------------------------------------------------------------------------
+
+VoxelGridFilter::VoxelGridFilter(double size)
+    : size(size)
+    , voxels(countThreads())
+{
+    if (!(size > 0.0)) {
+        throw Base::ValueError("The voxel size must be positive");
+    }
+}
+
+void VoxelGridFilter::filter(const std::vector<value_type>& points, std::size_t offset)
+{
+    constexpr std::uint32_t invalid = std::numeric_limits<std::uint32_t>::max();
+    auto numParts = static_cast<std::uint32_t>(voxels.size());
+    std::vector<Cell> keys(points.size());
+    std::vector<std::uint32_t> owners(points.size(), invalid);
+    parallelFor(points.size(), batchSize, [&](std::size_t begin, std::size_t end) {
+        CellHash hash;
+        for (std::size_t i = begin; i < end; i++) {
+            if (isFinite(points[i])) {
+                keys[i] = cellOf(points[i], size);
+                owners[i] = static_cast<std::uint32_t>(hash(keys[i]) % numParts);
+            }
+        }
+    });
+
+    // every thread only updates the voxels it owns
+    parallelFor(numParts, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t part = begin; part < end; part++) {
+            auto& map = voxels[part];
+            for (std::size_t i = 0; i < points.size(); i++) {
+                if (owners[i] != part) {
+                    continue;
+                }
+                const Cell& key = keys[i];
+                value_type center(float((key.x + 0.5) * size),
+                                  float((key.y + 0.5) * size),
+                                  float((key.z + 0.5) * size));
+                float dist = distance2(points[i], center);
+                auto [it, inserted] = map.try_emplace(key, Voxel {offset + i, points[i], dist});
+                if (!inserted && dist < it->second.distance) {
+                    it->second = Voxel {offset + i, points[i], dist};
+                }
+            }
+        }
+    });
+}
+
+void VoxelGridFilter::collect(std::vector<std::pair<std::size_t, value_type>>& result) const
+{
+    for (const auto& map : voxels) {
+        for (const auto& it : map) {
+            result.emplace_back(it.second.index, it.second.point);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+RandomFilter::RandomFilter(double ratio, std::uint32_t seed)
+    : seed(seed)
+{
+    if (!(ratio >= 0.0 && ratio <= 1.0)) {
+        throw Base::ValueError("The ratio must be in the range [0, 1]");
+    }
+    threshold = ratio >= 1.0 ? std::numeric_limits<std::uint64_t>::max()
+                             : static_cast<std::uint64_t>(ratio * 18446744073709551616.0);
+}
+
+void RandomFilter::filter(const std::vector<value_type>& points, std::size_t offset)
+{
+    std::vector<std::vector<std::pair<std::size_t, value_type>>> parts(
+        (points.size() + batchSize - 1) / batchSize);
+    std::uint64_t salt = mix(seed);
+    parallelFor(points.size(), batchSize, [&](std::size_t begin, std::size_t end) {
+        auto& part = parts[begin / batchSize];
+        for (std::size_t i = begin; i < end; i++) {
+            if (isFinite(points[i]) && mix(salt ^ (offset + i)) < threshold) {
+                part.emplace_back(offset + i, points[i]);
+            }
+        }
+    });
+    for (const auto& part : parts) {
+        kept.insert(kept.end(), part.begin(), part.end());
+    }
+}
+
+void RandomFilter::collect(std::vector<std::pair<std::size_t, value_type>>& result) const
+{
+    result.insert(result.end(), kept.begin(), kept.end());
+}
+
+// ----------------------------------------------------------------------------
+
+PoissonDiskFilter::PoissonDiskFilter(double radius)
+    : radius(radius)
+{
+    if (!(radius > 0.0)) {
+        throw Base::ValueError("The radius must be positive");
+    }
+}
+
+void PoissonDiskFilter::filter(const std::vector<value_type>& points, std::size_t offset)
+{
+    using Entries = std::vector<std::pair<std::size_t, value_type>>;
+
+    // sort the points by their cells, within a cell they keep their order
+    std::vector<Cell> keys(points.size());
+    std::vector<char> valid(points.size(), 0);
+    parallelFor(points.size(), batchSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            if (isFinite(points[i])) {
+                keys[i] = cellOf(points[i], radius);
+                valid[i] = 1;
+            }
+        }
+    });
+    std::vector<std::size_t> order;
+    order.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (valid[i]) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&keys](std::size_t a, std::size_t b) {
+        const Cell& ca = keys[a];
+        const Cell& cb = keys[b];
+        if (ca.x != cb.x) {
+            return ca.x < cb.x;
+        }
+        if (ca.y != cb.y) {
+            return ca.y < cb.y;
+        }
+        if (ca.z != cb.z) {
+            return ca.z < cb.z;
+        }
+        return a < b;
+    });
+
+    // the cells are created beforehand, so the map isn't modified by the threads
+    struct Range
+    {
+        std::size_t begin;
+        std::size_t end;
+        Entries* entries;
+        std::vector<const Entries*> neighbours;
+    };
+    std::array<std::vector<Range>, 8> phases;
+    for (std::size_t begin = 0; begin < order.size();) {
+        const Cell& key = keys[order[begin]];
+        std::size_t end = begin + 1;
+        while (end < order.size() && keys[order[end]] == key) {
+            end++;
+        }
+        std::size_t phase = (key.x & 1) | (key.y & 1) << 1 | (key.z & 1) << 2;
+        phases[phase].push_back(Range {begin, end, &cells[key], {}});
+        begin = end;
+    }
+
+    auto r2 = float(radius * radius);
+    auto isFree = [r2](const Range& range, const value_type& pnt) {
+        for (const Entries* entries : range.neighbours) {
+            for (const auto& entry : *entries) {
+                if (distance2(entry.second, pnt) < r2) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    for (auto& ranges : phases) {
+        parallelFor(ranges.size(), 16, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                Range& range = ranges[i];
+                const Cell& key = keys[order[range.begin]];
+                for (int dx = -1; dx <= 1; dx++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        for (int dz = -1; dz <= 1; dz++) {
+                            auto it = cells.find(Cell {key.x + dx, key.y + dy, key.z + dz});
+                            if (it != cells.end()) {
+                                range.neighbours.push_back(&it->second);
+                            }
+                        }
+                    }
+                }
+
+                // the own cell is among the neighbours, the others aren't modified
+                // in the same round
+                for (std::size_t j = range.begin; j < range.end; j++) {
+                    const value_type& pnt = points[order[j]];
+                    if (isFree(range, pnt)) {
+                        range.entries->emplace_back(offset + order[j], pnt);
+                    }
+                }
+                std::vector<const Entries*>().swap(range.neighbours);
+            }
+        });
+    }
+}
+
+void PoissonDiskFilter::collect(std::vector<std::pair<std::size_t, value_type>>& result) const
+{
+    for (const auto& it : cells) {
+        result.insert(result.end(), it.second.begin(), it.second.end());
+    }
+}
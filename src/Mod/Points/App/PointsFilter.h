@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_POINTSFILTER_H
+#define POINTS_POINTSFILTER_H
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+class PointKernel;
+
+/** Base class of the downsampling filters
+ *
+ * The points are passed in chunks, e.g. the nodes of a paged kernel, and the
+ * indices of the points continue from one chunk to the next. A filter only holds
+ * the points it keeps, so it needs memory in proportion to its result. The chunks
+ * are processed by all hardware threads, the result doesn't depend on their number.
+ *
+ * The kept points are identified by their indices, so that the same selection can
+ * be applied to the normals, colours or intensities of the points.
+ */
+class PointsExport PointsFilter
+{
+public:
+    using value_type = Base::Vector3f;
+
+    PointsFilter() = default;
+    virtual ~PointsFilter() = default;
+
+    PointsFilter(const PointsFilter&) = delete;
+    PointsFilter(PointsFilter&&) = delete;
+    PointsFilter& operator=(const PointsFilter&) = delete;
+    PointsFilter& operator=(PointsFilter&&) = delete;
+
+    /// Filters the next chunk of points, points with non-finite coordinates are dropped
+    void addChunk(const std::vector<value_type>& points);
+    /// Filters the untransformed points of \a kernel, those of a paged kernel node by node
+    void addKernel(const PointKernel& kernel);
+    /// The number of points passed so far
+    std::size_t countInput() const
+    {
+        return numInput;
+    }
+    /// The indices of the kept points in increasing order together with the points
+    std::vector<std::pair<std::size_t, value_type>> getResult() const;
+    std::vector<std::size_t> getIndices() const;
+
+    /// Filters \a kernel and returns a kernel with the kept points and its transformation
+    PointKernel apply(const PointKernel& kernel);
+
+protected:
+    /// \a offset is the index of the first point of the chunk
+    virtual void filter(const std::vector<value_type>& points, std::size_t offset) = 0;
+    /// Appends the kept points in any order
+    virtual void collect(std::vector<std::pair<std::size_t, value_type>>& result) const = 0;
+
+    struct Cell
+    {
+        std::int32_t x = 0;
+        std::int32_t y = 0;
+        std::int32_t z = 0;
+
+        bool operator==(const Cell& other) const
+        {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+    struct CellHash
+    {
+        std::size_t operator()(const Cell& cell) const;
+    };
+    /// The cell of an infinite grid of cubes with edge length \a size
+    static Cell cellOf(const value_type& pnt, double size);
+    /// Calls \a func(begin, end) for consecutive ranges of [0, count) from all threads
+    static void parallelFor(std::size_t count,
+                            std::size_t grain,
+                            const std::function<void(std::size_t, std::size_t)>& func);
+
+private:
+    std::size_t numInput = 0;
+};
+
+/** Keeps one point per cube of a regular grid, the one closest to the center of its cube.
+ */
+class PointsExport VoxelGridFilter: public PointsFilter
+{
+public:
+    explicit VoxelGridFilter(double size);
+
+protected:
+    void filter(const std::vector<value_type>& points, std::size_t offset) override;
+    void collect(std::vector<std::pair<std::size_t, value_type>>& result) const override;
+
+private:
+    struct Voxel
+    {
+        std::size_t index = 0;
+        value_type point;
+        float distance = 0.0F;
+    };
+
+    double size;
+    // the voxels are distributed over the threads by their hash value
+    std::vector<std::unordered_map<Cell, Voxel, CellHash>> voxels;
+};
+
+/** Keeps every point with the probability \a ratio. Whether a point is kept only
+ * depends on its index and the seed, so the selection is reproducible.
+ */
+class PointsExport RandomFilter: public PointsFilter
+{
+public:
+    explicit RandomFilter(double ratio, std::uint32_t seed = 0);
+
+protected:
+    void filter(const std::vector<value_type>& points, std::size_t offset) override;
+    void collect(std::vector<std::pair<std::size_t, value_type>>& result) const override;
+
+private:
+    std::uint64_t threshold;
+    std::uint32_t seed;
+    std::vector<std::pair<std::size_t, value_type>> kept;
+};
+
+/** Keeps the points that are at least \a radius away from all points kept before,
+ * which gives a Poisson-disk sample in the order of the points.
+ *
+ * The points are sorted into a grid with cells of the edge length \a radius, so
+ * only the adjacent cells have to be checked. The cells are processed in eight
+ * rounds by the parity of their coordinates, in each round no two cells of different
+ * threads are adjacent.
+ */
+class PointsExport PoissonDiskFilter: public PointsFilter
+{
+public:
+    explicit PoissonDiskFilter(double radius);
+
+protected:
+    void filter(const std::vector<value_type>& points, std::size_t offset) override;
+    void collect(std::vector<std::pair<std::size_t, value_type>>& result) const override;
+
+private:
+    double radius;
+    std::unordered_map<Cell, std::vector<std::pair<std::size_t, value_type>>, CellHash> cells;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_POINTSFILTER_H
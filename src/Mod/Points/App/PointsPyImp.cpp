@@ -28,9 +28,12 @@
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyBufferTools.h>
 #include <Base/VectorPy.h>
 
+#include "PointKDTree.h"
 #include "Points.h"
+#include "PointsFilter.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -159,6 +162,21 @@ PyObject* PointsPy::addPoints(PyObject* args)
         return nullptr;
     }
 
+    if (PyObject_CheckBuffer(obj)) {
+        PointKernel* kernel = getPointKernelPtr();
+        Base::Vector3d pnt;
+        bool ok = Base::forEachBufferValue(obj, 3, [&](Py_ssize_t index, auto value) {
+            pnt[static_cast<unsigned short>(index % 3)] = double(value);
+            if (index % 3 == 2) {
+                kernel->push_back(pnt);
+            }
+        });
+        if (!ok) {
+            return nullptr;
+        }
+        Py_Return;
+    }
+
     try {
         Py::Sequence list(obj);
         Py::Type vType(Base::getTypeAsObject(&Base::VectorPy::Type));
@@ -189,6 +207,72 @@ PyObject* PointsPy::addPoints(PyObject* args)
     Py_Return;
 }
 
+namespace
+{
+PyObject* filterIndices(const PointKernel* kernel, PointsFilter& filter)
+{
+    std::vector<std::size_t> indices;
+    PY_TRY
+    {
+        filter.addKernel(*kernel);
+        indices = filter.getIndices();
+    }
+    PY_CATCH;
+
+    Py::Tuple tuple(indices.size());
+    for (std::size_t i = 0; i < indices.size(); i++) {
+        tuple.setItem(i, Py::Long(static_cast<unsigned long>(indices[i])));
+    }
+    return Py::new_reference_to(tuple);
+}
+}  // namespace
+
+PyObject* PointsPy::filterVoxelGrid(PyObject* args) const
+{
+    double size {};
+    if (!PyArg_ParseTuple(args, "d", &size)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        VoxelGridFilter filter(size);
+        return filterIndices(getPointKernelPtr(), filter);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::filterRandom(PyObject* args) const
+{
+    double ratio {};
+    unsigned int seed = 0;
+    if (!PyArg_ParseTuple(args, "d|I", &ratio, &seed)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        RandomFilter filter(ratio, seed);
+        return filterIndices(getPointKernelPtr(), filter);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::filterPoissonDisk(PyObject* args) const
+{
+    double radius {};
+    if (!PyArg_ParseTuple(args, "d", &radius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        PoissonDiskFilter filter(radius);
+        return filterIndices(getPointKernelPtr(), filter);
+    }
+    PY_CATCH;
+}
+
 PyObject* PointsPy::fromSegment(PyObject* args) const
 {
     PyObject* obj {};
@@ -247,6 +331,58 @@ Py::Long PointsPy::getCountPoints() const
     return Py::Long((long)getPointKernelPtr()->size());
 }
 
+PyObject* PointsPy::getPointArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const PointKernel* points = getPointKernelPtr();
+    float* data = nullptr;
+    PyObject* array = Base::newArrayView(Py_ssize_t(points->size()), 3, data);
+    if (!array) {
+        return nullptr;
+    }
+    for (const auto& point : *points) {
+        *data++ = float(point.x);  // NOLINT
+        *data++ = float(point.y);  // NOLINT
+        *data++ = float(point.z);  // NOLINT
+    }
+    return array;
+}
+
+PyObject* PointsPy::estimateNormals(PyObject* args) const
+{
+    int ksearch = 10;
+    if (!PyArg_ParseTuple(args, "|i", &ksearch)) {
+        return nullptr;
+    }
+    if (ksearch < 3) {
+        PyErr_SetString(PyExc_ValueError, "KSearch must be at least 3");
+        return nullptr;
+    }
+
+    std::vector<Base::Vector3f> normals;
+    PY_TRY
+    {
+        Points::PointKDTree tree(getPointKernelPtr()->getBasicPoints());
+        normals = tree.estimateNormals(std::size_t(ksearch));
+    }
+    PY_CATCH;
+
+    float* data = nullptr;
+    PyObject* array = Base::newArrayView(Py_ssize_t(normals.size()), 3, data);
+    if (!array) {
+        return nullptr;
+    }
+    for (const auto& normal : normals) {
+        *data++ = normal.x;  // NOLINT
+        *data++ = normal.y;  // NOLINT
+        *data++ = normal.z;  // NOLINT
+    }
+    return array;
+}
+
 Py::List PointsPy::getPoints() const
 {
     Py::List PointList;
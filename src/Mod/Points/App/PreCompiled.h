@@ -39,11 +39,16 @@
 
 // STL
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 // boost
@@ -31,6 +31,7 @@
 #include <Base/Converter.h>
 #include <Base/Matrix.h>
 #include <Base/Persistence.h>
+#include <Base/PyBufferTools.h>
 #include <Base/Stream.h>
 #include <Base/VectorPy.h>
 #include <Base/Writer.h>
@@ -254,6 +255,13 @@ void PropertyNormalList::setValues(const std::vector<Base::Vector3f>& values)
     hasSetValue();
 }
 
+void PropertyNormalList::setValues(std::vector<Base::Vector3f>&& values)
+{
+    aboutToSetValue();
+    _lValueList = std::move(values);
+    hasSetValue();
+}
+
 PyObject* PropertyNormalList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
@@ -291,6 +299,21 @@ void PropertyNormalList::setPyObject(PyObject* value)
         val.setPyObject(value);
         setValue(Base::convertTo<Base::Vector3f>(val.getValue()));
     }
+    else if (PyObject_CheckBuffer(value)) {
+        // e.g. a NumPy array of N x 3 values
+        std::vector<Base::Vector3f> values;
+        Base::Vector3f normal;
+        bool ok = Base::forEachBufferValue(value, 3, [&](Py_ssize_t index, auto val) {
+            normal[static_cast<unsigned short>(index % 3)] = float(val);
+            if (index % 3 == 2) {
+                values.push_back(normal);
+            }
+        });
+        if (!ok) {
+            throw Py::Exception();
+        }
+        setValues(std::move(values));
+    }
     else {
         std::string error = std::string("type must be 'Vector' or list of 'Vector', not ");
         error += value->ob_type->tp_name;
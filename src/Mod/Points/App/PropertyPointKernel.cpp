@@ -29,6 +29,7 @@
 #endif
 
 #include <Base/Matrix.h>
+#include <Base/Reader.h>
 #include <Base/Writer.h>
 
 #include "PointsPy.h"
@@ -45,6 +46,7 @@ PropertyPointKernel::PropertyPointKernel()
 
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
+    deferredFile.reset();
     aboutToSetValue();
     *_cPoints = m;
     hasSetValue();
@@ -52,31 +54,37 @@ void PropertyPointKernel::setValue(const PointKernel& m)
 
 const PointKernel& PropertyPointKernel::getValue() const
 {
+    restoreDeferred();
     return *_cPoints;
 }
 
 const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 {
+    restoreDeferred();
     return _cPoints;
 }
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    restoreDeferred();
     _cPoints->setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPointKernel::getTransform() const
 {
+    restoreDeferred();
     return _cPoints->getTransform();
 }
 
 Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _cPoints->getBoundBox();
 }
 
 PyObject* PropertyPointKernel::getPyObject()
 {
+    restoreDeferred();
     PointsPy* points = new PointsPy(&*_cPoints);
     points->setConst();  // set immutable
     return points;
@@ -97,6 +105,7 @@ void PropertyPointKernel::setPyObject(PyObject* value)
 
 void PropertyPointKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     _cPoints->Save(writer);
 }
 
@@ -133,8 +142,23 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyPointKernel::deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file)
+{
+    deferredFile.set(file);
+    return true;
+}
+
+void PropertyPointKernel::restoreDeferred() const
+{
+    // The points belong to the restored document, so they are loaded without notifying the owner
+    deferredFile.restore([this](Base::Reader& reader) {
+        _cPoints->RestoreDocFile(reader);
+    });
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
+    restoreDeferred();
     PropertyPointKernel* prop = new PropertyPointKernel();
     (*prop->_cPoints) = (*this->_cPoints);
     return prop;
@@ -142,19 +166,22 @@ App::Property* PropertyPointKernel::Copy() const
 
 void PropertyPointKernel::Paste(const App::Property& from)
 {
-    aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
+    prop.restoreDeferred();
+    deferredFile.reset();
+    aboutToSetValue();
     *(this->_cPoints) = *(prop._cPoints);
     hasSetValue();
 }
 
 unsigned int PropertyPointKernel::getMemSize() const
 {
-    return sizeof(Base::Vector3f) * this->_cPoints->size();
+    return _cPoints->getMemSize() + deferredFile.getSize();
 }
 
 PointKernel* PropertyPointKernel::startEditing()
 {
+    restoreDeferred();
     aboutToSetValue();
     return static_cast<PointKernel*>(_cPoints);
 }
@@ -166,6 +193,7 @@ void PropertyPointKernel::finishEditing()
 
 void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndices)
 {
+    restoreDeferred();
     // We need a sorted array
     std::vector<unsigned long> uSortedInds = uIndices;
     std::sort(uSortedInds.begin(), uSortedInds.end());
@@ -198,6 +226,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    restoreDeferred();
     aboutToSetValue();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
@@ -24,6 +24,8 @@
 #ifndef POINTS_PROPERTYPOINTKERNEL_H
 #define POINTS_PROPERTYPOINTKERNEL_H
 
+#include <Base/Reader.h>
+
 #include "Points.h"
 
 namespace Points
@@ -76,6 +78,8 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    /// Defer reading the points until they are accessed
+    bool deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file) override;
     //@}
 
     /** @name Modification */
@@ -87,8 +91,12 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    void restoreDeferred() const;
+
 private:
     Base::Reference<PointKernel> _cPoints;
+    mutable Base::LazyDocFile deferredFile;
 };
 
 }  // namespace Points
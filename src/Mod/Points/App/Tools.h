@@ -26,6 +26,8 @@
 
 #include <App/DocumentObject.h>
 #include <algorithm>
+#include <type_traits>
+#include <vector>
 
 namespace Points
 {
@@ -60,6 +62,44 @@ bool copyProperty(App::DocumentObject* target,
     return false;
 }
 
+/** Sets the property \a propertyName of \a target to the values of the same property of
+ * \a source at the sorted \a indices, e.g. to keep the normals of downsampled points.
+ * The property is added to \a target if needed. Returns false if \a source has no such
+ * property or no value for each index.
+ */
+template<typename PropertyT>
+bool copyPropertyValues(App::DocumentObject* target,
+                        App::DocumentObject* source,
+                        const char* propertyName,
+                        const std::vector<std::size_t>& indices)
+{
+    auto source_prop = freecad_cast<PropertyT*>(source->getPropertyByName(propertyName));
+    if (!source_prop) {
+        return false;
+    }
+    const auto& source_values = source_prop->getValues();
+    if (!indices.empty() && indices.back() >= source_values.size()) {
+        return false;
+    }
+
+    auto target_prop = freecad_cast<PropertyT*>(target->getPropertyByName(propertyName));
+    if (!target_prop) {
+        target_prop = freecad_cast<PropertyT*>(
+            target->addDynamicProperty(PropertyT::getClassTypeId().getName(), propertyName));
+    }
+    if (!target_prop) {
+        return false;
+    }
+
+    std::decay_t<decltype(source_values)> values;
+    values.reserve(indices.size());
+    for (std::size_t index : indices) {
+        values.push_back(source_values[index]);
+    }
+    target_prop->setValues(values);
+    return true;
+}
+
 }  // namespace Points
 
 #endif  // POINTS_TOOLS_H
@@ -29,8 +29,13 @@
 
 // STL
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <queue>
+#include <vector>
 
 // boost
 #include <boost/math/special_functions/fpclassify.hpp>
@@ -40,10 +45,32 @@
 #include <QInputDialog>
 #include <QMessageBox>
 
+// OpenGL
+#ifdef FC_OS_WIN32
+#include <windows.h>
+#endif
+#ifdef FC_OS_MACOSX
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+
 // Inventor
+#include <Inventor/SbBox3f.h>
 #include <Inventor/SbVec2f.h>
+#include <Inventor/SoPrimitiveVertex.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/bundles/SoMaterialBundle.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoCullElement.h>
+#include <Inventor/elements/SoLazyElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/events/SoMouseButtonEvent.h>
+#include <Inventor/misc/SoState.h>
 #include <Inventor/nodes/SoCamera.h>
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoDrawStyle.h>
@@ -52,6 +79,8 @@
 #include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoNormal.h>
 #include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoShape.h>
+#include <Inventor/sensors/SoTimerSensor.h>
 
 #endif  //_PreComp_
 
@@ -0,0 +1,382 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#ifdef FC_OS_WIN32
+#include <windows.h>
+#endif
+#ifdef FC_OS_MACOSX
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+#include <Inventor/SoPrimitiveVertex.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/bundles/SoMaterialBundle.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoCullElement.h>
+#include <Inventor/elements/SoLazyElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/misc/SoState.h>
+#include <Inventor/sensors/SoTimerSensor.h>
+#endif
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Gui/GLBuffer.h>
+#include <Gui/SoFCInteractiveElement.h>
+#include <Mod/Points/App/PointOctree.h>
+
+#include "SoFCPointCloud.h"
+
+
+using namespace PointsGui;
+
+namespace
+{
+// the uploads of new nodes are spread over the frames
+constexpr std::size_t maxUploadPoints = 2000000;
+// the points that are loaded from the octree between two frames
+constexpr std::size_t maxLoadPoints = 2000000;
+
+SbBox3f toSbBox(const Base::BoundBox3d& box)
+{
+    return SbBox3f(float(box.MinX),
+                   float(box.MinY),
+                   float(box.MinZ),
+                   float(box.MaxX),
+                   float(box.MaxY),
+                   float(box.MaxZ));
+}
+}  // namespace
+
+SO_NODE_SOURCE(SoFCPointCloud)
+
+void SoFCPointCloud::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCPointCloud, SoShape, "Shape");
+}
+
+SoFCPointCloud::SoFCPointCloud()
+{
+    SO_NODE_CONSTRUCTOR(SoFCPointCloud);
+    loadSensor = new SoTimerSensor(loadNodesCB, this);
+    loadSensor->setInterval(SbTime(0.02));
+}
+
+SoFCPointCloud::~SoFCPointCloud()
+{
+    delete loadSensor;
+}
+
+void SoFCPointCloud::setOctree(const Points::PointOctree* tree)
+{
+    octree = tree;
+    nodes.clear();
+    visible.clear();
+    cachedPoints = 0;
+    boundBox.makeEmpty();
+    root = Points::PointOctree::NoNode;
+    loadSensor->unschedule();
+
+    if (octree && octree->getRootNode() != Points::PointOctree::NoNode) {
+        nodes.resize(octree->countNodes());
+        for (std::uint32_t i = 0; i < nodes.size(); i++) {
+            nodes[i].box = toSbBox(octree->getNodeBox(i));
+            nodes[i].count = octree->countNodePoints(i);
+            nodes[i].children = octree->getChildNodes(i);
+        }
+        root = octree->getRootNode();
+        gridSize = float(octree->getSettings().gridSize);
+        boundBox = toSbBox(octree->getBoundBox());
+    }
+    touch();
+}
+
+void SoFCPointCloud::setPointBudget(std::size_t budget)
+{
+    pointBudget = budget;
+    limitCache();
+    touch();
+}
+
+/**
+ * Collects the visible nodes by their size on the screen until \a budget points are
+ * reached. The size of a node is the number of pixels covered by the diagonal of its box.
+ */
+void SoFCPointCloud::selectNodes(SoState* state, std::size_t budget)
+{
+    visible.clear();
+    if (root == Points::PointOctree::NoNode) {
+        return;
+    }
+
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    const SbMatrix& mat = SoModelMatrixElement::get(state);
+    float height = float(SoViewportRegionElement::get(state).getViewportSizePixels()[1]);
+    auto screenSize = [&](const SbBox3f& box) {
+        SbBox3f world = box;
+        world.transform(mat);
+        float diagonal = (world.getMax() - world.getMin()).length();
+        float scale = std::fabs(vv.getWorldToScreenScale(world.getCenter(), 1.0F));
+        // the camera is inside of the node
+        if (scale <= std::numeric_limits<float>::epsilon()) {
+            return std::numeric_limits<float>::max();
+        }
+        return diagonal / scale * height;
+    };
+
+    using Entry = std::pair<float, std::uint32_t>;
+    std::priority_queue<Entry> queue;
+    queue.emplace(screenSize(nodes[root].box), root);
+    std::size_t count = 0;
+    while (!queue.empty()) {
+        auto [size, index] = queue.top();
+        queue.pop();
+        const OctreeNode& node = nodes[index];
+        if (SoCullElement::cullTest(state, node.box)) {
+            continue;
+        }
+        if (count + node.count > budget) {
+            break;
+        }
+        count += node.count;
+        visible.push_back(index);
+
+        // the node has a sample of one point per grid cell
+        if (size / gridSize > 1.0F) {
+            for (std::uint32_t child : node.children) {
+                if (child != Points::PointOctree::NoNode) {
+                    queue.emplace(screenSize(nodes[child].box), child);
+                }
+            }
+        }
+    }
+}
+
+void SoFCPointCloud::GLRender(SoGLRenderAction* action)
+{
+    if (!shouldGLRender(action) || !octree) {
+        return;
+    }
+
+    SoState* state = action->getState();
+    frame++;
+    std::size_t budget = pointBudget;
+    if (Gui::SoFCInteractiveElement::get(state)) {
+        budget /= 4;
+    }
+    selectNodes(state, budget);
+
+    state->push();
+    // the points have no normals
+    SoLazyElement::setLightModel(state, SoLazyElement::BASE_COLOR);
+    SoMaterialBundle mb(action);
+    mb.sendFirst();
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    bool incomplete = false;
+    std::size_t uploaded = 0;
+    for (std::uint32_t index : visible) {
+        OctreeNode& node = nodes[index];
+        if (node.count == 0) {
+            continue;
+        }
+        node.lastUse = frame;
+        if (!node.loaded || !renderNode(action, node, uploaded)) {
+            incomplete = true;
+        }
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    state->pop();
+
+    if (incomplete && !loadSensor->isScheduled()) {
+        loadSensor->schedule();
+    }
+}
+
+/**
+ * Renders the node and returns true, or false if its upload has to wait for the next frame.
+ */
+bool SoFCPointCloud::renderNode(SoGLRenderAction* action,
+                                OctreeNode& node,
+                                std::size_t& uploaded)
+{
+    static bool init = false;
+    static bool vboAvailable = false;
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+        init = true;
+    }
+
+    auto count = static_cast<GLsizei>(node.points.size() / 3);
+    if (!vboAvailable) {
+        glVertexPointer(3, GL_FLOAT, 0, node.points.data());
+        glDrawArrays(GL_POINTS, 0, count);
+        return true;
+    }
+
+    if (!node.buffer) {
+        node.buffer = std::make_unique<Gui::OpenGLMultiBuffer>(GL_ARRAY_BUFFER);
+    }
+    uint32_t context = action->getCacheContext();
+    node.buffer->setCurrentContext(context);
+    if (!node.buffer->isCreated(context)) {
+        if (uploaded > 0 && uploaded + std::size_t(count) > maxUploadPoints) {
+            return false;
+        }
+        uploaded += std::size_t(count);
+        node.buffer->create();
+        node.buffer->bind();
+        node.buffer->allocate(node.points.data(),
+                              static_cast<int>(node.points.size() * sizeof(float)));
+    }
+    else {
+        node.buffer->bind();
+    }
+    glVertexPointer(3, GL_FLOAT, 0, nullptr);
+    glDrawArrays(GL_POINTS, 0, count);
+    node.buffer->release();
+    return true;
+}
+
+void SoFCPointCloud::loadNodes()
+{
+    std::size_t loaded = 0;
+    for (std::uint32_t index : visible) {
+        OctreeNode& node = nodes[index];
+        if (node.loaded || node.count == 0) {
+            continue;
+        }
+        if (loaded > 0 && loaded + node.count > maxLoadPoints) {
+            break;
+        }
+
+        std::vector<Base::Vector3f> points = octree->getNodePoints(index);
+        node.points.resize(3 * points.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            node.points[3 * i] = points[i].x;
+            node.points[3 * i + 1] = points[i].y;
+            node.points[3 * i + 2] = points[i].z;
+        }
+        node.loaded = true;
+        node.lastUse = frame;
+        loaded += points.size();
+        cachedPoints += points.size();
+    }
+    limitCache();
+}
+
+void SoFCPointCloud::limitCache()
+{
+    if (cachedPoints <= 2 * pointBudget) {
+        return;
+    }
+
+    // the nodes of the last frame are kept
+    std::vector<std::uint32_t> cached;
+    for (std::uint32_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].loaded && nodes[i].lastUse < frame) {
+            cached.push_back(i);
+        }
+    }
+    std::sort(cached.begin(), cached.end(), [this](std::uint32_t a, std::uint32_t b) {
+        return nodes[a].lastUse < nodes[b].lastUse;
+    });
+
+    for (std::uint32_t index : cached) {
+        if (cachedPoints <= 2 * pointBudget) {
+            break;
+        }
+        OctreeNode& node = nodes[index];
+        cachedPoints -= node.points.size() / 3;
+        std::vector<float>().swap(node.points);
+        node.buffer.reset();
+        node.loaded = false;
+    }
+}
+
+void SoFCPointCloud::loadNodesCB(void* data, SoSensor* sensor)
+{
+    auto self = static_cast<SoFCPointCloud*>(data);
+    static_cast<SoTimerSensor*>(sensor)->unschedule();
+    try {
+        self->loadNodes();
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().warning("Failed to load the points of the octree: %s\n", e.what());
+        self->setOctree(nullptr);
+        return;
+    }
+
+    // redraw with the new nodes, the next frame schedules the sensor again if needed
+    self->touch();
+}
+
+void SoFCPointCloud::computeBBox(SoAction* /*action*/, SbBox3f& box, SbVec3f& center)
+{
+    box = boundBox;
+    if (!box.isEmpty()) {
+        center = box.getCenter();
+    }
+}
+
+void SoFCPointCloud::getPrimitiveCount(SoGetPrimitiveCountAction* action)
+{
+    if (!shouldPrimitiveCount(action)) {
+        return;
+    }
+    std::size_t count = 0;
+    for (std::uint32_t index : visible) {
+        count += nodes[index].points.size() / 3;
+    }
+    action->addNumPoints(static_cast<int>(count));
+}
+
+/**
+ * Generates the points of the nodes of the last frame, e.g. for picking.
+ */
+void SoFCPointCloud::generatePrimitives(SoAction* action)
+{
+    SoPrimitiveVertex vertex;
+    SoPointDetail detail;
+    vertex.setDetail(&detail);
+
+    beginShape(action, SoShape::POINTS);
+    for (std::uint32_t index : visible) {
+        const std::vector<float>& points = nodes[index].points;
+        for (std::size_t i = 0; i + 2 < points.size(); i += 3) {
+            vertex.setPoint(SbVec3f(points[i], points[i + 1], points[i + 2]));
+            shapeVertex(&vertex);
+        }
+    }
+    endShape();
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTSGUI_SOFCPOINTCLOUD_H
+#define POINTSGUI_SOFCPOINTCLOUD_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Inventor/SbBox3f.h>
+#include <Inventor/nodes/SoShape.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+class SoSensor;
+class SoTimerSensor;
+
+namespace Gui
+{
+class OpenGLMultiBuffer;
+}
+
+namespace Points
+{
+class PointOctree;
+}
+
+namespace PointsGui
+{
+
+/** Renders the points of a PointOctree within a budget of points per frame
+ *
+ * Every frame the visible nodes are collected from the root downwards, the nodes
+ * that cover most pixels first, until the budget is used up. A node is only
+ * refined as long as the spacing of its points is larger than a pixel. Nodes that
+ * aren't in memory yet are loaded from the octree between the frames and uploaded
+ * into vertex buffers over the next frames, meanwhile the coarser nodes are shown.
+ * The least recently shown nodes are dropped when more than twice the budget is
+ * held.
+ *
+ * The octree is not copied, it must be reset with setOctree() before it's
+ * modified or destroyed.
+ */
+class PointsGuiExport SoFCPointCloud: public SoShape
+{
+    using inherited = SoShape;
+
+    SO_NODE_HEADER(SoFCPointCloud);
+
+public:
+    static void initClass();
+    SoFCPointCloud();
+
+    /// Shows the points of \a octree, nullptr shows nothing
+    void setOctree(const Points::PointOctree* octree);
+    /// Maximum number of points that are drawn per frame, a quarter of it while interacting
+    void setPointBudget(std::size_t budget);
+
+protected:
+    ~SoFCPointCloud() override;
+    void GLRender(SoGLRenderAction* action) override;
+    void computeBBox(SoAction* action, SbBox3f& box, SbVec3f& center) override;
+    void getPrimitiveCount(SoGetPrimitiveCountAction* action) override;
+    void generatePrimitives(SoAction* action) override;
+
+private:
+    struct OctreeNode
+    {
+        SbBox3f box;
+        std::size_t count = 0;
+        std::array<std::uint32_t, 8> children {};
+        bool loaded = false;
+        std::vector<float> points;
+        std::unique_ptr<Gui::OpenGLMultiBuffer> buffer;
+        std::uint64_t lastUse = 0;
+    };
+
+    void selectNodes(SoState* state, std::size_t budget);
+    bool renderNode(SoGLRenderAction* action, OctreeNode& node, std::size_t& uploaded);
+    void loadNodes();
+    void limitCache();
+    static void loadNodesCB(void* data, SoSensor* sensor);
+
+private:
+    const Points::PointOctree* octree = nullptr;
+    std::vector<OctreeNode> nodes;
+    std::uint32_t root = std::numeric_limits<std::uint32_t>::max();
+    float gridSize = 1.0F;
+    SbBox3f boundBox;
+    std::size_t pointBudget = 10000000;
+    // the nodes selected for the last frame, most important first
+    std::vector<std::uint32_t> visible;
+    std::size_t cachedPoints = 0;
+    std::uint64_t frame = 0;
+    SoTimerSensor* loadSensor;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_SOFCPOINTCLOUD_H
@@ -37,6 +37,7 @@
 #include <Inventor/nodes/SoPointSet.h>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
@@ -46,6 +47,7 @@
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/Properties.h>
 
+#include "SoFCPointCloud.h"
 #include "ViewProvider.h"
 
 
@@ -77,6 +79,8 @@ ViewProviderPoints::ViewProviderPoints()
 
     pcPointsCoord = new SoCoordinate3();
     pcPointsCoord->ref();
+    pcPointCloud = new SoFCPointCloud();
+    pcPointCloud->ref();
     pcPointsNormal = new SoNormal();
     pcPointsNormal->ref();
     pcColorMat = new SoMaterial;
@@ -92,6 +96,7 @@ ViewProviderPoints::~ViewProviderPoints()
 {
     pcHighlight->unref();
     pcPointsCoord->unref();
+    pcPointCloud->unref();
     pcPointsNormal->unref();
     pcColorMat->unref();
     pcPointStyle->unref();
@@ -156,6 +161,23 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
     pcPointsNormal->vector.finishEditing();
 }
 
+bool ViewProviderPoints::setPagedPoints(const App::Property* prop)
+{
+    const Points::PointKernel& cPts =
+        static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+    if (!cPts.isPaged()) {
+        pcPointCloud->setOctree(nullptr);
+        return false;
+    }
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points");
+    pcPointCloud->setPointBudget(hGrp->GetUnsigned("PointBudget", 10000000));
+    pcPointCloud->setOctree(cPts.getPagedPoints());
+    pcPointsCoord->point.setNum(0);
+    return true;
+}
+
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
     int numPoints = pcPointsCoord->point.getNum();
@@ -389,6 +411,7 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     // Highlight for selection
     pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
+    pcHighlight->addChild(pcPointCloud);
 
     std::vector<std::string> modes = getDisplayModes();
 
@@ -427,8 +450,13 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        if (setPagedPoints(prop)) {
+            pcPoints->numPoints = 0;
+        }
+        else {
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -561,6 +589,7 @@ void ViewProviderStructured::attach(App::DocumentObject* pcObj)
     // Highlight for selection
     pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
+    pcHighlight->addChild(pcPointCloud);
 
     std::vector<std::string> modes = getDisplayModes();
 
@@ -599,8 +628,13 @@ void ViewProviderStructured::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        if (setPagedPoints(prop)) {
+            pcPoints->coordIndex.setNum(0);
+        }
+        else {
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -675,6 +709,29 @@ template class PointsGuiExport ViewProviderFeaturePythonT<PointsGui::ViewProvide
 
 // -------------------------------------------------
 
+namespace
+{
+
+// Paged point clouds are too large to be shown completely, only the coarse levels of the
+// octree are displayed
+std::size_t setLevelOfDetail(const Points::PointKernel& cPts, SoCoordinate3* coords)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points");
+    std::size_t budget = hGrp->GetUnsigned("PointBudget", 10000000);
+    std::vector<Points::PointKernel::value_type> kernel = cPts.getLevelOfDetail(budget);
+
+    coords->point.setNum(kernel.size());
+    SbVec3f* vec = coords->point.startEditing();
+    for (std::size_t idx = 0; idx < kernel.size(); idx++) {
+        vec[idx].setValue(kernel[idx].x, kernel[idx].y, kernel[idx].z);
+    }
+    coords->point.finishEditing();
+    return kernel.size();
+}
+
+}  // namespace
+
 void ViewProviderPointsBuilder::buildNodes(const App::Property* prop,
                                            std::vector<SoNode*>& nodes) const
 {
@@ -708,6 +765,10 @@ void ViewProviderPointsBuilder::createPoints(const App::Property* prop,
     const Points::PropertyPointKernel* prop_points =
         static_cast<const Points::PropertyPointKernel*>(prop);
     const Points::PointKernel& cPts = prop_points->getValue();
+    if (cPts.isPaged()) {
+        points->numPoints = setLevelOfDetail(cPts, coords);
+        return;
+    }
 
     coords->point.setNum(cPts.size());
     SbVec3f* vec = coords->point.startEditing();
@@ -732,6 +793,17 @@ void ViewProviderPointsBuilder::createPoints(const App::Property* prop,
     const Points::PropertyPointKernel* prop_points =
         static_cast<const Points::PropertyPointKernel*>(prop);
     const Points::PointKernel& cPts = prop_points->getValue();
+    if (cPts.isPaged()) {
+        // the octree only holds valid points
+        auto num = static_cast<int32_t>(setLevelOfDetail(cPts, coords));
+        points->coordIndex.setNum(num);
+        int32_t* pos = points->coordIndex.startEditing();
+        for (int32_t index = 0; index < num; index++) {
+            pos[index] = index;
+        }
+        points->coordIndex.finishEditing();
+        return;
+    }
 
     coords->point.setNum(cPts.size());
     SbVec3f* vec = coords->point.startEditing();
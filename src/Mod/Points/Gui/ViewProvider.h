@@ -60,6 +60,8 @@ class Feature;
 namespace PointsGui
 {
 
+class SoFCPointCloud;
+
 class ViewProviderPointsBuilder: public Gui::ViewProviderBuilder
 {
 public:
@@ -105,10 +107,15 @@ protected:
     void setVertexGreyvalueMode(Points::PropertyGreyValueList*);
     void setVertexNormalMode(Points::PropertyNormalList*);
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) = 0;
+    /** Shows the points of a paged kernel with the octree renderer and clears the
+     * coordinates. Returns false for any other kernel.
+     */
+    bool setPagedPoints(const App::Property* prop);
 
 protected:
     Gui::SoFCSelection* pcHighlight;
     SoCoordinate3* pcPointsCoord;
+    SoFCPointCloud* pcPointCloud;
     SoMaterial* pcColorMat;
     SoNormal* pcPointsNormal;
     SoDrawStyle* pcPointStyle;
@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+
 #include <Geom_BSplineSurface.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #endif
@@ -45,6 +47,7 @@
 #include "RegionGrowing.h"
 #include "SampleConsensus.h"
 #include "Segmentation.h"
+#include "ShapeDetection.h"
 #include "SurfaceTriangulation.h"
 
 // clang-format off
@@ -156,6 +159,12 @@ public:
             "sampleConsensus()."
         );
 #endif
+        add_keyword_method("detectShapes",&Module::detectShapes,
+            "detectShapes(Points, [Normals, Types, Epsilon, NormalThreshold, MinSupport, Probability]) -> list\n"
+            "Detects planes, spheres and cylinders with an efficient RANSAC. Each shape is a dict\n"
+            "with its Type, its Parameters like the ones of sampleConsensus() and its point indices\n"
+            "as Model."
+        );
         initialize("This module is the ReverseEngineering module."); // register with Python
     }
 
@@ -975,6 +984,90 @@ Points.show(np)
         return dict;
     }
 #endif
+/*
+import ReverseEngineering as reen
+import Points
+p = App.ActiveDocument.Points.Points
+data = p.Points
+shapes = reen.detectShapes(Points=p, Types=("Plane", "Cylinder"), MinSupport=500)
+for shape in shapes:
+    np = Points.Points()
+    np.addPoints([data[i] for i in shape["Model"]])
+    Points.show(np, shape["Type"])
+    */
+    Py::Object detectShapes(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        PyObject *vec = nullptr;
+        PyObject *seq = nullptr;
+        ShapeDetection::Parameters params;
+        int minSupport = static_cast<int>(params.minSupport);
+
+        static const std::array<const char*,8> kwds_detect {"Points", "Normals", "Types", "Epsilon",
+                                                            "NormalThreshold", "MinSupport",
+                                                            "Probability", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|OOddid", kwds_detect,
+                                        &(Points::PointsPy::Type), &pts, &vec, &seq,
+                                        &params.epsilon, &params.normalThreshold, &minSupport,
+                                        &params.probability))
+            throw Py::Exception();
+
+        if (minSupport < 1)
+            throw Py::ValueError("MinSupport must be positive");
+        if (params.probability <= 0.0 || params.probability >= 1.0)
+            throw Py::ValueError("Value of Probability out of range (0,1)");
+        params.minSupport = static_cast<std::size_t>(minSupport);
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+        std::vector<Base::Vector3d> normals;
+        if (vec && vec != Py_None) {
+            Py::Sequence list(vec);
+            normals.reserve(list.size());
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                Base::Vector3d v = Py::Vector(*it).toVector();
+                normals.push_back(v);
+            }
+        }
+
+        const std::array<const char*, 3> typeNames {"Plane", "Sphere", "Cylinder"};
+        if (seq && seq != Py_None) {
+            params.types.clear();
+            Py::Sequence list(seq);
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                std::string name = Py::String(*it).as_std_string();
+                auto jt = std::find(typeNames.begin(), typeNames.end(), name);
+                if (jt == typeNames.end())
+                    throw Py::ValueError("Unknown shape type: " + name);
+                params.types.push_back(static_cast<ShapeDetection::ShapeType>(jt - typeNames.begin()));
+            }
+        }
+
+        std::vector<ShapeDetection::Shape> shapes;
+        try {
+            ShapeDetection detection(*points, normals);
+            shapes = detection.perform(params);
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        Py::List list;
+        for (const auto& shape : shapes) {
+            Py::Dict dict;
+            Py::Tuple tuple(shape.parameters.size());
+            for (std::size_t i = 0; i < shape.parameters.size(); i++)
+                tuple.setItem(i, Py::Float(shape.parameters[i]));
+            Py::Tuple data(shape.points.size());
+            for (std::size_t i = 0; i < shape.points.size(); i++)
+                data.setItem(i, Py::Long(static_cast<unsigned long>(shape.points[i])));
+            dict.setItem(Py::String("Type"), Py::String(typeNames[shape.type]));
+            dict.setItem(Py::String("Parameters"), tuple);
+            dict.setItem(Py::String("Model"), data);
+            list.append(dict);
+        }
+
+        return list;
+    }
 };
 
 PyObject* initModule()
@@ -22,8 +22,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <chrono>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QThread>
 #include <QtConcurrentMap>
 
 #include <Geom_BSplineSurface.hxx>
@@ -32,6 +34,7 @@
 #include <math_Householder.hxx>
 #endif
 
+#include <Base/Console.h>
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Core/Approximation.h>
@@ -958,35 +961,45 @@ void BSplineParameterCorrection::SetVKnots(const std::vector<double>& afKnots)
     _clVSpline.SetKnots(_vVKnots, _vVMults, _usVOrder);
 }
 
-void BSplineParameterCorrection::DoParameterCorrection(int iIter)
+namespace Reen
 {
-    int i = 0;
-    double fMaxDiff = 0.0, fMaxScalar = 1.0;
-    double fWeight = _fSmoothInfluence;
-
-    Base::SequencerLauncher seq("Calc surface...", iIter * _pvcPoints->Length());
-
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
-
-        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(_vCtrlPntsOfSurf,
-                                                                             _vUKnots,
-                                                                             _vVKnots,
-                                                                             _vUMults,
-                                                                             _vVMults,
-                                                                             _usUOrder - 1,
-                                                                             _usVOrder - 1);
+// Splits the index range into blocks that are handled by one thread each
+static std::vector<std::pair<int, int>> makeBlocks(int lower, int upper)
+{
+    int count = upper - lower + 1;
+    int numBlocks = std::max(1, std::min(QThread::idealThreadCount(), count / 1000));
+    int size = std::max(1, (count + numBlocks - 1) / numBlocks);
+    std::vector<std::pair<int, int>> blocks;
+    for (int begin = lower; begin <= upper; begin += size) {
+        blocks.emplace_back(begin, std::min(upper + 1, begin + size));
+    }
+    return blocks;
+}
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
+class ParameterStep
+{
+public:
+    ParameterStep(const Handle(Geom_BSplineSurface) & surf,
+                  const TColgp_Array1OfPnt& points,
+                  TColgp_Array1OfPnt2d& params)
+        : surf(surf)
+        , points(points)
+        , params(params)
+    {}
+    // Corrects the parameters of the points of a block, returns the maximum change and
+    // the minimum scalar product of normal and error
+    std::pair<double, double> correct(const std::pair<int, int>& block) const
+    {
+        double fMaxDiff = 0.0, fMaxScalar = 1.0;
+        for (int ii = block.first; ii < block.second; ii++) {
             double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
+            const gp_Pnt& pnt = points(ii);
             gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
             gp_Pnt PntX;
             gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
             // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+            gp_Pnt2d& uvValue = params(ii);
+            surf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
             gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
             gp_Vec ErrorVec = X - P;
 
@@ -1019,9 +1032,55 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
                 fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
                 fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
             }
+        }
+        return {fMaxDiff, fMaxScalar};
+    }
+
+private:
+    Handle(Geom_BSplineSurface) surf;
+    const TColgp_Array1OfPnt& points;
+    TColgp_Array1OfPnt2d& params;
+};
+}  // namespace Reen
 
-            seq.next();
+void BSplineParameterCorrection::DoParameterCorrection(int iIter)
+{
+    int i = 0;
+    double fMaxDiff = 0.0, fMaxScalar = 1.0;
+    double fWeight = _fSmoothInfluence;
+
+    Base::SequencerLauncher seq("Calc surface...", iIter);
+
+    using clock = std::chrono::steady_clock;
+    do {
+        clock::time_point start = clock::now();
+        fMaxScalar = 1.0;
+        fMaxDiff = 0.0;
+
+        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(_vCtrlPntsOfSurf,
+                                                                             _vUKnots,
+                                                                             _vVKnots,
+                                                                             _vUMults,
+                                                                             _vVMults,
+                                                                             _usUOrder - 1,
+                                                                             _usVOrder - 1);
+
+        // the points are independent of each other
+        std::vector<std::pair<int, int>> blocks =
+            makeBlocks(_pvcPoints->Lower(), _pvcPoints->Upper());
+        ParameterStep step(pclBSplineSurf, *_pvcPoints, *_pvcUVParam);
+        // NOLINTBEGIN
+        QFuture<std::pair<double, double>> future =
+            QtConcurrent::mapped(blocks, std::bind(&ParameterStep::correct, &step, sp::_1));
+        // NOLINTEND
+        QFutureWatcher<std::pair<double, double>> watcher;
+        watcher.setFuture(future);
+        watcher.waitForFinished();
+        for (const auto& it : future) {
+            fMaxDiff = std::max<double>(it.first, fMaxDiff);
+            fMaxScalar = std::min<double>(it.second, fMaxScalar);
         }
+        clock::time_point corrected = clock::now();
 
         if (_bSmoothing) {
             fWeight *= 0.5f;
@@ -1031,6 +1090,12 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             SolveWithoutSmoothing();
         }
 
+        clock::time_point solved = clock::now();
+        Base::Console().log("Surface fit iteration %d: correction %.3f s, solving %.3f s\n",
+                            i + 1,
+                            std::chrono::duration<double>(corrected - start).count(),
+                            std::chrono::duration<double>(solved - corrected).count());
+        seq.next();
         i++;
     } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
 }
@@ -1115,145 +1180,172 @@ bool BSplineParameterCorrection::SolveWithoutSmoothing()
 
 namespace Reen
 {
-class ScalarProduct
+// Sums up the normal equations M^T.M and M^T.b of the points of a block. Only the
+// basis functions of the knot spans of a point are non-zero, so the full matrix M
+// isn't needed.
+class NormalEquations
 {
 public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
+    NormalEquations(BSplineBasis& basisU,
+                    BSplineBasis& basisV,
+                    const TColStd_Array1OfReal& knotsU,
+                    const TColStd_Array1OfReal& knotsV,
+                    int numU,
+                    int numV,
+                    int orderU,
+                    int orderV,
+                    const TColgp_Array1OfPnt& points,
+                    const TColgp_Array1OfPnt2d& params)
+        : basisU(basisU)
+        , basisV(basisV)
+        , knotsU(knotsU)
+        , knotsV(knotsV)
+        , numU(numU)
+        , numV(numV)
+        , orderU(orderU)
+        , orderV(orderV)
+        , points(points)
+        , params(params)
     {}
-    std::vector<double> multiply(int col) const
+    // The rows of M^T.M followed by M^T.b for x, y and z
+    std::vector<double> sum(const std::pair<int, int>& block) const
     {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
+        int dim = numU * numV;
+        std::vector<double> values((dim + 3) * dim, 0.0);
+        std::vector<int> index;
+        std::vector<double> value;
+        std::vector<double> valuesV;
+        for (int i = block.first; i < block.second; i++) {
+            const gp_Pnt2d& uvValue = params(i);
+            double fU = uvValue.X();
+            double fV = uvValue.Y();
+            int firstU {}, lastU {}, firstV {}, lastV {};
+            support(basisU, knotsU, numU, orderU, fU, firstU, lastU);
+            support(basisV, knotsV, numV, orderV, fV, firstV, lastV);
+
+            valuesV.clear();
+            for (int k = firstV; k <= lastV; k++) {
+                valuesV.push_back(basisV.BasisFunction(k, fV));
+            }
+            index.clear();
+            value.clear();
+            for (int j = firstU; j <= lastU; j++) {
+                double valueU = basisU.BasisFunction(j, fU);
+                if (valueU == 0.0) {
+                    continue;
+                }
+                for (int k = firstV; k <= lastV; k++) {
+                    index.push_back(j * numV + k);
+                    value.push_back(valueU * valuesV[k - firstV]);
+                }
+            }
+
+            const gp_Pnt& pnt = points(i);
+            double* rhs = &values[dim * dim];
+            for (std::size_t m = 0; m < index.size(); m++) {
+                double* row = &values[index[m] * dim];
+                for (std::size_t n = 0; n < index.size(); n++) {
+                    row[index[n]] += value[m] * value[n];
+                }
+                rhs[index[m]] += value[m] * pnt.X();
+                rhs[dim + index[m]] += value[m] * pnt.Y();
+                rhs[2 * dim + index[m]] += value[m] * pnt.Z();
+            }
         }
-        return out;
+        return values;
     }
 
 private:
-    const math_Matrix& mat;
+    // The range of the basis functions that can be non-zero at fParam
+    static void support(BSplineBasis& basis,
+                        const TColStd_Array1OfReal& knots,
+                        int num,
+                        int order,
+                        double fParam,
+                        int& first,
+                        int& last)
+    {
+        if (fParam < knots(knots.Lower()) || fParam > knots(knots.Upper())) {
+            first = 0;
+            last = num - 1;
+            return;
+        }
+        int span = basis.FindSpan(fParam);
+        first = std::max(0, span - order + 1);
+        last = std::min(num - 1, span);
+    }
+
+    BSplineBasis& basisU;
+    BSplineBasis& basisV;
+    const TColStd_Array1OfReal& knotsU;
+    const TColStd_Array1OfReal& knotsV;
+    int numU;
+    int numV;
+    int orderU;
+    int orderV;
+    const TColgp_Array1OfPnt& points;
+    const TColgp_Array1OfPnt2d& params;
 };
 }  // namespace Reen
 
 bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
 {
-    unsigned ulSize = _pvcPoints->Length();
     unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
     math_Vector Xx(0, ulDim - 1);
     math_Vector Xy(0, ulDim - 1);
     math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-    math_Vector Mbx(0, ulDim - 1);
-    math_Vector Mby(0, ulDim - 1);
-    math_Vector Mbz(0, ulDim - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
-
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
-            }
-        }
-    }
-
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
-        }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
+    math_Vector Mbx(0, ulDim - 1, 0.0);
+    math_Vector Mby(0, ulDim - 1, 0.0);
+    math_Vector Mbz(0, ulDim - 1, 0.0);
+
+    // The normal equations are summed up in parallel for blocks of points
+    std::vector<std::pair<int, int>> blocks = makeBlocks(_pvcPoints->Lower(), _pvcPoints->Upper());
+    NormalEquations normal(_clUSpline,
+                           _clVSpline,
+                           _vUKnots,
+                           _vVKnots,
+                           int(_usUCtrlpoints),
+                           int(_usVCtrlpoints),
+                           int(_usUOrder),
+                           int(_usVOrder),
+                           *_pvcPoints,
+                           *_pvcUVParam);
     // NOLINTBEGIN
     QFuture<std::vector<double>> future =
-        QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
+        QtConcurrent::mapped(blocks, std::bind(&NormalEquations::sum, &normal, sp::_1));
     // NOLINTEND
     QFutureWatcher<std::vector<double>> watcher;
     watcher.setFuture(future);
     watcher.waitForFinished();
 
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
+    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1, 0.0);
     for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end();
-             ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
+        const double* values = it.data();
+        for (unsigned m = 0; m < ulDim; m++) {
+            for (unsigned n = 0; n < ulDim; n++) {
+                MTM(m, n) += *values++;
+            }
+        }
+        for (unsigned m = 0; m < ulDim; m++) {
+            Mbx(m) += *values++;
+        }
+        for (unsigned m = 0; m < ulDim; m++) {
+            Mby(m) += *values++;
+        }
+        for (unsigned m = 0; m < ulDim; m++) {
+            Mbz(m) += *values++;
         }
-        rowIndex++;
-    }
-#endif
-
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
-    }
-
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
-
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
-        return false;
     }
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
+    // Solve the LGS with the LU decomposition, the matrix is the same for x, y and z
+    math_Gauss mgGauss(MTM + fWeight * _clSmoothMatrix);
+    if (!mgGauss.IsDone()) {
         return false;
     }
 
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
-        return false;
-    }
+    mgGauss.Solve(Mbx, Xx);
+    mgGauss.Solve(Mby, Xy);
+    mgGauss.Solve(Mbz, Xz);
 
     unsigned ulIdx = 0;
     for (unsigned j = 0; j < _usUCtrlpoints; j++) {
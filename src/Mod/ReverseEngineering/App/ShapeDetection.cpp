@@ -0,0 +1,639 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <random>
+#include <thread>
+#include <type_traits>
+#endif
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
+
+#include <Base/Exception.h>
+#include <Mod/Points/App/PointKDTree.h>
+#include <Mod/Points/App/Points.h>
+
+#include "ShapeDetection.h"
+
+
+using namespace Reen;
+
+namespace
+{
+using Vector = Eigen::Vector3f;
+
+// the sizes of the neighbourhoods the samples are taken from, the small ones find small
+// shapes, the large ones give more accurate candidates for large shapes
+constexpr std::array<std::size_t, 3> sampleLevels {16, 128, 1024};
+// the samples that are drawn at a time, independent of the number of threads so that
+// the result is the same on every machine
+constexpr std::size_t samplesPerBatch = 256;
+// the number of points a candidate is scored on first
+constexpr std::size_t firstSubset = 1024;
+// the points a thread takes at a time when evaluating a candidate
+constexpr std::size_t pointsPerTask = 16384;
+// gives up on a shape after this many samples
+constexpr std::size_t maxSamples = 1000000;
+// the least squares fits of an accepted shape to its growing set of points
+constexpr int maxRefits = 3;
+
+template<typename Func>
+void parallelFor(unsigned int threads, std::size_t count, std::size_t grain, Func&& func)
+{
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        std::size_t begin {};
+        while ((begin = next.fetch_add(grain)) < count) {
+            func(begin, std::min(count, begin + grain));
+        }
+    };
+
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    auto numThreads =
+        static_cast<unsigned int>(std::min<std::size_t>(threads, (count + grain - 1) / grain));
+    std::vector<std::future<void>> futures;
+    for (unsigned int i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+std::uint32_t mixSeed(std::uint64_t value)
+{
+    // splitmix64
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    // minstd_rand must not be seeded with zero
+    return static_cast<std::uint32_t>(value % 0x7FFFFFFEULL) + 1;
+}
+
+struct Candidate
+{
+    ShapeDetection::ShapeType type {};
+    // plane: a point on the plane, sphere: the center, cylinder: a point on the axis
+    Vector point;
+    // plane: the normal, cylinder: the axis direction
+    Vector axis;
+    float radius = 0.0F;
+    // the inliers among the first evaluated points of the remaining points
+    std::size_t score = 0;
+    std::size_t evaluated = 0;
+};
+
+class Detector
+{
+public:
+    Detector(const std::vector<Base::Vector3f>& points,
+             const std::vector<Base::Vector3f>& normals,
+             const Points::PointKDTree& tree,
+             const ShapeDetection::Parameters& params);
+    std::vector<ShapeDetection::Shape> run();
+
+private:
+    Vector position(std::size_t index) const
+    {
+        const Base::Vector3f& pnt = points[index];
+        return {pnt.x, pnt.y, pnt.z};
+    }
+    Vector normal(std::size_t index) const
+    {
+        const Base::Vector3f& vec = normals[index];
+        return {vec.x, vec.y, vec.z};
+    }
+    bool isInlier(const Candidate& candidate, std::size_t index) const;
+    bool fit(ShapeDetection::ShapeType type,
+             const std::array<std::size_t, 3>& sample,
+             Candidate& candidate) const;
+    void drawSample(std::size_t number, std::vector<Candidate>& candidates) const;
+    void drawBatch(std::size_t first, std::vector<Candidate>& pool) const;
+    std::size_t countInliers(const Candidate& candidate, std::size_t begin, std::size_t end) const;
+    void evaluateMore(Candidate& candidate) const;
+    double upperBound(const Candidate& candidate) const;
+    std::vector<std::size_t> collectInliers(const Candidate& candidate) const;
+    bool refit(Candidate& candidate, const std::vector<std::size_t>& inliers) const;
+    static ShapeDetection::Shape makeShape(const Candidate& candidate,
+                                           std::vector<std::size_t>&& inliers);
+
+private:
+    const std::vector<Base::Vector3f>& points;
+    const std::vector<Base::Vector3f>& normals;
+    const Points::PointKDTree& tree;
+    const ShapeDetection::Parameters& params;
+    float epsilon = 0.0F;
+    float cosAngle = 0.0F;
+    float maxRadius = 0.0F;
+    // the indices of the points that don't belong to a shape yet in random order, so
+    // that each of its prefixes is a random subset
+    std::vector<std::size_t> remaining;
+    std::vector<char> active;
+    std::size_t numSamples = 0;
+};
+
+Detector::Detector(const std::vector<Base::Vector3f>& points,
+                   const std::vector<Base::Vector3f>& normals,
+                   const Points::PointKDTree& tree,
+                   const ShapeDetection::Parameters& params)
+    : points(points)
+    , normals(normals)
+    , tree(tree)
+    , params(params)
+    , cosAngle(float(params.normalThreshold))
+    , active(points.size(), 0)
+{
+    Eigen::AlignedBox3f box;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Vector pnt = position(i);
+        if (pnt.allFinite() && normal(i).allFinite() && normal(i).squaredNorm() > 0.0F) {
+            remaining.push_back(i);
+            active[i] = 1;
+            box.extend(pnt);
+        }
+    }
+
+    float diagonal = remaining.empty() ? 0.0F : box.diagonal().norm();
+    epsilon = params.epsilon > 0.0 ? float(params.epsilon) : 0.005F * diagonal;
+    maxRadius = diagonal;
+    std::shuffle(remaining.begin(), remaining.end(), std::minstd_rand(mixSeed(params.seed)));
+}
+
+bool Detector::isInlier(const Candidate& candidate, std::size_t index) const
+{
+    Vector pnt = position(index);
+    Vector vec = normal(index);
+    Vector dir = pnt - candidate.point;
+    if (candidate.type == ShapeDetection::Plane) {
+        return std::fabs(dir.dot(candidate.axis)) < epsilon
+            && std::fabs(vec.dot(candidate.axis)) >= cosAngle;
+    }
+    if (candidate.type == ShapeDetection::Cylinder) {
+        dir -= candidate.axis * dir.dot(candidate.axis);
+    }
+    // the normals are unit vectors, so the angle can be checked without a division
+    float len = dir.norm();
+    return std::fabs(len - candidate.radius) < epsilon
+        && std::fabs(vec.dot(dir)) >= cosAngle * len;
+}
+
+/**
+ * Fits a shape of \a type to the sample, planes through all three points, spheres and
+ * cylinders through the first two points and their normals. The shape is only taken if
+ * all points of the sample are inliers.
+ */
+bool Detector::fit(ShapeDetection::ShapeType type,
+                   const std::array<std::size_t, 3>& sample,
+                   Candidate& candidate) const
+{
+    Vector p0 = position(sample[0]);
+    Vector p1 = position(sample[1]);
+    Vector n0 = normal(sample[0]).normalized();
+    Vector n1 = normal(sample[1]).normalized();
+    candidate.type = type;
+
+    switch (type) {
+        case ShapeDetection::Plane: {
+            Vector axis = (p1 - p0).cross(position(sample[2]) - p0);
+            float len = axis.norm();
+            if (len <= 0.0F) {
+                return false;
+            }
+            candidate.point = p0;
+            candidate.axis = axis / len;
+        } break;
+        case ShapeDetection::Sphere:
+        case ShapeDetection::Cylinder: {
+            // for a cylinder both normals are perpendicular to the axis
+            Vector axis = n0.cross(n1);
+            float sine = axis.norm();
+            if (sine < 0.01F) {
+                return false;
+            }
+            axis /= sine;
+
+            // the closest points of the lines through the points along their normals,
+            // for a cylinder the lines are projected onto a plane perpendicular to the axis
+            Vector w = p0 - p1;
+            if (type == ShapeDetection::Cylinder) {
+                w -= axis * w.dot(axis);
+            }
+            float b = n0.dot(n1);
+            float d = n0.dot(w);
+            float e = n1.dot(w);
+            float denom = 1.0F - b * b;
+            float t = (b * e - d) / denom;
+            float s = (e - b * d) / denom;
+            if (type == ShapeDetection::Sphere) {
+                candidate.point = 0.5F * (p0 + t * n0 + p1 + s * n1);
+                candidate.radius = 0.5F * ((p0 - candidate.point).norm() + (p1 - candidate.point).norm());
+            }
+            else {
+                candidate.point = p0 + t * n0;
+                candidate.axis = axis;
+                candidate.radius = 0.5F * (std::fabs(t) + std::fabs(s));
+            }
+            // a huge sphere or cylinder is rather a plane
+            if (!(candidate.radius > epsilon && candidate.radius < maxRadius)) {
+                return false;
+            }
+        } break;
+    }
+
+    return std::all_of(sample.begin(), sample.end(), [&](std::size_t index) {
+        return isInlier(candidate, index);
+    });
+}
+
+/**
+ * Takes a random remaining point and two other remaining points out of one of its
+ * neighbourhoods, fits all shape types to them and scores the candidates on the first
+ * subset of the remaining points. \a number seeds the random numbers.
+ */
+void Detector::drawSample(std::size_t number, std::vector<Candidate>& candidates) const
+{
+    std::minstd_rand rng(mixSeed((std::uint64_t(params.seed) << 32) + number));
+    std::size_t first = remaining[rng() % remaining.size()];
+    std::size_t level = sampleLevels[rng() % sampleLevels.size()];
+
+    thread_local std::vector<Points::PointKDTree::Neighbour> neighbours;
+    thread_local std::vector<std::size_t> nearby;
+    tree.findNearest(points[first], level, neighbours);
+    nearby.clear();
+    for (const auto& neighbour : neighbours) {
+        if (neighbour.first != first && active[neighbour.first]) {
+            nearby.push_back(neighbour.first);
+        }
+    }
+    if (nearby.size() < 2) {
+        return;
+    }
+
+    std::size_t i = rng() % nearby.size();
+    std::size_t j = rng() % (nearby.size() - 1);
+    if (j >= i) {
+        j++;
+    }
+    std::array<std::size_t, 3> sample {first, nearby[i], nearby[j]};
+
+    std::size_t subset = std::min(remaining.size(), firstSubset);
+    for (auto type : params.types) {
+        Candidate candidate;
+        if (fit(type, sample, candidate)) {
+            candidate.score = countInliers(candidate, 0, subset);
+            candidate.evaluated = subset;
+            candidates.push_back(candidate);
+        }
+    }
+}
+
+void Detector::drawBatch(std::size_t first, std::vector<Candidate>& pool) const
+{
+    std::vector<std::vector<Candidate>> batch(samplesPerBatch);
+    parallelFor(params.threads, samplesPerBatch, 8, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            drawSample(first + i, batch[i]);
+        }
+    });
+    for (const auto& candidates : batch) {
+        pool.insert(pool.end(), candidates.begin(), candidates.end());
+    }
+}
+
+std::size_t
+Detector::countInliers(const Candidate& candidate, std::size_t begin, std::size_t end) const
+{
+    std::size_t count = 0;
+    for (std::size_t i = begin; i < end; i++) {
+        if (isInlier(candidate, remaining[i])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Doubles the number of points the candidate is evaluated on.
+ */
+void Detector::evaluateMore(Candidate& candidate) const
+{
+    std::size_t begin = candidate.evaluated;
+    std::size_t end = std::min(remaining.size(), std::max(2 * begin, firstSubset));
+    if (end - begin <= pointsPerTask) {
+        candidate.score += countInliers(candidate, begin, end);
+    }
+    else {
+        std::atomic<std::size_t> score {0};
+        auto count = [&](std::size_t first, std::size_t last) {
+            score += countInliers(candidate, begin + first, begin + last);
+        };
+        parallelFor(params.threads, end - begin, pointsPerTask, count);
+        candidate.score += score;
+    }
+    candidate.evaluated = end;
+}
+
+/**
+ * The number of inliers among all remaining points is below this bound with high
+ * probability. The bound is extrapolated from the evaluated points with twice the
+ * standard deviation of the hypergeometric distribution.
+ */
+double Detector::upperBound(const Candidate& candidate) const
+{
+    auto total = double(remaining.size());
+    auto evaluated = double(candidate.evaluated);
+    if (candidate.evaluated >= remaining.size()) {
+        return double(candidate.score);
+    }
+    double ratio = (double(candidate.score) + 1.0) / (evaluated + 2.0);
+    double deviation =
+        total * std::sqrt(ratio * (1.0 - ratio) / evaluated * (total - evaluated) / (total - 1.0));
+    return double(candidate.score) * total / evaluated + 2.0 * deviation;
+}
+
+std::vector<std::size_t> Detector::collectInliers(const Candidate& candidate) const
+{
+    std::size_t count = remaining.size();
+    std::vector<std::vector<std::size_t>> parts((count + pointsPerTask - 1) / pointsPerTask);
+    parallelFor(params.threads, count, pointsPerTask, [&](std::size_t begin, std::size_t end) {
+        auto& part = parts[begin / pointsPerTask];
+        for (std::size_t i = begin; i < end; i++) {
+            if (isInlier(candidate, remaining[i])) {
+                part.push_back(remaining[i]);
+            }
+        }
+    });
+
+    std::vector<std::size_t> inliers;
+    for (const auto& part : parts) {
+        inliers.insert(inliers.end(), part.begin(), part.end());
+    }
+    std::sort(inliers.begin(), inliers.end());
+    return inliers;
+}
+
+/**
+ * Replaces the shape through the sample by the least squares fit of its inliers. Planes
+ * and spheres are fitted to the points, the axis of a cylinder is the direction the
+ * normals vary least along and its circle is fitted to the points projected along it.
+ */
+bool Detector::refit(Candidate& candidate, const std::vector<std::size_t>& inliers) const
+{
+    if (inliers.size() < 4) {
+        return false;
+    }
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+    for (std::size_t index : inliers) {
+        center += position(index).cast<double>();
+    }
+    center /= double(inliers.size());
+
+    // the algebraic fit |p|^2 = 2 * c.p + k of a circle or sphere with center c and
+    // radius sqrt(k + |c|^2), relative to the center of the points for accuracy
+    auto fitSphere = [&](auto project, auto& mid, double& radius) {
+        using Vec = std::decay_t<decltype(mid)>;
+        constexpr int dim = Vec::RowsAtCompileTime;
+        Eigen::Matrix<double, dim + 1, dim + 1> lhs;
+        Eigen::Matrix<double, dim + 1, 1> rhs;
+        lhs.setZero();
+        rhs.setZero();
+        for (std::size_t index : inliers) {
+            Vec pnt = project(position(index).cast<double>() - center);
+            Eigen::Matrix<double, dim + 1, 1> row;
+            row << 2.0 * pnt, 1.0;
+            lhs += row * row.transpose();
+            rhs += row * pnt.squaredNorm();
+        }
+        Eigen::Matrix<double, dim + 1, 1> solution = lhs.ldlt().solve(rhs);
+        mid = solution.template head<dim>();
+        double square = solution[dim] + mid.squaredNorm();
+        if (!(square > 0.0)) {
+            return false;
+        }
+        radius = std::sqrt(square);
+        return true;
+    };
+
+    switch (candidate.type) {
+        case ShapeDetection::Plane: {
+            Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+            for (std::size_t index : inliers) {
+                Eigen::Vector3d diff = position(index).cast<double>() - center;
+                covariance += diff * diff.transpose();
+            }
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+            solver.computeDirect(covariance);
+            candidate.point = center.cast<float>();
+            candidate.axis = solver.eigenvectors().col(0).cast<float>().normalized();
+        } break;
+        case ShapeDetection::Sphere: {
+            Eigen::Vector3d mid;
+            double radius {};
+            if (!fitSphere([](const Eigen::Vector3d& pnt) { return pnt; }, mid, radius)) {
+                return false;
+            }
+            candidate.point = (center + mid).cast<float>();
+            candidate.radius = float(radius);
+        } break;
+        case ShapeDetection::Cylinder: {
+            Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+            for (std::size_t index : inliers) {
+                Eigen::Vector3d vec = normal(index).cast<double>();
+                covariance += vec * vec.transpose();
+            }
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+            solver.computeDirect(covariance);
+            Eigen::Vector3d axis = solver.eigenvectors().col(0).normalized();
+            Eigen::Vector3d u = axis.unitOrthogonal();
+            Eigen::Vector3d v = axis.cross(u);
+            auto project = [&](const Eigen::Vector3d& pnt) {
+                return Eigen::Vector2d(pnt.dot(u), pnt.dot(v));
+            };
+            Eigen::Vector2d mid;
+            double radius {};
+            if (!fitSphere(project, mid, radius)) {
+                return false;
+            }
+            candidate.point = (center + mid.x() * u + mid.y() * v).cast<float>();
+            candidate.axis = axis.cast<float>();
+            candidate.radius = float(radius);
+        } break;
+    }
+    return candidate.radius < maxRadius;
+}
+
+ShapeDetection::Shape Detector::makeShape(const Candidate& candidate,
+                                          std::vector<std::size_t>&& inliers)
+{
+    ShapeDetection::Shape shape;
+    shape.type = candidate.type;
+    const Vector& pnt = candidate.point;
+    const Vector& dir = candidate.axis;
+    switch (candidate.type) {
+        case ShapeDetection::Plane:
+            shape.parameters = {dir.x(), dir.y(), dir.z(), -dir.dot(pnt)};
+            break;
+        case ShapeDetection::Sphere:
+            shape.parameters = {pnt.x(), pnt.y(), pnt.z(), candidate.radius};
+            break;
+        case ShapeDetection::Cylinder:
+            shape.parameters =
+                {pnt.x(), pnt.y(), pnt.z(), dir.x(), dir.y(), dir.z(), candidate.radius};
+            break;
+    }
+    shape.points = std::move(inliers);
+    return shape;
+}
+
+std::vector<ShapeDetection::Shape> Detector::run()
+{
+    std::vector<ShapeDetection::Shape> shapes;
+    std::size_t minSupport = std::max<std::size_t>(params.minSupport, 3);
+    double failure = 1.0 - params.probability;
+    if (params.types.empty()) {
+        return shapes;
+    }
+
+    while (remaining.size() >= minSupport) {
+        std::vector<Candidate> pool;
+        std::size_t drawn = 0;
+        Candidate best;
+        for (;;) {
+            drawBatch(numSamples, pool);
+            numSamples += samplesPerBatch;
+            drawn += samplesPerBatch;
+
+            // evaluate the most promising candidate on more points until it's evaluated
+            // on all points, then no other candidate can have more inliers
+            auto bound = [this](const Candidate& a, const Candidate& b) {
+                return upperBound(a) < upperBound(b);
+            };
+            while (!pool.empty()) {
+                auto it = std::max_element(pool.begin(), pool.end(), bound);
+                if (it->evaluated >= remaining.size()) {
+                    best = *it;
+                    break;
+                }
+                evaluateMore(*it);
+            }
+            pool.erase(std::remove_if(pool.begin(),
+                                      pool.end(),
+                                      [&](const Candidate& c) {
+                                          return upperBound(c) < double(best.score);
+                                      }),
+                       pool.end());
+
+            // the chance to draw a sample of a shape with n points is about n/N for the
+            // first point and one out of the neighbourhood levels for the other two
+            std::size_t size = std::max(best.score, minSupport);
+            double found = double(size) / (double(remaining.size()) * sampleLevels.size());
+            if (std::pow(1.0 - found, double(drawn)) < failure || drawn >= maxSamples) {
+                break;
+            }
+        }
+
+        if (best.score < minSupport) {
+            break;
+        }
+
+        // the fit to the sample is only as accurate as its few points
+        std::vector<std::size_t> inliers = collectInliers(best);
+        for (int i = 0; i < maxRefits; i++) {
+            Candidate candidate = best;
+            if (!refit(candidate, inliers)) {
+                break;
+            }
+            std::vector<std::size_t> refitInliers = collectInliers(candidate);
+            if (refitInliers.size() <= inliers.size()) {
+                break;
+            }
+            best = candidate;
+            inliers = std::move(refitInliers);
+        }
+
+        for (std::size_t index : inliers) {
+            active[index] = 0;
+        }
+        remaining.erase(std::remove_if(remaining.begin(),
+                                       remaining.end(),
+                                       [this](std::size_t index) {
+                                           return !active[index];
+                                       }),
+                        remaining.end());
+        shapes.push_back(makeShape(best, std::move(inliers)));
+    }
+
+    return shapes;
+}
+}  // namespace
+
+ShapeDetection::ShapeDetection(const Points::PointKernel& points,
+                               const std::vector<Base::Vector3d>& normals)
+    : myPoints(points)
+    , myNormals(normals)
+{}
+
+std::vector<ShapeDetection::Shape> ShapeDetection::perform(const Parameters& params) const
+{
+    if (!myNormals.empty() && myNormals.size() != myPoints.size()) {
+        throw Base::ValueError("The number of normals must match the number of points");
+    }
+
+    std::vector<Base::Vector3f> points;
+    points.reserve(myPoints.size());
+    for (Points::PointKernel::const_iterator it = myPoints.begin(); it != myPoints.end(); ++it) {
+        points.emplace_back(float(it->x), float(it->y), float(it->z));
+    }
+
+    Points::PointKDTree tree(points);
+    std::vector<Base::Vector3f> normals;
+    if (myNormals.empty()) {
+        normals = tree.estimateNormals(10);
+    }
+    else {
+        normals.reserve(myNormals.size());
+        for (const auto& vec : myNormals) {
+            double len = vec.Length();
+            if (len > 0.0) {
+                normals.emplace_back(float(vec.x / len), float(vec.y / len), float(vec.z / len));
+            }
+            else {
+                normals.emplace_back();
+            }
+        }
+    }
+
+    Detector detector(points, normals, tree, params);
+    return detector.run();
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef REEN_SHAPEDETECTION_H
+#define REEN_SHAPEDETECTION_H
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+
+namespace Points
+{
+class PointKernel;
+}
+
+namespace Reen
+{
+
+/** Detects planes, spheres and cylinders in a point cloud with an efficient RANSAC
+ *
+ * The approach follows Schnabel et al., "Efficient RANSAC for Point-Cloud Shape
+ * Detection": candidates of all shape types are fitted to the same minimal samples,
+ * which are taken from the neighbourhood of a random point. A candidate is scored on
+ * a random subset of the points first and only evaluated on more points while it may
+ * still be the best one. The best candidate is accepted as soon as the chance to have
+ * missed a larger shape drops below 1 - probability, its points are removed and the
+ * search goes on with the remaining points until no shape with enough points is left.
+ *
+ * The candidates are generated and scored by several threads. The result only
+ * depends on the seed, not on the number of threads.
+ */
+class ShapeDetection
+{
+public:
+    enum ShapeType
+    {
+        Plane,
+        Sphere,
+        Cylinder,
+    };
+
+    struct Parameters
+    {
+        /// The maximum distance of a point to its shape, 0.5% of the bounding box
+        /// diagonal if not positive
+        double epsilon = 0.0;
+        /// The minimum cosine of the angle between the normals of a point and its shape
+        double normalThreshold = 0.9;
+        /// The minimum number of points of a shape
+        std::size_t minSupport = 100;
+        /// The confidence not to miss a shape with more points than the accepted one
+        double probability = 0.99;
+        /// The shape types to look for
+        std::vector<ShapeType> types {Plane, Sphere, Cylinder};
+        std::uint32_t seed = 0;
+        /// The number of threads, all hardware threads if 0
+        unsigned int threads = 0;
+    };
+
+    struct Shape
+    {
+        ShapeType type;
+        /** The coefficients of the shape like those of PCL:
+         * Plane: a, b, c, d of a*x + b*y + c*z + d = 0 with a unit normal
+         * Sphere: center, radius
+         * Cylinder: point on the axis, axis direction, radius
+         */
+        std::vector<double> parameters;
+        /// The indices of the points of the shape
+        std::vector<std::size_t> points;
+    };
+
+    /// The normals are estimated from the ten nearest points if \a normals is empty
+    ShapeDetection(const Points::PointKernel& points, const std::vector<Base::Vector3d>& normals);
+    /// The shapes in the order they were found, which roughly is by decreasing size
+    std::vector<Shape> perform(const Parameters& params) const;
+
+private:
+    const Points::PointKernel& myPoints;
+    const std::vector<Base::Vector3d>& myNormals;
+};
+
+}  // namespace Reen
+
+#endif  // REEN_SHAPEDETECTION_H
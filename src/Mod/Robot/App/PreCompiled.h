@@ -39,8 +39,10 @@
 #ifdef _PreComp_
 
 // STL
+#include <algorithm>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 // kdl_cp
 #include "kdl_cp/chain.hpp"
@@ -60,6 +62,7 @@
 // OCC
 #include <BRepAdaptor_Curve.hxx>
 #include <CPnts_AbscissaPoint.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 
@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+
 #include "kdl_cp/chainfksolverpos_recursive.hpp"
 #include "kdl_cp/chainiksolverpos_nr_jl.hpp"
 #include "kdl_cp/chainiksolvervel_pinv.hpp"
@@ -220,39 +222,45 @@ void Robot6Axis::Restore(XMLReader& reader)
     calcTcp();
 }
 
-bool Robot6Axis::setTo(const Placement& To)
+Robot6Axis::Solver::Solver(const Robot6Axis& Rob)
+    : FkSolver(Rob.Kinematic)     // Forward position solver
+    , IkSolverVel(Rob.Kinematic)  // Inverse velocity solver
+    , IkSolver(Rob.Kinematic,
+               Rob.Min,
+               Rob.Max,
+               FkSolver,
+               IkSolverVel,
+               100,
+               1e-6)  // Maximum 100 iterations, stop at accuracy 1e-6
+    , Joints(Rob.Actual)
+    , Result(Rob.Kinematic.getNrOfJoints())
+{
+    std::copy(Rob.RotDir, Rob.RotDir + 6, RotDir);
+}
+
+bool Robot6Axis::Solver::solve(const Placement& To)
 {
-    // Creation of the solvers:
-    ChainFkSolverPos_recursive fksolver1(Kinematic);  // Forward position solver
-    ChainIkSolverVel_pinv iksolver1v(Kinematic);      // Inverse velocity solver
-    ChainIkSolverPos_NR_JL iksolver1(Kinematic,
-                                     Min,
-                                     Max,
-                                     fksolver1,
-                                     iksolver1v,
-                                     100,
-                                     1e-6);  // Maximum 100 iterations, stop at accuracy 1e-6
-
-    // Creation of jntarrays:
-    JntArray result(Kinematic.getNrOfJoints());
-
-    // Set destination frame
-    Frame F_dest =
-        Frame(KDL::Rotation::Quaternion(To.getRotation()[0],
-                                        To.getRotation()[1],
-                                        To.getRotation()[2],
-                                        To.getRotation()[3]),
-              KDL::Vector(To.getPosition()[0], To.getPosition()[1], To.getPosition()[2]));
-
-    // solve
-    if (iksolver1.CartToJnt(Actual, F_dest, result) < 0) {
+    if (IkSolver.CartToJnt(Joints, toFrame(To), Result) < 0) {
         return false;
     }
-    else {
-        Actual = result;
-        Tcp = F_dest;
-        return true;
+    Joints = Result;
+    return true;
+}
+
+double Robot6Axis::Solver::getAxis(int Axis) const
+{
+    return RotDir[Axis] * Base::toDegrees<double>(Joints(Axis));
+}
+
+bool Robot6Axis::setTo(const Placement& To)
+{
+    Solver solver(*this);
+    if (!solver.solve(To)) {
+        return false;
     }
+    Actual = solver.getJoints();
+    Tcp = toFrame(To);
+    return true;
 }
 
 Base::Placement Robot6Axis::getTcp()
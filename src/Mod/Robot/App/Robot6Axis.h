@@ -24,6 +24,9 @@
 #define ROBOT_ROBOT6AXLE_H
 
 #include "kdl_cp/chain.hpp"
+#include "kdl_cp/chainfksolverpos_recursive.hpp"
+#include "kdl_cp/chainiksolverpos_nr_jl.hpp"
+#include "kdl_cp/chainiksolvervel_pinv.hpp"
 #include "kdl_cp/jntarray.hpp"
 #include <Base/Persistence.h>
 #include <Base/Placement.h>
@@ -54,6 +57,41 @@ class RobotExport Robot6Axis: public Base::Persistence
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
 
 public:
+    /** The inverse kinematic of a robot for solving many positions
+     * The solvers copy the kinematic chain, so they are set up once and not for every position.
+     * Every solution starts from the last one, which makes the solutions of the positions along
+     * a trajectory fast and steady. A solver must only be used by one thread at a time.
+     */
+    class RobotExport Solver
+    {
+    public:
+        /// starts with the actual axis angles of \a Rob
+        explicit Solver(const Robot6Axis& Rob);
+        Solver(const Solver&) = delete;
+        Solver& operator=(const Solver&) = delete;
+
+        /// calculates the axis for that position, they are kept if it can't be reached
+        bool solve(const Base::Placement& To);
+        /// the axis angle in degree like Robot6Axis::getAxis()
+        double getAxis(int Axis) const;
+        const KDL::JntArray& getJoints() const
+        {
+            return Joints;
+        }
+        void setJoints(const KDL::JntArray& Jnt)
+        {
+            Joints = Jnt;
+        }
+
+    private:
+        KDL::ChainFkSolverPos_recursive FkSolver;
+        KDL::ChainIkSolverVel_pinv IkSolverVel;
+        KDL::ChainIkSolverPos_NR_JL IkSolver;
+        KDL::JntArray Joints;
+        KDL::JntArray Result;
+        double RotDir[6];
+    };
+
     Robot6Axis();
 
     // from base class
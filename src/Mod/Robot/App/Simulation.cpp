@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <OSD_Parallel.hxx>
+#endif
 
 #include "Simulation.h"
 
@@ -95,3 +98,76 @@ void Simulation::reset()
     Axis[4] = Rob.getAxis(4);
     Axis[5] = Rob.getAxis(5);
 }
+
+void Simulation::solve(Robot6Axis::Solver& solver, const Base::Placement& Pos, Sample& sample) const
+{
+    sample.reachable = solver.solve(Pos * Tool.inverse());
+    for (int i = 0; i < 6; i++) {
+        sample.axis[i] = solver.getAxis(i);
+    }
+}
+
+std::vector<Simulation::Sample> Simulation::evaluate(const std::vector<double>& times) const
+{
+    std::vector<Base::Placement> positions = Trac.getPositions(times);
+    std::vector<Sample> samples(times.size());
+    Robot6Axis::Solver solver(Rob);
+    for (std::size_t i = 0; i < times.size(); i++) {
+        samples[i].time = times[i];
+        solve(solver, positions[i], samples[i]);
+    }
+    return samples;
+}
+
+std::vector<Simulation::Sample> Simulation::scan(double tick) const
+{
+    double duration = Trac.getDuration();
+    if (tick <= 0.0 || Trac.getSegmentCount() == 0) {
+        return {};
+    }
+
+    std::vector<double> times;
+    for (std::size_t i = 0; double(i) * tick < duration; i++) {
+        times.push_back(double(i) * tick);
+    }
+    times.push_back(duration);
+    // the trajectory is evaluated in one go, its paths cache the last lookup and can't be shared
+    std::vector<Base::Placement> positions = Trac.getPositions(times);
+
+    // the index of the first time of every move, the last time belongs to the last move
+    std::vector<std::size_t> starts;
+    double end = 0.0;
+    for (unsigned int n = 0, i = 0; n < Trac.getSegmentCount() && i < times.size(); n++) {
+        end += Trac.getDuration(n);
+        if (times[i] < end || n + 1 == Trac.getSegmentCount()) {
+            starts.push_back(i);
+        }
+        while (i < times.size() && times[i] < end) {
+            i++;
+        }
+    }
+    starts.push_back(times.size());
+
+    std::vector<Sample> samples(times.size());
+    for (std::size_t i = 0; i < times.size(); i++) {
+        samples[i].time = times[i];
+    }
+
+    // the start of each move is the start for the rest of it
+    std::size_t numMoves = starts.size() - 1;
+    std::vector<KDL::JntArray> joints(numMoves);
+    Robot6Axis::Solver solver(Rob);
+    for (std::size_t n = 0; n < numMoves; n++) {
+        solve(solver, positions[starts[n]], samples[starts[n]]);
+        joints[n] = solver.getJoints();
+    }
+
+    OSD_Parallel::For(0, int(numMoves), [&](int n) {
+        Robot6Axis::Solver moveSolver(Rob);
+        moveSolver.setJoints(joints[n]);
+        for (std::size_t i = starts[n] + 1; i < starts[n + 1]; i++) {
+            solve(moveSolver, positions[i], samples[i]);
+        }
+    });
+    return samples;
+}
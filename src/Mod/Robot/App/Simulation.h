@@ -23,6 +23,8 @@
 #ifndef _Simulation_h_
 #define _Simulation_h_
 
+#include <vector>
+
 #include <Base/Placement.h>
 
 #include "Robot6Axis.h"
@@ -38,6 +40,15 @@ class RobotExport Simulation
 {
 
 public:
+    /// The robot axis at a time of the trajectory
+    struct Sample
+    {
+        double time;
+        /// in degree like Robot6Axis::getAxis(), the axis of the sample before if not reachable
+        double axis[6];
+        bool reachable;
+    };
+
     /// Constructor
     Simulation(const Trajectory& Trac, Robot6Axis& Rob);
     virtual ~Simulation();
@@ -66,6 +77,17 @@ public:
     // apply the start axis angles and set to time 0. Restores the exact start position
     void reset();
 
+    /** Calculates the axis at the given ascending times without moving the robot
+     * Each time starts from the solution of the time before and the first one from the actual
+     * axis of the robot, which gives the same axis as calling setToTime() for each time.
+     */
+    std::vector<Sample> evaluate(const std::vector<double>& times) const;
+    /** Calculates the axis along the whole trajectory every tick seconds, e.g. to check if it
+     * can be reached. The start of every move is solved from the start of the move before, then
+     * the rest of the moves are solved in parallel.
+     */
+    std::vector<Sample> scan(double tick) const;
+
     double Pos {0.0};
     double Axis[6] {};
     double startAxis[6] {};
@@ -73,6 +95,9 @@ public:
     Trajectory Trac;
     Robot6Axis& Rob;
     Base::Placement Tool;
+
+protected:
+    void solve(Robot6Axis::Solver& solver, const Base::Placement& Pos, Sample& sample) const;
 };
 
 
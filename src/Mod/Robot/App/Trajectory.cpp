@@ -126,6 +126,52 @@ Placement Trajectory::getPosition(double time) const
     return {};
 }
 
+std::vector<Placement> Trajectory::getPositions(const std::vector<double>& times) const
+{
+    if (!pcTrajectory || pcTrajectory->GetNrOfSegments() == 0) {
+        return std::vector<Placement>(times.size());
+    }
+
+    // the same lookup as KDL::Trajectory_Composite::Pos(), which starts with the first segment
+    // for every time, here it goes on from the segment of the time before
+    std::vector<Placement> positions;
+    positions.reserve(times.size());
+    unsigned int count = pcTrajectory->GetNrOfSegments();
+    unsigned int index = 0;
+    double start = 0.0;
+    double end = pcTrajectory->Get(0)->Duration();
+    for (double time : times) {
+        if (time < start) {
+            index = 0;
+            start = 0.0;
+            end = pcTrajectory->Get(0)->Duration();
+        }
+        while (index < count && time >= end) {
+            start = end;
+            if (++index < count) {
+                end += pcTrajectory->Get(index)->Duration();
+            }
+        }
+
+        if (time < 0) {
+            positions.push_back(toPlacement(pcTrajectory->Get(0)->Pos(0)));
+        }
+        else if (index < count) {
+            positions.push_back(toPlacement(pcTrajectory->Get(index)->Pos(time - start)));
+        }
+        else {
+            KDL::Trajectory* last = pcTrajectory->Get(count - 1);
+            positions.push_back(toPlacement(last->Pos(last->Duration())));
+        }
+    }
+    return positions;
+}
+
+unsigned int Trajectory::getSegmentCount() const
+{
+    return pcTrajectory ? pcTrajectory->GetNrOfSegments() : 0;
+}
+
 double Trajectory::getVelocity(double time) const
 {
     if (pcTrajectory) {
@@ -82,6 +82,10 @@ public:
     /// return the duration (s) of the Trajectory if -1 or of the Waypoint with the given number
     double getDuration(int n = -1) const;
     Base::Placement getPosition(double time) const;
+    /// return the positions at the given ascending times, faster than getPosition() for each time
+    std::vector<Base::Placement> getPositions(const std::vector<double>& times) const;
+    /// return the number of the moves the Trajectory is made of
+    unsigned int getSegmentCount() const;
     double getVelocity(double time) const;
 
 
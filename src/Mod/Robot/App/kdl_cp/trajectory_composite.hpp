@@ -59,6 +59,7 @@ class Trajectory_Composite: public Trajectory
         
         // access the single members
         Trajectory *Get(unsigned int n){return vt[n];} // FreeCAD change
+        unsigned int GetNrOfSegments() const {return vt.size();} // FreeCAD change
 
 		virtual ~Trajectory_Composite();
 	};
@@ -4582,10 +4582,19 @@ int Sketch::solve()
     Base::TimeElapsed end_time;
 
     if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
-
-        Base::Console().log("Sketcher::Solve()-%s-T:%s\n",
-                            solvername.c_str(),
-                            Base::TimeElapsed::diffTime(start_time, end_time).c_str());
+        if (isInitMove) {
+            // while dragging only the subsystems affected by the move are solved again
+            Base::Console().log("Sketcher::Solve()-%s-T:%s (drag, %d of %d subsystems solved)\n",
+                                solvername.c_str(),
+                                Base::TimeElapsed::diffTime(start_time, end_time).c_str(),
+                                GCSsys.solvedSubsystemsNumber(),
+                                GCSsys.subsystemsNumber());
+        }
+        else {
+            Base::Console().log("Sketcher::Solve()-%s-T:%s\n",
+                                solvername.c_str(),
+                                Base::TimeElapsed::diffTime(start_time, end_time).c_str());
+        }
     }
 
     SolveTime = Base::TimeElapsed::diffTimeF(start_time, end_time);
@@ -4604,6 +4613,9 @@ int Sketch::internalSolve(std::string& solvername, int level)
     bool valid_solution;
     int defaultsoltype = -1;
 
+    // the subsystems that are not affected by a drag need to be solved only once
+    GCSsys.setIncrementalSolve(isInitMove);
+
     if (isInitMove) {
         solvername = "DogLeg";  // DogLeg is used for dragging (same as before)
         ret = GCSsys.solve(isFine, GCS::DogLeg);
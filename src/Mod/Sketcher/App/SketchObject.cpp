@@ -24,8 +24,14 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <future>
 #include <limits>
+#include <numeric>
+#include <optional>
+#include <thread>
 #include <vector>
 
 #include <BRepAdaptor_Curve.hxx>
@@ -38,12 +44,15 @@
 #include <BRepOffsetAPI_NormalProjection.hxx>
 #include <BRepTools_WireExplorer.hxx>
 #include <BRep_Tool.hxx>
+#include <BndLib_Add3dCurve.hxx>
+#include <Bnd_Box.hxx>
 #include <ElCLib.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
 #include <GC_MakeArcOfCircle.hxx>
 #include <GC_MakeCircle.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <GeomAdaptor_Curve.hxx>
 #include <GeomConvert_BSplineCurveKnotSplitting.hxx>
 #include <GeomLProp_CLProps.hxx>
 #include <Geom_BSplineCurve.hxx>
@@ -174,6 +183,11 @@ SketchObject::SketchObject() : geoLastId(0)
                       "Internal Geometry",
                       App::Prop_None,
                       "Make internal geometry, e.g. split intersecting edges, face of closed wires.");
+    ADD_PROPERTY_TYPE(SolverFingerprint,
+                      (""),
+                      "Sketch",
+                      (App::PropertyType)(App::Prop_Output | App::Prop_ReadOnly | App::Prop_Hidden),
+                      "Fingerprint and DoF of the last clean solve, lets restoring skip the solver");
 
     Geometry.setOrderRelevant(true);
 
@@ -193,6 +207,7 @@ SketchObject::SketchObject() : geoLastId(0)
     lastSolveTime = 0;
 
     solverNeedsUpdate = false;
+    solverStateRestored = false;
 
     noRecomputes = false;
 
@@ -283,8 +298,12 @@ App::DocumentObjectExecReturn* SketchObject::execute()
     }
 
     // This includes a regular solve including full geometry update, except when an error
-    // ensues
-    int err = this->solve(true);
+    // ensues. A sketch restored with a matching fingerprint is already solved, the solve is
+    // deferred until the first edit.
+    int err = 0;
+    if (!solverStateRestored || !restoreSolverState()) {
+        err = this->solve(true);
+    }
 
     if (err == -4) {// over-constrained sketch
         std::string msg = "Over-constrained sketch\n";
@@ -351,8 +370,16 @@ void SketchObject::buildShape()
         }
     };
 
-    // get the geometry after running the solver
-    auto geometries = solvedSketch.extractGeometry();
+    // get the geometry after running the solver, or the restored one if the solve was skipped
+    std::vector<Part::Geometry*> geometries;
+    if (solverStateRestored) {
+        for (auto geo : getInternalGeometry()) {
+            geometries.push_back(geo->clone());
+        }
+    }
+    else {
+        geometries = solvedSketch.extractGeometry();
+    }
     for (auto geo : geometries) {
         ++geoId;
         if (GeometryFacade::getConstruction(geo)) {
@@ -524,11 +551,79 @@ void SketchObject::retrieveSolverDiagnostics()
     lastMalformedConstraints = solvedSketch.getMalformedConstraints();
 }
 
+std::string SketchObject::computeSolverFingerprint() const
+{
+    // the persisted form is what a restored sketch is compared with, so hash exactly that
+    Base::StringWriter writer;
+    Geometry.Save(writer);
+    Constraints.Save(writer);
+    ExternalGeo.Save(writer);
+    // FNV-1a, the value is saved with the document, so it must be the same on every platform
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : writer.getString()) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    std::ostringstream str;
+    str << std::hex << hash;
+    return str.str();
+}
+
+void SketchObject::updateSolverFingerprint(bool solved)
+{
+    std::string fingerprint;
+    if (solved) {
+        fingerprint = computeSolverFingerprint() + ":" + std::to_string(lastDoF);
+    }
+    if (SolverFingerprint.getStrValue() != fingerprint) {
+        SolverFingerprint.setValue(fingerprint);
+    }
+}
+
+bool SketchObject::restoreSolverState()
+{
+    solverStateRestored = false;
+    const std::string& stored = SolverFingerprint.getStrValue();
+    auto pos = stored.find(':');
+    if (pos == std::string::npos || stored.compare(0, pos, computeSolverFingerprint()) != 0) {
+        return false;
+    }
+
+    // only clean solves are stored, so there is nothing to diagnose
+    lastDoF = std::atoi(stored.c_str() + pos + 1);
+    lastHasConflict = false;
+    lastHasRedundancies = false;
+    lastHasPartialRedundancies = false;
+    lastHasMalformedConstraints = false;
+    lastConflicting.clear();
+    lastRedundant.clear();
+    lastPartiallyRedundant.clear();
+    lastMalformedConstraints.clear();
+    lastSolverStatus = 0;
+    // the solver is set up on the first drag, the first solve() does it for any other edit
+    solverNeedsUpdate = true;
+    solverStateRestored = true;
+    return true;
+}
+
+void SketchObject::setUpSolver()
+{
+    lastDoF = solvedSketch.setUpSketch(
+        getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
+
+    retrieveSolverDiagnostics();
+
+    solverNeedsUpdate = false;
+    solverStateRestored = false;
+}
+
 int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
 {
     // no need to check input data validity as this is an sketchobject managed operation.
     Base::StateLocker lock(managedoperation, true);
 
+    solverStateRestored = false;
+
     // Reset the initial movement in case of a dragging operation was ongoing on the solver.
     solvedSketch.resetInitMove();
 
@@ -616,6 +711,7 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
             }
         }
     }
+    updateSolverFingerprint(err == 0 && updateGeoAfterSolving && !lastHasPartialRedundancies);
 
     signalSolverUpdate();
 
@@ -730,6 +826,77 @@ public:
     }
 };
 
+class SketchObject::GeometryIndex
+{
+private:
+    using Point = bg::model::point<double, 2, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, int>;
+
+    std::vector<std::optional<Box>> boxes;
+    // curves without a finite box are tested against everything
+    std::vector<int> unbounded;
+    bgi::rtree<Value, bgi::linear<16>> rtree;
+
+    static std::optional<Box> curveBox(const Part::Geometry* geo)
+    {
+        Handle(Geom_Curve) curve = Handle(Geom_Curve)::DownCast(geo->handle());
+        if (curve.IsNull()) {
+            return std::nullopt;
+        }
+        Bnd_Box bnd;
+        try {
+            BndLib_Add3dCurve::Add(GeomAdaptor_Curve(curve), Precision::Confusion(), bnd);
+        }
+        catch (Standard_Failure&) {
+            return std::nullopt;
+        }
+        if (bnd.IsVoid() || bnd.IsOpen()) {
+            return std::nullopt;
+        }
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        bnd.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        return Box(Point(xmin, ymin), Point(xmax, ymax));
+    }
+
+public:
+    explicit GeometryIndex(const std::vector<Part::Geometry*>& geos)
+    {
+        std::vector<Value> values;
+        boxes.reserve(geos.size());
+        for (int i = 0; i < int(geos.size()); ++i) {
+            boxes.push_back(curveBox(geos[i]));
+            if (boxes.back()) {
+                values.emplace_back(*boxes.back(), i);
+            }
+            else if (geos[i]->isDerivedFrom<Part::GeomCurve>()) {
+                unbounded.push_back(i);
+            }
+        }
+        // bulk loading packs the tree better than inserting one by one
+        rtree = bgi::rtree<Value, bgi::linear<16>>(values);
+    }
+
+    /// Indexes of the curves that may intersect the curve at \a index, in ascending order
+    std::vector<int> query(int index) const
+    {
+        std::vector<int> result;
+        if (index < 0 || index >= int(boxes.size()) || !boxes[index]) {
+            result.resize(boxes.size());
+            std::iota(result.begin(), result.end(), 0);
+            return result;
+        }
+        std::vector<Value> values;
+        rtree.query(bgi::intersects(*boxes[index]), std::back_inserter(values));
+        result = unbounded;
+        for (const auto& value : values) {
+            result.push_back(value.second);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
 void SketchObject::updateGeoHistory() {
     if(!geoHistoryLevel) return;
 
@@ -1393,12 +1560,7 @@ int SketchObject::moveGeometries(const std::vector<GeoElementId>& geoEltIds, con
 
 
     if (updateGeoBeforeMoving || solverNeedsUpdate) {
-        lastDoF = solvedSketch.setUpSketch(
-            getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
-
-        retrieveSolverDiagnostics();
-
-        solverNeedsUpdate = false;
+        setUpSolver();
     }
 
     if (lastDoF < 0)// over-constrained sketch
@@ -3045,6 +3207,13 @@ bool SketchObject::seekTrimPoints(int GeoId,
 
     geos.resize(geos.size() - 2);  // remove the axes to avoid intersections with the axes
 
+    // only the curves whose box overlaps the one of GeoId can cut it. The index is kept until
+    // the geometry changes, so the trim preview does not rebuild it on every mouse move
+    if (!geometryIndex) {
+        geometryIndex = std::make_unique<GeometryIndex>(geos);
+    }
+    std::vector<int> candidates = geometryIndex->query(GeoId);
+
     int localindex1, localindex2;
 
     // Not found in will be returned as -1, not as GeoUndef, Part WB is agnostic to the concept of
@@ -3055,7 +3224,8 @@ bool SketchObject::seekTrimPoints(int GeoId,
                                       localindex1,
                                       intersect1,
                                       localindex2,
-                                      intersect2)) {
+                                      intersect2,
+                                      &candidates)) {
         return false;
     }
 
@@ -8622,6 +8792,18 @@ std::vector<TopoDS_Shape> projectShape(const TopoDS_Shape& inShape, const gp_Ax3
 
 }
 
+SketchObject::ExternalProjectionStats SketchObject::getExternalProjectionStats() const
+{
+    ExternalProjectionStats stats = externalProjectionStats;
+    stats.entries = externalProjections.size();
+    return stats;
+}
+
+void SketchObject::resetExternalProjectionStats()
+{
+    externalProjectionStats = ExternalProjectionStats();
+}
+
 void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd)
 {
     Base::StateLocker lock(managedoperation, true); // no need to check input data validity as this is an sketchobject managed operation.
@@ -8691,26 +8873,54 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
         gp_Pnt(Pos.x, Pos.y, Pos.z), gp_Dir(dN.x, dN.y, dN.z), gp_Dir(dX.x, dX.y, dX.z));
     gp_Pln sketchPlane(sketchAx3);
 
-    Handle(Geom_Plane) gPlane = new Geom_Plane(sketchPlane);
-    BRepBuilderAPI_MakeFace mkFace(sketchPlane);
-    TopoDS_Shape aProjFace = mkFace.Shape();
+    double arcFitTolerance = ArcFitTolerance.getValue();
 
-    std::set<std::string> refSet;
-    // We use a vector here to keep the order (roughly) the same as ExternalGeometry
-    std::vector<std::vector<std::unique_ptr<Part::Geometry> > > newGeos;
-    newGeos.reserve(Objects.size());
+    // The sub-shapes are looked up in order, then the references that aren't
+    // projected yet are projected in parallel
+    struct ExternalRef
+    {
+        std::string key;
+        TopoDS_Shape shape;
+        bool projection = false;
+        bool intersection = false;
+        bool beingCreated = false;
+        bool frozen = false;
+        ExternalProjection* cached = nullptr;
+        ExternalProjection projected;
+        bool failed = false;
+        std::string error;
+    };
+    auto setError = [](ExternalRef& ref) {
+        ref.failed = true;
+        try {
+            throw;
+        } catch (Base::Exception &e) {
+            ref.error = e.what();
+        } catch (Standard_Failure &e) {
+            ref.error = e.GetMessageString();
+        } catch (std::exception &e) {
+            ref.error = e.what();
+        } catch (...) {
+            ref.error = "Unknown exception";
+        }
+    };
+
+    std::vector<ExternalRef> refs;
+    refs.reserve(Objects.size());
     for (int i=0; i < int(Objects.size()); i++) {
         const App::DocumentObject *Obj=Objects[i];
         const std::string &SubElement=SubElements[i];
         const std::string &key = keys[i];
+        int type = i < int(Types.size()) ? Types[i] : 0;
 
-        bool beingCreated = false;
+        ExternalRef ref;
+        ref.key = key;
         if (extToAdd) {
-            beingCreated = extToAdd->obj == Obj && extToAdd->subname == SubElement;
+            ref.beingCreated = extToAdd->obj == Obj && extToAdd->subname == SubElement;
         }
 
-        bool projection = Types[i] == (int)ExtType::Projection || Types[i] == (int)ExtType::Both;
-        bool intersection = Types[i] == (int)ExtType::Intersection || Types[i] == (int)ExtType::Both;
+        ref.projection = type == (int)ExtType::Projection || type == (int)ExtType::Both;
+        ref.intersection = type == (int)ExtType::Intersection || type == (int)ExtType::Both;
 
         // Skip frozen geometries
         bool frozen = false;
@@ -8728,27 +8938,14 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
             }
         }
         if(frozen && !sync) {
-            refSet.insert(std::move(key));
+            ref.frozen = true;
+            refs.push_back(std::move(ref));
             continue;
         }
         if (!Obj || !Obj->getNameInDocument()) {
             continue;
         }
 
-        std::vector<std::unique_ptr<Part::Geometry> > geos;
-
-        auto importVertex = [&](const TopoDS_Shape& refSubShape) {
-            gp_Pnt P = BRep_Tool::Pnt(TopoDS::Vertex(refSubShape));
-            GeomAPI_ProjectPointOnSurf proj(P, gPlane);
-            P = proj.NearestPoint();
-            Base::Vector3d p(P.X(), P.Y(), P.Z());
-            invPlm.multVec(p, p);
-
-            Part::GeomPoint* point = new Part::GeomPoint(p);
-            GeometryFacade::setConstruction(point, true);
-            geos.emplace_back(point);
-        };
-
         try {
             TopoDS_Shape refSubShape;
 
@@ -8811,10 +9008,54 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                     "Datum feature type is not yet supported as external geometry for a sketch");
             }
 
-            if (projection) {
-                switch (refSubShape.ShapeType()) {
+            ref.shape = refSubShape;
+        } catch (...) {
+            setError(ref);
+            refs.push_back(std::move(ref));
+            continue;
+        }
+
+        // the projection is kept as long as the sub-shape and the sketch plane stay
+        auto it = externalProjections.find(key);
+        if (it != externalProjections.end() && it->second.type == type
+            && it->second.shape.IsEqual(ref.shape) && it->second.placement == Plm
+            && it->second.arcFitTolerance == arcFitTolerance) {
+            ref.cached = &it->second;
+        }
+        else {
+            ref.projected.shape = ref.shape;
+            ref.projected.type = type;
+            ref.projected.placement = Plm;
+            ref.projected.arcFitTolerance = arcFitTolerance;
+        }
+        refs.push_back(std::move(ref));
+    }
+
+    auto project = [&](ExternalRef& ref) {
+        // the algorithms don't share their input with the other threads
+        Handle(Geom_Plane) gPlane = new Geom_Plane(sketchPlane);
+        BRepBuilderAPI_MakeFace mkFace(sketchPlane);
+        TopoDS_Shape aProjFace = mkFace.Shape();
+        gp_Ax3 ax3 = sketchAx3;
+        auto& geos = ref.projected.geos;
+
+        auto importVertex = [&](const TopoDS_Shape& refSubShape) {
+            gp_Pnt P = BRep_Tool::Pnt(TopoDS::Vertex(refSubShape));
+            GeomAPI_ProjectPointOnSurf proj(P, gPlane);
+            P = proj.NearestPoint();
+            Base::Vector3d p(P.X(), P.Y(), P.Z());
+            invPlm.multVec(p, p);
+
+            Part::GeomPoint* point = new Part::GeomPoint(p);
+            GeometryFacade::setConstruction(point, true);
+            geos.emplace_back(point);
+        };
+
+        try {
+            if (ref.projection) {
+                switch (ref.shape.ShapeType()) {
                 case TopAbs_FACE: {
-                    const TopoDS_Face& face = TopoDS::Face(refSubShape);
+                    const TopoDS_Face& face = TopoDS::Face(ref.shape);
                     BRepAdaptor_Surface surface(face);
                     if (surface.GetType() == GeomAbs_Plane) {
                         // Check that the plane is perpendicular to the sketch plane
@@ -8827,7 +9068,7 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                         for (edgeExp.Init(face, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
                             TopoDS_Edge edge = TopoDS::Edge(edgeExp.Current());
                             // Process each edge
-                            processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, sketchAx3, aProjFace);
+                            processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, ax3, aProjFace);
                         }
 
                         if (fabs(dnormal.Angle(snormal) - std::numbers::pi/2) < Precision::Confusion()) {
@@ -8895,7 +9136,7 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                         }
                     }
                     else {
-                        std::vector<TopoDS_Shape> res = projectShape(face, sketchAx3);
+                        std::vector<TopoDS_Shape> res = projectShape(face, ax3);
                         for (auto& resShape : res) {
                             TopExp_Explorer explorer(resShape, TopAbs_EDGE);
                             while (explorer.More()) {
@@ -8907,28 +9148,22 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                     }
                 } break;
                 case TopAbs_EDGE: {
-                    const TopoDS_Edge& edge = TopoDS::Edge(refSubShape);
-                    processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, sketchAx3, aProjFace);
+                    const TopoDS_Edge& edge = TopoDS::Edge(ref.shape);
+                    processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, ax3, aProjFace);
                 } break;
                 case TopAbs_VERTEX: {
-                    importVertex(refSubShape);
+                    importVertex(ref.shape);
                 } break;
                 default:
                     throw Base::TypeError("Unknown type of geometry");
                     break;
                 }
-                if (beingCreated && !extToAdd->intersection) {
-                    // We are adding the projections, so we need to initialize those
-                    for (auto& geo : geos) {
-                        auto egf = ExternalGeometryFacade::getFacade(geo.get());
-                        egf->setFlag(ExternalGeometryExtension::Defining, extToAdd->defining);
-                    }
-                }
             }
-            int projSize = geos.size();
+            ref.projected.projectedCount = geos.size();
+            ref.projected.intersectionStart = geos.size();
 
-            if (intersection) {
-                FCBRepAlgoAPI_Section maker(refSubShape, sketchPlane);
+            if (ref.intersection) {
+                FCBRepAlgoAPI_Section maker(ref.shape, sketchPlane);
                 maker.Approximation(Standard_True);
                 if (!maker.IsDone())
                     FC_THROWM(Base::CADKernelError, "Failed to get intersection");
@@ -8936,12 +9171,12 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                 auto edges = intersectionShape.getSubTopoShapes(TopAbs_EDGE);
                 for (const auto& s : edges) {
                     TopoDS_Edge edge = TopoDS::Edge(s.getShape());
-                    processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, sketchAx3, aProjFace);
+                    processEdge(edge, geos, gPlane, invPlm, mov, sketchPlane, invRot, ax3, aProjFace);
                 }
                 // Section of some face (e.g. sphere) produce more than one arcs
                 // from the same circle. So we try to fit the arcs with a single
                 // circle/arc.
-                if (refSubShape.ShapeType() == TopAbs_FACE && geos.size() > 1) {
+                if (ref.shape.ShapeType() == TopAbs_FACE && geos.size() > 1) {
                     auto wires = Part::TopoShape().makeElementWires(edges);
                     if (wires.countSubShapes(TopAbs_WIRE) == 1) {
                         TopoDS_Vertex firstVertex, lastVertex;
@@ -8952,42 +9187,79 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                         lastVertex = exp.CurrentVertex();
                         gp_Pnt P1 = BRep_Tool::Pnt(firstVertex);
                         gp_Pnt P2 = BRep_Tool::Pnt(lastVertex);
-                        if (auto geo = fitArcs(geos, P1, P2, ArcFitTolerance.getValue())) {
+                        if (auto geo = fitArcs(geos, P1, P2, arcFitTolerance)) {
                             geos.clear();
                             geos.emplace_back(geo);
+                            ref.projected.projectedCount = 0;
                         }
                     }
                 }
                 for (const auto& s : intersectionShape.getSubShapes(TopAbs_VERTEX, TopAbs_EDGE)) {
                     importVertex(s);
                 }
-
-                if (beingCreated && extToAdd->intersection) {
-                    // We are adding the projections, so we need to initialize those
-                    for (size_t i = projSize; i < geos.size(); ++i) {
-                        auto egf = ExternalGeometryFacade::getFacade(geos[i].get());
-                        egf->setFlag(ExternalGeometryExtension::Defining, extToAdd->defining);
-                    }
-                }
             }
 
-        } catch (Base::Exception &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.what());
-            continue;
-        } catch (Standard_Failure &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.GetMessageString());
-            continue;
-        } catch (std::exception &e) {
-            FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << e.what());
-            continue;
         } catch (...) {
+            setError(ref);
+        }
+    };
+
+    std::vector<ExternalRef*> uncached;
+    for (auto& ref : refs) {
+        if (!ref.frozen && !ref.failed && !ref.cached) {
+            uncached.push_back(&ref);
+        }
+    }
+    // the references are projected independently of each other
+    std::atomic<std::size_t> next(0);
+    auto projectRefs = [&]() {
+        for (std::size_t i = next++; i < uncached.size(); i = next++) {
+            project(*uncached[i]);
+        }
+    };
+    std::size_t threadsNum = std::min<std::size_t>(uncached.size(),
+                                                   std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < threadsNum; ++i) {
+        futures.push_back(std::async(std::launch::async, projectRefs));
+    }
+    projectRefs();
+    for (auto& fut : futures) {
+        fut.get();
+    }
+
+    std::set<std::string> refSet;
+    // We use a vector here to keep the order (roughly) the same as ExternalGeometry
+    std::vector<std::vector<std::unique_ptr<Part::Geometry> > > newGeos;
+    newGeos.reserve(refs.size());
+    for (auto& ref : refs) {
+        const std::string &key = ref.key;
+        if (ref.frozen) {
+            refSet.insert(key);
+            continue;
+        }
+        if (ref.failed) {
             FC_ERR("Failed to project external geometry in "
-                   << getFullName() << ": " << key << std::endl << "Unknown exception");
+                   << getFullName() << ": " << key << std::endl << ref.error);
             continue;
         }
+
+        const ExternalProjection& projection = ref.cached ? *ref.cached : ref.projected;
+        std::vector<std::unique_ptr<Part::Geometry> > geos;
+        geos.reserve(projection.geos.size());
+        for (auto& geo : projection.geos) {
+            geos.emplace_back(geo->clone());
+        }
+        if (ref.beingCreated) {
+            // We are adding the projections, so we need to initialize those
+            std::size_t begin = extToAdd->intersection ? projection.intersectionStart : 0;
+            std::size_t end = extToAdd->intersection ? geos.size()
+                                                     : std::min(projection.projectedCount, geos.size());
+            for (std::size_t i = begin; i < end; ++i) {
+                auto egf = ExternalGeometryFacade::getFacade(geos[i].get());
+                egf->setFlag(ExternalGeometryExtension::Defining, extToAdd->defining);
+            }
+        }
         if (geos.empty()) {
             continue;
         }
@@ -9003,6 +9275,25 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
         newGeos.push_back(std::move(geos));
     }
 
+    // keep the new projections and drop the ones of the removed references
+    for (auto& ref : refs) {
+        if (ref.cached) {
+            ++externalProjectionStats.reused;
+        }
+        else if (!ref.frozen && !ref.failed) {
+            ++externalProjectionStats.projected;
+            externalProjections[ref.key] = std::move(ref.projected);
+        }
+    }
+    for (auto it = externalProjections.begin(); it != externalProjections.end();) {
+        if (refSet.count(it->first)) {
+            ++it;
+        }
+        else {
+            it = externalProjections.erase(it);
+        }
+    }
+
     // allocate unique geometry id
     for(auto &geos : newGeos) {
         auto egf = ExternalGeometryFacade::getFacade(geos.front().get());
@@ -9899,6 +10190,10 @@ static inline bool checkMigration(Part::PropertyGeometryList &prop)
 
 void SketchObject::onChanged(const App::Property* prop)
 {
+    if (prop == &Geometry || prop == &ExternalGeo) {
+        geometryIndex.reset();
+    }
+
     if (prop == &Geometry) {
         if (isRestoring() && checkMigration(Geometry)) {
             // Construction migration to extension
@@ -10423,10 +10718,13 @@ void SketchObject::onSketchRestore()
             acceptGeometry();
 
         synchroniseGeometryState();
+        restoreSolverState();
         // this may happen when saving a sketch directly in edit mode
         // but never performed a recompute before
         if (Shape.getValue().IsNull() && hasConflicts() == 0) {
-            if (this->solve(true) == 0)
+            if (solverStateRestored)
+                buildShape();
+            else if (this->solve(true) == 0)
                 Shape.setValue(solvedSketch.toShape());
         }
 
@@ -11031,6 +11329,11 @@ SketchObject::getHigherElements(const char *element, bool silent) const
 {
     std::vector<Data::IndexedName> res;
         if (boost::istarts_with(element, "vertex")) {
+            // the solver numbers the points, a sketch restored with a matching fingerprint
+            // hasn't set it up yet
+            if (solverNeedsUpdate) {
+                const_cast<SketchObject*>(this)->setUpSolver();
+            }
             int n = 0;
             int index = atoi(element+6);
             for (auto cstr : Constraints.getValues()) {
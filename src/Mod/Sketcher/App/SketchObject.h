@@ -90,6 +90,7 @@ public:
     Part ::PropertyPartShape InternalShape;
     App ::PropertyPrecision InternalTolerance;
     App ::PropertyBool MakeInternals;
+    App ::PropertyString SolverFingerprint;
     /** @name methods override Feature */
     //@{
     short mustExecute() const override;
@@ -254,6 +255,16 @@ public:
     // It uses std::optional because this function is actually used to both recompute external
     // geometries but also to add new external geometries. Ideally this should be refactored.
     void rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd = std::nullopt);
+    /// How often rebuildExternalGeometry() reused or computed the projection of a reference
+    struct ExternalProjectionStats
+    {
+        std::uint64_t reused {0};
+        std::uint64_t projected {0};
+        /// The projections kept for the next rebuild
+        std::size_t entries {0};
+    };
+    ExternalProjectionStats getExternalProjectionStats() const;
+    void resetExternalProjectionStats();
     /// returns the number of external Geometry entities
     int getExternalGeometryCount() const
     {
@@ -977,6 +988,15 @@ protected:
     // retrieves redundant, conflicting and malformed constraint information from the solver
     void retrieveSolverDiagnostics();
 
+    // hash of the geometry, constraints and external geometry the solver state depends on
+    std::string computeSolverFingerprint() const;
+    // stores the fingerprint after a clean solve, so that restoring can skip the solver
+    void updateSolverFingerprint(bool solved);
+    // on restore, takes the persisted solver state over if the fingerprint still matches
+    bool restoreSolverState();
+    // sets the solver up with the current geometry and constraints without solving
+    void setUpSolver();
+
     // retrieves whether a geometry blocked state corresponds to this constraint
     // returns true of the constraint is of Block type, false otherwise
     bool getBlockedState(const Constraint* cstr, bool& blockedstate) const;
@@ -1034,6 +1054,12 @@ private:
     */
     bool solverNeedsUpdate;
 
+    /** this internal flag indicates that the sketch was restored from a matching solver
+       fingerprint and was not solved since, so the solver holds no geometry yet and the
+       geometry of the SketchObject is the solved one.
+    */
+    bool solverStateRestored;
+
     int lastDoF;
     bool lastHasConflict;
     bool lastHasRedundancies;
@@ -1085,6 +1111,23 @@ private:
     // backup of ExternalGeometry in case of element reference change
     std::vector<std::string> externalGeoRef;
 
+    // projection of an external reference onto the sketch plane
+    struct ExternalProjection
+    {
+        TopoDS_Shape shape;
+        Base::Placement placement;
+        int type = 0;
+        double arcFitTolerance = 0.0;
+        std::vector<std::unique_ptr<Part::Geometry>> geos;
+        // geos[0, projectedCount) are projections, the intersections start at intersectionStart
+        std::size_t projectedCount = 0;
+        std::size_t intersectionStart = 0;
+    };
+    // the projections of rebuildExternalGeometry() by their reference, they are
+    // projected again once the sub-shape or the placement of the sketch changes
+    std::map<std::string, ExternalProjection> externalProjections;
+    ExternalProjectionStats externalProjectionStats;
+
     // mapping from ExternalGeo[*].Id to index of ExternalGeo
     std::map<long, int> externalGeoMap;
 
@@ -1099,6 +1142,10 @@ private:
     class GeoHistory;
     std::unique_ptr<GeoHistory> geoHistory;
 
+    // bounding boxes of the complete geometry, built on demand and dropped on any change of it
+    class GeometryIndex;
+    std::unique_ptr<GeometryIndex> geometryIndex;
+
     mutable std::map<std::string, std::string> internalElementMap;
 };
 
@@ -47,10 +47,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <numbers>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -471,6 +474,8 @@ System::System()
     , hasDiagnosis(false)
     , isInit(false)
     , emptyDiagnoseMatrix(true)
+    , incrementalSolve(false)
+    , solvedSubsystems(0)
     , maxIter(100)
     , maxIterRedundant(100)
     , sketchSizeMultiplier(false)
@@ -479,6 +484,7 @@ System::System()
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
     , dogLegGaussStep(FullPivLU)
+    , sparseSolverThreshold(200)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
     , LM_eps(1E-10)
@@ -1978,17 +1984,33 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     // return success by default in order to permit coincidence constraints to be applied
     // even if no other system has to be solved
     int res = Success;
+    solvedSubsystems = 0;
+    if (incrementalSolve) {
+        solvedComponents.resize(subSystems.size(), false);
+    }
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
         if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
             resetToReference();
             isReset = true;
         }
+        // a component without temporary constraints gives the same solution every time
+        bool cacheable = incrementalSolve && subSystems[cid] && !subSystemsAux[cid];
+        if (cacheable && solvedComponents[cid]) {
+            continue;
+        }
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            ++solvedSubsystems;
+        }
         if (subSystems[cid] && subSystemsAux[cid]) {
             res = std::max(res,
                            solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            int ret = solve(subSystems[cid], isFine, alg, isRedundantsolving);
+            if (cacheable && ret == Success) {
+                solvedComponents[cid] = true;
+            }
+            res = std::max(res, ret);
         }
         else if (subSystemsAux[cid]) {
             res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
@@ -2155,8 +2177,95 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// Solve the augmented normal equations A*h = g of the LevenbergMarquardt solver
+void solveNormalEquations(const Eigen::MatrixXd& A, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+{
+    h = A.fullPivLu().solve(g);
+}
+
+// Get the Gauss-Newton step of the DogLeg solver
+void gaussNewtonStep(const Eigen::MatrixXd& J,
+                     const Eigen::VectorXd& fx,
+                     DogLegGaussStep method,
+                     Eigen::VectorXd& h_gn)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (method) {
+        case FullPivLU:
+            h_gn = J.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h_gn = J.adjoint() * (J * J.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h_gn = J.adjoint() * (J * J.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+void solveNormalEquations(const Eigen::SparseMatrix<double>& A,
+                          const Eigen::VectorXd& g,
+                          Eigen::VectorXd& h)
+{
+    // with the damping A is symmetric positive definite
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(A);
+    if (ldlt.info() == Eigen::Success) {
+        h = ldlt.solve(g);
+    }
+    else {
+        h = Eigen::MatrixXd(A).fullPivLu().solve(g);
+    }
+}
+
+void gaussNewtonStep(const Eigen::SparseMatrix<double>& J,
+                     const Eigen::VectorXd& fx,
+                     DogLegGaussStep method,
+                     Eigen::VectorXd& h_gn)
+{
+    // The least norm step, like LeastNormLdlt. If J J^T is singular the dense
+    // decomposition of the selected method is used instead.
+    Eigen::SparseMatrix<double> JJt = J * J.transpose();
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(JJt);
+    if (ldlt.info() == Eigen::Success) {
+        Eigen::VectorXd y = ldlt.solve(-fx);
+        if (ldlt.info() == Eigen::Success) {
+            h_gn = J.transpose() * y;
+            return;
+        }
+    }
+    gaussNewtonStep(Eigen::MatrixXd(J), fx, method, h_gn);
+}
+#endif
+
+}  // namespace
+
+bool System::useSparseSolver([[maybe_unused]] SubSystem* subsys) const
+{
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    return sparseSolverThreshold >= 0 && subsys->pSize() >= sparseSolverThreshold;
+#else
+    return false;
+#endif
+}
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (useSparseSolver(subsys)) {
+        return solve_LM_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename Jacobian>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2170,8 +2279,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    Jacobian J(csize, xsize);  // Jacobi of the subsystem
+    Jacobian A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2249,11 +2358,11 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         while (k < 50) {
             // augment normal equations A = A+uI
             for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
+                A.coeffRef(i, i) += mu;
             }
 
             // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            solveNormalEquations(A, g, h);
             double rel_error = (A * h - g).norm() / g.norm();
 
             // check if solving works
@@ -2305,7 +2414,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
             mu *= nu;
             nu *= 2.0;
             for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
+                A.coeffRef(i, i) = diag_A(i);
             }
 
             k++;
@@ -2337,6 +2446,17 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (useSparseSolver(subsys)) {
+        return solve_DL_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename Jacobian>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2380,7 +2500,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Jacobian Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2432,19 +2552,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        gaussNewtonStep(Jx, fx, dogLegGaussStep, h_gn);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -5475,6 +5583,111 @@ void System::identifyDependentGeometryParametersInTransposedJacobianDenseQRDecom
     }
 }
 
+int System::solveDecoupled(std::vector<Constraint*>& clist_,
+                           VEC_pD& params,
+                           Algorithm alg,
+                           bool isRedundantsolving)
+{
+    MAP_pD_I index;
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        index[params[i]] = int(i);
+    }
+
+    Graph g;
+    for (std::size_t i = 0; i < params.size() + clist_.size(); ++i) {
+        boost::add_vertex(g);
+    }
+
+    int cvtid = int(params.size());
+    for (const auto constr : clist_) {
+        for (const auto param : c2p[constr]) {
+            auto it = index.find(param);
+            if (it != index.end()) {
+                boost::add_edge(cvtid, it->second, g);
+            }
+        }
+        ++cvtid;
+    }
+
+    VEC_I components(boost::num_vertices(g));
+    int componentsSize = 0;
+    if (!components.empty()) {
+        componentsSize = boost::connected_components(g, &components[0]);
+    }
+
+    std::vector<VEC_pD> plistsTmp(componentsSize);
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        plistsTmp[components[i]].push_back(params[i]);
+    }
+
+    std::vector<std::vector<Constraint*>> clistsTmp(componentsSize);
+    std::vector<Constraint*> fixedConstrs;  // constraints without any unknown parameter
+    for (std::size_t i = 0; i < clist_.size(); ++i) {
+        int cid = components[params.size() + i];
+        if (plistsTmp[cid].empty()) {
+            fixedConstrs.push_back(clist_[i]);
+        }
+        else {
+            clistsTmp[cid].push_back(clist_[i]);
+        }
+    }
+
+    std::vector<std::unique_ptr<SubSystem>> subsystems;
+    for (int cid = 0; cid < componentsSize; ++cid) {
+        if (!clistsTmp[cid].empty()) {
+            subsystems.push_back(std::make_unique<SubSystem>(clistsTmp[cid], plistsTmp[cid]));
+        }
+    }
+
+    // The components do not share any constraint nor parameter, so that they can be solved
+    // at the same time. Each result is stored at the index of its component, making the
+    // outcome independent of the order in which the threads pick the components.
+    std::vector<int> results(subsystems.size(), Success);
+    std::atomic<std::size_t> next(0);
+    auto solveComponents = [&]() {
+        for (std::size_t i = next++; i < subsystems.size(); i = next++) {
+            results[i] = solve(subsystems[i].get(), true, alg, isRedundantsolving);
+        }
+    };
+
+    // the iteration log of the solvers is not thread-safe
+    std::size_t threadsNum = 1;
+    if (debugMode != IterationLevel) {
+        threadsNum = std::min<std::size_t>(subsystems.size(),
+                                           std::max(1U, std::thread::hardware_concurrency()));
+    }
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < threadsNum; ++i) {
+        futures.push_back(std::async(std::launch::async, solveComponents));
+    }
+    solveComponents();
+    for (auto& fut : futures) {
+        fut.get();
+    }
+
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
+    }
+
+    // an unsatisfied constraint without unknowns makes the whole system unsolvable
+    for (const auto constr : fixedConstrs) {
+        double err = constr->error();
+        if (err * err > (isRedundantsolving ? convergenceRedundant : convergence)) {
+            res = Failed;
+        }
+    }
+
+    if (res == Success) {
+        for (auto& subsys : subsystems) {
+            subsys->applySolution();
+        }
+    }
+
+    return res;
+}
+
 void System::eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank)
 {
     for (int i = 1; i < rank; i++) {
@@ -5625,8 +5838,9 @@ void System::identifyConflictingRedundantConstraints(
         return (constr->isDriving() && skipped.count(constr) == 0);
     });
 
-    SubSystem* subSysTmp = new SubSystem(clistTmp, pdiagnoselist);
-    int res = solve(subSysTmp, true, alg, true);
+    // The trial solution does not depend on how the decoupled components are scheduled, the
+    // redundant constraints are the same as if the whole system was solved at once
+    int res = solveDecoupled(clistTmp, pdiagnoselist, alg, true);
 
     if (debugMode == Minimal || debugMode == IterationLevel) {
         std::string solvername;
@@ -5646,7 +5860,6 @@ void System::identifyConflictingRedundantConstraints(
     }
 
     if (res == Success) {
-        subSysTmp->applySolution();
         std::ranges::copy_if(skipped,
                              std::inserter(redundant, redundant.begin()),
                              [this](const auto& constr) {
@@ -5683,7 +5896,6 @@ void System::identifyConflictingRedundantConstraints(
             constrNum--;
         }
     }
-    delete subSysTmp;
 
     // simplified output of conflicting tags
     SET_I conflictingTagsSet;
@@ -5739,6 +5951,15 @@ void System::clearSubSystems()
     deleteAllContent(subSystemsAux);
     subSystems.clear();
     subSystemsAux.clear();
+    solvedComponents.clear();
+}
+
+void System::setIncrementalSolve(bool on)
+{
+    if (incrementalSolve != on) {
+        incrementalSolve = on;
+        solvedComponents.clear();
+    }
 }
 
 double lineSearch(SubSystem* subsys, Eigen::VectorXd& xdir)
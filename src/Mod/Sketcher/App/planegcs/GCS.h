@@ -124,6 +124,12 @@ private:
     std::vector<SubSystem*> subSystems, subSystemsAux;
     void clearSubSystems();
 
+    // In incremental mode the decoupled components without temporary constraints are
+    // only solved once, their solution is kept in the subsystem for the following solves
+    bool incrementalSolve;
+    std::vector<bool> solvedComponents;
+    int solvedSubsystems;  // number of components solved by the last call of solve()
+
     VEC_D reference;
     void setReference();      // copies the current parameter values to reference
     void resetToReference();  // reverts all parameter values to the stored reference
@@ -146,6 +152,12 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // Jacobian is either a dense Eigen::MatrixXd or an Eigen::SparseMatrix<double>
+    template<typename Jacobian>
+    int solve_LM_impl(SubSystem* subsys, bool isRedundantsolving);
+    template<typename Jacobian>
+    int solve_DL_impl(SubSystem* subsys, bool isRedundantsolving);
+    bool useSparseSolver(SubSystem* subsys) const;
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -192,6 +204,13 @@ private:
 
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
+    // Partitions the constraints into decoupled components and solves them concurrently.
+    // The solution is only applied if every component is solved.
+    int solveDecoupled(std::vector<Constraint*>& clist_,
+                       VEC_pD& params,
+                       Algorithm alg,
+                       bool isRedundantsolving);
+
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
     void identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
                                              const std::map<int, int>& jacobianconstraintmap,
@@ -224,6 +243,9 @@ public:
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
     DogLegGaussStep dogLegGaussStep;
+    // DogLeg and LevenbergMarquardt use sparse matrices for subsystems with at least this many
+    // parameters, a negative value disables the sparse solver path
+    int sparseSolverThreshold;
     double qrpivotThreshold;
     DebugMode debugMode;
     double LM_eps;
@@ -559,6 +581,20 @@ public:
 
     void applySolution();
     void undoSolution();
+    /** Only re-solve the components that contain temporary constraints
+     * Meant for dragging, where only the temporary constraints of the moved
+     * parameters change their values between the solves. The other components
+     * are solved once after initSolution(), their solution is then reused.
+     */
+    void setIncrementalSolve(bool on);
+    int subsystemsNumber() const
+    {
+        return int(subSystems.size());
+    }
+    int solvedSubsystemsNumber() const
+    {
+        return solvedSubsystems;
+    }
     // FIXME: looks like XconvergenceFine is not the solver precision, at least in DogLeg
     // solver.
     //  Note: Yes, every solver has a different way of interpreting precision
@@ -24,8 +24,11 @@
 #pragma warning(disable : 4251)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <numeric>
+#include <set>
 
 #include "SubSystem.h"
 
@@ -116,27 +119,39 @@ void SubSystem::initialize(VEC_pD& params, MAP_pD_pD& reductionmap)
         pmap[itr->first] = &pvals[itr->second];
     }
 
-    c2p.clear();
-    p2c.clear();
-    for (std::vector<Constraint*>::iterator constr = clist.begin(); constr != clist.end();
-         ++constr) {
-        (*constr)->revertParams();  // ensure that the constraint points to the original parameters
-        VEC_pD constr_params_orig = (*constr)->params();
-        SET_pD constr_params;
+    cparams.assign(csize, {});
+    for (int i = 0; i < csize; i++) {
+        Constraint* constr = clist[i];
+        constr->revertParams();  // ensure that the constraint points to the original parameters
+        VEC_pD constr_params_orig = constr->params();
+        std::set<int> constr_params;
         for (VEC_pD::const_iterator p = constr_params_orig.begin(); p != constr_params_orig.end();
              ++p) {
             MAP_pD_pD::const_iterator pmapfind = pmap.find(*p);
             if (pmapfind != pmap.end()) {
-                constr_params.insert(pmapfind->second);
+                constr_params.insert(int(pmapfind->second - pvals.data()));
             }
         }
-        for (SET_pD::const_iterator p = constr_params.begin(); p != constr_params.end(); ++p) {
-            //            jacobi.set(*constr, *p, 0.);
-            c2p[*constr].push_back(*p);
-            p2c[*p].push_back(*constr);
+        cparams[i].assign(constr_params.begin(), constr_params.end());
+    }
+
+    corder.resize(csize);
+    std::iota(corder.begin(), corder.end(), 0);
+    std::stable_sort(corder.begin(), corder.end(), [this](int a, int b) {
+        return clist[a]->getTypeId() < clist[b]->getTypeId();
+    });
+}
+
+std::vector<std::vector<int>> SubSystem::paramColumns(VEC_pD& params)
+{
+    std::vector<std::vector<int>> columns(psize);
+    for (int j = 0; j < int(params.size()); j++) {
+        MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
+        if (pmapfind != pmap.end()) {
+            columns[pmapfind->second - pvals.data()].push_back(j);
         }
-        //        (*constr)->redirectParams(pmap); // redirect parameters to pvec
     }
+    return columns;
 }
 
 void SubSystem::redirectParams()
@@ -224,9 +239,8 @@ void SubSystem::getConstraintList(std::vector<Constraint*>& clist_)
 double SubSystem::error()
 {
     double err = 0.;
-    for (std::vector<Constraint*>::const_iterator constr = clist.begin(); constr != clist.end();
-         ++constr) {
-        double tmp = (*constr)->error();
+    for (int i : corder) {
+        double tmp = clist[i]->error();
         err += tmp * tmp;
     }
     err *= 0.5;
@@ -237,10 +251,8 @@ void SubSystem::calcResidual(Eigen::VectorXd& r)
 {
     assert(r.size() == csize);
 
-    int i = 0;
-    for (std::vector<Constraint*>::const_iterator constr = clist.begin(); constr != clist.end();
-         ++constr, i++) {
-        r[i] = (*constr)->error();
+    for (int i : corder) {
+        r[i] = clist[i]->error();
     }
 }
 
@@ -248,24 +260,23 @@ void SubSystem::calcResidual(Eigen::VectorXd& r, double& err)
 {
     assert(r.size() == csize);
 
-    int i = 0;
-    err = 0.;
-    for (std::vector<Constraint*>::const_iterator constr = clist.begin(); constr != clist.end();
-         ++constr, i++) {
-        r[i] = (*constr)->error();
-        err += r[i] * r[i];
-    }
-    err *= 0.5;
+    calcResidual(r);
+    err = 0.5 * r.squaredNorm();
 }
 
 void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 {
+    // only the parameters of a constraint give non-zero entries in its row
+    std::vector<std::vector<int>> columns = paramColumns(params);
     jacobi.setZero(csize, params.size());
-    for (int j = 0; j < int(params.size()); j++) {
-        MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
-        if (pmapfind != pmap.end()) {
-            for (int i = 0; i < csize; i++) {
-                jacobi(i, j) = clist[i]->grad(pmapfind->second);
+    for (int i : corder) {
+        for (int index : cparams[i]) {
+            if (columns[index].empty()) {
+                continue;
+            }
+            double value = clist[i]->grad(&pvals[index]);
+            for (int j : columns[index]) {
+                jacobi(i, j) = value;
             }
         }
     }
@@ -273,22 +284,43 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // the columns of plist are the entries of pvals
+    jacobi.setZero(csize, psize);
+    for (int i : corder) {
+        for (int index : cparams[i]) {
+            jacobi(i, index) = clist[i]->grad(&pvals[index]);
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    std::vector<Eigen::Triplet<double>> entries;
+    for (int i : corder) {
+        for (int index : cparams[i]) {
+            entries.emplace_back(i, index, clist[i]->grad(&pvals[index]));
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(entries.begin(), entries.end());
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
 
+    // the error of every constraint is evaluated once and spread over its parameters
+    std::vector<std::vector<int>> columns = paramColumns(params);
     grad.setZero();
-    for (int j = 0; j < int(params.size()); j++) {
-        MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
-        if (pmapfind != pmap.end()) {
-            std::vector<Constraint*> constrs = p2c[pmapfind->second];
-            for (std::vector<Constraint*>::const_iterator constr = constrs.begin();
-                 constr != constrs.end();
-                 ++constr) {
-                grad[j] += (*constr)->error() * (*constr)->grad(pmapfind->second);
+    for (int i : corder) {
+        double err = clist[i]->error();
+        for (int index : cparams[i]) {
+            if (columns[index].empty()) {
+                continue;
+            }
+            double value = err * clist[i]->grad(&pvals[index]);
+            for (int j : columns[index]) {
+                grad[j] += value;
             }
         }
     }
@@ -296,7 +328,15 @@ void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 
 void SubSystem::calcGrad(Eigen::VectorXd& grad)
 {
-    calcGrad(plist, grad);
+    assert(grad.size() == psize);
+
+    grad.setZero();
+    for (int i : corder) {
+        double err = clist[i]->error();
+        for (int index : cparams[i]) {
+            grad[index] += err * clist[i]->grad(&pvals[index]);
+        }
+    }
 }
 
 double SubSystem::maxStep(VEC_pD& params, Eigen::VectorXd& xdir)
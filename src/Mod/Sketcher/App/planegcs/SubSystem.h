@@ -27,6 +27,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "Constraints.h"
 
@@ -43,9 +44,14 @@ private:
     MAP_pD_pD pmap;  // redirection map from the original parameters to pvals
     VEC_D pvals;     // current variables vector (psize)
                      //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
-    std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
-    std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
+    // indices into pvals of the parameters of each constraint, in the order of clist
+    std::vector<std::vector<int>> cparams;
+    // indices into clist grouped by constraint type, so that evaluating the constraints in
+    // this order dispatches to the same error() and grad() implementations back to back
+    std::vector<int> corder;
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
+    // columns of params per entry of pvals, a reduced parameter can appear more than once
+    std::vector<std::vector<int>> paramColumns(VEC_pD& params);
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params, MAP_pD_pD& reductionmap);
@@ -78,6 +84,7 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
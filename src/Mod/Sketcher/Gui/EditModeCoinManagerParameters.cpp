@@ -26,6 +26,7 @@
 
 #include <Base/Color.h>
 #include <Gui/ViewParams.h>
+#include <Mod/Part/App/Geometry.h>
 
 #include "EditModeCoinManagerParameters.h"
 
@@ -98,3 +99,51 @@ SbColor
 SbColor DrawingParameters::CursorTextColor(0.0f, 0.0f, 1.0f);        // #0000FF -> (0,0,255)
 
 const MultiFieldId MultiFieldId::Invalid = MultiFieldId();
+
+CurveTessellationCache::CurveTessellationCache() = default;
+
+CurveTessellationCache::~CurveTessellationCache() = default;
+
+const CurveTessellationCache::Entry*
+CurveTessellationCache::find(int geoId, const Part::Geometry* geo, int numSegments)
+{
+    auto it = previousEntries.find(geoId);
+    if (it == previousEntries.end()) {
+        return nullptr;
+    }
+
+    Entry& entry = it->second;
+    // an exact comparison, the cached points must be those the curve would give
+    if (entry.numSegments != numSegments || !geo->isSame(*entry.geometry, 0, 0)) {
+        return nullptr;
+    }
+
+    auto& kept = entries[geoId] = std::move(entry);
+    previousEntries.erase(it);
+    return &kept;
+}
+
+void CurveTessellationCache::store(int geoId,
+                                   const Part::Geometry* geo,
+                                   int numSegments,
+                                   std::vector<Base::Vector3d> points,
+                                   double combRepresentationScale)
+{
+    Entry& entry = entries[geoId];
+    entry.geometry.reset(geo->copy());
+    entry.numSegments = numSegments;
+    entry.points = std::move(points);
+    entry.combRepresentationScale = combRepresentationScale;
+}
+
+void CurveTessellationCache::endConversion()
+{
+    previousEntries.swap(entries);
+    entries.clear();
+}
+
+void CurveTessellationCache::clear()
+{
+    previousEntries.clear();
+    entries.clear();
+}
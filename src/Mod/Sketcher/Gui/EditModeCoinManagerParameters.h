@@ -24,6 +24,7 @@
 #define SKETCHERGUI_EditModeCoinManagerParameters_H
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <QString>
@@ -41,6 +42,7 @@
 #include <Inventor/nodes/SoTranslation.h>
 
 #include <Base/Color.h>
+#include <Base/Vector3D.h>
 #include <Gui/ViewParams.h>
 #include <Gui/Inventor/SmSwitchboard.h>
 #include <Mod/Sketcher/App/GeoList.h>
@@ -563,6 +565,44 @@ struct CoinMapping
     std::map<Sketcher::GeoElementId, MultiFieldId> GeoElementId2SetId;
 };
 
+/** @brief      Helper class keeping the tessellation of the curves between two conversions
+ * of the geometry into coin nodes.
+ *
+ * While dragging most curves keep their shape, so their points are taken from here instead of
+ * evaluating the curves again. An entry is used only if its geometry is the same as the current
+ * one of the GeoId, entries not used by a conversion are dropped by the next call to
+ * endConversion().
+ */
+class CurveTessellationCache
+{
+public:
+    struct Entry
+    {
+        std::unique_ptr<Part::Geometry> geometry;
+        int numSegments = 0;
+        std::vector<Base::Vector3d> points;
+        /// the comb representation scale of a B-spline
+        double combRepresentationScale = 0;
+    };
+
+    CurveTessellationCache();
+    ~CurveTessellationCache();
+
+    /// returns the entry of geoId if it was made for the same geometry and number of segments
+    const Entry* find(int geoId, const Part::Geometry* geo, int numSegments);
+    void store(int geoId,
+               const Part::Geometry* geo,
+               int numSegments,
+               std::vector<Base::Vector3d> points,
+               double combRepresentationScale = 0);
+    void endConversion();
+    void clear();
+
+private:
+    std::map<int, Entry> previousEntries;
+    std::map<int, Entry> entries;
+};
+
 }  // namespace SketcherGui
 
 #endif  // SKETCHERGUI_EditModeCoinManagerParameters_H
@@ -24,8 +24,10 @@
 #ifndef _PreComp_
 #include <QPainter>
 #include <QRegularExpression>
+#include <cmath>
 #include <limits>
 #include <memory>
+#include <queue>
 
 #include <Inventor/SbImage.h>
 #include <Inventor/SbVec3f.h>
@@ -2514,61 +2516,78 @@ void EditModeConstraintCoinManager::combineConstraintIcons(IconQueue iconQueue)
     // getScaleFactor gives us a ratio of pixels per some kind of real units
     float maxDistSquared = pow(ViewProviderSketchCoinAttorney::getScaleFactor(viewProvider), 2);
 
-    // There's room for optimisation here; we could reuse the combined icons...
     combinedConstrBoxes.clear();
 
-    while (!iconQueue.empty()) {
-        // A group starts with an item popped off the back of our initial queue
-        IconQueue thisGroup;
-        thisGroup.push_back(iconQueue.back());
-        constrIconQueueItem init = iconQueue.back();
-        iconQueue.pop_back();
-
-        // we group only icons not being Symmetry icons, because we want those on the line
-        // and only icons that are visible
-        if (init.type != QStringLiteral("Constraint_Symmetric") && init.visible) {
-
-            IconQueue::iterator i = iconQueue.begin();
-
-
-            while (i != iconQueue.end()) {
-                if ((*i).visible) {
-                    bool addedToGroup = false;
-
-                    for (IconQueue::iterator j = thisGroup.begin(); j != thisGroup.end(); ++j) {
-                        float distSquared = pow(i->position[0] - j->position[0], 2)
-                            + pow(i->position[1] - j->position[1], 2);
-                        if (distSquared <= maxDistSquared
-                            && (*i).type != QStringLiteral("Constraint_Symmetric")) {
-                            // Found an icon in iconQueue that's close enough to
-                            // a member of thisGroup, so move it into thisGroup
-                            thisGroup.push_back(*i);
-                            i = iconQueue.erase(i);
-                            addedToGroup = true;
-                            break;
-                        }
-                    }
+    // we group only icons not being Symmetry icons, because we want those on the line
+    // and only icons that are visible
+    auto isGroupable = [](const constrIconQueueItem& icon) {
+        return icon.visible && icon.type != QStringLiteral("Constraint_Symmetric");
+    };
 
-                    if (addedToGroup) {
-                        if (i == iconQueue.end()) {
-                            // We just got the last icon out of iconQueue
-                            break;
-                        }
-                        else {
-                            // Start looking through the iconQueue again, in case
-                            // we have an icon that's now close enough to thisGroup
-                            i = iconQueue.begin();
-                        }
-                    }
-                    else {
-                        ++i;
-                    }
+    // The groupable icons are sorted into a grid of cells as large as the grouping distance, so
+    // that the icons close to another one are searched for in the neighbouring cells only.
+    float cellSize = std::sqrt(maxDistSquared);
+    if (!(cellSize > 0)) {
+        cellSize = 1;
+    }
+    using Cell = std::pair<long long, long long>;
+    auto cellOf = [cellSize](const SbVec3f& position) -> Cell {
+        return {static_cast<long long>(std::floor(position[0] / cellSize)),
+                static_cast<long long>(std::floor(position[1] / cellSize))};
+    };
+
+    std::map<Cell, std::vector<std::size_t>> grid;
+    for (std::size_t i = 0; i < iconQueue.size(); ++i) {
+        if (isGroupable(iconQueue[i])) {
+            grid[cellOf(iconQueue[i].position)].push_back(i);
+        }
+    }
+
+    std::vector<bool> grouped(iconQueue.size(), false);
+
+    // Icons close enough to a member of the group in the queue are moved into the group,
+    // the index is used to add them in the order of the queue.
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> candidates;
+    auto addNeighbours = [&](std::size_t index) {
+        const SbVec3f& position = iconQueue[index].position;
+        Cell cell = cellOf(position);
+        for (long long x = cell.first - 1; x <= cell.first + 1; ++x) {
+            for (long long y = cell.second - 1; y <= cell.second + 1; ++y) {
+                auto it = grid.find(Cell(x, y));
+                if (it == grid.end()) {
+                    continue;
                 }
-                else {  // if !visible we skip it
-                    i++;
+                for (std::size_t other : it->second) {
+                    float distSquared = pow(iconQueue[other].position[0] - position[0], 2)
+                        + pow(iconQueue[other].position[1] - position[1], 2);
+                    if (!grouped[other] && distSquared <= maxDistSquared) {
+                        grouped[other] = true;
+                        candidates.push(other);
+                    }
                 }
             }
         }
+    };
+
+    // A group starts with the last icon of our initial queue not yet in a group
+    for (std::size_t init = iconQueue.size(); init-- > 0;) {
+        if (grouped[init]) {
+            continue;
+        }
+        grouped[init] = true;
+
+        IconQueue thisGroup;
+        thisGroup.push_back(iconQueue[init]);
+
+        if (isGroupable(iconQueue[init])) {
+            addNeighbours(init);
+            while (!candidates.empty()) {
+                std::size_t next = candidates.top();
+                candidates.pop();
+                thisGroup.push_back(iconQueue[next]);
+                addNeighbours(next);
+            }
+        }
 
         if (thisGroup.size() == 1) {
             drawTypicalConstraintIcon(thisGroup[0]);
@@ -2825,14 +2844,30 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
 {
     QColor color = constrColor(i.constraintId);
 
-    QImage image = renderConstrIcon(i.type,
-                                    color,
-                                    QStringList(i.label),
-                                    QList<QColor>() << color,
-                                    i.iconRotation);
+    QString key = QStringLiteral("%1|%2|%3|%4|%5")
+                      .arg(i.type,
+                           color.name(QColor::HexArgb),
+                           i.label,
+                           QString::number(i.iconRotation, 'g', 17),
+                           QString::number(drawingParameters.constraintIconSize));
+
+    auto cached = typicalIconCache.find(key);
+    if (cached == typicalIconCache.end()) {
+        // every label value gives an entry, keep the cache from growing while dragging
+        const std::size_t maxCachedIcons = 1000;
+        if (typicalIconCache.size() >= maxCachedIcons) {
+            typicalIconCache.clear();
+        }
+        QImage image = renderConstrIcon(i.type,
+                                        color,
+                                        QStringList(i.label),
+                                        QList<QColor>() << color,
+                                        i.iconRotation);
+        cached = typicalIconCache.emplace(key, std::move(image)).first;
+    }
 
     i.infoPtr->string.setValue(QString::number(i.constraintId).toLatin1().data());
-    sendConstraintIconToCoin(image, i.destination);
+    sendConstraintIconToCoin(cached->second, i.destination);
 }
 
 QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constraint)
@@ -191,6 +191,10 @@ private:
 
     std::map<QString, ConstrIconBBVec> combinedConstrBoxes;
 
+    // The rendered single constraint icons, keyed by everything that gives their look, so that
+    // redrawing an unchanged icon doesn't render it again.
+    std::map<QString, QImage> typicalIconCache;
+
 
     /// Internal type used for drawing constraint icons
     struct constrIconQueueItem
@@ -39,12 +39,14 @@ EditModeGeometryCoinConverter::EditModeGeometryCoinConverter(
     GeometryLayerNodes& geometrylayernodes,
     DrawingParameters& drawingparameters,
     GeometryLayerParameters& geometryLayerParams,
-    CoinMapping& coinMap)
+    CoinMapping& coinMap,
+    CurveTessellationCache& tessellationcache)
     : viewProvider(vp)
     , geometryLayerNodes(geometrylayernodes)
     , drawingParameters(drawingparameters)
     , geometryLayerParameters(geometryLayerParams)
     , coinMapping(coinMap)
+    , tessellationCache(tessellationcache)
 {}
 
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geolistfacade)
@@ -269,6 +271,8 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
         }
     }
 
+    tessellationCache.endConversion();
+
     // Coin Nodes Editing
     int vOrFactor = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider);
     double linez = vOrFactor * drawingParameters.zLowLines;  // NOLINT
@@ -349,6 +353,29 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
         addPoint(Points[coinLayer], geo->getCenter());
     }
 
+    // Adds the points of an unchanged curve from the cache
+    [[maybe_unused]] auto addCachedCurve = [&](int numSegments) {
+        auto entry = tessellationCache.find(geoid, geo, numSegments);
+        if (!entry) {
+            return false;
+        }
+        for (const auto& pnt : entry->points) {
+            addPoint(Coords[coinLayer][subLayer], pnt);
+        }
+        Index[coinLayer][subLayer].push_back(numSegments + 1);
+        if (entry->combRepresentationScale > combrepscale) {
+            combrepscale = entry->combRepresentationScale;
+        }
+        return true;
+    };
+
+    [[maybe_unused]] auto storeCurve =
+        [&](int numSegments, std::size_t first, double repscale = 0) {
+            auto& coords = Coords[coinLayer][subLayer];
+            std::vector<Base::Vector3d> points(coords.begin() + first, coords.end());
+            tessellationCache.store(geoid, geo, numSegments, std::move(points), repscale);
+        };
+
     // Curves
     if constexpr (curvemode == CurveMode::StartEndPointsOnly) {
         addPoint(Coords[coinLayer][subLayer], geo->getStartPoint());
@@ -361,6 +388,11 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
             numSegments *= geo->countKnots();
         }
 
+        if (addCachedCurve(numSegments)) {
+            return;
+        }
+        std::size_t first = Coords[coinLayer][subLayer].size();
+
         double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
 
         for (int i = 0; i < numSegments; i++) {
@@ -372,6 +404,8 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
         addPoint(Coords[coinLayer][subLayer], pnt);
 
         Index[coinLayer][subLayer].push_back(numSegments + 1);
+
+        storeCurve(numSegments, first);
     }
     else if constexpr (curvemode == CurveMode::OpenCurve) {
         int numSegments = drawingParameters.curvedEdgeCountSegments;
@@ -379,6 +413,12 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
             numSegments *= (geo->countKnots() - 1);  // one less segments than knots
         }
 
+        if (addCachedCurve(numSegments)) {
+            return;
+        }
+        std::size_t first = Coords[coinLayer][subLayer].size();
+        double curverepscale = 0;
+
         double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
 
         for (int i = 0; i < numSegments; i++) {
@@ -459,7 +499,10 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
             if (temprepscale > combrepscale) {
                 combrepscale = temprepscale;
             }
+            curverepscale = temprepscale;
         }
+
+        storeCurve(numSegments, first, curverepscale);
     }
 }
 
@@ -54,6 +54,7 @@ struct GeometryLayerNodes;
 struct DrawingParameters;
 class GeometryLayerParameters;
 struct CoinMapping;
+class CurveTessellationCache;
 
 /** @brief      Class for creating the Geometry layer into coin nodes
  *  @details
@@ -108,12 +109,16 @@ public:
      * the geometry
      *
      * @param drawingparameters: Parameters for drawing the overlay information
+     *
+     * @param tessellationcache: The curve points of the previous conversion, curves that didn't
+     * change are not evaluated again
      */
     EditModeGeometryCoinConverter(ViewProviderSketch& vp,
                                   GeometryLayerNodes& geometrylayernodes,
                                   DrawingParameters& drawingparameters,
                                   GeometryLayerParameters& geometryLayerParams,
-                                  CoinMapping& coinMap);
+                                  CoinMapping& coinMap,
+                                  CurveTessellationCache& tessellationcache);
 
     /**
      * converts the geometry defined by GeometryLayer into the coin nodes.
@@ -178,6 +183,8 @@ private:
     // Mappings coin geoId
     CoinMapping& coinMapping;
 
+    CurveTessellationCache& tessellationCache;
+
     // measurements
     float boundingBoxMaxMagnitude = 100;
     double combrepscale =
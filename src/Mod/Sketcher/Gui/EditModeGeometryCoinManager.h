@@ -122,6 +122,9 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    // the tessellated curves of the last processGeometry()
+    CurveTessellationCache tessellationCache;
 };
 
 
@@ -42,6 +42,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <queue>
 #include <vector>
 
 // Boost
@@ -1365,6 +1365,8 @@ void PropertySheet::addDependencies(CellAddress key)
         return;
     }
 
+    registerDocumentLabelReferences(expression, false);
+
     for (auto& var : expression->getIdentifiers()) {
         for (auto& dep : var.first.getDep(true)) {
             App::DocumentObject* docObj = dep.first;
@@ -1373,7 +1375,11 @@ void PropertySheet::addDependencies(CellAddress key)
 
             documentObjectToCellMap[docObjName].insert(key);
             cellToDocumentObjectMap[key].insert(docObjName);
-            ++updateCount;
+            // Plain references to cells of the same sheet don't change the links of this
+            // property, so there is no need to rebuild them from all cells in hasSetValue()
+            if (docObj != owner || var.first.hasDocumentObjectName()) {
+                ++updateCount;
+            }
 
             for (auto& name : dep.second) {
                 std::string propName = docObjName + "." + name;
@@ -1438,9 +1444,14 @@ void PropertySheet::removeDependencies(CellAddress key)
     std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
 
     if (i2 != cellToDocumentObjectMap.end()) {
+        std::string ownerName = owner ? owner->getFullName() : std::string();
+        bool external = false;
         std::set<std::string>::const_iterator j = i2->second.begin();
 
         while (j != i2->second.end()) {
+            if (*j != ownerName) {
+                external = true;
+            }
             std::map<std::string, std::set<CellAddress>>::iterator k =
                 documentObjectToCellMap.find(*j);
 
@@ -1456,7 +1467,9 @@ void PropertySheet::removeDependencies(CellAddress key)
         }
 
         cellToDocumentObjectMap.erase(i2);
-        ++updateCount;
+        if (external) {
+            ++updateCount;
+        }
     }
 }
 
@@ -1663,8 +1676,14 @@ void PropertySheet::recomputeDependencies(CellAddress key)
 
 void PropertySheet::hasSetValue()
 {
-    if (updateCount == 0 || !owner || !owner->isAttachedToDocument() || owner->isRestoring()
-        || this != &owner->cells || testFlag(LinkDetached)) {
+    if (!owner || !owner->isAttachedToDocument() || owner->isRestoring() || this != &owner->cells
+        || testFlag(LinkDetached)) {
+        unregisterDocumentLabelReferences();
+        PropertyExpressionContainer::hasSetValue();
+        return;
+    }
+    if (updateCount == 0) {
+        // document references of new cells are registered by addDependencies()
         PropertyExpressionContainer::hasSetValue();
         return;
     }
@@ -1674,11 +1693,13 @@ void PropertySheet::hasSetValue()
     std::map<App::DocumentObject*, bool> deps;
     std::vector<std::string> labels;
     unregisterElementReference();
+    registerDocumentLabelReferences(nullptr, true);
     UpdateElementReferenceExpressionVisitor<PropertySheet> v(*this);
     for (auto& d : data) {
         auto expr = d.second->expression.get();
         if (expr) {
             expr->getDepObjects(deps, &labels);
+            registerDocumentLabelReferences(expr, false);
             if (!restoring) {
                 expr->visit(v);
             }
@@ -1778,10 +1799,12 @@ void PropertySheet::onContainerRestored()
 {
     Base::FlagToggler<bool> flag(restoring);
     unregisterElementReference();
+    registerDocumentLabelReferences(nullptr, true);
     UpdateElementReferenceExpressionVisitor<PropertySheet> v(*this);
     for (auto& d : data) {
         auto expr = d.second->expression.get();
         if (expr) {
+            registerDocumentLabelReferences(expr, false);
             expr->visit(v);
         }
     }
@@ -1058,10 +1058,12 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
+    // Only the dirty cells and the cells that depend on them are added to the graph
     DependencyList graph;
     std::map<CellAddress, Vertex> VertexList;
     std::map<Vertex, CellAddress> VertexIndexList;
     std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
+    const std::string prefix = getFullName() + ".";
     while (!workQueue.empty()) {
         CellAddress currPos = workQueue.front();
         workQueue.pop_front();
@@ -1074,7 +1076,7 @@ DocumentObjectExecReturn* Sheet::execute()
         }
 
         // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
+        for (auto& dep : cells.getDeps(prefix + currPos.toString())) {
             auto resDep = VertexList.emplace(dep, Vertex());
             if (resDep.second) {
                 resDep.first->second = add_vertex(graph);
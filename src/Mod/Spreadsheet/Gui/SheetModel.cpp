@@ -64,6 +64,18 @@ SheetModel::SheetModel(Sheet* _sheet, QObject* parent)
     negativeFgColor =
         QColor(QString::fromStdString(hGrp->GetASCII("NegativeNumberColor", "#000000")));
 
+    // The cached display strings depend on the alias display and unit settings
+    ParameterGrp::handle hGrpUnits =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Units");
+    paramChangedConnection = App::GetApplication().GetUserParameter().signalParamChanged.connect(
+        [this, hGrp, hGrpUnits](ParameterGrp* param,
+                                ParameterGrp::ParamType,
+                                const char* /*name*/,
+                                const char* /*value*/) {
+            if (param == hGrp || param == hGrpUnits) {
+                displayCache.clear();
+            }
+        });
 
     const QStringList alphabet {
         QStringLiteral("A"), QStringLiteral("B"), QStringLiteral("C"), QStringLiteral("D"),
@@ -93,6 +105,7 @@ SheetModel::~SheetModel()
 {
     cellUpdatedConnection.disconnect();
     rangeUpdatedConnection.disconnect();
+    paramChangedConnection.disconnect();
 }
 
 int SheetModel::rowCount(const QModelIndex& parent) const
@@ -125,9 +138,32 @@ QVariant formatCellDisplay(QString value, const Cell* cell)
     }
     return QVariant(value);
 }
+
+unsigned int cacheKey(int row, int col)
+{
+    return (static_cast<unsigned int>(row) << 16) | static_cast<unsigned int>(col);
+}
 }  // namespace
 
 QVariant SheetModel::data(const QModelIndex& index, int role) const
+{
+    if (role != Qt::DisplayRole) {
+        return cellData(index, role);
+    }
+
+    unsigned int key = cacheKey(index.row(), index.column());
+    auto it = displayCache.find(key);
+    if (it != displayCache.end()) {
+        return it->second;
+    }
+    QVariant value = cellData(index, role);
+    if (value.isValid()) {
+        displayCache.emplace(key, value);
+    }
+    return value;
+}
+
+QVariant SheetModel::cellData(const QModelIndex& index, int role) const
 {
     static const Cell* emptyCell = new Cell(CellAddress(0, 0), nullptr);
     int row = index.row();
@@ -604,15 +640,69 @@ Qt::ItemFlags SheetModel::flags(const QModelIndex& /*index*/) const
 
 void SheetModel::cellUpdated(CellAddress address)
 {
-    QModelIndex i = index(address.row(), address.col());
-
-    Q_EMIT dataChanged(i, i);
+    displayCache.erase(cacheKey(address.row(), address.col()));
+    scheduleUpdate(address.row(), address.col(), address.row(), address.col());
 }
 
 void SheetModel::rangeUpdated(const Range& range)
 {
-    QModelIndex i = index(range.from().row(), range.from().col());
-    QModelIndex j = index(range.to().row(), range.to().col());
+    invalidateRange(range);
+    scheduleUpdate(range.from().row(), range.from().col(), range.to().row(), range.to().col());
+}
+
+void SheetModel::invalidateRange(const Range& range)
+{
+    if (static_cast<std::size_t>(range.size()) > displayCache.size()) {
+        CellAddress from = range.from();
+        CellAddress to = range.to();
+        for (auto it = displayCache.begin(); it != displayCache.end();) {
+            int row = static_cast<int>(it->first >> 16);
+            int col = static_cast<int>(it->first & 0xffff);
+            if (row >= from.row() && row <= to.row() && col >= from.col() && col <= to.col()) {
+                it = displayCache.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        return;
+    }
+
+    Range cells(range);
+    do {
+        CellAddress address(*cells);
+        displayCache.erase(cacheKey(address.row(), address.col()));
+    } while (cells.next());
+}
+
+// A recompute reports every evaluated cell on its own. Collect them into one
+// dataChanged() signal that is emitted once control returns to the event loop.
+void SheetModel::scheduleUpdate(int top, int left, int bottom, int right)
+{
+    if (!updatePending) {
+        updatePending = true;
+        pendingTop = top;
+        pendingLeft = left;
+        pendingBottom = bottom;
+        pendingRight = right;
+        QMetaObject::invokeMethod(this, &SheetModel::flushUpdates, Qt::QueuedConnection);
+        return;
+    }
+    pendingTop = std::min(pendingTop, top);
+    pendingLeft = std::min(pendingLeft, left);
+    pendingBottom = std::max(pendingBottom, bottom);
+    pendingRight = std::max(pendingRight, right);
+}
+
+void SheetModel::flushUpdates()
+{
+    if (!updatePending) {
+        return;
+    }
+    updatePending = false;
+
+    QModelIndex i = index(pendingTop, pendingLeft);
+    QModelIndex j = index(pendingBottom, pendingRight);
 
     Q_EMIT dataChanged(i, j);
 }
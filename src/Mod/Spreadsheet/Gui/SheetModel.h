@@ -23,6 +23,7 @@
 #ifndef SHEETMODEL_H
 #define SHEETMODEL_H
 
+#include <unordered_map>
 #include <QAbstractTableModel>
 
 #include <App/Range.h>
@@ -53,13 +54,18 @@ public:
 
 private Q_SLOTS:
     void setCellData(QModelIndex index, QString str);
+    void flushUpdates();
 
 private:
+    QVariant cellData(const QModelIndex& index, int role) const;
     void cellUpdated(App::CellAddress address);
     void rangeUpdated(const App::Range& range);
+    void invalidateRange(const App::Range& range);
+    void scheduleUpdate(int top, int left, int bottom, int right);
 
     boost::signals2::scoped_connection cellUpdatedConnection;
     boost::signals2::scoped_connection rangeUpdatedConnection;
+    boost::signals2::scoped_connection paramChangedConnection;
     Spreadsheet::Sheet* sheet;
     QColor aliasBgColor;
     QColor textFgColor;
@@ -68,6 +74,17 @@ private:
 
     QVariantList columnLabels, rowLabels;
 
+    // Formatted display strings keyed by row and column, dropped
+    // whenever the sheet reports a change of the cell
+    mutable std::unordered_map<unsigned int, QVariant> displayCache;
+
+    // Bounding box of the cells changed since the last dataChanged() signal
+    bool updatePending {false};
+    int pendingTop {0};
+    int pendingLeft {0};
+    int pendingBottom {0};
+    int pendingRight {0};
+
     static constexpr int maxRowCount = 16384, maxColumnCount = 26 + 26 * 26;
 };
 
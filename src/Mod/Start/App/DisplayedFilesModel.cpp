@@ -41,7 +41,6 @@
 #include <App/ProjectFile.h>
 #include <Base/FileInfo.h>
 #include <Base/TimeInfo.h>
-#include <Base/Stream.h>
 
 
 using namespace Start;
@@ -63,36 +62,6 @@ FileStats fileInfoFromFreeCADFile(const std::string& path)
     return result;
 }
 
-/// Load the thumbnail image data (if any) that is stored in an FCStd file.
-/// \returns The image bytes, or an empty QByteArray (if no thumbnail was stored)
-QByteArray loadFCStdThumbnail(const QString& pathToFCStdFile)
-{
-    if (App::ProjectFile proj(pathToFCStdFile.toStdString()); proj.loadDocument()) {
-        try {
-            const QString pathToCachedThumbnail = getPathToCachedThumbnail(pathToFCStdFile);
-            if (!useCachedThumbnail(pathToCachedThumbnail, pathToFCStdFile)) {
-                static const QString pathToThumbnail = defaultThumbnailPath;
-                if (proj.containsFile(pathToThumbnail.toStdString())) {
-                    createThumbnailsDir();
-                    const Base::FileInfo fi(pathToCachedThumbnail.toStdString());
-                    Base::ofstream stream(fi, std::ios::out | std::ios::binary);
-                    proj.readInputFileDirect(pathToThumbnail.toStdString(), stream);
-                    stream.close();
-                }
-            }
-
-            if (auto inputFile = QFile(pathToCachedThumbnail); inputFile.exists()) {
-                inputFile.open(QIODevice::OpenModeFlag::ReadOnly);
-                return inputFile.readAll();
-            }
-        }
-        catch (...) {
-            Base::Console().log("Failed to load thumbnail for %s\n", pathToFCStdFile.toStdString());
-        }
-    }
-    return {};
-}
-
 FileStats getFileInfo(const std::string& path)
 {
     FileStats result;
@@ -200,16 +169,13 @@ void DisplayedFilesModel::addFile(const QString& filePath)
                                          QLatin1String("pyi"),
                                          QLatin1String("csv"),
                                          QLatin1String("txt")};
-    if (lowercaseExtension == QLatin1String("fcstd")) {
-        if (const auto thumbnail = loadFCStdThumbnail(filePath); !thumbnail.isEmpty()) {
-            _imageCache.insert(filePath, thumbnail);
-        }
-    }
-    else if (ignoredExtensions.contains(lowercaseExtension)) {
+    if (ignoredExtensions.contains(lowercaseExtension)) {
         // Don't try to generate a thumbnail for things like this: FreeCAD can read them, but
         // there's not much point in showing anything besides a generic icon
     }
     else {
+        // The thumbnail is extracted from an FCStd file or generated by f3d on the thread pool,
+        // the view shows a generic icon until it is available.
         const auto runner = new ThumbnailSource(filePath);
         connect(runner->signals(),
                 &ThumbnailSourceSignals::thumbnailAvailable,
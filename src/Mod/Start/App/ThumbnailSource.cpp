@@ -29,6 +29,7 @@
 #include <QObject>
 #include <QProcess>
 #include <QTimer>
+#include <sstream>
 #endif
 
 #include "ThumbnailSource.h"
@@ -38,6 +39,9 @@
 #include "FileUtilities.h"
 
 #include <App/Application.h>
+#include <App/ProjectFile.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
 
 using namespace Start;
 
@@ -53,10 +57,40 @@ ThumbnailSourceSignals* ThumbnailSource::signals()
     return &_signals;
 }
 
+/// Copy the thumbnail stored in an FCStd file to the thumbnail cache. Only the zip directory and
+/// the image are read, not the document.
+/// \returns false if there is no thumbnail stored
+bool extractFCStdThumbnail(const QString& pathToFCStdFile, const QString& pathToCachedThumbnail)
+{
+    try {
+        App::ProjectFile proj(pathToFCStdFile.toStdString());
+        std::ostringstream image;
+        proj.readInputFileDirect(std::string(defaultThumbnailPath.data()), image);
+        if (image.str().empty()) {
+            return false;
+        }
+        createThumbnailsDir();
+        const Base::FileInfo fi(pathToCachedThumbnail.toStdString());
+        Base::ofstream stream(fi, std::ios::out | std::ios::binary);
+        stream << image.str();
+        return true;
+    }
+    catch (...) {
+        Base::Console().log("Failed to load thumbnail for %s\n", pathToFCStdFile.toStdString());
+    }
+    return false;
+}
+
 void ThumbnailSource::run()
 {
     _thumbnailPath = getPathToCachedThumbnail(_file);
-    if (!useCachedThumbnail(_thumbnailPath, _file)) {
+    if (_file.endsWith(QLatin1String(".fcstd"), Qt::CaseInsensitive)) {
+        if (!useCachedThumbnail(_thumbnailPath, _file)
+            && !extractFCStdThumbnail(_file, _thumbnailPath)) {
+            return;
+        }
+    }
+    else if (!useCachedThumbnail(_thumbnailPath, _file)) {
         // Go through the mutex to ensure data is not stale.
         // Contention on the lock is diminished because of first checking the cache.
         setupF3D();
@@ -69,6 +69,10 @@ public:
     // recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canCacheResult() const override
+    {
+        return true;
+    }
     /// returns the type name of the view provider
     const char* getViewProviderName() const override
     {
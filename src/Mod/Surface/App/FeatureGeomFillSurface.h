@@ -74,6 +74,10 @@ public:
     short mustExecute() const override;
     void onChanged(const App::Property*) override;
     App::DocumentObjectExecReturn* execute() override;
+    bool canCacheResult() const override
+    {
+        return true;
+    }
 
     /// returns the type name of the view provider
     const char* getViewProviderName() const override
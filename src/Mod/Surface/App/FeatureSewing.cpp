@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <Precision.hxx>
 #include <TopoDS.hxx>
@@ -77,6 +78,7 @@ App::DocumentObjectExecReturn* Sewing::execute()
     try {
         BRepBuilderAPI_Sewing builder(atol, opt1, opt2, opt3, opt4);
 
+        std::vector<TopoDS_Shape> inputs;
         std::vector<App::PropertyLinkSubList::SubSet> subset = ShapeList.getSubListValues();
         for (const auto& it : subset) {
             // the subset has the documentobject and the element name which belongs to it,
@@ -87,8 +89,7 @@ App::DocumentObjectExecReturn* Sewing::execute()
 
                 // we want only the subshape which is linked
                 for (const auto& jt : it.second) {
-                    TopoDS_Shape sub = ts.getSubShape(jt.c_str());
-                    builder.Add(sub);
+                    inputs.push_back(ts.getSubShape(jt.c_str()));
                 }
             }
             else {
@@ -96,17 +97,42 @@ App::DocumentObjectExecReturn* Sewing::execute()
             }
         }
 
+        // The shapes sewn last time are unchanged if the linked features
+        // still hand out the same TShapes
+        std::array<bool, 4> options {opt1, opt2, opt3, opt4};
+        std::size_t first = 0;
+        if (opt1 && !sewnShape.IsNull() && atol == sewnTolerance && options == sewnOptions
+            && sewnInputs.size() < inputs.size()
+            && std::equal(sewnInputs.begin(),
+                          sewnInputs.end(),
+                          inputs.begin(),
+                          [](const TopoDS_Shape& s1, const TopoDS_Shape& s2) {
+                              return s1.IsEqual(s2);
+                          })) {
+            builder.Add(sewnShape);
+            first = sewnInputs.size();
+        }
+        for (std::size_t i = first; i < inputs.size(); ++i) {
+            builder.Add(inputs[i]);
+        }
+
         builder.Perform();  // Perform Sewing
 
         TopoDS_Shape aShape = builder.SewedShape();  // Get Shape
         if (aShape.IsNull()) {
+            sewnShape.Nullify();
             return new App::DocumentObjectExecReturn("Resulting shape is null");
         }
         this->Shape.setValue(aShape);
+
+        sewnInputs = std::move(inputs);
+        sewnShape = aShape;
+        sewnTolerance = atol;
+        sewnOptions = options;
         return StdReturn;
     }
     catch (Standard_Failure& e) {
-
+        sewnShape.Nullify();
         return new App::DocumentObjectExecReturn(e.GetMessageString());
     }
 }
@@ -23,6 +23,9 @@
 #ifndef SURFACE_FEATURESEWING_H
 #define SURFACE_FEATURESEWING_H
 
+#include <array>
+#include <vector>
+
 #include <App/PropertyStandard.h>
 #include <Mod/Part/App/PartFeature.h>
 #include <Mod/Surface/SurfaceGlobal.h>
@@ -49,6 +52,18 @@ public:
     // recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canCacheResult() const override
+    {
+        return true;
+    }
+
+private:
+    // Inputs, options and result of the last run. When shapes are only
+    // appended to ShapeList the new ones are sewn onto the previous result.
+    std::vector<TopoDS_Shape> sewnInputs;
+    TopoDS_Shape sewnShape;
+    double sewnTolerance {0.0};
+    std::array<bool, 4> sewnOptions {};
 };
 
 }  // Namespace Surface
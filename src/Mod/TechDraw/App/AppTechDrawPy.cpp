@@ -70,6 +70,7 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "PageExporter.h"
 #include "ProjectionAlgos.h"
 #include "TechDrawExport.h"
 #include "DrawLeaderLinePy.h"
@@ -146,6 +147,9 @@ public:
         add_varargs_method("writeDXFPage", &Module::writeDXFPage,
             "writeDXFPage(page, filename): Exports a DrawPage to a DXF file."
         );
+        add_varargs_method("writeSVGPages", &Module::writeSVGPages,
+            "writeSVGPages([pages], [filenames]): Updates the views of the DrawPages and exports the edges of their part views and their templates to SVG files. Works without the GUI."
+        );
         add_varargs_method("findCentroid", &Module::findCentroid,
             "vector = findCentroid(shape, direction): finds geometric centroid of shape looking in direction."
         );
@@ -830,6 +834,41 @@ private:
         return Py::None();
     }
 
+    Py::Object writeSVGPages(const Py::Tuple& args)
+    {
+        PyObject *pagesObj(nullptr);
+        PyObject *namesObj(nullptr);
+        if (!PyArg_ParseTuple(args.ptr(), "OO", &pagesObj, &namesObj)) {
+            throw Py::TypeError("expected ([pages], [paths])");
+        }
+
+        Py::Sequence pages(pagesObj);
+        Py::Sequence names(namesObj);
+        if (pages.size() != names.size()) {
+            throw Py::ValueError("expected a path for every page");
+        }
+
+        try {
+            TechDraw::PageExporter exporter;
+            for (Py::Sequence::size_type i = 0; i < pages.size(); i++) {
+                PyObject* pageObj = pages[i].ptr();
+                if (!PyObject_TypeCheck(pageObj, &(TechDraw::DrawPagePy::Type))) {
+                    throw Py::TypeError("expected a DrawPage");
+                }
+                auto* dPage = static_cast<TechDraw::DrawPage*>(
+                    static_cast<App::DocumentObjectPy*>(pageObj)->getDocumentObjectPtr());
+                exporter.addPage(dPage, Py::String(names[i]).as_std_string("utf-8"));
+            }
+            exporter.exportSvg();
+        }
+        catch (const Base::Exception& e) {
+            e.setPyException();
+            throw Py::Exception();
+        }
+
+        return Py::None();
+    }
+
     Py::Object findCentroid(const Py::Tuple& args)
     {
         PyObject *pcObjShape(nullptr);
@@ -473,19 +473,16 @@ ReferenceEntry DimensionAutoCorrect::searchViewForVert(DrawViewPart* obj,
 {
     // Base::Console().message("DAC::searchViewForVert()\n");
     (void)exact;
-    std::vector<TechDraw::VertexPtr> gVertexAll =
-        getDimension()->getViewPart()->getVertexGeometry();
+    // the view's vertices in canonical form - not scaled or rotated - shared by all
+    // the dimensions of the view
+    const GeometryIndex& vertexIndex = obj->getCanonicalVertexIndex();
     getMatcher()->setPointTolerance(EWTOLERANCE);
-    int iVertex = 0;
-    for (auto& vert : gVertexAll) {
-        // vert is in display form - scaled and rotated
-        Part::TopoShape temp = ReferenceEntry::asCanonicalTopoShape(vert->asTopoShape(), *obj);
-        bool isSame = getMatcher()->compareGeometry(temp, refVertex);
+    for (auto iVertex : vertexIndex.getCandidates(refVertex)) {
+        bool isSame = getMatcher()->compareGeometry(vertexIndex.getShape(iVertex), refVertex);
         if (isSame) {
             auto newSubname = std::string("Vertex") + std::to_string(iVertex);
             return {obj, newSubname, getDimension()->getDocument()};
         }
-        iVertex++;
     }
     return {};
 }
@@ -495,18 +492,15 @@ ReferenceEntry DimensionAutoCorrect::searchViewForExactEdge(DrawViewPart* obj,
                                                             const Part::TopoShape& refEdge) const
 {
     // Base::Console().message("DAC::searchViewForExactEdge()\n");
-    auto gEdgeAll = getDimension()->getViewPart()->getEdgeGeometry();
-    int iEdge {0};
-    for (auto& edge : gEdgeAll) {
-        // edge is scaled and rotated. we need it in the same scale/rotate state as
-        // the reference edge in order to match.
-        Part::TopoShape temp = ReferenceEntry::asCanonicalTopoShape(edge->asTopoShape(), *obj);
-        bool isSame = getMatcher()->compareGeometry(refEdge, temp);
+    // the view's edges in the same scale/rotate state as the reference edge, only
+    // the edges near the reference edge are compared.
+    const GeometryIndex& edgeIndex = obj->getCanonicalEdgeIndex();
+    for (auto iEdge : edgeIndex.getCandidates(refEdge)) {
+        bool isSame = getMatcher()->compareGeometry(refEdge, edgeIndex.getShape(iEdge));
         if (isSame) {
             auto newSubname = std::string("Edge") + std::to_string(iEdge);
             return {obj, newSubname, getDimension()->getDocument()};
         }
-        iEdge++;
     }
     return {};
 }
@@ -145,7 +145,9 @@ App::DocumentObjectExecReturn* DrawBrokenView::execute()
     }
 
     if (waitingForResult()) {
-        // don't start something new until the in-progress events complete
+        // don't start something new until the in-progress events complete, an outdated HLR
+        // is stopped and restarted
+        cancelHlr();
         return DrawView::execute();     // NOLINT
     }
 
@@ -23,22 +23,30 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <cmath>
 # include <iomanip>
 # include <limits>
 # include <sstream>
+# include <utility>
 
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <gp_Circ.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Edge.hxx>
@@ -69,6 +77,330 @@
 using namespace TechDraw;
 using DU = DrawUtil;
 
+namespace {
+
+//! the dashes of one hatch line, as parameters t of origin + t * direction
+struct HatchLine
+{
+    Base::Vector3d origin;
+    std::vector<std::pair<double, double>> dashes;
+};
+
+struct HatchLines
+{
+    Base::Vector3d direction;
+    std::vector<HatchLine> lines;
+};
+
+//! make the dashes of the parallel lines of hatchLine covering bBox
+HatchLines makeHatchLines(const PATLineSpec& hatchLine, const Bnd_Box& bBox, double scale, double rotation)
+{
+    const size_t MaxNumberOfEdges = Preferences::getPreferenceGroup("PAT")->GetInt("MaxSeg", 10000l);
+
+    HatchLines result;
+    double minX, maxX, minY, maxY, minZ, maxZ;
+    bBox.Get(minX, minY, minZ, maxX, maxY, maxZ);
+    Base::Vector3d topLeft(minX, maxY, 0.);
+    Base::Vector3d topRight(maxX, maxY, 0.);
+    Base::Vector3d bottomLeft(minX, minY, 0.);
+    Base::Vector3d bottomRight(maxX, minY, 0.);
+
+    Base::Vector3d origin = hatchLine.getOrigin() * scale;
+    double interval = hatchLine.getInterval() * scale;
+    double offset = hatchLine.getOffset() * scale;
+    double angle = hatchLine.getAngle() + rotation;
+    origin.RotateZ(Base::toRadians(rotation));
+
+    if (scale == 0. || interval == 0.)
+        return {};
+
+    const double hatchAngle = Base::toRadians(angle);
+    Base::Vector3d hatchDirection(cos(hatchAngle), sin(hatchAngle), 0.);
+    Base::Vector3d hatchPerpendicular(-hatchDirection.y, hatchDirection.x, 0.);
+    Base::Vector3d hatchIntervalAndOffset = offset * hatchDirection + interval * hatchPerpendicular;
+    result.direction = hatchDirection;
+
+    std::array<double, 4> orthogonalProjections = {
+        (topLeft - origin).Dot(hatchPerpendicular / interval),
+        (topRight - origin).Dot(hatchPerpendicular / interval),
+        (bottomLeft - origin).Dot(hatchPerpendicular / interval),
+        (bottomRight - origin).Dot(hatchPerpendicular / interval)
+    };
+    auto minMaxIterators = std::minmax_element(orthogonalProjections.begin(), orthogonalProjections.end());
+    int firstRepeatIndex = ceil(*minMaxIterators.first);
+    int lastRepeatIndex = floor(*minMaxIterators.second);
+
+    std::vector<double> dashParams = hatchLine.getDashParms().get();
+    double globalDashStep = 0.;
+    if (dashParams.empty()) {
+        // we define a single dash with length equal to twice the diagonal of the bounding box
+        double diagonalLength = (topRight - bottomLeft).Length();
+        dashParams.push_back(2. * diagonalLength);
+        globalDashStep = diagonalLength;
+    }
+    else {
+        for (auto& x : dashParams) {
+            x *= scale;
+            globalDashStep += std::abs(x);
+        }
+    }
+    if (globalDashStep == 0.) {
+        return {};
+    }
+
+    // we handle hatch as a set of parallel lines made of dashes, here we loop on each line
+    size_t numberOfEdges = 0;
+    for (int i = firstRepeatIndex ; i <= lastRepeatIndex ; ++i) {
+        Base::Vector3d currentOrigin = origin + static_cast<double>(i) * hatchIntervalAndOffset;
+        HatchLine line {currentOrigin, {}};
+
+        int firstDashIndex, lastDashIndex;
+        if (std::abs(hatchDirection.x) > std::abs(hatchDirection.y)) {  // we compute intersections with minX and maxX
+            firstDashIndex = (hatchDirection.x > 0.)
+                    ? std::floor((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
+                    : std::floor((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
+            lastDashIndex = (hatchDirection.x > 0.)
+                    ? std::ceil((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
+                    : std::ceil((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
+        }
+        else {  // we compute intersections with minY and maxY
+            firstDashIndex = (hatchDirection.y > 0.)
+                    ? std::floor((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
+                    : std::floor((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
+            lastDashIndex = (hatchDirection.y > 0.)
+                    ? std::ceil((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
+                    : std::ceil((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
+        }
+
+        for (int j = firstDashIndex ; j < lastDashIndex ; ++j) {
+            double currentParam = static_cast<double>(j) * globalDashStep;
+            for (auto dashParamsIterator = dashParams.begin() ; dashParamsIterator != dashParams.end() ; ++dashParamsIterator) {
+                double len = *dashParamsIterator;
+                double nextParam = currentParam + std::abs(len);
+                Base::Vector3d current = currentOrigin + currentParam * hatchDirection;
+                Base::Vector3d next = currentOrigin + nextParam * hatchDirection;
+                if (len > 0. && (current.x >= minX || next.x >= minX) && (current.x <= maxX || next.x <= maxX)
+                        && (current.y >= minY || next.y >= minY) && (current.y <= maxY || next.y <= maxY)) {
+                    line.dashes.emplace_back(currentParam, nextParam);
+                }
+                currentParam = nextParam;
+            }
+        }
+
+        numberOfEdges += line.dashes.size();
+        if (numberOfEdges > MaxNumberOfEdges) {
+            return {};
+        }
+        result.lines.push_back(std::move(line));
+    }
+
+    return result;
+}
+
+//! the outline of a face in the XY plane. Lines and circular arcs are intersected exactly,
+//! other curves are approximated by polylines.
+class FaceOutline
+{
+public:
+    explicit FaceOutline(const TopoDS_Face& face)
+    {
+        Bnd_Box box;
+        BRepBndLib::Add(face, box);
+        double size = box.IsVoid() ? 1.0 : sqrt(box.SquareExtent());
+        deflection = std::max(size * 1e-5, Precision::Confusion());
+
+        for (TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+            const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+            if (!BRep_Tool::Degenerated(edge)) {
+                addEdge(edge);
+            }
+        }
+    }
+
+    //! the intervals of t where origin + t * direction lies inside the face, in ascending order
+    std::vector<std::pair<double, double>> insideIntervals(const Base::Vector3d& origin,
+                                                           const Base::Vector3d& direction) const
+    {
+        std::vector<double> params;
+        for (auto& segment : segments) {
+            intersect(segment, origin, direction, params);
+        }
+        for (auto& arc : arcs) {
+            intersect(arc, origin, direction, params);
+        }
+        std::sort(params.begin(), params.end());
+
+        std::vector<std::pair<double, double>> result;
+        for (size_t i = 1; i < params.size(); i++) {
+            double first = params[i - 1];
+            double last = params[i];
+            if (last - first <= Precision::Confusion() ||
+                !contains(origin + 0.5 * (first + last) * direction)) {
+                continue;
+            }
+            if (!result.empty() && first - result.back().second <= Precision::Confusion()) {
+                result.back().second = last;
+            }
+            else {
+                result.emplace_back(first, last);
+            }
+        }
+        return result;
+    }
+
+private:
+    struct Segment
+    {
+        Base::Vector3d start;
+        Base::Vector3d end;
+    };
+
+    //! center + radius * (cos(u) * xAxis + sin(u) * yAxis), u in [first, last]
+    struct Arc
+    {
+        Base::Vector3d center;
+        double radius;
+        Base::Vector3d xAxis;
+        Base::Vector3d yAxis;
+        double first;
+        double last;
+    };
+
+    static double cross(const Base::Vector3d& a, const Base::Vector3d& b)
+    {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    void addEdge(const TopoDS_Edge& edge)
+    {
+        BRepAdaptor_Curve adapt(edge);
+        double first = adapt.FirstParameter();
+        double last = adapt.LastParameter();
+        if (adapt.GetType() == GeomAbs_Line) {
+            Segment segment {Base::convertTo<Base::Vector3d>(adapt.Value(first)), Base::convertTo<Base::Vector3d>(adapt.Value(last))};
+            segment.start.z = segment.end.z = 0.0;
+            segments.push_back(segment);
+            polygon.push_back(segment);
+            return;
+        }
+
+        if (adapt.GetType() == GeomAbs_Circle) {
+            gp_Circ circle = adapt.Circle();
+            if (circle.Axis().Direction().IsParallel(gp::DZ(), Precision::Angular())) {
+                Arc arc {Base::convertTo<Base::Vector3d>(circle.Location()), circle.Radius(),
+                         Base::convertTo<Base::Vector3d>(circle.XAxis().Direction()),
+                         Base::convertTo<Base::Vector3d>(circle.YAxis().Direction()), first, last};
+                arc.center.z = arc.xAxis.z = arc.yAxis.z = 0.0;
+                arcs.push_back(arc);
+
+                //the polygon only decides if a point between two intersections is inside
+                double step = deflection < arc.radius ? 2.0 * acos(1.0 - deflection / arc.radius) : last - first;
+                int count = std::clamp(static_cast<int>(ceil((last - first) / step)), 4, 10000);
+                addToPolygon(adapt, first, last, count);
+                return;
+            }
+        }
+
+        GCPnts_TangentialDeflection discretizer(adapt, first, last, 0.1, deflection);
+        Base::Vector3d previous;
+        for (int i = 1; i <= discretizer.NbPoints(); i++) {
+            Base::Vector3d point = Base::convertTo<Base::Vector3d>(discretizer.Value(i));
+            point.z = 0.0;
+            if (i > 1) {
+                segments.push_back({previous, point});
+                polygon.push_back({previous, point});
+            }
+            previous = point;
+        }
+    }
+
+    void addToPolygon(const BRepAdaptor_Curve& adapt, double first, double last, int count)
+    {
+        Base::Vector3d previous = Base::convertTo<Base::Vector3d>(adapt.Value(first));
+        previous.z = 0.0;
+        for (int i = 1; i <= count; i++) {
+            Base::Vector3d point = Base::convertTo<Base::Vector3d>(adapt.Value(first + (last - first) * i / count));
+            point.z = 0.0;
+            polygon.push_back({previous, point});
+            previous = point;
+        }
+    }
+
+    static void intersect(const Segment& segment, const Base::Vector3d& origin,
+                          const Base::Vector3d& direction, std::vector<double>& params)
+    {
+        Base::Vector3d edge = segment.end - segment.start;
+        double length = edge.Length();
+        double denominator = cross(direction, edge);
+        if (std::abs(denominator) <= Precision::Angular() * length) {
+            //parallel, the intersections with the neighbouring edges bound the line
+            return;
+        }
+        Base::Vector3d toStart = segment.start - origin;
+        double s = cross(toStart, direction) / denominator;
+        double tolerance = Precision::Confusion() / length;
+        if (s >= -tolerance && s <= 1.0 + tolerance) {
+            params.push_back(cross(toStart, edge) / denominator);
+        }
+    }
+
+    static void intersect(const Arc& arc, const Base::Vector3d& origin,
+                          const Base::Vector3d& direction, std::vector<double>& params)
+    {
+        using std::numbers::pi;
+
+        Base::Vector3d toOrigin = origin - arc.center;
+        double b = toOrigin.x * direction.x + toOrigin.y * direction.y;
+        double c = toOrigin.x * toOrigin.x + toOrigin.y * toOrigin.y - arc.radius * arc.radius;
+        double discriminant = b * b - c;
+        if (discriminant < 0.0) {
+            return;
+        }
+        double root = sqrt(discriminant);
+        double tolerance = Precision::Confusion() / arc.radius;
+        for (double t : {-b - root, -b + root}) {
+            Base::Vector3d point = toOrigin + t * direction;
+            double u = atan2(point.Dot(arc.yAxis), point.Dot(arc.xAxis));
+            u = arc.first + fmod(u - arc.first, 2.0 * pi);
+            if (u < arc.first) {
+                u += 2.0 * pi;
+            }
+            if (u <= arc.last + tolerance || u >= arc.first + 2.0 * pi - tolerance) {
+                params.push_back(t);
+            }
+            if (root == 0.0) {
+                break;
+            }
+        }
+    }
+
+    //! even-odd rule with a ray in +x direction
+    bool contains(const Base::Vector3d& point) const
+    {
+        bool inside = false;
+        for (auto& segment : polygon) {
+            const Base::Vector3d& a = segment.start;
+            const Base::Vector3d& b = segment.end;
+            if ((a.y > point.y) != (b.y > point.y)) {
+                double x = a.x + (point.y - a.y) * (b.x - a.x) / (b.y - a.y);
+                if (x > point.x) {
+                    inside = !inside;
+                }
+            }
+        }
+        return inside;
+    }
+
+    double deflection;
+    //! the lines and approximated curves
+    std::vector<Segment> segments;
+    std::vector<Arc> arcs;
+    //! all edges as lines, to classify points
+    std::vector<Segment> polygon;
+};
+
+}  // namespace
+
 App::PropertyFloatConstraint::Constraints DrawGeomHatch::scaleRange = {
     Precision::Confusion(), std::numeric_limits<double>::max(), (0.1)}; // increment by 0.1
 
@@ -120,6 +452,11 @@ void DrawGeomHatch::onChanged(const App::Property* prop)
     if (prop == &NamePattern) {
         makeLineSets();
     }
+    if (prop == &ScalePattern ||
+        prop == &PatternRotation ||
+        prop == &PatternOffset) {
+        m_trimmedLines.clear();
+    }
 
     App::DocumentObject::onChanged(prop);
 }
@@ -186,6 +523,7 @@ void DrawGeomHatch::makeLineSets()
         m_lineSets = makeLineSets(PatIncluded.getValue(),
                                   NamePattern.getValue());
     }
+    m_trimmedLines.clear();
 }
 
 /*static*/
@@ -246,8 +584,22 @@ std::vector<LineSet>  DrawGeomHatch::getTrimmedLines(int iFace)   //get the trim
         !source->hasGeometry()) {
         return std::vector<LineSet>();
     }
-    return getTrimmedLines(source, m_lineSets, iFace, ScalePattern.getValue(),
-                           PatternRotation.getValue(), PatternOffset.getValue());
+
+    //the faces only change with the geometry of the source view
+    GeometryObjectPtr geometry = source->getGeometryObject();
+    if (m_trimmedGeometry.lock() != geometry) {
+        m_trimmedLines.clear();
+        m_trimmedGeometry = geometry;
+    }
+    auto cached = m_trimmedLines.find(iFace);
+    if (cached != m_trimmedLines.end()) {
+        return cached->second;
+    }
+
+    std::vector<LineSet> result = getTrimmedLines(source, m_lineSets, iFace, ScalePattern.getValue(),
+                                                  PatternRotation.getValue(), PatternOffset.getValue());
+    m_trimmedLines[iFace] = result;
+    return result;
 }
 
 /* static */
@@ -315,68 +667,61 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
         return result;
     }
 
-    TopoDS_Face face = f;
-
     Bnd_Box bBox;
-    BRepBndLib::AddOptimal(face, bBox);
+    BRepBndLib::AddOptimal(f, bBox);
     bBox.SetGap(0.0);
     gp_Vec translateVector(hatchOffset.x, hatchOffset.y, 0.);
     auto cornerMin = bBox.CornerMin().Translated(-translateVector);
     auto cornerMax = bBox.CornerMax().Translated(-translateVector);
     bBox = Bnd_Box(cornerMin, cornerMax);
 
-    for (auto& ls: lineSets) {
-        PATLineSpec hl = ls.getPATLineSpec();
-        std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale, hatchRotation);   //completely cover face bbox with lines
-
-        //make Compound for this linespec
-        BRep_Builder builder;
-        TopoDS_Compound gridComp;
-        builder.MakeCompound(gridComp);
-        for (auto& c: candidates) {
-           builder.Add(gridComp, c);
-        }
+    FaceOutline outline(f);
+    Base::Vector3d offset(hatchOffset.x, hatchOffset.y, 0.);
 
-        TopoDS_Shape grid = gridComp;
-        gp_Trsf xGridTranslate;
-        xGridTranslate.SetTranslation(Base::convertTo<gp_Vec>(hatchOffset));
-        BRepBuilderAPI_Transform mkTransTranslate(grid, xGridTranslate, true);
-        grid = mkTransTranslate.Shape();
-
-        //Common(Compound, Face)
-        FCBRepAlgoAPI_Common mkCommon(face, grid);
-        if (!mkCommon.IsDone() ||
-            mkCommon.Shape().IsNull()) {
-            return result;
-        }
-        TopoDS_Shape common = mkCommon.Shape();
+    for (auto& ls: lineSets) {
+        //completely cover face bbox with lines
+        HatchLines hatch = makeHatchLines(ls.getPATLineSpec(), bBox, scale, hatchRotation);
+
+        //clip the dashes of every line against the face outline
+        std::vector<std::vector<std::pair<double, double>>> pieces(hatch.lines.size());
+        OSD_Parallel::For(0, static_cast<int>(hatch.lines.size()), [&](int i) {
+            const HatchLine& line = hatch.lines[i];
+            std::vector<std::pair<double, double>> inside =
+                outline.insideIntervals(line.origin + offset, hatch.direction);
+            for (auto& dash : line.dashes) {
+                for (auto& interval : inside) {
+                    double first = std::max(dash.first, interval.first);
+                    double last = std::min(dash.second, interval.second);
+                    if (last - first > Precision::Confusion()) {
+                        pieces[i].emplace_back(first, last);
+                    }
+                }
+            }
+        });
 
         //save the boundingBox of hatch pattern
         Bnd_Box overlayBox;
         overlayBox.SetGap(0.0);
-        BRepBndLib::AddOptimal(common, overlayBox);
-        ls.setBBox(overlayBox);
-
-        //get resulting edges
         std::vector<TopoDS_Edge> resultEdges;
-        TopTools_IndexedMapOfShape mapOfEdges;
-        TopExp::MapShapes(common, TopAbs_EDGE, mapOfEdges);
-        for ( int i = 1 ; i <= mapOfEdges.Extent() ; i++ ) {           //remember, TopExp makes no promises about the order it finds edges
-            const TopoDS_Edge& edge = TopoDS::Edge(mapOfEdges(i));
-            if (edge.IsNull()) {
-                continue;
-            }
-            resultEdges.push_back(edge);
-        }
-
         std::vector<TechDraw::BaseGeomPtr> resultGeoms;
-        for (auto& e: resultEdges) {
-            TechDraw::BaseGeomPtr base = BaseGeom::baseFactory(e);
-            if (!base) {
-                throw Base::ValueError("DGH::getTrimmedLines - baseFactory failed");
+        for (size_t i = 0; i < pieces.size(); i++) {
+            Base::Vector3d origin = hatch.lines[i].origin + offset;
+            for (auto& piece : pieces[i]) {
+                Base::Vector3d start = origin + piece.first * hatch.direction;
+                Base::Vector3d end = origin + piece.second * hatch.direction;
+                overlayBox.Add(gp_Pnt(start.x, start.y, 0.0));
+                overlayBox.Add(gp_Pnt(end.x, end.y, 0.0));
+
+                TopoDS_Edge edge = makeLine(start, end);
+                TechDraw::BaseGeomPtr base = BaseGeom::baseFactory(edge);
+                if (!base) {
+                    throw Base::ValueError("DGH::getTrimmedLines - baseFactory failed");
+                }
+                resultEdges.push_back(edge);
+                resultGeoms.push_back(base);
             }
-            resultGeoms.push_back(base);
         }
+        ls.setBBox(overlayBox);
         ls.setEdges(resultEdges);
         ls.setGeoms(resultGeoms);
         result.push_back(ls);
@@ -387,101 +732,14 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
 /* static */
 std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox, double scale, double rotation)
 {
-    using std::numbers::pi;
-
-    const size_t MaxNumberOfEdges = Preferences::getPreferenceGroup("PAT")->GetInt("MaxSeg", 10000l);
-
     std::vector<TopoDS_Edge> result;
-    double minX, maxX, minY, maxY, minZ, maxZ;
-    bBox.Get(minX, minY, minZ, maxX, maxY, maxZ);
-    Base::Vector3d topLeft(minX, maxY, 0.);
-    Base::Vector3d topRight(maxX, maxY, 0.);
-    Base::Vector3d bottomLeft(minX, minY, 0.);
-    Base::Vector3d bottomRight(maxX, minY, 0.);
-
-    Base::Vector3d origin = hatchLine.getOrigin() * scale;
-    double interval = hatchLine.getInterval() * scale;
-    double offset = hatchLine.getOffset() * scale;
-    double angle = hatchLine.getAngle() + rotation;
-    origin.RotateZ(Base::toRadians(rotation));
-
-    if (scale == 0. || interval == 0.)
-        return {};
-
-    const double hatchAngle = Base::toRadians(angle);
-    Base::Vector3d hatchDirection(cos(hatchAngle), sin(hatchAngle), 0.);
-    Base::Vector3d hatchPerpendicular(-hatchDirection.y, hatchDirection.x, 0.);
-    Base::Vector3d hatchIntervalAndOffset = offset * hatchDirection + interval * hatchPerpendicular;
-
-    std::array<double, 4> orthogonalProjections = {
-        (topLeft - origin).Dot(hatchPerpendicular / interval),
-        (topRight - origin).Dot(hatchPerpendicular / interval),
-        (bottomLeft - origin).Dot(hatchPerpendicular / interval),
-        (bottomRight - origin).Dot(hatchPerpendicular / interval)
-    };
-    auto minMaxIterators = std::minmax_element(orthogonalProjections.begin(), orthogonalProjections.end());
-    int firstRepeatIndex = ceil(*minMaxIterators.first);
-    int lastRepeatIndex = floor(*minMaxIterators.second);
-
-    std::vector<double> dashParams = hatchLine.getDashParms().get();
-    double globalDashStep = 0.;
-    if (dashParams.empty()) {
-        // we define a single dash with length equal to twice the diagonal of the bounding box
-        double diagonalLength = (topRight - bottomLeft).Length();
-        dashParams.push_back(2. * diagonalLength);
-        globalDashStep = diagonalLength;
-    }
-    else {
-        for (auto& x : dashParams) {
-            x *= scale;
-            globalDashStep += std::abs(x);
-        }
-    }
-    if (globalDashStep == 0.) {
-        return {};
-    }
-
-    // we handle hatch as a set of parallel lines made of dashes, here we loop on each line
-    for (int i = firstRepeatIndex ; i <= lastRepeatIndex ; ++i) {
-        Base::Vector3d currentOrigin = origin + static_cast<double>(i) * hatchIntervalAndOffset;
-
-        int firstDashIndex, lastDashIndex;
-        if (std::abs(hatchDirection.x) > std::abs(hatchDirection.y)) {  // we compute intersections with minX and maxX
-            firstDashIndex = (hatchDirection.x > 0.)
-                    ? std::floor((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
-                    : std::floor((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
-            lastDashIndex = (hatchDirection.x > 0.)
-                    ? std::ceil((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
-                    : std::ceil((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
-        }
-        else {  // we compute intersections with minY and maxY
-            firstDashIndex = (hatchDirection.y > 0.)
-                    ? std::floor((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
-                    : std::floor((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
-            lastDashIndex = (hatchDirection.y > 0.)
-                    ? std::ceil((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
-                    : std::ceil((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
-        }
-
-        for (int j = firstDashIndex ; j < lastDashIndex ; ++j) {
-            Base::Vector3d current = currentOrigin + static_cast<double>(j) * globalDashStep * hatchDirection;
-            for (auto dashParamsIterator = dashParams.begin() ; dashParamsIterator != dashParams.end() ; ++dashParamsIterator) {
-                double len = *dashParamsIterator;
-                Base::Vector3d next = current + std::abs(len) * hatchDirection;
-                if (len > 0. && (current.x >= minX || next.x >= minX) && (current.x <= maxX || next.x <= maxX)
-                        && (current.y >= minY || next.y >= minY) && (current.y <= maxY || next.y <= maxY)) {
-                    TopoDS_Edge newLine = makeLine(current, next);
-                    result.push_back(newLine);
-                }
-                std::swap(current, next);
-            }
-        }
-
-        if (result.size() > MaxNumberOfEdges) {
-            return {};
+    HatchLines hatch = makeHatchLines(hatchLine, bBox, scale, rotation);
+    for (auto& line : hatch.lines) {
+        for (auto& dash : line.dashes) {
+            result.push_back(makeLine(line.origin + dash.first * hatch.direction,
+                                      line.origin + dash.second * hatch.direction));
         }
     }
-
     return result;
 }
 
@@ -23,6 +23,9 @@
 #ifndef TechDraw_DrawGeomHatch_h_
 #define TechDraw_DrawGeomHatch_h_
 
+#include <map>
+#include <memory>
+
 #include <App/DocumentObject.h>
 #include <App/FeaturePython.h>
 #include <App/PropertyFile.h>
@@ -44,6 +47,7 @@ namespace TechDraw
 {
 class DrawViewPart;
 class DrawViewSection;
+class GeometryObject;
 class PATLineSpec;
 class LineSet;
 class DashSet;
@@ -114,6 +118,9 @@ protected:
 
 private:
     std::vector<LineSet> m_lineSets;
+    // the trimmed lines of the faces of the source view's geometry
+    std::map<int, std::vector<LineSet>> m_trimmedLines;
+    std::weak_ptr<GeometryObject> m_trimmedGeometry;
     std::string m_saveFile;
     std::string m_saveName;
     static App::PropertyFloatConstraint::Constraints scaleRange;
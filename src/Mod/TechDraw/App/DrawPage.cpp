@@ -417,6 +417,18 @@ std::vector<App::DocumentObject*> DrawPage::getAllViews() const
     return allViews;
 }
 
+int DrawPage::countPendingViews() const
+{
+    int count = 0;
+    for (auto& v : getAllViews()) {
+        auto* dvp = freecad_cast<DrawViewPart*>(v);
+        if (dvp && dvp->waitingForResult()) {
+            count++;
+        }
+    }
+    return count;
+}
+
 void DrawPage::unsetupObject()
 {
     nowUnsetting = true;
@@ -93,6 +93,8 @@ public:
     void requestPaint();
     std::vector<App::DocumentObject*> getViews() const;
     std::vector<App::DocumentObject*> getAllViews() const;
+    //! the number of views waiting for their HLR, face finding or other background jobs
+    int countPendingViews() const;
 
     int getNextBalloonIndex();
 
@@ -114,6 +114,7 @@ App::DocumentObjectExecReturn *DrawProjGroupItem::execute()
     }
 
     if (waitingForHlr()) {
+        cancelHlr();
         return DrawView::execute();
     }
 
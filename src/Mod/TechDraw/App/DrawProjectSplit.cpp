@@ -24,9 +24,11 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <iterator>
 # include <limits>
 # include <sstream>
 #include <Bnd_Box.hxx>
+#include <OSD_Parallel.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
@@ -45,6 +47,8 @@
 #include <TopoDS_Shape.hxx>
 #endif
 #include <BOPAlgo_Builder.hxx>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <Base/Console.h>
 #include <Base/Parameter.h>
@@ -58,6 +62,66 @@
 
 using namespace TechDraw;
 
+namespace
+{
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using BoxPoint = bg::model::point<double, 3, bg::cs::cartesian>;
+using BoxItem = std::pair<bg::model::box<BoxPoint>, int>;
+using BoxTree = bgi::rtree<BoxItem, bgi::linear<16>>;
+
+BoxPoint toBoxPoint(const gp_Pnt& pnt)
+{
+    return BoxPoint(pnt.X(), pnt.Y(), pnt.Z());
+}
+
+//the boxes of the edges with the same gap as the brute force checks used.  Edges without a box
+//are left out of the tree.
+BoxTree makeBoxTree(const std::vector<TopoDS_Edge>& edges, bool optimal, std::vector<Bnd_Box>& boxes)
+{
+    boxes.assign(edges.size(), Bnd_Box());
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int i) {
+        if (optimal) {
+            BRepBndLib::AddOptimal(edges[i], boxes[i]);
+        } else {
+            BRepBndLib::Add(edges[i], boxes[i]);
+        }
+        boxes[i].SetGap(0.1);
+    });
+
+    std::vector<BoxItem> items;
+    items.reserve(edges.size());
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (boxes[i].IsVoid()) {
+            continue;
+        }
+        items.emplace_back(bg::model::box<BoxPoint>(toBoxPoint(boxes[i].CornerMin()),
+                                                    toBoxPoint(boxes[i].CornerMax())),
+                           static_cast<int>(i));
+    }
+    //the range constructor uses packing, which gives a better tree than inserting one by one
+    return BoxTree(items.begin(), items.end());
+}
+
+//the indices of the edges whose box intersects geometry, in ascending order
+template<typename Geometry>
+std::vector<int> queryBoxTree(const BoxTree& tree, const Geometry& geometry)
+{
+    std::vector<BoxItem> hits;
+    tree.query(bgi::intersects(geometry), std::back_inserter(hits));
+    std::vector<int> result;
+    result.reserve(hits.size());
+    for (auto& hit : hits) {
+        result.push_back(hit.second);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // namespace
+
 //===========================================================================
 // DrawProjectSplit
 //===========================================================================
@@ -164,6 +228,81 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
 }
 
 
+//HLR algo does not provide all edge intersections for edge endpoints, so the long edges touched by
+//a vertex of another edge have to be split.  An R-tree of the edge boxes gives the few edges near
+//a vertex, which are then checked in parallel.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<Bnd_Box> boxes;
+    BoxTree tree = makeBoxTree(edges, true, boxes);
+    //zero length edges shouldn't be there, skip them anyway
+    std::vector<char> skip(edges.size(), 0);
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int i) {
+        skip[i] = boxes[i].IsVoid() || DrawUtil::isZeroEdge(edges[i]);
+    });
+
+    std::vector<std::vector<splitPoint>> edgeSplits(edges.size());
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int iOuter) {
+        const TopoDS_Edge& outer = edges[iOuter];
+        if (skip[iOuter]) {
+            return;
+        }
+        for (const TopoDS_Vertex& vertex : {TopExp::FirstVertex(outer), TopExp::LastVertex(outer)}) {
+            gp_Pnt pnt = BRep_Tool::Pnt(vertex);
+            for (int iInner : queryBoxTree(tree, toBoxPoint(pnt))) {
+                double param = -1;
+                if (iInner != iOuter && !skip[iInner] && isOnEdge(edges[iInner], vertex, param, false)) {
+                    splitPoint split;
+                    split.i = iInner;
+                    split.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                    split.param = param;
+                    edgeSplits[iOuter].push_back(split);
+                }
+            }
+        }
+    });
+
+    std::vector<splitPoint> result;
+    for (auto& splits : edgeSplits) {
+        result.insert(result.end(), splits.begin(), splits.end());
+    }
+    return result;
+}
+
+//a 64 bit FNV-1a hash of the curve type, the parameter range and some points of every edge
+std::uint64_t DrawProjectSplit::edgesDigest(const std::vector<TopoDS_Edge>& edges)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto add = [&hash](const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    };
+    auto addPoint = [&add](const gp_Pnt& pnt) {
+        double coords[3] = {pnt.X(), pnt.Y(), pnt.Z()};
+        add(coords, sizeof(coords));
+    };
+
+    size_t count = edges.size();
+    add(&count, sizeof(count));
+    for (auto& edge : edges) {
+        BRepAdaptor_Curve adapt(edge);
+        int type = adapt.GetType();
+        double first = adapt.FirstParameter();
+        double last = adapt.LastParameter();
+        add(&type, sizeof(type));
+        add(&first, sizeof(first));
+        add(&last, sizeof(last));
+        addPoint(BRep_Tool::Pnt(TopExp::FirstVertex(edge)));
+        addPoint(BRep_Tool::Pnt(TopExp::LastVertex(edge)));
+        for (double fraction : {0.25, 0.5, 0.75}) {
+            addPoint(adapt.Value(first + fraction * (last - first)));
+        }
+    }
+    return hash;
+}
+
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
     std::vector<TopoDS_Edge> result;
@@ -593,15 +732,19 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> outEdges;
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
+    //only edges with intersecting boxes can overlap, see boxesIntersect()
+    std::vector<Bnd_Box> boxes;
+    BoxTree tree = makeBoxTree(inEdges, false, boxes);
     int edgeCount = inEdges.size();
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
-        if (skipThisEdge.at(ie0)) {
+        if (skipThisEdge.at(ie0) || boxes.at(ie0).IsVoid()) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
-            if (skipThisEdge.at(ie1)) {
+        bg::model::box<BoxPoint> box0(toBoxPoint(boxes.at(ie0).CornerMin()),
+                                      toBoxPoint(boxes.at(ie0).CornerMax()));
+        for (int ie1 : queryBoxTree(tree, box0)) {
+            if (ie1 <= ie0 || skipThisEdge.at(ie1)) {
                 continue;
             }
             int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
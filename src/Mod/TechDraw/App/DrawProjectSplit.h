@@ -23,6 +23,8 @@
 #ifndef DrawProjectSplit_h_
 #define DrawProjectSplit_h_
 
+#include <cstdint>
+
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Vertex.hxx>
 
@@ -102,6 +104,10 @@ public:
     static TechDraw::GeometryObjectPtr  buildGeometryObject(TopoDS_Shape shape, const gp_Ax2& viewAxis);
 
     static bool isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds = false);
+    //the points where an end of one edge touches the inside of another one
+    static std::vector<splitPoint> findSplitPoints(const std::vector<TopoDS_Edge>& edges);
+    //identifies the geometry of edges for caching the result of findSplitPoints
+    static std::uint64_t edgesDigest(const std::vector<TopoDS_Edge>& edges);
     static std::vector<TopoDS_Edge> splitEdges(std::vector<TopoDS_Edge> orig, std::vector<splitPoint> splits);
     static std::vector<TopoDS_Edge> split1Edge(TopoDS_Edge e, std::vector<splitPoint> splitPoints);
 
@@ -185,6 +185,7 @@ App::DocumentObjectExecReturn* DrawViewDetail::execute()
 void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawViewSection* dvs)
 {
     if (waitingForHlr() || waitingForDetail()) {
+        cancelHlr();
         return;
     }
 
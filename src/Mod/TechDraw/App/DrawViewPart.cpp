@@ -48,6 +48,7 @@
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <TopExp.hxx>
@@ -75,6 +76,8 @@
 
 #include "Cosmetic.h"
 #include "CenterLine.h"
+#include "DimensionReferences.h"
+#include "DrawBrokenView.h"
 #include "DrawGeomHatch.h"
 #include "DrawHatch.h"
 #include "DrawPage.h"
@@ -83,12 +86,15 @@
 #include "DrawViewBalloon.h"
 #include "DrawViewDetail.h"
 #include "DrawViewDimension.h"
+#include "DrawViewMulti.h"
 #include "DrawViewPart.h"
 #include "DrawViewPartPy.h"// generated from DrawViewPartPy.xml
 #include "DrawViewSection.h"
 #include "EdgeWalker.h"
 #include "Geometry.h"
+#include "GeometryMatcher.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
@@ -104,7 +110,9 @@ DrawViewPart::DrawViewPart()
       m_handleFaces(false),
       nowUnsetting(false),
       m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false),
+      m_hlrResultRestored(false),
+      m_hlrOutdated(false)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -149,6 +157,12 @@ DrawViewPart::DrawViewPart()
 
     ADD_PROPERTY_TYPE(ScrubCount, (Preferences::scrubCount()), sgroup, App::Prop_None,
                       "The number of times FreeCAD should try to clean the HLR result.");
+    ADD_PROPERTY_TYPE(HlrResult, (TopoDS_Shape()), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output | App::Prop_NoRecompute),
+                      "The saved output of the hidden line removal");
+    ADD_PROPERTY_TYPE(HlrResultKey, (""), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output | App::Prop_NoRecompute),
+                      "Identifies the shape and settings of the saved HLR output");
 
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
@@ -233,6 +247,7 @@ App::DocumentObjectExecReturn* DrawViewPart::execute()
     }
 
     if (waitingForHlr()) {
+        cancelHlr();
         return DrawView::execute();
     }
 
@@ -293,10 +308,13 @@ void DrawViewPart::onChanged(const App::Property* prop)
 void DrawViewPart::partExec(TopoDS_Shape& shape)
 {
     if (waitingForHlr()) {
-        //finish what we are already doing before starting a new cycle
+        //stop what we are already doing and start a new cycle when it has stopped
+        cancelHlr();
         return;
     }
 
+    restoreHlrResult();
+
     //we need to keep using the old geometryObject until the new one is fully populated
     m_tempGeometryObject = makeGeometryForShape(shape);
     if (CoarseView.getValue() ||
@@ -342,6 +360,21 @@ TopoDS_Shape DrawViewPart::centerScaleRotate(const DrawViewPart *dvp, TopoDS_Sha
     return centeredShape;
 }
 
+//! the HLR jobs of all views share this pool, so that pages with many views don't
+//! start more jobs than there are cores
+static QThreadPool* hlrThreadPool()
+{
+    static QThreadPool* pool = [] {
+        auto* threadPool = new QThreadPool();
+        int count = Preferences::hlrThreadCount();
+        if (count > 0) {
+            threadPool->setMaxThreadCount(count);
+        }
+        return threadPool;
+    }();
+    return pool;
+}
+
 //! create a geometry object and trigger the HLR process in another thread
 TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shape,
                                                               const gp_Ax2& viewAxis)
@@ -379,16 +412,74 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     // This is important because those variables might be local to the calling
     // function and might get destructed before the parallel processing finishes.
     auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-    m_hlrFuture = QtConcurrent::run(std::move(lambda));
+    m_hlrFuture = QtConcurrent::run(hlrThreadPool(), std::move(lambda));
     m_hlrWatcher.setFuture(m_hlrFuture);
     waitingForHlr(true);
 
     return go;
 }
 
+//! returns a job that runs the hidden line removal of the view into the HLR cache, so that
+//! the next recompute finds the result there. The job may run in any thread, it doesn't touch
+//! the view. Views that modify the source shape before projecting it get an empty job.
+std::function<void()> DrawViewPart::makeHlrPrefetch()
+{
+    if (CoarseView.getValue() || isDerivedFrom<DrawViewSection>()
+        || isDerivedFrom<DrawViewDetail>() || isDerivedFrom<DrawViewMulti>()
+        || isDerivedFrom<DrawBrokenView>()) {
+        return {};
+    }
+    TopoDS_Shape shape = getSourceShape();
+    if (shape.IsNull()) {
+        return {};
+    }
+
+    //the same steps as makeGeometryForShape(), so that the cache keys match
+    bool copyGeometry = true;
+    bool copyMesh = false;
+    BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
+    TopoDS_Shape localShape = copier.Shape();
+    gp_Ax2 viewAxis = getProjectionCS();
+    gp_Pnt gCentroid = ShapeUtils::findCentroid(localShape, viewAxis);
+    centerScaleRotate(this, localShape, Base::convertTo<Base::Vector3d>(gCentroid));
+
+    TechDraw::GeometryObjectPtr go(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    go->setIsoCount(IsoCount.getValue());
+    go->isPerspective(Perspective.getValue());
+    go->setFocus(Focus.getValue());
+    go->usePolygonHLR(false);
+    go->setScrubCount(ScrubCount.getValue());
+    return [go, localShape, viewAxis] { go->projectShape(localShape, viewAxis); };
+}
+
+//! the HLR job running now is outdated. A job still queued in the pool doesn't start, a
+//! running one stops at its next check, and the view is recomputed once it has finished.
+void DrawViewPart::cancelHlr()
+{
+    if (!waitingForHlr()) {
+        return;
+    }
+    m_hlrOutdated = true;
+    if (m_tempGeometryObject) {
+        m_tempGeometryObject->cancel();
+    }
+    m_hlrFuture.cancel();
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
+    if (m_hlrOutdated) {
+        //the source changed while the HLR was running, so its result is discarded
+        m_hlrOutdated = false;
+        m_tempGeometryObject = nullptr;
+        waitingForHlr(false);
+        QObject::disconnect(connectHlrWatcher);
+        recomputeFeature();
+        return;
+    }
+
     //now that the new GeometryObject is fully populated, we can replace the old one
     if (m_tempGeometryObject) {
         geometryObject = m_tempGeometryObject;//replace with new
@@ -405,6 +496,7 @@ void DrawViewPart::onHlrFinished()
 
     //the last hlr related task is to make a bbox of the results
     bbox = geometryObject->calcBoundingBox();
+    saveHlrResult();
 
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
@@ -444,6 +536,39 @@ void DrawViewPart::onHlrFinished()
     }
 }
 
+//! hand the HLR output saved in the document to the cache once, so that the first
+//! execute after opening the document doesn't need to run the HLR
+void DrawViewPart::restoreHlrResult()
+{
+    if (m_hlrResultRestored) {
+        return;
+    }
+    m_hlrResultRestored = true;
+    if (HlrResultKey.isEmpty()) {
+        return;
+    }
+    HLRResult result;
+    if (result.fromCompound(HlrResult.getValue())) {
+        HLRCache::add(HlrResultKey.getValue(), result);
+    }
+}
+
+//! keep the HLR output in the document or drop it if it is no longer wanted
+void DrawViewPart::saveHlrResult()
+{
+    std::string key;
+    if (Preferences::saveHlrResult()) {
+        key = geometryObject->getHlrKey();
+    }
+    if (key == HlrResultKey.getStrValue()) {
+        return;
+    }
+    HlrResultKey.setValue(key);
+    HlrResult.setValue(key.empty() ? TopoDS_Shape() : geometryObject->getHlrResult().toCompound());
+    HlrResultKey.purgeTouched();
+    HlrResult.purgeTouched();
+}
+
 //! run any tasks that need to been done after geometry is available
 void DrawViewPart::postHlrTasks()
 {
@@ -608,62 +733,14 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
         }
     }
 
-    //HLR algo does not provide all edge intersections for edge endpoints.
-    //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    //finding the split points is the slow part, the cached ones are used as long as the edge
+    //geometry doesn't change, e.g. if only the line styles were edited
+    std::uint64_t splitsKey = DrawProjectSplit::edgesDigest(nonZero);
+    if (splitsKey != m_splitsKey) {
+        m_splits = DrawProjectSplit::findSplitPoints(nonZero);
+        m_splitsKey = splitsKey;
+    }
+    std::vector<splitPoint> splits = m_splits;
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -790,6 +867,36 @@ const std::vector<TechDraw::VertexPtr> DrawViewPart::getVertexGeometry() const
     return std::vector<TechDraw::VertexPtr>();
 }
 
+//! the vertices of this view without scale and rotation, indexed for GeometryMatcher.
+//! The index is rebuilt when the vertex geometry has been replaced.
+const GeometryIndex& DrawViewPart::getCanonicalVertexIndex()
+{
+    auto vertexes = getVertexGeometry();
+    if (!m_vertexIndex || vertexes != m_indexedVertexes) {
+        m_vertexIndex = std::make_shared<GeometryIndex>();
+        for (auto& vertex : vertexes) {
+            m_vertexIndex->add(ReferenceEntry::asCanonicalTopoShape(vertex->asTopoShape(), *this));
+        }
+        m_indexedVertexes = vertexes;
+    }
+    return *m_vertexIndex;
+}
+
+//! the edges of this view without scale and rotation, indexed for GeometryMatcher.
+//! The index is rebuilt when the edge geometry has been replaced.
+const GeometryIndex& DrawViewPart::getCanonicalEdgeIndex()
+{
+    auto edges = getEdgeGeometry();
+    if (!m_edgeIndex || edges != m_indexedEdges) {
+        m_edgeIndex = std::make_shared<GeometryIndex>();
+        for (auto& edge : edges) {
+            m_edgeIndex->add(ReferenceEntry::asCanonicalTopoShape(edge->asTopoShape(), *this));
+        }
+        m_indexedEdges = edges;
+    }
+    return *m_edgeIndex;
+}
+
 
 //! TechDraw vertex names run from 0 to n-1
 TechDraw::VertexPtr DrawViewPart::getVertex(std::string vertexName) const
@@ -25,6 +25,10 @@
 #ifndef DrawViewPart_h_
 #define DrawViewPart_h_
 
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include <QFuture>
 #include <QFutureWatcher>
 
@@ -35,6 +39,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <Base/BoundBox.h>
+#include <Mod/Part/App/PropertyTopoShape.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -55,6 +60,7 @@ namespace TechDraw
 {
 class GeometryObject;
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
+class GeometryIndex;
 class Vertex;
 class BaseGeom;
 class Face;
@@ -73,6 +79,7 @@ class CosmeticVertex;
 class CosmeticEdge;
 class CenterLine;
 class GeomFormat;
+struct splitPoint;
 }// namespace TechDraw
 
 namespace TechDraw
@@ -135,6 +142,10 @@ public:
 
     App::PropertyInteger ScrubCount;
 
+    //the HLR output kept in the document, see Preferences::saveHlrResult()
+    Part::PropertyPartShape HlrResult;
+    App::PropertyString HlrResultKey;
+
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
     const char* getViewProviderName() const override { return "TechDrawGui::ViewProviderViewPart"; }
@@ -160,6 +171,9 @@ public:
     bool hasGeometry() const;
     TechDraw::GeometryObjectPtr getGeometryObject() const { return geometryObject; }
 
+    const GeometryIndex& getCanonicalVertexIndex();
+    const GeometryIndex& getCanonicalEdgeIndex();
+
     TechDraw::VertexPtr getVertex(std::string vertexName) const;
     TechDraw::BaseGeomPtr getEdge(std::string edgeName) const;
     TechDraw::FacePtr getFace(std::string faceName) const;
@@ -237,6 +251,8 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    void cancelHlr();
+    std::function<void()> makeHlrPrefetch();
     void progressValueChanged(int v);
 
     bool isCosmeticVertex(const std::string& element);
@@ -277,9 +293,14 @@ protected:
     std::vector<TechDraw::VertexPtr> m_referenceVerts;
 
 private:
+    void restoreHlrResult();
+    void saveHlrResult();
+
     bool nowUnsetting;
     bool m_waitingForFaces;
     bool m_waitingForHlr;
+    bool m_hlrResultRestored;
+    bool m_hlrOutdated;
 
     QMetaObject::Connection connectHlrWatcher;
     QFutureWatcher<void> m_hlrWatcher;
@@ -288,6 +309,15 @@ private:
     QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
 
+    //the split points of the last findFacesOld() and the digest of its edges
+    std::uint64_t m_splitsKey{0};
+    std::vector<splitPoint> m_splits;
+
+    //canonical geometry for matching dimension references and the geometry it was made from
+    std::shared_ptr<GeometryIndex> m_vertexIndex;
+    std::vector<TechDraw::VertexPtr> m_indexedVertexes;
+    std::shared_ptr<GeometryIndex> m_edgeIndex;
+    BaseGeomPtrVector m_indexedEdges;
 };
 
 using DrawViewPartPython = App::FeaturePythonT<DrawViewPart>;
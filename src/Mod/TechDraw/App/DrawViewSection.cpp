@@ -33,6 +33,7 @@
 // makeSectionCut (separate thread)
 //     m_cuttingTool = makeCuttingTool (DVSTool.brep)
 //     m_cutPieces = (baseShape - m_cuttingTool) (DVSCutPieces.brep)
+//     solids already cut by the same tool are taken from m_cutCache
 
 // onSectionCutFinished
 //     m_preparedShape = prepareShape(m_cutPieces) - centered, scaled, rotated
@@ -46,6 +47,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <BRepBndLib.hxx>
@@ -55,7 +57,9 @@
 #include <BRepPrimAPI_MakePrism.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <OSD_Parallel.hxx>
 #include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -66,6 +70,7 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Vertex.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Ax3.hxx>
 #include <gp_Dir.hxx>
@@ -411,6 +416,7 @@ App::DocumentObjectExecReturn* DrawViewSection::execute()
     }
 
     if (waitingForCut() || waitingForHlr()) {
+        cancelHlr();
         return DrawView::execute();     //NOLINT
     }
 
@@ -505,34 +511,67 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
 {
     showProgressMessage(getNameInDocument(), "is making section cut");
 
-    // We need to copy the shape to not modify the BRepstructure
-    BRepBuilderAPI_Copy BuilderCopy(baseShape);
-    TopoDS_Shape myShape = BuilderCopy.Shape();
-    m_saveShape = myShape;// save shape for 2nd pass
+    m_saveShape = baseShape;// save shape for 2nd pass
 
     if (debugSection()) {
-        BRepTools::Write(myShape, "DVSCopy.brep");// debug
+        BRepTools::Write(m_cuttingTool, "DVSTool.brep");// debug
     }
 
-    if (debugSection()) {
-        BRepTools::Write(m_cuttingTool, "DVSTool.brep");// debug
+    // the pieces of an earlier cut are only good for the same tool
+    std::vector<double> toolSignature = getToolSignature(m_cuttingTool);
+    if (toolSignature != m_cutCacheTool) {
+        m_cutCache.Clear();
+        m_cutCacheTool = toolSignature;
     }
 
-    // perform the cut. We cut each solid in myShape individually to avoid issues
-    // where a compound BaseShape does not cut correctly.
+    // perform the cut. We cut each solid in baseShape individually to avoid issues
+    // where a compound BaseShape does not cut correctly. Solids that were cut before
+    // with this tool are taken from the cache, the others are cut in parallel.
+    std::vector<TopoDS_Shape> solids;
+    std::vector<TopoDS_Shape> pieces;
+    std::vector<int> toCut;
+    for (TopExp_Explorer expl(baseShape, TopAbs_SOLID); expl.More(); expl.Next()) {
+        solids.push_back(expl.Current());
+        if (m_cutCache.IsBound(expl.Current())) {
+            pieces.push_back(m_cutCache.Find(expl.Current()));
+        }
+        else {
+            pieces.emplace_back();
+            toCut.push_back(static_cast<int>(solids.size()) - 1);
+        }
+    }
+
+    OSD_Parallel::For(0, static_cast<int>(toCut.size()), [&](int i) {
+        // We need to copy the shapes to not modify the BRepstructure, a copy of
+        // the tool for each cut as well since the cuts run at the same time
+        int iSolid = toCut[i];
+        try {
+            BRepBuilderAPI_Copy solidCopy(solids[iSolid]);
+            BRepBuilderAPI_Copy toolCopy(m_cuttingTool);
+            FCBRepAlgoAPI_Cut mkCut(solidCopy.Shape(), toolCopy.Shape());
+            if (mkCut.IsDone()) {
+                pieces[iSolid] = mkCut.Shape();
+            }
+        }
+        catch (Standard_Failure&) {
+            pieces[iSolid].Nullify();
+        }
+    });
+
+    TopTools_DataMapOfShapeShape cutCache;
     BRep_Builder builder;
     TopoDS_Compound cutPieces;
     builder.MakeCompound(cutPieces);
-    TopExp_Explorer expl(myShape, TopAbs_SOLID);
-    for (; expl.More(); expl.Next()) {
-        const TopoDS_Solid& s = TopoDS::Solid(expl.Current());
-        FCBRepAlgoAPI_Cut mkCut(s, m_cuttingTool);
-        if (!mkCut.IsDone()) {
+    for (size_t iSolid = 0; iSolid < solids.size(); iSolid++) {
+        if (pieces[iSolid].IsNull()) {
             Base::Console().warning("DVS: Section cut has failed in %s\n", getNameInDocument());
             continue;
         }
-        builder.Add(cutPieces, mkCut.Shape());
+        cutCache.Bind(solids[iSolid], pieces[iSolid]);
+        builder.Add(cutPieces, pieces[iSolid]);
     }
+    // only keep the solids of this cut
+    m_cutCache.Exchange(cutCache);
 
     // cutPieces contains result of cutting each subshape in baseShape with tool
     m_cutPieces = cutPieces;
@@ -566,6 +605,27 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
     waitingForCut(false);
 }
 
+//! the vertex positions and edge midpoints of a cutting tool. Tools built from the
+//! same parameters have the same signature, so cuts made by one are valid for the other.
+std::vector<double> DrawViewSection::getToolSignature(const TopoDS_Shape& tool)
+{
+    std::vector<double> signature;
+    for (TopExp_Explorer expl(tool, TopAbs_VERTEX); expl.More(); expl.Next()) {
+        gp_Pnt point = BRep_Tool::Pnt(TopoDS::Vertex(expl.Current()));
+        signature.insert(signature.end(), {point.X(), point.Y(), point.Z()});
+    }
+    for (TopExp_Explorer expl(tool, TopAbs_EDGE); expl.More(); expl.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        BRepAdaptor_Curve curve(edge);
+        gp_Pnt point = curve.Value((curve.FirstParameter() + curve.LastParameter()) / 2.0);
+        signature.insert(signature.end(), {point.X(), point.Y(), point.Z()});
+    }
+    return signature;
+}
+
 //! position, scale and rotate shape for buildGeometryObject
 //! save the cut shape for further processing
 TopoDS_Shape DrawViewSection::prepareShape(const TopoDS_Shape& rawShape, double shapeSize)
@@ -25,6 +25,7 @@
 #ifndef DrawViewSection_h_
 #define DrawViewSection_h_
 
+#include <TopTools_DataMapOfShapeShape.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Ax2.hxx>
@@ -189,6 +190,7 @@ protected:
 
 
     virtual gp_Pln getSectionPlane() const;
+    static std::vector<double> getToolSignature(const TopoDS_Shape& tool);
     virtual TopoDS_Compound findSectionPlaneIntersections(const TopoDS_Shape& shape);
     void getParameters();
     bool debugSection() const;
@@ -214,6 +216,10 @@ protected:
     TopoDS_Shape m_cuttingTool;
     double m_shapeSize;
 
+    // cut pieces by source solid, valid as long as the cutting tool stays the same
+    TopTools_DataMapOfShapeShape m_cutCache;
+    std::vector<double> m_cutCacheTool;
+
     static App::PropertyFloatConstraint::Constraints stretchRange;
 
 };
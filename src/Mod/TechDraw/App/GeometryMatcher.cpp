@@ -28,6 +28,8 @@
 #ifndef _PreComp_
 #include <BRepGProp.hxx>
 #include <GProp_GProps.hxx>
+#include <algorithm>
+#include <cmath>
 #endif
 
 #include <BRepAdaptor_Curve.hxx>
@@ -280,3 +282,84 @@ bool GeometryMatcher::compareEndPoints(const TopoDS_Edge& edge1, const TopoDS_Ed
             ends1.second.IsEqual(ends2.second, EWTOLERANCE));
 }
 
+
+void GeometryIndex::add(const Part::TopoShape& shape)
+{
+    size_t index = m_shapes.size();
+    m_shapes.push_back(shape);
+    Base::Vector3d anchor;
+    if (getAnchor(shape, anchor)) {
+        m_cells[getCell(anchor)].push_back(index);
+    }
+    else {
+        m_unanchored.push_back(index);
+    }
+}
+
+std::vector<size_t> GeometryIndex::getCandidates(const Part::TopoShape& shape) const
+{
+    Base::Vector3d anchor;
+    if (!getAnchor(shape, anchor)) {
+        // no anchor, so anything could match
+        std::vector<size_t> all(m_shapes.size());
+        for (size_t index = 0; index < all.size(); index++) {
+            all[index] = index;
+        }
+        return all;
+    }
+
+    // the cells are as big as the tolerance, so a match is in the anchor's cell or a neighbour
+    std::vector<size_t> candidates = m_unanchored;
+    auto [x, y, z] = getCell(anchor);
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                auto found = m_cells.find(Cell(x + dx, y + dy, z + dz));
+                if (found != m_cells.end()) {
+                    candidates.insert(candidates.end(), found->second.begin(), found->second.end());
+                }
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+}
+
+bool GeometryIndex::getAnchor(const Part::TopoShape& shape, Base::Vector3d& anchor)
+{
+    if (shape.isNull()) {
+        return false;
+    }
+    const TopoDS_Shape& geom = shape.getShape();
+    if (geom.ShapeType() == TopAbs_VERTEX) {
+        anchor = Base::convertTo<Base::Vector3d>(BRep_Tool::Pnt(TopoDS::Vertex(geom)));
+        return true;
+    }
+    if (geom.ShapeType() != TopAbs_EDGE) {
+        return false;
+    }
+
+    try {
+        TopoDS_Edge edge = TopoDS::Edge(geom);
+        BRepAdaptor_Curve adapt(edge);
+        if (adapt.GetType() == GeomAbs_Line) {
+            anchor = SU::getEdgeEnds(edge).first;
+            return true;
+        }
+        if (adapt.GetType() == GeomAbs_Circle) {
+            anchor = Base::convertTo<Base::Vector3d>(adapt.Circle().Location());
+            return true;
+        }
+    }
+    catch (Standard_Failure&) {
+        // compared the slow way
+    }
+    return false;
+}
+
+GeometryIndex::Cell GeometryIndex::getCell(const Base::Vector3d& point)
+{
+    return {static_cast<std::int64_t>(std::floor(point.x / EWTOLERANCE)),
+            static_cast<std::int64_t>(std::floor(point.y / EWTOLERANCE)),
+            static_cast<std::int64_t>(std::floor(point.z / EWTOLERANCE))};
+}
@@ -24,6 +24,11 @@
 #ifndef GEOMETRYMATCHER_H
 #define GEOMETRYMATCHER_H
 
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include <DrawViewDimension.h>
@@ -70,5 +75,38 @@ private:
     double m_pointTolerance {EWTOLERANCE};
 };
 
+//! vertices or edges bucketed by an anchor point that compareGeometry requires to be equal
+//! for a match: the point of a vertex, the center of a circle and the first end of a line.
+//! A search then only compares against the entries near the anchor. Ellipses and splines
+//! can match by either their center or their ends, they are candidates for every search.
+class TechDrawExport GeometryIndex
+{
+public:
+    GeometryIndex() = default;
+
+    void add(const Part::TopoShape& shape);
+    //! indexes of the entries that might match shape, in ascending order
+    std::vector<size_t> getCandidates(const Part::TopoShape& shape) const;
+
+    const Part::TopoShape& getShape(size_t index) const
+    {
+        return m_shapes.at(index);
+    }
+    size_t size() const
+    {
+        return m_shapes.size();
+    }
+
+private:
+    using Cell = std::tuple<std::int64_t, std::int64_t, std::int64_t>;
+
+    static bool getAnchor(const Part::TopoShape& shape, Base::Vector3d& anchor);
+    static Cell getCell(const Base::Vector3d& point);
+
+    std::vector<Part::TopoShape> m_shapes;
+    std::map<Cell, std::vector<size_t>> m_cells;
+    std::vector<size_t> m_unanchored;
+};
+
 }  // end namespace TechDraw
 #endif
@@ -143,6 +143,18 @@ void GeometryObject::clear()
 void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
 {
     clear();
+    if (isCancelled()) {
+        return;
+    }
+
+    //views of unchanged shapes reuse the previous HLR output
+    m_hlrKey = HLRCache::makeKey(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+    HLRResult cached;
+    if (HLRCache::find(m_hlrKey, cached)) {
+        setHlrResult(cached);
+        makeTDGeometry();
+        return;
+    }
 
     Handle(HLRBRep_Algo) brep_hlr;
     try {
@@ -159,6 +171,9 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             brep_hlr->Projector(projector);
         }
         brep_hlr->Update();
+        if (isCancelled()) {
+            return;
+        }
         brep_hlr->Hide();
     }
     catch (const Standard_Failure& e) {
@@ -170,6 +185,10 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
         throw Base::RuntimeError("GeometryObject::projectShape - unknown error");
     }
 
+    if (isCancelled()) {
+        return;
+    }
+
     try {
         HLRBRep_HLRToShape hlrToShape(brep_hlr);
 
@@ -244,9 +263,40 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    HLRCache::add(m_hlrKey, getHlrResult());
     makeTDGeometry();
 }
 
+HLRResult GeometryObject::getHlrResult() const
+{
+    HLRResult result;
+    result.visHard = visHard;
+    result.visOutline = visOutline;
+    result.visSmooth = visSmooth;
+    result.visSeam = visSeam;
+    result.visIso = visIso;
+    result.hidHard = hidHard;
+    result.hidOutline = hidOutline;
+    result.hidSmooth = hidSmooth;
+    result.hidSeam = hidSeam;
+    result.hidIso = hidIso;
+    return result;
+}
+
+void GeometryObject::setHlrResult(const HLRResult& result)
+{
+    visHard = result.visHard;
+    visOutline = result.visOutline;
+    visSmooth = result.visSmooth;
+    visSeam = result.visSeam;
+    visIso = result.visIso;
+    hidHard = result.hidHard;
+    hidOutline = result.hidOutline;
+    hidSmooth = result.hidSmooth;
+    hidSeam = result.hidSeam;
+    hidIso = result.hidIso;
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -29,6 +29,7 @@
 
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -41,6 +42,7 @@
 #include <Base/Vector3D.h>
 
 #include "Geometry.h"
+#include "HLRCache.h"
 #include "ShapeUtils.h"
 
 
@@ -113,6 +115,16 @@ public:
     TopoDS_Shape getHidSeam() { return hidSeam; }
     TopoDS_Shape getHidIso() { return hidIso; }
 
+    //! the HLR output and the key of the HLR cache, the key is empty if the cache wasn't used
+    HLRResult getHlrResult() const;
+    void setHlrResult(const HLRResult& result);
+    const std::string& getHlrKey() const { return m_hlrKey; }
+
+    //! ask a running projectShape() to stop early, the geometry of a cancelled projection is
+    //! incomplete and has to be discarded
+    void cancel() { m_cancelled = true; }
+    bool isCancelled() const { return m_cancelled; }
+
     void addVertex(TechDraw::VertexPtr v);
     void addEdge(TechDraw::BaseGeomPtr bg);
 
@@ -165,6 +177,8 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    std::string m_hlrKey;
+    std::atomic<bool> m_cancelled {false};
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <array>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <QByteArray>
+#include <QCryptographicHash>
+#endif
+
+#include "HLRCache.h"
+
+using namespace TechDraw;
+
+namespace
+{
+
+// HLR results can be large, only the most recently used ones are kept
+constexpr std::size_t MaxEntries = 32;
+
+// works for const and non-const results
+template<typename Result>
+auto shapesOf(Result& result)
+{
+    return std::array {&result.visHard,
+                       &result.visOutline,
+                       &result.visSmooth,
+                       &result.visSeam,
+                       &result.visIso,
+                       &result.hidHard,
+                       &result.hidOutline,
+                       &result.hidSmooth,
+                       &result.hidSeam,
+                       &result.hidIso};
+}
+
+struct Cache
+{
+    std::mutex mutex;
+    // most recently used first
+    std::list<std::pair<std::string, HLRResult>> entries;
+    std::unordered_map<std::string, std::list<std::pair<std::string, HLRResult>>::iterator> index;
+};
+
+Cache& getCache()
+{
+    static Cache cache;
+    return cache;
+}
+
+void writeAxis(std::ostream& out, const gp_Ax2& viewAxis)
+{
+    const gp_Pnt& location = viewAxis.Location();
+    const gp_Dir& direction = viewAxis.Direction();
+    const gp_Dir& xDirection = viewAxis.XDirection();
+    out << location.X() << ' ' << location.Y() << ' ' << location.Z() << ' ' << direction.X()
+        << ' ' << direction.Y() << ' ' << direction.Z() << ' ' << xDirection.X() << ' '
+        << xDirection.Y() << ' ' << xDirection.Z() << '\n';
+}
+
+}// namespace
+
+TopoDS_Shape HLRResult::toCompound() const
+{
+    // a null shape can't be added to a compound, so it's stored as an empty one
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (const TopoDS_Shape* shape : shapesOf(*this)) {
+        if (shape->IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(compound, empty);
+        }
+        else {
+            builder.Add(compound, *shape);
+        }
+    }
+    return compound;
+}
+
+bool HLRResult::fromCompound(const TopoDS_Shape& compound)
+{
+    if (compound.IsNull() || compound.ShapeType() != TopAbs_COMPOUND) {
+        return false;
+    }
+    std::vector<TopoDS_Shape> children;
+    for (TopoDS_Iterator it(compound); it.More(); it.Next()) {
+        children.push_back(it.Value());
+    }
+    auto shapes = shapesOf(*this);
+    if (children.size() != shapes.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        TopoDS_Iterator it(children[i]);
+        *shapes[i] = it.More() ? children[i] : TopoDS_Shape();
+    }
+    return true;
+}
+
+//! the serialized geometry is hashed, because the shape handed to the HLR is a new
+//  copy every time and can't be compared by its identity
+std::string HLRCache::makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                              bool perspective, double focus)
+{
+    std::ostringstream out;
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    BRepTools::Write(shape, out);
+    writeAxis(out, viewAxis);
+    out << isoCount << ' ' << perspective << ' ' << focus;
+
+    std::string data = out.str();
+    QByteArray hash = QCryptographicHash::hash(
+        QByteArray::fromRawData(data.c_str(), static_cast<int>(data.size())),
+        QCryptographicHash::Sha1);
+    return hash.toHex().toStdString();
+}
+
+bool HLRCache::find(const std::string& key, HLRResult& result)
+{
+    Cache& cache = getCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.index.find(key);
+    if (it == cache.index.end()) {
+        return false;
+    }
+    cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+    result = it->second->second;
+    return true;
+}
+
+void HLRCache::add(const std::string& key, const HLRResult& result)
+{
+    Cache& cache = getCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.index.find(key);
+    if (it != cache.index.end()) {
+        cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+        it->second->second = result;
+        return;
+    }
+    cache.entries.emplace_front(key, result);
+    cache.index[key] = cache.entries.begin();
+    if (cache.entries.size() > MaxEntries) {
+        cache.index.erase(cache.entries.back().first);
+        cache.entries.pop_back();
+    }
+}
+
+void HLRCache::clear()
+{
+    Cache& cache = getCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.index.clear();
+    cache.entries.clear();
+}
+
+std::size_t HLRCache::capacity()
+{
+    return MaxEntries;
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef TECHDRAW_HLRCACHE_H
+#define TECHDRAW_HLRCACHE_H
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <cstddef>
+#include <string>
+
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax2.hxx>
+
+namespace TechDraw
+{
+
+//! the edge compounds produced by hidden line removal
+struct TechDrawExport HLRResult
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+
+    //! packs the edge compounds into one compound to be saved into the document
+    TopoDS_Shape toCompound() const;
+    //! the reverse of toCompound(), returns false if the shape has not been made by it
+    bool fromCompound(const TopoDS_Shape& compound);
+};
+
+//! a process wide cache of HLR results, so that views of unchanged shapes don't
+//  have to run the hidden line removal again. The cache is used from the HLR threads.
+class TechDrawExport HLRCache
+{
+public:
+    //! the key depends on the geometry of the shape, the view axis and the HLR settings
+    static std::string makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                               bool perspective, double focus);
+
+    static bool find(const std::string& key, HLRResult& result);
+    static void add(const std::string& key, const HLRResult& result);
+    static void clear();
+    //! the number of results kept in the cache
+    static std::size_t capacity();
+};
+
+}// namespace TechDraw
+
+#endif
@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <OSD_Parallel.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS_Shape.hxx>
+#include <QCoreApplication>
+#include <QDomDocument>
+#include <QTextStream>
+#include <QThread>
+#endif
+
+#include <App/Document.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "DrawPage.h"
+#include "DrawProjGroup.h"
+#include "DrawProjGroupItem.h"
+#include "DrawSVGTemplate.h"
+#include "DrawUtil.h"
+#include "DrawViewPart.h"
+#include "Geometry.h"
+#include "GeometryObject.h"
+#include "HLRCache.h"
+#include "PageExporter.h"
+#include "TechDrawExport.h"
+
+using namespace TechDraw;
+
+namespace
+{
+
+//! the edges of a view, collected in the main thread so the pages can be written in others
+struct ViewEdges
+{
+    //! the position of the view origin in SVG coordinates
+    double x;
+    double y;
+    std::vector<TopoDS_Shape> visible;
+    std::vector<TopoDS_Shape> hidden;
+};
+
+struct PageData
+{
+    std::string fileName;
+    double width;
+    double height;
+    std::string templateSvg;
+    std::vector<ViewEdges> views;
+};
+
+std::vector<DrawViewPart*> partViews(DrawPage* page)
+{
+    std::vector<DrawViewPart*> result;
+    for (auto* view : page->getAllViews()) {
+        if (auto* dvp = freecad_cast<DrawViewPart*>(view)) {
+            result.push_back(dvp);
+        }
+    }
+    return result;
+}
+
+//! the root element of the template document, sized to the page in mm
+std::string templateElement(const QString& svg, double width, double height)
+{
+    QDomDocument document;
+    if (svg.isEmpty() || !document.setContent(svg)) {
+        return {};
+    }
+    QDomElement root = document.documentElement();
+    if (!root.hasAttribute(QStringLiteral("viewBox"))) {
+        root.setAttribute(QStringLiteral("viewBox"), QStringLiteral("0 0 %1 %2").arg(width).arg(height));
+    }
+    root.setAttribute(QStringLiteral("x"), 0);
+    root.setAttribute(QStringLiteral("y"), 0);
+    root.setAttribute(QStringLiteral("width"), width);
+    root.setAttribute(QStringLiteral("height"), height);
+
+    QString text;
+    QTextStream stream(&text);
+    root.save(stream, 1);
+    return text.toStdString();
+}
+
+//! the same edges as TechDraw.viewPartAsSvg() and write1ViewDxf() take
+ViewEdges collectEdges(DrawViewPart* dvp, double pageHeight)
+{
+    GeometryObjectPtr gObj = dvp->getGeometryObject();
+
+    double x = dvp->X.getValue();
+    double y = dvp->Y.getValue();
+    if (auto* dpgi = freecad_cast<DrawProjGroupItem*>(dvp)) {
+        if (DrawProjGroup* dpg = dpgi->getPGroup()) {
+            x += dpg->X.getValue();
+            y += dpg->Y.getValue();
+        }
+    }
+    //the geometry has y pointing down like SVG, the page has it pointing up
+    ViewEdges edges {x, pageHeight - y, {}, {}};
+
+    edges.visible = {gObj->getVisHard(), gObj->getVisOutline()};
+    if (dvp->SmoothVisible.getValue()) {
+        edges.visible.push_back(gObj->getVisSmooth());
+    }
+    if (dvp->SeamVisible.getValue()) {
+        edges.visible.push_back(gObj->getVisSeam());
+    }
+    std::vector<TopoDS_Edge> cosmeticEdges;
+    for (auto& geom : dvp->getEdgeGeometry()) {
+        if (geom->getHlrVisible() && geom->getCosmetic()) {
+            cosmeticEdges.push_back(geom->getOCCEdge());
+        }
+    }
+    if (!cosmeticEdges.empty()) {
+        edges.visible.push_back(DrawUtil::vectorToCompound(cosmeticEdges));
+    }
+
+    if (dvp->HardHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidHard());
+        edges.hidden.push_back(gObj->getHidOutline());
+    }
+    if (dvp->SmoothHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidSmooth());
+    }
+    if (dvp->SeamHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidSeam());
+    }
+    return edges;
+}
+
+PageData collectPage(DrawPage* page, const std::string& fileName)
+{
+    // A3 landscape like the GUI uses for pages without a template
+    PageData data {fileName, 420.0, 297.0, {}, {}};
+    if (page->hasValidTemplate()) {
+        data.width = page->getPageWidth();
+        data.height = page->getPageHeight();
+    }
+    if (auto* svgTemplate = freecad_cast<DrawSVGTemplate*>(page->Template.getValue())) {
+        data.templateSvg = templateElement(svgTemplate->processTemplate(), data.width, data.height);
+    }
+    for (auto* dvp : partViews(page)) {
+        if (dvp->hasGeometry() && dvp->getGeometryObject()) {
+            data.views.push_back(collectEdges(dvp, data.height));
+        }
+    }
+    return data;
+}
+
+void writeGroup(std::ostream& out, const std::vector<TopoDS_Shape>& shapes, double lineWidth,
+                const char* dashes)
+{
+    if (shapes.empty()) {
+        return;
+    }
+    out << "<g fill=\"none\" stroke=\"#000000\" stroke-opacity=\"1\" stroke-width=\"" << lineWidth
+        << "\" stroke-linecap=\"butt\" stroke-linejoin=\"miter\" stroke-miterlimit=\"4\"";
+    if (dashes) {
+        out << " stroke-dasharray=\"" << dashes << "\"";
+    }
+    out << ">\n";
+    SVGOutput svgOut;
+    for (auto& shape : shapes) {
+        if (!shape.IsNull()) {
+            out << svgOut.exportEdges(shape);
+        }
+    }
+    out << "</g>\n";
+}
+
+void writePage(const PageData& page, double thick, double thin)
+{
+    Base::FileInfo file(page.fileName);
+    Base::ofstream out(file, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!out) {
+        throw Base::FileException("Cannot open file", file);
+    }
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+        << "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" width=\"" << page.width
+        << "mm\" height=\"" << page.height << "mm\" viewBox=\"0 0 " << page.width << " "
+        << page.height << "\">\n";
+    out << page.templateSvg;
+    for (auto& view : page.views) {
+        out << "<g transform=\"translate(" << view.x << "," << view.y << ")\">\n";
+        writeGroup(out, view.visible, thick, nullptr);
+        writeGroup(out, view.hidden, thin, "2,1");
+        out << "</g>\n";
+    }
+    out << "</svg>\n";
+    out.close();
+    if (!out) {
+        throw Base::FileException("Cannot write file", file);
+    }
+}
+
+}// namespace
+
+void PageExporter::addPage(DrawPage* page, const std::string& fileName)
+{
+    pages.emplace_back(page, fileName);
+}
+
+void PageExporter::exportSvg()
+{
+    updateViews();
+
+    std::vector<PageData> data;
+    for (auto& entry : pages) {
+        data.push_back(collectPage(entry.first, entry.second));
+    }
+    double thick = DrawUtil::getDefaultLineWeight("Thick");
+    double thin = DrawUtil::getDefaultLineWeight("Thin");
+
+    std::vector<std::string> errors(data.size());
+    OSD_Parallel::For(0, static_cast<int>(data.size()), [&](int i) {
+        try {
+            writePage(data[i], thick, thin);
+        }
+        catch (const Base::Exception& e) {
+            errors[i] = e.what();
+        }
+    });
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        if (!errors[i].empty()) {
+            throw Base::FileException(errors[i], data[i].fileName);
+        }
+    }
+}
+
+//! recomputes the outdated views a few at a time, after running their HLR in parallel. The
+//! chunks are smaller than the HLR cache, so the results are still there for the recompute.
+void PageExporter::updateViews()
+{
+    std::vector<DrawViewPart*> outdated;
+    std::set<DrawViewPart*> seen;
+    std::set<App::Document*> documents;
+    for (auto& entry : pages) {
+        documents.insert(entry.first->getDocument());
+        for (auto* dvp : partViews(entry.first)) {
+            if (!seen.insert(dvp).second) {
+                continue;
+            }
+            if (!dvp->hasGeometry()) {
+                dvp->touch();
+            }
+            if (dvp->isTouched() || dvp->mustExecute()) {
+                outdated.push_back(dvp);
+            }
+        }
+    }
+
+    std::size_t chunkSize = std::max<std::size_t>(HLRCache::capacity() / 2, 1);
+    for (std::size_t start = 0; start < outdated.size(); start += chunkSize) {
+        std::size_t end = std::min(start + chunkSize, outdated.size());
+        std::vector<std::function<void()>> jobs;
+        std::map<App::Document*, std::vector<App::DocumentObject*>> chunk;
+        for (std::size_t i = start; i < end; i++) {
+            if (auto job = outdated[i]->makeHlrPrefetch()) {
+                jobs.push_back(std::move(job));
+            }
+            chunk[outdated[i]->getDocument()].push_back(outdated[i]);
+        }
+        OSD_Parallel::For(0, static_cast<int>(jobs.size()), [&jobs](int i) {
+            try {
+                jobs[i]();
+            }
+            catch (const Standard_Failure&) {
+                //the recompute runs the HLR again and reports the error
+            }
+        });
+        for (auto& docViews : chunk) {
+            docViews.first->recompute(docViews.second);
+        }
+        waitForViews();
+    }
+
+    //the pages and the views that weren't prefetched
+    for (auto* doc : documents) {
+        doc->recompute();
+    }
+    waitForViews();
+}
+
+//! with the GUI running the views finish their HLR and face finding in other threads
+void PageExporter::waitForViews() const
+{
+    auto pending = [this] {
+        return std::any_of(pages.begin(), pages.end(), [](const auto& entry) {
+            return entry.first->countPendingViews() > 0;
+        });
+    };
+    while (pending()) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+        QThread::msleep(10);
+    }
+}
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef TECHDRAW_PAGEEXPORTER_H
+#define TECHDRAW_PAGEEXPORTER_H
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace TechDraw
+{
+
+class DrawPage;
+
+/** Writes TechDraw pages to SVG files without the GUI
+ *
+ * The outdated views of the pages are brought up to date first. Their hidden line removal runs
+ * in parallel into the HLR cache, a few views at a time, and the following recompute of the views
+ * takes the results from there. The files are then made from the GeometryObject of the views and
+ * the page template, one page per thread. Only the edges of the part views are written, the
+ * annotations, dimensions and hatches drawn by the GUI are not.
+ */
+class TechDrawExport PageExporter
+{
+public:
+    void addPage(DrawPage* page, const std::string& fileName);
+
+    //! updates the views and writes the files, throws Base::FileException if one can't be written
+    void exportSvg();
+
+private:
+    void updateViews();
+    void waitForViews() const;
+
+    std::vector<std::pair<DrawPage*, std::string>> pages;
+};
+
+}// namespace TechDraw
+
+#endif
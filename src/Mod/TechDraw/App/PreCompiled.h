@@ -33,15 +33,19 @@
 
 // standard
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <list>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // boost
@@ -57,16 +61,22 @@
 // Qt
 #include <QApplication>
 #include <QCollator>
+#include <QCoreApplication>
+#include <QCryptographicHash>
 #include <QDateTime>
 #include <QDomDocument>
 #include <QFile>
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
 #include <Mod/Part/App/OpenCascadeAll.h>
+#include <OSD_Parallel.hxx>
 
 #endif // _PreComp_
 #endif
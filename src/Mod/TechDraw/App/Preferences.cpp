@@ -440,6 +440,18 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 1);
 }
 
+//! maximum number of HLR jobs that run at the same time, 0 uses one per core
+int Preferences::hlrThreadCount()
+{
+    return getPreferenceGroup("HLR")->GetInt("MaxThreads", 0);
+}
+
+//! keep the HLR output in the document, so that opening it doesn't run the HLR again
+bool Preferences::saveHlrResult()
+{
+    return getPreferenceGroup("HLR")->GetBool("SaveResult", false);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
@@ -110,6 +110,8 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static int hlrThreadCount();
+    static bool saveHlrResult();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
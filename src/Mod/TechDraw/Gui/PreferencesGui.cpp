@@ -221,6 +221,12 @@ bool PreferencesGui::multiSelection()
     return greedy || Preferences::getPreferenceGroup("General")->GetBool("multiSelection", false);
 }
 
+//! pan and zoom a bitmap of the last frame instead of repainting all the items
+bool PreferencesGui::interactionCache()
+{
+    return Preferences::getPreferenceGroup("General")->GetBool("InteractionCache", true);
+}
+
 Base::Color PreferencesGui::pageColor()
 {
     Base::Color result;
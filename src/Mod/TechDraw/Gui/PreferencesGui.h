@@ -84,6 +84,7 @@ static Base::Color gridColor();
 static QColor gridQColor();
 static double gridSpacing();
 static bool multiSelection();
+static bool interactionCache();
 
 static QColor       getAccessibleQColor(QColor orig);
 static QColor       lightTextQColor();
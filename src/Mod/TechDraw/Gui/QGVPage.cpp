@@ -168,9 +168,10 @@ public:
 };
 
 QGVPage::QGVPage(ViewProviderPage* vpPage, QGSPage* scenePage, QWidget* parent)
-    : QGraphicsView(parent), m_renderer(RendererType::Native), drawBkg(true), m_vpPage(nullptr),
+    : QGraphicsView(parent), m_renderer(RendererType::Native), drawBkg(true),
+      m_interactionCache(PreferencesGui::interactionCache()), m_settled(true), m_vpPage(nullptr),
       m_scene(scenePage), balloonPlacing(false), m_showGrid(false),
-      m_navStyle(nullptr), d(new Private(this)), toolHandler(nullptr)
+      m_navStyle(nullptr), d(new Private(this)), toolHandler(nullptr), m_pendingViews(0)
 {
     assert(vpPage);
     m_vpPage = vpPage;
@@ -214,6 +215,14 @@ QGVPage::QGVPage(ViewProviderPage* vpPage, QGSPage* scenePage, QWidget* parent)
     initNavigationStyle();
 
     createStandardCursors(devicePixelRatio());
+
+    m_progressTimer.setInterval(250);
+    connect(&m_progressTimer, &QTimer::timeout, this, &QGVPage::updateProgress);
+    m_progressTimer.start();
+
+    m_settleTimer.setSingleShot(true);
+    m_settleTimer.setInterval(150);
+    connect(&m_settleTimer, &QTimer::timeout, this, &QGVPage::settleInteraction);
 }
 
 QGVPage::~QGVPage()
@@ -391,23 +400,57 @@ void QGVPage::setHighQualityAntialiasing(bool highQualityAntialiasing)
 
 void QGVPage::paintEvent(QPaintEvent* event)
 {
-    if (m_renderer == RendererType::Image) {
-        if (m_image.size() != viewport()->size()) {
-            m_image = QImage(viewport()->size(), QImage::Format_ARGB32_Premultiplied);
-        }
-
-        QPainter imagePainter(&m_image);
-        QGraphicsView::render(&imagePainter);
-        imagePainter.end();
-
-        QPainter p(viewport());
-        p.drawImage(0, 0, m_image);
+    if (m_renderer == RendererType::Image
+        || (m_renderer == RendererType::Native && m_interactionCache)) {
+        paintCached();
     }
     else {
         QGraphicsView::paintEvent(event);
     }
 }
 
+//! render the scene into m_image and show it. Painting thousands of edges and hatches is too slow
+//! for zooming and panning a large drawing smoothly, so while the viewport transform changes the
+//! last image is only moved and scaled. The scene is rendered again once the view settles.
+void QGVPage::paintCached()
+{
+    QTransform transform = viewportTransform();
+    qreal dpr = viewport()->devicePixelRatioF();
+    QSize size = viewport()->size() * dpr;
+    bool moved = !m_image.isNull() && m_image.size() == size && transform != m_imageTransform;
+
+    QPainter p(viewport());
+    if (moved && !m_settled) {
+        //a low quality preview, the parts outside of the old image only get the background
+        p.fillRect(viewport()->rect(), *bkgBrush);
+        p.setTransform(m_imageTransform.inverted() * transform);
+        p.drawImage(QPointF(0, 0), m_image);
+        m_settleTimer.start();
+        return;
+    }
+
+    if (m_image.size() != size) {
+        m_image = QImage(size, QImage::Format_ARGB32_Premultiplied);
+        m_image.setDevicePixelRatio(dpr);
+    }
+    QPainter imagePainter(&m_image);
+    imagePainter.setRenderHints(renderHints());
+    QGraphicsView::render(&imagePainter, QRectF(QPointF(0, 0), viewport()->size()));
+    imagePainter.end();
+    m_imageTransform = transform;
+    //the next move after a pause starts with a fresh image
+    m_settled = false;
+
+    p.drawImage(QPointF(0, 0), m_image);
+}
+
+//! the view stopped moving, repaint the scene at the new transform
+void QGVPage::settleInteraction()
+{
+    m_settled = true;
+    viewport()->update();
+}
+
 void QGVPage::contextMenuEvent(QContextMenuEvent* event)
 {
     if (m_navStyle->allowContextMenu(event)) {
@@ -618,6 +661,32 @@ void QGVPage::drawForeground(QPainter* painter, const QRectF& rect)
         painter->drawPath(m_gridPath);
         painter->setPen(savePen);
     }
+
+    if (m_pendingViews > 0) {
+        //a note in the corner of the viewport while views are updated in the background
+        QString text = tr("Updating %n view(s)", nullptr, m_pendingViews);
+        painter->save();
+        painter->resetTransform();
+        QRect box = painter->fontMetrics().boundingRect(text).adjusted(-6, -3, 6, 3);
+        box.moveTopLeft(QPoint(8, 8));
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(QColor(0, 0, 0, 128));
+        painter->drawRoundedRect(box, 4, 4);
+        painter->setPen(Qt::white);
+        painter->drawText(box, Qt::AlignCenter, text);
+        painter->restore();
+    }
+}
+
+//! repaint the progress note when the number of views waiting for a result changes
+void QGVPage::updateProgress()
+{
+    TechDraw::DrawPage* page = getDrawPage();
+    int pending = page ? page->countPendingViews() : 0;
+    if (pending != m_pendingViews) {
+        m_pendingViews = pending;
+        viewport()->update();
+    }
 }
 
 void QGVPage::makeGrid(int gridWidth, int gridHeight, double gridStep)
@@ -30,6 +30,7 @@
 #include <QGraphicsView>
 #include <QLabel>
 #include <QPainterPath>
+#include <QTimer>
 
 #include <Base/Type.h>
 
@@ -164,12 +165,22 @@ protected:
 
     void createStandardCursors(double dpr);
 
+    void updateProgress();
+    void paintCached();
+    void settleInteraction();
+
 private:
     RendererType m_renderer;
 
     bool drawBkg;
     QBrush* bkgBrush;
     QImage m_image;
+    //the viewport transform m_image was rendered with
+    QTransform m_imageTransform;
+    //shows the transformed m_image while the view is panned or zoomed, until it settles
+    bool m_interactionCache;
+    bool m_settled;
+    QTimer m_settleTimer;
     ViewProviderPage* m_vpPage;
 
     bool m_atCursor;
@@ -202,6 +213,10 @@ private:
     QContextMenuEvent* m_saveContextEvent;
 
     std::unique_ptr<TechDrawHandler> toolHandler;
+
+    //polls the page for views updating in the background
+    QTimer m_progressTimer;
+    int m_pendingViews;
 };
 
 }// namespace TechDrawGui
@@ -0,0 +1,281 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# ***************************************************************************
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+import json
+import math
+import os
+import platform
+import shutil
+import sys
+import tempfile
+import time
+import unittest
+
+import FreeCAD as App
+
+
+def _timed(results, key, func, *args):
+    start = time.perf_counter()
+    value = func(*args)
+    results[key] = round((time.perf_counter() - start) * 1000.0, 3)
+    return value
+
+
+def _addPolygon(sketch, center, radius, sides):
+    import Part
+    import Sketcher
+
+    first = sketch.GeometryCount
+    points = []
+    for i in range(sides):
+        angle = 2.0 * math.pi * i / sides
+        x = center[0] + radius * math.cos(angle)
+        y = center[1] + radius * math.sin(angle)
+        points.append(App.Vector(x, y, 0))
+    geometries = [Part.LineSegment(points[i], points[(i + 1) % sides]) for i in range(sides)]
+    sketch.addGeometry(geometries, False)
+    constraints = []
+    for i in range(sides):
+        constraints.append(
+            Sketcher.Constraint("Coincident", first + i, 2, first + (i + 1) % sides, 1)
+        )
+        if i > 0:
+            constraints.append(Sketcher.Constraint("Equal", first, first + i))
+    sketch.addConstraint(constraints)
+
+
+def _addPolygonSketch(doc, name, body, center, radius, sides):
+    sketch = doc.addObject("Sketcher::SketchObject", name)
+    body.addObject(sketch)
+    _addPolygon(sketch, center, radius, sides)
+    return sketch
+
+
+def makePartDesignDocument(doc, count=50):
+    """A body with a base pad and a row of pockets, each one on its own sketch"""
+    body = doc.addObject("PartDesign::Body", "Body")
+    base = _addPolygonSketch(doc, "BaseSketch", body, (count * 5.0, 0), count * 6.0, 4)
+    pad = doc.addObject("PartDesign::Pad", "Pad")
+    body.addObject(pad)
+    pad.Profile = base
+    pad.Length = 10
+    for i in range(count):
+        sketch = _addPolygonSketch(doc, "PocketSketch%d" % i, body, (i * 10.0, 0), 3.0, 6)
+        pocket = doc.addObject("PartDesign::Pocket", "Pocket%d" % i)
+        body.addObject(pocket)
+        pocket.Profile = sketch
+        pocket.Length = 5
+
+
+def makeHoleDocument(doc, count=400):
+    """A plate drilled by a single hole feature on a sketch with many circles"""
+    import Part
+    import Sketcher
+
+    body = doc.addObject("PartDesign::Body", "Body")
+    side = int(math.ceil(math.sqrt(count)))
+    base = _addPolygonSketch(doc, "BaseSketch", body, (side * 5.0, side * 5.0), side * 8.0, 4)
+    pad = doc.addObject("PartDesign::Pad", "Pad")
+    body.addObject(pad)
+    pad.Profile = base
+    pad.Length = 10
+    sketch = doc.addObject("Sketcher::SketchObject", "HoleSketch")
+    body.addObject(sketch)
+    sketch.Placement = App.Placement(App.Vector(0, 0, 10), App.Rotation())
+    circles = []
+    for i in range(count):
+        center = App.Vector((i % side) * 10.0 + 5.0, (i // side) * 10.0 + 5.0, 0)
+        circles.append(Part.Circle(center, App.Vector(0, 0, 1), 2.0))
+    sketch.addGeometry(circles, False)
+    sketch.addConstraint([Sketcher.Constraint("Radius", i, 2.0) for i in range(count)])
+    hole = doc.addObject("PartDesign::Hole", "Hole")
+    body.addObject(hole)
+    hole.Profile = sketch
+    hole.Diameter = 4
+    hole.DepthType = "ThroughAll"
+
+
+def makeSketchDocument(doc, count=100):
+    """A single sketch carrying many constrained polygons"""
+    sketch = doc.addObject("Sketcher::SketchObject", "Sketch")
+    for i in range(count):
+        _addPolygon(sketch, ((i % 10) * 12.0, (i // 10) * 12.0), 5.0, 6)
+
+
+def makePartDocument(doc, count=100):
+    """Primitives combined by booleans, the result is what gets exported"""
+    cylinders = []
+    for i in range(count):
+        cylinder = doc.addObject("Part::Cylinder", "Cylinder%d" % i)
+        cylinder.Radius = 2
+        cylinder.Height = 20
+        cylinder.Placement.Base = App.Vector((i % 10) * 10 + 5, (i // 10) * 10 + 5, -5)
+        cylinders.append(cylinder)
+    box = doc.addObject("Part::Box", "Box")
+    box.Length = 100
+    box.Width = (count // 10 + 1) * 10
+    box.Height = 10
+    tools = doc.addObject("Part::MultiFuse", "Tools")
+    tools.Shapes = cylinders
+    cut = doc.addObject("Part::Cut", "Cut")
+    cut.Base = box
+    cut.Tool = tools
+
+
+def makeMeshDocument(doc, count=200):
+    """A feature holding a finely tessellated sphere"""
+    import Mesh
+
+    feature = doc.addObject("Mesh::Feature", "Mesh")
+    feature.Mesh = Mesh.createSphere(50.0, count)
+
+
+def makeFemDocument(doc, count=20):
+    """A netgen mesh of a block with bores, needs FEM built with netgen"""
+    import ObjectsFem
+
+    makePartDocument(doc, count)
+    analysis = ObjectsFem.makeAnalysis(doc, "Analysis")
+    mesh = ObjectsFem.makeMeshNetgenLegacy(doc, "FEMMesh")
+    mesh.Shape = doc.getObject("Cut")
+    analysis.addObject(mesh)
+
+
+REFERENCE_DOCUMENTS = {
+    "partdesign": makePartDesignDocument,
+    "holes": makeHoleDocument,
+    "sketch": makeSketchDocument,
+    "part": makePartDocument,
+    "mesh": makeMeshDocument,
+    "fem": makeFemDocument,
+}
+
+
+def exportDocument(doc, directory, results):
+    """Export the document's shapes to STEP and its meshes to STL, if there are any"""
+    shapes = [
+        obj
+        for obj in doc.Objects
+        if obj.isDerivedFrom("Part::Feature") and not obj.InList and not obj.Shape.isNull()
+    ]
+    meshes = [obj for obj in doc.Objects if obj.isDerivedFrom("Mesh::Feature")]
+    if shapes:
+        import Import
+
+        path = os.path.join(directory, doc.Name + ".step")
+        _timed(results, "export_step", Import.export, shapes, path)
+        os.remove(path)
+    if meshes:
+        import Mesh
+
+        path = os.path.join(directory, doc.Name + ".stl")
+        _timed(results, "export_stl", Mesh.export, meshes, path)
+        os.remove(path)
+
+
+def benchmarkDocument(fileName, directory):
+    """Time open, recompute, save and export of an existing document"""
+    results = {"document": os.path.basename(fileName)}
+    doc = _timed(results, "open", App.openDocument, fileName)
+    try:
+        for obj in doc.Objects:
+            obj.touch()
+        _timed(results, "recompute", doc.recompute)
+        results["objects"] = len(doc.Objects)
+        path = os.path.join(directory, doc.Name + "_saved.FCStd")
+        _timed(results, "save", doc.saveAs, path)
+        os.remove(path)
+        exportDocument(doc, directory, results)
+    finally:
+        App.closeDocument(doc.Name)
+    return results
+
+
+def benchmarkReference(name, make, directory):
+    """Build one of the reference documents, then run it through benchmarkDocument"""
+    results = {}
+    doc = App.newDocument("Benchmark_" + name)
+    try:
+        _timed(results, "create", make, doc)
+        _timed(results, "initial_recompute", doc.recompute)
+        path = os.path.join(directory, name + ".FCStd")
+        doc.saveAs(path)
+    finally:
+        App.closeDocument(doc.Name)
+    results.update(benchmarkDocument(path, directory))
+    results["document"] = name
+    os.remove(path)
+    return results
+
+
+class BenchmarkTestCase(unittest.TestCase):
+    """
+    Headless performance run over a fixed set of reference documents, not part of the unit tests.
+    Every document is timed through open, recompute, save and export, the timings in milliseconds
+    are written as JSON so that runs of different builds can be compared.
+
+    Intended to be run as "FreeCADCmd -t TestBenchmark --pass <results.json> [<model.FCStd> ...]"
+
+    Without model files the reference documents built by this module are used. Documents whose
+    workbench is missing, e.g. FEM without netgen, are reported with their error and skipped.
+    """
+
+    def setUp(self):
+        self.output = "benchmark.json"
+        self.fileList = []
+        if "--pass" in sys.argv:
+            args = sys.argv[sys.argv.index("--pass") + 1 :]
+            if args and args[0].lower().endswith(".json"):
+                self.output = args.pop(0)
+            self.fileList = args
+        self.directory = tempfile.mkdtemp(prefix="FreeCADBenchmark")
+
+    def tearDown(self):
+        shutil.rmtree(self.directory, ignore_errors=True)
+
+    def testAll(self):
+        runs = []
+        if self.fileList:
+            for fileName in self.fileList:
+                runs.append((fileName, lambda f=fileName: benchmarkDocument(f, self.directory)))
+        else:
+            for name, make in REFERENCE_DOCUMENTS.items():
+                runs.append(
+                    (name, lambda n=name, m=make: benchmarkReference(n, m, self.directory))
+                )
+
+        documents = []
+        for name, run in runs:
+            try:
+                documents.append(run())
+            except Exception as e:
+                documents.append({"document": os.path.basename(name), "error": str(e)})
+            App.Console.PrintMessage("{}\n".format(json.dumps(documents[-1])))
+
+        report = {
+            "version": ".".join(App.Version()[0:3]),
+            "revision": App.Version()[3] if len(App.Version()) > 3 else "",
+            "platform": platform.platform(),
+            "documents": documents,
+        }
+        with open(self.output, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+        self.assertTrue(any("error" not in d for d in documents))
@@ -3,9 +3,25 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObject.h"
+#include "App/DocumentObjectGroup.h"
+#include "App/FeatureTest.h"
+#include "App/Part.h"
+#include "App/PropertyLinks.h"
+#include "App/RecomputeProfile.h"
 #include "App/StringHasher.h"
+#include "Base/Exception.h"
+#include "Base/Interpreter.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
 
@@ -94,4 +110,641 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, recomputeAsyncRecomputesTouchedObjects)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::FeatureTest");
+    auto mainThread = std::this_thread::get_id();
+    std::vector<std::thread::id> signalThreads;
+    auto connection = doc()->signalRecomputedObject.connect([&](const App::DocumentObject&) {
+        signalThreads.push_back(std::this_thread::get_id());
+    });
+
+    // Act
+    bool started = doc()->recomputeAsync();
+    int count = doc()->waitForRecompute();
+
+    // Assert
+    EXPECT_TRUE(started);
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(doc()->isRecomputingAsync());
+    EXPECT_FALSE(obj->isTouched());
+    ASSERT_EQ(signalThreads.size(), 1);
+    EXPECT_EQ(signalThreads.front(), mainThread);
+    connection.disconnect();
+}
+
+TEST_F(DocumentTest, parallelRecomputeNotifiesOnCallingThread)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    hGrp->SetBool("ParallelRecompute", true);
+    doc()->setUndoMode(1);
+    std::vector<App::FeatureTestConcurrent*> features;
+    for (int i = 0; i < 8; ++i) {
+        auto feature = static_cast<App::FeatureTestConcurrent*>(
+            doc()->addObject("App::FeatureTestConcurrent"));
+        feature->Input.setValue(i + 1);
+        features.push_back(feature);
+    }
+    doc()->recompute();
+    doc()->openTransaction("Change");
+    for (auto feature : features) {
+        feature->Input.setValue(feature->Input.getValue() * 10);
+    }
+    auto mainThread = std::this_thread::get_id();
+    std::mutex mutex;
+    std::vector<std::thread::id> signalThreads;
+    auto record = [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        signalThreads.push_back(std::this_thread::get_id());
+    };
+    auto c1 = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property&) { record(); });
+    auto c2 = doc()->signalBeforeChangeObject.connect(
+        [&](const App::DocumentObject&, const App::Property&) { record(); });
+    auto c3 = features.front()->signalChanged.connect(
+        [&](const App::DocumentObject&, const App::Property&) { record(); });
+
+    // Act
+    int count = doc()->recompute();
+    doc()->commitTransaction();
+    c1.disconnect();
+    c2.disconnect();
+    c3.disconnect();
+
+    // Assert: the outputs are computed and their signals are emitted by the calling thread
+    EXPECT_EQ(count, 8);
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        EXPECT_EQ(features[i]->Output.getValue(), int(i + 1) * 20);
+    }
+    EXPECT_FALSE(signalThreads.empty());
+    for (auto id : signalThreads) {
+        EXPECT_EQ(id, mainThread);
+    }
+    EXPECT_TRUE(doc()->getStringHasher()->isThreadSafe());
+
+    // Act
+    doc()->undo();
+
+    // Assert: the undo transaction holds the outputs before the recompute
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        EXPECT_EQ(features[i]->Input.getValue(), int(i + 1));
+        EXPECT_EQ(features[i]->Output.getValue(), int(i + 1) * 2);
+    }
+    hGrp->SetBool("ParallelRecompute", parallel);
+}
+
+TEST_F(DocumentTest, recomputeDocumentsRecomputesConcurrently)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    hGrp->SetBool("ParallelRecompute", true);
+    std::string otherName = App::GetApplication().getUniqueDocumentName("other");
+    auto other = App::GetApplication().newDocument(otherName.c_str(), "testUser");
+    auto first =
+        static_cast<App::FeatureTestConcurrent*>(doc()->addObject("App::FeatureTestConcurrent"));
+    auto second =
+        static_cast<App::FeatureTestConcurrent*>(other->addObject("App::FeatureTestConcurrent"));
+    first->Input.setValue(3);
+    second->Input.setValue(4);
+    std::atomic<int> hookCalls {0};
+    doc()->setMainThreadHook([&hookCalls]() {
+        ++hookCalls;
+    });
+    auto mainThread = std::this_thread::get_id();
+    std::vector<std::thread::id> signalThreads;
+    auto record = [&](const App::DocumentObject&) {
+        signalThreads.push_back(std::this_thread::get_id());
+    };
+    auto c1 = doc()->signalRecomputedObject.connect(record);
+    auto c2 = other->signalRecomputedObject.connect(record);
+
+    // Act
+    int count = App::GetApplication().recomputeDocuments({doc(), other});
+    c1.disconnect();
+    c2.disconnect();
+
+    // Assert: both documents are done, their signals are emitted by the calling thread,
+    // and the hook of the document has been called and is installed again
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(first->Output.getValue(), 6);
+    EXPECT_EQ(second->Output.getValue(), 8);
+    ASSERT_EQ(signalThreads.size(), 2);
+    for (auto id : signalThreads) {
+        EXPECT_EQ(id, mainThread);
+    }
+    EXPECT_GT(hookCalls, 0);
+    int calls = hookCalls;
+    doc()->getMainThreadHook()();
+    EXPECT_EQ(hookCalls, calls + 1);
+    doc()->setMainThreadHook({});
+    App::GetApplication().closeDocument(otherName.c_str());
+    hGrp->SetBool("ParallelRecompute", parallel);
+}
+
+namespace
+{
+std::string documentFile(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / (name + ".FCStd")).string();
+}
+
+// Save a document linking to an object of another one and open it again, which opens the
+// other document partially. Return the file of the other document.
+std::string openWithPartialLink(App::Document* doc)
+{
+    std::string linkedName = App::GetApplication().getUniqueDocumentName("linked");
+    auto linked = App::GetApplication().newDocument(linkedName.c_str(), "testUser");
+    auto source = linked->addObject("App::FeatureTest", "Source");
+    linked->addObject("App::FeatureTest", "Unlinked");
+    auto owner = doc->addObject("App::FeatureTest", "Owner");
+    auto link = static_cast<App::PropertyXLink*>(
+        owner->addDynamicProperty("App::PropertyXLink", "Link"));
+    link->setAllowPartial(true);
+    link->setValue(source);
+
+    std::string linkedFile = documentFile(linkedName);
+    std::string ownerFile = documentFile(doc->getName());
+    linked->saveAs(linkedFile.c_str());
+    doc->saveAs(ownerFile.c_str());
+    App::GetApplication().closeDocument(doc->getName());
+    App::GetApplication().closeDocument(linked->getName());
+    App::GetApplication().openDocument(ownerFile.c_str());
+    return linkedFile;
+}
+}  // namespace
+
+TEST_F(DocumentTest, loadPartialDocumentsLoadsAllObjects)
+{
+    // Arrange
+    std::string ownerFile = documentFile(doc()->getName());
+    std::string linkedFile = openWithPartialLink(doc());
+    auto partial = App::GetApplication().getDocumentByPath(linkedFile.c_str());
+    ASSERT_NE(partial, nullptr);
+    ASSERT_TRUE(partial->testStatus(App::Document::PartialDoc));
+    EXPECT_EQ(partial->getObject("Unlinked"), nullptr);
+
+    // Act
+    auto loaded = App::GetApplication().loadPartialDocuments({partial});
+
+    // Assert
+    ASSERT_EQ(loaded.size(), 1);
+    ASSERT_NE(loaded.front(), nullptr);
+    EXPECT_FALSE(loaded.front()->testStatus(App::Document::PartialDoc));
+    EXPECT_NE(loaded.front()->getObject("Unlinked"), nullptr);
+    EXPECT_EQ(App::GetApplication().getDocumentByPath(linkedFile.c_str()), loaded.front());
+    App::GetApplication().closeDocument(loaded.front()->getName());
+    if (auto owner = App::GetApplication().getDocumentByPath(ownerFile.c_str())) {
+        App::GetApplication().closeDocument(owner->getName());
+    }
+    std::filesystem::remove(linkedFile);
+    std::filesystem::remove(ownerFile);
+}
+
+TEST_F(DocumentTest, recomputeDocumentsKeepsUnsavedDocuments)
+{
+    // Arrange: a touched partial document is reloaded by the recompute
+    std::string ownerFile = documentFile(doc()->getName());
+    std::string linkedFile = openWithPartialLink(doc());
+    auto owner = App::GetApplication().getDocumentByPath(ownerFile.c_str());
+    auto partial = App::GetApplication().getDocumentByPath(linkedFile.c_str());
+    ASSERT_NE(owner, nullptr);
+    ASSERT_NE(partial, nullptr);
+    ASSERT_TRUE(partial->testStatus(App::Document::PartialDoc));
+    partial->getObject("Source")->touch();
+    std::string unsavedName = App::GetApplication().getUniqueDocumentName("unsaved");
+    auto unsaved = App::GetApplication().newDocument(unsavedName.c_str(), "testUser");
+    auto feature = unsaved->addObject("App::FeatureTest");
+
+    // Act
+    App::GetApplication().recomputeDocuments({owner, unsaved, partial});
+
+    // Assert
+    auto loaded = App::GetApplication().getDocumentByPath(linkedFile.c_str());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_FALSE(loaded->testStatus(App::Document::PartialDoc));
+    EXPECT_FALSE(loaded->getObject("Source")->isTouched());
+    EXPECT_FALSE(feature->isTouched());
+    App::GetApplication().closeDocument(unsavedName.c_str());
+    App::GetApplication().closeDocument(loaded->getName());
+    App::GetApplication().closeDocument(owner->getName());
+    std::filesystem::remove(linkedFile);
+    std::filesystem::remove(ownerFile);
+}
+
+TEST_F(DocumentTest, saveAsyncKeepsFileWhenAborted)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool backupPolicy = hGrp->GetBool("BackupPolicy", true);
+    hGrp->SetBool("BackupPolicy", false);
+    std::string file = documentFile(doc()->getName());
+    doc()->FileName.setValue(file);
+    doc()->addObject("App::FeatureTest");
+    int started = 0;
+    int finished = 0;
+    auto c1 = doc()->signalStartSave.connect([&](const App::Document&, const std::string&) {
+        ++started;
+    });
+    auto c2 = doc()->signalFinishSave.connect([&](const App::Document&, const std::string&) {
+        ++finished;
+    });
+    auto readFile = [&file]() {
+        std::ifstream stream(file, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), {});
+    };
+
+    // Act
+    ASSERT_TRUE(doc()->saveAsync());
+    bool saved = doc()->waitForSave();
+
+    // Assert
+    EXPECT_TRUE(saved);
+    EXPECT_EQ(started, 1);
+    EXPECT_EQ(finished, 1);
+    std::string content = readFile();
+    EXPECT_FALSE(content.empty());
+
+    // Act: abort a second save, the worker may have been done already
+    for (int i = 0; i < 1000; ++i) {
+        doc()->addObject("App::FeatureTest");
+    }
+    ASSERT_TRUE(doc()->saveAsync());
+    doc()->abortSave();
+    bool replaced = doc()->waitForSave();
+
+    // Assert: the signals are paired and an aborted save keeps the file
+    EXPECT_EQ(started, 2);
+    EXPECT_EQ(finished, 2);
+    EXPECT_EQ(readFile() == content, !replaced);
+    EXPECT_FALSE(doc()->waitForSave());
+    c1.disconnect();
+    c2.disconnect();
+    std::filesystem::remove(file);
+    hGrp->SetBool("BackupPolicy", backupPolicy);
+}
+
+TEST_F(DocumentTest, recomputeAsyncLocksDocument)
+{
+    // Arrange: the hook keeps the worker waiting for the main thread
+    auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    bool hooked = false;
+    doc()->setPreRecomputeHook([&]() { hooked = true; });
+
+    // Act
+    doc()->recomputeAsync();
+
+    // Assert
+    EXPECT_THROW(doc()->addObject("App::FeatureTest"), Base::RuntimeError);
+    EXPECT_THROW(obj->Integer.setValue(1), Base::RuntimeError);
+    EXPECT_EQ(doc()->waitForRecompute(), 1);
+    EXPECT_TRUE(hooked);
+    EXPECT_NO_THROW(obj->Integer.setValue(1));
+    doc()->setPreRecomputeHook({});
+}
+
+TEST_F(DocumentTest, waitForRecomputeWithoutRecompute)
+{
+    // Act
+    int count = doc()->waitForRecompute();
+
+    // Assert
+    EXPECT_EQ(count, 0);
+    EXPECT_FALSE(doc()->isRecomputingAsync());
+}
+
+TEST_F(DocumentTest, recomputeProfileRecordsExecutedObjects)
+{
+    // Arrange
+    auto obj = freecad_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    ASSERT_TRUE(obj);
+    doc()->recompute();
+    obj->Integer.setValue(3);
+
+    // Act
+    doc()->recompute();
+    auto entries = doc()->getRecomputeProfile().getEntries();
+
+    // Assert
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries.front().name, obj->getNameInDocument());
+    EXPECT_EQ(entries.front().type, "App::FeatureTest");
+    EXPECT_EQ(entries.front().thread, 0);
+    EXPECT_FALSE(entries.front().failed);
+    EXPECT_THAT(entries.front().touched, ::testing::Contains(std::string("Integer")));
+    EXPECT_GE(doc()->getRecomputeProfile().getDuration(), entries.front().duration);
+}
+
+TEST_F(DocumentTest, recomputeProfileStopsOnException)
+{
+    // Arrange
+    doc()->addObject("App::FeatureTest");
+    doc()->setPreRecomputeHook([]() {
+        throw std::runtime_error("hook failed");
+    });
+
+    // Act
+    EXPECT_THROW(doc()->recompute(), std::runtime_error);
+    doc()->setPreRecomputeHook({});
+
+    // Assert
+    EXPECT_FALSE(doc()->getRecomputeProfile().isRecording());
+}
+
+TEST_F(DocumentTest, exportRecomputeProfile)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::FeatureTest");
+    doc()->recompute();
+    std::ostringstream chrome;
+    std::ostringstream speedscope;
+
+    // Act
+    const auto& profile = doc()->getRecomputeProfile();
+    profile.exportProfile(chrome, App::RecomputeProfile::Format::ChromeTrace);
+    profile.exportProfile(speedscope, App::RecomputeProfile::Format::Speedscope);
+
+    // Assert
+    EXPECT_THAT(chrome.str(), ::testing::HasSubstr("\"traceEvents\""));
+    EXPECT_THAT(chrome.str(), ::testing::HasSubstr(obj->getNameInDocument()));
+    EXPECT_THAT(speedscope.str(), ::testing::HasSubstr("\"type\":\"evented\""));
+    EXPECT_THAT(speedscope.str(), ::testing::HasSubstr(obj->getNameInDocument()));
+}
+
+TEST_F(DocumentTest, typeHierarchy)
+{
+    Base::Type test = App::FeatureTest::getClassTypeId();
+    Base::Type exception = App::FeatureTestException::getClassTypeId();
+    Base::Type group = App::DocumentObjectGroup::getClassTypeId();
+
+    EXPECT_TRUE(exception.isDerivedFrom(test));
+    EXPECT_TRUE(exception.isDerivedFrom(App::DocumentObject::getClassTypeId()));
+    EXPECT_TRUE(exception.isDerivedFrom(Base::BaseClass::getClassTypeId()));
+    EXPECT_TRUE(test.isDerivedFrom(test));
+    EXPECT_FALSE(test.isDerivedFrom(exception));
+    EXPECT_FALSE(exception.isDerivedFrom(group));
+    EXPECT_FALSE(test.isDerivedFrom(Base::Type::BadType));
+    EXPECT_FALSE(Base::Type::BadType.isDerivedFrom(test));
+}
+
+TEST_F(DocumentTest, getObjectsOfType)
+{
+    // Arrange
+    auto test1 = doc()->addObject("App::FeatureTest");
+    auto exception1 = doc()->addObject("App::FeatureTestException");
+    auto group = doc()->addObject("App::DocumentObjectGroup");
+    auto test2 = doc()->addObject("App::FeatureTest");
+    auto exception2 = doc()->addObject("App::FeatureTestException");
+    auto test3 = doc()->addObject("App::FeatureTest");
+    doc()->removeObject(test2->getNameInDocument());
+
+    // Act
+    auto tests = doc()->getObjectsOfType(App::FeatureTest::getClassTypeId());
+    auto exceptions = doc()->getObjectsOfType<App::FeatureTestException>();
+    auto several = doc()->getObjectsOfType(
+        std::vector<Base::Type> {App::DocumentObjectGroup::getClassTypeId(),
+                                 App::FeatureTestException::getClassTypeId(),
+                                 App::FeatureTest::getClassTypeId()});
+
+    // Assert: the objects are in the order of the document
+    using Objects = std::vector<App::DocumentObject*>;
+    EXPECT_EQ(tests, (Objects {test1, exception1, exception2, test3}));
+    EXPECT_EQ(exceptions.size(), 2);
+    EXPECT_EQ(exceptions.front(), exception1);
+    EXPECT_EQ(several, (Objects {test1, exception1, group, exception2, test3}));
+    EXPECT_EQ(doc()->countObjectsOfType<App::FeatureTest>(), 4);
+    EXPECT_EQ(doc()->countObjectsOfType("App::FeatureTestException"), 2);
+    EXPECT_EQ(doc()->countObjectsOfType("App::FeatureTestColumn"), 0);
+    EXPECT_EQ(doc()->findObjects(App::FeatureTest::getClassTypeId(),
+                                 exception2->getNameInDocument(),
+                                 nullptr),
+              (Objects {exception2}));
+}
+
+TEST_F(DocumentTest, getSubObjectCached)
+{
+    // Arrange
+    auto part = static_cast<App::Part*>(doc()->addObject("App::Part"));
+    auto child = static_cast<App::Part*>(doc()->addObject("App::Part"));
+    part->addObject(child);
+    part->Placement.setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    child->Placement.setValue(Base::Placement(Base::Vector3d(0, 2, 0), Base::Rotation()));
+    std::string subname = std::string(child->getNameInDocument()) + ".";
+    Base::Matrix4D offset;
+    offset.move(Base::Vector3d(0, 0, 3));
+    doc()->resetResolutionCacheStats();
+
+    // Act
+    Base::Matrix4D expected = offset;
+    auto resolved = part->getSubObject(subname.c_str(), nullptr, &expected);
+    Base::Matrix4D first = offset;
+    part->getSubObjectCached(subname.c_str(), &first);
+    Base::Matrix4D second = offset;
+    auto cached = part->getSubObjectCached(subname.c_str(), &second);
+    auto stats = doc()->getResolutionCacheStats();
+
+    // Assert: the cached transformation applies to any input matrix
+    EXPECT_EQ(resolved, child);
+    EXPECT_EQ(cached, child);
+    EXPECT_EQ(first, expected);
+    EXPECT_EQ(second, expected);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+    EXPECT_EQ(part->getSubObjectCached("Invalid."), nullptr);
+
+    // Act: a change of a placement drops the cache
+    child->Placement.setValue(Base::Placement(Base::Vector3d(0, 5, 0), Base::Rotation()));
+    Base::Matrix4D changed;
+    part->getSubObjectCached(subname.c_str(), &changed);
+
+    // Assert
+    EXPECT_EQ(changed.getCol(3), Base::Vector3d(1, 5, 0));
+    EXPECT_EQ(doc()->getResolutionCacheStats().misses, 3);
+    EXPECT_EQ(doc()->getResolutionCacheStats().entries, 1);
+}
+
+TEST_F(DocumentTest, getLinkedObjectCachedWithPythonOverride)
+{
+    // Arrange: a proxy that assigns the matrix instead of multiplying it
+    std::string cmd = "import FreeCAD\n"
+                      "class AbsoluteLink:\n"
+                      "    def getLinkedObject(self, obj, recurse, matrix, transform, depth):\n"
+                      "        mat = FreeCAD.Matrix()\n"
+                      "        mat.move(FreeCAD.Vector(7, 0, 0))\n"
+                      "        return (obj, mat)\n"
+                      "obj = FreeCAD.getDocument('"
+        + std::string(doc()->getName())
+        + "').addObject('App::FeaturePython', 'Absolute')\n"
+          "obj.Proxy = AbsoluteLink()\n";
+    Base::Interpreter().runString(cmd.c_str());
+    auto feature = doc()->getObject("Absolute");
+    ASSERT_NE(feature, nullptr);
+    Base::Matrix4D offset;
+    offset.move(Base::Vector3d(0, 0, 3));
+    doc()->resetResolutionCacheStats();
+
+    // Act
+    Base::Matrix4D expected = offset;
+    auto linked = feature->getLinkedObject(true, &expected);
+    Base::Matrix4D first = offset;
+    feature->getLinkedObjectCached(true, &first);
+    Base::Matrix4D second = offset;
+    auto cached = feature->getLinkedObjectCached(true, &second);
+
+    // Assert: the results match the uncached ones and none comes from the cache
+    EXPECT_EQ(linked, feature);
+    EXPECT_EQ(cached, feature);
+    EXPECT_EQ(expected.getCol(3), Base::Vector3d(7, 0, 0));
+    EXPECT_EQ(first, expected);
+    EXPECT_EQ(second, expected);
+    EXPECT_EQ(doc()->getResolutionCacheStats().hits, 0);
+}
+
+TEST_F(DocumentTest, undoOfTrimmedListChange)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    std::vector<double> values(100000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = double(i);
+    }
+    feature->FloatList.setValues(values);
+
+    // Act: change one element
+    doc()->openTransaction("Change");
+    feature->FloatList.set1Value(500, -1.0);
+    doc()->commitTransaction();
+
+    // Assert: the undo step only keeps the changed element
+    EXPECT_LT(doc()->getUndoMemSize(), values.size() * sizeof(double) / 10);
+    EXPECT_EQ(doc()->getTransactionMemSize(true), doc()->getUndoMemSize());
+
+    // Act
+    doc()->undo();
+
+    // Assert
+    EXPECT_EQ(feature->FloatList.getValues(), values);
+
+    // Act
+    doc()->redo();
+
+    // Assert
+    EXPECT_EQ(feature->FloatList[500], -1.0);
+    EXPECT_EQ(feature->FloatList[501], 501.0);
+    EXPECT_EQ(feature->FloatList.getSize(), int(values.size()));
+}
+
+TEST_F(DocumentTest, undoOfListChangedOutsideTransaction)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    feature->FloatList.setValues(std::vector<double>(100000, 1.0));
+    doc()->openTransaction("Change");
+    feature->FloatList.set1Value(0, 2.0);
+    doc()->commitTransaction();
+
+    // Act: the shared elements are gone, so the change cannot be undone
+    feature->FloatList.set1Value(99999, 3.0);
+    doc()->undo();
+
+    // Assert
+    EXPECT_EQ(feature->FloatList[0], 2.0);
+}
+
+TEST_F(DocumentTest, undoMemoryLimit)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    const std::size_t size = 10000;
+    doc()->setUndoLimit(3 * size * sizeof(double));
+
+    // Act: every step replaces all values
+    for (int i = 0; i < 10; i++) {
+        doc()->openTransaction("Change");
+        feature->FloatList.setValues(std::vector<double>(size, double(i)));
+        doc()->commitTransaction();
+    }
+
+    // Assert: the oldest steps are gone
+    EXPECT_LE(doc()->getAvailableUndos(), 3);
+    EXPECT_GE(doc()->getAvailableUndos(), 1);
+    EXPECT_LE(doc()->getUndoMemSize(), doc()->getUndoLimit());
+    doc()->undo();
+    EXPECT_EQ(feature->FloatList[0], 8.0);
+}
+
+TEST_F(DocumentTest, objectBatchDefersSignals)
+{
+    // Arrange
+    int single = 0;
+    std::vector<std::size_t> batches;
+    auto c1 = doc()->signalNewObject.connect([&](const App::DocumentObject&) { ++single; });
+    auto c2 = doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objs) { batches.push_back(objs.size()); });
+
+    // Act
+    {
+        App::Document::ObjectBatch batch(doc());
+        doc()->addObjects({"App::FeatureTest", "App::DocumentObjectGroup", "App::FeatureTest"},
+                          {"First", "", "Removed"});
+        doc()->addObject("App::FeatureTest", "Last");
+        EXPECT_TRUE(doc()->isBatchingObjects());
+        EXPECT_EQ(single, 0);
+        doc()->removeObject("Removed");
+    }
+
+    // Assert: one announcement per remaining object, then one for all of them
+    EXPECT_FALSE(doc()->isBatchingObjects());
+    EXPECT_EQ(single, 3);
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches.front(), 3);
+    EXPECT_NE(doc()->getObject("First"), nullptr);
+    EXPECT_EQ(doc()->getObjectsOfType(App::DocumentObjectGroup::getClassTypeId()).size(), 1);
+    c1.disconnect();
+    c2.disconnect();
+}
+
+TEST_F(DocumentTest, addObjectsRejectsBadType)
+{
+    // Act / Assert: nothing is added if any type is wrong
+    EXPECT_THROW(doc()->addObjects({"App::FeatureTest", "Base::Vector3d"}, {"", ""}),
+                 Base::TypeError);
+    EXPECT_TRUE(doc()->getObjects().empty());
+}
+
+TEST_F(DocumentTest, memoryReport)
+{
+    // Arrange
+    auto small = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    auto large = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    large->FloatList.setValues(std::vector<double>(10000, 1.0));
+
+    // Act
+    auto report = doc()->getMemoryReport();
+
+    // Assert: the largest object and property come first and everything adds up
+    ASSERT_EQ(report.objects.size(), 2);
+    EXPECT_EQ(report.objects[0].object, large);
+    EXPECT_EQ(report.objects[1].object, small);
+    ASSERT_FALSE(report.objects[0].properties.empty());
+    EXPECT_EQ(report.objects[0].properties.front().first, "FloatList");
+    EXPECT_GE(report.objects[0].properties.front().second, 10000 * sizeof(double));
+    std::size_t sum = report.properties + report.hasher + report.undo;
+    for (const auto& entry : report.objects) {
+        sum += entry.total;
+    }
+    EXPECT_EQ(report.total, sum);
+}
+
 // NOLINTEND(readability-magic-numbers)
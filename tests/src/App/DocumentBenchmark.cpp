@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings of the document life cycle, see src/BenchmarkHelpers.h. Workbench documents are timed
+// by Mod/Test/TestBenchmark.py.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/Expression.h>
+#include <App/FeatureTest.h>
+#include <App/ObjectIdentifier.h>
+#include <src/App/InitApplication.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+// a chain of objects, each one links to its predecessor and takes its value by an expression
+void fillDocument(App::Document* doc, int count)
+{
+    App::FeatureTest* prev = nullptr;
+    for (int i = 0; i < count; ++i) {
+        auto obj = static_cast<App::FeatureTest*>(
+            doc->addObject("App::FeatureTest", ("Feature" + std::to_string(i)).c_str()));
+        if (prev) {
+            obj->Link.setValue(prev);
+            std::string expr = std::string(prev->getNameInDocument()) + ".Integer + 1";
+            std::shared_ptr<App::Expression> expression(App::Expression::parse(obj, expr));
+            obj->setExpression(App::ObjectIdentifier::parse(obj, "Integer"), expression);
+        }
+        prev = obj;
+    }
+}
+
+}  // namespace
+
+class DocumentBenchmark: public ::testing::TestWithParam<int>
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_P(DocumentBenchmark, lifeCycle)  // NOLINT
+{
+    int count = GetParam();
+    RecordProperty("objects", count);
+    std::string name = App::GetApplication().getUniqueDocumentName("benchmark");
+    std::string file = (std::filesystem::temp_directory_path() / (name + ".FCStd")).string();
+
+    auto start = std::chrono::steady_clock::now();
+    App::Document* doc = App::GetApplication().newDocument(name.c_str(), "benchmark");
+    fillDocument(doc, count);
+    tests::record("create", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    doc->recompute();
+    tests::record("recompute", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(doc->saveAs(file.c_str()));
+    tests::record("save", tests::elapsedMilliseconds(start));
+    App::GetApplication().closeDocument(doc->getName());
+
+    start = std::chrono::steady_clock::now();
+    doc = App::GetApplication().openDocument(file.c_str());
+    tests::record("open", tests::elapsedMilliseconds(start));
+    ASSERT_NE(doc, nullptr);
+
+    for (auto obj : doc->getObjects()) {
+        obj->touch();
+    }
+    start = std::chrono::steady_clock::now();
+    doc->recompute();
+    tests::record("recompute_after_open", tests::elapsedMilliseconds(start));
+
+    auto first = static_cast<App::FeatureTest*>(doc->getObject("Feature0"));
+    auto last = static_cast<App::FeatureTest*>(
+        doc->getObject(("Feature" + std::to_string(count - 1)).c_str()));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last->Integer.getValue(), first->Integer.getValue() + count - 1);
+
+    App::GetApplication().closeDocument(doc->getName());
+    std::filesystem::remove(file);
+}
+
+INSTANTIATE_TEST_SUITE_P(Objects,
+                         DocumentBenchmark,
+                         ::testing::Values(1000, 10000),
+                         [](const ::testing::TestParamInfo<int>& info) {
+                             return "Objects" + std::to_string(info.param);
+                         });
@@ -3,11 +3,14 @@
 #include "gtest/gtest.h"
 #include <gmock/gmock.h>
 
+#include <algorithm>
+
 #include <src/App/InitApplication.h>
 
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
+#include <App/DocumentObjectGroup.h>
 #include <App/GeoFeatureGroupExtension.h>
 #include <Base/Interpreter.h>
 
@@ -155,4 +158,51 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, recursiveListsFollowLinkChanges)
+{
+    // Arrange
+    auto outer = static_cast<DocumentObjectGroup*>(_doc->addObject("App::DocumentObjectGroup"));
+    auto inner = static_cast<DocumentObjectGroup*>(_doc->addObject("App::DocumentObjectGroup"));
+    auto leaf = _doc->addObject("App::FeatureTest");
+    outer->addObject(inner);
+    inner->addObject(leaf);
+    using Objects = std::vector<DocumentObject*>;
+    auto sorted = [](Objects objs) {
+        std::sort(objs.begin(), objs.end());
+        return objs;
+    };
+
+    // Act: the second queries are answered from the cache
+    auto inList = leaf->getInListRecursive();
+    auto inListCached = leaf->getInListRecursive();
+    auto outList = outer->getOutListRecursive();
+    auto outListCached = outer->getOutListRecursive();
+    auto deps = Document::getDependencyList({outer}, Document::DepSort);
+    auto depsCached = Document::getDependencyList({outer}, Document::DepSort);
+
+    // Assert
+    EXPECT_EQ(inList, (Objects {inner, outer}));
+    EXPECT_EQ(inListCached, inList);
+    EXPECT_EQ(outList, sorted({inner, leaf}));
+    EXPECT_EQ(outListCached, outList);
+    EXPECT_EQ(deps, (Objects {leaf, inner, outer}));
+    EXPECT_EQ(depsCached, deps);
+    EXPECT_TRUE(leaf->isInInListRecursive(outer));
+    EXPECT_TRUE(outer->isInOutListRecursive(leaf));
+    EXPECT_FALSE(leaf->testIfLinkDAGCompatible(outer));
+
+    // Act: a link change drops the cached lists
+    inner->removeObject(leaf);
+    outer->addObject(leaf);
+
+    // Assert
+    EXPECT_EQ(leaf->getInListRecursive(), (Objects {outer}));
+    EXPECT_EQ(inner->getOutListRecursive(), Objects {});
+    EXPECT_EQ(outer->getOutListRecursive(), sorted({inner, leaf}));
+    EXPECT_FALSE(leaf->isInInListRecursive(inner));
+    EXPECT_FALSE(inner->isInOutListRecursive(leaf));
+    EXPECT_TRUE(inner->testIfLinkDAGCompatible(leaf));
+    EXPECT_EQ(Document::getDependencyList({inner}, Document::DepSort), (Objects {inner}));
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
@@ -159,6 +159,51 @@ TEST_F(ElementMapTest, setElementNameWithHashing)
     EXPECT_EQ(mappedToElement, expectedName);
 }
 
+TEST_F(ElementMapTest, setElementNameSharesPostfix)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::IndexedName edge1("Edge", 1);
+    Data::IndexedName edge2("Edge", 2);
+    Data::MappedName name1("Edge1");
+    Data::MappedName name2("Edge2");
+    name1 += ";:H1:7,E";
+    name2 += ";:H1:7,E";
+    ASSERT_NE(name1.constPostfix(), name2.constPostfix());
+
+    // Act
+    elementMap.setElementName(edge1, name1, 0);
+    elementMap.setElementName(edge2, name2, 0);
+    auto mappedName1 = elementMap.find(edge1);
+    auto mappedName2 = elementMap.find(edge2);
+
+    // Assert
+    EXPECT_EQ(mappedName1, name1);
+    EXPECT_EQ(mappedName2, name2);
+    EXPECT_EQ(mappedName1.constPostfix(), mappedName2.constPostfix());
+}
+
+TEST_F(ElementMapTest, setElementNames)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    std::vector<Data::ElementMap::ElementName> names {
+        {Data::IndexedName("Edge", 3), Data::MappedName("EDGE3"), {}},
+        {Data::IndexedName("Face", 1), Data::MappedName("FACE1"), {}},
+        {Data::IndexedName("Edge", 1), Data::MappedName("EDGE1"), {}}};
+
+    // Act
+    elementMap.setElementNames(names, 0);
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), 3);
+    EXPECT_EQ(names[0].name, Data::MappedName("EDGE3"));
+    EXPECT_EQ(elementMap.find(Data::IndexedName("Edge", 3)), Data::MappedName("EDGE3"));
+    EXPECT_EQ(elementMap.find(Data::IndexedName("Edge", 1)), Data::MappedName("EDGE1"));
+    EXPECT_EQ(elementMap.find(Data::IndexedName("Face", 1)), Data::MappedName("FACE1"));
+    EXPECT_FALSE(elementMap.find(Data::IndexedName("Edge", 2)));
+}
+
 TEST_F(ElementMapTest, eraseMappedName)
 {
     // Arrange
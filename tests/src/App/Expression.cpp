@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
 
+#include "Base/Interpreter.h"
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/DocumentObject.h"
 #include "App/ExpressionParser.h"
 #include "App/ExpressionTokenizer.h"
+#include "App/PropertyUnits.h"
+
+#include "src/App/InitApplication.h"
 
 // clang-format off
 TEST(Expression, tokenize)
@@ -288,4 +296,119 @@ TEST(Expression, test_e_rad)
     EXPECT_EQ(op->toString(), "e rad");
     op.release();
 }
+
+class ExpressionNumericTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _obj = _doc->addObject("App::VarSet", "Params");
+        static_cast<App::PropertyFloat*>(_obj->addDynamicProperty("App::PropertyFloat", "f"))->setValue(2.5);
+        static_cast<App::PropertyInteger*>(_obj->addDynamicProperty("App::PropertyInteger", "i"))->setValue(7);
+        static_cast<App::PropertyBool*>(_obj->addDynamicProperty("App::PropertyBool", "b"))->setValue(true);
+        static_cast<App::PropertyLength*>(_obj->addDynamicProperty("App::PropertyLength", "len"))->setValue(10.0);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc() { return _doc; }
+    App::DocumentObject* obj() { return _obj; }
+
+    std::unique_ptr<App::Expression> parse(const std::string& text)
+    {
+        return std::unique_ptr<App::Expression>(App::Expression::parse(_obj, text));
+    }
+
+    // the numeric evaluation has to give the same value and type as Python
+    void expectSameAsPython(const std::string& text)
+    {
+        auto expr = parse(text);
+        App::Expression::NumericValue value;
+        EXPECT_TRUE(expr->getNumericValue(value)) << text;
+
+        App::any numeric = expr->getValueAsAny();
+        App::any python;
+        {
+            Base::PyGILStateLocker lock;
+            python = App::pyObjectToAny(expr->getPyValue());
+        }
+        EXPECT_TRUE(numeric.type() == python.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(numeric, python)) << text;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::DocumentObject* _obj {};
+};
+
+TEST_F(ExpressionNumericTest, sameAsPython) // NOLINT
+{
+    for (const char* text : {"1 + 2", "7 / 2", "8 / 2", "-7 % 3", "7.5 % -2", "2 ^ 10",
+                             "2 ^ -1", "2.5 ^ 2", "-i", "+b", "i * 2", "i / 2", "f * 4",
+                             "b + 1", "False + 1", "pi", "len * 2", "len + 1 mm", "2 mm * i",
+                             "len / 5 mm", "len ^ 2", "-len", "len > 5 mm", "len == 10 mm",
+                             "i < f", "b ? i : f", "len > 20 mm ? 1 : 2.5", "sin(30 deg)",
+                             "sqrt(len * len)", "hypot(3; 4)", "pow(2; 3)", "mod(7; 3)",
+                             "round(f)", "href(i) + 1", "Params.len + len", "<<Params>>.f * 2"}) {
+        expectSameAsPython(text);
+    }
+}
+
+TEST_F(ExpressionNumericTest, fallBackToPython) // NOLINT
+{
+    App::Expression::NumericValue value;
+    for (const char* text : {"1 / 0", "len + 1", "(-8) ^ (1 / 3)", "str(i)", "i % 0",
+                             "Label", "len < 1", "vector(1; 2; 3)"}) {
+        EXPECT_FALSE(parse(text)->getNumericValue(value)) << text;
+    }
+
+    // the Python evaluation reports the error
+    EXPECT_THROW(parse("1 / 0")->getValueAsAny(), Base::Exception);
+    EXPECT_THROW(parse("len + 1")->getValueAsAny(), Base::Exception);
+
+    // too large for exact integer arithmetic
+    EXPECT_FALSE(parse("2 ^ 70")->getNumericValue(value));
+}
+
+TEST_F(ExpressionNumericTest, resolveAgainAfterChanges) // NOLINT
+{
+    auto expr = parse("x + 1");
+    App::Expression::NumericValue value;
+    EXPECT_FALSE(expr->getNumericValue(value));
+
+    auto prop = obj()->addDynamicProperty("App::PropertyFloat", "x");
+    static_cast<App::PropertyFloat*>(prop)->setValue(1.5);
+    ASSERT_TRUE(expr->getNumericValue(value));
+    EXPECT_EQ(value.type, App::Expression::NumericValue::Type::Float);
+    EXPECT_DOUBLE_EQ(value.real, 2.5);
+
+    // the property is replaced by one of another type
+    obj()->removeDynamicProperty("x");
+    EXPECT_FALSE(expr->getNumericValue(value));
+    prop = obj()->addDynamicProperty("App::PropertyInteger", "x");
+    static_cast<App::PropertyInteger*>(prop)->setValue(4);
+    ASSERT_TRUE(expr->getNumericValue(value));
+    EXPECT_EQ(value.type, App::Expression::NumericValue::Type::Integer);
+    EXPECT_EQ(value.integer, 5);
+
+    // references by label don't resolve anymore after a relabel
+    auto byLabel = parse("<<Params>>.i");
+    ASSERT_TRUE(byLabel->getNumericValue(value));
+    EXPECT_EQ(value.integer, 7);
+    obj()->Label.setValue("Other");
+    EXPECT_FALSE(byLabel->getNumericValue(value));
+    EXPECT_THROW(byLabel->getValueAsAny(), Base::Exception);
+    EXPECT_TRUE(parse("<<Other>>.i")->getNumericValue(value));
+}
 // clang-format on
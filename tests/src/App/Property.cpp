@@ -53,6 +53,22 @@ TEST(PropertyLink, TestSetValues)
     EXPECT_EQ(sub[1], "Sub2");
 }
 
+TEST(PropertyMaterialList, TestSetRange)
+{
+    App::PropertyMaterialList prop;
+    App::Material mat;
+    prop.setValues(std::vector<App::Material>(4, mat));
+    Base::Color red(1.0F, 0.0F, 0.0F);
+    prop.setDiffuseColors(1, {red, red});
+    EXPECT_EQ(prop.getDiffuseColor(0), mat.diffuseColor);
+    EXPECT_EQ(prop.getDiffuseColor(1), red);
+    EXPECT_EQ(prop.getDiffuseColor(2), red);
+    EXPECT_EQ(prop.getDiffuseColor(3), mat.diffuseColor);
+    // the touched elements are only kept while the change is reported
+    EXPECT_TRUE(prop.getTouchList().empty());
+    EXPECT_THROW(prop.setDiffuseColors(3, {red, red}), Base::RuntimeError);
+}
+
 class PropertyFloatTest: public ::testing::Test
 {
 protected:
@@ -8,6 +8,7 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
 
 #include "src/App/InitApplication.h"
 
@@ -90,4 +91,44 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, executeConcurrently)
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    bool parallel = hGrp->GetBool("ParallelExpressions", false);
+    hGrp->SetBool("ParallelExpressions", true);
+
+    // many independent bindings, one that depends on them and two that need Python
+    auto obj = this_doc()->addObject("App::VarSet", "Params");
+    auto bind = [obj](const char* type, const std::string& name, const std::string& expr) {
+        obj->addDynamicProperty(type, name.c_str());
+        auto path = App::ObjectIdentifier::parse(obj, name);
+        obj->setExpression(path, std::shared_ptr<App::Expression>(App::Expression::parse(obj, expr)));
+    };
+    const int count = 200;
+    for (int i = 0; i < count; ++i) {
+        bind("App::PropertyFloat", "p" + std::to_string(i), std::to_string(i) + " * 2 + 0.5");
+    }
+    bind("App::PropertyString", "text", "str(3)");
+    bind("App::PropertyFloat", "total", "p0 + p1 + p199");
+    bind("App::PropertyString", "totalText", "str(total)");
+
+    obj->ExpressionEngine.execute();
+    hGrp->SetBool("ParallelExpressions", parallel);
+
+    for (int i = 0; i < count; ++i) {
+        auto prop = dynamic_cast<App::PropertyFloat*>(obj->getPropertyByName(("p" + std::to_string(i)).c_str()));
+        ASSERT_TRUE(prop);
+        EXPECT_DOUBLE_EQ(prop->getValue(), i * 2 + 0.5);
+    }
+    auto total = dynamic_cast<App::PropertyFloat*>(obj->getPropertyByName("total"));
+    ASSERT_TRUE(total);
+    EXPECT_DOUBLE_EQ(total->getValue(), 0.5 + 2.5 + 398.5);
+    auto text = dynamic_cast<App::PropertyString*>(obj->getPropertyByName("text"));
+    ASSERT_TRUE(text);
+    EXPECT_STREQ(text->getValue(), "3");
+    auto totalText = dynamic_cast<App::PropertyString*>(obj->getPropertyByName("totalText"));
+    ASSERT_TRUE(totalText);
+    EXPECT_STREQ(totalText->getValue(), "401.5");
+}
+
 // clang-format on
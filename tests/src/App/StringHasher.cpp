@@ -9,6 +9,8 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1588,56 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, threadSafeGetID)  // NOLINT
+{
+    // Arrange
+    const int numThreads {4};
+    const int numNames {1000};
+    Hasher()->setThreadSafe(true);
+    std::vector<std::vector<long>> ids(numThreads);
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([this, &ids, i]() {
+            QVector<App::StringIDRef> sids;
+            for (int j = 0; j < numNames; ++j) {
+                std::string postfix = ";:H" + std::to_string(j) + ",E";
+                auto sid = Hasher()->getID(givenMappedName("Edge1", postfix.c_str()), sids);
+                ids[i].push_back(sid.value());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert - every name got its own ID, shared by all threads
+    for (int i = 1; i < numThreads; ++i) {
+        EXPECT_EQ(ids[0], ids[i]);
+    }
+    std::set<long> uniqueIDs(ids[0].begin(), ids[0].end());
+    EXPECT_EQ(numNames, uniqueIDs.size());
+    EXPECT_TRUE(Hasher()->getID(ids[0].front()));
+}
+
+TEST_F(StringHasherTest, threadSafeCompact)  // NOLINT
+{
+    // Arrange
+    Hasher()->setThreadSafe(true);
+    auto ref = Hasher()->getID("Persistent");
+    ref.setPersistent(true);
+    Hasher()->getID("Temporary");
+
+    // Act
+    Hasher()->compact();
+    auto found = Hasher()->getID("Persistent");
+    auto added = Hasher()->getID("Temporary");
+
+    // Assert
+    EXPECT_TRUE(Hasher()->isThreadSafe());
+    EXPECT_EQ(ref, found);
+    EXPECT_EQ(2, Hasher()->size());
+    EXPECT_GT(added.value(), ref.value());
+}
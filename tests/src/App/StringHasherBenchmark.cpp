@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Throughput of StringHasher::getID(), see src/BenchmarkHelpers.h.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <App/MappedName.h>
+#include <App/StringHasher.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+constexpr int numNames = 20000;
+constexpr int numLookups = 1000000;
+
+// element names like the ones generated by the boolean operations
+std::vector<Data::MappedName> createNames()
+{
+    std::vector<Data::MappedName> names;
+    names.reserve(numNames);
+    for (int i = 0; i < numNames; ++i) {
+        std::string postfix = ";:H" + std::to_string(i % 97) + ":7,F;:M" + std::to_string(i);
+        names.emplace_back(Data::MappedName("Face" + std::to_string(i % 13 + 1)),
+                           postfix.c_str());
+    }
+    return names;
+}
+
+// every thread does the same number of lookups, spread over all names
+double run(App::StringHasher& hasher, const std::vector<Data::MappedName>& names, int numThreads)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&hasher, &names, i]() {
+            QVector<App::StringIDRef> sids;
+            for (int j = 0; j < numLookups; ++j) {
+                const auto& name = names[(j * 31 + i * 7919) % names.size()];
+                hasher.getID(name, sids);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return tests::elapsedMilliseconds(start);
+}
+
+}  // namespace
+
+class StringHasherBenchmark: public ::testing::TestWithParam<int>
+{
+};
+
+TEST_P(StringHasherBenchmark, getID)  // NOLINT
+{
+    int numThreads = GetParam();
+    std::vector<Data::MappedName> names = createNames();
+    Base::Reference<App::StringHasher> hasher(new App::StringHasher);
+    hasher->setThreadSafe(true);
+    RecordProperty("lookups", numThreads * numLookups);
+
+    // the first run mostly adds the names, the second one only finds them
+    tests::record("fill", run(*hasher, names, numThreads));
+    tests::record("lookup", run(*hasher, names, numThreads));
+    EXPECT_GE(hasher->size(), numNames);
+
+    if (numThreads == 1) {
+        Base::Reference<App::StringHasher> plain(new App::StringHasher);
+        run(*plain, names, 1);
+        tests::record("lookup_single_threaded_mode", run(*plain, names, 1));
+        EXPECT_EQ(plain->size(), hasher->size());
+    }
+    hasher->clear();
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads,
+                         StringHasherBenchmark,
+                         ::testing::Values(1, 2, 4, 8, 16, 32),
+                         [](const ::testing::TestParamInfo<int>& info) {
+                             return "Threads" + std::to_string(info.param);
+                         });
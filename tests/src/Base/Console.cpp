@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+// drops the trace messages at compile time
+#define FC_LOG_MAX_LEVEL 3
+
+#include "Base/Console.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class CollectingObserver: public Base::ILogger
+{
+public:
+    explicit CollectingObserver(bool threadSafe)
+        : threadSafe {threadSafe}
+    {}
+    void sendLog(const std::string& notifiername,
+                 const std::string& msg,
+                 Base::LogStyle level,
+                 Base::IntendedRecipient recipient,
+                 Base::ContentType content) override
+    {
+        (void)level;
+        (void)recipient;
+        (void)content;
+        std::lock_guard<std::mutex> lock(mutex);
+        messages[notifiername].push_back(msg);
+    }
+    const char* name() override
+    {
+        return "Collecting";
+    }
+    bool isThreadSafe() const override
+    {
+        return threadSafe;
+    }
+
+    bool threadSafe;
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::string>> messages;
+};
+
+class ConsoleTest: public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    }
+};
+
+TEST_F(ConsoleTest, asynchronousKeepsOrderOfEachThread)
+{
+    constexpr int numThreads = 4;
+    constexpr int numMessages = 2000;
+    CollectingObserver observer(true);
+    Base::Console().attachObserver(&observer);
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Asynchronous);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([i]() {
+            std::string notifier = "thread" + std::to_string(i);
+            for (int j = 0; j < numMessages; j++) {
+                Base::Console().log(notifier, "%d", j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Base::Console().flush();
+
+    {
+        std::lock_guard<std::mutex> lock(observer.mutex);
+        ASSERT_EQ(observer.messages.size(), std::size_t(numThreads));
+        for (const auto& it : observer.messages) {
+            ASSERT_EQ(it.second.size(), std::size_t(numMessages));
+            for (int j = 0; j < numMessages; j++) {
+                EXPECT_EQ(it.second[j], std::to_string(j));
+            }
+        }
+    }
+    Base::Console().detachObserver(&observer);
+}
+
+TEST_F(ConsoleTest, asynchronousDeliversToMainThreadObservers)
+{
+    CollectingObserver observer(false);
+    Base::Console().attachObserver(&observer);
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Asynchronous);
+
+    std::thread thread([]() {
+        Base::Console().log(std::string("worker"), "message");
+    });
+    thread.join();
+    Base::Console().flush();
+
+    EXPECT_EQ(observer.messages["worker"], std::vector<std::string> {"message"});
+    Base::Console().detachObserver(&observer);
+}
+
+TEST_F(ConsoleTest, compiledOutLevel)
+{
+    *Base::Console().getLogLevel("ConsoleTest") = FC_LOGLEVEL_TRACE;
+    FC_LOG_LEVEL_INIT("ConsoleTest");
+    CollectingObserver observer(false);
+    Base::Console().attachObserver(&observer);
+
+    int evaluated = 0;
+    auto count = [&evaluated]() {
+        return ++evaluated;
+    };
+    FC_TRACE("trace " << count());
+    FC_LOG("log " << count());
+
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_EQ(observer.messages[""].size(), 1U);
+    Base::Console().detachObserver(&observer);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Base/Exception.h>
+
+TEST(Exception, rethrowFirstExceptionWithoutErrors)
+{
+    // Arrange
+    std::vector<std::exception_ptr> errors(3);
+
+    // Act & Assert
+    EXPECT_NO_THROW(Base::rethrowFirstException(errors));
+}
+
+TEST(Exception, rethrowFirstExceptionInOrder)
+{
+    // Arrange
+    std::vector<std::exception_ptr> errors(3);
+    errors[1] = std::make_exception_ptr(Base::ValueError("first"));
+    errors[2] = std::make_exception_ptr(Base::TypeError("second"));
+
+    // Act & Assert
+    EXPECT_THROW(Base::rethrowFirstException(errors), Base::ValueError);
+}
@@ -573,5 +573,42 @@ TEST(Matrix, TestToAndFromString)
 
     EXPECT_EQ(mat, inp);
 }
+
+TEST(Matrix, TestTransformPoints)
+{
+    Base::Matrix4D mat;
+    mat.rotLine(Base::Vector3d(1.0, 2.0, -1.0), 0.7);
+    mat.scale(2.0, 0.5, 3.0);
+    mat.move(Base::Vector3d(10.0, -20.0, 30.0));
+
+    std::vector<Base::Vector3d> pntsd;
+    std::vector<Base::Vector3f> pntsf;
+    for (int i = 0; i < 100; i++) {
+        pntsd.emplace_back(0.1 * i, 1.0 - 0.2 * i, 0.3 * i * i);
+        pntsf.emplace_back(0.1F * i, 1.0F - 0.2F * i, 0.3F * i * i);
+    }
+
+    std::vector<Base::Vector3d> resultd(pntsd);
+    std::vector<Base::Vector3f> resultf(pntsf);
+    mat.transformPoints(std::span<Base::Vector3d>(resultd));
+    mat.transformPoints(std::span<Base::Vector3f>(resultf));
+    std::vector<Base::Vector3f> resultg(pntsf);
+    mat.transformPoints(resultg.begin(), resultg.end());
+
+    for (std::size_t i = 0; i < pntsd.size(); i++) {
+        Base::Vector3d pntd = mat * pntsd[i];
+        EXPECT_DOUBLE_EQ(resultd[i].x, pntd.x);
+        EXPECT_DOUBLE_EQ(resultd[i].y, pntd.y);
+        EXPECT_DOUBLE_EQ(resultd[i].z, pntd.z);
+
+        Base::Vector3f pntf = mat * pntsf[i];
+        EXPECT_FLOAT_EQ(resultf[i].x, pntf.x);
+        EXPECT_FLOAT_EQ(resultf[i].y, pntf.y);
+        EXPECT_FLOAT_EQ(resultf[i].z, pntf.z);
+        EXPECT_FLOAT_EQ(resultg[i].x, pntf.x);
+        EXPECT_FLOAT_EQ(resultg[i].y, pntf.y);
+        EXPECT_FLOAT_EQ(resultg[i].z, pntf.z);
+    }
+}
 // clang-format on
 // NOLINTEND(cppcoreguidelines-*,readability-magic-numbers)
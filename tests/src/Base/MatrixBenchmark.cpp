@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings of the batch transformation, see src/BenchmarkHelpers.h.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <Base/Matrix.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+constexpr std::size_t numPoints = 10000000;
+
+Base::Matrix4D createMatrix()
+{
+    Base::Matrix4D mat;
+    mat.rotLine(Base::Vector3d(1.0, 2.0, -1.0), 0.7);
+    mat.move(Base::Vector3d(10.0, -20.0, 30.0));
+    return mat;
+}
+
+template<typename Vec>
+std::vector<Vec> createPoints()
+{
+    using value_type = typename Vec::num_type;
+    std::vector<Vec> points;
+    points.reserve(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        auto value = static_cast<value_type>(i % 1000);
+        points.emplace_back(value, -value, value * value_type(0.5));
+    }
+    return points;
+}
+
+template<typename Vec>
+void compare(const char* name)
+{
+    Base::Matrix4D mat = createMatrix();
+    std::vector<Vec> points = createPoints<Vec>();
+    std::vector<Vec> copy(points);
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto& pnt : points) {
+        mat.multVec(pnt, pnt);
+    }
+    tests::record(std::string(name) + ".multVec", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    mat.transformPoints(std::span<Vec>(copy));
+    tests::record(std::string(name) + ".transformPoints", tests::elapsedMilliseconds(start));
+
+    EXPECT_EQ(points.front(), copy.front());
+    EXPECT_EQ(points.back(), copy.back());
+}
+
+}  // namespace
+
+TEST(MatrixBenchmark, transformVector3f)  // NOLINT
+{
+    compare<Base::Vector3f>("Vector3f");
+}
+
+TEST(MatrixBenchmark, transformVector3d)  // NOLINT
+{
+    compare<Base::Vector3d>("Vector3d");
+}
@@ -443,6 +443,35 @@ TEST_F(ParameterTest, TestObserverNoRef)
     EXPECT_EQ(obs.getCountNotifications(), 1);
 }
 
+TEST_F(ParameterTest, TestParameterValue)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    grp->SetInt("Int", 5);
+
+    ParameterValue<int> intValue(grp, "Int", 1);
+    ParameterValue<bool> boolValue(grp, "Bool", true);
+    ParameterValue<std::string> textValue(grp, "Text", "preset");
+    EXPECT_EQ(intValue.getValue(), 5);
+    EXPECT_TRUE(boolValue.getValue());
+    EXPECT_EQ(textValue.getValue(), "preset");
+
+    grp->SetInt("Int", 7);
+    grp->SetBool("Bool", false);
+    textValue.setValue("value");
+    EXPECT_EQ(intValue.getValue(), 7);
+    EXPECT_FALSE(boolValue.getValue());
+    EXPECT_EQ(grp->GetASCII("Text"), "value");
+
+    grp->RemoveInt("Int");
+    EXPECT_EQ(intValue.getValue(), 1);
+
+    grp->SetBool("Bool", false);
+    grp->Clear(true);
+    EXPECT_TRUE(boolValue.getValue());
+    EXPECT_EQ(textValue.getValue(), "preset");
+}
+
 TEST_F(ParameterTest, TestLockFile)
 {
     std::string fn = getFileName();
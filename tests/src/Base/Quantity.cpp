@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include <Base/Exception.h>
 #include <Base/Quantity.h>
+#include <Base/UnitsApi.h>
 #include <QLocale>
+#include <string>
+#include <thread>
+#include <vector>
 
 using Base::ParserError;
 using Base::Quantity;
@@ -27,6 +31,53 @@ TEST(BaseQuantity, TestParse)
     EXPECT_THROW(auto rew [[maybe_unused]] = Quantity::parse("1,234,500.12 kg"), ParserError);
 }
 
+TEST(BaseQuantity, TestParseRepeated)
+{
+    // the second parse of each string is served from the cache
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(Quantity::parse("2 mm"), Quantity(2.0, Unit::Length));
+        EXPECT_EQ(Quantity::parse("3 kg"), Quantity(3.0, Unit::Mass));
+        EXPECT_THROW(auto rew [[maybe_unused]] = Quantity::parse("1,234,500.12 kg"), ParserError);
+    }
+    // more strings than the cache holds
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(Quantity::parse(std::to_string(i) + " mm"), Quantity(i, Unit::Length));
+    }
+    EXPECT_EQ(Quantity::parse("2 mm"), Quantity(2.0, Unit::Length));
+}
+
+TEST(BaseQuantity, TestParseRepeatedFormat)
+{
+    // a cached result takes the number of decimals that is current when parsing again
+    const std::size_t decimals = Base::UnitsApi::getDecimals();
+    Base::UnitsApi::setDecimals(2);
+    EXPECT_EQ(Quantity::parse("4 mm").getFormat().precision, 2);
+    Base::UnitsApi::setDecimals(5);
+    EXPECT_EQ(Quantity::parse("4 mm").getFormat().precision, 5);
+    Base::UnitsApi::setDecimals(decimals);
+}
+
+TEST(BaseQuantity, TestParseConcurrent)
+{
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (std::size_t t = 0; t < failures.size(); t++) {
+        threads.emplace_back([t, &failures]() {
+            for (int i = 0; i < 500; i++) {
+                int value = i % 100;
+                if (Quantity::parse(std::to_string(value) + " m^2")
+                    != Quantity(value * 1e6, Unit::Area)) {
+                    failures[t]++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures, std::vector<int>(failures.size(), 0));
+}
+
 TEST(BaseQuantity, TestNoDim)
 {
     const Quantity q1 {};
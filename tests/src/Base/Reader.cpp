@@ -7,14 +7,28 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Stream.h"
+#include "Base/Writer.h"
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <random>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 #include <xercesc/util/PlatformUtils.hpp>
+#include <zipios++/zipfile.h>
+#include <zipios++/zipinputstream.h>
 #include <QString>
+#include <src/BenchmarkHelpers.h>
 
 namespace fs = std::filesystem;
 
@@ -459,3 +473,377 @@ TEST_F(ReaderTest, validDefaults)
     EXPECT_THROW({ xml.Reader()->getAttribute<TimesIGoToBed>("missing"); }, Base::XMLBaseException);
     EXPECT_EQ(value20, TimesIGoToBed::Late);
 }
+
+TEST_F(ReaderTest, readAttributes)
+{
+    // Arrange
+    auto xmlBody = R"(
+<node1 a='-12' b='1.5e3' c='+7' d=' 8' e='caf&#233;' f='0'/>
+<node2 b='2'/>
+)";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+
+    // Act
+    xml.Reader()->readElement("node1");
+    auto count = xml.Reader()->getAttributeCount();
+    auto a = xml.Reader()->getAttribute<long>("a");
+    auto b = xml.Reader()->getAttribute<double>("b");
+    auto c = xml.Reader()->getAttribute<int>("c");
+    auto d = xml.Reader()->getAttribute<unsigned long>("d");
+    std::string e = xml.Reader()->getAttribute<const char*>("e");
+    auto f = xml.Reader()->getAttribute<bool>("f");
+    xml.Reader()->readElement("node2");
+
+    // Assert: the attributes of the previous element are gone
+    EXPECT_EQ(count, 6);
+    EXPECT_EQ(a, -12);
+    EXPECT_DOUBLE_EQ(b, 1500.0);
+    EXPECT_EQ(c, 7);
+    EXPECT_EQ(d, 8);
+    EXPECT_EQ(e, "caf\xc3\xa9");
+    EXPECT_FALSE(f);
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 1);
+    EXPECT_FALSE(xml.Reader()->hasAttribute("a"));
+    EXPECT_DOUBLE_EQ(xml.Reader()->getAttribute<double>("b"), 2.0);
+    EXPECT_THROW(xml.Reader()->getAttribute<long>("missing"), Base::XMLBaseException);
+}
+
+namespace
+{
+
+class DataFile: public Base::Persistence
+{
+public:
+    DataFile(std::string content, bool lazy)
+        : content {std::move(content)}
+        , lazy {lazy}
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& writer) const override
+    {
+        writer.Stream() << "<Data file=\"" << writer.addFile("data", this) << "\"/>";
+    }
+    void Restore(Base::XMLReader& reader) override
+    {
+        reader.readElement("Data");
+        reader.addFile(reader.getAttribute<const char*>("file"), this);
+    }
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        content.assign(std::istreambuf_iterator<char>(reader), {});
+    }
+    bool deferRestoreDocFile(const std::shared_ptr<Base::DeferredDocFile>& file) override
+    {
+        if (lazy) {
+            deferred = file;
+        }
+        return lazy;
+    }
+
+    std::string content;
+    bool lazy;
+    std::shared_ptr<Base::DeferredDocFile> deferred;
+};
+
+class DecodedDataFile: public DataFile
+{
+public:
+    DecodedDataFile(std::string content, std::vector<std::string>* assigned)
+        : DataFile(std::move(content), false)
+        , assigned {assigned}
+    {}
+    DocFileDecoder getDocFileDecoder() override
+    {
+        return [this](Base::Reader& reader) -> std::function<void()> {
+            std::string data(std::istreambuf_iterator<char>(reader), {});
+            return [this, data]() {
+                content = data;
+                assigned->push_back(data);
+            };
+        };
+    }
+
+    std::vector<std::string>* assigned;
+};
+
+// saved like App::PropertyIntegerList, either inline or as a binary file
+class IntegerList: public Base::Persistence
+{
+public:
+    explicit IntegerList(bool binary)
+        : binary {binary}
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& writer) const override
+    {
+        if (binary) {
+            writer.Stream() << "<IntegerList file=\"" << writer.addFile("list", this) << "\"/>";
+            return;
+        }
+        writer.Stream() << "<IntegerList count=\"" << values.size() << "\">\n";
+        for (long value : values) {
+            writer.Stream() << "<I v=\"" << value << "\"/>\n";
+        }
+        writer.Stream() << "</IntegerList>\n";
+    }
+    void Restore(Base::XMLReader& reader) override
+    {
+        reader.readElement("IntegerList");
+        if (reader.hasAttribute("file")) {
+            reader.addFile(reader.getAttribute<const char*>("file"), this);
+            return;
+        }
+        values.resize(reader.getAttribute<unsigned long>("count"));
+        for (long& value : values) {
+            reader.readElement("I");
+            value = reader.getAttribute<long>("v");
+        }
+        reader.readEndElement("IntegerList");
+    }
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        Base::OutputStream str(writer.Stream());
+        std::vector<int32_t> data(values.begin(), values.end());
+        str << static_cast<uint32_t>(data.size());
+        str.writeArray(data.data(), data.size());
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        Base::InputStream str(reader);
+        uint32_t count = 0;
+        str >> count;
+        std::vector<int32_t> data(count);
+        str.readArray(data.data(), data.size());
+        values.assign(data.begin(), data.end());
+    }
+
+    bool binary;
+    std::vector<long> values;
+};
+
+IntegerList createList(bool binary)
+{
+    constexpr int numValues = 100000;
+    IntegerList list(binary);
+    for (int i = 0; i < numValues; i++) {
+        list.values.push_back((i * 7919L) % 100000 - 50000);
+    }
+    return list;
+}
+
+// saves and restores the list, the time of restoring it is recorded as property
+IntegerList saveAndRestore(const IntegerList& list)
+{
+    std::ostringstream archive;
+    {
+        Base::ZipWriter writer(archive);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?><Document>";
+        list.Save(writer);
+        writer.Stream() << "</Document>";
+        writer.writeFiles();
+    }
+
+    IntegerList restored(list.binary);
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::istringstream str(archive.str());
+        zipios::ZipInputStream zipstream(str);
+        Base::XMLReader reader("list", zipstream);
+        reader.readElement("Document");
+        restored.Restore(reader);
+        reader.readFiles(zipstream);
+    }
+    tests::record("restore", tests::elapsedMilliseconds(start));
+    return restored;
+}
+
+}  // namespace
+
+TEST_F(ReaderTest, readFilesLazy)
+{
+    // Arrange
+    fs::path file = fs::temp_directory_path() / ("unit_test_Reader-" + random_string(4) + ".zip");
+    {
+        DataFile eager("eager data", false);
+        DataFile lazy("lazy data", true);
+        std::ofstream str(file.string(), std::ios::out | std::ios::binary);
+        Base::ZipWriter writer(str);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?><Document>";
+        eager.Save(writer);
+        lazy.Save(writer);
+        writer.Stream() << "</Document>";
+        writer.writeFiles();
+    }
+    DataFile eager("", false);
+    DataFile lazy("", true);
+
+    // Act
+    {
+        std::ifstream str(file.string(), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(str);
+        Base::XMLReader reader(file.string().c_str(), zipstream);
+        reader.setLazyArchive(std::make_shared<zipios::ZipFile>(file.string()));
+        reader.readElement("Document");
+        eager.Restore(reader);
+        lazy.Restore(reader);
+        reader.readFiles(zipstream);
+    }
+
+    // Assert
+    EXPECT_EQ(eager.content, "eager data");
+    EXPECT_TRUE(lazy.content.empty());
+    ASSERT_TRUE(lazy.deferred);
+    EXPECT_TRUE(lazy.deferred->restore([&lazy](Base::Reader& reader) {
+        lazy.RestoreDocFile(reader);
+    }));
+    EXPECT_EQ(lazy.content, "lazy data");
+
+    lazy.deferred.reset();
+    fs::remove(file);
+}
+
+TEST_F(ReaderTest, lazyDocFileRestoresOnce)
+{
+    // Arrange
+    fs::path file = fs::temp_directory_path() / ("unit_test_Reader-" + random_string(4) + ".zip");
+    {
+        DataFile lazy("lazy data", true);
+        std::ofstream str(file.string(), std::ios::out | std::ios::binary);
+        Base::ZipWriter writer(str);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?><Document>";
+        lazy.Save(writer);
+        writer.Stream() << "</Document>";
+        writer.writeFiles();
+    }
+    DataFile lazy("", true);
+    {
+        std::ifstream str(file.string(), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(str);
+        Base::XMLReader reader(file.string().c_str(), zipstream);
+        reader.setLazyArchive(std::make_shared<zipios::ZipFile>(file.string()));
+        reader.readElement("Document");
+        lazy.Restore(reader);
+        reader.readFiles(zipstream);
+    }
+    Base::LazyDocFile pending;
+    pending.set(lazy.deferred);
+    lazy.deferred.reset();
+    EXPECT_EQ(pending.getSize(), 9);
+
+    // Act: several threads access the data at the same time
+    std::atomic<int> restored {0};
+    std::atomic<int> done {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&]() {
+            pending.restore([&](Base::Reader& reader) {
+                lazy.RestoreDocFile(reader);
+                ++restored;
+            });
+            // the data must be there for every caller once restore() returns
+            if (lazy.content == "lazy data") {
+                ++done;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(restored, 1);
+    EXPECT_EQ(done, 4);
+    EXPECT_EQ(pending.getSize(), 0);
+    EXPECT_FALSE(pending.restore([](Base::Reader&) {}));
+
+    fs::remove(file);
+}
+
+TEST_F(ReaderTest, readFilesDecoded)
+{
+    // Arrange
+    constexpr int numFiles = 50;
+    std::ostringstream archive;
+    {
+        std::vector<std::unique_ptr<DataFile>> files;
+        for (int i = 0; i < numFiles; i++) {
+            std::string content = "data " + std::to_string(i);
+            files.push_back(std::make_unique<DecodedDataFile>(content, nullptr));
+        }
+        files.push_back(std::make_unique<DataFile>("direct data", false));
+        Base::ZipWriter writer(archive);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?><Document>";
+        for (const auto& file : files) {
+            file->Save(writer);
+        }
+        writer.Stream() << "</Document>";
+        writer.writeFiles();
+    }
+    std::vector<std::string> assigned;
+    std::vector<std::unique_ptr<DataFile>> files;
+    for (int i = 0; i < numFiles; i++) {
+        files.push_back(std::make_unique<DecodedDataFile>("", &assigned));
+    }
+    files.push_back(std::make_unique<DataFile>("", false));
+
+    // Act
+    {
+        std::istringstream str(archive.str());
+        zipios::ZipInputStream zipstream(str);
+        Base::XMLReader reader("decoded", zipstream);
+        reader.readElement("Document");
+        for (const auto& file : files) {
+            file->Restore(reader);
+        }
+        reader.readFiles(zipstream);
+        EXPECT_FALSE(reader.hasReadFailed("data"));
+    }
+
+    // Assert
+    ASSERT_EQ(assigned.size(), numFiles);
+    for (int i = 0; i < numFiles; i++) {
+        EXPECT_EQ(files[i]->content, "data " + std::to_string(i));
+        EXPECT_EQ(assigned[i], files[i]->content);
+    }
+    EXPECT_EQ(files.back()->content, "direct data");
+}
+
+TEST_F(ReaderTest, restoreInlineList)
+{
+    // Arrange
+    IntegerList list = createList(false);
+
+    // Act
+    IntegerList restored = saveAndRestore(list);
+
+    // Assert
+    EXPECT_EQ(restored.values, list.values);
+}
+
+TEST_F(ReaderTest, restoreBinaryList)
+{
+    // Arrange
+    IntegerList list = createList(true);
+
+    // Act
+    IntegerList restored = saveAndRestore(list);
+
+    // Assert
+    EXPECT_EQ(restored.values, list.values);
+}
@@ -125,3 +125,40 @@ TEST_F(TextStreamIntegrationTest, OutputThenInputMultiLineWithCarriageReturns)
     // Assert
     EXPECT_EQ(multiLineStringResult, result);
 }
+
+TEST(BinaryStreamTest, writeArrayThenReadArray)
+{
+    // Arrange
+    std::vector<float> values {1.5F, -2.0F, 3.25F, 1e-7F};
+
+    for (auto order : {Base::Stream::LittleEndian, Base::Stream::BigEndian}) {
+        // Act
+        std::stringstream str;
+        Base::OutputStream out(str);
+        out.setByteOrder(order);
+        out.writeArray(values.data(), values.size());
+        Base::InputStream in(str);
+        in.setByteOrder(order);
+        std::vector<float> result(values.size());
+        in.readArray(result.data(), result.size());
+
+        // Assert
+        EXPECT_EQ(str.str().size(), values.size() * sizeof(float));
+        EXPECT_EQ(result, values);
+    }
+}
+
+TEST(BinaryStreamTest, writeArrayByteOrder)
+{
+    // Arrange
+    std::vector<uint32_t> values {0x01020304, 0x0A0B0C0D};
+
+    // Act
+    std::ostringstream str;
+    Base::OutputStream out(str);
+    out.setByteOrder(Base::Stream::BigEndian);
+    out.writeArray(values.data(), values.size());
+
+    // Assert
+    EXPECT_EQ(str.str(), std::string("\x01\x02\x03\x04\x0A\x0B\x0C\x0D", 8));
+}
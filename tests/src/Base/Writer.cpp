@@ -2,7 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <zipios++/zipinputstream.h>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +135,220 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+TEST_F(WriterTest, compact)
+{
+    // Arrange
+    _writer.incInd();
+
+    // Act
+    _writer.setCompact(true);
+    _writer.incInd();
+
+    // Assert
+    EXPECT_STREQ(_writer.ind(), "");
+    _writer.setCompact(false);
+    _writer.incInd();
+    EXPECT_STREQ(_writer.ind(), "    ");
+}
+
+TEST(XMLNumberTest, sameAsStream)
+{
+    const double values[] {0.0, -0.0, 1.0, 0.1, -1.0 / 3.0, 1e-20, 123456789.125, 1e300};
+    const std::ios::fmtflags formats[] {std::ios::fixed, std::ios::scientific, {}};
+    for (auto format : formats) {
+        for (int precision : {0, 6, 16}) {
+            for (double value : values) {
+                std::ostringstream expected;
+                std::ostringstream result;
+                for (auto* str : {&expected, &result}) {
+                    str->imbue(std::locale::classic());
+                    str->precision(precision);
+                    str->setf(format, std::ios::floatfield);
+                }
+                expected << value;
+                result << Base::XMLNumber(value);
+                EXPECT_EQ(result.str(), expected.str());
+            }
+        }
+    }
+
+    std::ostringstream str;
+    str << Base::XMLNumber(-42L) << ' ' << Base::XMLNumber(7);
+    EXPECT_EQ(str.str(), "-42 7");
+}
+
+TEST(PersistenceTest, encodeAttribute)
+{
+    EXPECT_EQ(Base::Persistence::encodeAttribute("Plain name"), "Plain name");
+    EXPECT_EQ(Base::Persistence::encodeAttribute("a<b & \"c\"\n"),
+              "a&lt;b &amp; &quot;c&quot;&#10;");
+    EXPECT_EQ(Base::Persistence::encodeAttribute(">'\t\r"), "&gt;&apos;&#9;&#13;");
+}
+
+namespace
+{
+
+class DataFile: public Base::Persistence
+{
+public:
+    explicit DataFile(std::string content)
+        : content {std::move(content)}
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(content.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream().write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    std::string content;
+};
+
+std::vector<DataFile> createDataFiles()
+{
+    std::string text;
+    for (int i = 0; i < 500000; i++) {
+        text += std::to_string(i % 977) + ",";
+    }
+    std::string noise;
+    std::mt19937 gen(5489U);  // NOLINT
+    for (int i = 0; i < 3000000; i++) {
+        noise.push_back(static_cast<char>(gen()));
+    }
+    return {DataFile(""), DataFile("small"), DataFile(text), DataFile(noise)};
+}
+
+std::string
+writeZip(const std::vector<DataFile>& files, int level, bool parallel, bool stored = false)
+{
+    std::ostringstream str;
+    {
+        Base::ZipWriter writer(str);
+        writer.setLevel(level);
+        writer.setParallel(parallel);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (const auto& file : files) {
+            writer.addFile("data", &file, stored);
+        }
+        writer.writeFiles();
+    }
+    return str.str();
+}
+
+Base::ZipWriter::EntryDigests writeZipFile(const std::string& fileName,
+                                           const std::vector<DataFile>& files,
+                                           const std::string& previous,
+                                           const Base::ZipWriter::EntryDigests& digests,
+                                           std::vector<std::string>& changed)
+{
+    std::ofstream str(fileName, std::ios::out | std::ios::binary);
+    Base::ZipWriter writer(str);
+    writer.setPreviousArchive(previous, digests);
+    writer.putNextEntry("Document.xml");
+    writer.Stream() << "<Document/>";
+    for (const auto& file : files) {
+        writer.addFile("data", &file);
+    }
+    writer.writeFiles();
+    changed = writer.getChangedFiles();
+    return writer.getDigests();
+}
+
+std::string readFile(const std::string& fileName)
+{
+    std::ifstream str(fileName, std::ios::in | std::ios::binary);
+    return {std::istreambuf_iterator<char>(str), {}};
+}
+
+void checkZip(const std::string& zip, const std::vector<DataFile>& files)
+{
+    std::istringstream str(zip);
+    zipios::ZipInputStream zipStream(str);
+    std::string document {std::istreambuf_iterator<char>(zipStream), {}};
+    EXPECT_EQ(document, "<Document/>");
+    for (const auto& file : files) {
+        zipStream.getNextEntry();
+        std::string content {std::istreambuf_iterator<char>(zipStream), {}};
+        EXPECT_EQ(content.size(), file.content.size());
+        EXPECT_TRUE(content == file.content);
+    }
+}
+
+}  // namespace
+
+TEST(ZipWriterTest, writeFilesParallel)
+{
+    // Arrange
+    auto files = createDataFiles();
+
+    // Act
+    std::string zip = writeZip(files, 6, true);
+
+    // Assert
+    checkZip(zip, files);
+    EXPECT_LT(zip.size(), writeZip(files, 0, true).size());
+}
+
+TEST(ZipWriterTest, writeFilesParallelStoreOnly)
+{
+    // Arrange
+    auto files = createDataFiles();
+
+    // Act
+    std::string zip = writeZip(files, 0, true);
+
+    // Assert
+    checkZip(zip, files);
+}
+
+TEST(ZipWriterTest, writeFilesStoredAligned)
+{
+    // Arrange
+    auto files = createDataFiles();
+
+    for (bool parallel : {false, true}) {
+        // Act
+        std::string zip = writeZip(files, 6, parallel, true);
+
+        // Assert
+        checkZip(zip, files);
+        for (const auto& file : files) {
+            if (file.content.size() > 1000) {
+                std::size_t offset = zip.find(file.content);
+                ASSERT_NE(offset, std::string::npos);
+                EXPECT_EQ(offset % Base::Writer::storedAlignment, 0);
+            }
+        }
+    }
+}
+
+TEST(ZipWriterTest, writeFilesIncremental)
+{
+    // Arrange
+    auto files = createDataFiles();
+    auto dir = std::filesystem::temp_directory_path();
+    std::string first = (dir / "ZipWriterTestFirst.zip").string();
+    std::string second = (dir / "ZipWriterTestSecond.zip").string();
+    std::vector<std::string> changed;
+    auto digests = writeZipFile(first, files, std::string(), {}, changed);
+    EXPECT_EQ(changed.size(), files.size());
+    files[1].content = "other";
+
+    // Act
+    writeZipFile(second, files, first, digests, changed);
+
+    // Assert
+    checkZip(readFile(second), files);
+    ASSERT_EQ(changed.size(), 1);
+    EXPECT_EQ(changed.front(), "data1");
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+}
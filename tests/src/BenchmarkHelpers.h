@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Helpers of the benchmarks. They are built as <Module>_benchmark_run and are not part of the
+// unit tests. Run one with --gtest_output=json:<file> to keep the results, the tests record
+// their measurements as properties, timings in milliseconds.
+
+#ifndef TEST_BENCHMARKHELPERS_H
+#define TEST_BENCHMARKHELPERS_H
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+namespace tests
+{
+
+inline double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    return duration.count();
+}
+
+/// Records \a value as property \a key of the running test
+inline void record(const std::string& key, double value)
+{
+    std::ostringstream str;
+    str << value;
+    ::testing::Test::RecordProperty(key, str.str());
+}
+
+/// Returns the size set by the environment variable \a name, \a defaultSize if it isn't set
+inline std::size_t sizeFromEnvironment(const char* name, std::size_t defaultSize)
+{
+    const char* value = std::getenv(name);
+    return value ? std::strtoull(value, nullptr, 10) : defaultSize;
+}
+
+}  // namespace tests
+
+#endif  // TEST_BENCHMARKHELPERS_H
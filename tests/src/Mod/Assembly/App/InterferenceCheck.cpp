@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Pnt.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Assembly/App/AssemblyObject.h>
+#include <Mod/Assembly/App/InterferenceCheck.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class InterferenceCheckTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    Part::Feature* addBox(const gp_Pnt& pnt, double size)
+    {
+        auto feature = _doc->addObject<Part::Feature>();
+        feature->Shape.setValue(BRepPrimAPI_MakeBox(pnt, size, size, size).Shape());
+        return feature;
+    }
+
+    static void addPart(Assembly::InterferenceCheck& check, Part::Feature* feature)
+    {
+        check.addPart(feature, feature->Shape.getShape().getShape());
+    }
+
+    App::Document* _doc = nullptr;
+    std::string _docName;
+};
+
+TEST_F(InterferenceCheckTest, overlappingParts)
+{
+    auto box1 = addBox(gp_Pnt(0, 0, 0), 10);
+    auto box2 = addBox(gp_Pnt(5, 0, 0), 10);
+
+    Assembly::InterferenceCheck check;
+    addPart(check, box1);
+    addPart(check, box2);
+    auto result = check.perform();
+
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].object1, box1);
+    EXPECT_EQ(result[0].object2, box2);
+    EXPECT_NEAR(result[0].volume, 500.0, 1e-6);
+}
+
+TEST_F(InterferenceCheckTest, touchingParts)
+{
+    Assembly::InterferenceCheck check;
+    addPart(check, addBox(gp_Pnt(0, 0, 0), 10));
+    addPart(check, addBox(gp_Pnt(10, 0, 0), 10));
+    addPart(check, addBox(gp_Pnt(30, 0, 0), 10));
+    auto result = check.perform();
+
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(check.countBroadphasePairs(), 1);
+}
+
+TEST_F(InterferenceCheckTest, containedPart)
+{
+    auto outer = addBox(gp_Pnt(0, 0, 0), 10);
+    auto inner = addBox(gp_Pnt(2, 2, 2), 2);
+
+    Assembly::InterferenceCheck check;
+    addPart(check, outer);
+    addPart(check, inner);
+    auto result = check.perform();
+
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(check.countMidphasePairs(), 1);
+    EXPECT_NEAR(result[0].volume, 8.0, 1e-6);
+}
+
+TEST_F(InterferenceCheckTest, manyParts)
+{
+    // a row of boxes where every fourth one overlaps with its neighbor
+    Assembly::InterferenceCheck check;
+    for (int i = 0; i < 40; i++) {
+        double x = 20.0 * i - (i % 4 == 1 ? 15.0 : 0.0);
+        addPart(check, addBox(gp_Pnt(x, 0, 0), 10));
+    }
+    auto result = check.perform();
+
+    EXPECT_EQ(check.countBroadphasePairs(), 10);
+    ASSERT_EQ(result.size(), 10);
+    for (const auto& pair : result) {
+        EXPECT_NEAR(pair.volume, 500.0, 1e-6);
+    }
+}
+
+TEST_F(InterferenceCheckTest, assemblyParts)
+{
+    auto assembly = _doc->addObject<Assembly::AssemblyObject>();
+    auto box1 = addBox(gp_Pnt(0, 0, 0), 10);
+    auto box2 = addBox(gp_Pnt(0, 0, 0), 10);
+    box2->Placement.setValue(Base::Placement(Base::Vector3d(20, 0, 0), Base::Rotation()));
+    assembly->addObject(box1);
+    assembly->addObject(box2);
+
+    EXPECT_TRUE(assembly->checkInterference().empty());
+
+    // the parts are checked at their placements
+    box2->Placement.setValue(Base::Placement(Base::Vector3d(2, 0, 0), Base::Rotation()));
+    auto result = assembly->checkInterference();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_NEAR(result[0].volume, 800.0, 1e-6);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
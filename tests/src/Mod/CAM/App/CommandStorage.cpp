@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include <Base/Exception.h>
+#include <Mod/CAM/App/CommandStorage.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+Path::Command makeCommand(const char* name, const std::map<std::string, double>& parameters)
+{
+    return Path::Command(name, parameters);
+}
+
+Path::CommandStorage createStorage()
+{
+    Path::CommandStorage storage;
+    storage.push_back(makeCommand("G0", {{"X", 1.0}, {"Y", 2.0}, {"Z", 3.0}}));
+    storage.push_back(makeCommand("G1", {{"X", 4.5}, {"F", 100.0}}));
+    // parameters with longer names are kept after the single letters
+    storage.push_back(makeCommand("M6", {{"T", 2.0}, {"TOOL", 7.0}, {"XX", -1.5}}));
+    storage.push_back(makeCommand("G2", {{"I", 0.5}, {"J", -0.5}, {"X", 1.0}, {"Y", 1.0}}));
+    return storage;
+}
+
+void expectEqual(const Path::CommandStorage& storage1, const Path::CommandStorage& storage2)
+{
+    ASSERT_EQ(storage1.size(), storage2.size());
+    for (std::size_t i = 0; i < storage1.size(); i++) {
+        Path::Command cmd1 = storage1.at(i);
+        Path::Command cmd2 = storage2.at(i);
+        EXPECT_EQ(cmd1.Name, cmd2.Name);
+        EXPECT_EQ(cmd1.Parameters, cmd2.Parameters);
+    }
+}
+
+std::string save(const Path::CommandStorage& storage)
+{
+    std::ostringstream str;
+    storage.save(str);
+    return str.str();
+}
+}  // namespace
+
+TEST(CommandStorage, binaryRoundTrip)
+{
+    // Arrange
+    Path::CommandStorage storage = createStorage();
+    Path::CommandStorage restored;
+
+    // Act
+    std::istringstream str(save(storage));
+    restored.restore(str);
+
+    // Assert
+    expectEqual(storage, restored);
+    EXPECT_EQ(restored.at(2).Parameters.at("TOOL"), 7.0);
+    EXPECT_EQ(restored.value(1, 'F'), 100.0);
+}
+
+TEST(CommandStorage, binaryRoundTripEmpty)
+{
+    // Arrange
+    Path::CommandStorage storage;
+    Path::CommandStorage restored = createStorage();
+
+    // Act
+    std::istringstream str(save(storage));
+    restored.restore(str);
+
+    // Assert
+    EXPECT_TRUE(restored.empty());
+}
+
+TEST(CommandStorage, restoreTruncated)
+{
+    // Arrange
+    std::string data = save(createStorage());
+
+    for (std::size_t length = 0; length < data.size(); length++) {
+        Path::CommandStorage restored;
+        std::istringstream str(data.substr(0, length));
+
+        // Act and Assert
+        EXPECT_THROW(restored.restore(str), Base::BadFormatError) << "length " << length;
+        EXPECT_TRUE(restored.empty());
+    }
+}
+
+TEST(CommandStorage, restoreUnknownFormat)
+{
+    // Arrange
+    std::string data = save(createStorage());
+    data[0] = 'X';
+    Path::CommandStorage restored;
+    std::istringstream str(data);
+
+    // Act and Assert
+    EXPECT_THROW(restored.restore(str), Base::BadFormatError);
+}
+
+TEST(CommandStorage, restoreCorrupted)
+{
+    // Arrange
+    Path::CommandStorage storage = createStorage();
+    std::string data = save(storage);
+
+    // the entries follow the header, the string table and the number of entries
+    std::size_t pos = 3 * sizeof(std::uint32_t);
+    for (const auto& name : storage.names()) {
+        pos += sizeof(std::uint32_t) + name.size();
+    }
+    pos += sizeof(std::uint64_t);
+    const std::size_t entrySize = 2 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+    const std::size_t opcode = pos;
+    const std::size_t mask = pos + sizeof(std::uint32_t);
+    const std::size_t offset = pos + entrySize + 2 * sizeof(std::uint32_t);
+
+    for (std::size_t at : {opcode, mask, offset}) {
+        std::string corrupted = data;
+        corrupted[at + 3] = char(0x7F);
+        Path::CommandStorage restored;
+        std::istringstream str(corrupted);
+
+        // Act and Assert
+        EXPECT_THROW(restored.restore(str), Base::BadFormatError) << "position " << at;
+        EXPECT_TRUE(restored.empty());
+    }
+}
+
+TEST(CommandStorage, insertAtBothEnds)
+{
+    // Arrange
+    Path::CommandStorage storage = createStorage();
+    Path::Command first = makeCommand("G90", {{"TOOL", 3.0}});
+    Path::Command last = makeCommand("G1", {{"Z", -1.0}});
+
+    // Act
+    storage.insert(0, first);
+    storage.insert(storage.size(), last);
+
+    // Assert
+    Path::CommandStorage expected;
+    expected.push_back(first);
+    expected.append(createStorage());
+    expected.push_back(last);
+    expectEqual(storage, expected);
+    EXPECT_EQ(storage.value(1, 'Z'), 3.0);
+    EXPECT_EQ(storage.value(5, 'Z'), -1.0);
+}
+
+TEST(CommandStorage, eraseAtBothEnds)
+{
+    // Arrange
+    Path::CommandStorage storage = createStorage();
+
+    // Act
+    storage.erase(0);
+    storage.erase(storage.size() - 1);
+
+    // Assert
+    ASSERT_EQ(storage.size(), 2);
+    EXPECT_EQ(storage.at(0).Name, "G1");
+    EXPECT_EQ(storage.value(0, 'X'), 4.5);
+    EXPECT_EQ(storage.at(1).Name, "M6");
+    EXPECT_EQ(storage.at(1).Parameters.at("XX"), -1.5);
+
+    // the remaining commands are saved and restored as they are
+    Path::CommandStorage restored;
+    std::istringstream str(save(storage));
+    restored.restore(str);
+    expectEqual(storage, restored);
+}
+
+TEST(CommandStorage, replaceWithOtherSize)
+{
+    // Arrange
+    Path::CommandStorage storage = createStorage();
+    Path::Command cmd = makeCommand("G1", {{"X", 1.0}, {"Y", 1.0}, {"Z", 1.0}, {"FEED", 5.0}});
+
+    // Act
+    storage.replace(1, cmd);
+
+    // Assert
+    EXPECT_EQ(storage.at(1).Parameters, cmd.Parameters);
+    EXPECT_EQ(storage.at(2).Parameters.at("TOOL"), 7.0);
+    EXPECT_EQ(storage.value(3, 'I'), 0.5);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
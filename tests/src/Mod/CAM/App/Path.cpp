@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <App/Application.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+#include <Mod/CAM/App/Path.h>
+#include <src/App/InitApplication.h>
+#include <zipios++/zipinputstream.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ToolpathTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void TearDown() override
+    {
+        setSaveBinary(false);
+    }
+
+    static void setSaveBinary(bool on)
+    {
+        App::GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/CAM")
+            ->SetBool("SaveBinaryToolpath", on);
+    }
+
+    static Path::Toolpath createPath()
+    {
+        Path::Toolpath path;
+        path.setFromGCode("G0 X1.000000 Y2.000000 Z3.000000\n"
+                          "G1 X4.500000 F100.000000\n"
+                          "G2 I0.500000 J-0.500000 X1.000000 Y1.000000\n");
+        return path;
+    }
+
+    // Save() writes the XML, \a between is called before the document file is written
+    template<typename Func>
+    static std::string save(const Path::Toolpath& path, Func&& between)
+    {
+        std::ostringstream str;
+        {
+            Base::ZipWriter writer(str);
+            writer.ObjectName = "Path";
+            writer.putNextEntry("Document.xml");
+            writer.Stream() << "<?xml version='1.0' encoding='utf-8'?><Document>";
+            path.Save(writer);
+            writer.Stream() << "</Document>";
+            between();
+            writer.writeFiles();
+        }
+        return str.str();
+    }
+
+    static std::string save(const Path::Toolpath& path)
+    {
+        return save(path, []() {});
+    }
+
+    static Path::Toolpath restore(const std::string& archive)
+    {
+        Path::Toolpath path;
+        std::istringstream str(archive);
+        zipios::ZipInputStream zipstream(str);
+        Base::XMLReader reader("Path", zipstream);
+        reader.readElement("Document");
+        path.Restore(reader);
+        reader.readFiles(zipstream);
+        return path;
+    }
+
+    static void expectEqual(const Path::Toolpath& path1, const Path::Toolpath& path2)
+    {
+        ASSERT_EQ(path1.getSize(), path2.getSize());
+        for (unsigned int i = 0; i < path1.getSize(); i++) {
+            EXPECT_EQ(path1.getCommand(i).Name, path2.getCommand(i).Name);
+            EXPECT_EQ(path1.getCommand(i).Parameters, path2.getCommand(i).Parameters);
+        }
+    }
+};
+
+TEST_F(ToolpathTest, textRoundTrip)
+{
+    // Arrange
+    Path::Toolpath path = createPath();
+
+    // Act
+    Path::Toolpath restored = restore(save(path));
+
+    // Assert
+    expectEqual(path, restored);
+}
+
+TEST_F(ToolpathTest, binaryRoundTrip)
+{
+    // Arrange
+    Path::Toolpath path = createPath();
+    setSaveBinary(true);
+
+    // Act
+    Path::Toolpath restored = restore(save(path));
+
+    // Assert
+    expectEqual(path, restored);
+}
+
+TEST_F(ToolpathTest, binaryRoundTripEmpty)
+{
+    // Arrange
+    Path::Toolpath path;
+    setSaveBinary(true);
+
+    // Act
+    Path::Toolpath restored = restore(save(path));
+
+    // Assert
+    EXPECT_EQ(restored.getSize(), 0);
+}
+
+TEST_F(ToolpathTest, preferenceChangedWhileSaving)
+{
+    // Arrange
+    Path::Toolpath path = createPath();
+
+    // Act
+    setSaveBinary(true);
+    std::string binary = save(path, []() { setSaveBinary(false); });
+    std::string text = save(path, []() { setSaveBinary(true); });
+
+    // Assert
+    expectEqual(path, restore(binary));
+    expectEqual(path, restore(text));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
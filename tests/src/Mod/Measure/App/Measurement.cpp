@@ -0,0 +1,85 @@
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <Mod/Measure/App/Measurement.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <gtest/gtest.h>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Circ.hxx>
+#include <TopoDS_Edge.hxx>
+#include <cmath>
+
+class Measurement: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        document = App::GetApplication().newDocument("Measurement");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(document->getName());
+    }
+
+    App::Document* getDocument() const
+    {
+        return document;
+    }
+
+    TopoDS_Edge makeCircle(const gp_Pnt& pnt) const
+    {
+        gp_Circ circle;
+        circle.SetLocation(pnt);
+        circle.SetRadius(1.0);
+        BRepBuilderAPI_MakeEdge mkEdge(circle);
+        return mkEdge.Edge();
+    }
+
+private:
+    App::Document* document {};
+};
+
+// NOLINTBEGIN
+TEST_F(Measurement, testBatchLengthsAndAreas)
+{
+    App::Document* doc = getDocument();
+    auto box = doc->addObject<Part::Feature>("Box");
+    box->Shape.setValue(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape());
+
+    auto lengths = Measure::Measurement::lengths({box, box, box}, {"Edge1", "Edge2", "Edge1"});
+    ASSERT_EQ(lengths.size(), 3);
+    EXPECT_DOUBLE_EQ(lengths[0], 3.0);
+    EXPECT_DOUBLE_EQ(lengths[1], 2.0);
+    EXPECT_DOUBLE_EQ(lengths[2], lengths[0]);
+
+    auto areas = Measure::Measurement::areas({box, box}, {"Face1", "Face99"});
+    ASSERT_EQ(areas.size(), 2);
+    EXPECT_NEAR(areas[0], 6.0, 1e-9);
+    EXPECT_TRUE(std::isnan(areas[1]));
+
+    auto volumes = Measure::Measurement::volumes({box}, {""});
+    ASSERT_EQ(volumes.size(), 1);
+    EXPECT_NEAR(volumes[0], 6.0, 1e-9);
+}
+
+TEST_F(Measurement, testBatchDistances)
+{
+    App::Document* doc = getDocument();
+    auto p1 = doc->addObject<Part::Feature>("Shape1");
+    p1->Shape.setValue(makeCircle(gp_Pnt(0.0, 0.0, 0.0)));
+    auto p2 = doc->addObject<Part::Feature>("Shape2");
+    p2->Shape.setValue(makeCircle(gp_Pnt(5.0, 0.0, 0.0)));
+
+    auto distances =
+        Measure::Measurement::distances({p1, p1}, {"Edge1", "Edge1"}, {p2, p1}, {"Edge1", "Edge1"});
+    ASSERT_EQ(distances.size(), 2);
+    EXPECT_NEAR(distances[0], 3.0, 1e-7);
+    EXPECT_NEAR(distances[1], 0.0, 1e-7);
+}
+// NOLINTEND
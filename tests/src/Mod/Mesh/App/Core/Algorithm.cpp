@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshRefTest: public ::testing::Test
+{
+protected:
+    // unit square in the xy plane split into 2 * n * n facets
+    static MeshCore::MeshKernel createPlane(int n)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        float step = 1.0F / float(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                Base::Vector3f p1 {float(i) * step, float(j) * step, 0};
+                Base::Vector3f p2 {float(i + 1) * step, float(j) * step, 0};
+                Base::Vector3f p3 {float(i) * step, float(j + 1) * step, 0};
+                Base::Vector3f p4 {float(i + 1) * step, float(j + 1) * step, 0};
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p3, p2, p4);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+};
+
+TEST_F(MeshRefTest, TestPointToFacets)
+{
+    MeshCore::MeshKernel kernel = createPlane(200);
+    MeshCore::MeshRefPointToFacets vf_it(kernel);
+
+    std::vector<std::set<MeshCore::FacetIndex>> expected(kernel.CountPoints());
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (MeshCore::FacetIndex i = 0; i < facets.size(); i++) {
+        for (MeshCore::PointIndex p : facets[i]._aulPoints) {
+            expected[p].insert(i);
+        }
+    }
+
+    for (MeshCore::PointIndex p = 0; p < expected.size(); p++) {
+        MeshCore::MeshIndexList list = vf_it[p];
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), expected[p].begin(), expected[p].end()));
+    }
+}
+
+TEST_F(MeshRefTest, TestPointToPoints)
+{
+    MeshCore::MeshKernel kernel = createPlane(10);
+    MeshCore::MeshRefPointToPoints vv_it(kernel);
+
+    std::size_t inner = 0;
+    for (MeshCore::PointIndex p = 0; p < kernel.CountPoints(); p++) {
+        MeshCore::MeshIndexList list = vv_it[p];
+        EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+        EXPECT_EQ(std::adjacent_find(list.begin(), list.end()), list.end());
+        EXPECT_EQ(list.count(p), 0);
+        if (list.size() == 6) {
+            inner++;
+        }
+    }
+    EXPECT_EQ(inner, 81);
+}
+
+TEST_F(MeshRefTest, TestFacetToFacets)
+{
+    MeshCore::MeshKernel kernel = createPlane(10);
+    MeshCore::MeshRefFacetToFacets ff_it(kernel);
+
+    for (MeshCore::FacetIndex f = 0; f < kernel.CountFacets(); f++) {
+        MeshCore::MeshIndexList list = ff_it[f];
+        EXPECT_NE(list.find(f), list.end());
+        for (MeshCore::FacetIndex n : kernel.GetFacets()[f]._aulNeighbours) {
+            if (n != MeshCore::FACET_INDEX_MAX) {
+                EXPECT_EQ(list.count(n), 1);
+            }
+        }
+    }
+}
+
+TEST_F(MeshRefTest, TestAddAndRemoveNeighbour)
+{
+    MeshCore::MeshKernel kernel = createPlane(2);
+    MeshCore::MeshRefPointToFacets vf_it(kernel);
+
+    MeshCore::MeshIndexList list = vf_it[0];
+    std::vector<MeshCore::FacetIndex> facets(list.begin(), list.end());
+
+    // the list runs full and gets moved
+    for (MeshCore::FacetIndex f = 100; f < 110; f++) {
+        vf_it.AddNeighbour(0, f);
+    }
+    vf_it.AddNeighbour(0, 105);
+    list = vf_it[0];
+    EXPECT_EQ(list.size(), facets.size() + 10);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+
+    for (MeshCore::FacetIndex f = 100; f < 110; f++) {
+        vf_it.RemoveNeighbour(0, f);
+    }
+    list = vf_it[0];
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), facets.begin(), facets.end()));
+}
+
+TEST_F(MeshRefTest, TestCheckFacets)
+{
+    MeshCore::MeshKernel kernel = createPlane(100);
+    // the unit matrix maps the plane to [0.5, 1] x [0.5, 1]
+    Base::ViewProjMatrix proj {Base::Matrix4D()};
+
+    // a star shaped lasso with many edges
+    Base::Polygon2d polygon;
+    const int corners = 200;
+    for (int i = 0; i < corners; i++) {
+        double angle = 2.0 * std::numbers::pi * double(i) / double(corners);
+        double radius = (i % 2 == 0) ? 0.2 : 0.1;
+        polygon.Add(
+            Base::Vector2d(0.75 + radius * std::cos(angle), 0.75 + radius * std::sin(angle)));
+    }
+
+    for (bool inner : {true, false}) {
+        std::vector<MeshCore::FacetIndex> expected;
+        const MeshCore::MeshPointArray& points = kernel.GetPoints();
+        const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+        for (MeshCore::FacetIndex i = 0; i < facets.size(); i++) {
+            for (MeshCore::PointIndex p : facets[i]._aulPoints) {
+                Base::Vector3f pnt = proj(points[p]);
+                if (polygon.Contains(Base::Vector2d(pnt.x, pnt.y)) == inner) {
+                    expected.push_back(i);
+                    break;
+                }
+            }
+        }
+
+        std::vector<MeshCore::FacetIndex> indices;
+        MeshCore::MeshAlgorithm(kernel).CheckFacets(&proj, polygon, inner, indices);
+        EXPECT_FALSE(indices.empty());
+        EXPECT_EQ(indices, expected);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
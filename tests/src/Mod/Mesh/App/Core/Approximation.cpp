@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <Mod/Mesh/App/Core/Approximation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ApproximationTest: public ::testing::Test
+{
+protected:
+    // points on a sphere with some noise
+    static std::vector<Base::Vector3f>
+    spherePoints(const Base::Vector3f& center, float radius, int count, float noise, int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> angle(0.0F, 2.0F * std::numbers::pi_v<float>);
+        std::uniform_real_distribution<float> height(-1.0F, 1.0F);
+        std::uniform_real_distribution<float> error(-noise, noise);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            float z = height(gen);
+            float phi = angle(gen);
+            float r = std::sqrt(1.0F - z * z);
+            Base::Vector3f dir(r * std::cos(phi), r * std::sin(phi), z);
+            points.push_back(center + dir * (radius + error(gen)));
+        }
+        return points;
+    }
+
+    // points on the side of a cylinder along the z axis
+    static std::vector<Base::Vector3f>
+    cylinderPoints(const Base::Vector3f& base, float radius, int count, float noise, int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> angle(0.0F, 2.0F * std::numbers::pi_v<float>);
+        std::uniform_real_distribution<float> height(0.0F, 10.0F);
+        std::uniform_real_distribution<float> error(-noise, noise);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            float phi = angle(gen);
+            float r = radius + error(gen);
+            points.push_back(base + Base::Vector3f(r * std::cos(phi), r * std::sin(phi), height(gen)));
+        }
+        return points;
+    }
+};
+
+TEST_F(ApproximationTest, TestPlaneFit)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(-10.0F, 10.0F);
+    std::uniform_real_distribution<float> error(-0.01F, 0.01F);
+    Base::Vector3f normal(1.0F, 2.0F, 2.0F);
+    normal.Normalize();
+    Base::Vector3f base(1.0F, 2.0F, 3.0F);
+
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 1000; i++) {
+        Base::Vector3f pnt(dist(gen), dist(gen), dist(gen));
+        pnt.ProjectToPlane(base, normal);
+        points.push_back(pnt + normal * error(gen));
+    }
+
+    MeshCore::PlaneFit fit;
+    fit.AddPoints(std::span<const Base::Vector3f>(points));
+    EXPECT_LT(fit.Fit(), 0.01F);
+    EXPECT_NEAR(std::fabs(fit.GetNormal() * normal), 1.0F, 1.0e-4F);
+    EXPECT_NEAR(fit.GetDistanceToPlane(base), 0.0F, 1.0e-3F);
+}
+
+TEST_F(ApproximationTest, TestSphereFit)
+{
+    Base::Vector3f center(1.0F, 2.0F, 3.0F);
+    std::vector<Base::Vector3f> points = spherePoints(center, 5.0F, 500, 0.01F, 1);
+
+    MeshCore::SphereFit fit;
+    fit.AddPoints(points);
+    EXPECT_LT(fit.Fit(), 0.01F);
+    EXPECT_NEAR(fit.GetRadius(), 5.0F, 1.0e-3F);
+    EXPECT_LT(Base::Distance(fit.GetCenter(), center), 1.0e-3F);
+}
+
+TEST_F(ApproximationTest, TestCylinderFit)
+{
+    Base::Vector3f base(1.0F, 1.0F, 0.0F);
+    std::vector<Base::Vector3f> points = cylinderPoints(base, 2.0F, 500, 0.01F, 1);
+
+    MeshCore::CylinderFit fit;
+    fit.AddPoints(points);
+    EXPECT_LT(fit.Fit(), 0.01F);
+    EXPECT_NEAR(fit.GetRadius(), 2.0F, 1.0e-3F);
+    EXPECT_NEAR(std::fabs(fit.GetAxis().z), 1.0F, 1.0e-4F);
+    EXPECT_LT(base.DistanceToLine(fit.GetBase(), fit.GetAxis()), 1.0e-2F);
+}
+
+TEST_F(ApproximationTest, TestClearResetsResult)
+{
+    MeshCore::SphereFit fit;
+    fit.AddPoints(spherePoints(Base::Vector3f(), 1.0F, 100, 0.0F, 1));
+    fit.Fit();
+    EXPECT_TRUE(fit.Done());
+    EXPECT_LT(fit.GetLastResult(), 1.0e-4F);
+
+    fit.Clear();
+    EXPECT_FALSE(fit.Done());
+    EXPECT_EQ(fit.CountPoints(), 0);
+    EXPECT_EQ(fit.GetLastResult(), std::numeric_limits<float>::max());
+}
+
+TEST_F(ApproximationTest, TestFitPointSets)
+{
+    // sets of different size and radius, one of them too small to fit
+    std::vector<Base::Vector3f> points;
+    std::vector<std::size_t> offsets {0};
+    for (int i = 0; i < 100; i++) {
+        int count = i == 50 ? 3 : 20 + i;
+        auto set = spherePoints(Base::Vector3f(float(i), 0.0F, 0.0F), 1.0F + 0.1F * float(i), count, 0.001F, i);
+        points.insert(points.end(), set.begin(), set.end());
+        offsets.push_back(points.size());
+    }
+
+    std::vector<float> radius(100), result(100);
+    MeshCore::FitPointSets<MeshCore::SphereFit>(points,
+                                                offsets,
+                                                [&](std::size_t index, const MeshCore::SphereFit& fit) {
+                                                    radius[index] = fit.GetRadius();
+                                                    result[index] = fit.GetLastResult();
+                                                });
+
+    for (std::size_t i = 0; i < 100; i++) {
+        MeshCore::SphereFit fit;
+        fit.AddPoints(std::vector<Base::Vector3f>(points.begin() + offsets[i], points.begin() + offsets[i + 1]));
+        float sigma = fit.Fit();
+        EXPECT_EQ(result[i], sigma);
+        if (i == 50) {
+            EXPECT_EQ(result[i], std::numeric_limits<float>::max());
+        }
+        else {
+            EXPECT_EQ(radius[i], fit.GetRadius());
+            EXPECT_NEAR(radius[i], 1.0F + 0.1F * float(i), 1.0e-2F);
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class DecimationTest: public ::testing::Test
+{
+protected:
+    // unit square in the xy plane split into 2 * n * n facets
+    static MeshCore::MeshKernel createPlane(int n)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        float step = 1.0F / float(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                Base::Vector3f p1 {float(i) * step, float(j) * step, 0};
+                Base::Vector3f p2 {float(i + 1) * step, float(j) * step, 0};
+                Base::Vector3f p3 {float(i) * step, float(j + 1) * step, 0};
+                Base::Vector3f p4 {float(i + 1) * step, float(j + 1) * step, 0};
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p3, p2, p4);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    // unit sphere with the given number of rings and segments
+    static MeshCore::MeshKernel createSphere(int rings, int segments)
+    {
+        auto point = [=](int ring, int segment) {
+            double theta = std::numbers::pi * double(ring) / double(rings);
+            double phi = 2.0 * std::numbers::pi * double(segment % segments) / double(segments);
+            if (ring == 0 || ring == rings) {
+                phi = 0.0;
+            }
+            return Base::Vector3f(float(std::sin(theta) * std::cos(phi)),
+                                  float(std::sin(theta) * std::sin(phi)),
+                                  float(std::cos(theta)));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i + 1, j);
+                Base::Vector3f p3 = point(i, j + 1);
+                Base::Vector3f p4 = point(i + 1, j + 1);
+                if (i > 0) {
+                    facets.emplace_back(p1, p2, p3);
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(p3, p2, p4);
+                }
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static void expectValid(const MeshCore::MeshKernel& kernel)
+    {
+        MeshCore::MeshEvalTopology topology(kernel);
+        EXPECT_TRUE(topology.Evaluate());
+        MeshCore::MeshEvalNeighbourhood neighbourhood(kernel);
+        EXPECT_TRUE(neighbourhood.Evaluate());
+        MeshCore::MeshEvalOrientation orientation(kernel);
+        EXPECT_TRUE(orientation.Evaluate());
+    }
+};
+
+TEST_F(DecimationTest, TestTargetSizeOfSphere)
+{
+    MeshCore::MeshKernel kernel = createSphere(40, 80);
+    std::size_t numFacets = kernel.CountFacets();
+
+    MeshCore::MeshDecimation decimation(kernel);
+    std::size_t removed = decimation.decimate(1000);
+
+    EXPECT_EQ(removed, numFacets - kernel.CountFacets());
+    EXPECT_LE(kernel.CountFacets(), 1000);
+    EXPECT_GE(kernel.CountFacets(), 990);
+    expectValid(kernel);
+    MeshCore::MeshEvalSolid solid(kernel);
+    EXPECT_TRUE(solid.Evaluate());
+
+    for (const auto& point : kernel.GetPoints()) {
+        EXPECT_NEAR(point.Length(), 1.0F, 0.05F);
+    }
+}
+
+TEST_F(DecimationTest, TestPlaneKeepsBorder)
+{
+    MeshCore::MeshKernel kernel = createPlane(30);
+
+    MeshCore::MeshDecimation decimation(kernel);
+    decimation.decimate(100);
+
+    EXPECT_LE(kernel.CountFacets(), 100);
+    expectValid(kernel);
+    EXPECT_NEAR(kernel.GetSurface(), 1.0F, 1e-4F);
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxX, 1.0F);
+    EXPECT_FLOAT_EQ(box.MinY, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxY, 1.0F);
+    for (const auto& point : kernel.GetPoints()) {
+        EXPECT_FLOAT_EQ(point.z, 0.0F);
+    }
+}
+
+TEST_F(DecimationTest, TestMaxError)
+{
+    // a planar mesh can be collapsed without any error, a sphere cannot
+    MeshCore::MeshKernel plane = createPlane(10);
+    MeshCore::MeshDecimation(plane).decimate(0, 1e-6);
+    EXPECT_LT(plane.CountFacets(), 200);
+
+    MeshCore::MeshKernel sphere = createSphere(20, 40);
+    std::size_t numFacets = sphere.CountFacets();
+    MeshCore::MeshDecimation(sphere).decimate(0, 1e-12);
+    EXPECT_EQ(sphere.CountFacets(), numFacets);
+}
+
+TEST_F(DecimationTest, TestParallelDecimation)
+{
+    MeshCore::MeshKernel kernel = createSphere(100, 200);
+
+    MeshCore::MeshDecimation decimation(kernel);
+    decimation.setNumberOfThreads(4);
+    decimation.decimate(4000);
+
+    EXPECT_LE(kernel.CountFacets(), 4000);
+    EXPECT_GE(kernel.CountFacets(), 3990);
+    expectValid(kernel);
+    MeshCore::MeshEvalSolid solid(kernel);
+    EXPECT_TRUE(solid.Evaluate());
+    for (const auto& point : kernel.GetPoints()) {
+        EXPECT_NEAR(point.Length(), 1.0F, 0.02F);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
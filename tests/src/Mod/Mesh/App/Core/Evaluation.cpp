@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class EvaluationTest: public ::testing::Test
+{
+protected:
+    // sphere with the given number of rings and segments
+    static void addSphere(std::vector<MeshCore::MeshGeomFacet>& facets,
+                          const Base::Vector3f& center,
+                          int rings,
+                          int segments)
+    {
+        auto point = [=](int ring, int segment) {
+            double theta = std::numbers::pi * double(ring) / double(rings);
+            double phi = 2.0 * std::numbers::pi * double(segment % segments) / double(segments);
+            if (ring == 0 || ring == rings) {
+                phi = 0.0;
+            }
+            return center
+                + Base::Vector3f(float(std::sin(theta) * std::cos(phi)),
+                                 float(std::sin(theta) * std::sin(phi)),
+                                 float(std::cos(theta)));
+        };
+
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i + 1, j);
+                Base::Vector3f p3 = point(i, j + 1);
+                Base::Vector3f p4 = point(i + 1, j + 1);
+                if (i > 0) {
+                    facets.emplace_back(p1, p2, p3);
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(p3, p2, p4);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(EvaluationTest, TestNoSelfIntersection)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    addSphere(facets, Base::Vector3f(0, 0, 0), 20, 40);
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST_F(EvaluationTest, TestSelfIntersection)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    addSphere(facets, Base::Vector3f(0, 0, 0), 20, 40);
+    std::size_t numFacets = facets.size();
+    addSphere(facets, Base::Vector3f(0.5F, 0.3F, 0.1F), 20, 40);
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    ASSERT_FALSE(pairs.empty());
+
+    // each pair once with a facet of either sphere
+    EXPECT_TRUE(std::is_sorted(pairs.begin(), pairs.end()));
+    EXPECT_EQ(std::adjacent_find(pairs.begin(), pairs.end()), pairs.end());
+    for (const auto& it : pairs) {
+        EXPECT_LT(it.first, numFacets);
+        EXPECT_GE(it.second, numFacets);
+    }
+
+    std::vector<std::pair<Base::Vector3f, Base::Vector3f>> lines;
+    eval.GetIntersections(pairs, lines);
+    EXPECT_EQ(lines.size(), pairs.size());
+
+    MeshCore::MeshFixSelfIntersection fix(kernel, pairs);
+    fix.Fixup();
+    EXPECT_TRUE(MeshCore::MeshEvalSelfIntersection(kernel).Evaluate());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
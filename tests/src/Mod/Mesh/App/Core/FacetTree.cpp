@@ -0,0 +1,300 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <mutex>
+#include <numbers>
+#include <random>
+#include <set>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class FacetTreeTest: public ::testing::Test
+{
+protected:
+    // unit sphere with the given number of rings and segments
+    static MeshCore::MeshKernel createSphere(int rings, int segments)
+    {
+        auto point = [=](int ring, int segment) {
+            double theta = std::numbers::pi * double(ring) / double(rings);
+            double phi = 2.0 * std::numbers::pi * double(segment % segments) / double(segments);
+            if (ring == 0 || ring == rings) {
+                phi = 0.0;
+            }
+            return Base::Vector3f(float(std::sin(theta) * std::cos(phi)),
+                                  float(std::sin(theta) * std::sin(phi)),
+                                  float(std::cos(theta)));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i + 1, j);
+                Base::Vector3f p3 = point(i, j + 1);
+                Base::Vector3f p4 = point(i + 1, j + 1);
+                if (i > 0) {
+                    facets.emplace_back(p1, p2, p3);
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(p3, p2, p4);
+                }
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static std::vector<Base::Vector3f> createPoints(int count, float range)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-range, range);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+        return points;
+    }
+
+    static float nearestDistance(const MeshCore::MeshKernel& kernel,
+                                 const Base::Matrix4D& mat,
+                                 const Base::Vector3f& pnt)
+    {
+        float minDist = std::numeric_limits<float>::max();
+        MeshCore::MeshFacetIterator it(kernel);
+        it.Transform(mat);
+        for (it.Init(); it.More(); it.Next()) {
+            minDist = std::min(minDist, it->DistanceToPoint(pnt));
+        }
+        return minDist;
+    }
+};
+
+TEST_F(FacetTreeTest, TestNearestFacet)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshFacetTree tree(kernel);
+    EXPECT_EQ(tree.CountFacets(), kernel.CountFacets());
+
+    for (const auto& pnt : createPoints(200, 1.5F)) {
+        float dist {};
+        MeshCore::FacetIndex index = tree.NearestFacet(pnt, 10.0F, dist);
+        ASSERT_NE(index, MeshCore::FACET_INDEX_MAX);
+        EXPECT_NEAR(dist, nearestDistance(kernel, Base::Matrix4D(), pnt), 1e-5F);
+        EXPECT_NEAR(dist, kernel.GetFacet(index).DistanceToPoint(pnt), 1e-5F);
+    }
+}
+
+TEST_F(FacetTreeTest, TestMaxDistance)
+{
+    MeshCore::MeshKernel kernel = createSphere(10, 20);
+    MeshCore::MeshFacetTree tree(kernel);
+
+    float dist = -1.0F;
+    EXPECT_EQ(tree.NearestFacet(Base::Vector3f(5, 0, 0), 1.0F, dist), MeshCore::FACET_INDEX_MAX);
+    EXPECT_FLOAT_EQ(dist, -1.0F);
+    EXPECT_NE(tree.NearestFacet(Base::Vector3f(1.5F, 0, 0), 1.0F, dist), MeshCore::FACET_INDEX_MAX);
+    EXPECT_NEAR(dist, 0.5F, 0.01F);
+}
+
+TEST_F(FacetTreeTest, TestTransform)
+{
+    MeshCore::MeshKernel kernel = createSphere(10, 20);
+    Base::Matrix4D mat;
+    mat.scale(2.0, 1.0, 0.5);
+    mat.move(Base::Vector3d(10, 0, 0));
+    MeshCore::MeshFacetTree tree(kernel, mat);
+
+    for (const auto& pnt : createPoints(100, 3.0F)) {
+        Base::Vector3f moved = pnt + Base::Vector3f(10, 0, 0);
+        float dist {};
+        ASSERT_NE(tree.NearestFacet(moved, 100.0F, dist), MeshCore::FACET_INDEX_MAX);
+        EXPECT_NEAR(dist, nearestDistance(kernel, mat, moved), 1e-5F);
+    }
+}
+
+TEST_F(FacetTreeTest, TestFacetArray)
+{
+    MeshCore::MeshKernel kernel = createSphere(10, 20);
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        facets.push_back(*it);
+    }
+    MeshCore::MeshFacetTree tree(facets);
+
+    for (const auto& pnt : createPoints(100, 1.5F)) {
+        float dist {};
+        MeshCore::FacetIndex index = tree.NearestFacet(pnt, 10.0F, dist);
+        ASSERT_LT(index, facets.size());
+        EXPECT_NEAR(dist, facets[index].DistanceToPoint(pnt), 1e-5F);
+        EXPECT_NEAR(dist, nearestDistance(kernel, Base::Matrix4D(), pnt), 1e-5F);
+    }
+}
+
+TEST_F(FacetTreeTest, TestNearestFacetOnRay)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshFacetTree tree(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+
+    std::vector<Base::Vector3f> points = createPoints(200, 2.0F);
+    std::vector<Base::Vector3f> dirs = createPoints(201, 1.0F);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        // the brute-force search also takes intersections behind the point
+        const Base::Vector3f& pnt = points[i];
+        const Base::Vector3f& dir = dirs[i + 1];
+        Base::Vector3f res1;
+        Base::Vector3f res2;
+        MeshCore::FacetIndex index1 = MeshCore::FACET_INDEX_MAX;
+        bool found = alg.NearestFacetOnRay(pnt, dir, res1, index1);
+        MeshCore::FacetIndex index2 = tree.NearestFacetOnRay(pnt, dir, MeshCore::Mathf::PI, res2, true);
+        ASSERT_EQ(found, index2 != MeshCore::FACET_INDEX_MAX);
+        if (found) {
+            // a hit on a shared edge may be reported for either facet
+            EXPECT_NEAR(Base::Distance(pnt, res1), Base::Distance(pnt, res2), 1e-4F);
+            MeshCore::MeshGeomFacet facet = kernel.GetFacet(index2);
+            EXPECT_NEAR(res2.DistanceToPlane(facet._aclPoints[0], facet.GetNormal()), 0.0F, 1e-4F);
+        }
+    }
+}
+
+TEST_F(FacetTreeTest, TestRayDirection)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshFacetTree tree(kernel);
+    MeshCore::MeshAlgorithm alg(kernel);
+    const float maxAngle = MeshCore::Mathf::PI;
+
+    Base::Vector3f res;
+    Base::Vector3f dir(1, 0.01F, 0.02F);
+    EXPECT_NE(tree.NearestFacetOnRay(Base::Vector3f(), dir, maxAngle, res), MeshCore::FACET_INDEX_MAX);
+    EXPECT_NEAR(res.x, 1.0F, 0.01F);
+    EXPECT_EQ(tree.NearestFacetOnRay(Base::Vector3f(2, 0, 0), dir, maxAngle, res),
+              MeshCore::FACET_INDEX_MAX);
+    EXPECT_NE(tree.NearestFacetOnRay(Base::Vector3f(2, 0, 0), dir, maxAngle, res, true),
+              MeshCore::FACET_INDEX_MAX);
+    EXPECT_NEAR(res.x, 1.0F, 0.01F);
+
+    // the overload of the algorithm only searches in front of the point
+    MeshCore::FacetIndex index {};
+    EXPECT_TRUE(alg.NearestFacetOnRay(Base::Vector3f(-2, 0, 0), dir, tree, res, index));
+    EXPECT_NEAR(res.x, -1.0F, 0.01F);
+    EXPECT_FALSE(alg.NearestFacetOnRay(Base::Vector3f(2, 0, 0), dir, tree, res, index));
+}
+
+TEST_F(FacetTreeTest, TestRayMaxAngle)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshFacetTree tree(kernel);
+
+    // only one side of the sphere faces the ray
+    Base::Vector3f pnt(-2, 0.01F, 0.02F);
+    Base::Vector3f dir(1, 0, 0);
+    Base::Vector3f res;
+    MeshCore::FacetIndex index = tree.NearestFacetOnRay(pnt, dir, 1.0F, res);
+    ASSERT_NE(index, MeshCore::FACET_INDEX_MAX);
+    EXPECT_LE(kernel.GetFacet(index).GetNormal().GetAngle(dir), 1.0F);
+    EXPECT_NEAR(std::fabs(res.x), 1.0F, 0.01F);
+    EXPECT_EQ(tree.NearestFacetOnRay(pnt, Base::Vector3f(0, 0, 1), 1.0F, res),
+              MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(FacetTreeTest, TestOverlappingFacets)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshFacetTree tree(kernel);
+    std::vector<Base::BoundBox3f> boxes;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        boxes.push_back(kernel.GetFacet(i).GetBoundBox());
+    }
+
+    std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> expected;
+    for (MeshCore::FacetIndex i = 0; i < boxes.size(); i++) {
+        for (MeshCore::FacetIndex j = i + 1; j < boxes.size(); j++) {
+            if (boxes[i] && boxes[j]) {
+                expected.emplace(i, j);
+            }
+        }
+    }
+
+    for (std::size_t threads : {1, 4}) {
+        std::mutex mutex;
+        std::size_t calls = 0;
+        std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+        std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> overlapping;
+        auto collect = [&](std::size_t thread, MeshCore::FacetIndex i, MeshCore::FacetIndex j) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_LT(thread, threads);
+            EXPECT_LT(i, j);
+            calls++;
+            pairs.emplace(i, j);
+            if (boxes[i] && boxes[j]) {
+                overlapping.emplace(i, j);
+            }
+            return true;
+        };
+        tree.OverlappingFacets(threads, collect);
+        EXPECT_EQ(calls, pairs.size());
+        EXPECT_EQ(overlapping, expected);
+    }
+
+    std::size_t calls = 0;
+    tree.OverlappingFacets(1, [&calls](std::size_t, MeshCore::FacetIndex, MeshCore::FacetIndex) {
+        return ++calls < 5;
+    });
+    EXPECT_EQ(calls, 5);
+}
+
+TEST_F(FacetTreeTest, TestOverlappingFacetsOfTwoTrees)
+{
+    MeshCore::MeshKernel kernel1 = createSphere(20, 40);
+    MeshCore::MeshKernel kernel2 = createSphere(15, 30);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(0.5F, 0.2F, 0.1F));
+    kernel2.Transform(mat);
+    MeshCore::MeshFacetTree tree1(kernel1);
+    MeshCore::MeshFacetTree tree2(kernel2);
+
+    std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> expected;
+    for (MeshCore::FacetIndex i = 0; i < kernel1.CountFacets(); i++) {
+        for (MeshCore::FacetIndex j = 0; j < kernel2.CountFacets(); j++) {
+            if (kernel1.GetFacet(i).GetBoundBox() && kernel2.GetFacet(j).GetBoundBox()) {
+                expected.emplace(i, j);
+            }
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+
+    for (std::size_t threads : {1, 4}) {
+        std::mutex mutex;
+        std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> overlapping;
+        auto collect = [&](std::size_t thread, MeshCore::FacetIndex i, MeshCore::FacetIndex j) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_LT(thread, threads);
+            if (kernel1.GetFacet(i).GetBoundBox() && kernel2.GetFacet(j).GetBoundBox()) {
+                overlapping.emplace(i, j);
+            }
+            return true;
+        };
+        tree1.OverlappingFacets(tree2, threads, collect);
+        EXPECT_EQ(overlapping, expected);
+    }
+}
+
+TEST_F(FacetTreeTest, TestEmpty)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFacetTree tree(kernel);
+    float dist {};
+    EXPECT_EQ(tree.NearestFacet(Base::Vector3f(), 1.0F, dist), MeshCore::FACET_INDEX_MAX);
+    Base::Vector3f res;
+    EXPECT_EQ(tree.NearestFacetOnRay(Base::Vector3f(), Base::Vector3f(1, 0, 0), 1.0F, res),
+              MeshCore::FACET_INDEX_MAX);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings of the nearest facet search and ray picking, see src/BenchmarkHelpers.h. The sizes
+// can be reduced with the environment variables MESH_BENCHMARK_POINTS, MESH_BENCHMARK_RAYS and
+// MESH_BENCHMARK_FACETS.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+// Height field over the unit square with a fine fillet like region at x = 0 and coarse
+// facets elsewhere, as it's typical for tessellated CAD models.
+MeshCore::MeshKernel createUnevenMesh(std::size_t numFacets)
+{
+    auto n = static_cast<int>(std::sqrt(double(numFacets) / 2.0));
+    std::vector<float> xs(n + 1);
+    for (int i = 0; i <= n; i++) {
+        // cell sizes grow geometrically by four orders of magnitude
+        double t = double(i) / double(n);
+        xs[i] = float((std::pow(10000.0, t) - 1.0) / 9999.0);
+    }
+    auto height = [](float x, float y) {
+        return 0.05F * std::sin(20.0F * x) * std::cos(10.0F * y);
+    };
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.reserve(2 * n * n);
+    float step = 1.0F / float(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            float x1 = xs[i];
+            float x2 = xs[i + 1];
+            float y1 = float(j) * step;
+            float y2 = float(j + 1) * step;
+            Base::Vector3f p1 {x1, y1, height(x1, y1)};
+            Base::Vector3f p2 {x2, y1, height(x2, y1)};
+            Base::Vector3f p3 {x1, y2, height(x1, y2)};
+            Base::Vector3f p4 {x2, y2, height(x2, y2)};
+            facets.emplace_back(p1, p2, p3);
+            facets.emplace_back(p3, p2, p4);
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    return kernel;
+}
+
+// points scattered around the surface like a scan with noise
+std::vector<Base::Vector3f> createScan(std::size_t numPoints)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos(0.0F, 1.0F);
+    std::normal_distribution<float> noise(0.0F, 0.01F);
+    std::vector<Base::Vector3f> points;
+    points.reserve(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        float x = pos(gen);
+        float y = pos(gen);
+        points.emplace_back(x, y, 0.05F * std::sin(20.0F * x) * std::cos(10.0F * y) + noise(gen));
+    }
+    return points;
+}
+
+}  // namespace
+
+// Compares the grid as used by Inspection::InspectNominalMesh with the search tree
+TEST(FacetTreeBenchmark, nearestFacet)  // NOLINT
+{
+    const float radius = 0.05F;
+    MeshCore::MeshKernel kernel =
+        createUnevenMesh(tests::sizeFromEnvironment("MESH_BENCHMARK_FACETS", 2000000));
+    std::vector<Base::Vector3f> points =
+        createScan(tests::sizeFromEnvironment("MESH_BENCHMARK_POINTS", 10000000));
+    RecordProperty("facets", std::to_string(kernel.CountFacets()));
+    RecordProperty("points", std::to_string(points.size()));
+
+    auto start = std::chrono::steady_clock::now();
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    float minGridLen =
+        std::pow(box.LengthX() * box.LengthY() * box.LengthZ() / 8000000.0F, 0.3333F);
+    float gridLen = std::max(minGridLen, 5.0F * MeshCore::MeshAlgorithm(kernel).GetAverageEdgeLength());
+    MeshCore::MeshFacetGrid grid(kernel, gridLen);
+    tests::record("grid.build", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    MeshCore::MeshFacetTree tree(kernel);
+    tests::record("tree.build", tests::elapsedMilliseconds(start));
+
+    // the grid is only searched for a sample because it's too slow
+    std::size_t gridPoints = std::min<std::size_t>(points.size(), 10000);
+    std::vector<float> gridDist(gridPoints);
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < gridPoints; i++) {
+        std::set<MeshCore::ElementIndex> indices;
+        grid.MeshGrid::SearchNearestFromPoint(points[i], indices);
+        float minDist = std::numeric_limits<float>::max();
+        for (auto index : indices) {
+            minDist = std::min(minDist, kernel.GetFacet(index).DistanceToPoint(points[i]));
+        }
+        gridDist[i] = minDist;
+    }
+    double gridTime = tests::elapsedMilliseconds(start);
+    tests::record("grid.search", gridTime * double(points.size()) / double(gridPoints));
+
+    start = std::chrono::steady_clock::now();
+    std::size_t found = 0;
+    std::size_t closer = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        float dist {};
+        if (tree.NearestFacet(points[i], radius, dist) != MeshCore::FACET_INDEX_MAX) {
+            found++;
+            // the grid only checks the neighbourhood and may miss the nearest facet
+            if (i < gridPoints) {
+                EXPECT_LE(dist, gridDist[i] + 1e-5F);
+                if (dist < gridDist[i] - 1e-5F) {
+                    closer++;
+                }
+            }
+        }
+    }
+    tests::record("tree.search", tests::elapsedMilliseconds(start));
+    RecordProperty("found", std::to_string(found));
+    RecordProperty("closerThanGrid", std::to_string(closer));
+    EXPECT_GT(found, 0);
+}
+
+// Compares the grid as used by picking and MeshPart::MeshProjection with the search tree
+TEST(FacetTreeBenchmark, nearestFacetOnRay)  // NOLINT
+{
+    MeshCore::MeshKernel kernel =
+        createUnevenMesh(tests::sizeFromEnvironment("MESH_BENCHMARK_FACETS", 2000000));
+    std::vector<Base::Vector3f> points =
+        createScan(tests::sizeFromEnvironment("MESH_BENCHMARK_RAYS", 10000));
+    RecordProperty("facets", std::to_string(kernel.CountFacets()));
+    RecordProperty("rays", std::to_string(points.size()));
+    // rays from above the surface downwards
+    const Base::Vector3f dir(0.1F, 0.05F, -1.0F);
+    for (auto& pnt : points) {
+        pnt.z = 1.0F;
+    }
+
+    MeshCore::MeshAlgorithm alg(kernel);
+    auto start = std::chrono::steady_clock::now();
+    MeshCore::MeshFacetGrid grid(kernel, 5.0F * alg.GetAverageEdgeLength());
+    tests::record("grid.build", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    MeshCore::MeshFacetTree tree(kernel);
+    tests::record("tree.build", tests::elapsedMilliseconds(start));
+
+    std::vector<Base::Vector3f> gridHits(points.size());
+    start = std::chrono::steady_clock::now();
+    std::size_t gridFound = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        MeshCore::FacetIndex index {};
+        if (alg.NearestFacetOnRay(points[i], dir, grid, gridHits[i], index)) {
+            gridFound++;
+        }
+    }
+    tests::record("grid.search", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    std::size_t treeFound = 0;
+    std::size_t differ = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        MeshCore::FacetIndex index {};
+        Base::Vector3f res;
+        if (alg.NearestFacetOnRay(points[i], dir, tree, res, index)) {
+            treeFound++;
+            if (Base::DistanceP2(res, gridHits[i]) > 1e-8F) {
+                differ++;
+            }
+        }
+    }
+    tests::record("tree.search", tests::elapsedMilliseconds(start));
+    RecordProperty("found", std::to_string(treeFound));
+    RecordProperty("differentFromGrid", std::to_string(differ));
+    // the cells along the ray may miss a facet hit close to their border
+    EXPECT_GE(treeFound, gridFound);
+    EXPECT_GT(treeFound, 0);
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings and accuracy of the primitive fits over many small point sets, like segmentation
+// produces them, see src/BenchmarkHelpers.h. Besides the timings the tests record the mean
+// parameter error. The number of sets can be reduced with the environment variable
+// MESH_BENCHMARK_FIT_SETS.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <string>
+
+#include <Mod/Mesh/App/Core/Approximation.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+constexpr int pointsPerSet = 200;
+
+// point sets on spheres and cylinders of radius 1 + i % 5, with noise of 0.1%
+struct PointSets
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<std::size_t> offsets {0};
+    std::vector<float> radius;
+};
+
+PointSets createSets(std::size_t count, bool cylinder)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> angle(0.0F, 2.0F * std::numbers::pi_v<float>);
+    std::uniform_real_distribution<float> height(-1.0F, 1.0F);
+    std::uniform_real_distribution<float> noise(-0.001F, 0.001F);
+    PointSets sets;
+    sets.points.reserve(count * pointsPerSet);
+    for (std::size_t i = 0; i < count; i++) {
+        float radius = 1.0F + float(i % 5);
+        Base::Vector3f center(float(i), 0.0F, 0.0F);
+        for (int j = 0; j < pointsPerSet; j++) {
+            float phi = angle(gen);
+            float z = height(gen);
+            float r = radius * (1.0F + noise(gen));
+            if (cylinder) {
+                sets.points.push_back(center
+                                      + Base::Vector3f(r * std::cos(phi), r * std::sin(phi), 20.0F * z));
+            }
+            else {
+                float s = std::sqrt(1.0F - z * z);
+                sets.points.push_back(center
+                                      + Base::Vector3f(s * std::cos(phi), s * std::sin(phi), z) * r);
+            }
+        }
+        sets.offsets.push_back(sets.points.size());
+        sets.radius.push_back(radius);
+    }
+    return sets;
+}
+
+template<class FitT>
+void compare(const PointSets& sets)
+{
+    std::size_t count = sets.radius.size();
+    ::testing::Test::RecordProperty("sets", std::to_string(count));
+
+    // one fit object per set that gets its points one by one
+    std::vector<float> single(count);
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; i++) {
+        FitT fit;
+        for (std::size_t j = sets.offsets[i]; j < sets.offsets[i + 1]; j++) {
+            fit.AddPoint(sets.points[j]);
+        }
+        fit.Fit();
+        single[i] = fit.GetRadius();
+    }
+    tests::record("single", tests::elapsedMilliseconds(start));
+
+    // the radius of a failed fit is meaningless, the batch reports it as FLOAT_MAX
+    std::vector<float> batched(count);
+    start = std::chrono::steady_clock::now();
+    auto store = [&](std::size_t index, const FitT& fit) {
+        batched[index] = fit.GetLastResult() < std::numeric_limits<float>::max()
+            ? fit.GetRadius()
+            : std::numeric_limits<float>::max();
+    };
+    MeshCore::FitPointSets<FitT>(sets.points, sets.offsets, store);
+    tests::record("batched", tests::elapsedMilliseconds(start));
+
+    double error = 0.0;
+    std::size_t fitted = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        if (batched[i] < std::numeric_limits<float>::max()) {
+            EXPECT_EQ(single[i], batched[i]);
+            error += std::fabs(batched[i] - sets.radius[i]);
+            fitted++;
+        }
+    }
+    tests::record("fitted", double(fitted));
+    tests::record("mean_radius_error", error / double(fitted));
+    EXPECT_EQ(fitted, count);
+    EXPECT_LT(error / double(fitted), 1.0e-2);
+}
+
+}  // namespace
+
+TEST(FitBenchmark, sphereFit)  // NOLINT
+{
+    compare<MeshCore::SphereFit>(
+        createSets(tests::sizeFromEnvironment("MESH_BENCHMARK_FIT_SETS", 5000), false));
+}
+
+TEST(FitBenchmark, cylinderFit)  // NOLINT
+{
+    compare<MeshCore::CylinderFit>(
+        createSets(tests::sizeFromEnvironment("MESH_BENCHMARK_FIT_SETS", 5000), true));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/Health.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class HealthTest: public ::testing::Test
+{
+protected:
+    // closed sphere with the given number of rings and segments
+    static MeshCore::MeshKernel createSphere(int rings, int segments)
+    {
+        auto point = [=](int ring, int segment) {
+            double theta = std::numbers::pi * double(ring) / double(rings);
+            double phi = 2.0 * std::numbers::pi * double(segment % segments) / double(segments);
+            if (ring == 0 || ring == rings) {
+                phi = 0.0;
+            }
+            return Base::Vector3f(float(std::sin(theta) * std::cos(phi)),
+                                  float(std::sin(theta) * std::sin(phi)),
+                                  float(std::cos(theta)));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i + 1, j);
+                Base::Vector3f p3 = point(i, j + 1);
+                Base::Vector3f p4 = point(i + 1, j + 1);
+                if (i > 0) {
+                    facets.emplace_back(p1, p2, p3);
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(p3, p2, p4);
+                }
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+};
+
+TEST_F(HealthTest, TestValidMesh)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshEvalHealth eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+    EXPECT_TRUE(eval.GetReport().IsValid());
+    EXPECT_EQ(eval.GetReport().openEdges, 0);
+}
+
+TEST_F(HealthTest, TestDefects)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    MeshCore::MeshFacetArray facets = kernel.GetFacets();
+    MeshCore::FacetIndex numFacets = facets.size();
+
+    // a copy of a facet, a facet with flipped orientation and a facet using a copy of a point
+    facets.push_back(facets[5]);
+    std::swap(facets[10]._aulPoints[1], facets[10]._aulPoints[2]);
+    MeshCore::PointIndex copied = facets[200]._aulPoints[0];
+    points.push_back(points[copied]);
+    facets[200]._aulPoints[0] = points.size() - 1;
+    kernel.Adopt(points, facets, true);
+
+    MeshCore::MeshEvalHealth eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    const MeshCore::MeshHealthReport& report = eval.GetReport();
+
+    std::vector<MeshCore::FacetIndex> duplicatedFacets {numFacets};
+    EXPECT_EQ(report.duplicatedFacets, duplicatedFacets);
+
+    ASSERT_EQ(report.duplicatedPoints.size(), 1);
+    EXPECT_EQ(report.duplicatedPoints[0].first, kernel.CountPoints() - 1);
+    EXPECT_EQ(report.duplicatedPoints[0].second, copied);
+
+    // the copied facet makes its three edges non-manifold
+    EXPECT_EQ(report.nonManifoldEdges.size(), 3);
+    EXPECT_NE(std::find(report.wrongOrientation.begin(), report.wrongOrientation.end(), 10),
+              report.wrongOrientation.end());
+    EXPECT_GT(report.openEdges, 0);
+    EXPECT_TRUE(report.invalidNeighbourhood.empty());
+
+    MeshCore::MeshFixHealth fix(kernel, report);
+    fix.Fixup();
+
+    MeshCore::MeshEvalHealth check(kernel);
+    EXPECT_TRUE(check.Evaluate());
+    EXPECT_EQ(check.GetReport().openEdges, 0);
+    EXPECT_EQ(kernel.CountFacets(), numFacets);
+}
+
+TEST_F(HealthTest, TestIndices)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    MeshCore::MeshFacetArray facets = kernel.GetFacets();
+    facets[3]._aulNeighbours[0] = facets.size() + 5;
+    facets[7]._aulPoints[1] = facets[7]._aulPoints[0];
+    kernel.Adopt(points, facets, false);
+
+    MeshCore::MeshEvalHealth eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    const MeshCore::MeshHealthReport& report = eval.GetReport();
+    EXPECT_EQ(report.neighboursOutOfRange, std::vector<MeshCore::FacetIndex> {3});
+    EXPECT_EQ(report.corruptedFacets, std::vector<MeshCore::FacetIndex> {7});
+    EXPECT_FALSE(report.invalidNeighbourhood.empty());
+
+    MeshCore::MeshFixHealth fix(kernel, report);
+    fix.Fixup();
+    MeshCore::MeshEvalHealth check(kernel);
+    check.Evaluate();
+    EXPECT_TRUE(check.GetReport().neighboursOutOfRange.empty());
+    EXPECT_TRUE(check.GetReport().corruptedFacets.empty());
+    EXPECT_TRUE(check.GetReport().invalidNeighbourhood.empty());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
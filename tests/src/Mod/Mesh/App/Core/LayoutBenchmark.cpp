@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings of the common point kernels on the MeshPointArray and on MeshPointCoordinates, see
+// src/BenchmarkHelpers.h. The size can be reduced with the environment variable
+// MESH_BENCHMARK_LAYOUT_POINTS.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/Layout.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+template<class Func>
+void run(const std::string& name, Func&& func)
+{
+    constexpr int repeat = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++) {
+        func();
+    }
+    tests::record(name, tests::elapsedMilliseconds(start) / repeat);
+}
+
+MeshCore::MeshPointArray createPoints(std::size_t numPoints)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-100.0F, 100.0F);
+    MeshCore::MeshPointArray points;
+    points.reserve(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        points.emplace_back(dist(gen), dist(gen), dist(gen));
+    }
+    return points;
+}
+
+}  // namespace
+
+TEST(LayoutBenchmark, pointKernels)  // NOLINT
+{
+    MeshCore::MeshPointArray points =
+        createPoints(tests::sizeFromEnvironment("MESH_BENCHMARK_LAYOUT_POINTS", 10000000));
+    MeshCore::MeshPointCoordinates coords(points);
+    RecordProperty("points", std::to_string(points.size()));
+
+    Base::BoundBox3f box1, box2;
+    run("boundbox_array", [&]() {
+        box1.SetVoid();
+        for (const auto& it : points) {
+            box1.Add(it);
+        }
+    });
+    run("boundbox_coordinates", [&]() {
+        box2 = coords.GetBoundBox();
+    });
+    EXPECT_EQ(box1.MaxX, box2.MaxX);
+
+    Base::Matrix4D mat;
+    mat.rotZ(0.001);
+    run("transform_array", [&]() {
+        points.Transform(mat);
+    });
+    run("transform_coordinates", [&]() {
+        coords.Transform(mat);
+    });
+
+    Base::Vector3f pnt(1.0F, 2.0F, 3.0F);
+    MeshCore::PointIndex nearest1 = MeshCore::POINT_INDEX_MAX;
+    MeshCore::PointIndex nearest2 = MeshCore::POINT_INDEX_MAX;
+    run("nearest_array", [&]() {
+        float minDist = std::numeric_limits<float>::max();
+        for (std::size_t i = 0; i < points.size(); i++) {
+            float dist = Base::DistanceP2(points[i], pnt);
+            if (dist < minDist) {
+                minDist = dist;
+                nearest1 = i;
+            }
+        }
+    });
+    run("nearest_coordinates", [&]() {
+        nearest2 = coords.NearestPoint(pnt);
+    });
+    EXPECT_EQ(nearest1, nearest2);
+}
+
+TEST(LayoutBenchmark, resetFlags)  // NOLINT
+{
+    MeshCore::MeshPointArray points =
+        createPoints(tests::sizeFromEnvironment("MESH_BENCHMARK_LAYOUT_POINTS", 10000000));
+    MeshCore::MeshFlagBits flags(points.size());
+    RecordProperty("points", std::to_string(points.size()));
+
+    run("reset_array", [&]() {
+        points.ResetFlag(MeshCore::MeshPoint::VISIT);
+    });
+    run("reset_bits", [&]() {
+        flags.ResetAll();
+    });
+    EXPECT_EQ(flags.Count(), 0);
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <sstream>
+#include <Base/Exception.h>
+#include <Base/Writer.h>
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/Layout.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshKernelTest: public ::testing::Test
+{
+protected:
+    // a grid of triangles with open edges at its border
+    static MeshCore::MeshKernel createGrid(int size)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                Base::Vector3f p1(float(i), float(j), 0.1F * float(i * j));
+                Base::Vector3f p2(float(i + 1), float(j), 0.1F * float((i + 1) * j));
+                Base::Vector3f p3(float(i), float(j + 1), 0.1F * float(i * (j + 1)));
+                Base::Vector3f p4(float(i + 1), float(j + 1), 0.1F * float((i + 1) * (j + 1)));
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p3, p2, p4);
+            }
+        }
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static void expectEqual(const MeshCore::MeshKernel& kernel1, const MeshCore::MeshKernel& kernel2)
+    {
+        ASSERT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+        ASSERT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+        for (MeshCore::PointIndex i = 0; i < kernel1.CountPoints(); i++) {
+            EXPECT_EQ(kernel1.GetPoint(i), kernel2.GetPoint(i));
+        }
+        const MeshCore::MeshFacetArray& facets1 = kernel1.GetFacets();
+        const MeshCore::MeshFacetArray& facets2 = kernel2.GetFacets();
+        for (std::size_t i = 0; i < facets1.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(facets1[i]._aulPoints[j], facets2[i]._aulPoints[j]);
+                EXPECT_EQ(facets1[i]._aulNeighbours[j], facets2[i]._aulNeighbours[j]);
+            }
+        }
+        Base::BoundBox3f box1 = kernel1.GetBoundBox();
+        Base::BoundBox3f box2 = kernel2.GetBoundBox();
+        EXPECT_EQ(box1.GetMinimum(), box2.GetMinimum());
+        EXPECT_EQ(box1.GetMaximum(), box2.GetMaximum());
+    }
+};
+
+TEST_F(MeshKernelTest, TestWriteRawRead)
+{
+    MeshCore::MeshKernel kernel = createGrid(70);
+    std::stringstream str;
+    kernel.WriteRaw(str);
+
+    // header, points and facets are aligned
+    std::size_t pointSize = 12 * kernel.CountPoints();
+    pointSize += (64 - pointSize % 64) % 64;
+    EXPECT_EQ(Base::Writer::storedAlignment, 64);
+    EXPECT_EQ(str.str().size(), 64 + pointSize + 24 * kernel.CountFacets());
+
+    MeshCore::MeshKernel restored;
+    restored.Read(str);
+    expectEqual(kernel, restored);
+}
+
+TEST_F(MeshKernelTest, TestWriteRawEmpty)
+{
+    MeshCore::MeshKernel kernel;
+    std::stringstream str;
+    kernel.WriteRaw(str);
+    MeshCore::MeshKernel restored = createGrid(2);
+    restored.Read(str);
+    EXPECT_EQ(restored.CountPoints(), 0);
+    EXPECT_EQ(restored.CountFacets(), 0);
+}
+
+TEST_F(MeshKernelTest, TestReadRawInvalid)
+{
+    MeshCore::MeshKernel kernel = createGrid(10);
+    std::stringstream str;
+    kernel.WriteRaw(str);
+
+    // truncated data
+    std::string data = str.str();
+    std::stringstream truncated(data.substr(0, data.size() - 10));
+    MeshCore::MeshKernel restored;
+    EXPECT_THROW(restored.Read(truncated), Base::BadFormatError);
+
+    // point index out of range
+    std::size_t pointSize = 12 * kernel.CountPoints();
+    pointSize += (64 - pointSize % 64) % 64;
+    data[64 + pointSize + 3] = char(0x7f);
+    std::stringstream invalid(data);
+    EXPECT_THROW(restored.Read(invalid), Base::BadFormatError);
+    EXPECT_EQ(restored.CountPoints(), 0);
+}
+
+TEST_F(MeshKernelTest, TestWriteRead)
+{
+    MeshCore::MeshKernel kernel = createGrid(20);
+    std::stringstream str;
+    kernel.Write(str);
+    MeshCore::MeshKernel restored;
+    restored.Read(str);
+    expectEqual(kernel, restored);
+}
+
+TEST_F(MeshKernelTest, TestRebuildNeighbours)
+{
+    // large enough to use the radix sort and several threads
+    MeshCore::MeshKernel kernel = createGrid(200);
+    MeshCore::MeshFacetArray expected = kernel.GetFacets();
+
+    std::map<std::pair<MeshCore::PointIndex, MeshCore::PointIndex>, MeshCore::FacetIndex> edges;
+    for (MeshCore::FacetIndex i = 0; i < expected.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            MeshCore::PointIndex p0 = expected[i]._aulPoints[j];
+            MeshCore::PointIndex p1 = expected[i]._aulPoints[(j + 1) % 3];
+            edges[std::make_pair(std::min(p0, p1), std::max(p0, p1))] += 1;
+        }
+    }
+    for (const auto& facet : expected) {
+        for (int j = 0; j < 3; j++) {
+            MeshCore::PointIndex p0 = facet._aulPoints[j];
+            MeshCore::PointIndex p1 = facet._aulPoints[(j + 1) % 3];
+            MeshCore::FacetIndex count = edges[std::make_pair(std::min(p0, p1), std::max(p0, p1))];
+            EXPECT_EQ(count == 1, facet._aulNeighbours[j] == MeshCore::FACET_INDEX_MAX);
+        }
+    }
+
+    // the complete and the incremental rebuild restore the links
+    MeshCore::MeshFacetArray facets = expected;
+    for (auto& facet : facets) {
+        facet._aulNeighbours[0] = facet._aulNeighbours[1] = facet._aulNeighbours[2] = 0;
+    }
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    kernel.Adopt(points, facets, false);
+    kernel.RebuildNeighbours(0);
+    const MeshCore::MeshFacetArray& result = kernel.GetFacets();
+    ASSERT_EQ(result.size(), expected.size());
+    for (MeshCore::FacetIndex i = 0; i < expected.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(result[i]._aulNeighbours[j], expected[i]._aulNeighbours[j]);
+        }
+    }
+}
+
+TEST_F(MeshKernelTest, TestPointCoordinates)
+{
+    MeshCore::MeshKernel kernel = createGrid(20);
+    MeshCore::MeshPointCoordinates coords = kernel.GetPointCoordinates();
+    ASSERT_EQ(coords.Size(), kernel.CountPoints());
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_EQ(coords.GetPoint(i), kernel.GetPoint(i));
+    }
+
+    Base::BoundBox3f box1 = coords.GetBoundBox();
+    Base::BoundBox3f box2 = kernel.GetBoundBox();
+    EXPECT_EQ(box1.MinX, box2.MinX);
+    EXPECT_EQ(box1.MaxY, box2.MaxY);
+    EXPECT_EQ(box1.MaxZ, box2.MaxZ);
+
+    EXPECT_EQ(coords.NearestPoint(kernel.GetPoint(17) + Base::Vector3f(0.1F, 0, 0)), 17);
+    std::vector<float> dist;
+    coords.SquaredDistances(kernel.GetPoint(5), dist);
+    EXPECT_EQ(dist[5], 0.0F);
+
+    // transforming the copy gives the same points as transforming the kernel
+    Base::Matrix4D mat;
+    mat.rotX(0.3);
+    mat.move(Base::Vector3d(1, 2, 3));
+    coords.Transform(mat);
+    MeshCore::MeshKernel copy = kernel;
+    copy.Transform(mat);
+    kernel.SetPointCoordinates(coords);
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_FLOAT_EQ(kernel.GetPoint(i).x, copy.GetPoint(i).x);
+        EXPECT_FLOAT_EQ(kernel.GetPoint(i).y, copy.GetPoint(i).y);
+        EXPECT_FLOAT_EQ(kernel.GetPoint(i).z, copy.GetPoint(i).z);
+    }
+    EXPECT_FLOAT_EQ(kernel.GetBoundBox().MaxZ, copy.GetBoundBox().MaxZ);
+}
+
+TEST_F(MeshKernelTest, TestFlagBits)
+{
+    MeshCore::MeshFlagBits flags(130);
+    EXPECT_EQ(flags.Count(), 0);
+    flags.Set(0);
+    flags.Set(64);
+    flags.Set(129);
+    EXPECT_TRUE(flags.Test(64));
+    EXPECT_FALSE(flags.Test(63));
+    EXPECT_FALSE(flags.TestAndSet(129));
+    EXPECT_TRUE(flags.TestAndSet(128));
+    flags.Reset(0);
+    std::vector<std::size_t> indices {64, 128, 129};
+    EXPECT_EQ(flags.GetIndices(), indices);
+
+    flags.SetAll();
+    EXPECT_EQ(flags.Count(), 130);
+    flags.ResetAll();
+    EXPECT_EQ(flags.Count(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
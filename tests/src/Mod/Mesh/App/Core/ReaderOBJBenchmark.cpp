@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Read megabytes per second of the OBJ reader, see src/BenchmarkHelpers.h. The size can be
+// reduced with the environment variable MESH_BENCHMARK_OBJ_POINTS.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+// height field over the unit square with about numPoints points in OBJ format
+std::string createOBJ(std::size_t numPoints)
+{
+    auto n = static_cast<int>(std::sqrt(double(numPoints)));
+    std::ostringstream str;
+    str.precision(7);
+    float step = 1.0F / float(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            float x = float(i) * step;
+            float y = float(j) * step;
+            str << "v " << x << " " << y << " " << 0.05F * std::sin(20.0F * x) * std::cos(10.0F * y)
+                << "\n";
+        }
+    }
+    for (int i = 0; i + 1 < n; i++) {
+        for (int j = 0; j + 1 < n; j++) {
+            int k = i * n + j + 1;
+            str << "f " << k << "/" << k << " " << k + n << "/" << k + n << " " << k + 1 << "/"
+                << k + 1 << "\n";
+            str << "f " << k + 1 << " " << k + n << " " << k + n + 1 << "\n";
+        }
+    }
+    return str.str();
+}
+
+}  // namespace
+
+TEST(ReaderOBJBenchmark, load)  // NOLINT
+{
+    std::string data = createOBJ(tests::sizeFromEnvironment("MESH_BENCHMARK_OBJ_POINTS", 4000000));
+    RecordProperty("bytes", std::to_string(data.size()));
+
+    std::istringstream str(data);
+    MeshCore::MeshKernel kernel;
+    MeshCore::Material mat;
+    MeshCore::ReaderOBJ reader(kernel, &mat);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(reader.Load(str));
+    double seconds = tests::elapsedMilliseconds(start) / 1000.0;
+    tests::record("throughput", double(data.size()) / (1024.0 * 1024.0) / seconds);
+    EXPECT_GT(kernel.CountFacets(), 0);
+}
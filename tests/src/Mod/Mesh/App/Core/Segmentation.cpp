@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <Mod/Mesh/App/Core/Approximation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// accepts the facets that are marked in a mask
+class MaskSegment: public MeshCore::MeshSurfaceSegment
+{
+public:
+    MaskSegment(const MeshCore::MeshKernel& kernel,
+                const std::vector<bool>& test,
+                const std::vector<bool>& initial,
+                bool stateless)
+        : MeshCore::MeshSurfaceSegment(3)
+        , kernel(kernel)
+        , test(test)
+        , initial(initial)
+        , stateless(stateless)
+    {}
+    bool TestFacet(const MeshCore::MeshFacet& face) const override
+    {
+        return test[&face - &kernel.GetFacets()[0]];
+    }
+    bool TestInitialFacet(MeshCore::FacetIndex index) const override
+    {
+        return initial[index];
+    }
+    const char* GetType() const override
+    {
+        return "Mask";
+    }
+    bool IsStateless() const override
+    {
+        return stateless;
+    }
+
+private:
+    const MeshCore::MeshKernel& kernel;
+    const std::vector<bool>& test;
+    const std::vector<bool>& initial;
+    bool stateless;
+};
+
+}  // namespace
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    // n x n grid in the xy plane, folded by 90 degrees along x = 0.5
+    static MeshCore::MeshKernel createGrid(int n, bool folded)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        float step = 1.0F / float(n);
+        auto point = [=](int i, int j) {
+            float x = float(i) * step;
+            float y = float(j) * step;
+            if (folded && x > 0.5F) {
+                return Base::Vector3f(0.5F, y, x - 0.5F);
+            }
+            return Base::Vector3f(x, y, 0.0F);
+        };
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static std::vector<MeshCore::MeshSegment> findSegments(const MeshCore::MeshKernel& kernel,
+                                                           const std::vector<bool>& test1,
+                                                           const std::vector<bool>& test2,
+                                                           const std::vector<bool>& initial,
+                                                           bool stateless)
+    {
+        std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
+        segm.emplace_back(std::make_shared<MaskSegment>(kernel, test1, initial, stateless));
+        segm.emplace_back(std::make_shared<MaskSegment>(kernel, test2, initial, stateless));
+        MeshCore::MeshSegmentAlgorithm finder(kernel);
+        finder.FindSegments(segm);
+
+        std::vector<MeshCore::MeshSegment> result;
+        for (const auto& it : segm) {
+            for (auto segment : it->GetSegments()) {
+                std::sort(segment.begin(), segment.end());
+                result.push_back(segment);
+            }
+            result.emplace_back();
+        }
+        return result;
+    }
+};
+
+TEST_F(SegmentationTest, TestStatelessSegments)
+{
+    MeshCore::MeshKernel kernel = createGrid(100, false);
+    std::size_t count = kernel.CountFacets();
+
+    std::mt19937 gen(42);
+    std::bernoulli_distribution dist(0.6);
+    std::vector<bool> test1(count), test2(count), initial(count);
+    for (std::size_t i = 0; i < count; i++) {
+        test1[i] = dist(gen);
+        test2[i] = dist(gen);
+        initial[i] = dist(gen);
+    }
+
+    // the parallel search gives the same segments as growing one after the other
+    auto serial = findSegments(kernel, test1, test2, initial, false);
+    auto parallel = findSegments(kernel, test1, test2, initial, true);
+    EXPECT_GT(serial.size(), 10);
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST_F(SegmentationTest, TestPlaneSegments)
+{
+    MeshCore::MeshKernel kernel = createGrid(20, true);
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
+    segm.emplace_back(
+        std::make_shared<MeshCore::MeshDistanceGenericSurfaceFitSegment>(new MeshCore::PlaneSurfaceFit,
+                                                                         kernel,
+                                                                         10,
+                                                                         0.01F));
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    finder.FindSegments(segm);
+
+    const std::vector<MeshCore::MeshSegment>& segments = segm.front()->GetSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[0].size() + segments[1].size(), kernel.CountFacets());
+}
+
+TEST_F(SegmentationTest, TestIncrementalPlaneFit)
+{
+    std::vector<Base::Vector3f> points;
+    points.emplace_back(0, 0, 0);
+    points.emplace_back(1, 0, 0.1F);
+    points.emplace_back(0, 1, -0.1F);
+    points.emplace_back(1, 1, 0.05F);
+    points.emplace_back(2, 3, 0);
+    MeshCore::PlaneFit fit;
+    MeshCore::IncrementalPlaneFit incremental;
+    EXPECT_EQ(incremental.Fit(), std::numeric_limits<float>::max());
+    for (const auto& pnt : points) {
+        fit.AddPoint(pnt);
+        incremental.AddPoint(pnt);
+    }
+    EXPECT_FALSE(incremental.Done());
+    EXPECT_FLOAT_EQ(incremental.Fit(), fit.Fit());
+    EXPECT_TRUE(incremental.Done());
+    EXPECT_EQ(incremental.CountPoints(), points.size());
+    EXPECT_EQ(incremental.GetBase(), fit.GetBase());
+    EXPECT_EQ(incremental.GetNormal(), fit.GetNormal());
+    EXPECT_FLOAT_EQ(incremental.GetDistanceToPlane(Base::Vector3f(0, 0, 1)),
+                    fit.GetDistanceToPlane(Base::Vector3f(0, 0, 1)));
+
+    incremental.Clear();
+    EXPECT_EQ(incremental.CountPoints(), 0);
+    EXPECT_FALSE(incremental.Done());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
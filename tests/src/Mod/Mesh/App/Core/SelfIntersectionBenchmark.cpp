@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Timings of the self-intersection check, see src/BenchmarkHelpers.h. The size of the generated
+// mesh can be reduced with the environment variable MESH_BENCHMARK_INTERSECTION_FACETS.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+using FacetPairs = std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>>;
+
+// two wavy sheets over the unit square that cut each other, with numFacets facets in total
+MeshCore::MeshKernel createCrossingSheets(std::size_t numFacets)
+{
+    auto n = static_cast<int>(std::sqrt(double(numFacets) / 4.0));
+    float step = 1.0F / float(n);
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (int sheet = 0; sheet < 2; sheet++) {
+        auto offset = MeshCore::PointIndex(points.size());
+        for (int i = 0; i <= n; i++) {
+            for (int j = 0; j <= n; j++) {
+                float x = float(i) * step;
+                float y = float(j) * step;
+                float z = sheet == 0 ? 0.05F * std::sin(20.0F * x) * std::cos(10.0F * y)
+                                     : 0.02F * std::cos(7.0F * x + 3.0F * y);
+                points.emplace_back(x, y, z);
+            }
+        }
+        auto index = [n, offset](int i, int j) {
+            return offset + MeshCore::PointIndex(i) * MeshCore::PointIndex(n + 1)
+                + MeshCore::PointIndex(j);
+        };
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                facets.emplace_back(index(i, j), index(i + 1, j), index(i, j + 1));
+                facets.emplace_back(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1));
+            }
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+// The former search that tests the facet pairs of every grid cell
+FacetPairs gridIntersections(const MeshCore::MeshKernel& kernel)
+{
+    FacetPairs intersection;
+    MeshCore::MeshFacetGrid grid(kernel);
+    MeshCore::MeshGridIterator gridIter(grid);
+    const MeshCore::MeshFacetArray& faces = kernel.GetFacets();
+    std::vector<Base::BoundBox3f> boxes;
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Begin(); it.More(); it.Next()) {
+        boxes.push_back((*it).GetBoundBox());
+    }
+
+    Base::Vector3f pt1, pt2;
+    for (gridIter.Init(); gridIter.More(); gridIter.Next()) {
+        std::vector<MeshCore::FacetIndex> elements;
+        gridIter.GetElements(elements);
+        for (auto jt = elements.begin(); jt != elements.end(); ++jt) {
+            for (auto kt = jt + 1; kt != elements.end(); ++kt) {
+                const MeshCore::MeshFacet& face1 = faces[*jt];
+                const MeshCore::MeshFacet& face2 = faces[*kt];
+                if (face2.HasPoint(face1._aulPoints[0]) || face2.HasPoint(face1._aulPoints[1])
+                    || face2.HasPoint(face1._aulPoints[2])) {
+                    continue;
+                }
+                if (boxes[*jt] && boxes[*kt]) {
+                    MeshCore::MeshGeomFacet facet1 = kernel.GetFacet(*jt);
+                    MeshCore::MeshGeomFacet facet2 = kernel.GetFacet(*kt);
+                    if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                        intersection.emplace_back(std::min(*jt, *kt), std::max(*jt, *kt));
+                    }
+                }
+            }
+        }
+    }
+
+    // a pair is found in every cell that both facets share
+    std::sort(intersection.begin(), intersection.end());
+    intersection.erase(std::unique(intersection.begin(), intersection.end()), intersection.end());
+    return intersection;
+}
+
+void compare(const std::string& name, const MeshCore::MeshKernel& kernel)
+{
+    auto start = std::chrono::steady_clock::now();
+    FacetPairs grid = gridIntersections(kernel);
+    tests::record(name + "_grid", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    FacetPairs tree;
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    eval.GetIntersections(tree);
+    tests::record(name + "_tree", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    bool valid = eval.Evaluate();
+    tests::record(name + "_evaluate", tests::elapsedMilliseconds(start));
+
+    EXPECT_EQ(grid, tree);
+    EXPECT_EQ(valid, tree.empty());
+}
+
+}  // namespace
+
+TEST(SelfIntersectionBenchmark, crossingSheets)  // NOLINT
+{
+    MeshCore::MeshKernel kernel = createCrossingSheets(
+        tests::sizeFromEnvironment("MESH_BENCHMARK_INTERSECTION_FACETS", 2000000));
+    RecordProperty("facets", std::to_string(kernel.CountFacets()));
+    compare("sheets", kernel);
+}
+
+TEST(SelfIntersectionBenchmark, testData)  // NOLINT
+{
+    for (const char* name : {"NASTRAN_Test_GRID_CQUAD4.bdf",
+                             "NASTRAN_Test_GRID_CTRIA3.bdf",
+                             "NASTRAN_Test_GRIDSTAR_CQUAD4.bdf",
+                             "NASTRAN_Test_Delimited_GRID_CQUAD4.bdf"}) {
+        std::string file(TESTDATADIR);
+        file.append("/").append(name);
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshInput input(kernel);
+        ASSERT_TRUE(input.LoadAny(file.c_str()));
+        compare(name, kernel);
+    }
+}
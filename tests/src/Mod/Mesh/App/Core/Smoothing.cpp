@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SmoothingTest: public ::testing::Test
+{
+protected:
+    // unit square in the xy plane split into 2 * n * n facets with a bump at the center
+    static MeshCore::MeshKernel createPlane(int n)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        float step = 1.0F / float(n);
+        auto point = [=](int i, int j) {
+            float z = (i == n / 2 && j == n / 2) ? 0.1F : 0.0F;
+            return Base::Vector3f(float(i) * step, float(j) * step, z);
+        };
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static float maxHeight(const MeshCore::MeshKernel& kernel)
+    {
+        float height = 0.0F;
+        for (const auto& point : kernel.GetPoints()) {
+            height = std::max(height, std::fabs(point.z));
+        }
+        return height;
+    }
+
+    static void expectBorderUnchanged(const MeshCore::MeshKernel& kernel)
+    {
+        for (const auto& point : kernel.GetPoints()) {
+            if (point.x == 0.0F || point.x == 1.0F || point.y == 0.0F || point.y == 1.0F) {
+                EXPECT_FLOAT_EQ(point.z, 0.0F);
+            }
+        }
+    }
+};
+
+TEST_F(SmoothingTest, TestLaplace)
+{
+    MeshCore::MeshKernel kernel = createPlane(20);
+    MeshCore::LaplaceSmoothing smoothing(kernel);
+    smoothing.Smooth(5);
+
+    EXPECT_LT(maxHeight(kernel), 0.05F);
+    EXPECT_GT(maxHeight(kernel), 0.0F);
+    expectBorderUnchanged(kernel);
+}
+
+TEST_F(SmoothingTest, TestTaubin)
+{
+    MeshCore::MeshKernel kernel = createPlane(20);
+    MeshCore::TaubinSmoothing smoothing(kernel);
+    smoothing.Smooth(10);
+
+    EXPECT_LT(maxHeight(kernel), 0.1F);
+    expectBorderUnchanged(kernel);
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxX, 1.0F);
+}
+
+TEST_F(SmoothingTest, TestSmoothPoints)
+{
+    MeshCore::MeshKernel kernel = createPlane(20);
+    std::vector<MeshCore::PointIndex> indices;
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        if (kernel.GetPoint(i).z != 0.0F) {
+            indices.push_back(i);
+        }
+    }
+    ASSERT_EQ(indices.size(), 1);
+
+    MeshCore::LaplaceSmoothing smoothing(kernel);
+    smoothing.SmoothPoints(1, indices);
+
+    // only the selected point moves, by lambda times its distance to the neighbours
+    EXPECT_NEAR(kernel.GetPoint(indices.front()).z, 0.1 * (1.0 - smoothing.GetLambda()), 1e-6);
+    EXPECT_FLOAT_EQ(maxHeight(kernel), kernel.GetPoint(indices.front()).z);
+}
+
+TEST_F(SmoothingTest, TestPlaneFitAndMedian)
+{
+    MeshCore::MeshKernel kernel = createPlane(20);
+    MeshCore::PlaneFitSmoothing planeFit(kernel);
+    planeFit.Smooth(3);
+    EXPECT_LT(maxHeight(kernel), 0.1F);
+
+    float height = maxHeight(kernel);
+    MeshCore::MedianFilterSmoothing median(kernel);
+    median.Smooth(3);
+    EXPECT_LE(maxHeight(kernel), height);
+    expectBorderUnchanged(kernel);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Smoothed points per second of the smoothing algorithms, see src/BenchmarkHelpers.h. The size
+// can be reduced with the environment variable MESH_BENCHMARK_SMOOTH_POINTS.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+// noisy height field over the unit square with about numPoints points
+MeshCore::MeshKernel createNoisyMesh(std::size_t numPoints)
+{
+    auto n = static_cast<int>(std::sqrt(double(numPoints))) - 1;
+    std::mt19937 gen(42);
+    std::normal_distribution<float> noise(0.0F, 0.001F);
+    float step = 1.0F / float(n);
+
+    MeshCore::MeshPointArray points;
+    points.reserve(std::size_t(n + 1) * std::size_t(n + 1));
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            float x = float(i) * step;
+            float y = float(j) * step;
+            points.emplace_back(x, y, 0.05F * std::sin(20.0F * x) * std::cos(10.0F * y) + noise(gen));
+        }
+    }
+
+    MeshCore::MeshFacetArray facets;
+    facets.reserve(2 * std::size_t(n) * std::size_t(n));
+    auto index = [n](int i, int j) {
+        return MeshCore::PointIndex(i) * MeshCore::PointIndex(n + 1) + MeshCore::PointIndex(j);
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            facets.emplace_back(index(i, j), index(i + 1, j), index(i, j + 1));
+            facets.emplace_back(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+void run(const char* name, MeshCore::AbstractSmoothing& smoothing, unsigned int iterations,
+         std::size_t numPoints)
+{
+    auto start = std::chrono::steady_clock::now();
+    smoothing.Smooth(iterations);
+    double seconds = tests::elapsedMilliseconds(start) / 1000.0;
+    tests::record(name, double(numPoints) * double(iterations) / seconds);
+}
+
+}  // namespace
+
+TEST(SmoothingBenchmark, smooth)  // NOLINT
+{
+    MeshCore::MeshKernel kernel =
+        createNoisyMesh(tests::sizeFromEnvironment("MESH_BENCHMARK_SMOOTH_POINTS", 10000000));
+    std::size_t numPoints = kernel.CountPoints();
+    RecordProperty("points", std::to_string(numPoints));
+
+    MeshCore::LaplaceSmoothing laplace(kernel);
+    run("laplace", laplace, 20, numPoints);
+
+    MeshCore::TaubinSmoothing taubin(kernel);
+    run("taubin", taubin, 20, numPoints);
+
+    MeshCore::PlaneFitSmoothing planeFit(kernel);
+    run("planeFit", planeFit, 5, numPoints);
+
+    MeshCore::MedianFilterSmoothing median(kernel);
+    run("median", median, 5, numPoints);
+
+    EXPECT_EQ(kernel.CountPoints(), numPoints);
+}
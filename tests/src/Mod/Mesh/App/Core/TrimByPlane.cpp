@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/Health.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/TrimByPlane.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class TrimByPlaneTest: public ::testing::Test
+{
+protected:
+    // closed sphere with the given number of rings and segments
+    static MeshCore::MeshKernel createSphere(int rings, int segments)
+    {
+        auto point = [=](int ring, int segment) {
+            double theta = std::numbers::pi * double(ring) / double(rings);
+            double phi = 2.0 * std::numbers::pi * double(segment % segments) / double(segments);
+            if (ring == 0 || ring == rings) {
+                phi = 0.0;
+            }
+            return Base::Vector3f(float(std::sin(theta) * std::cos(phi)),
+                                  float(std::sin(theta) * std::sin(phi)),
+                                  float(std::cos(theta)));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i + 1, j);
+                Base::Vector3f p3 = point(i, j + 1);
+                Base::Vector3f p4 = point(i + 1, j + 1);
+                if (i > 0) {
+                    facets.emplace_back(p1, p2, p3);
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(p3, p2, p4);
+                }
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+};
+
+TEST_F(TrimByPlaneTest, TestTrim)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    std::size_t numFacets = kernel.CountFacets();
+    Base::Vector3f base(0.0F, 0.0F, 0.05F);
+    Base::Vector3f normal(0.0F, 0.0F, 1.0F);
+
+    std::vector<MeshCore::FacetIndex> removed;
+    MeshCore::MeshTrimByPlane trim(kernel);
+    trim.Trim(base, normal, removed);
+
+    EXPECT_TRUE(std::is_sorted(removed.begin(), removed.end()));
+    EXPECT_LT(kernel.CountFacets(), numFacets);
+    EXPECT_GT(kernel.CountFacets(), numFacets - removed.size());
+
+    // the cut points are shared, so the result is a valid hemisphere with one open border
+    MeshCore::MeshEvalHealth eval(kernel);
+    eval.Evaluate();
+    const MeshCore::MeshHealthReport& report = eval.GetReport();
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_TRUE(report.duplicatedPoints.empty());
+
+    std::size_t onPlane = 0;
+    for (const auto& point : kernel.GetPoints()) {
+        EXPECT_LE(point.z, base.z + 1.0e-5F);
+        if (std::fabs(point.z - base.z) < 1.0e-5F) {
+            onPlane++;
+        }
+    }
+    EXPECT_GT(onPlane, 0);
+    EXPECT_EQ(report.openEdges, onPlane);
+}
+
+TEST_F(TrimByPlaneTest, TestSameSurfaceAsTrimFacets)
+{
+    MeshCore::MeshKernel kernel = createSphere(20, 40);
+    Base::Vector3f base(0.1F, 0.2F, 0.3F);
+    Base::Vector3f normal(1.0F, 2.0F, 3.0F);
+    normal.Normalize();
+
+    MeshCore::MeshKernel other(kernel);
+    std::vector<MeshCore::FacetIndex> trimFacets, removeFacets;
+    std::vector<MeshCore::MeshGeomFacet> triangles;
+    MeshCore::MeshTrimByPlane otherTrim(other);
+    MeshCore::MeshFacetGrid grid(other);
+    otherTrim.CheckFacets(grid, base, normal, trimFacets, removeFacets);
+    otherTrim.TrimFacets(trimFacets, base, normal, triangles);
+    other.DeleteFacets(removeFacets);
+    other.AddFacets(triangles);
+
+    std::vector<MeshCore::FacetIndex> removed;
+    MeshCore::MeshTrimByPlane trim(kernel);
+    trim.Trim(base, normal, removed);
+
+    EXPECT_EQ(removed, removeFacets);
+    EXPECT_EQ(kernel.CountFacets(), other.CountFacets());
+    EXPECT_NEAR(kernel.GetSurface(), other.GetSurface(), 1.0e-4F);
+}
+
+TEST_F(TrimByPlaneTest, TestKeepAndRemoveAll)
+{
+    MeshCore::MeshKernel kernel = createSphere(10, 20);
+    std::size_t numPoints = kernel.CountPoints();
+    std::size_t numFacets = kernel.CountFacets();
+    Base::Vector3f normal(0.0F, 0.0F, 1.0F);
+
+    std::vector<MeshCore::FacetIndex> removed;
+    MeshCore::MeshTrimByPlane trim(kernel);
+    trim.Trim(Base::Vector3f(0.0F, 0.0F, 2.0F), normal, removed);
+    EXPECT_TRUE(removed.empty());
+    EXPECT_EQ(kernel.CountPoints(), numPoints);
+    EXPECT_EQ(kernel.CountFacets(), numFacets);
+
+    trim.Trim(Base::Vector3f(0.0F, 0.0F, -2.0F), normal, removed);
+    EXPECT_EQ(removed.size(), numFacets);
+    EXPECT_EQ(kernel.CountPoints(), 0);
+    EXPECT_EQ(kernel.CountFacets(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
+#include <cstring>
+#include <sstream>
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/IO/Writer3MF.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -37,4 +43,159 @@ TEST_F(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+TEST_F(ImporterTest, Test3MFRoundTrip)
+{
+    // a grid whose vertices and triangles are written in several chunks
+    const int n = 200;
+    MeshCore::MeshPointArray points;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            points.emplace_back(0.1F * float(i), 0.1F * float(j), 0.01F * float((i * j) % 13));
+        }
+    }
+    MeshCore::MeshFacetArray facets;
+    for (int i = 0; i + 1 < n; i++) {
+        for (int j = 0; j + 1 < n; j++) {
+            MeshCore::PointIndex k = i * n + j;
+            facets.emplace_back(k, k + n, k + 1);
+            facets.emplace_back(k + 1, k + n, k + n + 1);
+        }
+    }
+    MeshCore::MeshKernel mesh;
+    mesh.Adopt(points, facets, true);
+
+    std::stringstream str;
+    {
+        MeshCore::Writer3MF writer(str);
+        EXPECT_EQ(writer.AddMesh(mesh, Base::Matrix4D()), true);
+        EXPECT_EQ(writer.Save(), true);
+    }
+
+    MeshCore::Reader3MF reader(str);
+    EXPECT_EQ(reader.Load(), true);
+    std::vector<int> ids = reader.GetMeshIds();
+    ASSERT_EQ(ids.size(), 1);
+    const MeshCore::MeshKernel& copy = reader.GetMesh(ids[0]);
+    EXPECT_EQ(copy.CountPoints(), mesh.CountPoints());
+    EXPECT_EQ(copy.CountFacets(), mesh.CountFacets());
+    EXPECT_EQ(copy.GetPoints().back(), mesh.GetPoints().back());
+    EXPECT_EQ(copy.GetFacets().back()._aulPoints[2], mesh.GetFacets().back()._aulPoints[2]);
+}
+
+TEST_F(ImporterTest, TestBinarySTLFromBuffer)
+{
+    // a tetrahedron with four facets, each record has a normal, three points and an attribute
+    const float points[4][3][3] = {{{0, 0, 0}, {0, 1, 0}, {1, 0, 0}},
+                                   {{0, 0, 0}, {1, 0, 0}, {0, 0, 1}},
+                                   {{0, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+                                   {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+    uint32_t count = 4;
+    std::string data(80, ' ');
+    data.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& facet : points) {
+        const float normal[3] = {0, 0, 0};
+        const uint16_t attribute = 0;
+        data.append(reinterpret_cast<const char*>(normal), sizeof(normal));
+        data.append(reinterpret_cast<const char*>(facet), sizeof(facet));
+        data.append(reinterpret_cast<const char*>(&attribute), sizeof(attribute));
+    }
+
+    MeshCore::MeshKernel mesh1;
+    MeshCore::MeshInput input1(mesh1);
+    EXPECT_EQ(input1.LoadBinarySTL(data.data(), data.size()), true);
+    EXPECT_EQ(mesh1.CountPoints(), 4);
+    EXPECT_EQ(mesh1.CountEdges(), 6);
+    EXPECT_EQ(mesh1.CountFacets(), 4);
+
+    std::istringstream str(data);
+    MeshCore::MeshKernel mesh2;
+    MeshCore::MeshInput input2(mesh2);
+    EXPECT_EQ(input2.LoadBinarySTL(str), true);
+    EXPECT_EQ(mesh2.CountPoints(), mesh1.CountPoints());
+    EXPECT_EQ(mesh2.CountFacets(), mesh1.CountFacets());
+
+    // truncated buffer
+    MeshCore::MeshKernel mesh3;
+    MeshCore::MeshInput input3(mesh3);
+    EXPECT_EQ(input3.LoadBinarySTL(data.data(), data.size() - 1), false);
+}
+
+TEST_F(ImporterTest, TestOBJ)
+{
+    std::string data = "# comment\n"
+                       "mtllib cube.mtl\n"
+                       "v 0 0 0\n"
+                       "v 1.0 0 0\n"
+                       "v 1 1e0 -0\n"
+                       "v +0 1 .0\r\n"
+                       "vn 0 0 1\n"
+                       "g bottom\n"
+                       "usemtl red\n"
+                       "f 1//1 2//1 3//1 4//1\n"
+                       "g side\n"
+                       "usemtl blue\n"
+                       "v 0 0 1\n"
+                       "f -1 -5/1 -4/1/1\n"
+                       "f 5 1 4\n"
+                       "f 1 2 x\n";
+
+    std::istringstream str(data);
+    MeshCore::MeshKernel mesh;
+    MeshCore::Material mat;
+    MeshCore::ReaderOBJ reader(mesh, &mat);
+    EXPECT_EQ(reader.Load(str), true);
+    EXPECT_EQ(mesh.CountPoints(), 5);
+    EXPECT_EQ(mesh.CountFacets(), 4);
+    EXPECT_EQ(reader.GetGroupNames(), std::vector<std::string>({"bottom", "side"}));
+    EXPECT_EQ(mat.library, "cube.mtl");
+    EXPECT_EQ(mat.binding, MeshCore::MeshIO::PER_FACE);
+    EXPECT_EQ(mat.diffuseColor.size(), 4);
+}
+
+TEST_F(ImporterTest, TestOBJWithColors)
+{
+    std::string data = "v 0 0 0 255 0 0\n"
+                       "v 1 0 0 0 255 0\n"
+                       "v 0 1 0 0 0 255\n"
+                       "f 1 2 3\n";
+
+    std::istringstream str(data);
+    MeshCore::MeshKernel mesh;
+    MeshCore::Material mat;
+    MeshCore::ReaderOBJ reader(mesh, &mat);
+    EXPECT_EQ(reader.Load(str), true);
+    EXPECT_EQ(mesh.CountFacets(), 1);
+    EXPECT_EQ(mat.binding, MeshCore::MeshIO::PER_VERTEX);
+    ASSERT_EQ(mat.diffuseColor.size(), 3);
+    EXPECT_EQ(mat.diffuseColor[1], Base::Color(0.0F, 1.0F, 0.0F));
+}
+
+TEST_F(ImporterTest, TestLargeOBJ)
+{
+    // a grid that is read in several blocks and chunks with relative indices at the end
+    const int n = 300;
+    std::ostringstream out;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            out << "v " << i << " " << j << " " << 0.5 * (i % 7) << "\n";
+        }
+    }
+    for (int i = 0; i + 1 < n; i++) {
+        for (int j = 0; j + 1 < n; j++) {
+            int k = i * n + j + 1;
+            out << "f " << k << " " << k + n << " " << k + 1 << "\n";
+            out << "f " << k + 1 << "/1 " << k + n << "/1 " << k + n + 1 << "/1\n";
+        }
+    }
+    out << "v 0 0 -1\nf -1 1 2\n";
+
+    std::istringstream str(out.str());
+    MeshCore::MeshKernel mesh;
+    MeshCore::ReaderOBJ reader(mesh, nullptr);
+    EXPECT_EQ(reader.Load(str), true);
+    EXPECT_EQ(mesh.CountPoints(), n * n + 1);
+    EXPECT_EQ(mesh.CountFacets(), 2 * (n - 1) * (n - 1) + 1);
+    EXPECT_EQ(mesh.GetFacet(mesh.CountFacets() - 1)._aclPoints[0], Base::Vector3f(0, 0, -1));
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <cmath>
+#include <Base/Exception.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
@@ -95,4 +97,95 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST(MeshTest, TestCompactGridStorage)
+{
+    // a wavy height field
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    const int num = 40;
+    auto point = [](int i, int j) {
+        return Base::Vector3f(float(i), float(j), 2.0F * std::sin(0.3F * float(i + j)));
+    };
+    for (int i = 0; i < num; i++) {
+        for (int j = 0; j < num; j++) {
+            facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+            facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    MeshCore::MeshFacetGrid facetGrid(kernel, 8);
+    MeshCore::MeshFacetGrid compactGrid(kernel, 8);
+    compactGrid.SetCompactStorage(true);
+    EXPECT_EQ(compactGrid.IsCompactStorage(), true);
+    EXPECT_EQ(compactGrid.Verify(), true);
+
+    MeshCore::MeshGridIterator it1(facetGrid);
+    MeshCore::MeshGridIterator it2(compactGrid);
+    for (it1.Init(), it2.Init(); it1.More() && it2.More(); it1.Next(), it2.Next()) {
+        std::vector<MeshCore::ElementIndex> elements1;
+        std::vector<MeshCore::ElementIndex> elements2;
+        it1.GetElements(elements1);
+        it2.GetElements(elements2);
+        EXPECT_EQ(elements1, elements2);
+        EXPECT_EQ(it1.GetCtElements(), it2.GetCtElements());
+    }
+    EXPECT_EQ(it1.More(), it2.More());
+
+    Base::Vector3f pnt(10.3F, 20.7F, 1.0F);
+    EXPECT_EQ(facetGrid.SearchNearestFromPoint(pnt), compactGrid.SearchNearestFromPoint(pnt));
+
+    MeshCore::MeshPointGrid pointGrid(kernel, 8);
+    MeshCore::MeshPointGrid compactPointGrid(kernel, 8);
+    compactPointGrid.SetCompactStorage(true);
+    std::set<MeshCore::ElementIndex> points1;
+    std::set<MeshCore::ElementIndex> points2;
+    pointGrid.FindElements(pnt, points1);
+    compactPointGrid.FindElements(pnt, points2);
+    EXPECT_EQ(points1, points2);
+
+    // rebuilding fills the compact storage directly
+    compactGrid.Rebuild(8);
+    EXPECT_EQ(compactGrid.Verify(), true);
+    EXPECT_EQ(facetGrid.SearchNearestFromPoint(pnt), compactGrid.SearchNearestFromPoint(pnt));
+}
+
+namespace
+{
+class FacetGrid: public MeshCore::MeshFacetGrid
+{
+public:
+    using MeshCore::MeshFacetGrid::AddFacet;
+    using MeshCore::MeshFacetGrid::MeshFacetGrid;
+};
+
+class PointGrid: public MeshCore::MeshPointGrid
+{
+public:
+    using MeshCore::MeshPointGrid::AddPoint;
+    using MeshCore::MeshPointGrid::MeshPointGrid;
+};
+}  // namespace
+
+TEST(MeshTest, TestCompactGridAddElement)
+{
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshGeomFacet facet({0, 0, 0}, {1, 0, 0}, {0, 1, 0});
+    kernel.AddFacet(facet);
+
+    FacetGrid facetGrid(kernel, 2);
+    facetGrid.AddFacet(facet, 0);
+    EXPECT_EQ(facetGrid.Verify(), true);
+    facetGrid.SetCompactStorage(true);
+    EXPECT_THROW(facetGrid.AddFacet(facet, 0), Base::RuntimeError);
+
+    PointGrid pointGrid(kernel, 2);
+    pointGrid.AddPoint(kernel.GetPoint(0), 0);
+    EXPECT_EQ(pointGrid.Verify(), true);
+    pointGrid.SetCompactStorage(true);
+    EXPECT_THROW(pointGrid.AddPoint(kernel.GetPoint(0), 0), Base::RuntimeError);
+    EXPECT_EQ(pointGrid.Verify(), true);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
 #include <Mod/Mesh/App/MeshFeature.h>
+#include <Mod/Mesh/App/MeshProperties.h>
 
 class MeshFeatureTest: public ::testing::Test
 {
@@ -37,4 +38,38 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+TEST_F(MeshFeatureTest, copySharesMeshUntilModified)
+{
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    Mesh::PropertyMeshKernel prop;
+    prop.setValue(kernel);
+    const Mesh::MeshObject* mesh = prop.getValuePtr();
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto& copied = static_cast<Mesh::PropertyMeshKernel&>(*copy);
+    EXPECT_EQ(copied.getValuePtr(), mesh);
+
+    // the property keeps its mesh object, the copy keeps the old content
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1, 0, 0));
+    prop.transformGeometry(mat);
+    EXPECT_EQ(prop.getValuePtr(), mesh);
+    EXPECT_NE(copied.getValuePtr(), mesh);
+    EXPECT_FLOAT_EQ(prop.getValue().getKernel().GetPoint(0).x, 1.0F);
+    EXPECT_FLOAT_EQ(copied.getValue().getKernel().GetPoint(0).x, 0.0F);
+
+    std::unique_ptr<App::Property> copy2(prop.Copy());
+    MeshCore::MeshKernel empty;
+    prop.swapMesh(empty);
+    EXPECT_EQ(prop.getValue().countFacets(), 0);
+    EXPECT_EQ(static_cast<Mesh::PropertyMeshKernel&>(*copy2).getValue().countFacets(), 1);
+
+    prop.Paste(copied);
+    EXPECT_EQ(prop.getValuePtr(), mesh);
+    EXPECT_EQ(prop.getValue().countFacets(), 1);
+    EXPECT_FLOAT_EQ(prop.getValue().getKernel().GetPoint(0).x, 0.0F);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -108,6 +108,24 @@ TEST_F(AttacherTest, TestCalculateAttachedPlacement)
     EXPECT_EQ(placement.getPosition().z, 0);
 }
 
+TEST_F(AttacherTest, TestCalculateAttachedPlacementFollowsSupport)
+{
+    auto& attacher = _boxes[1]->attacher();
+    const Base::Placement orig;
+    auto first = attacher.calculateAttachedPlacement(orig);
+    // Unchanged support and parameters give the same result again
+    EXPECT_EQ(attacher.calculateAttachedPlacement(orig), first);
+
+    _boxes[0]->Placement.setValue(Base::Placement(Base::Vector3d(1, 2, 3), Base::Rotation()));
+    _boxes[0]->recomputeFeature();
+    auto moved = attacher.calculateAttachedPlacement(orig);
+    EXPECT_EQ(moved.getPosition(), Base::Vector3d(1, 2, 3));
+
+    attacher.attachmentOffset = Base::Placement(Base::Vector3d(0, 0, 1), Base::Rotation());
+    auto offset = attacher.calculateAttachedPlacement(orig);
+    EXPECT_EQ(offset.getPosition(), Base::Vector3d(1, 2, 4));
+}
+
 TEST_F(AttacherTest, TestAllStringModesValid)
 {
     // Arrange
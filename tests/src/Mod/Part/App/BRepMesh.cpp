@@ -173,4 +173,18 @@ TEST_F(BRepMeshTest, testUnconnectedDomains)
     EXPECT_EQ(points.size(), 6);
     EXPECT_EQ(faces.size(), 4);
 }
+
+TEST_F(BRepMeshTest, testSegmentOffsets)
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(getConnectedDomains(), points, faces);
+
+    std::vector<std::size_t> offsets {0, 2, 4};
+    EXPECT_EQ(brepMesh.getSegmentOffsets(), offsets);
+    auto segments = brepMesh.createSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[1], Part::BRepMesh::Segment({2, 3}));
+}
 // NOLINTEND
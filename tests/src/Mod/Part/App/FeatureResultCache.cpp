@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <App/Application.h>
+#include "Mod/Part/App/FeaturePartCut.h"
+#include "Mod/Part/App/FeatureResultCache.h"
+#include <src/App/InitApplication.h>
+
+#include "PartTestHelpers.h"
+
+class FeatureResultCacheTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        getParameter()->SetBool("FeatureResultCache", true);
+        Part::FeatureResultCache::instance().clear();
+        createTestDoc();
+        _cut = _doc->addObject<Part::Cut>();
+    }
+
+    void TearDown() override
+    {
+        getParameter()->RemoveBool("FeatureResultCache");
+        Part::FeatureResultCache::instance().clear();
+    }
+
+    static ParameterGrp::handle getParameter()
+    {
+        return App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General");
+    }
+
+    Part::Cut* _cut = nullptr;  // NOLINT Can't be private in a test framework
+};
+
+TEST_F(FeatureResultCacheTest, testRestoreResult)
+{
+    // Arrange
+    auto& cache = Part::FeatureResultCache::instance();
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape first = _cut->Shape.getValue();
+    EXPECT_EQ(cache.size(), 1);
+
+    // Act
+    _cut->Tool.setValue(_boxes[2]);
+    _doc->recompute();
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(_cut->Shape.getValue().IsSame(first));
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(_cut->Shape.getValue().IsSame(first));
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(_cut->Shape.getValue()), 3.0);
+}
+
+TEST_F(FeatureResultCacheTest, testChangedInput)
+{
+    // Arrange
+    auto& cache = Part::FeatureResultCache::instance();
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape first = _cut->Shape.getValue();
+
+    // Act
+    _boxes[1]->Placement.setValue(Base::Placement(Base::Vector3d(0, 0, 10), Base::Rotation()));
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(_cut->Shape.getValue().IsSame(first));
+}
+
+TEST_F(FeatureResultCacheTest, testMemoryBudget)
+{
+    // Arrange
+    auto& cache = Part::FeatureResultCache::instance();
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    EXPECT_GT(cache.memSize(), 0);
+
+    // Act
+    cache.setMemoryBudget(0);
+
+    // Assert
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.memSize(), 0);
+    cache.setMemoryBudget(std::size_t(256) * 1024 * 1024);
+}
+
+TEST_F(FeatureResultCacheTest, testRemoveObject)
+{
+    // Arrange
+    auto& cache = Part::FeatureResultCache::instance();
+    _cut->Base.setValue(_boxes[0]);
+    _cut->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    EXPECT_EQ(cache.size(), 1);
+
+    // Act
+    _doc->removeObject(_cut->getNameInDocument());
+
+    // Assert
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <App/Application.h>
+#include "Mod/Part/App/ShapeCache.h"
+#include <src/App/InitApplication.h>
+
+#include "PartTestHelpers.h"
+
+class ShapeCacheTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        Part::ShapeCache::instance().clear();
+        Part::ShapeCache::instance().resetStatistics();
+        createTestDoc();
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        Part::ShapeCache::instance().clear();
+        Part::ShapeCache::instance().setMemoryBudget(std::size_t(512) * 1024 * 1024);
+    }
+};
+
+TEST_F(ShapeCacheTest, testHitAndMiss)
+{
+    // Arrange
+    auto& cache = Part::ShapeCache::instance();
+    Part::TopoShape shape;
+
+    // Act
+    bool before = cache.getShape(_boxes[0], "", shape);
+    cache.setShape(_boxes[0], "", _boxes[0]->Shape.getShape());
+    bool after = cache.getShape(_boxes[0], "", shape);
+
+    // Assert
+    EXPECT_FALSE(before);
+    EXPECT_TRUE(after);
+    EXPECT_TRUE(shape.getShape().IsSame(_boxes[0]->Shape.getValue()));
+    auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_GT(stats.memSize, 0);
+}
+
+TEST_F(ShapeCacheTest, testChangedSource)
+{
+    // Arrange
+    auto& cache = Part::ShapeCache::instance();
+    cache.setShape(_boxes[0], "Link.", _boxes[1]->Shape.getShape(), _boxes[1]);
+    Part::TopoShape shape;
+
+    // Act
+    _boxes[1]->Length.setValue(2.0);
+    _doc->recompute();
+
+    // Assert
+    EXPECT_FALSE(cache.getShape(_boxes[0], "Link.", shape));
+    auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.outdated, 1);
+    EXPECT_EQ(stats.entries, 0);
+}
+
+TEST_F(ShapeCacheTest, testMemoryBudget)
+{
+    // Arrange
+    auto& cache = Part::ShapeCache::instance();
+    cache.setShape(_boxes[0], "", _boxes[0]->Shape.getShape());
+    cache.setShape(_boxes[1], "", _boxes[1]->Shape.getShape());
+    auto memSize = cache.getStatistics().memSize;
+    Part::TopoShape shape;
+
+    // Act
+    cache.setMemoryBudget(memSize - 1);
+
+    // Assert
+    auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_FALSE(cache.getShape(_boxes[0], "", shape));
+    EXPECT_TRUE(cache.getShape(_boxes[1], "", shape));
+}
+
+TEST_F(ShapeCacheTest, testRemoveObject)
+{
+    // Arrange
+    auto& cache = Part::ShapeCache::instance();
+    cache.setShape(_boxes[0], "", _boxes[0]->Shape.getShape());
+    cache.setShape(_boxes[0], "Face1", _boxes[0]->Shape.getShape());
+
+    // Act
+    _doc->removeObject(_boxes[0]->getNameInDocument());
+
+    // Assert
+    EXPECT_EQ(cache.getStatistics().entries, 0);
+}
+
+TEST_F(ShapeCacheTest, testCloseDocument)
+{
+    // Arrange
+    auto& cache = Part::ShapeCache::instance();
+    cache.setShape(_boxes[0], "", _boxes[0]->Shape.getShape());
+    cache.setShape(_boxes[0], "Link.", _boxes[1]->Shape.getShape(), _boxes[1]);
+
+    // Act
+    App::GetApplication().closeDocument(_docName.c_str());
+
+    // Assert
+    EXPECT_EQ(cache.getStatistics().entries, 0);
+}
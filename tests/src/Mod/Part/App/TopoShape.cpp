@@ -5,6 +5,11 @@
 #include <Mod/Part/App/TopoShape.h>
 #include "src/App/InitApplication.h"
 
+#include <sstream>
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+
 
 class TopoShapeTest: public ::testing::Test
 {
@@ -136,4 +141,35 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestBinaryTriangulation)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    BRepMesh_IncrementalMesh(box, 0.1);
+    Part::TopoShape shape(box);
+    auto hasTriangulation = [](const TopoDS_Shape& shape) {
+        TopLoc_Location loc;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Act
+    std::stringstream plain;
+    shape.exportBinary(plain);
+    std::stringstream meshed;
+    shape.exportBinary(meshed, true);
+    Part::TopoShape withoutMesh;
+    withoutMesh.importBinary(plain);
+    Part::TopoShape withMesh;
+    withMesh.importBinary(meshed);
+    // Assert
+    EXPECT_GT(meshed.str().size(), plain.str().size());
+    EXPECT_FALSE(hasTriangulation(withoutMesh.getShape()));
+    EXPECT_TRUE(hasTriangulation(withMesh.getShape()));
+    EXPECT_EQ(withMesh.countSubShapes(TopAbs_FACE), 6UL);
+}
+
 // clang-format on
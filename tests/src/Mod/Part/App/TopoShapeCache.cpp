@@ -12,6 +12,8 @@
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <TopoDS_Edge.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
 
@@ -281,4 +283,75 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, FindShapesInBox)
+{
+    // Arrange
+    const auto [shape, ancestors] = CreateFusedCubes();
+    Part::TopoShapeCache cache(shape);
+    Bnd_Box box;
+    box.Update(1.5, -0.5, 0.25, 1.75, 1.5, 0.75);  // crosses the second cube along y
+
+    // Act
+    auto solids = cache.findShapesInBox(shape, TopAbs_SOLID, box);
+    auto faces = cache.findShapesInBox(shape, TopAbs_FACE, box);
+
+    // Assert
+    EXPECT_EQ(solids.size(), 1);
+    EXPECT_EQ(faces.size(), 2);
+    EXPECT_TRUE(std::is_sorted(faces.begin(), faces.end()));
+}
+
+TEST_F(TopoShapeCacheTest, FindShapesOnRay)
+{
+    // Arrange
+    const auto [shape, ancestors] = CreateFusedCubes();
+    Part::TopoShapeCache cache(shape);
+
+    // Act
+    auto solids = cache.findShapesOnRay(shape, TopAbs_SOLID, gp_Pnt(-1, 0.5, 0.5), gp_Dir(1, 0, 0));
+    auto missed = cache.findShapesOnRay(shape, TopAbs_SOLID, gp_Pnt(-1, 0.5, 0.5), gp_Dir(-1, 0, 0));
+
+    // Assert
+    EXPECT_EQ(solids.size(), 2);
+    EXPECT_TRUE(missed.empty());
+}
+
+TEST_F(TopoShapeCacheTest, FindNearestShapes)
+{
+    // Arrange
+    const auto [shape, ancestors] = CreateFusedCubes();
+    Part::TopoShapeCache cache(shape);
+    gp_Pnt pnt(3.0, 0.5, 0.5);
+
+    // Act
+    auto vertexes = cache.findNearestShapes(shape, TopAbs_VERTEX, pnt, 4);
+
+    // Assert - the four corners at x = 2 come first
+    ASSERT_EQ(vertexes.size(), 4);
+    for (int index : vertexes) {
+        auto vertex = TopoDS::Vertex(cache.findShape(shape, TopAbs_VERTEX, index));
+        EXPECT_NEAR(BRep_Tool::Pnt(vertex).X(), 2.0, 1e-6);
+    }
+}
+
+TEST_F(TopoShapeCacheTest, FindShapesOfMovedShape)
+{
+    // Arrange - the cache is shared with a shape that is moved along the x-axis
+    auto shape = std::get<0>(CreateFusedCubes());
+    gp_Trsf transform;
+    transform.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    auto moved = shape.Moved(TopLoc_Location(transform));
+    Part::TopoShapeCache cache(moved);
+    Bnd_Box box;
+    box.Update(10.25, 0.25, 0.25, 10.5, 0.75, 0.75);
+
+    // Act
+    auto solids = cache.findShapesInBox(moved, TopAbs_SOLID, box);
+    auto original = cache.findShapesInBox(shape, TopAbs_SOLID, box);
+
+    // Assert
+    EXPECT_EQ(solids.size(), 1);
+    EXPECT_TRUE(original.empty());
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
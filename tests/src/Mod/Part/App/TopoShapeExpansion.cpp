@@ -9,6 +9,7 @@
 #include "PartTestHelpers.h"
 
 #include <boost/core/ignore_unused.hpp>
+#include <BRep_Tool.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -28,6 +29,7 @@
 #include <ShapeFix_Wireframe.hxx>
 #include <ShapeBuild_ReShape.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -3280,4 +3282,48 @@ TEST_F(TopoShapeExpansionTest, makeElementOffset2D)
                               }));
 }
 
+TEST_F(TopoShapeExpansionTest, getMassProperties)
+{
+    // Arrange
+    TopoShape box {BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 1L};
+    TopoShape moved {box};
+    moved.setPlacement(Base::Placement(Base::Vector3d(10.0, 0.0, 0.0), Base::Rotation()));
+    TopoShape face = box.getSubTopoShape(TopAbs_FACE, 1);
+    // Act
+    auto props = TopoShape::getMassProperties({box, moved, face, TopoShape()});
+    auto adaptive = box.getMassProperties(1e-6);
+    auto triangulated = box.getMassProperties(0.0, true);
+    // Assert
+    ASSERT_EQ(props.size(), 4);
+    EXPECT_EQ(props[0].dimension, 3);
+    EXPECT_NEAR(props[0].mass, 6.0, 1e-9);
+    EXPECT_TRUE(props[0].centerOfMass.IsEqual(Base::Vector3d(0.5, 1.0, 1.5), 1e-9));
+    // Ixx of a box about its center is m * (b^2 + c^2) / 12
+    EXPECT_NEAR(props[0].matrixOfInertia[0][0], 6.0 * (4.0 + 9.0) / 12.0, 1e-9);
+    EXPECT_LT(props[0].error, 0.0);
+    EXPECT_NEAR(props[1].mass, 6.0, 1e-9);
+    EXPECT_TRUE(props[1].centerOfMass.IsEqual(Base::Vector3d(10.5, 1.0, 1.5), 1e-9));
+    EXPECT_NEAR(props[1].matrixOfInertia[0][0], props[0].matrixOfInertia[0][0], 1e-9);
+    EXPECT_EQ(props[2].dimension, 2);
+    EXPECT_NEAR(props[2].mass, 6.0, 1e-9);
+    EXPECT_EQ(props[3].dimension, 0);
+    EXPECT_NEAR(adaptive.mass, 6.0, 1e-6);
+    EXPECT_GE(adaptive.error, 0.0);
+    EXPECT_NEAR(triangulated.mass, 6.0, 1e-6);
+}
+
+TEST_F(TopoShapeExpansionTest, getMassPropertiesKeepsTriangulation)
+{
+    // Arrange
+    TopoShape box {BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 1L};
+    TopLoc_Location loc;
+    // Act
+    auto triangulated = box.getMassProperties(0.0, true);
+    // Assert: the triangulation is made for a copy, the faces of the shape are not meshed
+    EXPECT_NEAR(triangulated.mass, 6.0, 1e-6);
+    for (TopExp_Explorer xp(box.getShape(), TopAbs_FACE); xp.More(); xp.Next()) {
+        EXPECT_TRUE(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull());
+    }
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
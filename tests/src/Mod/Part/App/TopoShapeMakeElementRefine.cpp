@@ -53,3 +53,28 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineWithRefinedBase)
+{
+    // Arrange
+    auto _doc = App::GetApplication().getActiveDocument();
+    auto _fuse = _doc->addObject<Part::Fuse>();
+    _fuse->Base.setValue(_boxes[0]);
+    _fuse->Tool.setValue(_boxes[3]);
+    _fuse->execute();
+    Part::TopoShape ts = _fuse->Shape.getShape();
+    // Act
+    // The faces of the first box are unchanged except the one touching the second box, so
+    // only the faces around it are checked, which are still enough to unite into one box
+    Part::TopoShape refined = ts.makeElementRefine(nullptr,
+                                                   Part::RefineFail::throwException,
+                                                   _boxes[0]->Shape.getValue());
+    // Everything is in the refined base, nothing is done
+    Part::TopoShape unchanged =
+        ts.makeElementRefine(nullptr, Part::RefineFail::throwException, ts.getShape());
+    // Assert
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(refined.getShape()), 12.0);
+    EXPECT_EQ(refined.countSubElements("Face"), 6);
+    EXPECT_EQ(refined.countSubElements("Edge"), 12);
+    EXPECT_EQ(unchanged.countSubElements("Face"), 10);
+}
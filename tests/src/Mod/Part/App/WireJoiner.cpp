@@ -382,6 +382,35 @@ TEST_F(WireJoinerTest, setSplitEdges)
     EXPECT_EQ(wireSplitEdges.getSubTopoShapes(TopAbs_EDGE).size(), 4);
 }
 
+TEST_F(WireJoinerTest, setSplitEdgesManyEdges)
+{
+    // Arrange
+
+    // Many horizontal edges crossed by a single vertical one, so that the intersections are
+    // computed in more than one block and no closed wire can be built
+    const int count = 600;
+    std::vector<TopoDS_Shape> edges;
+    for (int i = 0; i < count; ++i) {
+        edges.push_back(BRepBuilderAPI_MakeEdge(gp_Pnt(-1.0, i, 0.0), gp_Pnt(1.0, i, 0.0)).Edge());
+    }
+    edges.push_back(BRepBuilderAPI_MakeEdge(gp_Pnt(0.0, -1.0, 0.0), gp_Pnt(0.0, count, 0.0)).Edge());
+
+    auto wjSplitEdges {WireJoiner()};
+    wjSplitEdges.setTightBound(false);
+    auto wireSplitEdges {TopoShape(1)};
+
+    // Act
+    wjSplitEdges.addShape(edges);
+    wjSplitEdges.setSplitEdges();
+    wjSplitEdges.Build();
+    wjSplitEdges.getOpenWires(wireSplitEdges, nullptr, false);
+
+    // Assert
+
+    // Every horizontal edge is split once, the vertical edge at every crossing
+    EXPECT_EQ(wireSplitEdges.getSubTopoShapes(TopAbs_EDGE).size(), 2 * count + count + 1);
+}
+
 TEST_F(WireJoinerTest, setMergeEdges)
 {
     // Arrange
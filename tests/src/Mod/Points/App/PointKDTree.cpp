@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <Mod/Points/App/PointKDTree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointKDTreeTest: public ::testing::Test
+{
+protected:
+    static std::vector<Base::Vector3f> createPoints(int count)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+        return points;
+    }
+
+    // squared distances of the k nearest points by brute force
+    static std::vector<float>
+    nearestDistances(const std::vector<Base::Vector3f>& points, const Base::Vector3f& pnt, int k)
+    {
+        std::vector<float> dists;
+        for (const auto& it : points) {
+            if (std::isfinite(it.x)) {
+                dists.push_back(Base::DistanceP2(it, pnt));
+            }
+        }
+        std::sort(dists.begin(), dists.end());
+        dists.resize(std::min<std::size_t>(k, dists.size()));
+        return dists;
+    }
+};
+
+TEST_F(PointKDTreeTest, TestNearest)
+{
+    std::vector<Base::Vector3f> points = createPoints(5000);
+    Points::PointKDTree tree(points);
+    EXPECT_EQ(tree.size(), points.size());
+
+    std::vector<Points::PointKDTree::Neighbour> result;
+    for (const auto& pnt : createPoints(100)) {
+        tree.findNearest(pnt, 10, result);
+        std::vector<float> expected = nearestDistances(points, pnt, 10);
+        ASSERT_EQ(result.size(), expected.size());
+        for (std::size_t i = 0; i < result.size(); i++) {
+            EXPECT_FLOAT_EQ(result[i].second, expected[i]);
+            EXPECT_FLOAT_EQ(Base::DistanceP2(points[result[i].first], pnt), result[i].second);
+        }
+
+        float dist {};
+        std::size_t index = tree.findNearest(pnt, dist);
+        ASSERT_LT(index, points.size());
+        EXPECT_FLOAT_EQ(dist * dist, expected.front());
+    }
+}
+
+TEST_F(PointKDTreeTest, TestInvalidPoints)
+{
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<Base::Vector3f> points = createPoints(100);
+    points[10].Set(nan, nan, nan);
+    Points::PointKDTree tree(points);
+    EXPECT_EQ(tree.size(), 99);
+
+    std::vector<Points::PointKDTree::Neighbour> result;
+    tree.findNearest(Base::Vector3f(), 200, result);
+    EXPECT_EQ(result.size(), 99);
+    for (const auto& it : result) {
+        EXPECT_NE(it.first, 10);
+    }
+
+    Points::PointKDTree empty({});
+    float dist {};
+    EXPECT_EQ(empty.findNearest(Base::Vector3f(), dist), Points::PointKDTree::NoPoint);
+}
+
+TEST_F(PointKDTreeTest, TestNeighbourhoods)
+{
+    std::vector<Base::Vector3f> points = createPoints(20000);
+    Points::PointKDTree tree(points);
+
+    std::vector<std::atomic<int>> calls(points.size());
+    std::atomic<int> mismatches {0};
+    tree.forEachNeighbourhood(8, [&](std::size_t index, const auto& neighbours) {
+        calls[index]++;
+        if (neighbours.size() != 8 || neighbours.front().first != index
+            || neighbours.front().second != 0.0F) {
+            mismatches++;
+        }
+    });
+    EXPECT_EQ(mismatches, 0);
+    for (const auto& it : calls) {
+        EXPECT_EQ(it, 1);
+    }
+}
+
+TEST_F(PointKDTreeTest, TestNormals)
+{
+    // noisy plane z = 0.5 * x + 2
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> noise(-0.001F, 0.001F);
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 100; j++) {
+            float x = float(i) * 0.01F;
+            float y = float(j) * 0.01F;
+            points.emplace_back(x, y, 0.5F * x + 2.0F + noise(gen));
+        }
+    }
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    points.emplace_back(nan, nan, nan);
+
+    Points::PointKDTree tree(points);
+    std::vector<Base::Vector3f> normals = tree.estimateNormals(10);
+    ASSERT_EQ(normals.size(), points.size());
+
+    Base::Vector3f expected = Base::Vector3f(0.5F, 0.0F, -1.0F).Normalize();
+    for (std::size_t i = 0; i + 1 < normals.size(); i++) {
+        EXPECT_NEAR(normals[i].Length(), 1.0F, 1e-4F);
+        // oriented towards the origin
+        EXPECT_GT(normals[i] * expected, 0.95F);
+    }
+    EXPECT_EQ(normals.back(), Base::Vector3f());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <Mod/Points/App/PointOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointOctreeTest: public ::testing::Test
+{
+protected:
+    // regular n x n x n grid of points in the unit cube
+    static std::vector<Base::Vector3f> createGrid(int n)
+    {
+        std::vector<Base::Vector3f> points;
+        float step = 1.0F / float(n - 1);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                for (int k = 0; k < n; k++) {
+                    points.emplace_back(float(i) * step, float(j) * step, float(k) * step);
+                }
+            }
+        }
+        return points;
+    }
+
+    static Points::PointOctree::Settings smallNodes()
+    {
+        Points::PointOctree::Settings settings;
+        settings.gridSize = 4;
+        settings.maxLeafSize = 100;
+        return settings;
+    }
+
+    static std::size_t countChunkPoints(const Points::PointOctree& octree)
+    {
+        std::size_t count = 0;
+        octree.forEachChunk([&count](const std::vector<Base::Vector3f>& points) {
+            count += points.size();
+        });
+        return count;
+    }
+};
+
+TEST_F(PointOctreeTest, TestAdd)
+{
+    Points::PointOctree octree(smallNodes());
+    octree.add(createGrid(20));
+    octree.add(Base::Vector3f(std::numeric_limits<float>::quiet_NaN(), 0, 0));
+
+    EXPECT_EQ(octree.size(), 8000);
+    EXPECT_GT(octree.countNodes(), 1);
+    EXPECT_EQ(countChunkPoints(octree), 8000);
+
+    Base::BoundBox3d box = octree.getBoundBox();
+    EXPECT_DOUBLE_EQ(box.MinX, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxX, 1.0);
+    EXPECT_DOUBLE_EQ(box.MinZ, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxZ, 1.0);
+}
+
+TEST_F(PointOctreeTest, TestGrowRoot)
+{
+    Points::PointOctree octree(smallNodes());
+    octree.add(createGrid(10));
+    octree.add(Base::Vector3f(-50, 10, 100));
+
+    EXPECT_EQ(octree.size(), 1001);
+    EXPECT_EQ(countChunkPoints(octree), 1001);
+    Base::BoundBox3d box = octree.getBoundBox();
+    EXPECT_DOUBLE_EQ(box.MinX, -50.0);
+    EXPECT_DOUBLE_EQ(box.MaxY, 10.0);
+    EXPECT_DOUBLE_EQ(box.MaxZ, 100.0);
+}
+
+TEST_F(PointOctreeTest, TestPaging)
+{
+    Points::PointOctree::Settings settings = smallNodes();
+    settings.memoryBudget = 1000;
+    Points::PointOctree octree(settings);
+    octree.add(createGrid(20));
+
+    EXPECT_EQ(octree.size(), 8000);
+    EXPECT_LE(octree.countResident(), 1000);
+    EXPECT_EQ(countChunkPoints(octree), 8000);
+    EXPECT_LE(octree.countResident(), 1000);
+
+    std::unique_ptr<Points::PointOctree> copy = octree.clone();
+    EXPECT_EQ(copy->size(), 8000);
+    EXPECT_EQ(countChunkPoints(*copy), 8000);
+    EXPECT_LE(copy->countResident(), 1000);
+}
+
+TEST_F(PointOctreeTest, TestLevelOfDetail)
+{
+    Points::PointOctree octree(smallNodes());
+    octree.add(createGrid(20));
+
+    std::vector<Base::Vector3f> lod = octree.getLevelOfDetail(500);
+    EXPECT_GT(lod.size(), 0);
+    EXPECT_LE(lod.size(), 500);
+
+    // the coarse levels cover the whole cloud
+    Base::BoundBox3f box(lod.data(), lod.size());
+    EXPECT_LT(box.MinX, 0.2F);
+    EXPECT_GT(box.MaxX, 0.8F);
+    EXPECT_LT(box.MinY, 0.2F);
+    EXPECT_GT(box.MaxY, 0.8F);
+
+    EXPECT_EQ(octree.getLevelOfDetail(10000).size(), 8000);
+}
+
+TEST_F(PointOctreeTest, TestTransformAndCrop)
+{
+    Points::PointOctree octree(smallNodes());
+    octree.add(createGrid(20));
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 0, 0));
+    octree.transform(mat);
+    Base::BoundBox3d box = octree.getBoundBox();
+    EXPECT_NEAR(box.MinX, 10.0, 1e-6);
+    EXPECT_NEAR(box.MaxX, 11.0, 1e-6);
+
+    // keep the half with x <= 10.5
+    std::size_t removed = octree.crop(Base::BoundBox3d(9, -1, -1, 10.5, 2, 2));
+    EXPECT_EQ(removed, 4000);
+    EXPECT_EQ(octree.size(), 4000);
+    EXPECT_EQ(countChunkPoints(octree), 4000);
+    box = octree.getBoundBox();
+    EXPECT_LE(box.MaxX, 10.5);
+}
+
+TEST_F(PointOctreeTest, TestNodes)
+{
+    Points::PointOctree octree(smallNodes());
+    EXPECT_EQ(octree.getRootNode(), Points::PointOctree::NoNode);
+    octree.add(createGrid(20));
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 0, 0));
+    octree.transform(mat);
+
+    // walk the tree from the root, every point is inside the cube of its node
+    std::size_t count = 0;
+    std::size_t visited = 0;
+    std::vector<std::uint32_t> stack {octree.getRootNode()};
+    while (!stack.empty()) {
+        std::uint32_t index = stack.back();
+        stack.pop_back();
+        visited++;
+        Base::BoundBox3d box = octree.getNodeBox(index);
+        std::vector<Base::Vector3f> points = octree.getNodePoints(index);
+        EXPECT_EQ(points.size(), octree.countNodePoints(index));
+        for (const auto& pnt : points) {
+            EXPECT_TRUE(box.IsInBox(Base::Vector3d(pnt.x, pnt.y, pnt.z)));
+        }
+        count += points.size();
+        for (std::uint32_t child : octree.getChildNodes(index)) {
+            if (child != Points::PointOctree::NoNode) {
+                EXPECT_TRUE(box.IsInBox(octree.getNodeBox(child).GetCenter()));
+                stack.push_back(child);
+            }
+        }
+    }
+    EXPECT_EQ(visited, octree.countNodes());
+    EXPECT_EQ(count, 8000);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <sstream>
 #include <Base/FileInfo.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
 
@@ -119,6 +122,86 @@ TEST_F(PointsTest, TestSwap)
     EXPECT_EQ(kernel.countValid(), 20);
 }
 
+TEST_F(PointsTest, TestPaged)
+{
+    Points::PointKernel kernel(getKernel());
+    kernel.setPaged(Points::PointOctree::Settings());
+    EXPECT_TRUE(kernel.isPaged());
+    EXPECT_EQ(kernel.size(), 8);
+    EXPECT_EQ(kernel.countValid(), 8);
+    kernel.push_back(Base::Vector3d(2, 2, 2));
+    EXPECT_EQ(kernel.size(), 9);
+
+    Base::BoundBox3d box = kernel.getBoundBox();
+    EXPECT_DOUBLE_EQ(box.MaxX, 2.0);
+    EXPECT_DOUBLE_EQ(box.MinY, 0.0);
+
+    // copies share the octree until one of them is changed
+    Points::PointKernel copy(kernel);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(0, 0, 10));
+    copy.transformGeometry(mat);
+    EXPECT_DOUBLE_EQ(copy.getBoundBox().MinZ, 10.0);
+    EXPECT_DOUBLE_EQ(kernel.getBoundBox().MinZ, 0.0);
+
+    EXPECT_EQ(kernel.crop(Base::BoundBox3d(-1, -1, -1, 1.5, 1.5, 1.5)), 1);
+    EXPECT_EQ(kernel.size(), 8);
+    EXPECT_EQ(copy.size(), 9);
+    EXPECT_TRUE(kernel.isPaged());
+
+    // non-const access switches back to a plain array
+    EXPECT_EQ(kernel.getBasicPoints().size(), 8);
+    EXPECT_FALSE(kernel.isPaged());
+    EXPECT_EQ(kernel.size(), 8);
+}
+
+TEST_F(PointsTest, TestLevelOfDetail)
+{
+    Points::PointKernel kernel(getKernel());
+    EXPECT_EQ(kernel.getLevelOfDetail(10).size(), 8);
+    EXPECT_EQ(kernel.getLevelOfDetail(4).size(), 4);
+    kernel.setPaged(Points::PointOctree::Settings());
+    EXPECT_EQ(kernel.getLevelOfDetail(10).size(), 8);
+    EXPECT_TRUE(kernel.getLevelOfDetail(4).empty());
+}
+
+TEST_F(PointsTest, TestDocFile)
+{
+    for (bool raw : {false, true}) {
+        Base::StringWriter writer;
+        if (raw) {
+            writer.setMode("RawKernel");
+        }
+        getKernel().SaveDocFile(writer);
+        std::string data = writer.getString();
+        EXPECT_EQ(data.size(), raw ? 64 + 8 * 12 : 4 + 8 * 12);
+
+        std::istringstream str(data);
+        Base::Reader reader(str, "Points", 1);
+        Points::PointKernel kernel;
+        kernel.RestoreDocFile(reader);
+        EXPECT_EQ(kernel.getBasicPoints(), getKernel().getBasicPoints());
+    }
+}
+
+TEST_F(PointsTest, TestPagedRawDocFile)
+{
+    Points::PointKernel paged(getKernel());
+    paged.setPaged(Points::PointOctree::Settings());
+    Base::StringWriter writer;
+    writer.setMode("RawKernel");
+    paged.SaveDocFile(writer);
+
+    std::istringstream str(writer.getString());
+    Base::Reader reader(str, "Points", 1);
+    Points::PointKernel kernel;
+    kernel.RestoreDocFile(reader);
+    EXPECT_EQ(kernel.size(), 8);
+    Base::BoundBox3d box = kernel.getBoundBox();
+    EXPECT_DOUBLE_EQ(box.MinX, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxZ, 1.0);
+}
+
 TEST_F(PointsTest, TestASCII)
 {
     std::string name = getFileName() + ".asc";
@@ -138,6 +221,24 @@ TEST_F(PointsTest, TestASCII)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestPagedASCII)
+{
+    std::string name = getFileName() + ".asc";
+    Points::AscWriter writer(getKernel());
+    writer.write(name);
+
+    Points::AscReader reader;
+    reader.setOutOfCoreThreshold(4);
+    reader.read(name);
+
+    EXPECT_TRUE(reader.getPoints().isPaged());
+    EXPECT_EQ(reader.getPoints().size(), 8);
+    EXPECT_EQ(reader.getWidth(), 8);
+    Base::BoundBox3d box = reader.getPoints().getBoundBox();
+    EXPECT_DOUBLE_EQ(box.MinX, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxZ, 1.0);
+}
+
 TEST_F(PointsTest, TestPlainPLY)
 {
     std::string name = getFileName();
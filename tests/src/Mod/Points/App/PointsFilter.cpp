@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include <tuple>
+#include <Base/Exception.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsFilter.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsFilterTest: public ::testing::Test
+{
+protected:
+    static std::vector<Base::Vector3f> createPoints(int count)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < count; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+        return points;
+    }
+
+    static std::tuple<int, int, int> voxelOf(const Base::Vector3f& pnt, float size)
+    {
+        return {int(std::floor(pnt.x / size)),
+                int(std::floor(pnt.y / size)),
+                int(std::floor(pnt.z / size))};
+    }
+
+    // passes the points in chunks of different sizes
+    static void addChunks(Points::PointsFilter& filter, const std::vector<Base::Vector3f>& points)
+    {
+        std::size_t begin = 0;
+        std::size_t size = 100;
+        while (begin < points.size()) {
+            std::size_t end = std::min(points.size(), begin + size);
+            filter.addChunk(std::vector<Base::Vector3f>(points.begin() + begin, points.begin() + end));
+            begin = end;
+            size *= 3;
+        }
+    }
+};
+
+TEST_F(PointsFilterTest, TestVoxelGrid)
+{
+    std::vector<Base::Vector3f> points = createPoints(20000);
+    points[10].x = std::numeric_limits<float>::quiet_NaN();
+    const float size = 0.25F;
+
+    Points::VoxelGridFilter filter(size);
+    filter.addChunk(points);
+    std::vector<std::size_t> indices = filter.getIndices();
+    EXPECT_EQ(filter.countInput(), points.size());
+
+    std::set<std::tuple<int, int, int>> voxels;
+    for (const auto& pnt : points) {
+        if (std::isfinite(pnt.x)) {
+            voxels.insert(voxelOf(pnt, size));
+        }
+    }
+    ASSERT_EQ(indices.size(), voxels.size());
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+
+    // every kept point is the closest one to the center of its voxel
+    for (std::size_t index : indices) {
+        const Base::Vector3f& pnt = points[index];
+        auto voxel = voxelOf(pnt, size);
+        Base::Vector3f center((std::get<0>(voxel) + 0.5F) * size,
+                              (std::get<1>(voxel) + 0.5F) * size,
+                              (std::get<2>(voxel) + 0.5F) * size);
+        for (const auto& other : points) {
+            if (std::isfinite(other.x) && voxelOf(other, size) == voxel) {
+                EXPECT_LE(Base::DistanceP2(pnt, center), Base::DistanceP2(other, center) + 1e-6F);
+            }
+        }
+    }
+}
+
+TEST_F(PointsFilterTest, TestVoxelGridChunks)
+{
+    std::vector<Base::Vector3f> points = createPoints(50000);
+    Points::VoxelGridFilter whole(0.1);
+    whole.addChunk(points);
+    Points::VoxelGridFilter chunked(0.1);
+    addChunks(chunked, points);
+    EXPECT_EQ(whole.getIndices(), chunked.getIndices());
+}
+
+TEST_F(PointsFilterTest, TestRandom)
+{
+    std::vector<Base::Vector3f> points = createPoints(100000);
+    points[5].z = std::numeric_limits<float>::infinity();
+
+    Points::RandomFilter filter(0.2, 7);
+    addChunks(filter, points);
+    std::vector<std::size_t> indices = filter.getIndices();
+    EXPECT_NEAR(double(indices.size()) / points.size(), 0.2, 0.01);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_EQ(std::count(indices.begin(), indices.end(), 5), 0);
+
+    Points::RandomFilter same(0.2, 7);
+    same.addChunk(points);
+    EXPECT_EQ(same.getIndices(), indices);
+    Points::RandomFilter other(0.2, 8);
+    other.addChunk(points);
+    EXPECT_NE(other.getIndices(), indices);
+
+    Points::RandomFilter none(0.0);
+    none.addChunk(points);
+    EXPECT_TRUE(none.getIndices().empty());
+    Points::RandomFilter all(1.0);
+    all.addChunk(points);
+    EXPECT_EQ(all.getIndices().size(), points.size() - 1);
+}
+
+TEST_F(PointsFilterTest, TestPoissonDisk)
+{
+    std::vector<Base::Vector3f> points = createPoints(5000);
+    const float radius = 0.15F;
+
+    Points::PoissonDiskFilter filter(radius);
+    addChunks(filter, points);
+    auto result = filter.getResult();
+    ASSERT_FALSE(result.empty());
+    EXPECT_LT(result.size(), points.size());
+
+    std::vector<bool> kept(points.size(), false);
+    for (const auto& it : result) {
+        kept[it.first] = true;
+        EXPECT_EQ(it.second, points[it.first]);
+    }
+
+    // the kept points keep their distance and every other point is close to one of them
+    for (std::size_t i = 0; i < points.size(); i++) {
+        float nearest = std::numeric_limits<float>::max();
+        for (const auto& it : result) {
+            if (it.first != i) {
+                nearest = std::min(nearest, Base::Distance(points[i], it.second));
+            }
+        }
+        if (kept[i]) {
+            EXPECT_GE(nearest, radius);
+        }
+        else {
+            EXPECT_LT(nearest, radius);
+        }
+    }
+}
+
+TEST_F(PointsFilterTest, TestApply)
+{
+    std::vector<Base::Vector3f> points = createPoints(10000);
+    Points::PointKernel kernel;
+    kernel.swap(points);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1.0, 2.0, 3.0));
+    kernel.setTransform(mat);
+
+    Points::VoxelGridFilter filter(0.5);
+    Points::PointKernel output = filter.apply(kernel);
+    EXPECT_EQ(output.size(), 64);
+    EXPECT_EQ(output.getTransform(), mat);
+    std::vector<std::size_t> indices = filter.getIndices();
+    ASSERT_EQ(indices.size(), output.size());
+    for (std::size_t i = 0; i < indices.size(); i++) {
+        EXPECT_EQ(output.getBasicPoints()[i], kernel.getBasicPoints()[indices[i]]);
+    }
+}
+
+TEST_F(PointsFilterTest, TestInvalidArguments)
+{
+    EXPECT_THROW(Points::VoxelGridFilter(0.0), Base::ValueError);
+    EXPECT_THROW(Points::RandomFilter(1.5), Base::ValueError);
+    EXPECT_THROW(Points::PoissonDiskFilter(-1.0), Base::ValueError);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
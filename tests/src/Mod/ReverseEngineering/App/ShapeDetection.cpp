@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <Base/Vector3D.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/ReverseEngineering/App/ShapeDetection.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+constexpr int numPoints = 2000;
+constexpr double noise = 0.005;
+
+struct Cloud
+{
+    Points::PointKernel points;
+    std::vector<Base::Vector3d> normals;
+    std::mt19937 gen {42};
+
+    void add(const Base::Vector3d& pnt, const Base::Vector3d& normal)
+    {
+        // move the point along its normal by some noise
+        std::uniform_real_distribution<double> dist(-noise, noise);
+        points.push_back(pnt + normal * dist(gen));
+        normals.push_back(normal);
+    }
+
+    // a square patch of the plane n.p = d with a unit normal
+    void addPlane(const Base::Vector3d& normal, double distance)
+    {
+        Base::Vector3d u = normal % Base::Vector3d(1.0, 0.0, 0.0);
+        u.Normalize();
+        Base::Vector3d v = normal % u;
+        std::uniform_real_distribution<double> dist(-3.0, 3.0);
+        for (int i = 0; i < numPoints; i++) {
+            add(normal * distance + u * dist(gen) + v * dist(gen), normal);
+        }
+    }
+
+    void addSphere(const Base::Vector3d& center, double radius)
+    {
+        std::normal_distribution<double> dist;
+        for (int i = 0; i < numPoints; i++) {
+            Base::Vector3d dir(dist(gen), dist(gen), dist(gen));
+            dir.Normalize();
+            add(center + dir * radius, dir);
+        }
+    }
+
+    // a cylinder along the z axis with a height of 6
+    void addCylinder(const Base::Vector3d& base, double radius)
+    {
+        std::uniform_real_distribution<double> angle(0.0, 2.0 * std::numbers::pi);
+        std::uniform_real_distribution<double> height(0.0, 6.0);
+        for (int i = 0; i < numPoints; i++) {
+            double phi = angle(gen);
+            Base::Vector3d dir(std::cos(phi), std::sin(phi), 0.0);
+            add(base + dir * radius + Base::Vector3d(0.0, 0.0, height(gen)), dir);
+        }
+    }
+};
+
+Reen::ShapeDetection::Parameters parameters()
+{
+    Reen::ShapeDetection::Parameters params;
+    params.epsilon = 0.02;
+    params.minSupport = 200;
+    params.seed = 7;
+    return params;
+}
+}  // namespace
+
+TEST(ShapeDetection, detectPlane)
+{
+    // Arrange
+    Cloud cloud;
+    Base::Vector3d normal(1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0);
+    cloud.addPlane(normal, 1.0);
+
+    // Act
+    Reen::ShapeDetection detection(cloud.points, cloud.normals);
+    auto shapes = detection.perform(parameters());
+
+    // Assert
+    ASSERT_EQ(shapes.size(), 1);
+    const auto& shape = shapes.front();
+    EXPECT_EQ(shape.type, Reen::ShapeDetection::Plane);
+    EXPECT_GE(shape.points.size(), numPoints * 95 / 100);
+    ASSERT_EQ(shape.parameters.size(), 4);
+    Base::Vector3d found(shape.parameters[0], shape.parameters[1], shape.parameters[2]);
+    double sign = found * normal > 0.0 ? 1.0 : -1.0;
+    EXPECT_NEAR(sign * (found * normal), 1.0, 1e-4);
+    EXPECT_NEAR(sign * shape.parameters[3], -1.0, 0.01);
+}
+
+TEST(ShapeDetection, detectSphere)
+{
+    // Arrange
+    Cloud cloud;
+    cloud.addSphere(Base::Vector3d(1.0, 2.0, 3.0), 2.0);
+
+    // Act
+    Reen::ShapeDetection detection(cloud.points, cloud.normals);
+    auto shapes = detection.perform(parameters());
+
+    // Assert
+    ASSERT_EQ(shapes.size(), 1);
+    const auto& shape = shapes.front();
+    EXPECT_EQ(shape.type, Reen::ShapeDetection::Sphere);
+    EXPECT_GE(shape.points.size(), numPoints * 95 / 100);
+    ASSERT_EQ(shape.parameters.size(), 4);
+    EXPECT_NEAR(shape.parameters[0], 1.0, 0.01);
+    EXPECT_NEAR(shape.parameters[1], 2.0, 0.01);
+    EXPECT_NEAR(shape.parameters[2], 3.0, 0.01);
+    EXPECT_NEAR(shape.parameters[3], 2.0, 0.01);
+}
+
+TEST(ShapeDetection, detectCylinder)
+{
+    // Arrange
+    Cloud cloud;
+    cloud.addCylinder(Base::Vector3d(1.0, -1.0, 0.0), 1.5);
+
+    // Act
+    Reen::ShapeDetection detection(cloud.points, cloud.normals);
+    auto shapes = detection.perform(parameters());
+
+    // Assert
+    ASSERT_EQ(shapes.size(), 1);
+    const auto& shape = shapes.front();
+    EXPECT_EQ(shape.type, Reen::ShapeDetection::Cylinder);
+    EXPECT_GE(shape.points.size(), numPoints * 95 / 100);
+    ASSERT_EQ(shape.parameters.size(), 7);
+    // the point on the axis can be anywhere along it
+    EXPECT_NEAR(shape.parameters[0], 1.0, 0.01);
+    EXPECT_NEAR(shape.parameters[1], -1.0, 0.01);
+    EXPECT_NEAR(std::fabs(shape.parameters[5]), 1.0, 1e-4);
+    EXPECT_NEAR(shape.parameters[6], 1.5, 0.01);
+}
+
+TEST(ShapeDetection, sameResultForAnyNumberOfThreads)
+{
+    // Arrange
+    Cloud cloud;
+    cloud.addPlane(Base::Vector3d(0.0, 0.0, 1.0), -5.0);
+    cloud.addSphere(Base::Vector3d(10.0, 0.0, 0.0), 2.0);
+    cloud.addCylinder(Base::Vector3d(0.0, 10.0, 0.0), 1.5);
+    Reen::ShapeDetection detection(cloud.points, cloud.normals);
+    auto params = parameters();
+
+    // Act
+    params.threads = 1;
+    auto single = detection.perform(params);
+    params.threads = 4;
+    auto multiple = detection.perform(params);
+
+    // Assert
+    ASSERT_EQ(single.size(), 3);
+    ASSERT_EQ(single.size(), multiple.size());
+    for (std::size_t i = 0; i < single.size(); i++) {
+        EXPECT_EQ(single[i].type, multiple[i].type);
+        EXPECT_EQ(single[i].parameters, multiple[i].parameters);
+        EXPECT_EQ(single[i].points, multiple[i].points);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <FCConfig.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Part/App/PrimitiveFeature.h>
+#include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/SketchObject.h>
+#include "SketcherTestHelpers.h"
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class SketchObjectExternalTest: public SketchObjectTest
+{
+protected:
+    void SetUp() override
+    {
+        SketchObjectTest::SetUp();
+        _line = getObject()->getDocument()->addObject<Part::Line>();
+        _line->X2.setValue(10.0);
+        _line->recomputeFeature();
+        getObject()->addExternal(_line, "Edge1");
+        getObject()->resetExternalProjectionStats();
+    }
+
+    Part::Line* getLine()
+    {
+        return _line;
+    }
+
+    Base::Vector3d getProjectedEnd()
+    {
+        auto geo = getObject()->getGeometry(Sketcher::GeoEnum::RefExt);
+        auto line = dynamic_cast<const Part::GeomLineSegment*>(geo);
+        return line ? line->getEndPoint() : Base::Vector3d();
+    }
+
+private:
+    Part::Line* _line {};
+};
+
+TEST_F(SketchObjectExternalTest, unchangedReferenceIsReused)
+{
+    // Act
+    getObject()->rebuildExternalGeometry();
+
+    // Assert
+    auto stats = getObject()->getExternalProjectionStats();
+    EXPECT_EQ(stats.reused, 1);
+    EXPECT_EQ(stats.projected, 0);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_EQ(getProjectedEnd(), Base::Vector3d(10, 0, 0));
+}
+
+TEST_F(SketchObjectExternalTest, recomputedReferenceIsProjectedAgain)
+{
+    // Arrange
+    getLine()->Y2.setValue(5.0);
+    getLine()->recomputeFeature();
+
+    // Act
+    getObject()->rebuildExternalGeometry();
+
+    // Assert
+    auto stats = getObject()->getExternalProjectionStats();
+    EXPECT_EQ(stats.reused, 0);
+    EXPECT_EQ(stats.projected, 1);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_EQ(getProjectedEnd(), Base::Vector3d(10, 5, 0));
+}
+
+TEST_F(SketchObjectExternalTest, movedSketchProjectsAgain)
+{
+    // Arrange
+    getObject()->Placement.setValue(
+        Base::Placement(Base::Vector3d(1, 0, 2), Base::Rotation()));
+    getObject()->resetExternalProjectionStats();
+
+    // Act
+    getObject()->rebuildExternalGeometry();
+
+    // Assert
+    auto stats = getObject()->getExternalProjectionStats();
+    EXPECT_EQ(stats.reused, 0);
+    EXPECT_EQ(stats.projected, 1);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_EQ(getProjectedEnd(), Base::Vector3d(9, 0, 0));
+}
+
+TEST_F(SketchObjectExternalTest, removedReferenceIsDropped)
+{
+    // Arrange
+    ASSERT_EQ(getObject()->delExternal(0), 0);
+
+    // Act
+    getObject()->rebuildExternalGeometry();
+
+    // Assert
+    auto stats = getObject()->getExternalProjectionStats();
+    EXPECT_EQ(stats.reused, 0);
+    EXPECT_EQ(stats.projected, 0);
+    EXPECT_EQ(stats.entries, 0);
+    EXPECT_EQ(getObject()->getExternalGeometryCount(), 2);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
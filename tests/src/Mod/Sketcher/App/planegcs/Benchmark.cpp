@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Solver timings, see src/BenchmarkHelpers.h. Real sketches are timed if the environment
+// variable SKETCHER_BENCHMARK_FILES holds a list of project files separated by the path
+// separator.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Sketcher/App/Sketch.h>
+#include <Mod/Sketcher/App/SketchObject.h>
+#include <src/App/InitApplication.h>
+#include <src/BenchmarkHelpers.h>
+
+#include "Mod/Sketcher/App/planegcs/GCS.h"
+#include "SolverTestHelpers.h"
+
+namespace
+{
+
+struct BenchmarkCase
+{
+    const char* name;
+    // number of staircases and segments per staircase
+    int count;
+    int segments;
+    GCS::Algorithm algorithm;
+    bool sparse;
+};
+
+std::ostream& operator<<(std::ostream& str, const BenchmarkCase& value)
+{
+    return str << value.name;
+}
+
+}  // namespace
+
+class SolverBenchmark: public ::testing::TestWithParam<BenchmarkCase>
+{
+};
+
+TEST_P(SolverBenchmark, solve)  // NOLINT
+{
+    const BenchmarkCase& param = GetParam();
+    SolverTestHelpers::Staircases sketch(param.count, param.segments);
+    GCS::System system;
+    system.sparseSolverThreshold = param.sparse ? 0 : -1;
+    system.qrAlgorithm = GCS::EigenSparseQR;
+    sketch.addTo(system);
+    RecordProperty("constraints", sketch.constraintCount());
+    RecordProperty("parameters", sketch.parameterCount());
+
+    auto start = std::chrono::steady_clock::now();
+    system.diagnose(param.algorithm);
+    tests::record("diagnose", tests::elapsedMilliseconds(start));
+    EXPECT_EQ(system.dofsNumber(), 0);
+
+    start = std::chrono::steady_clock::now();
+    system.initSolution(param.algorithm);
+    int result = system.solve(true, param.algorithm);
+    system.applySolution();
+    tests::record("solve", tests::elapsedMilliseconds(start));
+
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_LT(sketch.maxError(), 1e-6);
+}
+
+// A chain of 2n+2 constraints is one large subsystem, n blocks of five segments give
+// many small subsystems. The dense solver is left out for the largest systems.
+INSTANTIATE_TEST_SUITE_P(
+    Staircases,
+    SolverBenchmark,
+    ::testing::Values(BenchmarkCase {"Chain100_DogLeg_Dense", 1, 49, GCS::DogLeg, false},
+                      BenchmarkCase {"Chain100_DogLeg_Sparse", 1, 49, GCS::DogLeg, true},
+                      BenchmarkCase {"Chain1000_DogLeg_Dense", 1, 499, GCS::DogLeg, false},
+                      BenchmarkCase {"Chain1000_DogLeg_Sparse", 1, 499, GCS::DogLeg, true},
+                      BenchmarkCase {"Chain1000_LM_Dense", 1, 499, GCS::LevenbergMarquardt, false},
+                      BenchmarkCase {"Chain1000_LM_Sparse", 1, 499, GCS::LevenbergMarquardt, true},
+                      BenchmarkCase {"Chain10000_DogLeg_Sparse", 1, 4999, GCS::DogLeg, true},
+                      BenchmarkCase {"Chain10000_LM_Sparse", 1, 4999, GCS::LevenbergMarquardt, true},
+                      BenchmarkCase {"Blocks1200_DogLeg", 100, 5, GCS::DogLeg, true},
+                      BenchmarkCase {"Blocks12000_DogLeg", 1000, 5, GCS::DogLeg, true}),
+    [](const ::testing::TestParamInfo<BenchmarkCase>& info) {
+        return std::string(info.param.name);
+    });
+
+TEST(SketchBenchmark, solveProjectFiles)  // NOLINT
+{
+    const char* files = std::getenv("SKETCHER_BENCHMARK_FILES");
+    if (!files) {
+        GTEST_SKIP() << "SKETCHER_BENCHMARK_FILES is not set";
+    }
+
+    tests::initApplication();
+#ifdef FC_OS_WIN32
+    const char separator = ';';
+#else
+    const char separator = ':';
+#endif
+    std::stringstream list(files);
+    std::string file;
+    while (std::getline(list, file, separator)) {
+        if (file.empty()) {
+            continue;
+        }
+        App::Document* doc = App::GetApplication().openDocument(file.c_str());
+        ASSERT_TRUE(doc) << file;
+        for (auto obj : doc->getObjectsOfType<Sketcher::SketchObject>()) {
+            std::string name = std::string(doc->getName()) + "." + obj->getNameInDocument();
+            Sketcher::Sketch sketch;
+
+            // setting up the sketch includes the diagnosis
+            auto start = std::chrono::steady_clock::now();
+            sketch.setUpSketch(obj->getCompleteGeometry(),
+                               obj->Constraints.getValues(),
+                               obj->getExternalGeometryCount());
+            tests::record(name + ".diagnose", tests::elapsedMilliseconds(start));
+
+            start = std::chrono::steady_clock::now();
+            EXPECT_EQ(sketch.solve(), 0) << name;
+            tests::record(name + ".solve", tests::elapsedMilliseconds(start));
+        }
+        App::GetApplication().closeDocument(doc->getName());
+    }
+}
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "Mod/Sketcher/App/planegcs/GCS.h"
+#include "SolverTestHelpers.h"
 
 class SystemTest: public GCS::System
 {
@@ -50,3 +51,117 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, incrementalSolveOnlySolvesMovedComponent)  // NOLINT
+{
+    // Arrange
+    double x1 {1.0}, y1 {1.0}, x2 {2.0}, y2 {2.0};
+    double fixedX {5.0}, targetX {3.0}, targetY {4.0};
+    GCS::Point p1;
+    p1.x = &x1;
+    p1.y = &y1;
+    GCS::Point p2;
+    p2.x = &x2;
+    p2.y = &y2;
+    GCS::Point target;
+    target.x = &targetX;
+    target.y = &targetY;
+    GCS::VEC_pD params {&x1, &y1, &x2, &y2};
+    System()->declareUnknowns(params);
+    System()->addConstraintCoordinateX(p1, &fixedX, 1);
+    System()->addConstraintP2PCoincident(p2, target, GCS::DefaultTemporaryConstraint);
+    System()->initSolution();
+    System()->setIncrementalSolve(true);
+
+    // Act
+    int first = System()->solve();
+    int solvedFirst = System()->solvedSubsystemsNumber();
+    targetX = 6.0;
+    int second = System()->solve();
+    int solvedSecond = System()->solvedSubsystemsNumber();
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(first, GCS::Success);
+    EXPECT_EQ(second, GCS::Success);
+    // x2 and y2 are decoupled, each one is moved by a temporary constraint
+    EXPECT_EQ(solvedFirst, 3);
+    EXPECT_EQ(solvedSecond, 2);
+    EXPECT_NEAR(x1, fixedX, 1e-8);
+    EXPECT_NEAR(x2, 6.0, 1e-8);
+    EXPECT_NEAR(y2, targetY, 1e-8);
+}
+
+TEST_F(GCSTest, diagnoseDecoupledRedundantAndConflictingConstraints)  // NOLINT
+{
+    // Arrange
+    SolverTestHelpers::Staircases sketch(4, 4);
+    sketch.addTo(*System());
+    double length {10.0}, otherLength {12.0};
+    int tag = sketch.constraintCount() + 1;
+    // staircases 0 and 2 get a redundant distance, staircase 3 a conflicting one
+    const int redundantTag0 = tag++;
+    System()->addConstraintP2PDistance(sketch.point(0, 1),
+                                       sketch.point(0, 2),
+                                       &length,
+                                       redundantTag0);
+    const int redundantTag2 = tag++;
+    System()->addConstraintP2PDistance(sketch.point(2, 3),
+                                       sketch.point(2, 4),
+                                       &length,
+                                       redundantTag2);
+    const int conflictingTag = tag++;
+    System()->addConstraintP2PDistance(sketch.point(3, 0),
+                                       sketch.point(3, 1),
+                                       &otherLength,
+                                       conflictingTag);
+
+    // Act
+    System()->diagnose();
+    GCS::VEC_I redundant, conflicting;
+    System()->getRedundant(redundant);
+    System()->getConflicting(conflicting);
+
+    // Assert
+    // the latest introduced constraint of an equivalent group is reported
+    EXPECT_EQ(redundant, (GCS::VEC_I {redundantTag0, redundantTag2}));
+    // the distance of the first segment of staircase 3 and the new distance are in conflict
+    EXPECT_EQ(conflicting, (GCS::VEC_I {3 * 10 + 4, conflictingTag}));
+}
+
+class GCSSparseSolverTest: public GCSTest, public ::testing::WithParamInterface<GCS::Algorithm>
+{
+};
+
+TEST_P(GCSSparseSolverTest, sparseSolverMatchesDenseSolver)  // NOLINT
+{
+    // Arrange
+    SolverTestHelpers::Staircases sketch(1, 60);
+    sketch.addTo(*System());
+    System()->initSolution();
+
+    // Act
+    System()->sparseSolverThreshold = -1;
+    int denseResult = System()->solve(true, GetParam());
+    System()->applySolution();
+    auto dense = sketch.values();
+    sketch.reset();
+    System()->initSolution();
+    System()->sparseSolverThreshold = 0;
+    int sparseResult = System()->solve(true, GetParam());
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(denseResult, GCS::Success);
+    EXPECT_EQ(sparseResult, GCS::Success);
+    EXPECT_LT(sketch.maxError(), 1e-6);
+    const auto& sparse = sketch.values();
+    ASSERT_EQ(dense.size(), sparse.size());
+    for (size_t i = 0; i < dense.size(); ++i) {
+        EXPECT_NEAR(dense[i], sparse[i], 1e-6);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GCSTest,
+                         GCSSparseSolverTest,
+                         ::testing::Values(GCS::DogLeg, GCS::LevenbergMarquardt));
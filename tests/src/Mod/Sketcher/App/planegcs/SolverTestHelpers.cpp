@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <cmath>
+
+#include "SolverTestHelpers.h"
+
+using namespace SolverTestHelpers;
+
+Staircases::Staircases(int count, int segments)
+    : count {count}
+    , segments {segments}
+{
+    const int pointCount = count * (segments + 1);
+    origins.resize(2 * count);
+    for (int i = 0; i < count; ++i) {
+        origins[2 * i] = 0.0;
+        origins[2 * i + 1] = 2.0 * length * i;
+    }
+    // the points refer to the coordinates, so the vector must not grow afterwards
+    coords.resize(2 * pointCount);
+    points.resize(pointCount);
+    for (int i = 0; i < pointCount; ++i) {
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+    }
+    reset();
+}
+
+void Staircases::reset()
+{
+    for (int i = 0; i < count; ++i) {
+        double x = origins[2 * i];
+        double y = origins[2 * i + 1];
+        for (int j = 0; j <= segments; ++j) {
+            GCS::Point& point = points[i * (segments + 1) + j];
+            *point.x = x + 0.1 * std::sin(j);
+            *point.y = y + 0.1 * std::cos(j);
+            if (j % 2 == 0) {
+                x += length;
+            }
+            else {
+                y += length;
+            }
+        }
+    }
+}
+
+void Staircases::addTo(GCS::System& system)
+{
+    GCS::VEC_pD params;
+    params.reserve(coords.size());
+    for (double& coord : coords) {
+        params.push_back(&coord);
+    }
+    system.declareUnknowns(params);
+
+    int tag = 1;
+    for (int i = 0; i < count; ++i) {
+        GCS::Point* stair = &points[i * (segments + 1)];
+        system.addConstraintCoordinateX(stair[0], &origins[2 * i], tag++);
+        system.addConstraintCoordinateY(stair[0], &origins[2 * i + 1], tag++);
+        for (int j = 0; j < segments; ++j) {
+            if (j % 2 == 0) {
+                system.addConstraintHorizontal(stair[j], stair[j + 1], tag++);
+            }
+            else {
+                system.addConstraintVertical(stair[j], stair[j + 1], tag++);
+            }
+            system.addConstraintP2PDistance(stair[j], stair[j + 1], &length, tag++);
+        }
+    }
+}
+
+int Staircases::constraintCount() const
+{
+    return count * (2 + 2 * segments);
+}
+
+int Staircases::parameterCount() const
+{
+    return int(coords.size());
+}
+
+double Staircases::maxError() const
+{
+    double error = 0.0;
+    for (int i = 0; i < count; ++i) {
+        double x = origins[2 * i];
+        double y = origins[2 * i + 1];
+        for (int j = 0; j <= segments; ++j) {
+            const GCS::Point& point = points[i * (segments + 1) + j];
+            error = std::max({error, std::abs(*point.x - x), std::abs(*point.y - y)});
+            if (j % 2 == 0) {
+                x += length;
+            }
+            else {
+                y += length;
+            }
+        }
+    }
+    return error;
+}
+
+const std::vector<double>& Staircases::values() const
+{
+    return coords;
+}
+
+GCS::Point& Staircases::point(int staircase, int index)
+{
+    return points[staircase * (segments + 1) + index];
+}
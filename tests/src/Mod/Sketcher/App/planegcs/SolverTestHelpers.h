@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef SKETCHER_TESTS_SOLVERTESTHELPERS_H
+#define SKETCHER_TESTS_SOLVERTESTHELPERS_H
+
+#include <vector>
+
+#include "Mod/Sketcher/App/planegcs/GCS.h"
+
+namespace SolverTestHelpers
+{
+
+/** A synthetic, fully constrained sketch that can be made arbitrarily large
+ *
+ * It consists of independent staircases. Each one is a polyline starting at a
+ * fixed point whose segments are alternately horizontal and vertical and have
+ * a fixed length. The points start slightly off their solution.
+ */
+class Staircases
+{
+public:
+    /// Create \a count staircases of \a segments segments each
+    Staircases(int count, int segments);
+
+    /// Declare the unknowns and add the constraints to \a system
+    void addTo(GCS::System& system);
+    /// Move the points back to their perturbed start positions
+    void reset();
+
+    int constraintCount() const;
+    int parameterCount() const;
+    /// Largest distance of a point from its exact position
+    double maxError() const;
+    const std::vector<double>& values() const;
+    /// Point \a index of staircase \a staircase, index 0 is the fixed start point
+    GCS::Point& point(int staircase, int index);
+
+private:
+    int count;
+    int segments;
+    double length {10.0};
+    std::vector<double> origins;
+    std::vector<double> coords;
+    std::vector<GCS::Point> points;
+};
+
+}  // namespace SolverTestHelpers
+
+#endif  // SKETCHER_TESTS_SOLVERTESTHELPERS_H
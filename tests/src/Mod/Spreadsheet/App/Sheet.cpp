@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <App/VarSet.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    // integral results are stored as integer properties
+    double value(const char* address)
+    {
+        auto prop = _sheet->getPropertyByName(address);
+        if (auto floatProp = freecad_cast<App::PropertyFloat*>(prop)) {
+            return floatProp->getValue();
+        }
+        if (auto intProp = freecad_cast<App::PropertyInteger*>(prop)) {
+            return static_cast<double>(intProp->getValue());
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    bool dependsOn(App::DocumentObject* obj)
+    {
+        auto outList = _sheet->getOutList();
+        return std::find(outList.begin(), outList.end(), obj) != outList.end();
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, recomputeDependentCells)  // NOLINT
+{
+    // Arrange
+    sheet()->setCell("A1", "1.5");
+    sheet()->setCell("B1", "=A1 * 2");
+    sheet()->setCell("C1", "=B1 + 1");
+    sheet()->setCell("D1", "=7.5");
+    doc()->recompute();
+    ASSERT_DOUBLE_EQ(value("C1"), 4.0);
+
+    // Act
+    sheet()->setCell("A1", "2.5");
+    doc()->recompute();
+
+    // Assert
+    EXPECT_DOUBLE_EQ(value("B1"), 5.0);
+    EXPECT_DOUBLE_EQ(value("C1"), 6.0);
+    EXPECT_DOUBLE_EQ(value("D1"), 7.5);
+}
+
+TEST_F(SheetTest, editOfLocalCellKeepsExternalLinks)  // NOLINT
+{
+    // Arrange
+    auto varSet = freecad_cast<App::VarSet*>(doc()->addObject("App::VarSet", "VarSet"));
+    auto prop = freecad_cast<App::PropertyFloat*>(
+        varSet->addDynamicProperty("App::PropertyFloat", "Variable", "Variables"));
+    prop->setValue(3.0);
+    sheet()->setCell("A1", "=VarSet.Variable");
+    sheet()->setCell("B1", "=A1 + 1");
+    doc()->recompute();
+    ASSERT_TRUE(dependsOn(varSet));
+
+    // Act - cells that only refer to the sheet itself leave the links alone
+    sheet()->setCell("B1", "=A1 + 2");
+    sheet()->setCell("C1", "=B1");
+    doc()->recompute();
+
+    // Assert
+    EXPECT_TRUE(dependsOn(varSet));
+    EXPECT_DOUBLE_EQ(value("C1"), 5.0);
+
+    // Act - the last reference to the other object is removed
+    sheet()->setCell("A1", "1");
+    doc()->recompute();
+
+    // Assert
+    EXPECT_FALSE(dependsOn(varSet));
+    EXPECT_DOUBLE_EQ(value("C1"), 3.0);
+}
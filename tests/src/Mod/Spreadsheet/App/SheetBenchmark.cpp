@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Recompute timings of large sheets, see src/BenchmarkHelpers.h.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <App/VarSet.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+#include <src/App/InitApplication.h>
+#include <src/BenchmarkHelpers.h>
+
+namespace
+{
+
+// 20 columns of 1000 rows
+constexpr int numRows = 1000;
+constexpr int numColumns = 20;
+
+std::string address(int row, int col)
+{
+    return App::CellAddress(row, col).toString();
+}
+
+}  // namespace
+
+class SheetBenchmark: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("benchmark");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    // The first column holds parameters, every other cell refers to its left neighbour.
+    // Some cells of the last column depend on another object.
+    Spreadsheet::Sheet* createSheet()
+    {
+        auto varSet = freecad_cast<App::VarSet*>(doc()->addObject("App::VarSet", "VarSet"));
+        auto prop = freecad_cast<App::PropertyFloat*>(
+            varSet->addDynamicProperty("App::PropertyFloat", "Variable", "Variables"));
+        prop->setValue(1.0);
+
+        auto sheet = freecad_cast<Spreadsheet::Sheet*>(doc()->addObject("Spreadsheet::Sheet"));
+        for (int row = 0; row < numRows; ++row) {
+            sheet->setCell(address(row, 0).c_str(), std::to_string(row).c_str());
+            for (int col = 1; col < numColumns; ++col) {
+                std::string expr = "=" + address(row, col - 1) + " + 1";
+                if (col == numColumns - 1 && row % 100 == 0) {
+                    expr += " + VarSet.Variable";
+                }
+                sheet->setCell(address(row, col).c_str(), expr.c_str());
+            }
+        }
+        return sheet;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+};
+
+TEST_F(SheetBenchmark, editSingleCell)  // NOLINT
+{
+    auto start = std::chrono::steady_clock::now();
+    Spreadsheet::Sheet* sheet = createSheet();
+    tests::record("fill", tests::elapsedMilliseconds(start));
+
+    start = std::chrono::steady_clock::now();
+    doc()->recompute();
+    tests::record("recompute_all", tests::elapsedMilliseconds(start));
+
+    // A parameter with a chain of dependent cells
+    const int edits = 20;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < edits; ++i) {
+        sheet->setCell(address(i, 0).c_str(), std::to_string(i + 1000).c_str());
+        doc()->recompute();
+    }
+    tests::record("edit_parameter", tests::elapsedMilliseconds(start) / edits);
+
+    // A formula in the middle of a chain
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < edits; ++i) {
+        std::string expr = "=" + address(i, numColumns / 2 - 1) + " + 2";
+        sheet->setCell(address(i, numColumns / 2).c_str(), expr.c_str());
+        doc()->recompute();
+    }
+    tests::record("edit_formula", tests::elapsedMilliseconds(start) / edits);
+
+    auto prop = freecad_cast<App::PropertyInteger*>(
+        sheet->getPropertyByName(address(0, numColumns - 1).c_str()));
+    ASSERT_TRUE(prop);
+    EXPECT_EQ(prop->getValue(), 1000 + numColumns + 1);
+}